@@ -0,0 +1,120 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSLTE_SPSC_QUEUE_H
+#define SRSLTE_SPSC_QUEUE_H
+
+#include "srslte/adt/expected.h"
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ *
+ * @file spsc_queue.h
+ *
+ * @brief Bounded lock-free single-producer/single-consumer queue
+ *
+ * The producer and consumer indices are monotonically increasing counters padded into separate cache lines.
+ * Each side only writes its own index and reads the other one, so push and pop never block or take a lock.
+ * At most one thread may push and at most one thread may pop at any given time (callers that pop from
+ * several threads must serialize the pops themselves, e.g. under the mutex that already protects the consumer state).
+ */
+
+namespace srslte {
+
+template <typename T>
+class spsc_queue
+{
+  static const size_t cache_line_size = 64;
+
+public:
+  explicit spsc_queue(size_t capacity_ = 128) : buffer(capacity_ > 0 ? capacity_ : 1) {}
+  spsc_queue(const spsc_queue&) = delete;
+  spsc_queue& operator=(const spsc_queue&) = delete;
+
+  //! Non-blocking push. On failure (queue full) the object is handed back to the caller
+  srslte::error_type<T> try_push(T&& value)
+  {
+    size_t t = tail.load(std::memory_order_relaxed);
+    if (t - head.load(std::memory_order_acquire) >= buffer.size()) {
+      return std::move(value);
+    }
+    buffer[t % buffer.size()] = std::move(value);
+    tail.store(t + 1, std::memory_order_release);
+    return {};
+  }
+
+  //! Non-blocking pop. Returns false if the queue is empty
+  bool try_pop(T* value)
+  {
+    size_t h = head.load(std::memory_order_relaxed);
+    if (h == tail.load(std::memory_order_acquire)) {
+      return false;
+    }
+    T& slot = buffer[h % buffer.size()];
+    if (value != nullptr) {
+      *value = std::move(slot);
+    }
+    slot = T{};
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  //! Access to the oldest element. Only valid from the consumer side and if the queue is not empty
+  T& front() { return buffer[head.load(std::memory_order_relaxed) % buffer.size()]; }
+
+  size_t size() const { return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire); }
+  bool   empty() const { return size() == 0; }
+  bool   full() const { return size() >= buffer.size(); }
+  size_t capacity() const { return buffer.size(); }
+
+  /**
+   * Changes the queue capacity. The storage can only be reallocated while the queue is empty and neither producer
+   * nor consumer are active, otherwise the current capacity is kept.
+   * @return true if the queue has the new capacity
+   */
+  bool resize(size_t new_capacity)
+  {
+    if (new_capacity == buffer.size()) {
+      return true;
+    }
+    if (new_capacity == 0 or not empty()) {
+      return false;
+    }
+    std::vector<T>(new_capacity).swap(buffer);
+    head.store(0, std::memory_order_relaxed);
+    tail.store(0, std::memory_order_relaxed);
+    return true;
+  }
+
+private:
+  std::vector<T>      buffer;
+  char                pad0[cache_line_size];
+  std::atomic<size_t> head{0}; ///< written by the consumer only
+  char                pad1[cache_line_size - sizeof(std::atomic<size_t>)];
+  std::atomic<size_t> tail{0}; ///< written by the producer only
+  char                pad2[cache_line_size - sizeof(std::atomic<size_t>)];
+};
+
+} // namespace srslte
+
+#endif // SRSLTE_SPSC_QUEUE_H
@@ -28,6 +28,7 @@
 #include <cstring>
 #include <limits>
 #include <map>
+#include <new>
 #include <sstream>
 #include <stdarg.h> /* va_list, va_start, va_arg, va_end */
 #include <stdint.h>
@@ -84,6 +85,24 @@ struct ValOrError {
 template <typename T, typename Ptr>
 SRSASN_CODE unpack_bits(T& val, Ptr& ptr, uint8_t& offset, const uint8_t* max_ptr, uint32_t n_bits);
 
+// Big-endian 64-bit word at any address. Used by the bit_ref fast paths, which read and write whole words
+inline uint64_t load_be64(const uint8_t* p)
+{
+  uint64_t w;
+  memcpy(&w, p, sizeof(w));
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  w = __builtin_bswap64(w);
+#endif
+  return w;
+}
+inline void store_be64(uint8_t* p, uint64_t w)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  w = __builtin_bswap64(w);
+#endif
+  memcpy(p, &w, sizeof(w));
+}
+
 template <typename Ptr = uint8_t*>
 class bit_ref_impl
 {
@@ -104,6 +123,14 @@ public:
   template <class T>
   SRSASN_CODE unpack(T& val, uint32_t n_bits)
   {
+    // Fast path: the field is read with one word load when the 8 bytes at ptr are within the buffer
+    if (n_bits > 0 and n_bits <= sizeof(T) * 8 and offset + n_bits <= 64 and max_ptr - ptr >= 8) {
+      val          = static_cast<T>((load_be64(ptr) << offset) >> (64u - n_bits));
+      uint32_t end = offset + n_bits;
+      ptr += end / 8;
+      offset = end % 8;
+      return SRSASN_SUCCESS;
+    }
     return unpack_bits(val, ptr, offset, max_ptr, n_bits);
   }
   SRSASN_CODE unpack_bytes(uint8_t* buf, uint32_t n_bytes);
@@ -130,11 +157,138 @@ public:
   bit_ref() = default;
   bit_ref(uint8_t* start_ptr_, uint32_t max_size_) : bit_ref_impl(start_ptr_, max_size_) {}
 
-  SRSASN_CODE pack(uint32_t val, uint32_t n_bits);
+  SRSASN_CODE pack(uint32_t val, uint32_t n_bits)
+  {
+    // Fast path: read-modify-write of one word when the 8 bytes at ptr are within the buffer. As in the byte-wise
+    // path, the bits before the current position are kept and the rest of the last written byte is zeroed
+    if (n_bits > 0 and n_bits < 32 and max_ptr - ptr >= 8) {
+      uint32_t end   = offset + n_bits;
+      uint64_t field = (uint64_t)(val & ((1u << n_bits) - 1u)) << (64u - end);
+      uint64_t clear = (~0ull >> offset) & ~(~0ull >> (ceil_frac(end, 8u) * 8u));
+      store_be64(ptr, (load_be64(ptr) & ~clear) | field);
+      ptr += end / 8;
+      offset = end % 8;
+      return SRSASN_SUCCESS;
+    }
+    return pack_bitwise(val, n_bits);
+  }
   SRSASN_CODE pack_bytes(const uint8_t* buf, uint32_t n_bytes);
   SRSASN_CODE align_bytes_zero();
+
+private:
+  SRSASN_CODE pack_bitwise(uint32_t val, uint32_t n_bits);
+};
+
+/************************
+    arena allocator
+************************/
+
+/**
+ * Bump allocator for decoded messages. While an arena_scope is active in a thread, dyn_array and copy_ptr take their
+ * storage from its arena rather than from the heap, so that unpacking a message costs a few allocations at most.
+ * The memory is returned all at once by reset() or by the destructor, which must only be called once the containers
+ * allocated in the arena are destroyed. Copies made outside of the scope use the heap.
+ */
+class mem_arena
+{
+public:
+  explicit mem_arena(size_t chunk_size_ = 16384) : chunk_size(chunk_size_) {}
+  mem_arena(const mem_arena&) = delete;
+  mem_arena& operator=(const mem_arena&) = delete;
+  ~mem_arena();
+
+  void* allocate(size_t sz, size_t align)
+  {
+    uintptr_t p = (cur + align - 1) & ~(uintptr_t)(align - 1);
+    if (p + sz > end) {
+      return allocate_chunk(sz, align);
+    }
+    cur = p + sz;
+    return reinterpret_cast<void*>(p);
+  }
+  /// Releases all allocations. If they spanned several chunks, these are merged into one for the next message
+  void   reset();
+  size_t nof_bytes() const { return used + (cur - first_byte()); }
+  size_t nof_chunks() const;
+
+private:
+  struct chunk_t {
+    chunk_t* next;
+    size_t   size;
+  };
+
+  void*     allocate_chunk(size_t sz, size_t align);
+  uintptr_t first_byte() const { return chunks == nullptr ? cur : reinterpret_cast<uintptr_t>(chunks + 1); }
+
+  size_t    chunk_size;
+  chunk_t*  chunks = nullptr; ///< newest first
+  size_t    used   = 0;       ///< bytes allocated in the chunks other than the newest
+  uintptr_t cur    = 0;
+  uintptr_t end    = 0;
+};
+
+/// Arena used by the containers of the calling thread, or nullptr when they allocate on the heap
+mem_arena*& current_arena();
+
+/// Makes the containers of the calling thread allocate in an arena until the end of the scope
+class arena_scope
+{
+public:
+  explicit arena_scope(mem_arena& arena) : prev(current_arena()) { current_arena() = &arena; }
+  arena_scope(const arena_scope&) = delete;
+  arena_scope& operator=(const arena_scope&) = delete;
+  ~arena_scope() { current_arena() = prev; }
+
+private:
+  mem_arena* prev;
 };
 
+// Allocation of container storage. in_arena tells where it came from, as it has to be released accordingly
+template <class T>
+T* arena_new_array(uint32_t n, bool& in_arena)
+{
+  mem_arena* arena = current_arena();
+  in_arena         = arena != nullptr;
+  if (arena == nullptr) {
+    return new T[n];
+  }
+  T* ptr = static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+  for (uint32_t i = 0; i < n; ++i) {
+    new (&ptr[i]) T;
+  }
+  return ptr;
+}
+template <class T>
+void arena_delete_array(T* ptr, uint32_t n, bool in_arena)
+{
+  if (not in_arena) {
+    delete[] ptr;
+    return;
+  }
+  for (uint32_t i = 0; i < n; ++i) {
+    ptr[i].~T();
+  }
+}
+template <class T, class... Args>
+T* arena_new(bool& in_arena, Args&&... args)
+{
+  mem_arena* arena = current_arena();
+  in_arena         = arena != nullptr;
+  if (arena == nullptr) {
+    return new T(std::forward<Args>(args)...);
+  }
+  return new (arena->allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+}
+template <class T>
+void arena_delete(T* ptr, bool in_arena)
+{
+  if (in_arena) {
+    ptr->~T();
+  } else {
+    delete ptr;
+  }
+}
+
 /*********************
   function helpers
 *********************/
@@ -147,19 +301,22 @@ public:
   using const_iterator = const T*;
 
   dyn_array() = default;
-  explicit dyn_array(uint32_t new_size) : size_(new_size), cap_(new_size) { data_ = new T[size_]; }
+  explicit dyn_array(uint32_t new_size) : size_(new_size), cap_(new_size)
+  {
+    data_ = arena_new_array<T>(size_, in_arena_);
+  }
   dyn_array(const dyn_array<T>& other) : dyn_array(&other[0], other.size_) {}
   dyn_array(const T* ptr, uint32_t nof_items)
   {
     size_ = nof_items;
     cap_  = nof_items;
-    data_ = new T[cap_];
+    data_ = arena_new_array<T>(cap_, in_arena_);
     std::copy(ptr, ptr + size_, data_);
   }
   ~dyn_array()
   {
     if (data_ != NULL) {
-      delete[] data_;
+      arena_delete_array(data_, cap_, in_arena_);
     }
   }
   uint32_t      size() const { return size_; }
@@ -184,10 +341,12 @@ public:
       size_ = new_size;
       return;
     }
-    T* old_data = data_;
-    cap_        = new_size > new_cap ? new_size : new_cap;
+    T*       old_data     = data_;
+    uint32_t old_cap      = cap_;
+    bool     old_in_arena = in_arena_;
+    cap_                  = new_size > new_cap ? new_size : new_cap;
     if (cap_ > 0) {
-      data_ = new T[cap_];
+      data_ = arena_new_array<T>(cap_, in_arena_);
       if (old_data != NULL) {
         std::copy(&old_data[0], &old_data[size_], data_);
       }
@@ -196,7 +355,7 @@ public:
     }
     size_ = new_size;
     if (old_data != NULL) {
-      delete[] old_data;
+      arena_delete_array(old_data, old_cap, old_in_arena);
     }
   }
   iterator erase(iterator it)
@@ -231,9 +390,10 @@ public:
   const_iterator end() const { return &data_[size()]; }
 
 private:
-  T*       data_ = nullptr;
-  uint32_t size_ = 0;
-  uint32_t cap_  = 0;
+  T*       data_     = nullptr;
+  uint32_t size_     = 0;
+  uint32_t cap_      = 0;
+  bool     in_arena_ = false;
 };
 
 template <class T, uint32_t MAX_N>
@@ -654,9 +814,7 @@ SRSASN_CODE fixed_octstring<N, aligned>::pack(bit_ref& bref) const
   if (aligned and N > 2) {
     bref.align_bytes_zero();
   }
-  for (uint32_t i = 0; i < size(); ++i) {
-    HANDLE_CODE(bref.pack(octets_[i], 8));
-  }
+  HANDLE_CODE(bref.pack_bytes(octets_.data(), size()));
   return SRSASN_SUCCESS;
 }
 
@@ -666,9 +824,7 @@ SRSASN_CODE fixed_octstring<N, aligned>::unpack(cbit_ref& bref)
   if (aligned and N > 2) {
     bref.align_bytes();
   }
-  for (uint32_t i = 0; i < size(); ++i) {
-    HANDLE_CODE(bref.unpack(octets_[i], 8));
-  }
+  HANDLE_CODE(bref.unpack_bytes(octets_.data(), size()));
   return SRSASN_SUCCESS;
 }
 
@@ -1034,12 +1190,20 @@ public:
   explicit copy_ptr(T* ptr_ = nullptr) :
     ptr(ptr_) {} // it takes hold of the pointer (including destruction). You should use make_copy_ptr() in most cases
   // instead of this ctor
-  copy_ptr(const copy_ptr<T>& other) { ptr = (other.ptr == nullptr) ? nullptr : new T(*other.ptr); }
+  copy_ptr(const copy_ptr<T>& other) { ptr = (other.ptr == nullptr) ? nullptr : arena_new<T>(in_arena, *other.ptr); }
   ~copy_ptr() { destroy_(); }
   copy_ptr<T>& operator=(const copy_ptr<T>& other)
   {
     if (this != &other) {
-      reset((other.ptr == nullptr) ? nullptr : new T(*other.ptr));
+      if (other.ptr == nullptr) {
+        reset();
+      } else {
+        bool new_in_arena;
+        T*   new_ptr = arena_new<T>(new_in_arena, *other.ptr);
+        destroy_();
+        ptr      = new_ptr;
+        in_arena = new_in_arena;
+      }
     }
     return *this;
   }
@@ -1053,21 +1217,24 @@ public:
   T*       release()
   {
     T* ret = ptr;
-    ptr    = nullptr;
+    if (in_arena and ret != nullptr) {
+      // the caller owns the returned object, so it must live on the heap
+      ret = new T(std::move(*ptr));
+      destroy_();
+    }
+    ptr = nullptr;
     return ret;
   }
   void reset(T* ptr_ = nullptr)
   {
     destroy_();
-    ptr = ptr_;
+    ptr      = ptr_;
+    in_arena = false;
   }
   void set_present(bool flag = true)
   {
-    if (flag) {
-      reset(new T());
-    } else {
-      reset();
-    }
+    destroy_();
+    ptr = flag ? arena_new<T>(in_arena) : nullptr;
   }
   bool is_present() const { return get() != nullptr; }
 
@@ -1075,16 +1242,20 @@ private:
   void destroy_()
   {
     if (ptr != NULL) {
-      delete ptr;
+      arena_delete(ptr, in_arena);
     }
   }
-  T* ptr;
+  T*   ptr;
+  bool in_arena = false;
 };
 
 template <class T>
 copy_ptr<T> make_copy_ptr(const T& t)
 {
-  return copy_ptr<T>(new T(t));
+  copy_ptr<T> ret;
+  ret.set_present();
+  *ret = t;
+  return ret;
 }
 
 /*********************
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        aes128.h
+ * Description: AES-128 block cipher with a precomputed key context, used by
+ *              the EEA2 (CTR) and EIA2 (CMAC) algorithms of TS 33.401 B.1.3
+ *              and B.2.3. The key schedule and the CMAC subkeys are expanded
+ *              once per key, so per-PDU processing only runs the cipher
+ *              rounds. Uses AES-NI when the compiler targets it and a
+ *              table-based software implementation otherwise.
+ *****************************************************************************/
+
+#ifndef SRSLTE_AES128_H
+#define SRSLTE_AES128_H
+
+#include <stdint.h>
+
+namespace srslte {
+
+#define AES128_BLOCK_LEN 16
+#define AES128_NOF_ROUNDS 10
+
+struct aes128_key_ctx_t {
+  uint8_t  rk[(AES128_NOF_ROUNDS + 1) * AES128_BLOCK_LEN]; // round keys, FIPS-197 byte order
+  uint32_t rk_w[(AES128_NOF_ROUNDS + 1) * 4];               // round keys as big-endian words
+  uint8_t  cmac_k1[AES128_BLOCK_LEN];                       // RFC 4493 subkey K1
+  uint8_t  cmac_k2[AES128_BLOCK_LEN];                       // RFC 4493 subkey K2
+  bool     valid = false;
+};
+
+// Job descriptor for the batched CTR/CMAC calls. For CTR, iv is the initial counter block and out receives len bytes.
+// For CMAC, the tag is computed over iv[0..7] || msg[0..len-1] (the EIA2 message M) and its 16 bytes written to out.
+struct aes128_job_t {
+  const uint8_t* msg;
+  uint32_t       len;
+  uint8_t        iv[AES128_BLOCK_LEN];
+  uint8_t*       out;
+};
+
+void aes128_set_key(aes128_key_ctx_t* ctx, const uint8_t* key);
+
+void aes128_encrypt_block(const aes128_key_ctx_t* ctx, const uint8_t* in, uint8_t* out);
+
+// Encrypts nof_blocks independent blocks in place, block i under the key of ctxs[i]. Blocks of different keys share the
+// AES pipeline, e.g. the Milenage blocks of several subscribers.
+void aes128_ecb_multi(const aes128_key_ctx_t* const* ctxs, uint8_t (*blocks)[AES128_BLOCK_LEN], uint32_t nof_blocks);
+
+void aes128_ctr(const aes128_key_ctx_t* ctx, aes128_job_t* jobs, uint32_t nof_jobs);
+
+void aes128_cmac(const aes128_key_ctx_t* ctx, aes128_job_t* jobs, uint32_t nof_jobs);
+
+const char* aes128_impl_name();
+
+} // namespace srslte
+
+#endif // SRSLTE_AES128_H
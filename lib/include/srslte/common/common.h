@@ -30,6 +30,7 @@
 #include <memory>
 #include <stdint.h>
 #include <string.h>
+#include <vector>
 
 /*******************************************************************************
                               DEFINES
@@ -267,6 +268,9 @@ public:
 
 typedef std::unique_ptr<byte_buffer_t, byte_buffer_deleter> unique_byte_buffer_t;
 
+// Ordered batch of buffers of the same bearer, handed between layers in a single call
+typedef std::vector<unique_byte_buffer_t> unique_byte_buffer_list_t;
+
 ///
 /// Utilities to create a span out of a byte_buffer.
 ///
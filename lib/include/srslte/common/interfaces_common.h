@@ -59,6 +59,7 @@ typedef struct {
   std::string device_args;
   std::string time_adv_nsamples;
   std::string continuous_tx;
+  std::string resampler; // Resampler used with a forced sampling rate: fft or polyphase
 
   std::array<rf_args_band_t, SRSLTE_MAX_CARRIERS> ch_rx_bands;
   std::array<rf_args_band_t, SRSLTE_MAX_CARRIERS> ch_tx_bands;
@@ -0,0 +1,210 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        latency_probe.h
+ * Description: Low-overhead latency instrumentation of the TTI processing
+ *              chain. Scoped probes read the CPU timestamp counter and record
+ *              the elapsed time in per-thread HDR histograms, one per fixed
+ *              probe point, which are merged on demand for the metrics and
+ *              the SIGUSR1 dump. Probes are compiled out unless
+ *              ENABLE_LATENCY_PROBES is defined, and skipped at run-time
+ *              until latency_probes::set_enabled() is called.
+ *****************************************************************************/
+
+#ifndef SRSLTE_LATENCY_PROBE_H
+#define SRSLTE_LATENCY_PROBE_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace srslte {
+
+// Fixed probe points of the TTI processing chain
+enum class probe_point : uint32_t {
+  radio_rx = 0,
+  worker_ul,
+  worker_dl,
+  mac_dl_sched,
+  sched_dl,
+  pdsch_encode,
+  sch_decode,
+  radio_tx,
+  nof_points
+};
+
+constexpr uint32_t nof_probe_points = static_cast<uint32_t>(probe_point::nof_points);
+
+const char* to_string(probe_point p);
+
+/**
+ * Log-linear (HDR) histogram of durations in nanoseconds. Each power of two magnitude is split in SUB_BUCKETS linear
+ * buckets, so any value is stored with a relative error below 1/SUB_BUCKETS using a fixed amount of memory.
+ * A single thread records into a histogram while others may read or merge it concurrently.
+ */
+class hdr_histogram
+{
+public:
+  static const uint32_t SUB_BUCKET_BITS = 4;
+  static const uint32_t SUB_BUCKETS     = 1u << SUB_BUCKET_BITS;
+  static const uint32_t MAGNITUDES      = 40; // Up to 2^43 ns
+  static const uint32_t NOF_BUCKETS     = (MAGNITUDES + 1) * SUB_BUCKETS;
+
+  hdr_histogram() { reset(); }
+  hdr_histogram(const hdr_histogram&) = delete;
+  hdr_histogram& operator=(const hdr_histogram&) = delete;
+
+  void record(uint64_t value)
+  {
+    inc(buckets[bucket_idx(value)], 1);
+    inc(total, 1);
+    inc(sum, value);
+    if (value > max.load(std::memory_order_relaxed)) {
+      max.store(value, std::memory_order_relaxed);
+    }
+  }
+
+  // Adds the samples of other to this histogram
+  void merge(const hdr_histogram& other);
+  void reset();
+
+  uint64_t count() const { return total.load(std::memory_order_relaxed); }
+  uint64_t max_value() const { return max.load(std::memory_order_relaxed); }
+  double   mean() const;
+  // Value below which the given fraction (0 to 1) of the samples fall, within the histogram precision
+  uint64_t percentile(double q) const;
+
+  static uint32_t bucket_idx(uint64_t value)
+  {
+    if (value < SUB_BUCKETS) {
+      return (uint32_t)value;
+    }
+    uint32_t msb = 63 - __builtin_clzll(value);
+    uint32_t mag = msb - SUB_BUCKET_BITS + 1;
+    if (mag > MAGNITUDES) {
+      return NOF_BUCKETS - 1;
+    }
+    return mag * SUB_BUCKETS + (uint32_t)((value >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+  }
+  static uint64_t bucket_lower_bound(uint32_t idx)
+  {
+    uint32_t mag = idx / SUB_BUCKETS;
+    uint64_t sub = idx % SUB_BUCKETS;
+    return mag == 0 ? sub : (SUB_BUCKETS + sub) << (mag - 1);
+  }
+
+private:
+  // Only the owner thread writes, so a relaxed load and store is enough and avoids a locked instruction
+  static void inc(std::atomic<uint64_t>& v, uint64_t n)
+  {
+    v.store(v.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+  }
+
+  std::array<std::atomic<uint64_t>, NOF_BUCKETS> buckets;
+  std::atomic<uint64_t>                          total;
+  std::atomic<uint64_t>                          sum;
+  std::atomic<uint64_t>                          max;
+};
+
+// Summary of one probe point, merged across all the threads that recorded it
+struct latency_probe_stats_t {
+  uint64_t count   = 0;
+  double   mean_us = 0;
+  double   p50_us  = 0;
+  double   p99_us  = 0;
+  double   p999_us = 0;
+  double   max_us  = 0;
+};
+
+using latency_probe_stats_list_t = std::array<latency_probe_stats_t, nof_probe_points>;
+
+class latency_probes
+{
+public:
+  // Enables the recording, the timestamp counter is calibrated the first time
+  static void set_enabled(bool enable);
+  static bool is_enabled() { return enabled.load(std::memory_order_relaxed); }
+
+  static uint64_t now()
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+  }
+
+  // Records a duration in timestamp counter units into the histogram of the calling thread
+  static void record(probe_point p, uint64_t ticks);
+
+  static void get_stats(latency_probe_stats_list_t& stats);
+  static void dump(FILE* f);
+
+  // Installs a handler that requests a dump on the signal, which the application polls with dump_requested()
+  static void install_dump_handler(int signum);
+  static bool dump_requested() { return dump_request.exchange(false); }
+
+private:
+  static std::atomic<bool> enabled;
+  static std::atomic<bool> dump_request;
+};
+
+class scoped_latency_probe
+{
+public:
+  explicit scoped_latency_probe(probe_point p_) : p(p_), t0(latency_probes::is_enabled() ? latency_probes::now() : 0)
+  {
+  }
+  ~scoped_latency_probe()
+  {
+    if (t0 != 0) {
+      latency_probes::record(p, latency_probes::now() - t0);
+    }
+  }
+  scoped_latency_probe(const scoped_latency_probe&) = delete;
+  scoped_latency_probe& operator=(const scoped_latency_probe&) = delete;
+
+private:
+  probe_point p;
+  uint64_t    t0;
+};
+
+} // namespace srslte
+
+#ifdef ENABLE_LATENCY_PROBES
+#define SRSLTE_LATENCY_PROBE_CONCAT_(a, b) a##b
+#define SRSLTE_LATENCY_PROBE_CONCAT(a, b) SRSLTE_LATENCY_PROBE_CONCAT_(a, b)
+// Measures the time until the end of the enclosing scope
+#define SRSLTE_LATENCY_PROBE(point)                                                                                    \
+  srslte::scoped_latency_probe SRSLTE_LATENCY_PROBE_CONCAT(latency_probe_, __LINE__)(srslte::probe_point::point)
+#else
+#define SRSLTE_LATENCY_PROBE(point)
+#endif
+
+#endif // SRSLTE_LATENCY_PROBE_H
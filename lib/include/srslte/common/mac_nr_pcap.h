@@ -22,6 +22,7 @@
 #ifndef SRSLTE_MAC_NR_PCAP_H
 #define SRSLTE_MAC_NR_PCAP_H
 
+#include "srslte/common/pcap_writer.h"
 #include <string>
 
 namespace srslte {
@@ -32,11 +33,16 @@ public:
   mac_nr_pcap();
   ~mac_nr_pcap();
   void enable(const bool& enable_);
-  void open(const std::string& filename, const uint16_t& ue_id = 0);
+  void open(const std::string& filename, const uint16_t& ue_id = 0, const pcap_writer_args_t& args = {});
   void close();
 
   void set_ue_id(const uint16_t& ue_id);
 
+  //! Only C-RNTI PDUs of the RNTIs in the filter are captured. Must be set before open()
+  void set_filter(const pcap_filter& filter_) { filter = filter_; }
+
+  pcap_writer_stats_t get_stats() const { return writer.get_stats(); }
+
   void write_dl_crnti(uint8_t* pdu, uint32_t pdu_len_bytes, uint16_t crnti, uint8_t harqid, uint32_t tti);
   void write_ul_crnti(uint8_t* pdu, uint32_t pdu_len_bytes, uint16_t rnti, uint8_t harqid, uint32_t tti);
   void write_dl_ra_rnti(uint8_t* pdu, uint32_t pdu_len_bytes, uint16_t rnti, uint8_t harqid, uint32_t tti);
@@ -47,8 +53,9 @@ public:
 private:
   bool        enable_write = false;
   std::string filename;
-  FILE*       pcap_file = nullptr;
-  uint32_t    ue_id     = 0;
+  pcap_writer writer;
+  pcap_filter filter;
+  uint32_t    ue_id = 0;
   void        pack_and_write(uint8_t* pdu,
                              uint32_t pdu_len_bytes,
                              uint32_t tti,
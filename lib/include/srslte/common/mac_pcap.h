@@ -22,7 +22,7 @@
 #ifndef SRSLTE_MAC_PCAP_H
 #define SRSLTE_MAC_PCAP_H
 
-#include "srslte/common/pcap.h"
+#include "srslte/common/pcap_writer.h"
 #include <stdint.h>
 
 namespace srslte {
@@ -33,11 +33,16 @@ public:
   mac_pcap();
   ~mac_pcap();
   void enable(bool en);
-  void open(const char* filename, uint32_t ue_id = 0);
+  void open(const char* filename, uint32_t ue_id = 0, const pcap_writer_args_t& args = {});
   void close();
 
   void set_ue_id(uint16_t ue_id);
 
+  //! Only C-RNTI (and SL-RNTI) PDUs of the RNTIs in the filter are captured. Must be set before open()
+  void set_filter(const pcap_filter& filter_) { filter = filter_; }
+
+  pcap_writer_stats_t get_stats() const { return writer.get_stats(); }
+
   void
        write_ul_crnti(uint8_t* pdu, uint32_t pdu_len_bytes, uint16_t crnti, uint32_t reTX, uint32_t tti, uint8_t cc_idx);
   void write_dl_crnti(uint8_t* pdu, uint32_t pdu_len_bytes, uint16_t crnti, bool crc_ok, uint32_t tti, uint8_t cc_idx);
@@ -55,18 +60,19 @@ public:
   void write_sl_crnti(uint8_t* pdu, uint32_t pdu_len_bytes, uint16_t rnti, uint32_t reTX, uint32_t tti, uint8_t cc_idx);
 
 private:
-  bool     enable_write;
-  FILE*    pcap_file;
-  uint32_t ue_id;
-  void     pack_and_write(uint8_t* pdu,
-                          uint32_t pdu_len_bytes,
-                          uint32_t reTX,
-                          bool     crc_ok,
-                          uint8_t  cc_idx,
-                          uint32_t tti,
-                          uint16_t crnti_,
-                          uint8_t  direction,
-                          uint8_t  rnti_type);
+  bool        enable_write;
+  pcap_writer writer;
+  pcap_filter filter;
+  uint32_t    ue_id;
+  void        pack_and_write(uint8_t* pdu,
+                             uint32_t pdu_len_bytes,
+                             uint32_t reTX,
+                             bool     crc_ok,
+                             uint8_t  cc_idx,
+                             uint32_t tti,
+                             uint16_t crnti_,
+                             uint8_t  direction,
+                             uint8_t  rnti_type);
 };
 
 } // namespace srslte
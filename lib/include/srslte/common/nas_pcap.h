@@ -22,7 +22,7 @@
 #ifndef SRSLTE_NAS_PCAP_H
 #define SRSLTE_NAS_PCAP_H
 
-#include "srslte/common/pcap.h"
+#include "srslte/common/pcap_writer.h"
 
 namespace srslte {
 
@@ -33,18 +33,19 @@ public:
   {
     enable_write = false;
     ue_id        = 0;
-    pcap_file    = NULL;
   }
   void enable();
-  void open(const char* filename, uint32_t ue_id = 0);
+  void open(const char* filename, uint32_t ue_id = 0, const pcap_writer_args_t& args = {});
   void close();
   void write_nas(uint8_t* pdu, uint32_t pdu_len_bytes);
 
+  pcap_writer_stats_t get_stats() const { return writer.get_stats(); }
+
 private:
-  bool     enable_write;
-  FILE*    pcap_file;
-  uint32_t ue_id;
-  void     pack_and_write(uint8_t* pdu, uint32_t pdu_len_bytes);
+  bool        enable_write;
+  pcap_writer writer;
+  uint32_t    ue_id;
+  void        pack_and_write(uint8_t* pdu, uint32_t pdu_len_bytes);
 };
 
 } // namespace srslte
@@ -126,6 +126,7 @@ public:
   };
   using task_callback_t     = std::unique_ptr<recv_task>;
   using recvfrom_callback_t = std::function<void(srslte::unique_byte_buffer_t, const sockaddr_in&)>;
+  using recvmmsg_callback_t = std::function<void(srslte::unique_byte_buffer_list_t, std::vector<sockaddr_in>)>;
   using sctp_recv_callback_t =
       std::function<void(srslte::unique_byte_buffer_t, const sockaddr_in&, const sctp_sndrcvinfo&, int)>;
 
@@ -142,6 +143,8 @@ public:
   // convenience methods for recv using buffer pool
   bool add_socket_pdu_handler(int fd, recvfrom_callback_t pdu_task);
   bool add_socket_sctp_pdu_handler(int fd, sctp_recv_callback_t task);
+  // reads all the datagrams pending in the socket with a single recvmmsg(...) call
+  bool add_socket_pdu_batch_handler(int fd, recvmmsg_callback_t pdu_task);
 
   void run_thread() override;
 
@@ -186,10 +186,24 @@ typedef struct S1AP_Context_Info_s {
   unsigned char dummy;
 } S1AP_Context_Info_t;
 
+/* Upper bound of the context header that any of the dissectors above puts before the PDU */
+#define PCAP_CONTEXT_HEADER_MAX 256
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* Fill in the header written at the start of every file */
+void LTE_PCAP_Init_File_Header(pcap_hdr_t* file_header, uint32_t DLT);
+
+/* Fill in the PCAP packet header of a record of length bytes (context header + PDU) with the current time */
+void LTE_PCAP_Init_Packet_Header(pcaprec_hdr_t* packet_header, unsigned int length);
+
+/* Pack the context header of a PDU into context_header (at least PCAP_CONTEXT_HEADER_MAX bytes), returns its length */
+int LTE_PCAP_MAC_Pack_Context(uint8_t* context_header, const MAC_Context_Info_t* context);
+int LTE_PCAP_RLC_Pack_Context(uint8_t* context_header, const RLC_Context_Info_t* context, unsigned int length);
+int NR_PCAP_MAC_Pack_Context(uint8_t* context_header, const mac_nr_context_info_t* context, unsigned int length);
+
 /* Open the file and write file header */
 FILE* LTE_PCAP_Open(uint32_t DLT, const char* fileName);
 
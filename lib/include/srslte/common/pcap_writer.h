@@ -0,0 +1,175 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        pcap_writer.h
+ * Description: Asynchronous PCAP file writer shared by the MAC, RLC, S1AP and
+ *              NAS captures. Producers format each record straight into a
+ *              lock-free multi-producer byte ring and return; a writer thread
+ *              drains the ring into large write() calls, rotates the output
+ *              file by size or age and accounts for dropped records.
+ *****************************************************************************/
+
+#ifndef SRSLTE_PCAP_WRITER_H
+#define SRSLTE_PCAP_WRITER_H
+
+#include "srslte/common/pcap.h"
+#include "srslte/common/threads.h"
+#include <atomic>
+#include <bitset>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <time.h>
+#include <vector>
+
+namespace srslte {
+
+struct pcap_writer_args_t {
+  uint32_t ring_size_kb     = 8192; // capture ring, rounded up to a power of two
+  uint32_t batch_size_kb    = 256;  // records are written to the file in chunks of this size
+  uint32_t flush_period_ms  = 20;   // maximum time a record waits in the ring when the capture rate is low
+  uint32_t max_file_size_mb = 0;    // start a new file when the current one reaches this size, 0 disables
+  uint32_t rotate_period_s  = 0;    // start a new file every rotate_period_s seconds, 0 disables
+};
+
+struct pcap_writer_stats_t {
+  uint64_t nof_records;      // records written to the file(s)
+  uint64_t nof_bytes;        // bytes written to the file(s), including file headers
+  uint64_t nof_dropped;      // records discarded because the ring was full or the writer closed
+  uint64_t nof_filtered;     // records discarded by the capture filter
+  uint64_t nof_write_errors; // failed write() calls, the batch is lost
+  uint32_t nof_files;        // files opened, i.e. rotations + 1
+};
+
+/**
+ * Per-RNTI and per-LCID capture filter, evaluated by the producers before anything is copied. An empty set matches
+ * everything. Filters must be configured before the capture is opened.
+ */
+class pcap_filter
+{
+public:
+  void set_rntis(const std::vector<uint16_t>& rntis_);
+  void set_lcids(const std::vector<uint32_t>& lcids_);
+
+  //! Parses a comma separated list of decimal or 0x prefixed hex values. Returns false on a malformed list
+  bool set_rntis(const std::string& list);
+  bool set_lcids(const std::string& list);
+
+  bool match_rnti(uint16_t rnti) const { return all_rntis or rntis.test(rnti); }
+  bool match_lcid(uint32_t lcid) const { return all_lcids or (lcid < max_lcids and lcids.test(lcid)); }
+
+private:
+  static const uint32_t max_lcids = 64;
+
+  bool                   all_rntis = true;
+  bool                   all_lcids = true;
+  std::bitset<1u << 16>  rntis;
+  std::bitset<max_lcids> lcids;
+};
+
+class pcap_writer : public thread
+{
+public:
+  pcap_writer();
+  ~pcap_writer();
+  pcap_writer(const pcap_writer&) = delete;
+  pcap_writer& operator=(const pcap_writer&) = delete;
+
+  //! Creates filename, writes the file header for the given DLT and starts the writer thread
+  bool open(const std::string& filename, uint32_t dlt, const pcap_writer_args_t& args = {});
+
+  //! Stops accepting records, writes everything already in the ring and closes the file
+  void close();
+
+  bool is_open() const { return accepting.load(std::memory_order_relaxed); }
+
+  /**
+   * Copies one record, made of an optional context header and the PDU, into the ring together with its PCAP packet
+   * header and timestamp. Can be called concurrently from any number of threads and never blocks; returns false, and
+   * counts a drop, if the ring is full or the writer is closed.
+   */
+  bool write(const uint8_t* context, uint32_t context_len, const uint8_t* pdu, uint32_t pdu_len);
+
+  //! Accounts for a record discarded by the caller's capture filter
+  void count_filtered() { nof_filtered.fetch_add(1, std::memory_order_relaxed); }
+
+  pcap_writer_stats_t get_stats() const;
+
+  //! Name of the file being written
+  std::string get_filename() const;
+
+protected:
+  //! Writer thread body, overridable so that tests can hold the writer back and fill the ring deterministically
+  void run_thread() override;
+
+private:
+  struct record_header_t;
+
+  bool drain();
+  void append(const uint8_t* data, uint32_t len);
+  void flush_batch();
+  bool open_file();
+  void close_file();
+  void rotate();
+  bool rotation_due() const;
+
+  record_header_t* header_at(uint64_t pos) const;
+
+  static const size_t cache_line_size = 64;
+
+  // Producer side, padded into its own cache line without over-aligning the writer or the objects embedding it
+  std::unique_ptr<uint8_t[]> ring;
+  uint64_t                   ring_size = 0;
+  std::atomic<bool>          accepting{false};
+  char                       pad0[cache_line_size];
+  std::atomic<uint64_t>      head{0};
+  std::atomic<uint64_t>      nof_dropped{0};
+  std::atomic<uint64_t>      nof_filtered{0};
+  char                       pad1[cache_line_size - 3 * sizeof(std::atomic<uint64_t>)];
+
+  // Consumer side
+  std::atomic<uint64_t>   tail{0};
+  char                    pad2[cache_line_size - sizeof(std::atomic<uint64_t>)];
+  std::atomic<bool>       running{false};
+  std::mutex              mutex;
+  std::condition_variable cvar;
+
+  // Writer thread state
+  pcap_writer_args_t    args;
+  std::string           base_filename;
+  std::string           cur_filename;
+  uint32_t              dlt        = 0;
+  int                   fd         = -1;
+  uint64_t              file_bytes = 0;
+  struct timespec       file_start = {};
+  std::vector<uint8_t>  batch;
+  std::atomic<uint64_t> nof_records{0};
+  std::atomic<uint64_t> nof_bytes{0};
+  std::atomic<uint64_t> nof_write_errors{0};
+  std::atomic<uint32_t> nof_files{0};
+  mutable std::mutex    filename_mutex;
+};
+
+} // namespace srslte
+
+#endif // SRSLTE_PCAP_WRITER_H
@@ -22,26 +22,24 @@
 #ifndef SRSLTE_S1AP_PCAP_H
 #define SRSLTE_S1AP_PCAP_H
 
-#include "srslte/common/pcap.h"
+#include "srslte/common/pcap_writer.h"
 
 namespace srslte {
 
 class s1ap_pcap
 {
 public:
-  s1ap_pcap()
-  {
-    enable_write = false;
-    pcap_file    = NULL;
-  }
+  s1ap_pcap() { enable_write = false; }
   void enable();
-  void open(const char* filename);
+  void open(const char* filename, const pcap_writer_args_t& args = {});
   void close();
   void write_s1ap(uint8_t* pdu, uint32_t pdu_len_bytes);
 
+  pcap_writer_stats_t get_stats() const { return writer.get_stats(); }
+
 private:
-  bool  enable_write;
-  FILE* pcap_file;
+  bool        enable_write;
+  pcap_writer writer;
 };
 
 } // namespace srslte
@@ -26,6 +26,7 @@
  * Common security header - wraps ciphering/integrity check algorithms.
  *****************************************************************************/
 
+#include "srslte/common/aes128.h"
 #include "srslte/common/common.h"
 
 namespace srslte {
@@ -78,6 +79,34 @@ struct as_security_config_t {
   CIPHERING_ALGORITHM_ID_ENUM cipher_algo;
 };
 
+// One PDU of a batched EEA2/EIA2 call. All PDUs of a batch share the key context, bearer and direction.
+struct security_pdu_t {
+  uint8_t* msg;
+  uint32_t msg_len;
+  uint32_t count;
+  uint8_t* out; // msg_len bytes of ciphered/deciphered output for EEA2 (may equal msg), 4 byte MAC-I for EIA2
+};
+
+// Milenage state of one subscriber: the expanded key schedule of K and the precomputed OPc
+struct milenage_ctx_t {
+  aes128_key_ctx_t k;
+  uint8_t          opc[16];
+};
+
+// One authentication vector of a batched Milenage call. rand, sqn and amf are inputs, the other fields receive the
+// outputs of f1 to f5. Vectors of a batch may belong to different subscribers.
+struct milenage_vector_t {
+  const milenage_ctx_t* ctx;
+  uint8_t               rand[16];
+  uint8_t               sqn[6];
+  uint8_t               amf[2];
+  uint8_t               mac_a[8];
+  uint8_t               res[8];
+  uint8_t               ck[16];
+  uint8_t               ik[16];
+  uint8_t               ak[6];
+};
+
 /******************************************************************************
  * Key Generation
  *****************************************************************************/
@@ -132,6 +161,20 @@ uint8_t security_128_eia2(const uint8_t* key,
                           uint32_t       msg_len,
                           uint8_t*       mac);
 
+uint8_t security_128_eia2(const aes128_key_ctx_t* ctx,
+                          uint32_t                count,
+                          uint32_t                bearer,
+                          uint8_t                 direction,
+                          uint8_t*                msg,
+                          uint32_t                msg_len,
+                          uint8_t*                mac);
+
+uint8_t security_128_eia2_batch(const aes128_key_ctx_t* ctx,
+                                uint32_t                bearer,
+                                uint8_t                 direction,
+                                security_pdu_t*         pdus,
+                                uint32_t                nof_pdus);
+
 uint8_t security_128_eia3(const uint8_t* key,
                           uint32_t       count,
                           uint32_t       bearer,
@@ -161,6 +204,20 @@ uint8_t security_128_eea2(uint8_t* key,
                           uint32_t msg_len,
                           uint8_t* msg_out);
 
+uint8_t security_128_eea2(const aes128_key_ctx_t* ctx,
+                          uint32_t                count,
+                          uint8_t                 bearer,
+                          uint8_t                 direction,
+                          uint8_t*                msg,
+                          uint32_t                msg_len,
+                          uint8_t*                msg_out);
+
+uint8_t security_128_eea2_batch(const aes128_key_ctx_t* ctx,
+                                uint8_t                 bearer,
+                                uint8_t                 direction,
+                                security_pdu_t*         pdus,
+                                uint32_t                nof_pdus);
+
 uint8_t security_128_eea3(uint8_t* key,
                           uint32_t count,
                           uint8_t  bearer,
@@ -183,5 +240,9 @@ security_milenage_f2345(uint8_t* k, uint8_t* op, uint8_t* rand, uint8_t* res, ui
 
 uint8_t security_milenage_f5_star(uint8_t* k, uint8_t* op, uint8_t* rand, uint8_t* ak);
 
+void security_milenage_init(milenage_ctx_t* ctx, const uint8_t* k, const uint8_t* opc);
+
+uint8_t security_milenage_f12345_batch(milenage_vector_t* vectors, uint32_t nof_vectors);
+
 } // namespace srslte
 #endif // SRSLTE_SECURITY_H
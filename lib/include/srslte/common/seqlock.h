@@ -0,0 +1,81 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSLTE_SEQLOCK_H
+#define SRSLTE_SEQLOCK_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ *
+ * @file seqlock.h
+ *
+ * @brief Sequence lock for data that is written rarely and read from any thread without blocking the writer
+ *
+ * The sequence counter is odd while a write is in progress. Readers take the sequence before copying the protected
+ * data and retry if it was odd or has changed by the time the copy is finished. The protected fields must themselves
+ * be std::atomic and be accessed with relaxed ordering, so that a read racing with a write is not undefined behaviour;
+ * the fences below order those relaxed accesses against the sequence counter. Writers must be serialized by the caller.
+ */
+
+namespace srslte {
+
+class seqlock
+{
+public:
+  seqlock()               = default;
+  seqlock(const seqlock&) = delete;
+  seqlock& operator=(const seqlock&) = delete;
+
+  void write_begin()
+  {
+    uint32_t s = seq.load(std::memory_order_relaxed);
+    seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+
+  void write_end() { seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+  //! Returns the (even) sequence to be passed to read_retry() once the protected data has been copied
+  uint32_t read_begin() const
+  {
+    uint32_t s = seq.load(std::memory_order_acquire);
+    while (s & 1u) {
+      s = seq.load(std::memory_order_acquire);
+    }
+    return s;
+  }
+
+  //! True if a write started or completed since read_begin(), in which case the copy must be discarded
+  bool read_retry(uint32_t s) const
+  {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return seq.load(std::memory_order_relaxed) != s;
+  }
+
+private:
+  std::atomic<uint32_t> seq{0};
+};
+
+} // namespace srslte
+
+#endif // SRSLTE_SEQLOCK_H
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        thread_topology.h
+ * Description: Run-time placement of srsLTE threads. Every thread is mapped by
+ *              name to a thread class (PHY workers, txrx, stack, ...) and each
+ *              class can be given a CPU set, a scheduling policy and priority
+ *              from the [threads] section of the configuration file. Threads
+ *              apply their class settings when they start, and optionally
+ *              prefer memory from the NUMA node their CPUs belong to.
+ *****************************************************************************/
+
+#ifndef SRSLTE_THREAD_TOPOLOGY_H
+#define SRSLTE_THREAD_TOPOLOGY_H
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <sched.h>
+#include <stdio.h>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+namespace srslte {
+
+/// Placement of one thread class as given in the configuration
+struct thread_class_args_t {
+  std::string cpus;      ///< CPU list, e.g. "2-5,8". Empty keeps the affinity chosen by the code
+  std::string policy;    ///< "fifo", "rr" or "other". Empty keeps the policy chosen by the code
+  int         prio = -1; ///< Absolute scheduling priority for fifo/rr, -1 to use the policy default
+};
+
+struct thread_topology_args_t {
+  bool                                       numa   = false; ///< Prefer memory local to each class' CPUs
+  bool                                       report = false; ///< Print the layout even if no class is configured
+  std::map<std::string, thread_class_args_t> classes;        ///< Indexed by thread class name
+};
+
+class thread_topology
+{
+public:
+  static thread_topology& get();
+
+  /// Names of all known thread classes, in report order
+  static const std::vector<std::string>& class_names();
+
+  /// Returns the class a thread belongs to given its name, or an empty string if it is not known
+  static std::string classify(const std::string& thread_name);
+
+  static bool parse_cpu_list(const std::string& list, cpu_set_t* set);
+  static bool parse_policy(const std::string& policy, int* sched_policy);
+
+  /**
+   * Validates and stores the thread layout. Threads already running are moved to their class settings, the ones
+   * created afterwards apply them from srslte::thread. With NUMA placement enabled, the calling thread prefers the
+   * memory node of the PHY workers so that the buffers allocated during the initialization land next to them.
+   * Returns false if any entry is invalid, in which case nothing is applied.
+   */
+  bool configure(const thread_topology_args_t& args);
+
+  /// True once a layout with at least one configured class has been applied
+  bool active() const { return configured; }
+
+  /// Applies the class settings to the calling thread. Cheap no-op while no layout is configured
+  void apply_self(const std::string& thread_name);
+
+  /// Prints the effective CPU set, policy and priority of every thread of the process
+  void print_report(FILE* f) const;
+
+private:
+  struct class_cfg_t {
+    bool      has_cpus   = false;
+    cpu_set_t cpus       = {};
+    bool      has_policy = false;
+    int       policy     = SCHED_OTHER;
+    int       prio       = 0;
+    int       numa_node  = -1;
+  };
+
+  thread_topology() = default;
+
+  bool apply(pid_t tid, const std::string& thread_name);
+  void scan_numa_nodes();
+  int  node_of(const cpu_set_t& set) const;
+
+  std::atomic<bool>                  configured{false};
+  bool                               numa = false;
+  std::map<std::string, class_cfg_t> cfg;
+  std::vector<cpu_set_t>             numa_nodes;
+  mutable std::mutex                 mutex;
+};
+
+} // namespace srslte
+
+#endif // SRSLTE_THREAD_TOPOLOGY_H
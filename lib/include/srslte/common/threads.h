@@ -44,6 +44,7 @@ void threads_print_self();
 #ifdef __cplusplus
 }
 
+#include "srslte/common/thread_topology.h"
 #include <string>
 
 namespace srslte {
@@ -84,6 +85,7 @@ public:
   {
     name = name_;
     pthread_setname_np(pthread_self(), name.c_str());
+    thread_topology::get().apply_self(name);
   }
 
   void wait_thread_finish() { pthread_join(_thread, NULL); }
@@ -108,6 +110,7 @@ private:
   static void* thread_function_entry(void* _this)
   {
     pthread_setname_np(pthread_self(), ((thread*)_this)->name.c_str());
+    thread_topology::get().apply_self(((thread*)_this)->name);
     ((thread*)_this)->run_thread();
     return NULL;
   }
@@ -182,6 +182,14 @@ public:
   virtual int  get_mch_sched(uint32_t tti, bool is_mcch, dl_sched_list_t& dl_sched_res) = 0;
   virtual int  get_ul_sched(uint32_t tti, ul_sched_list_t& ul_sched_res)                = 0;
   virtual void set_sched_dl_tti_mask(uint8_t* tti_mask, uint32_t nof_sfs)               = 0;
+
+  /**
+   * PHY request to limit the scheduled load while its workers miss the TTI deadline. Default limits restore normal
+   * operation.
+   *
+   * @param limits the limits to apply to all carriers from the next scheduled TTI
+   */
+  virtual void set_overload_limits(const sched_interface::overload_limits_t& limits) = 0;
 };
 
 /* Interface MAC -> PHY */
@@ -335,10 +343,12 @@ class rlc_interface_pdcp
 public:
   /* PDCP calls RLC to push an RLC SDU. SDU gets placed into the RLC buffer and MAC pulls
    * RLC PDUs according to TB size. */
-  virtual void write_sdu(uint16_t rnti, uint32_t lcid, srslte::unique_byte_buffer_t sdu) = 0;
-  virtual void discard_sdu(uint16_t rnti, uint32_t lcid, uint32_t sn)                    = 0;
-  virtual bool rb_is_um(uint16_t rnti, uint32_t lcid)                                    = 0;
-  virtual bool sdu_queue_is_full(uint16_t rnti, uint32_t lcid)                           = 0;
+  virtual void     write_sdu(uint16_t rnti, uint32_t lcid, srslte::unique_byte_buffer_t sdu)       = 0;
+  virtual void     write_sdus(uint16_t rnti, uint32_t lcid, srslte::unique_byte_buffer_list_t sdus) = 0;
+  virtual void     discard_sdu(uint16_t rnti, uint32_t lcid, uint32_t sn)                          = 0;
+  virtual bool     rb_is_um(uint16_t rnti, uint32_t lcid)                                          = 0;
+  virtual bool     sdu_queue_is_full(uint16_t rnti, uint32_t lcid)                                 = 0;
+  virtual uint32_t sdu_queue_space(uint16_t rnti, uint32_t lcid)                                 = 0;
 };
 
 // RLC interface for RRC
@@ -363,6 +373,9 @@ class pdcp_interface_gtpu
 {
 public:
   virtual void write_sdu(uint16_t rnti, uint32_t lcid, srslte::unique_byte_buffer_t sdu) = 0;
+  /* GTPU hands over consecutive DL SDUs of the same bearer in a single call, so that user lookup,
+   * COUNT assignment, ciphering and RLC queueing are done once per batch. */
+  virtual void write_sdus(uint16_t rnti, uint32_t lcid, srslte::unique_byte_buffer_list_t sdus) = 0;
 };
 
 // PDCP interface for RRC
@@ -575,7 +588,10 @@ typedef struct {
 typedef struct {
   uint32_t                      nof_prb; ///< Needed to dimension MAC softbuffers for all cells
   sched_interface::sched_args_t sched;
-  int                           nr_tb_size = -1;
+  int                           nr_tb_size          = -1;
+  uint32_t                      nof_tx_softbuffers  = 128;  ///< DL HARQ softbuffers shared by all UEs
+  uint32_t                      nof_rx_softbuffers  = 64;   ///< UL HARQ softbuffers shared by all UEs
+  bool                          softbuffer_overflow = true; ///< Allocate beyond the pools when they are exhausted
 #ifdef ENABLE_SLICER
   slicer_args_t                 slicer;
 #endif
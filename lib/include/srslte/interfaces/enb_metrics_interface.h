@@ -32,34 +32,46 @@
 #endif
 #include "srsenb/hdr/stack/upper/common_enb.h"
 #include "srsenb/hdr/stack/upper/s1ap_metrics.h"
+#include "srslte/common/latency_probe.h"
 #include "srslte/common/metrics_hub.h"
 #include "srslte/radio/radio_metrics.h"
 #include "srslte/upper/rlc_metrics.h"
 #include "srsue/hdr/stack/upper/gw_metrics.h"
+#include <vector>
 
 namespace srsenb {
 
+// Per-UE vectors (stack.mac, phy, rrc.ues and pdcp.ues) are indexed by the same UE, rrc.n_ues entries each
 struct stack_metrics_t {
-  mac_metrics_t  mac[ENB_METRICS_MAX_USERS];
-  rrc_metrics_t  rrc;
+  std::vector<mac_metrics_t> mac;
+  rrc_metrics_t              rrc;
 #ifdef ENABLE_RIC_AGENT_KPM
-  pdcp_metrics_t pdcp;
+  pdcp_metrics_t             pdcp;
 #endif
-  s1ap_metrics_t s1ap;
+  s1ap_metrics_t             s1ap;
+  softbuffer_pool_metrics_t  softbuffer_tx; ///< Shared DL HARQ softbuffers
+  softbuffer_pool_metrics_t  softbuffer_rx; ///< Shared UL HARQ softbuffers
 };
 
 typedef struct {
-  srslte::rf_metrics_t rf;
-  phy_metrics_t        phy[ENB_METRICS_MAX_USERS];
-  stack_metrics_t      stack;
-  bool                 running;
+  srslte::rf_metrics_t               rf;
+  std::vector<phy_metrics_t>         phy;
+  phy_overload_metrics_t             phy_overload;
+  stack_metrics_t                    stack;
+  srslte::latency_probe_stats_list_t latency; ///< Cumulative per-stage latencies, all zero unless probes are enabled
+  bool                               running;
 } enb_metrics_t;
 
+class ue_metrics_reader;
+
 // ENB interface
 class enb_metrics_interface : public srslte::metrics_interface<enb_metrics_t>
 {
 public:
   virtual bool get_metrics(enb_metrics_t* m) = 0;
+  // Per-UE counters are reported as increments since the previous call with the same reader, so that several
+  // consumers can sample with independent periods
+  virtual bool get_metrics(enb_metrics_t* m, ue_metrics_reader& reader) = 0;
 };
 
 } // namespace srsenb
@@ -74,20 +74,29 @@ public:
                                                struct sctp_sndrcvinfo enb_sri)               = 0;
 };
 
+// E-UTRAN authentication vector, TS 33.401 Section 6.1.2
+typedef struct {
+  uint8_t k_asme[32];
+  uint8_t autn[16];
+  uint8_t rand[16];
+  uint8_t xres[16];
+} auth_vector_t;
+
 class hss_interface_nas // NAS -> HSS
 {
 public:
   virtual bool gen_auth_info_answer(uint64_t imsi, uint8_t* k_asme, uint8_t* autn, uint8_t* rand, uint8_t* xres) = 0;
+  virtual bool gen_auth_vectors(uint64_t imsi, auth_vector_t* vectors, uint32_t nof_vectors)                     = 0;
   virtual bool gen_update_loc_answer(uint64_t imsi, uint8_t* qci)                                                = 0;
-  virtual bool resync_sqn(uint64_t imsi, uint8_t* auts)                                                          = 0;
+  virtual bool resync_sqn(uint64_t imsi, uint8_t* rand, uint8_t* auts)                                           = 0;
 };
 
 class mme_interface_nas // NAS -> MME
 {
 public:
-  virtual bool add_nas_timer(int timer_fd, enum nas_timer_type type, uint64_t imsi) = 0;
-  virtual bool is_nas_timer_running(enum nas_timer_type type, uint64_t imsi)        = 0;
-  virtual bool remove_nas_timer(enum nas_timer_type type, uint64_t imsi)            = 0;
+  virtual bool add_nas_timer(enum nas_timer_type type, uint64_t imsi, uint32_t timeout_ms) = 0;
+  virtual bool is_nas_timer_running(enum nas_timer_type type, uint64_t imsi)               = 0;
+  virtual bool remove_nas_timer(enum nas_timer_type type, uint64_t imsi)                   = 0;
 };
 
 class s1ap_interface_mme // MME -> S1AP
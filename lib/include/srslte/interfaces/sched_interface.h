@@ -62,6 +62,14 @@ public:
     int      max_aggr_level       = 3;
   };
 
+  //! Limits on user data allocations, set while the PHY cannot keep up with the TTI deadline
+  struct overload_limits_t {
+    uint32_t max_dl_users  = 0;     ///< Max. DL user allocations per TTI and carrier, 0 for no limit
+    uint32_t max_ul_users  = 0;     ///< Max. UL user allocations per TTI and carrier, 0 for no limit
+    float    max_prb_ratio = 1.0f;  ///< Fraction of the carrier bandwidth available for user data
+    bool     dl_ctrl_only  = false; ///< DL new transmissions only for UEs with pending SRB data or MAC CEs
+  };
+
   struct cell_cfg_t {
 
     // Main cell configuration (used to calculate DCI locations in scheduler)
@@ -260,6 +268,15 @@ public:
   virtual uint64_t get_dl_rbg_total(uint16_t rnti) = 0;
   virtual uint64_t get_ul_rb_total(uint16_t rnti) = 0;
 
+  struct ue_sched_metrics_t {
+    uint32_t ul_buffer;
+    uint32_t dl_buffer;
+    uint64_t dl_rbg_total;
+    uint64_t ul_rb_total;
+  };
+  /* All of the above under a single lock. Returns false, without logging, if the UE is not in the scheduler */
+  virtual bool get_ue_metrics(uint16_t rnti, ue_sched_metrics_t& m) = 0;
+
   /******************* Scheduling Interface ***********************/
 
   /**
@@ -305,6 +322,7 @@ public:
   virtual void                                 set_dl_tti_mask(uint8_t* tti_mask, uint32_t nof_sfs)        = 0;
   virtual std::array<int, SRSLTE_MAX_CARRIERS> get_enb_ue_cc_map(uint16_t rnti)                            = 0;
   virtual int                                  ul_buffer_add(uint16_t rnti, uint32_t lcid, uint32_t bytes) = 0;
+  virtual void                                 set_overload_limits(const overload_limits_t& limits)        = 0;
 };
 
 } // namespace srsenb
@@ -307,6 +307,14 @@ public:
   ///< MAC pulls RLC PDUs according to TB size
   virtual void write_sdu(uint32_t lcid, srslte::unique_byte_buffer_t sdu) = 0;
 
+  ///< PDCP calls RLC to push a batch of consecutive RLC SDUs of the same bearer
+  virtual void write_sdus(uint32_t lcid, srslte::unique_byte_buffer_list_t sdus)
+  {
+    for (auto& sdu : sdus) {
+      write_sdu(lcid, std::move(sdu));
+    }
+  }
+
   ///< Indicate RLC that a certain SN can be discarded
   virtual void discard_sdu(uint32_t lcid, uint32_t discard_sn) = 0;
 
@@ -315,6 +323,9 @@ public:
 
   ///< Allow PDCP to query SDU queue status
   virtual bool sdu_queue_is_full(uint32_t lcid) = 0;
+
+  ///< Allow PDCP to query how many SDUs still fit in the queue, before numbering a batch
+  virtual uint32_t sdu_queue_space(uint32_t lcid) { return sdu_queue_is_full(lcid) ? 0 : 1; }
 };
 
 // RLC interface for MAC
@@ -500,6 +511,9 @@ typedef struct {
   bool     meas_evm        = false;
   int      nof_phy_threads = 3;
 
+  uint32_t cell_search_threads        = 0;    // Parallel PSS/SSS cell search workers, 0 for the sequential search
+  float    cell_search_wideband_srate = 0.0f; // Wideband capture rate to search several EARFCNs at once, 0 disables
+
   int worker_cpu_mask   = -1;
   int sync_cpu_affinity = -1;
 
@@ -535,6 +549,7 @@ typedef struct {
   bool        pdsch_8bit_decoder           = false;
   uint32_t    intra_freq_meas_len_ms       = 20;
   uint32_t    intra_freq_meas_period_ms    = 200;
+  uint32_t    intra_freq_meas_threads      = 2;
   float       force_ul_amplitude           = 0.0f;
 
   float    in_sync_rsrp_dbm_th    = -130.0f;
@@ -625,7 +640,11 @@ public:
 };
 
 class gw_interface_stack : public gw_interface_nas, public gw_interface_rrc, public gw_interface_pdcp
-{};
+{
+public:
+  // Called by the stack at the end of each TTI, after all DL PDUs of that TTI were delivered
+  virtual void run_tti() = 0;
+};
 
 // STACK interface for RRC
 class stack_interface_rrc
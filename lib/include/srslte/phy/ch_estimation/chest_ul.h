@@ -111,6 +111,12 @@ SRSLTE_API int srslte_chest_ul_estimate_pucch(srslte_chest_ul_t*     q,
                                               cf_t*                  input,
                                               srslte_chest_ul_res_t* res);
 
+SRSLTE_API int srslte_chest_ul_estimate_pucch_pilots(srslte_chest_ul_t*     q,
+                                                     srslte_ul_sf_cfg_t*    sf,
+                                                     srslte_pucch_cfg_t*    cfg,
+                                                     const cf_t*            pilots,
+                                                     srslte_chest_ul_res_t* res);
+
 SRSLTE_API int srslte_chest_ul_estimate_srs(srslte_chest_ul_t*                 q,
                                             srslte_ul_sf_cfg_t*                sf,
                                             srslte_refsignal_srs_cfg_t*        cfg,
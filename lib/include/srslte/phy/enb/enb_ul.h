@@ -49,6 +49,22 @@
 
 #include "srslte/config.h"
 
+#define SRSLTE_ENB_UL_PUCCH_MAX_RB 32
+#define SRSLTE_ENB_UL_PUCCH_MAX_DMRS (SRSLTE_NRE * 3 * SRSLTE_NOF_SLOTS_PER_SF)
+
+/* PUCCH RB pair received in the current subframe. Its DMRS and data REs are extracted once and shared by all the
+ * resources mapped on it, which only differ in their cyclic shift and orthogonal cover. Only the RE extraction is
+ * shared, the channel estimation and the correlation are still done per resource.
+ */
+typedef struct SRSLTE_API {
+  uint32_t              n_prb[SRSLTE_NOF_SLOTS_PER_SF];
+  srslte_pucch_format_t layout;
+  bool                  shortened;
+  cf_t                  dmrs[SRSLTE_ENB_UL_PUCCH_MAX_DMRS];
+  cf_t                  symbols[SRSLTE_PUCCH_MAX_SYMBOLS];
+  uint32_t              nof_re;
+} srslte_enb_ul_pucch_rb_t;
+
 typedef struct SRSLTE_API {
   srslte_cell_t cell;
 
@@ -60,6 +76,10 @@ typedef struct SRSLTE_API {
   srslte_pusch_t    pusch;
   srslte_pucch_t    pucch;
 
+  srslte_enb_ul_pucch_rb_t* pucch_rb;
+  uint32_t                  nof_pucch_rb;
+  uint32_t                  pucch_rb_tti;
+
 } srslte_enb_ul_t;
 
 /* This function shall be called just after the initial synchronization */
@@ -40,6 +40,8 @@
 
 #define SRSLTE_PRACH_MAX_LEN (2 * 24576 + 21024) // Maximum Tcp + Tseq
 
+#define SRSLTE_PRACH_ROOTS_PER_BATCH 4 // Root sequences correlated with a single batched IFFT
+
 /** Generation and detection of RACH signals for uplink.
  *  Currently only supports preamble formats 0-3.
  *  Does not currently support high speed flag.
@@ -52,6 +54,11 @@ typedef struct {
   cf_t  phase_array[2 * 839];
 } srslte_prach_cancellation_t;
 
+/* Runs srslte_prach_correlate_batch() for batches 0 to nof_batches - 1 and returns when all of them are done. The
+ * batches are independent, so they can be spread across threads.
+ */
+typedef void (*srslte_prach_executor_t)(void* arg, uint32_t nof_batches);
+
 typedef struct SRSLTE_API {
   // Parameters from higher layers (extracted from SIB2)
   uint32_t config_idx;
@@ -105,12 +112,21 @@ typedef struct SRSLTE_API {
   bool                        freq_domain_offset_calc;
   srslte_tdd_config_t         tdd_config;
   uint32_t                    current_prach_idx;
-  cf_t*                       cross;
-  cf_t*                       corr_freq;
   srslte_prach_cancellation_t prach_cancel;
   cf_t                        sub[839 * 2];
   float                       phase[839];
 
+  // Correlation of every root sequence, each batch of SRSLTE_PRACH_ROOTS_PER_BATCH roots shares one IFFT
+  uint32_t                corr_stride;     // Distance between roots in the buffers below, keeps every root aligned
+  cf_t*                   corr_roots;      // Correlation spectrum, then correlation in time, of every root
+  float*                  corr_roots_pow;  // Power of the correlation in time of every root
+  cf_t*                   corr_freq_roots; // Correlation spectrum of every root, kept for successive cancellation
+  cf_t*                   cross_batch;     // Cross-correlation of the spectrum, one buffer per batch
+  cf_t                    cross_roots[64]; // Accumulated cross-correlation of the spectrum of every root
+  float                   corr_ave_roots[64];
+  srslte_dft_plan_t       zc_ifft_batch;
+  srslte_prach_executor_t executor;
+  void*                   executor_arg;
 } srslte_prach_t;
 
 typedef struct SRSLTE_API {
@@ -213,6 +229,10 @@ SRSLTE_API int srslte_prach_detect_offset(srslte_prach_t* p,
 
 SRSLTE_API void srslte_prach_set_detect_factor(srslte_prach_t* p, float factor);
 
+SRSLTE_API void srslte_prach_set_executor(srslte_prach_t* p, srslte_prach_executor_t executor, void* arg);
+
+SRSLTE_API void srslte_prach_correlate_batch(srslte_prach_t* p, uint32_t batch);
+
 SRSLTE_API int srslte_prach_free(srslte_prach_t* p);
 
 SRSLTE_API int srslte_prach_print_seqs(srslte_prach_t* p);
@@ -129,6 +129,17 @@ SRSLTE_API int srslte_pucch_decode(srslte_pucch_t*        q,
                                    cf_t*                  sf_symbols,
                                    srslte_pucch_res_t*    data);
 
+SRSLTE_API int
+srslte_pucch_get_symbols(srslte_pucch_t* q, srslte_ul_sf_cfg_t* sf, srslte_pucch_cfg_t* cfg, cf_t* sf_symbols, cf_t* z);
+
+SRSLTE_API int srslte_pucch_decode_symbols(srslte_pucch_t*        q,
+                                           srslte_ul_sf_cfg_t*    sf,
+                                           srslte_pucch_cfg_t*    cfg,
+                                           srslte_chest_ul_res_t* channel,
+                                           cf_t*                  symbols,
+                                           uint32_t               nof_re,
+                                           srslte_pucch_res_t*    data);
+
 /* Other utilities. These functions do not modify the state and run in real-time */
 SRSLTE_API float srslte_pucch_alpha_format1(const uint32_t n_cs_cell[SRSLTE_NSLOTS_X_FRAME][SRSLTE_CP_NORM_NSYMB],
                                             const srslte_pucch_cfg_t* cfg,
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         channelizer.h
+ *
+ *  Description:  Extracts a narrowband channel from a wideband capture. The
+ *                channel is shifted to baseband with a phase-continuous mixer
+ *                and decimated with the FFT based resampler, so a capture can
+ *                be processed in several calls.
+ *
+ *  Reference:
+ *****************************************************************************/
+
+#ifndef SRSLTE_CHANNELIZER_H
+#define SRSLTE_CHANNELIZER_H
+
+#include <stdint.h>
+
+#include "srslte/config.h"
+#include "srslte/phy/resampling/resampler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct SRSLTE_API {
+  srslte_resampler_fft_t decimator;
+  uint32_t               ratio;
+  float                  freq;  // Channel frequency offset normalized to the input sampling rate
+  double                 phase; // Mixer phase at the next input sample, in cycles
+  uint32_t               chunk_sz;
+  cf_t*                  mix_buffer;
+} srslte_channelizer_t;
+
+/**
+ * Initialise a channelizer
+ * @param q Object pointer
+ * @param ratio Decimation ratio between the input and output sampling rates, 1 only shifts in frequency
+ * @return SRSLTE_SUCCESS if no error, otherwise an SRSLTE error code
+ */
+SRSLTE_API int srslte_channelizer_init(srslte_channelizer_t* q, uint32_t ratio);
+
+/**
+ * Select the channel to extract and clear the mixer and decimator state
+ * @param q Object pointer
+ * @param freq Channel center frequency offset normalized to the input sampling rate
+ */
+SRSLTE_API void srslte_channelizer_set_freq(srslte_channelizer_t* q, float freq);
+
+/**
+ * Extract the channel from the input
+ * @param q Object pointer
+ * @param input Wideband samples
+ * @param output Channel samples, nsamples / ratio are written
+ * @param nsamples Number of input samples, must be a multiple of the ratio
+ * @return the number of output samples
+ */
+SRSLTE_API uint32_t srslte_channelizer_run(srslte_channelizer_t* q, const cf_t* input, cf_t* output, uint32_t nsamples);
+
+SRSLTE_API void srslte_channelizer_free(srslte_channelizer_t* q);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SRSLTE_CHANNELIZER_H
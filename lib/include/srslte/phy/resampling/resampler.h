@@ -22,7 +22,7 @@
 /******************************************************************************
  *  File:         resampler.h
  *
- *  Description:  Linear and vector interpolation
+ *  Description:  FFT based and polyphase FIR interpolation and decimation
  *
  *  Reference:
  *****************************************************************************/
@@ -89,12 +89,92 @@ SRSLTE_API uint32_t srslte_resampler_fft_get_delay(srslte_resampler_fft_t* q);
  */
 SRSLTE_API void srslte_resampler_fft_run(srslte_resampler_fft_t* q, const cf_t* input, cf_t* output, uint32_t nsamples);
 
+/**
+ * Clear the FFT based resampler state, so the next run does not overlap with the previous input
+ * @param q Object pointer
+ */
+SRSLTE_API void srslte_resampler_fft_reset(srslte_resampler_fft_t* q);
+
 /**
  * Free FFT based resampler buffers and subcomponents
  * @param q  Object pointer
  */
 SRSLTE_API void srslte_resampler_fft_free(srslte_resampler_fft_t* q);
 
+/**
+ * Polyphase FIR resampler internal state, the output rate is the input rate times interp / decim
+ */
+typedef struct {
+  uint32_t interp;   ///< Interpolation factor, number of filter phases
+  uint32_t decim;    ///< Decimation factor
+  uint32_t nof_taps; ///< Number of taps of each filter phase
+  float*   taps;     ///< interp filter phases of nof_taps, stored time reversed
+  cf_t*    window;   ///< Last nof_taps - 1 input samples followed by the start of the current input
+  uint32_t phase;    ///< Filter phase of the next output sample
+  uint32_t offset;   ///< Index of the newest input sample of the next output, relative to the next input
+} srslte_resampler_poly_t;
+
+/**
+ * Initialise a polyphase FIR resampler for the rational ratio interp / decim. Integer interpolation and decimation
+ * are the cases in which decim or interp are 1.
+ * @param q Object pointer
+ * @param interp Interpolation factor
+ * @param decim Decimation factor
+ * @return SRSLTE_SUCCES if no error, SRSLTE_ERROR_OUT_OF_BOUNDS if the ratio is 1, otherwise an SRSLTE error code
+ */
+SRSLTE_API int srslte_resampler_poly_init(srslte_resampler_poly_t* q, uint32_t interp, uint32_t decim);
+
+/**
+ * Get the number of output samples the next run produces from a given number of input samples.
+ * @param q Object pointer
+ * @param nof_input Number of input samples
+ * @return the number of output samples
+ */
+SRSLTE_API uint32_t srslte_resampler_poly_get_nof_output(const srslte_resampler_poly_t* q, uint32_t nof_input);
+
+/**
+ * Get the number of input samples the next run needs for producing a given number of output samples. When decimating
+ * (decim > interp), running this number of input samples produces exactly nof_output samples.
+ * @param q Object pointer
+ * @param nof_output Number of output samples
+ * @return the number of input samples
+ */
+SRSLTE_API uint32_t srslte_resampler_poly_get_nof_input(const srslte_resampler_poly_t* q, uint32_t nof_output);
+
+/**
+ * Get the filter delay of the polyphase resampler.
+ * @param q Object pointer
+ * @return the delay in number of input samples, it can be fractional
+ */
+SRSLTE_API float srslte_resampler_poly_get_delay(const srslte_resampler_poly_t* q);
+
+/**
+ * Run the polyphase resampler. The filter state is kept between calls, so a stream can be split in any number of runs
+ * of any size. The output is computed straight from the input buffer, which must not overlap the output. If input or
+ * output are NULL, the state advances as if zeros were processed.
+ * @param q Object pointer, make sure it has been initialised
+ * @param input Points at the input complex buffer
+ * @param output Points at the output complex buffer, it needs room for srslte_resampler_poly_get_nof_output() samples
+ * @param nsamples Number of input samples
+ * @return the number of output samples
+ */
+SRSLTE_API uint32_t srslte_resampler_poly_run(srslte_resampler_poly_t* q,
+                                              const cf_t*              input,
+                                              cf_t*                    output,
+                                              uint32_t                 nsamples);
+
+/**
+ * Clear the polyphase resampler state, so the next run does not overlap with the previous input
+ * @param q Object pointer
+ */
+SRSLTE_API void srslte_resampler_poly_reset(srslte_resampler_poly_t* q);
+
+/**
+ * Free polyphase resampler buffers
+ * @param q  Object pointer
+ */
+SRSLTE_API void srslte_resampler_poly_free(srslte_resampler_poly_t* q);
+
 #ifdef __cplusplus
 }
 #endif
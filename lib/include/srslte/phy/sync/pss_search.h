@@ -0,0 +1,98 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         pss_search.h
+ *
+ *  Description:  Multi-hypothesis PSS search for initial cell search.
+ *
+ *                Correlates a capture against the three PSS sequences in a
+ *                single frequency-domain pass: the input is split into
+ *                overlap-save blocks which are transformed once and shared by
+ *                the three N_id_2 hypotheses, so each hypothesis only costs a
+ *                spectral product and an inverse FFT per block. The
+ *                correlation power is accumulated non-coherently modulo the
+ *                PSS period (half a radio frame), which averages all the PSS
+ *                occurrences in the capture.
+ *
+ *                Once srslte_pss_search_set_input() has returned,
+ *                srslte_pss_search_run() can be called concurrently for
+ *                different N_id_2 since every hypothesis owns its own plan and
+ *                buffers.
+ *
+ *                The object works with signals sampled at 1.92 MHz centered at
+ *                the carrier frequency (128-point OFDM symbols).
+ *
+ *  Reference:    3GPP TS 36.211 version 10.0.0 Release 10 Sec. 6.11.1
+ *****************************************************************************/
+
+#ifndef SRSLTE_PSS_SEARCH_H
+#define SRSLTE_PSS_SEARCH_H
+
+#include <stdint.h>
+
+#include "srslte/config.h"
+#include "srslte/phy/common/phy_common.h"
+#include "srslte/phy/dft/dft.h"
+
+#define SRSLTE_PSS_SEARCH_SYMBOL_SZ 128
+#define SRSLTE_PSS_SEARCH_BLOCK_SZ 1024
+#define SRSLTE_PSS_SEARCH_PERIOD (SRSLTE_SF_LEN(SRSLTE_PSS_SEARCH_SYMBOL_SZ) * 5)
+
+typedef struct SRSLTE_API {
+  uint32_t N_id_2;
+  uint32_t peak_pos;   // Position of the PSS symbol (without CP) in [0, SRSLTE_PSS_SEARCH_PERIOD)
+  float    peak_value; // Correlation power at the peak averaged over all PSS occurrences
+  float    psr;        // Peak to side-lobe ratio
+  float    cfo;        // PSS-based CFO normalized to the subcarrier spacing
+  uint32_t nof_pss;    // Number of PSS occurrences accumulated
+} srslte_pss_search_result_t;
+
+typedef struct SRSLTE_API {
+  srslte_dft_plan_t dftp;
+  srslte_dft_plan_t idftp[3];
+
+  uint32_t max_samples;
+  uint32_t max_blocks;
+  uint32_t nof_samples;
+  uint32_t nof_blocks;
+
+  const cf_t* input;
+  cf_t*       input_fft;          // Transformed overlap-save blocks, shared by all hypotheses
+  cf_t*       pss_filter_fft[3];  // Frequency response of the matched filter of each N_id_2
+  cf_t        pss_time[3][SRSLTE_PSS_SEARCH_SYMBOL_SZ];
+  cf_t*       tmp_block[3];
+  cf_t*       tmp_corr[3];
+  float*      corr_power[3];      // Correlation power folded modulo SRSLTE_PSS_SEARCH_PERIOD
+  uint32_t*   corr_count[3];      // Number of values accumulated in each folded position
+} srslte_pss_search_t;
+
+SRSLTE_API int srslte_pss_search_init(srslte_pss_search_t* q, uint32_t max_samples);
+
+SRSLTE_API void srslte_pss_search_free(srslte_pss_search_t* q);
+
+SRSLTE_API int srslte_pss_search_set_input(srslte_pss_search_t* q, const cf_t* input, uint32_t nof_samples);
+
+SRSLTE_API int srslte_pss_search_run(srslte_pss_search_t* q, uint32_t N_id_2, srslte_pss_search_result_t* result);
+
+SRSLTE_API srslte_cp_t srslte_pss_search_detect_cp(const cf_t* pss_symbol);
+
+#endif // SRSLTE_PSS_SEARCH_H
@@ -44,6 +44,18 @@ typedef struct {
   uint32_t peak_index;
 } srslte_refsignal_dl_sync_t;
 
+/*
+ * Frequency domain subframes of a capture, computed once and shared (read-only) by several
+ * srslte_refsignal_dl_sync_t objects measuring different cells over the same samples.
+ */
+typedef struct {
+  srslte_dft_plan_t plan;
+  cf_t*             input_fft[SRSLTE_NOF_SF_X_FRAME];
+  uint32_t          fft_len;
+  uint32_t          nof_prb;
+  uint32_t          nof_sf;
+} srslte_refsignal_dl_sync_input_t;
+
 SRSLTE_API int srslte_refsignal_dl_sync_init(srslte_refsignal_dl_sync_t* q);
 
 SRSLTE_API int srslte_refsignal_dl_sync_set_cell(srslte_refsignal_dl_sync_t* q, srslte_cell_t cell);
@@ -52,6 +64,22 @@ SRSLTE_API void srslte_refsignal_dl_sync_free(srslte_refsignal_dl_sync_t* q);
 
 SRSLTE_API void srslte_refsignal_dl_sync_run(srslte_refsignal_dl_sync_t* q, cf_t* buffer, uint32_t nsamples);
 
+SRSLTE_API int srslte_refsignal_dl_sync_input_init(srslte_refsignal_dl_sync_input_t* q);
+
+SRSLTE_API int srslte_refsignal_dl_sync_input_set(srslte_refsignal_dl_sync_input_t* q,
+                                                  const cf_t*                       buffer,
+                                                  uint32_t                          nsamples,
+                                                  uint32_t                          nof_prb);
+
+SRSLTE_API void srslte_refsignal_dl_sync_input_free(srslte_refsignal_dl_sync_input_t* q);
+
+/* Same as srslte_refsignal_dl_sync_run() but the peak search reuses the subframe FFTs of input, which must have been
+ * set with the same buffer and nsamples and the cell bandwidth */
+SRSLTE_API void srslte_refsignal_dl_sync_run_input(srslte_refsignal_dl_sync_t*             q,
+                                                   const srslte_refsignal_dl_sync_input_t* input,
+                                                   cf_t*                                   buffer,
+                                                   uint32_t                                nsamples);
+
 SRSLTE_API void srslte_refsignal_dl_sync_measure_sf(srslte_refsignal_dl_sync_t* q,
                                                     cf_t*                       buffer,
                                                     uint32_t                    sf_idx,
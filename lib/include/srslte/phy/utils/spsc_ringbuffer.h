@@ -0,0 +1,131 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ *  File:         spsc_ringbuffer.h
+ *
+ *  Description:  Lock-free single-producer/single-consumer byte ring buffer.
+ *
+ *                The producer only writes the write index and the consumer only
+ *                the read index, each in its own cache line, so neither side
+ *                takes a lock. A side only sleeps, on a futex, when the buffer
+ *                is full (producer) or does not hold enough bytes (consumer),
+ *                and the other side only makes a system call to wake it up.
+ *
+ *                reserve()/commit() and peek()/release() give direct access to
+ *                the ring memory. A region that wraps around the end of the
+ *                buffer is returned as two contiguous spans.
+ *
+ *                At most one thread may produce and one thread may consume at a
+ *                time. reset() must only be called while neither side is
+ *                accessing the buffer.
+ *
+ *  Reference:
+ *****************************************************************************/
+
+#ifndef SRSLTE_SPSC_RINGBUFFER_H
+#define SRSLTE_SPSC_RINGBUFFER_H
+
+#include "srslte/config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SRSLTE_SPSC_RINGBUFFER_CACHE_LINE 64
+
+typedef struct {
+  uint8_t* ptr[2];
+  uint32_t len[2];
+} srslte_spsc_ringbuffer_span_t;
+
+typedef struct {
+  // Set at init, only read afterwards
+  uint8_t* buffer;
+  uint32_t capacity;
+  uint32_t active;
+  uint8_t  pad0[SRSLTE_SPSC_RINGBUFFER_CACHE_LINE];
+
+  // Written by the producer. Indices run from 0 to 2 * capacity so that a full buffer differs from an empty one
+  uint32_t write_idx;
+  uint32_t read_idx_cache;  // Last read index seen by the producer
+  uint32_t write_waiting;   // Producer is about to sleep on space_seq
+  uint32_t data_seq;        // Futex the consumer sleeps on
+  uint8_t  pad1[SRSLTE_SPSC_RINGBUFFER_CACHE_LINE - 4 * sizeof(uint32_t)];
+
+  // Written by the consumer
+  uint32_t read_idx;
+  uint32_t write_idx_cache; // Last write index seen by the consumer
+  uint32_t read_waiting;    // Consumer is about to sleep on data_seq
+  uint32_t space_seq;       // Futex the producer sleeps on
+  uint8_t  pad2[SRSLTE_SPSC_RINGBUFFER_CACHE_LINE - 4 * sizeof(uint32_t)];
+} srslte_spsc_ringbuffer_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+SRSLTE_API int srslte_spsc_ringbuffer_init(srslte_spsc_ringbuffer_t* q, uint32_t capacity);
+
+SRSLTE_API void srslte_spsc_ringbuffer_free(srslte_spsc_ringbuffer_t* q);
+
+SRSLTE_API void srslte_spsc_ringbuffer_reset(srslte_spsc_ringbuffer_t* q);
+
+// Wakes up both sides, any blocked or later call returns 0 bytes
+SRSLTE_API void srslte_spsc_ringbuffer_stop(srslte_spsc_ringbuffer_t* q);
+
+SRSLTE_API uint32_t srslte_spsc_ringbuffer_status(srslte_spsc_ringbuffer_t* q);
+
+SRSLTE_API uint32_t srslte_spsc_ringbuffer_space(srslte_spsc_ringbuffer_t* q);
+
+/* Producer side. timeout_ms < 0 blocks until there is space, 0 does not block. They return the number of bytes,
+ * SRSLTE_ERROR_TIMEOUT if there is not enough space in time or 0 if the buffer was stopped.
+ */
+
+// Returns in span the next nof_bytes of free ring memory, they become readable once commit() is called
+SRSLTE_API int srslte_spsc_ringbuffer_reserve(srslte_spsc_ringbuffer_t*      q,
+                                              uint32_t                       nof_bytes,
+                                              int32_t                        timeout_ms,
+                                              srslte_spsc_ringbuffer_span_t* span);
+
+SRSLTE_API void srslte_spsc_ringbuffer_commit(srslte_spsc_ringbuffer_t* q, uint32_t nof_bytes);
+
+SRSLTE_API int srslte_spsc_ringbuffer_write(srslte_spsc_ringbuffer_t* q,
+                                            const void*               ptr,
+                                            uint32_t                  nof_bytes,
+                                            int32_t                   timeout_ms);
+
+/* Consumer side, same timeout and return conventions as the producer side */
+
+// Returns in span the next nof_bytes to read, they stay in the ring until release() is called
+SRSLTE_API int srslte_spsc_ringbuffer_peek(srslte_spsc_ringbuffer_t*      q,
+                                           uint32_t                       nof_bytes,
+                                           int32_t                        timeout_ms,
+                                           srslte_spsc_ringbuffer_span_t* span);
+
+SRSLTE_API void srslte_spsc_ringbuffer_release(srslte_spsc_ringbuffer_t* q, uint32_t nof_bytes);
+
+SRSLTE_API int
+srslte_spsc_ringbuffer_read(srslte_spsc_ringbuffer_t* q, void* ptr, uint32_t nof_bytes, int32_t timeout_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SRSLTE_SPSC_RINGBUFFER_H
@@ -112,6 +112,11 @@ private:
   std::array<srslte_resampler_fft_t, SRSLTE_MAX_CHANNELS> interpolators = {};
   std::array<srslte_resampler_fft_t, SRSLTE_MAX_CHANNELS> decimators    = {};
 
+  // Polyphase resamplers, used instead of the FFT ones for integer and fractional ratios if selected
+  std::array<srslte_resampler_poly_t, SRSLTE_MAX_CHANNELS> poly_interpolators = {};
+  std::array<srslte_resampler_poly_t, SRSLTE_MAX_CHANNELS> poly_decimators    = {};
+  bool                                                     polyphase          = false;
+
   rf_timestamp_t end_of_burst_time  = {};
   bool           is_start_of_burst  = false;
   uint32_t       tx_adv_nsamples    = 0;
@@ -22,9 +22,19 @@
 #ifndef SRSLOG_DETAIL_LOG_ENTRY_H
 #define SRSLOG_DETAIL_LOG_ENTRY_H
 
-#include "srslte/srslog/bundled/fmt/printf.h"
+#include "srslte/srslog/detail/support/inline_storage.h"
 #include "srslte/srslog/detail/support/thread_utils.h"
 #include <chrono>
+#include <memory>
+#include <vector>
+
+#ifndef SRSLOG_ENTRY_ARGS_SIZE
+#define SRSLOG_ENTRY_ARGS_SIZE 1024
+#endif
+
+#ifndef SRSLOG_ENTRY_HEX_DUMP_SIZE
+#define SRSLOG_ENTRY_HEX_DUMP_SIZE 256
+#endif
 
 namespace srslog {
 
@@ -48,16 +58,23 @@ struct flush_backend_cmd {
 
 /// This structure packs all the required data required to create a log entry in
 /// the backend.
+/// Arguments and hex dumps are stored inline so that building an entry never
+/// allocates memory, unless the arguments exceed the inline storage (see
+/// inline_arg_store). The format string and the log name are not copied, they
+/// must outlive the entry (string literals and log channel names do).
 //:TODO: provide proper command objects when we have custom formatting.
 struct log_entry {
+  using arg_store_type = inline_arg_store<SRSLOG_ENTRY_ARGS_SIZE>;
+  using hex_dump_type = inline_buffer<SRSLOG_ENTRY_HEX_DUMP_SIZE>;
+
   sink* s;
   std::chrono::high_resolution_clock::time_point tp;
   log_context context;
-  std::string fmtstring;
-  fmt::dynamic_format_arg_store<fmt::printf_context> store;
-  std::string log_name;
+  const char* fmtstring;
+  arg_store_type store;
+  const char* log_name;
   char log_tag;
-  std::vector<uint8_t> hex_dump;
+  hex_dump_type hex_dump;
   std::unique_ptr<flush_backend_cmd> flush_cmd;
 };
 
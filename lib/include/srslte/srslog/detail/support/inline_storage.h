@@ -0,0 +1,419 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSLOG_DETAIL_SUPPORT_INLINE_STORAGE_H
+#define SRSLOG_DETAIL_SUPPORT_INLINE_STORAGE_H
+
+#include "srslte/srslog/bundled/fmt/printf.h"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace srslog {
+
+namespace detail {
+
+/// Byte buffer of fixed capacity stored inline in its owner object, so that it
+/// never allocates. Copying a buffer only transfers the bytes in use.
+template <size_t N>
+class inline_buffer
+{
+public:
+  inline_buffer() = default;
+
+  inline_buffer(const inline_buffer& other) : len(other.len)
+  {
+    std::memcpy(buffer, other.buffer, len);
+  }
+
+  inline_buffer& operator=(const inline_buffer& other)
+  {
+    if (this != &other) {
+      len = other.len;
+      std::memcpy(buffer, other.buffer, len);
+    }
+    return *this;
+  }
+
+  /// Appends up to n bytes from src to the buffer. Returns the number of bytes
+  /// that have been appended, which is lower than n when the buffer is full.
+  size_t append(const void* src, size_t n)
+  {
+    n = std::min(n, N - len);
+    std::memcpy(buffer + len, src, n);
+    len += n;
+    return n;
+  }
+
+  /// Removes all the contents of the buffer.
+  void clear() { len = 0; }
+
+  const uint8_t* data() const { return buffer; }
+  const uint8_t* begin() const { return buffer; }
+  const uint8_t* end() const { return buffer + len; }
+  size_t size() const { return len; }
+  bool empty() const { return len == 0; }
+  static constexpr size_t capacity() { return N; }
+
+private:
+  size_t len = 0;
+  uint8_t buffer[N];
+};
+
+/// Stores the formatting arguments of a log entry inside a fixed size inline
+/// buffer instead of a heap allocated fmt argument store. Each argument is
+/// encoded as a type tag followed by its value, using the same type mapping as
+/// fmt printf. Entries whose arguments do not fit inline, such as long
+/// preformatted legacy messages, move them to a heap buffer of up to max_size
+/// bytes. Beyond that, strings are truncated and other arguments dropped.
+/// NOTE: Only built-in types, strings and void pointers are supported.
+template <size_t N>
+class inline_arg_store
+{
+  enum class arg_type : uint8_t {
+    int_type,
+    uint_type,
+    long_long_type,
+    ulong_long_type,
+    bool_type,
+    char_type,
+    double_type,
+    long_double_type,
+    string_type,
+    pointer_type
+  };
+
+public:
+  using fmt_store_type = fmt::dynamic_format_arg_store<fmt::printf_context>;
+
+  inline_arg_store() = default;
+
+  inline_arg_store(const inline_arg_store& other) :
+    buffer(other.buffer),
+    heap(other.heap ? new std::vector<uint8_t>(*other.heap) : nullptr),
+    nof_args(other.nof_args),
+    truncated(other.truncated)
+  {}
+
+  inline_arg_store& operator=(const inline_arg_store& other)
+  {
+    if (this != &other) {
+      buffer = other.buffer;
+      heap.reset(other.heap ? new std::vector<uint8_t>(*other.heap) : nullptr);
+      nof_args = other.nof_args;
+      truncated = other.truncated;
+    }
+    return *this;
+  }
+
+  inline_arg_store(inline_arg_store&&) = default;
+  inline_arg_store& operator=(inline_arg_store&&) = default;
+
+  /// Upper bound of the encoded arguments, inline or on the heap.
+  static constexpr size_t max_size() { return UINT16_MAX; }
+
+  /// Adds a new argument to the store.
+  template <typename T>
+  void push_back(const T& arg)
+  {
+    push_value(arg, std::is_enum<T>{});
+  }
+
+  /// String literal and char array overload.
+  template <size_t M>
+  void push_back(const char (&arg)[M])
+  {
+    push_string(arg, ::strnlen(arg, M));
+  }
+
+  /// Removes all the stored arguments.
+  void clear()
+  {
+    buffer.clear();
+    heap.reset();
+    nof_args = 0;
+    truncated = false;
+  }
+
+  /// Returns the number of stored arguments.
+  size_t size() const { return nof_args; }
+
+  /// Returns true if any argument has been truncated or dropped because the
+  /// store ran out of space.
+  bool is_truncated() const { return truncated; }
+
+  /// Returns a pointer to the encoded arguments.
+  const uint8_t* raw_data() const { return heap ? heap->data() : buffer.data(); }
+
+  /// Returns the size in bytes of the encoded arguments.
+  size_t raw_size() const { return heap ? heap->size() : buffer.size(); }
+
+  /// Returns true if the encoded arguments have been moved to the heap.
+  bool is_on_heap() const { return heap != nullptr; }
+
+  /// Replaces the contents of the store with the specified encoded arguments,
+  /// as previously obtained through raw_data().
+  void assign_raw(const uint8_t* data,
+                  size_t len,
+                  size_t nof_encoded_args,
+                  bool is_truncated)
+  {
+    clear();
+    size_t stored_len = std::min(len, max_size());
+    append(data, stored_len);
+    truncated = is_truncated || (stored_len != len);
+    nof_args = static_cast<uint16_t>(nof_encoded_args);
+  }
+
+  /// Loads the stored arguments into a fmt argument store for formatting.
+  /// NOTE: String arguments reference the contents of this object, which must
+  /// outlive the fmt store.
+  void load(fmt_store_type& store) const
+  {
+    load(raw_data(), raw_size(), store);
+  }
+
+  /// Loads the encoded arguments in the specified memory block into a fmt
+  /// argument store.
+  /// NOTE: String arguments reference the input memory block. Decoding stops at
+  /// the first malformed argument.
+  static void load(const uint8_t* p, size_t len, fmt_store_type& store)
+  {
+    const uint8_t* end = p + len;
+    while (p < end) {
+      auto type = static_cast<arg_type>(*p++);
+      size_t left = end - p;
+      switch (type) {
+        case arg_type::int_type:
+          if (left < sizeof(int)) {
+            return;
+          }
+          store.push_back(read<int>(p));
+          break;
+        case arg_type::uint_type:
+          if (left < sizeof(unsigned)) {
+            return;
+          }
+          store.push_back(read<unsigned>(p));
+          break;
+        case arg_type::long_long_type:
+          if (left < sizeof(long long)) {
+            return;
+          }
+          store.push_back(read<long long>(p));
+          break;
+        case arg_type::ulong_long_type:
+          if (left < sizeof(unsigned long long)) {
+            return;
+          }
+          store.push_back(read<unsigned long long>(p));
+          break;
+        case arg_type::bool_type:
+          if (left < sizeof(bool)) {
+            return;
+          }
+          store.push_back(read<bool>(p));
+          break;
+        case arg_type::char_type:
+          if (left < sizeof(char)) {
+            return;
+          }
+          store.push_back(read<char>(p));
+          break;
+        case arg_type::double_type:
+          if (left < sizeof(double)) {
+            return;
+          }
+          store.push_back(read<double>(p));
+          break;
+        case arg_type::long_double_type:
+          if (left < sizeof(long double)) {
+            return;
+          }
+          store.push_back(read<long double>(p));
+          break;
+        case arg_type::pointer_type:
+          if (left < sizeof(const void*)) {
+            return;
+          }
+          store.push_back(read<const void*>(p));
+          break;
+        case arg_type::string_type: {
+          if (left < sizeof(uint32_t)) {
+            return;
+          }
+          auto str_len = read<uint32_t>(p);
+          if (left - sizeof(uint32_t) < str_len) {
+            return;
+          }
+          store.push_back(
+              fmt::string_view(reinterpret_cast<const char*>(p), str_len));
+          p += str_len;
+          break;
+        }
+        default:
+          return;
+      }
+    }
+  }
+
+private:
+  /// Integers are widened following the fmt argument mapping rules.
+  template <typename T>
+  void push_value(T arg, std::false_type)
+  {
+    static_assert(std::is_arithmetic<T>::value,
+                  "Unsupported log argument type");
+    push_arithmetic(arg);
+  }
+
+  /// Enumerations are stored as their underlying type.
+  template <typename T>
+  void push_value(T arg, std::true_type)
+  {
+    push_arithmetic(static_cast<typename std::underlying_type<T>::type>(arg));
+  }
+
+  void push_value(const char* arg, std::false_type)
+  {
+    push_string(arg, arg ? std::strlen(arg) : 0);
+  }
+  void push_value(char* arg, std::false_type)
+  {
+    push_value(static_cast<const char*>(arg), std::false_type{});
+  }
+  void push_value(const std::string& arg, std::false_type)
+  {
+    push_string(arg.data(), arg.size());
+  }
+  void push_value(fmt::string_view arg, std::false_type)
+  {
+    push_string(arg.data(), arg.size());
+  }
+  void push_value(const void* arg, std::false_type)
+  {
+    write(arg_type::pointer_type, arg);
+  }
+  void push_value(void* arg, std::false_type)
+  {
+    write(arg_type::pointer_type, static_cast<const void*>(arg));
+  }
+
+  void push_arithmetic(bool arg) { write(arg_type::bool_type, arg); }
+  void push_arithmetic(char arg) { write(arg_type::char_type, arg); }
+  void push_arithmetic(float arg)
+  {
+    write(arg_type::double_type, static_cast<double>(arg));
+  }
+  void push_arithmetic(double arg) { write(arg_type::double_type, arg); }
+  void push_arithmetic(long double arg)
+  {
+    write(arg_type::long_double_type, arg);
+  }
+  template <typename T>
+  void push_arithmetic(T arg)
+  {
+    static_assert(std::is_integral<T>::value, "Expected an integer type");
+    if (std::is_signed<T>::value) {
+      if (sizeof(T) <= sizeof(int)) {
+        write(arg_type::int_type, static_cast<int>(arg));
+      } else {
+        write(arg_type::long_long_type, static_cast<long long>(arg));
+      }
+    } else {
+      if (sizeof(T) <= sizeof(unsigned)) {
+        write(arg_type::uint_type, static_cast<unsigned>(arg));
+      } else {
+        write(arg_type::ulong_long_type,
+              static_cast<unsigned long long>(arg));
+      }
+    }
+  }
+
+  template <typename T>
+  void write(arg_type type, T value)
+  {
+    if (max_size() - raw_size() < sizeof(type) + sizeof(value)) {
+      truncated = true;
+      return;
+    }
+    append(&type, sizeof(type));
+    append(&value, sizeof(value));
+    ++nof_args;
+  }
+
+  void push_string(const char* str, size_t len)
+  {
+    arg_type type = arg_type::string_type;
+    size_t header_len = sizeof(type) + sizeof(uint32_t);
+    if (max_size() - raw_size() < header_len) {
+      truncated = true;
+      return;
+    }
+    auto stored_len = static_cast<uint32_t>(
+        std::min(len, max_size() - raw_size() - header_len));
+    truncated |= (stored_len != len);
+    append(&type, sizeof(type));
+    append(&stored_len, sizeof(stored_len));
+    append(str, stored_len);
+    ++nof_args;
+  }
+
+  /// Appends n bytes to the encoded arguments, moving them to the heap the
+  /// first time they do not fit in the inline buffer. The caller makes sure
+  /// that the total stays within max_size.
+  void append(const void* src, size_t n)
+  {
+    if (!heap && buffer.capacity() - buffer.size() >= n) {
+      buffer.append(src, n);
+      return;
+    }
+    if (!heap) {
+      heap.reset(new std::vector<uint8_t>(buffer.begin(), buffer.end()));
+    }
+    auto p = static_cast<const uint8_t*>(src);
+    heap->insert(heap->end(), p, p + n);
+  }
+
+  template <typename T>
+  static T read(const uint8_t*& p)
+  {
+    T value;
+    std::memcpy(&value, p, sizeof(value));
+    p += sizeof(value);
+    return value;
+  }
+
+private:
+  inline_buffer<N> buffer;
+  std::unique_ptr<std::vector<uint8_t> > heap;
+  uint16_t nof_args = 0;
+  bool truncated = false;
+};
+
+} // namespace detail
+
+} // namespace srslog
+
+#endif // SRSLOG_DETAIL_SUPPORT_INLINE_STORAGE_H
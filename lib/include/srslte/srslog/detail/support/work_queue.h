@@ -23,7 +23,9 @@
 #define SRSLOG_DETAIL_SUPPORT_WORK_QUEUE_H
 
 #include "srslte/srslog/detail/support/thread_utils.h"
-#include <queue>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 
 #ifndef SRSLOG_QUEUE_CAPACITY
 #define SRSLOG_QUEUE_CAPACITY 8192
@@ -33,109 +35,168 @@ namespace srslog {
 
 namespace detail {
 
-//:TODO: this is a temp work queue.
-
-/// Thread safe generic data type work queue.
+/// Bounded lock free multiple producer single consumer work queue.
+///
+/// Elements live in a ring of preallocated slots, each one tagged with a
+/// sequence number that tells producers and the consumer when the slot can be
+/// written or read. Producers claim a slot with a single CAS and never block:
+/// when the queue is full the new element is discarded and accounted for.
+/// The consumer processes elements in place and may sleep on a condition
+/// variable, producers only take its mutex when the consumer is sleeping.
+/// NOTE: The capacity must be a power of two.
 template <typename T, size_t capacity = SRSLOG_QUEUE_CAPACITY>
 class work_queue
 {
-  std::queue<T> queue;
-  mutable condition_variable cond_var;
+  static_assert(capacity > 1 && (capacity & (capacity - 1)) == 0,
+                "Queue capacity must be a power of two");
+
+  struct slot {
+    std::atomic<size_t> seq;
+    T value;
+  };
+
+  static constexpr size_t mask = capacity - 1;
   static constexpr size_t threshold = capacity * 0.98;
 
 public:
-  work_queue() = default;
+  work_queue() : slots(new slot[capacity])
+  {
+    for (size_t i = 0; i != capacity; ++i) {
+      slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
 
   work_queue(const work_queue&) = delete;
   work_queue& operator=(const work_queue&) = delete;
 
-  /// Inserts a new element into the back of the queue.
-  void push(const T& value)
+  /// Inserts a new element into the back of the queue. Returns false when the
+  /// queue is full and the element has been discarded.
+  template <typename U>
+  bool push(U&& value)
   {
-    cond_var.lock();
-    // Discard the new element if we reach the maximum capacity.
-    if (queue.size() > capacity) {
-      cond_var.unlock();
-      return;
+    if (try_push(std::forward<U>(value))) {
+      return true;
     }
-    queue.push(value);
-    cond_var.signal();
-    cond_var.unlock();
+    nof_discarded.fetch_add(1, std::memory_order_relaxed);
+    return false;
   }
 
-  /// Inserts a new element into the back of the queue.
-  void push(T&& value)
+  /// Inserts a new element into the back of the queue. Returns false when the
+  /// queue is full, leaving the input element untouched.
+  template <typename U>
+  bool try_push(U&& value)
   {
-    cond_var.lock();
-    // Discard the new element if we reach the maximum capacity.
-    if (queue.size() > capacity) {
-      cond_var.unlock();
-      return;
+    size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    slot* s;
+    while (true) {
+      s = &slots[pos & mask];
+      size_t seq = s->seq.load(std::memory_order_acquire);
+      intptr_t diff = intptr_t(seq) - intptr_t(pos);
+      if (diff == 0) {
+        if (enqueue_pos.compare_exchange_weak(
+                pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // The queue is full.
+        return false;
+      } else {
+        pos = enqueue_pos.load(std::memory_order_relaxed);
+      }
     }
-    queue.push(std::move(value));
-    cond_var.signal();
-    cond_var.unlock();
-  }
 
-  /// Extracts the top most element from the queue.
-  /// NOTE: This method blocks while the queue is empty.
-  T pop()
-  {
-    cond_var.lock();
+    s->value = std::forward<U>(value);
+    s->seq.store(pos + 1, std::memory_order_release);
 
-    while (queue.empty()) {
-      cond_var.wait();
+    // Pairs with the fence in timed_front() so that either the consumer
+    // observes the new element or we observe that it is sleeping.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (consumer_waiting.load(std::memory_order_relaxed)) {
+      cond_var.lock();
+      cond_var.signal();
+      cond_var.unlock();
     }
 
-    T elem = std::move(queue.front());
-    queue.pop();
-
-    cond_var.unlock();
-
-    return elem;
+    return true;
   }
 
-  /// Extracts the top most element from the queue.
-  /// NOTE: This method blocks while the queue is empty or or until the
-  /// programmed timeout expires. Returns a pair with a bool indicating if the
-  /// pop has been successful.
-  std::pair<bool, T> timed_pop(unsigned timeout_ms)
+  /// Returns a pointer to the front element of the queue so that it can be
+  /// processed in place, which must be followed by a call to pop().
+  /// NOTE: This method blocks while the queue is empty or until the programmed
+  /// timeout expires, returning nullptr in that case. Only one consumer thread
+  /// may call this method.
+  T* timed_front(unsigned timeout_ms)
   {
+    slot* s = &slots[dequeue_pos & mask];
+    if (is_readable(*s)) {
+      return &s->value;
+    }
+
     // Build an absolute time reference for the expiration time.
     timespec ts = condition_variable::build_timeout(timeout_ms);
 
     cond_var.lock();
+    consumer_waiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
 
     bool timedout = false;
-    while (queue.empty() && !timedout) {
+    while (!is_readable(*s) && !timedout) {
       timedout = cond_var.wait(ts);
     }
 
-    // Did we wake up on timeout?
-    if (timedout && queue.empty()) {
-      cond_var.unlock();
-      return {false, T{}};
-    }
-
-    // Here we have been woken up normally.
-    T Item = std::move(queue.front());
-    queue.pop();
-
+    consumer_waiting.store(false, std::memory_order_relaxed);
     cond_var.unlock();
 
-    return {true, std::move(Item)};
+    return is_readable(*s) ? &s->value : nullptr;
+  }
+
+  /// Releases the front element of the queue returned by timed_front().
+  void pop()
+  {
+    slot& s = slots[dequeue_pos & mask];
+    s.seq.store(dequeue_pos + capacity, std::memory_order_release);
+    ++dequeue_pos;
+    dequeue_count.store(dequeue_pos, std::memory_order_relaxed);
   }
 
   /// Capacity of the queue.
   size_t get_capacity() const { return capacity; }
 
+  /// Returns the approximate number of elements stored in the queue.
+  size_t size() const
+  {
+    size_t head = enqueue_pos.load(std::memory_order_relaxed);
+    size_t tail = dequeue_count.load(std::memory_order_relaxed);
+    return (head > tail) ? head - tail : 0;
+  }
+
   /// Returns true when the queue is almost full, otherwise returns false.
-  bool is_almost_full() const
+  bool is_almost_full() const { return size() > threshold; }
+
+  /// Returns the number of elements that have been discarded because the queue
+  /// was full.
+  size_t get_nof_discarded() const
   {
-    cond_var_scoped_lock lock(cond_var);
+    return nof_discarded.load(std::memory_order_relaxed);
+  }
 
-    return queue.size() > threshold;
+private:
+  bool is_readable(const slot& s) const
+  {
+    return s.seq.load(std::memory_order_acquire) == dequeue_pos + 1;
   }
+
+private:
+  // Producer and consumer indexes are kept in separate cache lines.
+  std::unique_ptr<slot[]> slots;
+  char pad0[64];
+  std::atomic<size_t> enqueue_pos{0};
+  std::atomic<size_t> nof_discarded{0};
+  char pad1[64];
+  size_t dequeue_pos = 0;
+  std::atomic<size_t> dequeue_count{0};
+  std::atomic<bool> consumer_waiting{false};
+  mutable condition_variable cond_var;
 };
 
 } // namespace detail
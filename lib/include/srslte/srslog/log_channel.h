@@ -23,6 +23,7 @@
 #define SRSLOG_LOG_CHANNEL_H
 
 #include "srslte/srslog/detail/log_backend.h"
+#include <atomic>
 #include <cassert>
 
 namespace srslog {
@@ -80,89 +81,108 @@ public:
   log_channel& operator=(const log_channel& other) = delete;
 
   /// Controls when the channel accepts incoming log entries.
-  void set_enabled(bool enabled) { is_enabled = enabled; }
+  void set_enabled(bool enabled)
+  {
+    is_enabled.store(enabled, std::memory_order_relaxed);
+  }
 
   /// Returns true if the channel is accepting incoming log entries, otherwise
   /// false.
-  bool enabled() const { return is_enabled; }
+  bool enabled() const { return is_enabled.load(std::memory_order_relaxed); }
 
   /// Returns the id string of the channel.
   const std::string& id() const { return log_id; }
 
   /// Set the log channel context to the specified value.
-  void set_context(uint32_t x) { ctx_value = x; }
+  void set_context(uint32_t x)
+  {
+    ctx_value.store(x, std::memory_order_relaxed);
+  }
 
   /// Set the maximum number of bytes to can be printed in a hex dump.
   /// Set to -1 to indicate no hex dump limit.
-  void set_hex_dump_max_size(int size) { hex_max_size = size; }
+  void set_hex_dump_max_size(int size)
+  {
+    hex_max_size.store(size, std::memory_order_relaxed);
+  }
 
   /// Builds the provided log entry and passes it to the backend. When the
   /// channel is disabled the log entry will be discarded.
+  /// NOTE: The format string is not copied, it must have static storage
+  /// duration, i.e. a string literal.
   template <typename... Args>
-  void operator()(const std::string& fmtstr, Args&&... args)
+  void operator()(const char* fmtstr, Args&&... args)
   {
     if (!enabled()) {
       return;
     }
     assert(&log_sink);
-    // Populate the store with all incoming arguments.
-    fmt::dynamic_format_arg_store<fmt::printf_context> store;
-    (void)std::initializer_list<int>{(store.push_back(args), 0)...};
+
+    // Build the log entry in place, populating the store with all incoming
+    // arguments.
+    detail::log_entry entry;
+    fill_log_entry(entry, fmtstr);
+    (void)std::initializer_list<int>{(entry.store.push_back(args), 0)...};
 
     // Send the log entry to the backend.
-    detail::log_entry entry = {&log_sink,
-                               std::chrono::high_resolution_clock::now(),
-                               {ctx_value, should_print_context},
-                               fmtstr,
-                               std::move(store),
-                               log_name,
-                               log_tag};
     backend.push(std::move(entry));
   }
 
   /// Builds the provided log entry and passes it to the backend. When the
   /// channel is disabled the log entry will be discarded.
+  /// NOTE: The format string is not copied, it must have static storage
+  /// duration, i.e. a string literal.
   template <typename... Args>
   void operator()(const uint8_t* buffer,
                   size_t len,
-                  const std::string& fmtstr,
+                  const char* fmtstr,
                   Args&&... args)
   {
     if (!enabled()) {
       return;
     }
-
     assert(&log_sink);
-    // Populate the store with all incoming arguments.
-    fmt::dynamic_format_arg_store<fmt::printf_context> store;
-    (void)std::initializer_list<int>{(store.push_back(args), 0)...};
+
+    // Build the log entry in place, populating the store with all incoming
+    // arguments.
+    detail::log_entry entry;
+    fill_log_entry(entry, fmtstr);
+    (void)std::initializer_list<int>{(entry.store.push_back(args), 0)...};
 
     // Calculate the length to capture in the buffer.
-    if (hex_max_size >= 0)
-      len = std::min<size_t>(len, hex_max_size);
+    int max_size = hex_max_size.load(std::memory_order_relaxed);
+    if (max_size >= 0)
+      len = std::min<size_t>(len, max_size);
+    entry.hex_dump.append(buffer, len);
 
     // Send the log entry to the backend.
-    detail::log_entry entry = {&log_sink,
-                               std::chrono::high_resolution_clock::now(),
-                               {ctx_value, should_print_context},
-                               fmtstr,
-                               std::move(store),
-                               log_name,
-                               log_tag,
-                               std::vector<uint8_t>(buffer, buffer + len)};
     backend.push(std::move(entry));
   }
 
 private:
+  /// Fills the fixed fields of the log entry.
+  void fill_log_entry(detail::log_entry& entry, const char* fmtstr) const
+  {
+    entry.s = &log_sink;
+    entry.tp = std::chrono::high_resolution_clock::now();
+    entry.context = {ctx_value.load(std::memory_order_relaxed),
+                     should_print_context};
+    entry.fmtstring = fmtstr;
+    entry.log_name = log_name.c_str();
+    entry.log_tag = log_tag;
+  }
+
   const std::string log_id;
   sink& log_sink;
   detail::log_backend& backend;
   const std::string log_name;
   const char log_tag;
   const bool should_print_context;
-  detail::shared_variable<uint32_t> ctx_value;
-  detail::shared_variable<int> hex_max_size;
-  detail::shared_variable<bool> is_enabled;
+  // Atomics instead of mutex guarded variables, as these are read on every log
+  // call by all logging threads.
+  std::atomic<uint32_t> ctx_value;
+  std::atomic<int> hex_max_size;
+  std::atomic<bool> is_enabled;
 };
 
 } // namespace srslog
@@ -23,6 +23,7 @@
 #define SRSLOG_LOGGER_H
 
 #include "srslte/srslog/log_channel.h"
+#include <array>
 
 namespace srslog {
 
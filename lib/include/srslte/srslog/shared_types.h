@@ -29,6 +29,16 @@ namespace srslog {
 /// Generic error handler callback.
 using error_handler = std::function<void(const std::string&)>;
 
+/// Behaviour of the backend when log entries arrive faster than they can be
+/// processed and the backend queue becomes full.
+enum class overflow_policy {
+  /// New log entries are silently discarded.
+  drop,
+  /// New log entries are discarded, and the number of lost entries gets
+  /// written to the sinks as soon as the backend catches up.
+  count
+};
+
 } // namespace srslog
 
 #endif // SRSLOG_SHARED_TYPES_H
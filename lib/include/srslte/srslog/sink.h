@@ -22,6 +22,7 @@
 #ifndef SRSLOG_SINK_H
 #define SRSLOG_SINK_H
 
+#include "srslte/srslog/detail/log_entry.h"
 #include "srslte/srslog/detail/support/error_string.h"
 #include "srslte/srslog/detail/support/memory_buffer.h"
 
@@ -39,6 +40,17 @@ public:
 
   /// Flushes any buffered contents to the backing store.
   virtual detail::error_string flush() = 0;
+
+  /// Returns true when the sink stores log entries in binary form, in which
+  /// case the backend passes them unformatted to write_entry().
+  virtual bool is_binary() const { return false; }
+
+  /// Writes the provided log entry into the sink without formatting it to
+  /// text. Only called for binary sinks.
+  virtual detail::error_string write_entry(const detail::log_entry& entry)
+  {
+    return {};
+  }
 };
 
 } // namespace srslog
@@ -171,6 +171,13 @@ sink& fetch_stderr_sink();
 /// NOTE: Any '#' characters in the id will get removed.
 sink& fetch_file_sink(const std::string& path, size_t max_size = 0);
 
+/// Returns an instance of a sink that writes log entries in binary form into a
+/// file in the specified path. Formatting of log entries is deferred to the
+/// srslog_decode tool, which converts binary files to text offline. The
+/// max_size parameter behaves as in fetch_file_sink.
+/// NOTE: Any '#' characters in the id will get removed.
+sink& fetch_binary_file_sink(const std::string& path, size_t max_size = 0);
+
 /// Creates a new sink that writes into the a file in the specified path and
 /// registers it into a sink repository so that it can be later retrieved in
 /// other parts of the application. Returns a pointer to the newly created sink
@@ -216,6 +223,15 @@ void flush();
 /// NOTE: This function should be called before init() and is NOT thread safe.
 void set_error_handler(error_handler handler);
 
+/// Selects how log entries discarded because the backend queue is full are
+/// reported. Entries are silently dropped by default.
+/// NOTE: This function should be called before init() and is NOT thread safe.
+void set_queue_overflow_policy(overflow_policy policy);
+
+/// Returns the number of log entries that have been discarded because the
+/// backend queue was full.
+size_t get_nof_discarded_log_entries();
+
 } // namespace srslog
 
 #endif // SRSLOG_SRSLOG_H
@@ -39,6 +39,7 @@ extern "C" {
 #include "srslte/phy/utils/convolution.h"
 #include "srslte/phy/utils/debug.h"
 #include "srslte/phy/utils/ringbuffer.h"
+#include "srslte/phy/utils/spsc_ringbuffer.h"
 #include "srslte/phy/utils/vector.h"
 
 #include "srslte/phy/common/phy_common.h"
@@ -119,6 +120,7 @@ extern "C" {
 #include "srslte/phy/sync/cfo.h"
 #include "srslte/phy/sync/cp.h"
 #include "srslte/phy/sync/pss.h"
+#include "srslte/phy/sync/pss_search.h"
 #include "srslte/phy/sync/refsignal_dl_sync.h"
 #include "srslte/phy/sync/sfo.h"
 #include "srslte/phy/sync/sss.h"
@@ -24,14 +24,18 @@
  *
  * @brief Queue of unique pointers to byte buffers used in PDCP and RLC TX queues.
  *        Uses a blocking queue with bounded capacity to block higher layers
- *        when pushing uplink traffic
+ *        when pushing uplink traffic.
+ *        The byte_buffer_spsc_queue variant is a non-blocking, lock-free alternative
+ *        for the RLC TX path, where PDCP is the only writer and MAC the only reader.
  */
 
 #ifndef SRSLTE_BYTE_BUFFERQUEUE_H
 #define SRSLTE_BYTE_BUFFERQUEUE_H
 
+#include "srslte/adt/spsc_queue.h"
 #include "srslte/common/block_queue.h"
 #include "srslte/common/common.h"
+#include <atomic>
 #include <pthread.h>
 
 namespace srslte {
@@ -89,6 +93,69 @@ private:
   uint32_t                          unread_bytes = 0;
 };
 
+class byte_buffer_spsc_queue
+{
+public:
+  byte_buffer_spsc_queue(int capacity = 128) : queue(capacity) {}
+
+  // Producer side (PDCP). The byte count is increased before the SDU is published, so that the consumer never
+  // decrements it below zero
+  srslte::error_type<unique_byte_buffer_t> try_write(unique_byte_buffer_t&& msg)
+  {
+    uint32_t nof_bytes = msg->N_bytes;
+    unread_bytes.fetch_add(nof_bytes, std::memory_order_relaxed);
+    srslte::error_type<unique_byte_buffer_t> ret = queue.try_push(std::move(msg));
+    if (not ret) {
+      unread_bytes.fetch_sub(nof_bytes, std::memory_order_relaxed);
+    }
+    return ret;
+  }
+
+  // Consumer side (MAC). Returns an empty pointer if there is nothing to read
+  unique_byte_buffer_t read()
+  {
+    unique_byte_buffer_t msg;
+    try_read(&msg);
+    return msg;
+  }
+
+  bool try_read(unique_byte_buffer_t* msg)
+  {
+    unique_byte_buffer_t tmp;
+    if (not queue.try_pop(&tmp)) {
+      return false;
+    }
+    unread_bytes.fetch_sub(tmp->N_bytes, std::memory_order_relaxed);
+    if (msg != nullptr) {
+      *msg = std::move(tmp);
+    }
+    return true;
+  }
+
+  // Only applied while the queue is empty, i.e. when the bearer is (re)configured. Returns false if the capacity
+  // was kept
+  bool     resize(uint32_t capacity) { return queue.resize(capacity); }
+  uint32_t size() { return (uint32_t)queue.size(); }
+  uint32_t capacity() { return (uint32_t)queue.capacity(); }
+
+  uint32_t size_bytes() { return unread_bytes.load(std::memory_order_relaxed); }
+
+  bool is_empty() { return queue.empty(); }
+
+  bool is_full() { return queue.full(); }
+
+  // Number of SDUs that can still be written. Exact for the producer, since the consumer can only free slots
+  uint32_t free_space()
+  {
+    size_t nof_used = queue.size();
+    return nof_used < queue.capacity() ? (uint32_t)(queue.capacity() - nof_used) : 0;
+  }
+
+private:
+  spsc_queue<unique_byte_buffer_t> queue;
+  std::atomic<uint32_t>            unread_bytes{0};
+};
+
 } // namespace srslte
 
 #endif // SRSLTE_BYTE_BUFFERQUEUE_H
@@ -117,6 +117,12 @@ public:
 
   // GW/SDAP/RRC interface
   virtual void write_sdu(unique_byte_buffer_t sdu) = 0;
+  virtual void write_sdus(unique_byte_buffer_list_t sdus)
+  {
+    for (auto& sdu : sdus) {
+      write_sdu(std::move(sdu));
+    }
+  }
 
   // RLC interface
   virtual void write_pdu(unique_byte_buffer_t pdu) = 0;
@@ -151,10 +157,15 @@ protected:
 
   srslte::as_security_config_t sec_cfg = {};
 
+  // AES key schedules for EEA2/EIA2, expanded once in config_security() instead of per PDU
+  srslte::aes128_key_ctx_t k_enc_ctx;
+  srslte::aes128_key_ctx_t k_int_ctx;
+
   // Security functions
   void integrity_generate(uint8_t* msg, uint32_t msg_len, uint32_t count, uint8_t* mac);
   bool integrity_verify(uint8_t* msg, uint32_t msg_len, uint32_t count, uint8_t* mac);
   void cipher_encrypt(uint8_t* msg, uint32_t msg_len, uint32_t count, uint8_t* ct);
+  void cipher_encrypt_batch(security_pdu_t* pdus, uint32_t nof_pdus);
   void cipher_decrypt(uint8_t* ct, uint32_t ct_len, uint32_t count, uint8_t* msg);
 
   // Common packing functions
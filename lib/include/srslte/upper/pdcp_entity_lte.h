@@ -39,6 +39,9 @@ namespace srslte {
 
 #define PDCP_CONTROL_MAC_I 0x00000000
 
+// Number of SDUs ciphered together by write_sdus()
+#define PDCP_TX_BATCH_SIZE 32
+
 /****************************************************************************
  * LTE PDCP Entity
  * Class for LTE PDCP entities
@@ -59,6 +62,7 @@ public:
 
   // GW/RRC interface
   void write_sdu(unique_byte_buffer_t sdu) override;
+  void write_sdus(unique_byte_buffer_list_t sdus) override;
 
   // RLC interface
   void write_pdu(unique_byte_buffer_t pdu) override;
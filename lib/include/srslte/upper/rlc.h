@@ -57,10 +57,12 @@ public:
 
   // PDCP interface
   void write_sdu(uint32_t lcid, unique_byte_buffer_t sdu);
+  void write_sdus(uint32_t lcid, unique_byte_buffer_list_t sdus);
   void write_sdu_mch(uint32_t lcid, unique_byte_buffer_t sdu);
   bool rb_is_um(uint32_t lcid);
   void discard_sdu(uint32_t lcid, uint32_t discard_sn);
-  bool sdu_queue_is_full(uint32_t lcid);
+  bool     sdu_queue_is_full(uint32_t lcid);
+  uint32_t sdu_queue_space(uint32_t lcid);
 
   // MAC interface
   bool     has_data_locked(const uint32_t lcid);
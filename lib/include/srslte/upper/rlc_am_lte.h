@@ -30,28 +30,103 @@
 #include "srslte/upper/byte_buffer_queue.h"
 #include "srslte/upper/rlc_am_base.h"
 #include "srslte/upper/rlc_common.h"
+#include <atomic>
 #include <deque>
-#include <list>
-#include <map>
+#include <limits>
+#include <vector>
 
 namespace srslte {
 
 #undef RLC_AM_BUFFER_DEBUG
 
+const uint32_t rlc_invalid_sn = std::numeric_limits<uint32_t>::max();
+
 struct rlc_amd_rx_pdu_t {
   rlc_amd_pdu_header_t header;
   unique_byte_buffer_t buf;
+  uint32_t             rlc_sn = rlc_invalid_sn;
+
+  void reset()
+  {
+    buf.reset();
+    rlc_sn = rlc_invalid_sn;
+  }
 };
 
+// Segments of one PDU, sorted by SO. The vector keeps its capacity when the window slot is recycled, so
+// segment reception does not allocate once the slot has been used
 struct rlc_amd_rx_pdu_segments_t {
-  std::list<rlc_amd_rx_pdu_t> segments;
+  std::vector<rlc_amd_rx_pdu_t> segments;
+  uint32_t                      rlc_sn = rlc_invalid_sn;
+
+  void reset()
+  {
+    segments.clear();
+    rlc_sn = rlc_invalid_sn;
+  }
 };
 
 struct rlc_amd_tx_pdu_t {
   rlc_amd_pdu_header_t header;
   unique_byte_buffer_t buf;
-  uint32_t             retx_count;
-  bool                 is_acked;
+  uint32_t             retx_count = 0;
+  uint32_t             rlc_sn     = rlc_invalid_sn;
+  bool                 is_acked   = false;
+
+  void reset()
+  {
+    buf.reset();
+    retx_count = 0;
+    is_acked   = false;
+    rlc_sn     = rlc_invalid_sn;
+  }
+};
+
+/**
+ * Ring-indexed RLC window. The AM window (512) is half the SN modulus (1024), so SN % RLC_AM_WINDOW_SIZE is
+ * unique for all SNs inside the window and PDUs can be stored in a fixed array without any tree lookups or
+ * per-PDU heap allocations. Each element stores its SN to tell valid entries from stale ones, and provides reset()
+ * to release its resources when the slot is freed. The slots are allocated once on construction and kept on
+ * the heap, as the PDU headers make the window too large to live on the stack.
+ */
+template <class T>
+struct rlc_ringbuffer_t {
+  rlc_ringbuffer_t() : window(RLC_AM_WINDOW_SIZE) {}
+
+  T& add_pdu(uint32_t sn)
+  {
+    if (not has_sn(sn)) {
+      count++;
+    }
+    T& slot = (*this)[sn];
+    slot.reset();
+    slot.rlc_sn = sn;
+    return slot;
+  }
+  void remove_pdu(uint32_t sn)
+  {
+    if (has_sn(sn)) {
+      (*this)[sn].reset();
+      count--;
+    }
+  }
+  T&       operator[](uint32_t sn) { return window[sn % RLC_AM_WINDOW_SIZE]; }
+  const T& operator[](uint32_t sn) const { return window[sn % RLC_AM_WINDOW_SIZE]; }
+  size_t   size() const { return count; }
+  bool     empty() const { return count == 0; }
+  bool     full() const { return count >= RLC_AM_WINDOW_SIZE; }
+  void     clear()
+  {
+    for (T& e : window) {
+      e.reset();
+    }
+    count = 0;
+  }
+  bool has_sn(uint32_t sn) const { return (*this)[sn].rlc_sn == sn; }
+
+private:
+  size_t         count = 0;
+  std::vector<T> window;
 };
 
 struct rlc_amd_retx_t {
@@ -79,9 +154,10 @@ public:
   uint32_t   get_bearer();
 
   // PDCP interface
-  void write_sdu(unique_byte_buffer_t sdu);
-  void discard_sdu(uint32_t pdcp_sn);
-  bool sdu_queue_is_full();
+  void     write_sdu(unique_byte_buffer_t sdu);
+  void     discard_sdu(uint32_t pdcp_sn);
+  bool     sdu_queue_is_full();
+  uint32_t sdu_queue_space();
 
   // MAC interface
   bool     has_data();
@@ -108,10 +184,11 @@ private:
     void reestablish();
     void stop();
 
-    int  write_sdu(unique_byte_buffer_t sdu);
-    int  read_pdu(uint8_t* payload, uint32_t nof_bytes);
-    void discard_sdu(uint32_t discard_sn);
-    bool sdu_queue_is_full();
+    int      write_sdu(unique_byte_buffer_t sdu);
+    int      read_pdu(uint8_t* payload, uint32_t nof_bytes);
+    void     discard_sdu(uint32_t discard_sn);
+    bool     sdu_queue_is_full();
+    uint32_t sdu_queue_space();
 
     bool     has_data();
     uint32_t get_buffer_state();
@@ -137,6 +214,7 @@ private:
     bool retx_queue_has_sn(uint32_t sn);
     int  required_buffer_size(rlc_amd_retx_t retx);
     void retransmit_random_pdu();
+    void publish_buffer_state();
 
     // Helpers
     bool poll_required();
@@ -154,8 +232,8 @@ private:
     rlc_am_config_t cfg = {};
 
     // TX SDU buffers
-    byte_buffer_queue    tx_sdu_queue;
-    unique_byte_buffer_t tx_sdu;
+    byte_buffer_spsc_queue tx_sdu_queue;
+    unique_byte_buffer_t   tx_sdu;
 
     bool tx_enabled = false;
 
@@ -188,12 +266,17 @@ private:
     bsr_callback_t bsr_callback;
 
     // Tx windows
-    std::map<uint32_t, rlc_amd_tx_pdu_t> tx_window;
-    std::deque<rlc_amd_retx_t>           retx_queue;
+    rlc_ringbuffer_t<rlc_amd_tx_pdu_t> tx_window;
+    std::deque<rlc_amd_retx_t>         retx_queue;
 
     // Mutexes
     pthread_mutex_t mutex;
 
+    // Snapshot of the mutex-protected state needed by get_buffer_state()/has_data(). It is republished at the end of
+    // every locked operation, so MAC can poll the buffer state without contending with read_pdu() or status handling.
+    // Bits 0-31: bytes of the next retx, bits 32-62: remaining bytes of a segmented SDU, bit 63: tx_window full
+    std::atomic<uint64_t> buffer_state_snapshot{0};
+
     // Metrics
     uint32_t num_tx_bytes = 0;
   };
@@ -261,8 +344,8 @@ private:
     pthread_mutex_t mutex;
 
     // Rx windows
-    std::map<uint32_t, rlc_amd_rx_pdu_t>          rx_window;
-    std::map<uint32_t, rlc_amd_rx_pdu_segments_t> rx_segments;
+    rlc_ringbuffer_t<rlc_amd_rx_pdu_t>          rx_window;
+    rlc_ringbuffer_t<rlc_amd_rx_pdu_segments_t> rx_segments;
 
     // Metrics
     uint32_t num_rx_bytes = 0;
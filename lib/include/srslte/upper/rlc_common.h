@@ -268,6 +268,8 @@ public:
   virtual void write_sdu(unique_byte_buffer_t sdu)                = 0;
   virtual void discard_sdu(uint32_t discard_sn)                   = 0;
   virtual bool sdu_queue_is_full()                                = 0;
+  // Number of SDUs that can still be written. Entities that cannot tell only guarantee room for one
+  virtual uint32_t sdu_queue_space() { return sdu_queue_is_full() ? 0 : 1; }
 
   // MAC interface
   virtual bool     has_data() = 0;
@@ -53,9 +53,10 @@ public:
   uint32_t   get_bearer();
 
   // PDCP interface
-  void write_sdu(unique_byte_buffer_t sdu);
-  void discard_sdu(uint32_t discard_sn);
-  bool sdu_queue_is_full();
+  void     write_sdu(unique_byte_buffer_t sdu);
+  void     discard_sdu(uint32_t discard_sn);
+  bool     sdu_queue_is_full();
+  uint32_t sdu_queue_space();
 
   // MAC interface
   bool     has_data();
@@ -81,9 +82,9 @@ protected:
     void             stop();
     void             reestablish();
     void             empty_queue();
-    void             write_sdu(unique_byte_buffer_t sdu);
     void             discard_sdu(uint32_t discard_sn);
     bool             sdu_queue_is_full();
+    uint32_t         sdu_queue_space();
     int              try_write_sdu(unique_byte_buffer_t sdu);
     void             reset_metrics();
     bool             has_data();
@@ -97,8 +98,8 @@ protected:
     rlc_config_t cfg = {};
 
     // TX SDU buffers
-    byte_buffer_queue    tx_sdu_queue;
-    unique_byte_buffer_t tx_sdu;
+    byte_buffer_spsc_queue tx_sdu_queue;
+    unique_byte_buffer_t   tx_sdu;
 
     // Mutexes
     std::mutex mutex;
@@ -102,6 +102,71 @@ void log_error_code(SRSASN_CODE code, const char* filename, int line)
   }
 }
 
+/************************
+    arena allocator
+************************/
+
+mem_arena::~mem_arena()
+{
+  while (chunks != nullptr) {
+    chunk_t* next = chunks->next;
+    ::operator delete(chunks);
+    chunks = next;
+  }
+}
+
+void* mem_arena::allocate_chunk(size_t sz, size_t align)
+{
+  if (chunks != nullptr) {
+    used += cur - first_byte();
+  }
+  size_t   data_size = std::max(chunk_size, sz + align);
+  chunk_t* chunk     = static_cast<chunk_t*>(::operator new(sizeof(chunk_t) + data_size));
+  chunk->next        = chunks;
+  chunk->size        = data_size;
+  chunks             = chunk;
+  cur                = first_byte();
+  end                = cur + data_size;
+  return allocate(sz, align);
+}
+
+void mem_arena::reset()
+{
+  if (chunks == nullptr) {
+    return;
+  }
+  if (chunks->next != nullptr) {
+    // the last message did not fit in one chunk. Make the next ones fit
+    size_t total = 0;
+    while (chunks != nullptr) {
+      chunk_t* next = chunks->next;
+      total += chunks->size;
+      ::operator delete(chunks);
+      chunks = next;
+    }
+    chunk_size = total;
+    allocate_chunk(0, 1);
+  }
+  used = 0;
+  cur  = first_byte();
+  end  = cur + chunks->size;
+}
+
+size_t mem_arena::nof_chunks() const
+{
+  size_t n = 0;
+  for (chunk_t* c = chunks; c != nullptr; c = c->next) {
+    n++;
+  }
+  return n;
+}
+
+mem_arena*& current_arena()
+{
+  static thread_local mem_arena* arena = nullptr;
+  return arena;
+}
+
 /*********************
        bit_ref
 *********************/
@@ -132,7 +197,7 @@ int bit_ref_impl<Ptr>::distance_bytes() const
   return ((int)(ptr - start_ptr)) + ((offset) ? 1 : 0);
 }
 
-SRSASN_CODE bit_ref::pack(uint32_t val, uint32_t n_bits)
+SRSASN_CODE bit_ref::pack_bitwise(uint32_t val, uint32_t n_bits)
 {
   if (n_bits >= 32) {
     log_error("This method only supports packing up to 32 bits\n");
@@ -183,7 +248,7 @@ SRSASN_CODE unpack_bits(T& val, Ptr& ptr, uint8_t& offset, const uint8_t* max_pt
       n_bits = 0;
     } else {
       auto mask = static_cast<uint8_t>((1u << (8u - offset)) - 1u);
-      val += ((uint32_t)((*ptr) & mask)) << (n_bits - 8 + offset);
+      val += ((uint64_t)((*ptr) & mask)) << (n_bits - 8 + offset);
       n_bits -= 8 - offset;
       offset = 0;
       ptr++;
@@ -234,19 +299,21 @@ SRSASN_CODE bit_ref_impl<Ptr>::unpack_bytes(uint8_t* buf, uint32_t n_bytes)
   if (n_bytes == 0) {
     return SRSASN_SUCCESS;
   }
-  if (ptr + n_bytes >= max_ptr) {
+  // Unaligned strings also touch the first bits of the byte after the last full one
+  if ((uint32_t)(max_ptr - ptr) < n_bytes + (offset > 0 ? 1 : 0)) {
     log_error("Buffer size limit was achieved\n");
     return SRSASN_ERROR_DECODE_FAIL;
   }
   if (offset == 0) {
     // Aligned case
     memcpy(buf, ptr, n_bytes);
-    ptr += n_bytes;
   } else {
+    // Unaligned case: each octet is the tail of one buffer byte followed by the head of the next
     for (uint32_t i = 0; i < n_bytes; ++i) {
-      HANDLE_CODE(unpack(buf[i], 8));
+      buf[i] = (uint8_t)((ptr[i] << offset) | (ptr[i + 1] >> (8u - offset)));
     }
   }
+  ptr += n_bytes;
   return SRSASN_SUCCESS;
 }
 
@@ -297,19 +364,23 @@ SRSASN_CODE bit_ref::pack_bytes(const uint8_t* buf, uint32_t n_bytes)
   if (n_bytes == 0) {
     return SRSASN_SUCCESS;
   }
-  if (ptr + n_bytes >= max_ptr) {
+  if ((uint32_t)(max_ptr - ptr) < n_bytes + (offset > 0 ? 1 : 0)) {
     log_error("Buffer size limit was achieved\n");
     return SRSASN_ERROR_ENCODE_FAIL;
   }
   if (offset == 0) {
     // Aligned case
     memcpy(ptr, buf, n_bytes);
-    ptr += n_bytes;
   } else {
-    for (uint32_t i = 0; i < n_bytes; ++i) {
-      pack(buf[i], 8);
+    // Unaligned case: the bits before the current position are kept and the rest of the last byte is zeroed
+    uint8_t keepmask = (uint8_t)(0xffu << (8u - offset));
+    ptr[0]           = (uint8_t)((ptr[0] & keepmask) | (buf[0] >> offset));
+    for (uint32_t i = 1; i < n_bytes; ++i) {
+      ptr[i] = (uint8_t)((buf[i - 1] << (8u - offset)) | (buf[i] >> offset));
     }
+    ptr[n_bytes] = (uint8_t)(buf[n_bytes - 1] << (8u - offset));
   }
+  ptr += n_bytes;
   return SRSASN_SUCCESS;
 }
 
@@ -1000,9 +1071,7 @@ template <bool Al>
 SRSASN_CODE unbounded_octstring<Al>::pack(bit_ref& bref) const
 {
   HANDLE_CODE(pack_length(bref, size(), aligned));
-  for (uint32_t i = 0; i < size(); ++i) {
-    HANDLE_CODE(bref.pack(octets_[i], 8));
-  }
+  HANDLE_CODE(bref.pack_bytes(octets_.data(), size()));
   return SRSASN_SUCCESS;
 }
 
@@ -1012,9 +1081,7 @@ SRSASN_CODE unbounded_octstring<Al>::unpack(cbit_ref& bref)
   uint32_t len;
   HANDLE_CODE(unpack_length(len, bref, aligned));
   resize(len);
-  for (uint32_t i = 0; i < size(); ++i) {
-    HANDLE_CODE(bref.unpack(octets_[i], 8));
-  }
+  HANDLE_CODE(bref.unpack_bytes(octets_.data(), size()));
   return SRSASN_SUCCESS;
 }
 
@@ -1097,7 +1164,13 @@ SRSASN_CODE pack_bitfield(bit_ref& bref, const uint8_t* buf, uint32_t nbits, uin
   uint32_t n_octs = ceil_frac(nbits, 8u);
   uint32_t offset = ((nbits - 1) % 8) + 1;
   HANDLE_CODE(bref.pack(buf[n_octs - 1], offset));
-  for (uint32_t i = 1; i < n_octs; ++i) {
+  // the octets are stored in reverse order, so they are packed three per field rather than copied
+  uint32_t i = 1;
+  for (; i + 3 <= n_octs; i += 3) {
+    const uint8_t* octs = &buf[n_octs - 3 - i];
+    HANDLE_CODE(bref.pack(((uint32_t)octs[2] << 16u) | ((uint32_t)octs[1] << 8u) | octs[0], 24));
+  }
+  for (; i < n_octs; ++i) {
     HANDLE_CODE(bref.pack(buf[n_octs - 1 - i], 8));
   }
   return SRSASN_SUCCESS;
@@ -1165,7 +1238,15 @@ SRSASN_CODE unpack_bitfield(uint8_t* buf, cbit_ref& bref, uint32_t n, uint32_t l
   uint32_t n_octs = ceil_frac(n, 8u);
   uint32_t offset = ((n - 1) % 8) + 1;
   HANDLE_CODE(bref.unpack(buf[n_octs - 1], offset));
-  for (uint32_t i = 1; i < n_octs; ++i) {
+  uint32_t i = 1;
+  for (; i + 3 <= n_octs; i += 3) {
+    uint32_t octs;
+    HANDLE_CODE(bref.unpack(octs, 24));
+    buf[n_octs - 1 - i] = (uint8_t)(octs >> 16u);
+    buf[n_octs - 2 - i] = (uint8_t)(octs >> 8u);
+    buf[n_octs - 3 - i] = (uint8_t)octs;
+  }
+  for (; i < n_octs; ++i) {
     HANDLE_CODE(bref.unpack(buf[n_octs - 1 - i], 8));
   }
   return SRSASN_SUCCESS;
@@ -1427,9 +1508,7 @@ varlength_field_pack_guard::~varlength_field_pack_guard()
   pack_length(brefstart, nof_bytes, align);
 
   // pack encoded bytes
-  for (uint32_t i = 0; i < nof_bytes; ++i) {
-    brefstart.pack(buffer[i], 8);
-  }
+  brefstart.pack_bytes(buffer, nof_bytes);
   *bref_tracker = brefstart;
 }
 
@@ -1631,68 +1631,68 @@ presence_e bearers_subject_to_status_transfer_item_ext_ies_o::get_presence(const
 // Extension ::= OPEN TYPE
 count_value_extended_s& bearers_subject_to_status_transfer_item_ext_ies_o::ext_c::ulcount_value_extended()
 {
-  assert_choice_type("COUNTValueExtended", type_.to_string(), "Extension");
+  assert_choice_type(types::ulcount_value_extended, type_, "Extension");
   return c.get<count_value_extended_s>();
 }
 count_value_extended_s& bearers_subject_to_status_transfer_item_ext_ies_o::ext_c::dlcount_value_extended()
 {
-  assert_choice_type("COUNTValueExtended", type_.to_string(), "Extension");
+  assert_choice_type(types::dlcount_value_extended, type_, "Extension");
   return c.get<count_value_extended_s>();
 }
 bounded_bitstring<1, 16384, false, true>&
 bearers_subject_to_status_transfer_item_ext_ies_o::ext_c::receive_status_of_ulpdcpsdus_extended()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::receive_status_of_ulpdcpsdus_extended, type_, "Extension");
   return c.get<bounded_bitstring<1, 16384, false, true> >();
 }
 coun_tvalue_pdcp_snlen18_s& bearers_subject_to_status_transfer_item_ext_ies_o::ext_c::ulcount_value_pdcp_snlen18()
 {
-  assert_choice_type("COUNTvaluePDCP-SNlength18", type_.to_string(), "Extension");
+  assert_choice_type(types::ulcount_value_pdcp_snlen18, type_, "Extension");
   return c.get<coun_tvalue_pdcp_snlen18_s>();
 }
 coun_tvalue_pdcp_snlen18_s& bearers_subject_to_status_transfer_item_ext_ies_o::ext_c::dlcount_value_pdcp_snlen18()
 {
-  assert_choice_type("COUNTvaluePDCP-SNlength18", type_.to_string(), "Extension");
+  assert_choice_type(types::dlcount_value_pdcp_snlen18, type_, "Extension");
   return c.get<coun_tvalue_pdcp_snlen18_s>();
 }
 bounded_bitstring<1, 131072, false, true>&
 bearers_subject_to_status_transfer_item_ext_ies_o::ext_c::receive_status_of_ulpdcpsdus_pdcp_snlen18()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::receive_status_of_ulpdcpsdus_pdcp_snlen18, type_, "Extension");
   return c.get<bounded_bitstring<1, 131072, false, true> >();
 }
 const count_value_extended_s& bearers_subject_to_status_transfer_item_ext_ies_o::ext_c::ulcount_value_extended() const
 {
-  assert_choice_type("COUNTValueExtended", type_.to_string(), "Extension");
+  assert_choice_type(types::ulcount_value_extended, type_, "Extension");
   return c.get<count_value_extended_s>();
 }
 const count_value_extended_s& bearers_subject_to_status_transfer_item_ext_ies_o::ext_c::dlcount_value_extended() const
 {
-  assert_choice_type("COUNTValueExtended", type_.to_string(), "Extension");
+  assert_choice_type(types::dlcount_value_extended, type_, "Extension");
   return c.get<count_value_extended_s>();
 }
 const bounded_bitstring<1, 16384, false, true>&
 bearers_subject_to_status_transfer_item_ext_ies_o::ext_c::receive_status_of_ulpdcpsdus_extended() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::receive_status_of_ulpdcpsdus_extended, type_, "Extension");
   return c.get<bounded_bitstring<1, 16384, false, true> >();
 }
 const coun_tvalue_pdcp_snlen18_s&
 bearers_subject_to_status_transfer_item_ext_ies_o::ext_c::ulcount_value_pdcp_snlen18() const
 {
-  assert_choice_type("COUNTvaluePDCP-SNlength18", type_.to_string(), "Extension");
+  assert_choice_type(types::ulcount_value_pdcp_snlen18, type_, "Extension");
   return c.get<coun_tvalue_pdcp_snlen18_s>();
 }
 const coun_tvalue_pdcp_snlen18_s&
 bearers_subject_to_status_transfer_item_ext_ies_o::ext_c::dlcount_value_pdcp_snlen18() const
 {
-  assert_choice_type("COUNTvaluePDCP-SNlength18", type_.to_string(), "Extension");
+  assert_choice_type(types::dlcount_value_pdcp_snlen18, type_, "Extension");
   return c.get<coun_tvalue_pdcp_snlen18_s>();
 }
 const bounded_bitstring<1, 131072, false, true>&
 bearers_subject_to_status_transfer_item_ext_ies_o::ext_c::receive_status_of_ulpdcpsdus_pdcp_snlen18() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::receive_status_of_ulpdcpsdus_pdcp_snlen18, type_, "Extension");
   return c.get<bounded_bitstring<1, 131072, false, true> >();
 }
 void bearers_subject_to_status_transfer_item_ext_ies_o::ext_c::destroy_()
@@ -4034,63 +4034,63 @@ presence_e cell_traffic_trace_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& cell_traffic_trace_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& cell_traffic_trace_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 fixed_octstring<8, true>& cell_traffic_trace_ies_o::value_c::e_utran_trace_id()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::e_utran_trace_id, type_, "Value");
   return c.get<fixed_octstring<8, true> >();
 }
 eutran_cgi_s& cell_traffic_trace_ies_o::value_c::eutran_cgi()
 {
-  assert_choice_type("EUTRAN-CGI", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_cgi, type_, "Value");
   return c.get<eutran_cgi_s>();
 }
 bounded_bitstring<1, 160, true, true>& cell_traffic_trace_ies_o::value_c::trace_collection_entity_ip_address()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::trace_collection_entity_ip_address, type_, "Value");
   return c.get<bounded_bitstring<1, 160, true, true> >();
 }
 privacy_ind_e& cell_traffic_trace_ies_o::value_c::privacy_ind()
 {
-  assert_choice_type("PrivacyIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::privacy_ind, type_, "Value");
   return c.get<privacy_ind_e>();
 }
 const uint64_t& cell_traffic_trace_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& cell_traffic_trace_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const fixed_octstring<8, true>& cell_traffic_trace_ies_o::value_c::e_utran_trace_id() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::e_utran_trace_id, type_, "Value");
   return c.get<fixed_octstring<8, true> >();
 }
 const eutran_cgi_s& cell_traffic_trace_ies_o::value_c::eutran_cgi() const
 {
-  assert_choice_type("EUTRAN-CGI", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_cgi, type_, "Value");
   return c.get<eutran_cgi_s>();
 }
 const bounded_bitstring<1, 160, true, true>&
 cell_traffic_trace_ies_o::value_c::trace_collection_entity_ip_address() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::trace_collection_entity_ip_address, type_, "Value");
   return c.get<bounded_bitstring<1, 160, true, true> >();
 }
 const privacy_ind_e& cell_traffic_trace_ies_o::value_c::privacy_ind() const
 {
-  assert_choice_type("PrivacyIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::privacy_ind, type_, "Value");
   return c.get<privacy_ind_e>();
 }
 void cell_traffic_trace_ies_o::value_c::destroy_()
@@ -4637,62 +4637,62 @@ presence_e conn_establishment_ind_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& conn_establishment_ind_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& conn_establishment_ind_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 unbounded_octstring<true>& conn_establishment_ind_ies_o::value_c::ue_radio_cap()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 enhanced_coverage_restricted_e& conn_establishment_ind_ies_o::value_c::enhanced_coverage_restricted()
 {
-  assert_choice_type("EnhancedCoverageRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::enhanced_coverage_restricted, type_, "Value");
   return c.get<enhanced_coverage_restricted_e>();
 }
 dl_cp_security_info_s& conn_establishment_ind_ies_o::value_c::dl_cp_security_info()
 {
-  assert_choice_type("DL-CP-SecurityInformation", type_.to_string(), "Value");
+  assert_choice_type(types::dl_cp_security_info, type_, "Value");
   return c.get<dl_cp_security_info_s>();
 }
 ce_mode_brestricted_e& conn_establishment_ind_ies_o::value_c::ce_mode_brestricted()
 {
-  assert_choice_type("CE-ModeBRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_brestricted, type_, "Value");
   return c.get<ce_mode_brestricted_e>();
 }
 const uint64_t& conn_establishment_ind_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& conn_establishment_ind_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const unbounded_octstring<true>& conn_establishment_ind_ies_o::value_c::ue_radio_cap() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const enhanced_coverage_restricted_e& conn_establishment_ind_ies_o::value_c::enhanced_coverage_restricted() const
 {
-  assert_choice_type("EnhancedCoverageRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::enhanced_coverage_restricted, type_, "Value");
   return c.get<enhanced_coverage_restricted_e>();
 }
 const dl_cp_security_info_s& conn_establishment_ind_ies_o::value_c::dl_cp_security_info() const
 {
-  assert_choice_type("DL-CP-SecurityInformation", type_.to_string(), "Value");
+  assert_choice_type(types::dl_cp_security_info, type_, "Value");
   return c.get<dl_cp_security_info_s>();
 }
 const ce_mode_brestricted_e& conn_establishment_ind_ies_o::value_c::ce_mode_brestricted() const
 {
-  assert_choice_type("CE-ModeBRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_brestricted, type_, "Value");
   return c.get<ce_mode_brestricted_e>();
 }
 void conn_establishment_ind_ies_o::value_c::destroy_()
@@ -5238,32 +5238,32 @@ presence_e deactiv_trace_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& deactiv_trace_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& deactiv_trace_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 fixed_octstring<8, true>& deactiv_trace_ies_o::value_c::e_utran_trace_id()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::e_utran_trace_id, type_, "Value");
   return c.get<fixed_octstring<8, true> >();
 }
 const uint64_t& deactiv_trace_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& deactiv_trace_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const fixed_octstring<8, true>& deactiv_trace_ies_o::value_c::e_utran_trace_id() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::e_utran_trace_id, type_, "Value");
   return c.get<fixed_octstring<8, true> >();
 }
 void deactiv_trace_ies_o::value_c::destroy_()
@@ -5822,112 +5822,112 @@ presence_e dl_nas_transport_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& dl_nas_transport_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& dl_nas_transport_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 unbounded_octstring<true>& dl_nas_transport_ies_o::value_c::nas_pdu()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nas_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 ho_restrict_list_s& dl_nas_transport_ies_o::value_c::ho_restrict_list()
 {
-  assert_choice_type("HandoverRestrictionList", type_.to_string(), "Value");
+  assert_choice_type(types::ho_restrict_list, type_, "Value");
   return c.get<ho_restrict_list_s>();
 }
 uint16_t& dl_nas_transport_ies_o::value_c::subscriber_profile_idfor_rfp()
 {
-  assert_choice_type("INTEGER (1..256)", type_.to_string(), "Value");
+  assert_choice_type(types::subscriber_profile_idfor_rfp, type_, "Value");
   return c.get<uint16_t>();
 }
 srvcc_operation_possible_e& dl_nas_transport_ies_o::value_c::srvcc_operation_possible()
 {
-  assert_choice_type("SRVCCOperationPossible", type_.to_string(), "Value");
+  assert_choice_type(types::srvcc_operation_possible, type_, "Value");
   return c.get<srvcc_operation_possible_e>();
 }
 unbounded_octstring<true>& dl_nas_transport_ies_o::value_c::ue_radio_cap()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 dlnaspdu_delivery_ack_request_e& dl_nas_transport_ies_o::value_c::dlnaspdu_delivery_ack_request()
 {
-  assert_choice_type("DLNASPDUDeliveryAckRequest", type_.to_string(), "Value");
+  assert_choice_type(types::dlnaspdu_delivery_ack_request, type_, "Value");
   return c.get<dlnaspdu_delivery_ack_request_e>();
 }
 enhanced_coverage_restricted_e& dl_nas_transport_ies_o::value_c::enhanced_coverage_restricted()
 {
-  assert_choice_type("EnhancedCoverageRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::enhanced_coverage_restricted, type_, "Value");
   return c.get<enhanced_coverage_restricted_e>();
 }
 ce_mode_brestricted_e& dl_nas_transport_ies_o::value_c::ce_mode_brestricted()
 {
-  assert_choice_type("CE-ModeBRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_brestricted, type_, "Value");
   return c.get<ce_mode_brestricted_e>();
 }
 pending_data_ind_e& dl_nas_transport_ies_o::value_c::pending_data_ind()
 {
-  assert_choice_type("PendingDataIndication", type_.to_string(), "Value");
+  assert_choice_type(types::pending_data_ind, type_, "Value");
   return c.get<pending_data_ind_e>();
 }
 const uint64_t& dl_nas_transport_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& dl_nas_transport_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const unbounded_octstring<true>& dl_nas_transport_ies_o::value_c::nas_pdu() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nas_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const ho_restrict_list_s& dl_nas_transport_ies_o::value_c::ho_restrict_list() const
 {
-  assert_choice_type("HandoverRestrictionList", type_.to_string(), "Value");
+  assert_choice_type(types::ho_restrict_list, type_, "Value");
   return c.get<ho_restrict_list_s>();
 }
 const uint16_t& dl_nas_transport_ies_o::value_c::subscriber_profile_idfor_rfp() const
 {
-  assert_choice_type("INTEGER (1..256)", type_.to_string(), "Value");
+  assert_choice_type(types::subscriber_profile_idfor_rfp, type_, "Value");
   return c.get<uint16_t>();
 }
 const srvcc_operation_possible_e& dl_nas_transport_ies_o::value_c::srvcc_operation_possible() const
 {
-  assert_choice_type("SRVCCOperationPossible", type_.to_string(), "Value");
+  assert_choice_type(types::srvcc_operation_possible, type_, "Value");
   return c.get<srvcc_operation_possible_e>();
 }
 const unbounded_octstring<true>& dl_nas_transport_ies_o::value_c::ue_radio_cap() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const dlnaspdu_delivery_ack_request_e& dl_nas_transport_ies_o::value_c::dlnaspdu_delivery_ack_request() const
 {
-  assert_choice_type("DLNASPDUDeliveryAckRequest", type_.to_string(), "Value");
+  assert_choice_type(types::dlnaspdu_delivery_ack_request, type_, "Value");
   return c.get<dlnaspdu_delivery_ack_request_e>();
 }
 const enhanced_coverage_restricted_e& dl_nas_transport_ies_o::value_c::enhanced_coverage_restricted() const
 {
-  assert_choice_type("EnhancedCoverageRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::enhanced_coverage_restricted, type_, "Value");
   return c.get<enhanced_coverage_restricted_e>();
 }
 const ce_mode_brestricted_e& dl_nas_transport_ies_o::value_c::ce_mode_brestricted() const
 {
-  assert_choice_type("CE-ModeBRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_brestricted, type_, "Value");
   return c.get<ce_mode_brestricted_e>();
 }
 const pending_data_ind_e& dl_nas_transport_ies_o::value_c::pending_data_ind() const
 {
-  assert_choice_type("PendingDataIndication", type_.to_string(), "Value");
+  assert_choice_type(types::pending_data_ind, type_, "Value");
   return c.get<pending_data_ind_e>();
 }
 void dl_nas_transport_ies_o::value_c::destroy_()
@@ -6494,22 +6494,22 @@ presence_e dl_non_ueassociated_lp_pa_transport_ies_o::get_presence(const uint32_
 // Value ::= OPEN TYPE
 uint16_t& dl_non_ueassociated_lp_pa_transport_ies_o::value_c::routing_id()
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::routing_id, type_, "Value");
   return c.get<uint16_t>();
 }
 unbounded_octstring<true>& dl_non_ueassociated_lp_pa_transport_ies_o::value_c::lp_pa_pdu()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lp_pa_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const uint16_t& dl_non_ueassociated_lp_pa_transport_ies_o::value_c::routing_id() const
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::routing_id, type_, "Value");
   return c.get<uint16_t>();
 }
 const unbounded_octstring<true>& dl_non_ueassociated_lp_pa_transport_ies_o::value_c::lp_pa_pdu() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lp_pa_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 void dl_non_ueassociated_lp_pa_transport_ies_o::value_c::destroy_()
@@ -6971,64 +6971,64 @@ presence_e dl_s1cdma2000tunnelling_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& dl_s1cdma2000tunnelling_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& dl_s1cdma2000tunnelling_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 erab_ie_container_list_l<erab_data_forwarding_item_ies_o>&
 dl_s1cdma2000tunnelling_ies_o::value_c::erab_subjectto_data_forwarding_list()
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABDataForwardingItemIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_subjectto_data_forwarding_list, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_data_forwarding_item_ies_o> >();
 }
 cdma2000_ho_status_e& dl_s1cdma2000tunnelling_ies_o::value_c::cdma2000_ho_status()
 {
-  assert_choice_type("Cdma2000HOStatus", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_ho_status, type_, "Value");
   return c.get<cdma2000_ho_status_e>();
 }
 cdma2000_rat_type_e& dl_s1cdma2000tunnelling_ies_o::value_c::cdma2000_rat_type()
 {
-  assert_choice_type("Cdma2000RATType", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_rat_type, type_, "Value");
   return c.get<cdma2000_rat_type_e>();
 }
 unbounded_octstring<true>& dl_s1cdma2000tunnelling_ies_o::value_c::cdma2000_pdu()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const uint64_t& dl_s1cdma2000tunnelling_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& dl_s1cdma2000tunnelling_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const erab_ie_container_list_l<erab_data_forwarding_item_ies_o>&
 dl_s1cdma2000tunnelling_ies_o::value_c::erab_subjectto_data_forwarding_list() const
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABDataForwardingItemIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_subjectto_data_forwarding_list, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_data_forwarding_item_ies_o> >();
 }
 const cdma2000_ho_status_e& dl_s1cdma2000tunnelling_ies_o::value_c::cdma2000_ho_status() const
 {
-  assert_choice_type("Cdma2000HOStatus", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_ho_status, type_, "Value");
   return c.get<cdma2000_ho_status_e>();
 }
 const cdma2000_rat_type_e& dl_s1cdma2000tunnelling_ies_o::value_c::cdma2000_rat_type() const
 {
-  assert_choice_type("Cdma2000RATType", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_rat_type, type_, "Value");
   return c.get<cdma2000_rat_type_e>();
 }
 const unbounded_octstring<true>& dl_s1cdma2000tunnelling_ies_o::value_c::cdma2000_pdu() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 void dl_s1cdma2000tunnelling_ies_o::value_c::destroy_()
@@ -7435,42 +7435,42 @@ presence_e dl_ueassociated_lp_pa_transport_ies_o::get_presence(const uint32_t& i
 // Value ::= OPEN TYPE
 uint64_t& dl_ueassociated_lp_pa_transport_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& dl_ueassociated_lp_pa_transport_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 uint16_t& dl_ueassociated_lp_pa_transport_ies_o::value_c::routing_id()
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::routing_id, type_, "Value");
   return c.get<uint16_t>();
 }
 unbounded_octstring<true>& dl_ueassociated_lp_pa_transport_ies_o::value_c::lp_pa_pdu()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lp_pa_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const uint64_t& dl_ueassociated_lp_pa_transport_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& dl_ueassociated_lp_pa_transport_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const uint16_t& dl_ueassociated_lp_pa_transport_ies_o::value_c::routing_id() const
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::routing_id, type_, "Value");
   return c.get<uint16_t>();
 }
 const unbounded_octstring<true>& dl_ueassociated_lp_pa_transport_ies_o::value_c::lp_pa_pdu() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lp_pa_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 void dl_ueassociated_lp_pa_transport_ies_o::value_c::destroy_()
@@ -8700,72 +8700,72 @@ presence_e erab_mod_confirm_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& erab_mod_confirm_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& erab_mod_confirm_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 erab_modify_list_bearer_mod_conf_l& erab_mod_confirm_ies_o::value_c::erab_modify_list_bearer_mod_conf()
 {
-  assert_choice_type("E-RABModifyListBearerModConf", type_.to_string(), "Value");
+  assert_choice_type(types::erab_modify_list_bearer_mod_conf, type_, "Value");
   return c.get<erab_modify_list_bearer_mod_conf_l>();
 }
 erab_list_l& erab_mod_confirm_ies_o::value_c::erab_failed_to_modify_list_bearer_mod_conf()
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_modify_list_bearer_mod_conf, type_, "Value");
   return c.get<erab_list_l>();
 }
 erab_list_l& erab_mod_confirm_ies_o::value_c::erab_to_be_released_list_bearer_mod_conf()
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_released_list_bearer_mod_conf, type_, "Value");
   return c.get<erab_list_l>();
 }
 crit_diagnostics_s& erab_mod_confirm_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 csg_membership_status_e& erab_mod_confirm_ies_o::value_c::csg_membership_status()
 {
-  assert_choice_type("CSGMembershipStatus", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_status, type_, "Value");
   return c.get<csg_membership_status_e>();
 }
 const uint64_t& erab_mod_confirm_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& erab_mod_confirm_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const erab_modify_list_bearer_mod_conf_l& erab_mod_confirm_ies_o::value_c::erab_modify_list_bearer_mod_conf() const
 {
-  assert_choice_type("E-RABModifyListBearerModConf", type_.to_string(), "Value");
+  assert_choice_type(types::erab_modify_list_bearer_mod_conf, type_, "Value");
   return c.get<erab_modify_list_bearer_mod_conf_l>();
 }
 const erab_list_l& erab_mod_confirm_ies_o::value_c::erab_failed_to_modify_list_bearer_mod_conf() const
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_modify_list_bearer_mod_conf, type_, "Value");
   return c.get<erab_list_l>();
 }
 const erab_list_l& erab_mod_confirm_ies_o::value_c::erab_to_be_released_list_bearer_mod_conf() const
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_released_list_bearer_mod_conf, type_, "Value");
   return c.get<erab_list_l>();
 }
 const crit_diagnostics_s& erab_mod_confirm_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const csg_membership_status_e& erab_mod_confirm_ies_o::value_c::csg_membership_status() const
 {
-  assert_choice_type("CSGMembershipStatus", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_status, type_, "Value");
   return c.get<csg_membership_status_e>();
 }
 void erab_mod_confirm_ies_o::value_c::destroy_()
@@ -9505,66 +9505,66 @@ presence_e erab_mod_ind_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& erab_mod_ind_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& erab_mod_ind_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 erab_ie_container_list_l<erab_to_be_modified_item_bearer_mod_ind_ies_o>&
 erab_mod_ind_ies_o::value_c::erab_to_be_modified_list_bearer_mod_ind()
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABToBeModifiedItemBearerModIndIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_modified_list_bearer_mod_ind, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_to_be_modified_item_bearer_mod_ind_ies_o> >();
 }
 erab_ie_container_list_l<erab_not_to_be_modified_item_bearer_mod_ind_ies_o>&
 erab_mod_ind_ies_o::value_c::erab_not_to_be_modified_list_bearer_mod_ind()
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABNotToBeModifiedItemBearerModIndIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_not_to_be_modified_list_bearer_mod_ind, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_not_to_be_modified_item_bearer_mod_ind_ies_o> >();
 }
 csg_membership_info_s& erab_mod_ind_ies_o::value_c::csg_membership_info()
 {
-  assert_choice_type("CSGMembershipInfo", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_info, type_, "Value");
   return c.get<csg_membership_info_s>();
 }
 tunnel_info_s& erab_mod_ind_ies_o::value_c::tunnel_info_for_bbf()
 {
-  assert_choice_type("TunnelInformation", type_.to_string(), "Value");
+  assert_choice_type(types::tunnel_info_for_bbf, type_, "Value");
   return c.get<tunnel_info_s>();
 }
 const uint64_t& erab_mod_ind_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& erab_mod_ind_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const erab_ie_container_list_l<erab_to_be_modified_item_bearer_mod_ind_ies_o>&
 erab_mod_ind_ies_o::value_c::erab_to_be_modified_list_bearer_mod_ind() const
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABToBeModifiedItemBearerModIndIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_modified_list_bearer_mod_ind, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_to_be_modified_item_bearer_mod_ind_ies_o> >();
 }
 const erab_ie_container_list_l<erab_not_to_be_modified_item_bearer_mod_ind_ies_o>&
 erab_mod_ind_ies_o::value_c::erab_not_to_be_modified_list_bearer_mod_ind() const
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABNotToBeModifiedItemBearerModIndIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_not_to_be_modified_list_bearer_mod_ind, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_not_to_be_modified_item_bearer_mod_ind_ies_o> >();
 }
 const csg_membership_info_s& erab_mod_ind_ies_o::value_c::csg_membership_info() const
 {
-  assert_choice_type("CSGMembershipInfo", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_info, type_, "Value");
   return c.get<csg_membership_info_s>();
 }
 const tunnel_info_s& erab_mod_ind_ies_o::value_c::tunnel_info_for_bbf() const
 {
-  assert_choice_type("TunnelInformation", type_.to_string(), "Value");
+  assert_choice_type(types::tunnel_info_for_bbf, type_, "Value");
   return c.get<tunnel_info_s>();
 }
 void erab_mod_ind_ies_o::value_c::destroy_()
@@ -10321,43 +10321,43 @@ presence_e erab_modify_request_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& erab_modify_request_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& erab_modify_request_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 ue_aggregate_maximum_bitrate_s& erab_modify_request_ies_o::value_c::ueaggregate_maximum_bitrate()
 {
-  assert_choice_type("UEAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ueaggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_aggregate_maximum_bitrate_s>();
 }
 erab_to_be_modified_list_bearer_mod_req_l& erab_modify_request_ies_o::value_c::erab_to_be_modified_list_bearer_mod_req()
 {
-  assert_choice_type("E-RABToBeModifiedListBearerModReq", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_modified_list_bearer_mod_req, type_, "Value");
   return c.get<erab_to_be_modified_list_bearer_mod_req_l>();
 }
 const uint64_t& erab_modify_request_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& erab_modify_request_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const ue_aggregate_maximum_bitrate_s& erab_modify_request_ies_o::value_c::ueaggregate_maximum_bitrate() const
 {
-  assert_choice_type("UEAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ueaggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_aggregate_maximum_bitrate_s>();
 }
 const erab_to_be_modified_list_bearer_mod_req_l&
 erab_modify_request_ies_o::value_c::erab_to_be_modified_list_bearer_mod_req() const
 {
-  assert_choice_type("E-RABToBeModifiedListBearerModReq", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_modified_list_bearer_mod_req, type_, "Value");
   return c.get<erab_to_be_modified_list_bearer_mod_req_l>();
 }
 void erab_modify_request_ies_o::value_c::destroy_()
@@ -10713,52 +10713,52 @@ presence_e erab_modify_resp_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& erab_modify_resp_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& erab_modify_resp_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 erab_modify_list_bearer_mod_res_l& erab_modify_resp_ies_o::value_c::erab_modify_list_bearer_mod_res()
 {
-  assert_choice_type("E-RABModifyListBearerModRes", type_.to_string(), "Value");
+  assert_choice_type(types::erab_modify_list_bearer_mod_res, type_, "Value");
   return c.get<erab_modify_list_bearer_mod_res_l>();
 }
 erab_list_l& erab_modify_resp_ies_o::value_c::erab_failed_to_modify_list()
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_modify_list, type_, "Value");
   return c.get<erab_list_l>();
 }
 crit_diagnostics_s& erab_modify_resp_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& erab_modify_resp_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& erab_modify_resp_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const erab_modify_list_bearer_mod_res_l& erab_modify_resp_ies_o::value_c::erab_modify_list_bearer_mod_res() const
 {
-  assert_choice_type("E-RABModifyListBearerModRes", type_.to_string(), "Value");
+  assert_choice_type(types::erab_modify_list_bearer_mod_res, type_, "Value");
   return c.get<erab_modify_list_bearer_mod_res_l>();
 }
 const erab_list_l& erab_modify_resp_ies_o::value_c::erab_failed_to_modify_list() const
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_modify_list, type_, "Value");
   return c.get<erab_list_l>();
 }
 const crit_diagnostics_s& erab_modify_resp_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void erab_modify_resp_ies_o::value_c::destroy_()
@@ -11160,52 +11160,52 @@ presence_e erab_release_cmd_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& erab_release_cmd_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& erab_release_cmd_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 ue_aggregate_maximum_bitrate_s& erab_release_cmd_ies_o::value_c::ueaggregate_maximum_bitrate()
 {
-  assert_choice_type("UEAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ueaggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_aggregate_maximum_bitrate_s>();
 }
 erab_list_l& erab_release_cmd_ies_o::value_c::erab_to_be_released_list()
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_released_list, type_, "Value");
   return c.get<erab_list_l>();
 }
 unbounded_octstring<true>& erab_release_cmd_ies_o::value_c::nas_pdu()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nas_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const uint64_t& erab_release_cmd_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& erab_release_cmd_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const ue_aggregate_maximum_bitrate_s& erab_release_cmd_ies_o::value_c::ueaggregate_maximum_bitrate() const
 {
-  assert_choice_type("UEAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ueaggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_aggregate_maximum_bitrate_s>();
 }
 const erab_list_l& erab_release_cmd_ies_o::value_c::erab_to_be_released_list() const
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_released_list, type_, "Value");
   return c.get<erab_list_l>();
 }
 const unbounded_octstring<true>& erab_release_cmd_ies_o::value_c::nas_pdu() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nas_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 void erab_release_cmd_ies_o::value_c::destroy_()
@@ -11629,42 +11629,42 @@ presence_e erab_release_ind_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& erab_release_ind_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& erab_release_ind_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 erab_list_l& erab_release_ind_ies_o::value_c::erab_released_list()
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_released_list, type_, "Value");
   return c.get<erab_list_l>();
 }
 user_location_info_s& erab_release_ind_ies_o::value_c::user_location_info()
 {
-  assert_choice_type("UserLocationInformation", type_.to_string(), "Value");
+  assert_choice_type(types::user_location_info, type_, "Value");
   return c.get<user_location_info_s>();
 }
 const uint64_t& erab_release_ind_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& erab_release_ind_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const erab_list_l& erab_release_ind_ies_o::value_c::erab_released_list() const
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_released_list, type_, "Value");
   return c.get<erab_list_l>();
 }
 const user_location_info_s& erab_release_ind_ies_o::value_c::user_location_info() const
 {
-  assert_choice_type("UserLocationInformation", type_.to_string(), "Value");
+  assert_choice_type(types::user_location_info, type_, "Value");
   return c.get<user_location_info_s>();
 }
 void erab_release_ind_ies_o::value_c::destroy_()
@@ -12125,62 +12125,62 @@ presence_e erab_release_resp_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& erab_release_resp_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& erab_release_resp_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 erab_release_list_bearer_rel_comp_l& erab_release_resp_ies_o::value_c::erab_release_list_bearer_rel_comp()
 {
-  assert_choice_type("E-RABReleaseListBearerRelComp", type_.to_string(), "Value");
+  assert_choice_type(types::erab_release_list_bearer_rel_comp, type_, "Value");
   return c.get<erab_release_list_bearer_rel_comp_l>();
 }
 erab_list_l& erab_release_resp_ies_o::value_c::erab_failed_to_release_list()
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_release_list, type_, "Value");
   return c.get<erab_list_l>();
 }
 crit_diagnostics_s& erab_release_resp_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 user_location_info_s& erab_release_resp_ies_o::value_c::user_location_info()
 {
-  assert_choice_type("UserLocationInformation", type_.to_string(), "Value");
+  assert_choice_type(types::user_location_info, type_, "Value");
   return c.get<user_location_info_s>();
 }
 const uint64_t& erab_release_resp_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& erab_release_resp_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const erab_release_list_bearer_rel_comp_l& erab_release_resp_ies_o::value_c::erab_release_list_bearer_rel_comp() const
 {
-  assert_choice_type("E-RABReleaseListBearerRelComp", type_.to_string(), "Value");
+  assert_choice_type(types::erab_release_list_bearer_rel_comp, type_, "Value");
   return c.get<erab_release_list_bearer_rel_comp_l>();
 }
 const erab_list_l& erab_release_resp_ies_o::value_c::erab_failed_to_release_list() const
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_release_list, type_, "Value");
   return c.get<erab_list_l>();
 }
 const crit_diagnostics_s& erab_release_resp_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const user_location_info_s& erab_release_resp_ies_o::value_c::user_location_info() const
 {
-  assert_choice_type("UserLocationInformation", type_.to_string(), "Value");
+  assert_choice_type(types::user_location_info, type_, "Value");
   return c.get<user_location_info_s>();
 }
 void erab_release_resp_ies_o::value_c::destroy_()
@@ -12826,32 +12826,32 @@ presence_e erab_to_be_setup_item_bearer_su_req_ext_ies_o::get_presence(const uin
 // Extension ::= OPEN TYPE
 fixed_octstring<4, true>& erab_to_be_setup_item_bearer_su_req_ext_ies_o::ext_c::correlation_id()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::correlation_id, type_, "Extension");
   return c.get<fixed_octstring<4, true> >();
 }
 fixed_octstring<4, true>& erab_to_be_setup_item_bearer_su_req_ext_ies_o::ext_c::sipto_correlation_id()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::sipto_correlation_id, type_, "Extension");
   return c.get<fixed_octstring<4, true> >();
 }
 bearer_type_e& erab_to_be_setup_item_bearer_su_req_ext_ies_o::ext_c::bearer_type()
 {
-  assert_choice_type("BearerType", type_.to_string(), "Extension");
+  assert_choice_type(types::bearer_type, type_, "Extension");
   return c.get<bearer_type_e>();
 }
 const fixed_octstring<4, true>& erab_to_be_setup_item_bearer_su_req_ext_ies_o::ext_c::correlation_id() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::correlation_id, type_, "Extension");
   return c.get<fixed_octstring<4, true> >();
 }
 const fixed_octstring<4, true>& erab_to_be_setup_item_bearer_su_req_ext_ies_o::ext_c::sipto_correlation_id() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::sipto_correlation_id, type_, "Extension");
   return c.get<fixed_octstring<4, true> >();
 }
 const bearer_type_e& erab_to_be_setup_item_bearer_su_req_ext_ies_o::ext_c::bearer_type() const
 {
-  assert_choice_type("BearerType", type_.to_string(), "Extension");
+  assert_choice_type(types::bearer_type, type_, "Extension");
   return c.get<bearer_type_e>();
 }
 void erab_to_be_setup_item_bearer_su_req_ext_ies_o::ext_c::destroy_()
@@ -13261,43 +13261,43 @@ presence_e erab_setup_request_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& erab_setup_request_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& erab_setup_request_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 ue_aggregate_maximum_bitrate_s& erab_setup_request_ies_o::value_c::ueaggregate_maximum_bitrate()
 {
-  assert_choice_type("UEAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ueaggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_aggregate_maximum_bitrate_s>();
 }
 erab_to_be_setup_list_bearer_su_req_l& erab_setup_request_ies_o::value_c::erab_to_be_setup_list_bearer_su_req()
 {
-  assert_choice_type("E-RABToBeSetupListBearerSUReq", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_setup_list_bearer_su_req, type_, "Value");
   return c.get<erab_to_be_setup_list_bearer_su_req_l>();
 }
 const uint64_t& erab_setup_request_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& erab_setup_request_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const ue_aggregate_maximum_bitrate_s& erab_setup_request_ies_o::value_c::ueaggregate_maximum_bitrate() const
 {
-  assert_choice_type("UEAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ueaggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_aggregate_maximum_bitrate_s>();
 }
 const erab_to_be_setup_list_bearer_su_req_l&
 erab_setup_request_ies_o::value_c::erab_to_be_setup_list_bearer_su_req() const
 {
-  assert_choice_type("E-RABToBeSetupListBearerSUReq", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_setup_list_bearer_su_req, type_, "Value");
   return c.get<erab_to_be_setup_list_bearer_su_req_l>();
 }
 void erab_setup_request_ies_o::value_c::destroy_()
@@ -13651,52 +13651,52 @@ presence_e erab_setup_resp_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& erab_setup_resp_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& erab_setup_resp_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 erab_setup_list_bearer_su_res_l& erab_setup_resp_ies_o::value_c::erab_setup_list_bearer_su_res()
 {
-  assert_choice_type("E-RABSetupListBearerSURes", type_.to_string(), "Value");
+  assert_choice_type(types::erab_setup_list_bearer_su_res, type_, "Value");
   return c.get<erab_setup_list_bearer_su_res_l>();
 }
 erab_list_l& erab_setup_resp_ies_o::value_c::erab_failed_to_setup_list_bearer_su_res()
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_setup_list_bearer_su_res, type_, "Value");
   return c.get<erab_list_l>();
 }
 crit_diagnostics_s& erab_setup_resp_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& erab_setup_resp_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& erab_setup_resp_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const erab_setup_list_bearer_su_res_l& erab_setup_resp_ies_o::value_c::erab_setup_list_bearer_su_res() const
 {
-  assert_choice_type("E-RABSetupListBearerSURes", type_.to_string(), "Value");
+  assert_choice_type(types::erab_setup_list_bearer_su_res, type_, "Value");
   return c.get<erab_setup_list_bearer_su_res_l>();
 }
 const erab_list_l& erab_setup_resp_ies_o::value_c::erab_failed_to_setup_list_bearer_su_res() const
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_setup_list_bearer_su_res, type_, "Value");
   return c.get<erab_list_l>();
 }
 const crit_diagnostics_s& erab_setup_resp_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void erab_setup_resp_ies_o::value_c::destroy_()
@@ -14084,32 +14084,32 @@ presence_e erab_to_be_setup_item_ctxt_su_req_ext_ies_o::get_presence(const uint3
 // Extension ::= OPEN TYPE
 fixed_octstring<4, true>& erab_to_be_setup_item_ctxt_su_req_ext_ies_o::ext_c::correlation_id()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::correlation_id, type_, "Extension");
   return c.get<fixed_octstring<4, true> >();
 }
 fixed_octstring<4, true>& erab_to_be_setup_item_ctxt_su_req_ext_ies_o::ext_c::sipto_correlation_id()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::sipto_correlation_id, type_, "Extension");
   return c.get<fixed_octstring<4, true> >();
 }
 bearer_type_e& erab_to_be_setup_item_ctxt_su_req_ext_ies_o::ext_c::bearer_type()
 {
-  assert_choice_type("BearerType", type_.to_string(), "Extension");
+  assert_choice_type(types::bearer_type, type_, "Extension");
   return c.get<bearer_type_e>();
 }
 const fixed_octstring<4, true>& erab_to_be_setup_item_ctxt_su_req_ext_ies_o::ext_c::correlation_id() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::correlation_id, type_, "Extension");
   return c.get<fixed_octstring<4, true> >();
 }
 const fixed_octstring<4, true>& erab_to_be_setup_item_ctxt_su_req_ext_ies_o::ext_c::sipto_correlation_id() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::sipto_correlation_id, type_, "Extension");
   return c.get<fixed_octstring<4, true> >();
 }
 const bearer_type_e& erab_to_be_setup_item_ctxt_su_req_ext_ies_o::ext_c::bearer_type() const
 {
-  assert_choice_type("BearerType", type_.to_string(), "Extension");
+  assert_choice_type(types::bearer_type, type_, "Extension");
   return c.get<bearer_type_e>();
 }
 void erab_to_be_setup_item_ctxt_su_req_ext_ies_o::ext_c::destroy_()
@@ -14517,23 +14517,23 @@ presence_e erab_to_be_setup_item_ho_req_ext_ies_o::get_presence(const uint32_t&
 // Extension ::= OPEN TYPE
 data_forwarding_not_possible_e& erab_to_be_setup_item_ho_req_ext_ies_o::ext_c::data_forwarding_not_possible()
 {
-  assert_choice_type("Data-Forwarding-Not-Possible", type_.to_string(), "Extension");
+  assert_choice_type(types::data_forwarding_not_possible, type_, "Extension");
   return c.get<data_forwarding_not_possible_e>();
 }
 bearer_type_e& erab_to_be_setup_item_ho_req_ext_ies_o::ext_c::bearer_type()
 {
-  assert_choice_type("BearerType", type_.to_string(), "Extension");
+  assert_choice_type(types::bearer_type, type_, "Extension");
   return c.get<bearer_type_e>();
 }
 const data_forwarding_not_possible_e&
 erab_to_be_setup_item_ho_req_ext_ies_o::ext_c::data_forwarding_not_possible() const
 {
-  assert_choice_type("Data-Forwarding-Not-Possible", type_.to_string(), "Extension");
+  assert_choice_type(types::data_forwarding_not_possible, type_, "Extension");
   return c.get<data_forwarding_not_possible_e>();
 }
 const bearer_type_e& erab_to_be_setup_item_ho_req_ext_ies_o::ext_c::bearer_type() const
 {
-  assert_choice_type("BearerType", type_.to_string(), "Extension");
+  assert_choice_type(types::bearer_type, type_, "Extension");
   return c.get<bearer_type_e>();
 }
 void erab_to_be_setup_item_ho_req_ext_ies_o::ext_c::destroy_() {}
@@ -15241,52 +15241,52 @@ presence_e enbcp_relocation_ind_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint32_t& enbcp_relocation_ind_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 s_tmsi_s& enbcp_relocation_ind_ies_o::value_c::s_tmsi()
 {
-  assert_choice_type("S-TMSI", type_.to_string(), "Value");
+  assert_choice_type(types::s_tmsi, type_, "Value");
   return c.get<s_tmsi_s>();
 }
 eutran_cgi_s& enbcp_relocation_ind_ies_o::value_c::eutran_cgi()
 {
-  assert_choice_type("EUTRAN-CGI", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_cgi, type_, "Value");
   return c.get<eutran_cgi_s>();
 }
 tai_s& enbcp_relocation_ind_ies_o::value_c::tai()
 {
-  assert_choice_type("TAI", type_.to_string(), "Value");
+  assert_choice_type(types::tai, type_, "Value");
   return c.get<tai_s>();
 }
 ul_cp_security_info_s& enbcp_relocation_ind_ies_o::value_c::ul_cp_security_info()
 {
-  assert_choice_type("UL-CP-SecurityInformation", type_.to_string(), "Value");
+  assert_choice_type(types::ul_cp_security_info, type_, "Value");
   return c.get<ul_cp_security_info_s>();
 }
 const uint32_t& enbcp_relocation_ind_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const s_tmsi_s& enbcp_relocation_ind_ies_o::value_c::s_tmsi() const
 {
-  assert_choice_type("S-TMSI", type_.to_string(), "Value");
+  assert_choice_type(types::s_tmsi, type_, "Value");
   return c.get<s_tmsi_s>();
 }
 const eutran_cgi_s& enbcp_relocation_ind_ies_o::value_c::eutran_cgi() const
 {
-  assert_choice_type("EUTRAN-CGI", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_cgi, type_, "Value");
   return c.get<eutran_cgi_s>();
 }
 const tai_s& enbcp_relocation_ind_ies_o::value_c::tai() const
 {
-  assert_choice_type("TAI", type_.to_string(), "Value");
+  assert_choice_type(types::tai, type_, "Value");
   return c.get<tai_s>();
 }
 const ul_cp_security_info_s& enbcp_relocation_ind_ies_o::value_c::ul_cp_security_info() const
 {
-  assert_choice_type("UL-CP-SecurityInformation", type_.to_string(), "Value");
+  assert_choice_type(types::ul_cp_security_info, type_, "Value");
   return c.get<ul_cp_security_info_s>();
 }
 void enbcp_relocation_ind_ies_o::value_c::destroy_()
@@ -15961,24 +15961,24 @@ presence_e x2_tnl_cfg_info_ext_ies_o::get_presence(const uint32_t& id)
 // Extension ::= OPEN TYPE
 enbx2_ext_tlas_l& x2_tnl_cfg_info_ext_ies_o::ext_c::enbx2_extended_transport_layer_addresses()
 {
-  assert_choice_type("ENBX2ExtTLAs", type_.to_string(), "Extension");
+  assert_choice_type(types::enbx2_extended_transport_layer_addresses, type_, "Extension");
   return c.get<enbx2_ext_tlas_l>();
 }
 enb_indirect_x2_transport_layer_addresses_l&
 x2_tnl_cfg_info_ext_ies_o::ext_c::enb_indirect_x2_transport_layer_addresses()
 {
-  assert_choice_type("ENBIndirectX2TransportLayerAddresses", type_.to_string(), "Extension");
+  assert_choice_type(types::enb_indirect_x2_transport_layer_addresses, type_, "Extension");
   return c.get<enb_indirect_x2_transport_layer_addresses_l>();
 }
 const enbx2_ext_tlas_l& x2_tnl_cfg_info_ext_ies_o::ext_c::enbx2_extended_transport_layer_addresses() const
 {
-  assert_choice_type("ENBX2ExtTLAs", type_.to_string(), "Extension");
+  assert_choice_type(types::enbx2_extended_transport_layer_addresses, type_, "Extension");
   return c.get<enbx2_ext_tlas_l>();
 }
 const enb_indirect_x2_transport_layer_addresses_l&
 x2_tnl_cfg_info_ext_ies_o::ext_c::enb_indirect_x2_transport_layer_addresses() const
 {
-  assert_choice_type("ENBIndirectX2TransportLayerAddresses", type_.to_string(), "Extension");
+  assert_choice_type(types::enb_indirect_x2_transport_layer_addresses, type_, "Extension");
   return c.get<enb_indirect_x2_transport_layer_addresses_l>();
 }
 void x2_tnl_cfg_info_ext_ies_o::ext_c::destroy_()
@@ -16789,22 +16789,22 @@ presence_e son_cfg_transfer_ext_ies_o::get_presence(const uint32_t& id)
 // Extension ::= OPEN TYPE
 x2_tnl_cfg_info_s& son_cfg_transfer_ext_ies_o::ext_c::x2_tnl_cfg_info()
 {
-  assert_choice_type("X2TNLConfigurationInfo", type_.to_string(), "Extension");
+  assert_choice_type(types::x2_tnl_cfg_info, type_, "Extension");
   return c.get<x2_tnl_cfg_info_s>();
 }
 synchronisation_info_s& son_cfg_transfer_ext_ies_o::ext_c::synchronisation_info()
 {
-  assert_choice_type("SynchronisationInformation", type_.to_string(), "Extension");
+  assert_choice_type(types::synchronisation_info, type_, "Extension");
   return c.get<synchronisation_info_s>();
 }
 const x2_tnl_cfg_info_s& son_cfg_transfer_ext_ies_o::ext_c::x2_tnl_cfg_info() const
 {
-  assert_choice_type("X2TNLConfigurationInfo", type_.to_string(), "Extension");
+  assert_choice_type(types::x2_tnl_cfg_info, type_, "Extension");
   return c.get<x2_tnl_cfg_info_s>();
 }
 const synchronisation_info_s& son_cfg_transfer_ext_ies_o::ext_c::synchronisation_info() const
 {
-  assert_choice_type("SynchronisationInformation", type_.to_string(), "Extension");
+  assert_choice_type(types::synchronisation_info, type_, "Extension");
   return c.get<synchronisation_info_s>();
 }
 void son_cfg_transfer_ext_ies_o::ext_c::destroy_()
@@ -17569,52 +17569,52 @@ presence_e enb_cfg_upd_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 printable_string<1, 150, true, true>& enb_cfg_upd_ies_o::value_c::enbname()
 {
-  assert_choice_type("PrintableString", type_.to_string(), "Value");
+  assert_choice_type(types::enbname, type_, "Value");
   return c.get<printable_string<1, 150, true, true> >();
 }
 supported_tas_l& enb_cfg_upd_ies_o::value_c::supported_tas()
 {
-  assert_choice_type("SupportedTAs", type_.to_string(), "Value");
+  assert_choice_type(types::supported_tas, type_, "Value");
   return c.get<supported_tas_l>();
 }
 csg_id_list_l& enb_cfg_upd_ies_o::value_c::csg_id_list()
 {
-  assert_choice_type("CSG-IdList", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id_list, type_, "Value");
   return c.get<csg_id_list_l>();
 }
 paging_drx_e& enb_cfg_upd_ies_o::value_c::default_paging_drx()
 {
-  assert_choice_type("PagingDRX", type_.to_string(), "Value");
+  assert_choice_type(types::default_paging_drx, type_, "Value");
   return c.get<paging_drx_e>();
 }
 nb_io_t_default_paging_drx_e& enb_cfg_upd_ies_o::value_c::nb_io_t_default_paging_drx()
 {
-  assert_choice_type("NB-IoT-DefaultPagingDRX", type_.to_string(), "Value");
+  assert_choice_type(types::nb_io_t_default_paging_drx, type_, "Value");
   return c.get<nb_io_t_default_paging_drx_e>();
 }
 const printable_string<1, 150, true, true>& enb_cfg_upd_ies_o::value_c::enbname() const
 {
-  assert_choice_type("PrintableString", type_.to_string(), "Value");
+  assert_choice_type(types::enbname, type_, "Value");
   return c.get<printable_string<1, 150, true, true> >();
 }
 const supported_tas_l& enb_cfg_upd_ies_o::value_c::supported_tas() const
 {
-  assert_choice_type("SupportedTAs", type_.to_string(), "Value");
+  assert_choice_type(types::supported_tas, type_, "Value");
   return c.get<supported_tas_l>();
 }
 const csg_id_list_l& enb_cfg_upd_ies_o::value_c::csg_id_list() const
 {
-  assert_choice_type("CSG-IdList", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id_list, type_, "Value");
   return c.get<csg_id_list_l>();
 }
 const paging_drx_e& enb_cfg_upd_ies_o::value_c::default_paging_drx() const
 {
-  assert_choice_type("PagingDRX", type_.to_string(), "Value");
+  assert_choice_type(types::default_paging_drx, type_, "Value");
   return c.get<paging_drx_e>();
 }
 const nb_io_t_default_paging_drx_e& enb_cfg_upd_ies_o::value_c::nb_io_t_default_paging_drx() const
 {
-  assert_choice_type("NB-IoT-DefaultPagingDRX", type_.to_string(), "Value");
+  assert_choice_type(types::nb_io_t_default_paging_drx, type_, "Value");
   return c.get<nb_io_t_default_paging_drx_e>();
 }
 void enb_cfg_upd_ies_o::value_c::destroy_()
@@ -18097,32 +18097,32 @@ presence_e enb_cfg_upd_fail_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 cause_c& enb_cfg_upd_fail_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 time_to_wait_e& enb_cfg_upd_fail_ies_o::value_c::time_to_wait()
 {
-  assert_choice_type("TimeToWait", type_.to_string(), "Value");
+  assert_choice_type(types::time_to_wait, type_, "Value");
   return c.get<time_to_wait_e>();
 }
 crit_diagnostics_s& enb_cfg_upd_fail_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const cause_c& enb_cfg_upd_fail_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const time_to_wait_e& enb_cfg_upd_fail_ies_o::value_c::time_to_wait() const
 {
-  assert_choice_type("TimeToWait", type_.to_string(), "Value");
+  assert_choice_type(types::time_to_wait, type_, "Value");
   return c.get<time_to_wait_e>();
 }
 const crit_diagnostics_s& enb_cfg_upd_fail_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void enb_cfg_upd_fail_ies_o::value_c::destroy_()
@@ -18895,34 +18895,34 @@ presence_e enb_status_transfer_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& enb_status_transfer_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& enb_status_transfer_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 enb_status_transfer_transparent_container_s&
 enb_status_transfer_ies_o::value_c::enb_status_transfer_transparent_container()
 {
-  assert_choice_type("ENB-StatusTransfer-TransparentContainer", type_.to_string(), "Value");
+  assert_choice_type(types::enb_status_transfer_transparent_container, type_, "Value");
   return c.get<enb_status_transfer_transparent_container_s>();
 }
 const uint64_t& enb_status_transfer_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& enb_status_transfer_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const enb_status_transfer_transparent_container_s&
 enb_status_transfer_ies_o::value_c::enb_status_transfer_transparent_container() const
 {
-  assert_choice_type("ENB-StatusTransfer-TransparentContainer", type_.to_string(), "Value");
+  assert_choice_type(types::enb_status_transfer_transparent_container, type_, "Value");
   return c.get<enb_status_transfer_transparent_container_s>();
 }
 void enb_status_transfer_ies_o::value_c::destroy_()
@@ -19255,42 +19255,42 @@ presence_e error_ind_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& error_ind_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& error_ind_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 cause_c& error_ind_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 crit_diagnostics_s& error_ind_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& error_ind_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& error_ind_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const cause_c& error_ind_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const crit_diagnostics_s& error_ind_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void error_ind_ies_o::value_c::destroy_()
@@ -19999,32 +19999,32 @@ presence_e ho_cancel_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ho_cancel_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ho_cancel_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 cause_c& ho_cancel_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const uint64_t& ho_cancel_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ho_cancel_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const cause_c& ho_cancel_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 void ho_cancel_ies_o::value_c::destroy_()
@@ -20322,32 +20322,32 @@ presence_e ho_cancel_ack_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ho_cancel_ack_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ho_cancel_ack_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 crit_diagnostics_s& ho_cancel_ack_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& ho_cancel_ack_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ho_cancel_ack_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const crit_diagnostics_s& ho_cancel_ack_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void ho_cancel_ack_ies_o::value_c::destroy_()
@@ -20699,93 +20699,93 @@ presence_e ho_cmd_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ho_cmd_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ho_cmd_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 handov_type_e& ho_cmd_ies_o::value_c::handov_type()
 {
-  assert_choice_type("HandoverType", type_.to_string(), "Value");
+  assert_choice_type(types::handov_type, type_, "Value");
   return c.get<handov_type_e>();
 }
 unbounded_octstring<true>& ho_cmd_ies_o::value_c::nas_security_paramsfrom_e_utran()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nas_security_paramsfrom_e_utran, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 erab_ie_container_list_l<erab_data_forwarding_item_ies_o>& ho_cmd_ies_o::value_c::erab_subjectto_data_forwarding_list()
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABDataForwardingItemIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_subjectto_data_forwarding_list, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_data_forwarding_item_ies_o> >();
 }
 erab_list_l& ho_cmd_ies_o::value_c::erab_to_release_list_ho_cmd()
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_release_list_ho_cmd, type_, "Value");
   return c.get<erab_list_l>();
 }
 unbounded_octstring<true>& ho_cmd_ies_o::value_c::target_to_source_transparent_container()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::target_to_source_transparent_container, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 unbounded_octstring<true>& ho_cmd_ies_o::value_c::target_to_source_transparent_container_secondary()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::target_to_source_transparent_container_secondary, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 crit_diagnostics_s& ho_cmd_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& ho_cmd_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ho_cmd_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const handov_type_e& ho_cmd_ies_o::value_c::handov_type() const
 {
-  assert_choice_type("HandoverType", type_.to_string(), "Value");
+  assert_choice_type(types::handov_type, type_, "Value");
   return c.get<handov_type_e>();
 }
 const unbounded_octstring<true>& ho_cmd_ies_o::value_c::nas_security_paramsfrom_e_utran() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nas_security_paramsfrom_e_utran, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const erab_ie_container_list_l<erab_data_forwarding_item_ies_o>&
 ho_cmd_ies_o::value_c::erab_subjectto_data_forwarding_list() const
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABDataForwardingItemIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_subjectto_data_forwarding_list, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_data_forwarding_item_ies_o> >();
 }
 const erab_list_l& ho_cmd_ies_o::value_c::erab_to_release_list_ho_cmd() const
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_release_list_ho_cmd, type_, "Value");
   return c.get<erab_list_l>();
 }
 const unbounded_octstring<true>& ho_cmd_ies_o::value_c::target_to_source_transparent_container() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::target_to_source_transparent_container, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const unbounded_octstring<true>& ho_cmd_ies_o::value_c::target_to_source_transparent_container_secondary() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::target_to_source_transparent_container_secondary, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const crit_diagnostics_s& ho_cmd_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void ho_cmd_ies_o::value_c::destroy_()
@@ -21305,32 +21305,32 @@ presence_e ho_fail_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ho_fail_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 cause_c& ho_fail_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 crit_diagnostics_s& ho_fail_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& ho_fail_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const cause_c& ho_fail_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const crit_diagnostics_s& ho_fail_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void ho_fail_ies_o::value_c::destroy_()
@@ -21664,62 +21664,62 @@ presence_e ho_notify_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ho_notify_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ho_notify_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 eutran_cgi_s& ho_notify_ies_o::value_c::eutran_cgi()
 {
-  assert_choice_type("EUTRAN-CGI", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_cgi, type_, "Value");
   return c.get<eutran_cgi_s>();
 }
 tai_s& ho_notify_ies_o::value_c::tai()
 {
-  assert_choice_type("TAI", type_.to_string(), "Value");
+  assert_choice_type(types::tai, type_, "Value");
   return c.get<tai_s>();
 }
 tunnel_info_s& ho_notify_ies_o::value_c::tunnel_info_for_bbf()
 {
-  assert_choice_type("TunnelInformation", type_.to_string(), "Value");
+  assert_choice_type(types::tunnel_info_for_bbf, type_, "Value");
   return c.get<tunnel_info_s>();
 }
 unbounded_octstring<true>& ho_notify_ies_o::value_c::lhn_id()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lhn_id, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const uint64_t& ho_notify_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ho_notify_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const eutran_cgi_s& ho_notify_ies_o::value_c::eutran_cgi() const
 {
-  assert_choice_type("EUTRAN-CGI", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_cgi, type_, "Value");
   return c.get<eutran_cgi_s>();
 }
 const tai_s& ho_notify_ies_o::value_c::tai() const
 {
-  assert_choice_type("TAI", type_.to_string(), "Value");
+  assert_choice_type(types::tai, type_, "Value");
   return c.get<tai_s>();
 }
 const tunnel_info_s& ho_notify_ies_o::value_c::tunnel_info_for_bbf() const
 {
-  assert_choice_type("TunnelInformation", type_.to_string(), "Value");
+  assert_choice_type(types::tunnel_info_for_bbf, type_, "Value");
   return c.get<tunnel_info_s>();
 }
 const unbounded_octstring<true>& ho_notify_ies_o::value_c::lhn_id() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lhn_id, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 void ho_notify_ies_o::value_c::destroy_()
@@ -22130,42 +22130,42 @@ presence_e ho_prep_fail_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ho_prep_fail_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ho_prep_fail_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 cause_c& ho_prep_fail_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 crit_diagnostics_s& ho_prep_fail_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& ho_prep_fail_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ho_prep_fail_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const cause_c& ho_prep_fail_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const crit_diagnostics_s& ho_prep_fail_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void ho_prep_fail_ies_o::value_c::destroy_()
@@ -23054,62 +23054,62 @@ presence_e immediate_mdt_ext_ies_o::get_presence(const uint32_t& id)
 // Extension ::= OPEN TYPE
 m3_cfg_s& immediate_mdt_ext_ies_o::ext_c::m3_cfg()
 {
-  assert_choice_type("M3Configuration", type_.to_string(), "Extension");
+  assert_choice_type(types::m3_cfg, type_, "Extension");
   return c.get<m3_cfg_s>();
 }
 m4_cfg_s& immediate_mdt_ext_ies_o::ext_c::m4_cfg()
 {
-  assert_choice_type("M4Configuration", type_.to_string(), "Extension");
+  assert_choice_type(types::m4_cfg, type_, "Extension");
   return c.get<m4_cfg_s>();
 }
 m5_cfg_s& immediate_mdt_ext_ies_o::ext_c::m5_cfg()
 {
-  assert_choice_type("M5Configuration", type_.to_string(), "Extension");
+  assert_choice_type(types::m5_cfg, type_, "Extension");
   return c.get<m5_cfg_s>();
 }
 fixed_bitstring<8, false, true>& immediate_mdt_ext_ies_o::ext_c::mdt_location_info()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::mdt_location_info, type_, "Extension");
   return c.get<fixed_bitstring<8, false, true> >();
 }
 m6_cfg_s& immediate_mdt_ext_ies_o::ext_c::m6_cfg()
 {
-  assert_choice_type("M6Configuration", type_.to_string(), "Extension");
+  assert_choice_type(types::m6_cfg, type_, "Extension");
   return c.get<m6_cfg_s>();
 }
 m7_cfg_s& immediate_mdt_ext_ies_o::ext_c::m7_cfg()
 {
-  assert_choice_type("M7Configuration", type_.to_string(), "Extension");
+  assert_choice_type(types::m7_cfg, type_, "Extension");
   return c.get<m7_cfg_s>();
 }
 const m3_cfg_s& immediate_mdt_ext_ies_o::ext_c::m3_cfg() const
 {
-  assert_choice_type("M3Configuration", type_.to_string(), "Extension");
+  assert_choice_type(types::m3_cfg, type_, "Extension");
   return c.get<m3_cfg_s>();
 }
 const m4_cfg_s& immediate_mdt_ext_ies_o::ext_c::m4_cfg() const
 {
-  assert_choice_type("M4Configuration", type_.to_string(), "Extension");
+  assert_choice_type(types::m4_cfg, type_, "Extension");
   return c.get<m4_cfg_s>();
 }
 const m5_cfg_s& immediate_mdt_ext_ies_o::ext_c::m5_cfg() const
 {
-  assert_choice_type("M5Configuration", type_.to_string(), "Extension");
+  assert_choice_type(types::m5_cfg, type_, "Extension");
   return c.get<m5_cfg_s>();
 }
 const fixed_bitstring<8, false, true>& immediate_mdt_ext_ies_o::ext_c::mdt_location_info() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::mdt_location_info, type_, "Extension");
   return c.get<fixed_bitstring<8, false, true> >();
 }
 const m6_cfg_s& immediate_mdt_ext_ies_o::ext_c::m6_cfg() const
 {
-  assert_choice_type("M6Configuration", type_.to_string(), "Extension");
+  assert_choice_type(types::m6_cfg, type_, "Extension");
   return c.get<m6_cfg_s>();
 }
 const m7_cfg_s& immediate_mdt_ext_ies_o::ext_c::m7_cfg() const
 {
-  assert_choice_type("M7Configuration", type_.to_string(), "Extension");
+  assert_choice_type(types::m7_cfg, type_, "Extension");
   return c.get<m7_cfg_s>();
 }
 void immediate_mdt_ext_ies_o::ext_c::destroy_()
@@ -24735,283 +24735,283 @@ presence_e ho_request_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ho_request_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 handov_type_e& ho_request_ies_o::value_c::handov_type()
 {
-  assert_choice_type("HandoverType", type_.to_string(), "Value");
+  assert_choice_type(types::handov_type, type_, "Value");
   return c.get<handov_type_e>();
 }
 cause_c& ho_request_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 ue_aggregate_maximum_bitrate_s& ho_request_ies_o::value_c::ueaggregate_maximum_bitrate()
 {
-  assert_choice_type("UEAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ueaggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_aggregate_maximum_bitrate_s>();
 }
 erab_ie_container_list_l<erab_to_be_setup_item_ho_req_ies_o>& ho_request_ies_o::value_c::erab_to_be_setup_list_ho_req()
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABToBeSetupItemHOReqIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_setup_list_ho_req, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_to_be_setup_item_ho_req_ies_o> >();
 }
 unbounded_octstring<true>& ho_request_ies_o::value_c::source_to_target_transparent_container()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::source_to_target_transparent_container, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 ue_security_cap_s& ho_request_ies_o::value_c::ue_security_cap()
 {
-  assert_choice_type("UESecurityCapabilities", type_.to_string(), "Value");
+  assert_choice_type(types::ue_security_cap, type_, "Value");
   return c.get<ue_security_cap_s>();
 }
 ho_restrict_list_s& ho_request_ies_o::value_c::ho_restrict_list()
 {
-  assert_choice_type("HandoverRestrictionList", type_.to_string(), "Value");
+  assert_choice_type(types::ho_restrict_list, type_, "Value");
   return c.get<ho_restrict_list_s>();
 }
 trace_activation_s& ho_request_ies_o::value_c::trace_activation()
 {
-  assert_choice_type("TraceActivation", type_.to_string(), "Value");
+  assert_choice_type(types::trace_activation, type_, "Value");
   return c.get<trace_activation_s>();
 }
 request_type_s& ho_request_ies_o::value_c::request_type()
 {
-  assert_choice_type("RequestType", type_.to_string(), "Value");
+  assert_choice_type(types::request_type, type_, "Value");
   return c.get<request_type_s>();
 }
 srvcc_operation_possible_e& ho_request_ies_o::value_c::srvcc_operation_possible()
 {
-  assert_choice_type("SRVCCOperationPossible", type_.to_string(), "Value");
+  assert_choice_type(types::srvcc_operation_possible, type_, "Value");
   return c.get<srvcc_operation_possible_e>();
 }
 security_context_s& ho_request_ies_o::value_c::security_context()
 {
-  assert_choice_type("SecurityContext", type_.to_string(), "Value");
+  assert_choice_type(types::security_context, type_, "Value");
   return c.get<security_context_s>();
 }
 unbounded_octstring<true>& ho_request_ies_o::value_c::nas_security_paramsto_e_utran()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nas_security_paramsto_e_utran, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 fixed_bitstring<27, false, true>& ho_request_ies_o::value_c::csg_id()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id, type_, "Value");
   return c.get<fixed_bitstring<27, false, true> >();
 }
 csg_membership_status_e& ho_request_ies_o::value_c::csg_membership_status()
 {
-  assert_choice_type("CSGMembershipStatus", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_status, type_, "Value");
   return c.get<csg_membership_status_e>();
 }
 gummei_s& ho_request_ies_o::value_c::gummei_id()
 {
-  assert_choice_type("GUMMEI", type_.to_string(), "Value");
+  assert_choice_type(types::gummei_id, type_, "Value");
   return c.get<gummei_s>();
 }
 uint64_t& ho_request_ies_o::value_c::mme_ue_s1ap_id_minus2()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id_minus2, type_, "Value");
   return c.get<uint64_t>();
 }
 management_based_mdt_allowed_e& ho_request_ies_o::value_c::management_based_mdt_allowed()
 {
-  assert_choice_type("ManagementBasedMDTAllowed", type_.to_string(), "Value");
+  assert_choice_type(types::management_based_mdt_allowed, type_, "Value");
   return c.get<management_based_mdt_allowed_e>();
 }
 mdtplmn_list_l& ho_request_ies_o::value_c::management_based_mdtplmn_list()
 {
-  assert_choice_type("MDTPLMNList", type_.to_string(), "Value");
+  assert_choice_type(types::management_based_mdtplmn_list, type_, "Value");
   return c.get<mdtplmn_list_l>();
 }
 fixed_bitstring<64, false, true>& ho_request_ies_o::value_c::masked_imeisv()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::masked_imeisv, type_, "Value");
   return c.get<fixed_bitstring<64, false, true> >();
 }
 expected_ue_behaviour_s& ho_request_ies_o::value_c::expected_ue_behaviour()
 {
-  assert_choice_type("ExpectedUEBehaviour", type_.to_string(), "Value");
+  assert_choice_type(types::expected_ue_behaviour, type_, "Value");
   return c.get<expected_ue_behaviour_s>();
 }
 pro_se_authorized_s& ho_request_ies_o::value_c::pro_se_authorized()
 {
-  assert_choice_type("ProSeAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::pro_se_authorized, type_, "Value");
   return c.get<pro_se_authorized_s>();
 }
 ueuser_plane_cio_tsupport_ind_e& ho_request_ies_o::value_c::ueuser_plane_cio_tsupport_ind()
 {
-  assert_choice_type("UEUserPlaneCIoTSupportIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::ueuser_plane_cio_tsupport_ind, type_, "Value");
   return c.get<ueuser_plane_cio_tsupport_ind_e>();
 }
 v2xservices_authorized_s& ho_request_ies_o::value_c::v2xservices_authorized()
 {
-  assert_choice_type("V2XServicesAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::v2xservices_authorized, type_, "Value");
   return c.get<v2xservices_authorized_s>();
 }
 ue_sidelink_aggregate_maximum_bitrate_s& ho_request_ies_o::value_c::ue_sidelink_aggregate_maximum_bitrate()
 {
-  assert_choice_type("UESidelinkAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ue_sidelink_aggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_sidelink_aggregate_maximum_bitrate_s>();
 }
 enhanced_coverage_restricted_e& ho_request_ies_o::value_c::enhanced_coverage_restricted()
 {
-  assert_choice_type("EnhancedCoverageRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::enhanced_coverage_restricted, type_, "Value");
   return c.get<enhanced_coverage_restricted_e>();
 }
 ce_mode_brestricted_e& ho_request_ies_o::value_c::ce_mode_brestricted()
 {
-  assert_choice_type("CE-ModeBRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_brestricted, type_, "Value");
   return c.get<ce_mode_brestricted_e>();
 }
 pending_data_ind_e& ho_request_ies_o::value_c::pending_data_ind()
 {
-  assert_choice_type("PendingDataIndication", type_.to_string(), "Value");
+  assert_choice_type(types::pending_data_ind, type_, "Value");
   return c.get<pending_data_ind_e>();
 }
 const uint64_t& ho_request_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const handov_type_e& ho_request_ies_o::value_c::handov_type() const
 {
-  assert_choice_type("HandoverType", type_.to_string(), "Value");
+  assert_choice_type(types::handov_type, type_, "Value");
   return c.get<handov_type_e>();
 }
 const cause_c& ho_request_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const ue_aggregate_maximum_bitrate_s& ho_request_ies_o::value_c::ueaggregate_maximum_bitrate() const
 {
-  assert_choice_type("UEAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ueaggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_aggregate_maximum_bitrate_s>();
 }
 const erab_ie_container_list_l<erab_to_be_setup_item_ho_req_ies_o>&
 ho_request_ies_o::value_c::erab_to_be_setup_list_ho_req() const
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABToBeSetupItemHOReqIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_setup_list_ho_req, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_to_be_setup_item_ho_req_ies_o> >();
 }
 const unbounded_octstring<true>& ho_request_ies_o::value_c::source_to_target_transparent_container() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::source_to_target_transparent_container, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const ue_security_cap_s& ho_request_ies_o::value_c::ue_security_cap() const
 {
-  assert_choice_type("UESecurityCapabilities", type_.to_string(), "Value");
+  assert_choice_type(types::ue_security_cap, type_, "Value");
   return c.get<ue_security_cap_s>();
 }
 const ho_restrict_list_s& ho_request_ies_o::value_c::ho_restrict_list() const
 {
-  assert_choice_type("HandoverRestrictionList", type_.to_string(), "Value");
+  assert_choice_type(types::ho_restrict_list, type_, "Value");
   return c.get<ho_restrict_list_s>();
 }
 const trace_activation_s& ho_request_ies_o::value_c::trace_activation() const
 {
-  assert_choice_type("TraceActivation", type_.to_string(), "Value");
+  assert_choice_type(types::trace_activation, type_, "Value");
   return c.get<trace_activation_s>();
 }
 const request_type_s& ho_request_ies_o::value_c::request_type() const
 {
-  assert_choice_type("RequestType", type_.to_string(), "Value");
+  assert_choice_type(types::request_type, type_, "Value");
   return c.get<request_type_s>();
 }
 const srvcc_operation_possible_e& ho_request_ies_o::value_c::srvcc_operation_possible() const
 {
-  assert_choice_type("SRVCCOperationPossible", type_.to_string(), "Value");
+  assert_choice_type(types::srvcc_operation_possible, type_, "Value");
   return c.get<srvcc_operation_possible_e>();
 }
 const security_context_s& ho_request_ies_o::value_c::security_context() const
 {
-  assert_choice_type("SecurityContext", type_.to_string(), "Value");
+  assert_choice_type(types::security_context, type_, "Value");
   return c.get<security_context_s>();
 }
 const unbounded_octstring<true>& ho_request_ies_o::value_c::nas_security_paramsto_e_utran() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nas_security_paramsto_e_utran, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const fixed_bitstring<27, false, true>& ho_request_ies_o::value_c::csg_id() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id, type_, "Value");
   return c.get<fixed_bitstring<27, false, true> >();
 }
 const csg_membership_status_e& ho_request_ies_o::value_c::csg_membership_status() const
 {
-  assert_choice_type("CSGMembershipStatus", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_status, type_, "Value");
   return c.get<csg_membership_status_e>();
 }
 const gummei_s& ho_request_ies_o::value_c::gummei_id() const
 {
-  assert_choice_type("GUMMEI", type_.to_string(), "Value");
+  assert_choice_type(types::gummei_id, type_, "Value");
   return c.get<gummei_s>();
 }
 const uint64_t& ho_request_ies_o::value_c::mme_ue_s1ap_id_minus2() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id_minus2, type_, "Value");
   return c.get<uint64_t>();
 }
 const management_based_mdt_allowed_e& ho_request_ies_o::value_c::management_based_mdt_allowed() const
 {
-  assert_choice_type("ManagementBasedMDTAllowed", type_.to_string(), "Value");
+  assert_choice_type(types::management_based_mdt_allowed, type_, "Value");
   return c.get<management_based_mdt_allowed_e>();
 }
 const mdtplmn_list_l& ho_request_ies_o::value_c::management_based_mdtplmn_list() const
 {
-  assert_choice_type("MDTPLMNList", type_.to_string(), "Value");
+  assert_choice_type(types::management_based_mdtplmn_list, type_, "Value");
   return c.get<mdtplmn_list_l>();
 }
 const fixed_bitstring<64, false, true>& ho_request_ies_o::value_c::masked_imeisv() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::masked_imeisv, type_, "Value");
   return c.get<fixed_bitstring<64, false, true> >();
 }
 const expected_ue_behaviour_s& ho_request_ies_o::value_c::expected_ue_behaviour() const
 {
-  assert_choice_type("ExpectedUEBehaviour", type_.to_string(), "Value");
+  assert_choice_type(types::expected_ue_behaviour, type_, "Value");
   return c.get<expected_ue_behaviour_s>();
 }
 const pro_se_authorized_s& ho_request_ies_o::value_c::pro_se_authorized() const
 {
-  assert_choice_type("ProSeAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::pro_se_authorized, type_, "Value");
   return c.get<pro_se_authorized_s>();
 }
 const ueuser_plane_cio_tsupport_ind_e& ho_request_ies_o::value_c::ueuser_plane_cio_tsupport_ind() const
 {
-  assert_choice_type("UEUserPlaneCIoTSupportIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::ueuser_plane_cio_tsupport_ind, type_, "Value");
   return c.get<ueuser_plane_cio_tsupport_ind_e>();
 }
 const v2xservices_authorized_s& ho_request_ies_o::value_c::v2xservices_authorized() const
 {
-  assert_choice_type("V2XServicesAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::v2xservices_authorized, type_, "Value");
   return c.get<v2xservices_authorized_s>();
 }
 const ue_sidelink_aggregate_maximum_bitrate_s& ho_request_ies_o::value_c::ue_sidelink_aggregate_maximum_bitrate() const
 {
-  assert_choice_type("UESidelinkAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ue_sidelink_aggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_sidelink_aggregate_maximum_bitrate_s>();
 }
 const enhanced_coverage_restricted_e& ho_request_ies_o::value_c::enhanced_coverage_restricted() const
 {
-  assert_choice_type("EnhancedCoverageRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::enhanced_coverage_restricted, type_, "Value");
   return c.get<enhanced_coverage_restricted_e>();
 }
 const ce_mode_brestricted_e& ho_request_ies_o::value_c::ce_mode_brestricted() const
 {
-  assert_choice_type("CE-ModeBRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_brestricted, type_, "Value");
   return c.get<ce_mode_brestricted_e>();
 }
 const pending_data_ind_e& ho_request_ies_o::value_c::pending_data_ind() const
 {
-  assert_choice_type("PendingDataIndication", type_.to_string(), "Value");
+  assert_choice_type(types::pending_data_ind, type_, "Value");
   return c.get<pending_data_ind_e>();
 }
 void ho_request_ies_o::value_c::destroy_()
@@ -26245,94 +26245,94 @@ presence_e ho_request_ack_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ho_request_ack_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ho_request_ack_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 erab_ie_container_list_l<erab_admitted_item_ies_o>& ho_request_ack_ies_o::value_c::erab_admitted_list()
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABAdmittedItemIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_admitted_list, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_admitted_item_ies_o> >();
 }
 erab_ie_container_list_l<erab_failedto_setup_item_ho_req_ack_ies_o>&
 ho_request_ack_ies_o::value_c::erab_failed_to_setup_list_ho_req_ack()
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABFailedtoSetupItemHOReqAckIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_setup_list_ho_req_ack, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_failedto_setup_item_ho_req_ack_ies_o> >();
 }
 unbounded_octstring<true>& ho_request_ack_ies_o::value_c::target_to_source_transparent_container()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::target_to_source_transparent_container, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 fixed_bitstring<27, false, true>& ho_request_ack_ies_o::value_c::csg_id()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id, type_, "Value");
   return c.get<fixed_bitstring<27, false, true> >();
 }
 crit_diagnostics_s& ho_request_ack_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 cell_access_mode_e& ho_request_ack_ies_o::value_c::cell_access_mode()
 {
-  assert_choice_type("CellAccessMode", type_.to_string(), "Value");
+  assert_choice_type(types::cell_access_mode, type_, "Value");
   return c.get<cell_access_mode_e>();
 }
 ce_mode_b_support_ind_e& ho_request_ack_ies_o::value_c::ce_mode_b_support_ind()
 {
-  assert_choice_type("CE-mode-B-SupportIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_b_support_ind, type_, "Value");
   return c.get<ce_mode_b_support_ind_e>();
 }
 const uint64_t& ho_request_ack_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ho_request_ack_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const erab_ie_container_list_l<erab_admitted_item_ies_o>& ho_request_ack_ies_o::value_c::erab_admitted_list() const
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABAdmittedItemIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_admitted_list, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_admitted_item_ies_o> >();
 }
 const erab_ie_container_list_l<erab_failedto_setup_item_ho_req_ack_ies_o>&
 ho_request_ack_ies_o::value_c::erab_failed_to_setup_list_ho_req_ack() const
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABFailedtoSetupItemHOReqAckIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_setup_list_ho_req_ack, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_failedto_setup_item_ho_req_ack_ies_o> >();
 }
 const unbounded_octstring<true>& ho_request_ack_ies_o::value_c::target_to_source_transparent_container() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::target_to_source_transparent_container, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const fixed_bitstring<27, false, true>& ho_request_ack_ies_o::value_c::csg_id() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id, type_, "Value");
   return c.get<fixed_bitstring<27, false, true> >();
 }
 const crit_diagnostics_s& ho_request_ack_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const cell_access_mode_e& ho_request_ack_ies_o::value_c::cell_access_mode() const
 {
-  assert_choice_type("CellAccessMode", type_.to_string(), "Value");
+  assert_choice_type(types::cell_access_mode, type_, "Value");
   return c.get<cell_access_mode_e>();
 }
 const ce_mode_b_support_ind_e& ho_request_ack_ies_o::value_c::ce_mode_b_support_ind() const
 {
-  assert_choice_type("CE-mode-B-SupportIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_b_support_ind, type_, "Value");
   return c.get<ce_mode_b_support_ind_e>();
 }
 void ho_request_ack_ies_o::value_c::destroy_()
@@ -27089,142 +27089,142 @@ presence_e ho_required_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ho_required_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ho_required_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 handov_type_e& ho_required_ies_o::value_c::handov_type()
 {
-  assert_choice_type("HandoverType", type_.to_string(), "Value");
+  assert_choice_type(types::handov_type, type_, "Value");
   return c.get<handov_type_e>();
 }
 cause_c& ho_required_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 target_id_c& ho_required_ies_o::value_c::target_id()
 {
-  assert_choice_type("TargetID", type_.to_string(), "Value");
+  assert_choice_type(types::target_id, type_, "Value");
   return c.get<target_id_c>();
 }
 direct_forwarding_path_availability_e& ho_required_ies_o::value_c::direct_forwarding_path_availability()
 {
-  assert_choice_type("Direct-Forwarding-Path-Availability", type_.to_string(), "Value");
+  assert_choice_type(types::direct_forwarding_path_availability, type_, "Value");
   return c.get<direct_forwarding_path_availability_e>();
 }
 srvccho_ind_e& ho_required_ies_o::value_c::srvccho_ind()
 {
-  assert_choice_type("SRVCCHOIndication", type_.to_string(), "Value");
+  assert_choice_type(types::srvccho_ind, type_, "Value");
   return c.get<srvccho_ind_e>();
 }
 unbounded_octstring<true>& ho_required_ies_o::value_c::source_to_target_transparent_container()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::source_to_target_transparent_container, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 unbounded_octstring<true>& ho_required_ies_o::value_c::source_to_target_transparent_container_secondary()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::source_to_target_transparent_container_secondary, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 unbounded_octstring<true>& ho_required_ies_o::value_c::ms_classmark2()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ms_classmark2, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 unbounded_octstring<true>& ho_required_ies_o::value_c::ms_classmark3()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ms_classmark3, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 fixed_bitstring<27, false, true>& ho_required_ies_o::value_c::csg_id()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id, type_, "Value");
   return c.get<fixed_bitstring<27, false, true> >();
 }
 cell_access_mode_e& ho_required_ies_o::value_c::cell_access_mode()
 {
-  assert_choice_type("CellAccessMode", type_.to_string(), "Value");
+  assert_choice_type(types::cell_access_mode, type_, "Value");
   return c.get<cell_access_mode_e>();
 }
 ps_service_not_available_e& ho_required_ies_o::value_c::ps_service_not_available()
 {
-  assert_choice_type("PS-ServiceNotAvailable", type_.to_string(), "Value");
+  assert_choice_type(types::ps_service_not_available, type_, "Value");
   return c.get<ps_service_not_available_e>();
 }
 const uint64_t& ho_required_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ho_required_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const handov_type_e& ho_required_ies_o::value_c::handov_type() const
 {
-  assert_choice_type("HandoverType", type_.to_string(), "Value");
+  assert_choice_type(types::handov_type, type_, "Value");
   return c.get<handov_type_e>();
 }
 const cause_c& ho_required_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const target_id_c& ho_required_ies_o::value_c::target_id() const
 {
-  assert_choice_type("TargetID", type_.to_string(), "Value");
+  assert_choice_type(types::target_id, type_, "Value");
   return c.get<target_id_c>();
 }
 const direct_forwarding_path_availability_e& ho_required_ies_o::value_c::direct_forwarding_path_availability() const
 {
-  assert_choice_type("Direct-Forwarding-Path-Availability", type_.to_string(), "Value");
+  assert_choice_type(types::direct_forwarding_path_availability, type_, "Value");
   return c.get<direct_forwarding_path_availability_e>();
 }
 const srvccho_ind_e& ho_required_ies_o::value_c::srvccho_ind() const
 {
-  assert_choice_type("SRVCCHOIndication", type_.to_string(), "Value");
+  assert_choice_type(types::srvccho_ind, type_, "Value");
   return c.get<srvccho_ind_e>();
 }
 const unbounded_octstring<true>& ho_required_ies_o::value_c::source_to_target_transparent_container() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::source_to_target_transparent_container, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const unbounded_octstring<true>& ho_required_ies_o::value_c::source_to_target_transparent_container_secondary() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::source_to_target_transparent_container_secondary, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const unbounded_octstring<true>& ho_required_ies_o::value_c::ms_classmark2() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ms_classmark2, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const unbounded_octstring<true>& ho_required_ies_o::value_c::ms_classmark3() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ms_classmark3, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const fixed_bitstring<27, false, true>& ho_required_ies_o::value_c::csg_id() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id, type_, "Value");
   return c.get<fixed_bitstring<27, false, true> >();
 }
 const cell_access_mode_e& ho_required_ies_o::value_c::cell_access_mode() const
 {
-  assert_choice_type("CellAccessMode", type_.to_string(), "Value");
+  assert_choice_type(types::cell_access_mode, type_, "Value");
   return c.get<cell_access_mode_e>();
 }
 const ps_service_not_available_e& ho_required_ies_o::value_c::ps_service_not_available() const
 {
-  assert_choice_type("PS-ServiceNotAvailable", type_.to_string(), "Value");
+  assert_choice_type(types::ps_service_not_available, type_, "Value");
   return c.get<ps_service_not_available_e>();
 }
 void ho_required_ies_o::value_c::destroy_()
@@ -28213,42 +28213,42 @@ presence_e init_context_setup_fail_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& init_context_setup_fail_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& init_context_setup_fail_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 cause_c& init_context_setup_fail_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 crit_diagnostics_s& init_context_setup_fail_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& init_context_setup_fail_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& init_context_setup_fail_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const cause_c& init_context_setup_fail_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const crit_diagnostics_s& init_context_setup_fail_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void init_context_setup_fail_ies_o::value_c::destroy_()
@@ -28776,285 +28776,285 @@ presence_e init_context_setup_request_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& init_context_setup_request_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& init_context_setup_request_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 ue_aggregate_maximum_bitrate_s& init_context_setup_request_ies_o::value_c::ueaggregate_maximum_bitrate()
 {
-  assert_choice_type("UEAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ueaggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_aggregate_maximum_bitrate_s>();
 }
 erab_to_be_setup_list_ctxt_su_req_l& init_context_setup_request_ies_o::value_c::erab_to_be_setup_list_ctxt_su_req()
 {
-  assert_choice_type("E-RABToBeSetupListCtxtSUReq", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_setup_list_ctxt_su_req, type_, "Value");
   return c.get<erab_to_be_setup_list_ctxt_su_req_l>();
 }
 ue_security_cap_s& init_context_setup_request_ies_o::value_c::ue_security_cap()
 {
-  assert_choice_type("UESecurityCapabilities", type_.to_string(), "Value");
+  assert_choice_type(types::ue_security_cap, type_, "Value");
   return c.get<ue_security_cap_s>();
 }
 fixed_bitstring<256, false, true>& init_context_setup_request_ies_o::value_c::security_key()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::security_key, type_, "Value");
   return c.get<fixed_bitstring<256, false, true> >();
 }
 trace_activation_s& init_context_setup_request_ies_o::value_c::trace_activation()
 {
-  assert_choice_type("TraceActivation", type_.to_string(), "Value");
+  assert_choice_type(types::trace_activation, type_, "Value");
   return c.get<trace_activation_s>();
 }
 ho_restrict_list_s& init_context_setup_request_ies_o::value_c::ho_restrict_list()
 {
-  assert_choice_type("HandoverRestrictionList", type_.to_string(), "Value");
+  assert_choice_type(types::ho_restrict_list, type_, "Value");
   return c.get<ho_restrict_list_s>();
 }
 unbounded_octstring<true>& init_context_setup_request_ies_o::value_c::ue_radio_cap()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 uint16_t& init_context_setup_request_ies_o::value_c::subscriber_profile_idfor_rfp()
 {
-  assert_choice_type("INTEGER (1..256)", type_.to_string(), "Value");
+  assert_choice_type(types::subscriber_profile_idfor_rfp, type_, "Value");
   return c.get<uint16_t>();
 }
 cs_fallback_ind_e& init_context_setup_request_ies_o::value_c::cs_fallback_ind()
 {
-  assert_choice_type("CSFallbackIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::cs_fallback_ind, type_, "Value");
   return c.get<cs_fallback_ind_e>();
 }
 srvcc_operation_possible_e& init_context_setup_request_ies_o::value_c::srvcc_operation_possible()
 {
-  assert_choice_type("SRVCCOperationPossible", type_.to_string(), "Value");
+  assert_choice_type(types::srvcc_operation_possible, type_, "Value");
   return c.get<srvcc_operation_possible_e>();
 }
 csg_membership_status_e& init_context_setup_request_ies_o::value_c::csg_membership_status()
 {
-  assert_choice_type("CSGMembershipStatus", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_status, type_, "Value");
   return c.get<csg_membership_status_e>();
 }
 lai_s& init_context_setup_request_ies_o::value_c::registered_lai()
 {
-  assert_choice_type("LAI", type_.to_string(), "Value");
+  assert_choice_type(types::registered_lai, type_, "Value");
   return c.get<lai_s>();
 }
 gummei_s& init_context_setup_request_ies_o::value_c::gummei_id()
 {
-  assert_choice_type("GUMMEI", type_.to_string(), "Value");
+  assert_choice_type(types::gummei_id, type_, "Value");
   return c.get<gummei_s>();
 }
 uint64_t& init_context_setup_request_ies_o::value_c::mme_ue_s1ap_id_minus2()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id_minus2, type_, "Value");
   return c.get<uint64_t>();
 }
 management_based_mdt_allowed_e& init_context_setup_request_ies_o::value_c::management_based_mdt_allowed()
 {
-  assert_choice_type("ManagementBasedMDTAllowed", type_.to_string(), "Value");
+  assert_choice_type(types::management_based_mdt_allowed, type_, "Value");
   return c.get<management_based_mdt_allowed_e>();
 }
 mdtplmn_list_l& init_context_setup_request_ies_o::value_c::management_based_mdtplmn_list()
 {
-  assert_choice_type("MDTPLMNList", type_.to_string(), "Value");
+  assert_choice_type(types::management_based_mdtplmn_list, type_, "Value");
   return c.get<mdtplmn_list_l>();
 }
 add_cs_fallback_ind_e& init_context_setup_request_ies_o::value_c::add_cs_fallback_ind()
 {
-  assert_choice_type("AdditionalCSFallbackIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::add_cs_fallback_ind, type_, "Value");
   return c.get<add_cs_fallback_ind_e>();
 }
 fixed_bitstring<64, false, true>& init_context_setup_request_ies_o::value_c::masked_imeisv()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::masked_imeisv, type_, "Value");
   return c.get<fixed_bitstring<64, false, true> >();
 }
 expected_ue_behaviour_s& init_context_setup_request_ies_o::value_c::expected_ue_behaviour()
 {
-  assert_choice_type("ExpectedUEBehaviour", type_.to_string(), "Value");
+  assert_choice_type(types::expected_ue_behaviour, type_, "Value");
   return c.get<expected_ue_behaviour_s>();
 }
 pro_se_authorized_s& init_context_setup_request_ies_o::value_c::pro_se_authorized()
 {
-  assert_choice_type("ProSeAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::pro_se_authorized, type_, "Value");
   return c.get<pro_se_authorized_s>();
 }
 ueuser_plane_cio_tsupport_ind_e& init_context_setup_request_ies_o::value_c::ueuser_plane_cio_tsupport_ind()
 {
-  assert_choice_type("UEUserPlaneCIoTSupportIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::ueuser_plane_cio_tsupport_ind, type_, "Value");
   return c.get<ueuser_plane_cio_tsupport_ind_e>();
 }
 v2xservices_authorized_s& init_context_setup_request_ies_o::value_c::v2xservices_authorized()
 {
-  assert_choice_type("V2XServicesAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::v2xservices_authorized, type_, "Value");
   return c.get<v2xservices_authorized_s>();
 }
 ue_sidelink_aggregate_maximum_bitrate_s&
 init_context_setup_request_ies_o::value_c::ue_sidelink_aggregate_maximum_bitrate()
 {
-  assert_choice_type("UESidelinkAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ue_sidelink_aggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_sidelink_aggregate_maximum_bitrate_s>();
 }
 enhanced_coverage_restricted_e& init_context_setup_request_ies_o::value_c::enhanced_coverage_restricted()
 {
-  assert_choice_type("EnhancedCoverageRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::enhanced_coverage_restricted, type_, "Value");
   return c.get<enhanced_coverage_restricted_e>();
 }
 ce_mode_brestricted_e& init_context_setup_request_ies_o::value_c::ce_mode_brestricted()
 {
-  assert_choice_type("CE-ModeBRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_brestricted, type_, "Value");
   return c.get<ce_mode_brestricted_e>();
 }
 pending_data_ind_e& init_context_setup_request_ies_o::value_c::pending_data_ind()
 {
-  assert_choice_type("PendingDataIndication", type_.to_string(), "Value");
+  assert_choice_type(types::pending_data_ind, type_, "Value");
   return c.get<pending_data_ind_e>();
 }
 const uint64_t& init_context_setup_request_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& init_context_setup_request_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const ue_aggregate_maximum_bitrate_s& init_context_setup_request_ies_o::value_c::ueaggregate_maximum_bitrate() const
 {
-  assert_choice_type("UEAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ueaggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_aggregate_maximum_bitrate_s>();
 }
 const erab_to_be_setup_list_ctxt_su_req_l&
 init_context_setup_request_ies_o::value_c::erab_to_be_setup_list_ctxt_su_req() const
 {
-  assert_choice_type("E-RABToBeSetupListCtxtSUReq", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_setup_list_ctxt_su_req, type_, "Value");
   return c.get<erab_to_be_setup_list_ctxt_su_req_l>();
 }
 const ue_security_cap_s& init_context_setup_request_ies_o::value_c::ue_security_cap() const
 {
-  assert_choice_type("UESecurityCapabilities", type_.to_string(), "Value");
+  assert_choice_type(types::ue_security_cap, type_, "Value");
   return c.get<ue_security_cap_s>();
 }
 const fixed_bitstring<256, false, true>& init_context_setup_request_ies_o::value_c::security_key() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::security_key, type_, "Value");
   return c.get<fixed_bitstring<256, false, true> >();
 }
 const trace_activation_s& init_context_setup_request_ies_o::value_c::trace_activation() const
 {
-  assert_choice_type("TraceActivation", type_.to_string(), "Value");
+  assert_choice_type(types::trace_activation, type_, "Value");
   return c.get<trace_activation_s>();
 }
 const ho_restrict_list_s& init_context_setup_request_ies_o::value_c::ho_restrict_list() const
 {
-  assert_choice_type("HandoverRestrictionList", type_.to_string(), "Value");
+  assert_choice_type(types::ho_restrict_list, type_, "Value");
   return c.get<ho_restrict_list_s>();
 }
 const unbounded_octstring<true>& init_context_setup_request_ies_o::value_c::ue_radio_cap() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const uint16_t& init_context_setup_request_ies_o::value_c::subscriber_profile_idfor_rfp() const
 {
-  assert_choice_type("INTEGER (1..256)", type_.to_string(), "Value");
+  assert_choice_type(types::subscriber_profile_idfor_rfp, type_, "Value");
   return c.get<uint16_t>();
 }
 const cs_fallback_ind_e& init_context_setup_request_ies_o::value_c::cs_fallback_ind() const
 {
-  assert_choice_type("CSFallbackIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::cs_fallback_ind, type_, "Value");
   return c.get<cs_fallback_ind_e>();
 }
 const srvcc_operation_possible_e& init_context_setup_request_ies_o::value_c::srvcc_operation_possible() const
 {
-  assert_choice_type("SRVCCOperationPossible", type_.to_string(), "Value");
+  assert_choice_type(types::srvcc_operation_possible, type_, "Value");
   return c.get<srvcc_operation_possible_e>();
 }
 const csg_membership_status_e& init_context_setup_request_ies_o::value_c::csg_membership_status() const
 {
-  assert_choice_type("CSGMembershipStatus", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_status, type_, "Value");
   return c.get<csg_membership_status_e>();
 }
 const lai_s& init_context_setup_request_ies_o::value_c::registered_lai() const
 {
-  assert_choice_type("LAI", type_.to_string(), "Value");
+  assert_choice_type(types::registered_lai, type_, "Value");
   return c.get<lai_s>();
 }
 const gummei_s& init_context_setup_request_ies_o::value_c::gummei_id() const
 {
-  assert_choice_type("GUMMEI", type_.to_string(), "Value");
+  assert_choice_type(types::gummei_id, type_, "Value");
   return c.get<gummei_s>();
 }
 const uint64_t& init_context_setup_request_ies_o::value_c::mme_ue_s1ap_id_minus2() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id_minus2, type_, "Value");
   return c.get<uint64_t>();
 }
 const management_based_mdt_allowed_e& init_context_setup_request_ies_o::value_c::management_based_mdt_allowed() const
 {
-  assert_choice_type("ManagementBasedMDTAllowed", type_.to_string(), "Value");
+  assert_choice_type(types::management_based_mdt_allowed, type_, "Value");
   return c.get<management_based_mdt_allowed_e>();
 }
 const mdtplmn_list_l& init_context_setup_request_ies_o::value_c::management_based_mdtplmn_list() const
 {
-  assert_choice_type("MDTPLMNList", type_.to_string(), "Value");
+  assert_choice_type(types::management_based_mdtplmn_list, type_, "Value");
   return c.get<mdtplmn_list_l>();
 }
 const add_cs_fallback_ind_e& init_context_setup_request_ies_o::value_c::add_cs_fallback_ind() const
 {
-  assert_choice_type("AdditionalCSFallbackIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::add_cs_fallback_ind, type_, "Value");
   return c.get<add_cs_fallback_ind_e>();
 }
 const fixed_bitstring<64, false, true>& init_context_setup_request_ies_o::value_c::masked_imeisv() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::masked_imeisv, type_, "Value");
   return c.get<fixed_bitstring<64, false, true> >();
 }
 const expected_ue_behaviour_s& init_context_setup_request_ies_o::value_c::expected_ue_behaviour() const
 {
-  assert_choice_type("ExpectedUEBehaviour", type_.to_string(), "Value");
+  assert_choice_type(types::expected_ue_behaviour, type_, "Value");
   return c.get<expected_ue_behaviour_s>();
 }
 const pro_se_authorized_s& init_context_setup_request_ies_o::value_c::pro_se_authorized() const
 {
-  assert_choice_type("ProSeAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::pro_se_authorized, type_, "Value");
   return c.get<pro_se_authorized_s>();
 }
 const ueuser_plane_cio_tsupport_ind_e& init_context_setup_request_ies_o::value_c::ueuser_plane_cio_tsupport_ind() const
 {
-  assert_choice_type("UEUserPlaneCIoTSupportIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::ueuser_plane_cio_tsupport_ind, type_, "Value");
   return c.get<ueuser_plane_cio_tsupport_ind_e>();
 }
 const v2xservices_authorized_s& init_context_setup_request_ies_o::value_c::v2xservices_authorized() const
 {
-  assert_choice_type("V2XServicesAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::v2xservices_authorized, type_, "Value");
   return c.get<v2xservices_authorized_s>();
 }
 const ue_sidelink_aggregate_maximum_bitrate_s&
 init_context_setup_request_ies_o::value_c::ue_sidelink_aggregate_maximum_bitrate() const
 {
-  assert_choice_type("UESidelinkAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ue_sidelink_aggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_sidelink_aggregate_maximum_bitrate_s>();
 }
 const enhanced_coverage_restricted_e& init_context_setup_request_ies_o::value_c::enhanced_coverage_restricted() const
 {
-  assert_choice_type("EnhancedCoverageRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::enhanced_coverage_restricted, type_, "Value");
   return c.get<enhanced_coverage_restricted_e>();
 }
 const ce_mode_brestricted_e& init_context_setup_request_ies_o::value_c::ce_mode_brestricted() const
 {
-  assert_choice_type("CE-ModeBRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_brestricted, type_, "Value");
   return c.get<ce_mode_brestricted_e>();
 }
 const pending_data_ind_e& init_context_setup_request_ies_o::value_c::pending_data_ind() const
 {
-  assert_choice_type("PendingDataIndication", type_.to_string(), "Value");
+  assert_choice_type(types::pending_data_ind, type_, "Value");
   return c.get<pending_data_ind_e>();
 }
 void init_context_setup_request_ies_o::value_c::destroy_()
@@ -30252,52 +30252,52 @@ presence_e init_context_setup_resp_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& init_context_setup_resp_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& init_context_setup_resp_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 erab_setup_list_ctxt_su_res_l& init_context_setup_resp_ies_o::value_c::erab_setup_list_ctxt_su_res()
 {
-  assert_choice_type("E-RABSetupListCtxtSURes", type_.to_string(), "Value");
+  assert_choice_type(types::erab_setup_list_ctxt_su_res, type_, "Value");
   return c.get<erab_setup_list_ctxt_su_res_l>();
 }
 erab_list_l& init_context_setup_resp_ies_o::value_c::erab_failed_to_setup_list_ctxt_su_res()
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_setup_list_ctxt_su_res, type_, "Value");
   return c.get<erab_list_l>();
 }
 crit_diagnostics_s& init_context_setup_resp_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& init_context_setup_resp_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& init_context_setup_resp_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const erab_setup_list_ctxt_su_res_l& init_context_setup_resp_ies_o::value_c::erab_setup_list_ctxt_su_res() const
 {
-  assert_choice_type("E-RABSetupListCtxtSURes", type_.to_string(), "Value");
+  assert_choice_type(types::erab_setup_list_ctxt_su_res, type_, "Value");
   return c.get<erab_setup_list_ctxt_su_res_l>();
 }
 const erab_list_l& init_context_setup_resp_ies_o::value_c::erab_failed_to_setup_list_ctxt_su_res() const
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_setup_list_ctxt_su_res, type_, "Value");
   return c.get<erab_list_l>();
 }
 const crit_diagnostics_s& init_context_setup_resp_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void init_context_setup_resp_ies_o::value_c::destroy_()
@@ -30836,202 +30836,202 @@ presence_e init_ue_msg_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint32_t& init_ue_msg_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 unbounded_octstring<true>& init_ue_msg_ies_o::value_c::nas_pdu()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nas_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 tai_s& init_ue_msg_ies_o::value_c::tai()
 {
-  assert_choice_type("TAI", type_.to_string(), "Value");
+  assert_choice_type(types::tai, type_, "Value");
   return c.get<tai_s>();
 }
 eutran_cgi_s& init_ue_msg_ies_o::value_c::eutran_cgi()
 {
-  assert_choice_type("EUTRAN-CGI", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_cgi, type_, "Value");
   return c.get<eutran_cgi_s>();
 }
 rrc_establishment_cause_e& init_ue_msg_ies_o::value_c::rrc_establishment_cause()
 {
-  assert_choice_type("RRC-Establishment-Cause", type_.to_string(), "Value");
+  assert_choice_type(types::rrc_establishment_cause, type_, "Value");
   return c.get<rrc_establishment_cause_e>();
 }
 s_tmsi_s& init_ue_msg_ies_o::value_c::s_tmsi()
 {
-  assert_choice_type("S-TMSI", type_.to_string(), "Value");
+  assert_choice_type(types::s_tmsi, type_, "Value");
   return c.get<s_tmsi_s>();
 }
 fixed_bitstring<27, false, true>& init_ue_msg_ies_o::value_c::csg_id()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id, type_, "Value");
   return c.get<fixed_bitstring<27, false, true> >();
 }
 gummei_s& init_ue_msg_ies_o::value_c::gummei_id()
 {
-  assert_choice_type("GUMMEI", type_.to_string(), "Value");
+  assert_choice_type(types::gummei_id, type_, "Value");
   return c.get<gummei_s>();
 }
 cell_access_mode_e& init_ue_msg_ies_o::value_c::cell_access_mode()
 {
-  assert_choice_type("CellAccessMode", type_.to_string(), "Value");
+  assert_choice_type(types::cell_access_mode, type_, "Value");
   return c.get<cell_access_mode_e>();
 }
 bounded_bitstring<1, 160, true, true>& init_ue_msg_ies_o::value_c::gw_transport_layer_address()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::gw_transport_layer_address, type_, "Value");
   return c.get<bounded_bitstring<1, 160, true, true> >();
 }
 relay_node_ind_e& init_ue_msg_ies_o::value_c::relay_node_ind()
 {
-  assert_choice_type("RelayNode-Indicator", type_.to_string(), "Value");
+  assert_choice_type(types::relay_node_ind, type_, "Value");
   return c.get<relay_node_ind_e>();
 }
 gummei_type_e& init_ue_msg_ies_o::value_c::gummei_type()
 {
-  assert_choice_type("GUMMEIType", type_.to_string(), "Value");
+  assert_choice_type(types::gummei_type, type_, "Value");
   return c.get<gummei_type_e>();
 }
 tunnel_info_s& init_ue_msg_ies_o::value_c::tunnel_info_for_bbf()
 {
-  assert_choice_type("TunnelInformation", type_.to_string(), "Value");
+  assert_choice_type(types::tunnel_info_for_bbf, type_, "Value");
   return c.get<tunnel_info_s>();
 }
 bounded_bitstring<1, 160, true, true>& init_ue_msg_ies_o::value_c::sipto_l_gw_transport_layer_address()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::sipto_l_gw_transport_layer_address, type_, "Value");
   return c.get<bounded_bitstring<1, 160, true, true> >();
 }
 unbounded_octstring<true>& init_ue_msg_ies_o::value_c::lhn_id()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lhn_id, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 fixed_octstring<2, true>& init_ue_msg_ies_o::value_c::mme_group_id()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::mme_group_id, type_, "Value");
   return c.get<fixed_octstring<2, true> >();
 }
 uint16_t& init_ue_msg_ies_o::value_c::ue_usage_type()
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::ue_usage_type, type_, "Value");
   return c.get<uint16_t>();
 }
 ce_mode_b_support_ind_e& init_ue_msg_ies_o::value_c::ce_mode_b_support_ind()
 {
-  assert_choice_type("CE-mode-B-SupportIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_b_support_ind, type_, "Value");
   return c.get<ce_mode_b_support_ind_e>();
 }
 uint32_t& init_ue_msg_ies_o::value_c::dcn_id()
 {
-  assert_choice_type("INTEGER (0..65535)", type_.to_string(), "Value");
+  assert_choice_type(types::dcn_id, type_, "Value");
   return c.get<uint32_t>();
 }
 coverage_level_e& init_ue_msg_ies_o::value_c::coverage_level()
 {
-  assert_choice_type("Coverage-Level", type_.to_string(), "Value");
+  assert_choice_type(types::coverage_level, type_, "Value");
   return c.get<coverage_level_e>();
 }
 const uint32_t& init_ue_msg_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const unbounded_octstring<true>& init_ue_msg_ies_o::value_c::nas_pdu() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nas_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const tai_s& init_ue_msg_ies_o::value_c::tai() const
 {
-  assert_choice_type("TAI", type_.to_string(), "Value");
+  assert_choice_type(types::tai, type_, "Value");
   return c.get<tai_s>();
 }
 const eutran_cgi_s& init_ue_msg_ies_o::value_c::eutran_cgi() const
 {
-  assert_choice_type("EUTRAN-CGI", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_cgi, type_, "Value");
   return c.get<eutran_cgi_s>();
 }
 const rrc_establishment_cause_e& init_ue_msg_ies_o::value_c::rrc_establishment_cause() const
 {
-  assert_choice_type("RRC-Establishment-Cause", type_.to_string(), "Value");
+  assert_choice_type(types::rrc_establishment_cause, type_, "Value");
   return c.get<rrc_establishment_cause_e>();
 }
 const s_tmsi_s& init_ue_msg_ies_o::value_c::s_tmsi() const
 {
-  assert_choice_type("S-TMSI", type_.to_string(), "Value");
+  assert_choice_type(types::s_tmsi, type_, "Value");
   return c.get<s_tmsi_s>();
 }
 const fixed_bitstring<27, false, true>& init_ue_msg_ies_o::value_c::csg_id() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id, type_, "Value");
   return c.get<fixed_bitstring<27, false, true> >();
 }
 const gummei_s& init_ue_msg_ies_o::value_c::gummei_id() const
 {
-  assert_choice_type("GUMMEI", type_.to_string(), "Value");
+  assert_choice_type(types::gummei_id, type_, "Value");
   return c.get<gummei_s>();
 }
 const cell_access_mode_e& init_ue_msg_ies_o::value_c::cell_access_mode() const
 {
-  assert_choice_type("CellAccessMode", type_.to_string(), "Value");
+  assert_choice_type(types::cell_access_mode, type_, "Value");
   return c.get<cell_access_mode_e>();
 }
 const bounded_bitstring<1, 160, true, true>& init_ue_msg_ies_o::value_c::gw_transport_layer_address() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::gw_transport_layer_address, type_, "Value");
   return c.get<bounded_bitstring<1, 160, true, true> >();
 }
 const relay_node_ind_e& init_ue_msg_ies_o::value_c::relay_node_ind() const
 {
-  assert_choice_type("RelayNode-Indicator", type_.to_string(), "Value");
+  assert_choice_type(types::relay_node_ind, type_, "Value");
   return c.get<relay_node_ind_e>();
 }
 const gummei_type_e& init_ue_msg_ies_o::value_c::gummei_type() const
 {
-  assert_choice_type("GUMMEIType", type_.to_string(), "Value");
+  assert_choice_type(types::gummei_type, type_, "Value");
   return c.get<gummei_type_e>();
 }
 const tunnel_info_s& init_ue_msg_ies_o::value_c::tunnel_info_for_bbf() const
 {
-  assert_choice_type("TunnelInformation", type_.to_string(), "Value");
+  assert_choice_type(types::tunnel_info_for_bbf, type_, "Value");
   return c.get<tunnel_info_s>();
 }
 const bounded_bitstring<1, 160, true, true>& init_ue_msg_ies_o::value_c::sipto_l_gw_transport_layer_address() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::sipto_l_gw_transport_layer_address, type_, "Value");
   return c.get<bounded_bitstring<1, 160, true, true> >();
 }
 const unbounded_octstring<true>& init_ue_msg_ies_o::value_c::lhn_id() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lhn_id, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const fixed_octstring<2, true>& init_ue_msg_ies_o::value_c::mme_group_id() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::mme_group_id, type_, "Value");
   return c.get<fixed_octstring<2, true> >();
 }
 const uint16_t& init_ue_msg_ies_o::value_c::ue_usage_type() const
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::ue_usage_type, type_, "Value");
   return c.get<uint16_t>();
 }
 const ce_mode_b_support_ind_e& init_ue_msg_ies_o::value_c::ce_mode_b_support_ind() const
 {
-  assert_choice_type("CE-mode-B-SupportIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_b_support_ind, type_, "Value");
   return c.get<ce_mode_b_support_ind_e>();
 }
 const uint32_t& init_ue_msg_ies_o::value_c::dcn_id() const
 {
-  assert_choice_type("INTEGER (0..65535)", type_.to_string(), "Value");
+  assert_choice_type(types::dcn_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const coverage_level_e& init_ue_msg_ies_o::value_c::coverage_level() const
 {
-  assert_choice_type("Coverage-Level", type_.to_string(), "Value");
+  assert_choice_type(types::coverage_level, type_, "Value");
   return c.get<coverage_level_e>();
 }
 void init_ue_msg_ies_o::value_c::destroy_()
@@ -33173,42 +33173,42 @@ presence_e kill_request_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 fixed_bitstring<16, false, true>& kill_request_ies_o::value_c::msg_id()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::msg_id, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 fixed_bitstring<16, false, true>& kill_request_ies_o::value_c::serial_num()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::serial_num, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 warning_area_list_c& kill_request_ies_o::value_c::warning_area_list()
 {
-  assert_choice_type("WarningAreaList", type_.to_string(), "Value");
+  assert_choice_type(types::warning_area_list, type_, "Value");
   return c.get<warning_area_list_c>();
 }
 kill_all_warning_msgs_e& kill_request_ies_o::value_c::kill_all_warning_msgs()
 {
-  assert_choice_type("KillAllWarningMessages", type_.to_string(), "Value");
+  assert_choice_type(types::kill_all_warning_msgs, type_, "Value");
   return c.get<kill_all_warning_msgs_e>();
 }
 const fixed_bitstring<16, false, true>& kill_request_ies_o::value_c::msg_id() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::msg_id, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 const fixed_bitstring<16, false, true>& kill_request_ies_o::value_c::serial_num() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::serial_num, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 const warning_area_list_c& kill_request_ies_o::value_c::warning_area_list() const
 {
-  assert_choice_type("WarningAreaList", type_.to_string(), "Value");
+  assert_choice_type(types::warning_area_list, type_, "Value");
   return c.get<warning_area_list_c>();
 }
 const kill_all_warning_msgs_e& kill_request_ies_o::value_c::kill_all_warning_msgs() const
 {
-  assert_choice_type("KillAllWarningMessages", type_.to_string(), "Value");
+  assert_choice_type(types::kill_all_warning_msgs, type_, "Value");
   return c.get<kill_all_warning_msgs_e>();
 }
 void kill_request_ies_o::value_c::destroy_()
@@ -33444,42 +33444,42 @@ presence_e kill_resp_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 fixed_bitstring<16, false, true>& kill_resp_ies_o::value_c::msg_id()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::msg_id, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 fixed_bitstring<16, false, true>& kill_resp_ies_o::value_c::serial_num()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::serial_num, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 broadcast_cancelled_area_list_c& kill_resp_ies_o::value_c::broadcast_cancelled_area_list()
 {
-  assert_choice_type("BroadcastCancelledAreaList", type_.to_string(), "Value");
+  assert_choice_type(types::broadcast_cancelled_area_list, type_, "Value");
   return c.get<broadcast_cancelled_area_list_c>();
 }
 crit_diagnostics_s& kill_resp_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const fixed_bitstring<16, false, true>& kill_resp_ies_o::value_c::msg_id() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::msg_id, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 const fixed_bitstring<16, false, true>& kill_resp_ies_o::value_c::serial_num() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::serial_num, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 const broadcast_cancelled_area_list_c& kill_resp_ies_o::value_c::broadcast_cancelled_area_list() const
 {
-  assert_choice_type("BroadcastCancelledAreaList", type_.to_string(), "Value");
+  assert_choice_type(types::broadcast_cancelled_area_list, type_, "Value");
   return c.get<broadcast_cancelled_area_list_c>();
 }
 const crit_diagnostics_s& kill_resp_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void kill_resp_ies_o::value_c::destroy_()
@@ -33727,52 +33727,52 @@ presence_e location_report_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& location_report_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& location_report_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 eutran_cgi_s& location_report_ies_o::value_c::eutran_cgi()
 {
-  assert_choice_type("EUTRAN-CGI", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_cgi, type_, "Value");
   return c.get<eutran_cgi_s>();
 }
 tai_s& location_report_ies_o::value_c::tai()
 {
-  assert_choice_type("TAI", type_.to_string(), "Value");
+  assert_choice_type(types::tai, type_, "Value");
   return c.get<tai_s>();
 }
 request_type_s& location_report_ies_o::value_c::request_type()
 {
-  assert_choice_type("RequestType", type_.to_string(), "Value");
+  assert_choice_type(types::request_type, type_, "Value");
   return c.get<request_type_s>();
 }
 const uint64_t& location_report_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& location_report_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const eutran_cgi_s& location_report_ies_o::value_c::eutran_cgi() const
 {
-  assert_choice_type("EUTRAN-CGI", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_cgi, type_, "Value");
   return c.get<eutran_cgi_s>();
 }
 const tai_s& location_report_ies_o::value_c::tai() const
 {
-  assert_choice_type("TAI", type_.to_string(), "Value");
+  assert_choice_type(types::tai, type_, "Value");
   return c.get<tai_s>();
 }
 const request_type_s& location_report_ies_o::value_c::request_type() const
 {
-  assert_choice_type("RequestType", type_.to_string(), "Value");
+  assert_choice_type(types::request_type, type_, "Value");
   return c.get<request_type_s>();
 }
 void location_report_ies_o::value_c::destroy_()
@@ -34021,32 +34021,32 @@ presence_e location_report_ctrl_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& location_report_ctrl_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& location_report_ctrl_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 request_type_s& location_report_ctrl_ies_o::value_c::request_type()
 {
-  assert_choice_type("RequestType", type_.to_string(), "Value");
+  assert_choice_type(types::request_type, type_, "Value");
   return c.get<request_type_s>();
 }
 const uint64_t& location_report_ctrl_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& location_report_ctrl_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const request_type_s& location_report_ctrl_ies_o::value_c::request_type() const
 {
-  assert_choice_type("RequestType", type_.to_string(), "Value");
+  assert_choice_type(types::request_type, type_, "Value");
   return c.get<request_type_s>();
 }
 void location_report_ctrl_ies_o::value_c::destroy_()
@@ -34251,32 +34251,32 @@ presence_e location_report_fail_ind_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& location_report_fail_ind_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& location_report_fail_ind_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 cause_c& location_report_fail_ind_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const uint64_t& location_report_fail_ind_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& location_report_fail_ind_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const cause_c& location_report_fail_ind_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 void location_report_fail_ind_ies_o::value_c::destroy_()
@@ -34474,22 +34474,22 @@ presence_e mmecp_relocation_ind_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& mmecp_relocation_ind_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& mmecp_relocation_ind_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const uint64_t& mmecp_relocation_ind_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& mmecp_relocation_ind_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 void mmecp_relocation_ind_ies_o::value_c::destroy_() {}
@@ -34780,32 +34780,32 @@ presence_e mme_cfg_upd_fail_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 cause_c& mme_cfg_upd_fail_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 time_to_wait_e& mme_cfg_upd_fail_ies_o::value_c::time_to_wait()
 {
-  assert_choice_type("TimeToWait", type_.to_string(), "Value");
+  assert_choice_type(types::time_to_wait, type_, "Value");
   return c.get<time_to_wait_e>();
 }
 crit_diagnostics_s& mme_cfg_upd_fail_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const cause_c& mme_cfg_upd_fail_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const time_to_wait_e& mme_cfg_upd_fail_ies_o::value_c::time_to_wait() const
 {
-  assert_choice_type("TimeToWait", type_.to_string(), "Value");
+  assert_choice_type(types::time_to_wait, type_, "Value");
   return c.get<time_to_wait_e>();
 }
 const crit_diagnostics_s& mme_cfg_upd_fail_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void mme_cfg_upd_fail_ies_o::value_c::destroy_()
@@ -35022,42 +35022,42 @@ presence_e mme_cfg_upd_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 printable_string<1, 150, true, true>& mme_cfg_upd_ies_o::value_c::mm_ename()
 {
-  assert_choice_type("PrintableString", type_.to_string(), "Value");
+  assert_choice_type(types::mm_ename, type_, "Value");
   return c.get<printable_string<1, 150, true, true> >();
 }
 served_gummeis_l& mme_cfg_upd_ies_o::value_c::served_gummeis()
 {
-  assert_choice_type("ServedGUMMEIs", type_.to_string(), "Value");
+  assert_choice_type(types::served_gummeis, type_, "Value");
   return c.get<served_gummeis_l>();
 }
 uint16_t& mme_cfg_upd_ies_o::value_c::relative_mme_capacity()
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::relative_mme_capacity, type_, "Value");
   return c.get<uint16_t>();
 }
 served_dcns_l& mme_cfg_upd_ies_o::value_c::served_dcns()
 {
-  assert_choice_type("ServedDCNs", type_.to_string(), "Value");
+  assert_choice_type(types::served_dcns, type_, "Value");
   return c.get<served_dcns_l>();
 }
 const printable_string<1, 150, true, true>& mme_cfg_upd_ies_o::value_c::mm_ename() const
 {
-  assert_choice_type("PrintableString", type_.to_string(), "Value");
+  assert_choice_type(types::mm_ename, type_, "Value");
   return c.get<printable_string<1, 150, true, true> >();
 }
 const served_gummeis_l& mme_cfg_upd_ies_o::value_c::served_gummeis() const
 {
-  assert_choice_type("ServedGUMMEIs", type_.to_string(), "Value");
+  assert_choice_type(types::served_gummeis, type_, "Value");
   return c.get<served_gummeis_l>();
 }
 const uint16_t& mme_cfg_upd_ies_o::value_c::relative_mme_capacity() const
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::relative_mme_capacity, type_, "Value");
   return c.get<uint16_t>();
 }
 const served_dcns_l& mme_cfg_upd_ies_o::value_c::served_dcns() const
 {
-  assert_choice_type("ServedDCNs", type_.to_string(), "Value");
+  assert_choice_type(types::served_dcns, type_, "Value");
   return c.get<served_dcns_l>();
 }
 void mme_cfg_upd_ies_o::value_c::destroy_()
@@ -35363,34 +35363,34 @@ presence_e mme_status_transfer_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& mme_status_transfer_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& mme_status_transfer_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 enb_status_transfer_transparent_container_s&
 mme_status_transfer_ies_o::value_c::enb_status_transfer_transparent_container()
 {
-  assert_choice_type("ENB-StatusTransfer-TransparentContainer", type_.to_string(), "Value");
+  assert_choice_type(types::enb_status_transfer_transparent_container, type_, "Value");
   return c.get<enb_status_transfer_transparent_container_s>();
 }
 const uint64_t& mme_status_transfer_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& mme_status_transfer_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const enb_status_transfer_transparent_container_s&
 mme_status_transfer_ies_o::value_c::enb_status_transfer_transparent_container() const
 {
-  assert_choice_type("ENB-StatusTransfer-TransparentContainer", type_.to_string(), "Value");
+  assert_choice_type(types::enb_status_transfer_transparent_container, type_, "Value");
   return c.get<enb_status_transfer_transparent_container_s>();
 }
 void mme_status_transfer_ies_o::value_c::destroy_()
@@ -35589,22 +35589,22 @@ presence_e nas_delivery_ind_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& nas_delivery_ind_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& nas_delivery_ind_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const uint64_t& nas_delivery_ind_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& nas_delivery_ind_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 void nas_delivery_ind_ies_o::value_c::destroy_() {}
@@ -35778,42 +35778,42 @@ presence_e nas_non_delivery_ind_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& nas_non_delivery_ind_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& nas_non_delivery_ind_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 unbounded_octstring<true>& nas_non_delivery_ind_ies_o::value_c::nas_pdu()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nas_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 cause_c& nas_non_delivery_ind_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const uint64_t& nas_non_delivery_ind_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& nas_non_delivery_ind_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const unbounded_octstring<true>& nas_non_delivery_ind_ies_o::value_c::nas_pdu() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nas_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const cause_c& nas_non_delivery_ind_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 void nas_non_delivery_ind_ies_o::value_c::destroy_()
@@ -36039,32 +36039,32 @@ presence_e overload_start_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 overload_resp_c& overload_start_ies_o::value_c::overload_resp()
 {
-  assert_choice_type("OverloadResponse", type_.to_string(), "Value");
+  assert_choice_type(types::overload_resp, type_, "Value");
   return c.get<overload_resp_c>();
 }
 gummei_list_l& overload_start_ies_o::value_c::gummei_list()
 {
-  assert_choice_type("GUMMEIList", type_.to_string(), "Value");
+  assert_choice_type(types::gummei_list, type_, "Value");
   return c.get<gummei_list_l>();
 }
 uint8_t& overload_start_ies_o::value_c::traffic_load_reduction_ind()
 {
-  assert_choice_type("INTEGER (1..99)", type_.to_string(), "Value");
+  assert_choice_type(types::traffic_load_reduction_ind, type_, "Value");
   return c.get<uint8_t>();
 }
 const overload_resp_c& overload_start_ies_o::value_c::overload_resp() const
 {
-  assert_choice_type("OverloadResponse", type_.to_string(), "Value");
+  assert_choice_type(types::overload_resp, type_, "Value");
   return c.get<overload_resp_c>();
 }
 const gummei_list_l& overload_start_ies_o::value_c::gummei_list() const
 {
-  assert_choice_type("GUMMEIList", type_.to_string(), "Value");
+  assert_choice_type(types::gummei_list, type_, "Value");
   return c.get<gummei_list_l>();
 }
 const uint8_t& overload_start_ies_o::value_c::traffic_load_reduction_ind() const
 {
-  assert_choice_type("INTEGER (1..99)", type_.to_string(), "Value");
+  assert_choice_type(types::traffic_load_reduction_ind, type_, "Value");
   return c.get<uint8_t>();
 }
 void overload_start_ies_o::value_c::destroy_()
@@ -36342,22 +36342,22 @@ presence_e pws_fail_ind_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 pw_sfailed_ecgi_list_l& pws_fail_ind_ies_o::value_c::pw_sfailed_ecgi_list()
 {
-  assert_choice_type("PWSfailedECGIList", type_.to_string(), "Value");
+  assert_choice_type(types::pw_sfailed_ecgi_list, type_, "Value");
   return c.get<pw_sfailed_ecgi_list_l>();
 }
 global_enb_id_s& pws_fail_ind_ies_o::value_c::global_enb_id()
 {
-  assert_choice_type("Global-ENB-ID", type_.to_string(), "Value");
+  assert_choice_type(types::global_enb_id, type_, "Value");
   return c.get<global_enb_id_s>();
 }
 const pw_sfailed_ecgi_list_l& pws_fail_ind_ies_o::value_c::pw_sfailed_ecgi_list() const
 {
-  assert_choice_type("PWSfailedECGIList", type_.to_string(), "Value");
+  assert_choice_type(types::pw_sfailed_ecgi_list, type_, "Value");
   return c.get<pw_sfailed_ecgi_list_l>();
 }
 const global_enb_id_s& pws_fail_ind_ies_o::value_c::global_enb_id() const
 {
-  assert_choice_type("Global-ENB-ID", type_.to_string(), "Value");
+  assert_choice_type(types::global_enb_id, type_, "Value");
   return c.get<global_enb_id_s>();
 }
 void pws_fail_ind_ies_o::value_c::destroy_()
@@ -36559,42 +36559,42 @@ presence_e pws_restart_ind_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 ecgi_list_for_restart_l& pws_restart_ind_ies_o::value_c::ecgi_list_for_restart()
 {
-  assert_choice_type("ECGIListForRestart", type_.to_string(), "Value");
+  assert_choice_type(types::ecgi_list_for_restart, type_, "Value");
   return c.get<ecgi_list_for_restart_l>();
 }
 global_enb_id_s& pws_restart_ind_ies_o::value_c::global_enb_id()
 {
-  assert_choice_type("Global-ENB-ID", type_.to_string(), "Value");
+  assert_choice_type(types::global_enb_id, type_, "Value");
   return c.get<global_enb_id_s>();
 }
 tai_list_for_restart_l& pws_restart_ind_ies_o::value_c::tai_list_for_restart()
 {
-  assert_choice_type("TAIListForRestart", type_.to_string(), "Value");
+  assert_choice_type(types::tai_list_for_restart, type_, "Value");
   return c.get<tai_list_for_restart_l>();
 }
 emergency_area_id_list_for_restart_l& pws_restart_ind_ies_o::value_c::emergency_area_id_list_for_restart()
 {
-  assert_choice_type("EmergencyAreaIDListForRestart", type_.to_string(), "Value");
+  assert_choice_type(types::emergency_area_id_list_for_restart, type_, "Value");
   return c.get<emergency_area_id_list_for_restart_l>();
 }
 const ecgi_list_for_restart_l& pws_restart_ind_ies_o::value_c::ecgi_list_for_restart() const
 {
-  assert_choice_type("ECGIListForRestart", type_.to_string(), "Value");
+  assert_choice_type(types::ecgi_list_for_restart, type_, "Value");
   return c.get<ecgi_list_for_restart_l>();
 }
 const global_enb_id_s& pws_restart_ind_ies_o::value_c::global_enb_id() const
 {
-  assert_choice_type("Global-ENB-ID", type_.to_string(), "Value");
+  assert_choice_type(types::global_enb_id, type_, "Value");
   return c.get<global_enb_id_s>();
 }
 const tai_list_for_restart_l& pws_restart_ind_ies_o::value_c::tai_list_for_restart() const
 {
-  assert_choice_type("TAIListForRestart", type_.to_string(), "Value");
+  assert_choice_type(types::tai_list_for_restart, type_, "Value");
   return c.get<tai_list_for_restart_l>();
 }
 const emergency_area_id_list_for_restart_l& pws_restart_ind_ies_o::value_c::emergency_area_id_list_for_restart() const
 {
-  assert_choice_type("EmergencyAreaIDListForRestart", type_.to_string(), "Value");
+  assert_choice_type(types::emergency_area_id_list_for_restart, type_, "Value");
   return c.get<emergency_area_id_list_for_restart_l>();
 }
 void pws_restart_ind_ies_o::value_c::destroy_()
@@ -36924,152 +36924,152 @@ presence_e paging_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 fixed_bitstring<10, false, true>& paging_ies_o::value_c::ue_id_idx_value()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_id_idx_value, type_, "Value");
   return c.get<fixed_bitstring<10, false, true> >();
 }
 ue_paging_id_c& paging_ies_o::value_c::ue_paging_id()
 {
-  assert_choice_type("UEPagingID", type_.to_string(), "Value");
+  assert_choice_type(types::ue_paging_id, type_, "Value");
   return c.get<ue_paging_id_c>();
 }
 paging_drx_e& paging_ies_o::value_c::paging_drx()
 {
-  assert_choice_type("PagingDRX", type_.to_string(), "Value");
+  assert_choice_type(types::paging_drx, type_, "Value");
   return c.get<paging_drx_e>();
 }
 cn_domain_e& paging_ies_o::value_c::cn_domain()
 {
-  assert_choice_type("CNDomain", type_.to_string(), "Value");
+  assert_choice_type(types::cn_domain, type_, "Value");
   return c.get<cn_domain_e>();
 }
 tai_list_l& paging_ies_o::value_c::tai_list()
 {
-  assert_choice_type("TAIList", type_.to_string(), "Value");
+  assert_choice_type(types::tai_list, type_, "Value");
   return c.get<tai_list_l>();
 }
 csg_id_list_l& paging_ies_o::value_c::csg_id_list()
 {
-  assert_choice_type("CSG-IdList", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id_list, type_, "Value");
   return c.get<csg_id_list_l>();
 }
 paging_prio_e& paging_ies_o::value_c::paging_prio()
 {
-  assert_choice_type("PagingPriority", type_.to_string(), "Value");
+  assert_choice_type(types::paging_prio, type_, "Value");
   return c.get<paging_prio_e>();
 }
 unbounded_octstring<true>& paging_ies_o::value_c::ue_radio_cap_for_paging()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap_for_paging, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 assist_data_for_paging_s& paging_ies_o::value_c::assist_data_for_paging()
 {
-  assert_choice_type("AssistanceDataForPaging", type_.to_string(), "Value");
+  assert_choice_type(types::assist_data_for_paging, type_, "Value");
   return c.get<assist_data_for_paging_s>();
 }
 paging_e_drx_info_s& paging_ies_o::value_c::paging_e_drx_info()
 {
-  assert_choice_type("Paging-eDRXInformation", type_.to_string(), "Value");
+  assert_choice_type(types::paging_e_drx_info, type_, "Value");
   return c.get<paging_e_drx_info_s>();
 }
 fixed_bitstring<14, false, true>& paging_ies_o::value_c::extended_ue_id_idx_value()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::extended_ue_id_idx_value, type_, "Value");
   return c.get<fixed_bitstring<14, false, true> >();
 }
 nb_io_t_paging_e_drx_info_s& paging_ies_o::value_c::nb_io_t_paging_e_drx_info()
 {
-  assert_choice_type("NB-IoT-Paging-eDRXInformation", type_.to_string(), "Value");
+  assert_choice_type(types::nb_io_t_paging_e_drx_info, type_, "Value");
   return c.get<nb_io_t_paging_e_drx_info_s>();
 }
 fixed_bitstring<12, false, true>& paging_ies_o::value_c::nb_io_t_ue_id_idx_value()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nb_io_t_ue_id_idx_value, type_, "Value");
   return c.get<fixed_bitstring<12, false, true> >();
 }
 enhanced_coverage_restricted_e& paging_ies_o::value_c::enhanced_coverage_restricted()
 {
-  assert_choice_type("EnhancedCoverageRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::enhanced_coverage_restricted, type_, "Value");
   return c.get<enhanced_coverage_restricted_e>();
 }
 ce_mode_brestricted_e& paging_ies_o::value_c::ce_mode_brestricted()
 {
-  assert_choice_type("CE-ModeBRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_brestricted, type_, "Value");
   return c.get<ce_mode_brestricted_e>();
 }
 const fixed_bitstring<10, false, true>& paging_ies_o::value_c::ue_id_idx_value() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_id_idx_value, type_, "Value");
   return c.get<fixed_bitstring<10, false, true> >();
 }
 const ue_paging_id_c& paging_ies_o::value_c::ue_paging_id() const
 {
-  assert_choice_type("UEPagingID", type_.to_string(), "Value");
+  assert_choice_type(types::ue_paging_id, type_, "Value");
   return c.get<ue_paging_id_c>();
 }
 const paging_drx_e& paging_ies_o::value_c::paging_drx() const
 {
-  assert_choice_type("PagingDRX", type_.to_string(), "Value");
+  assert_choice_type(types::paging_drx, type_, "Value");
   return c.get<paging_drx_e>();
 }
 const cn_domain_e& paging_ies_o::value_c::cn_domain() const
 {
-  assert_choice_type("CNDomain", type_.to_string(), "Value");
+  assert_choice_type(types::cn_domain, type_, "Value");
   return c.get<cn_domain_e>();
 }
 const tai_list_l& paging_ies_o::value_c::tai_list() const
 {
-  assert_choice_type("TAIList", type_.to_string(), "Value");
+  assert_choice_type(types::tai_list, type_, "Value");
   return c.get<tai_list_l>();
 }
 const csg_id_list_l& paging_ies_o::value_c::csg_id_list() const
 {
-  assert_choice_type("CSG-IdList", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id_list, type_, "Value");
   return c.get<csg_id_list_l>();
 }
 const paging_prio_e& paging_ies_o::value_c::paging_prio() const
 {
-  assert_choice_type("PagingPriority", type_.to_string(), "Value");
+  assert_choice_type(types::paging_prio, type_, "Value");
   return c.get<paging_prio_e>();
 }
 const unbounded_octstring<true>& paging_ies_o::value_c::ue_radio_cap_for_paging() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap_for_paging, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const assist_data_for_paging_s& paging_ies_o::value_c::assist_data_for_paging() const
 {
-  assert_choice_type("AssistanceDataForPaging", type_.to_string(), "Value");
+  assert_choice_type(types::assist_data_for_paging, type_, "Value");
   return c.get<assist_data_for_paging_s>();
 }
 const paging_e_drx_info_s& paging_ies_o::value_c::paging_e_drx_info() const
 {
-  assert_choice_type("Paging-eDRXInformation", type_.to_string(), "Value");
+  assert_choice_type(types::paging_e_drx_info, type_, "Value");
   return c.get<paging_e_drx_info_s>();
 }
 const fixed_bitstring<14, false, true>& paging_ies_o::value_c::extended_ue_id_idx_value() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::extended_ue_id_idx_value, type_, "Value");
   return c.get<fixed_bitstring<14, false, true> >();
 }
 const nb_io_t_paging_e_drx_info_s& paging_ies_o::value_c::nb_io_t_paging_e_drx_info() const
 {
-  assert_choice_type("NB-IoT-Paging-eDRXInformation", type_.to_string(), "Value");
+  assert_choice_type(types::nb_io_t_paging_e_drx_info, type_, "Value");
   return c.get<nb_io_t_paging_e_drx_info_s>();
 }
 const fixed_bitstring<12, false, true>& paging_ies_o::value_c::nb_io_t_ue_id_idx_value() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nb_io_t_ue_id_idx_value, type_, "Value");
   return c.get<fixed_bitstring<12, false, true> >();
 }
 const enhanced_coverage_restricted_e& paging_ies_o::value_c::enhanced_coverage_restricted() const
 {
-  assert_choice_type("EnhancedCoverageRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::enhanced_coverage_restricted, type_, "Value");
   return c.get<enhanced_coverage_restricted_e>();
 }
 const ce_mode_brestricted_e& paging_ies_o::value_c::ce_mode_brestricted() const
 {
-  assert_choice_type("CE-ModeBRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_brestricted, type_, "Value");
   return c.get<ce_mode_brestricted_e>();
 }
 void paging_ies_o::value_c::destroy_()
@@ -37629,165 +37629,165 @@ presence_e path_switch_request_ack_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& path_switch_request_ack_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& path_switch_request_ack_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 ue_aggregate_maximum_bitrate_s& path_switch_request_ack_ies_o::value_c::ueaggregate_maximum_bitrate()
 {
-  assert_choice_type("UEAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ueaggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_aggregate_maximum_bitrate_s>();
 }
 erab_ie_container_list_l<erab_to_be_switched_ul_item_ies_o>&
 path_switch_request_ack_ies_o::value_c::erab_to_be_switched_ul_list()
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABToBeSwitchedULItemIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_switched_ul_list, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_to_be_switched_ul_item_ies_o> >();
 }
 erab_list_l& path_switch_request_ack_ies_o::value_c::erab_to_be_released_list()
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_released_list, type_, "Value");
   return c.get<erab_list_l>();
 }
 security_context_s& path_switch_request_ack_ies_o::value_c::security_context()
 {
-  assert_choice_type("SecurityContext", type_.to_string(), "Value");
+  assert_choice_type(types::security_context, type_, "Value");
   return c.get<security_context_s>();
 }
 crit_diagnostics_s& path_switch_request_ack_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 uint64_t& path_switch_request_ack_ies_o::value_c::mme_ue_s1ap_id_minus2()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id_minus2, type_, "Value");
   return c.get<uint64_t>();
 }
 csg_membership_status_e& path_switch_request_ack_ies_o::value_c::csg_membership_status()
 {
-  assert_choice_type("CSGMembershipStatus", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_status, type_, "Value");
   return c.get<csg_membership_status_e>();
 }
 pro_se_authorized_s& path_switch_request_ack_ies_o::value_c::pro_se_authorized()
 {
-  assert_choice_type("ProSeAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::pro_se_authorized, type_, "Value");
   return c.get<pro_se_authorized_s>();
 }
 ueuser_plane_cio_tsupport_ind_e& path_switch_request_ack_ies_o::value_c::ueuser_plane_cio_tsupport_ind()
 {
-  assert_choice_type("UEUserPlaneCIoTSupportIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::ueuser_plane_cio_tsupport_ind, type_, "Value");
   return c.get<ueuser_plane_cio_tsupport_ind_e>();
 }
 v2xservices_authorized_s& path_switch_request_ack_ies_o::value_c::v2xservices_authorized()
 {
-  assert_choice_type("V2XServicesAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::v2xservices_authorized, type_, "Value");
   return c.get<v2xservices_authorized_s>();
 }
 ue_sidelink_aggregate_maximum_bitrate_s& path_switch_request_ack_ies_o::value_c::ue_sidelink_aggregate_maximum_bitrate()
 {
-  assert_choice_type("UESidelinkAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ue_sidelink_aggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_sidelink_aggregate_maximum_bitrate_s>();
 }
 enhanced_coverage_restricted_e& path_switch_request_ack_ies_o::value_c::enhanced_coverage_restricted()
 {
-  assert_choice_type("EnhancedCoverageRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::enhanced_coverage_restricted, type_, "Value");
   return c.get<enhanced_coverage_restricted_e>();
 }
 ce_mode_brestricted_e& path_switch_request_ack_ies_o::value_c::ce_mode_brestricted()
 {
-  assert_choice_type("CE-ModeBRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_brestricted, type_, "Value");
   return c.get<ce_mode_brestricted_e>();
 }
 pending_data_ind_e& path_switch_request_ack_ies_o::value_c::pending_data_ind()
 {
-  assert_choice_type("PendingDataIndication", type_.to_string(), "Value");
+  assert_choice_type(types::pending_data_ind, type_, "Value");
   return c.get<pending_data_ind_e>();
 }
 const uint64_t& path_switch_request_ack_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& path_switch_request_ack_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const ue_aggregate_maximum_bitrate_s& path_switch_request_ack_ies_o::value_c::ueaggregate_maximum_bitrate() const
 {
-  assert_choice_type("UEAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ueaggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_aggregate_maximum_bitrate_s>();
 }
 const erab_ie_container_list_l<erab_to_be_switched_ul_item_ies_o>&
 path_switch_request_ack_ies_o::value_c::erab_to_be_switched_ul_list() const
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABToBeSwitchedULItemIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_switched_ul_list, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_to_be_switched_ul_item_ies_o> >();
 }
 const erab_list_l& path_switch_request_ack_ies_o::value_c::erab_to_be_released_list() const
 {
-  assert_choice_type("E-RABList", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_released_list, type_, "Value");
   return c.get<erab_list_l>();
 }
 const security_context_s& path_switch_request_ack_ies_o::value_c::security_context() const
 {
-  assert_choice_type("SecurityContext", type_.to_string(), "Value");
+  assert_choice_type(types::security_context, type_, "Value");
   return c.get<security_context_s>();
 }
 const crit_diagnostics_s& path_switch_request_ack_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& path_switch_request_ack_ies_o::value_c::mme_ue_s1ap_id_minus2() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id_minus2, type_, "Value");
   return c.get<uint64_t>();
 }
 const csg_membership_status_e& path_switch_request_ack_ies_o::value_c::csg_membership_status() const
 {
-  assert_choice_type("CSGMembershipStatus", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_status, type_, "Value");
   return c.get<csg_membership_status_e>();
 }
 const pro_se_authorized_s& path_switch_request_ack_ies_o::value_c::pro_se_authorized() const
 {
-  assert_choice_type("ProSeAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::pro_se_authorized, type_, "Value");
   return c.get<pro_se_authorized_s>();
 }
 const ueuser_plane_cio_tsupport_ind_e& path_switch_request_ack_ies_o::value_c::ueuser_plane_cio_tsupport_ind() const
 {
-  assert_choice_type("UEUserPlaneCIoTSupportIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::ueuser_plane_cio_tsupport_ind, type_, "Value");
   return c.get<ueuser_plane_cio_tsupport_ind_e>();
 }
 const v2xservices_authorized_s& path_switch_request_ack_ies_o::value_c::v2xservices_authorized() const
 {
-  assert_choice_type("V2XServicesAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::v2xservices_authorized, type_, "Value");
   return c.get<v2xservices_authorized_s>();
 }
 const ue_sidelink_aggregate_maximum_bitrate_s&
 path_switch_request_ack_ies_o::value_c::ue_sidelink_aggregate_maximum_bitrate() const
 {
-  assert_choice_type("UESidelinkAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ue_sidelink_aggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_sidelink_aggregate_maximum_bitrate_s>();
 }
 const enhanced_coverage_restricted_e& path_switch_request_ack_ies_o::value_c::enhanced_coverage_restricted() const
 {
-  assert_choice_type("EnhancedCoverageRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::enhanced_coverage_restricted, type_, "Value");
   return c.get<enhanced_coverage_restricted_e>();
 }
 const ce_mode_brestricted_e& path_switch_request_ack_ies_o::value_c::ce_mode_brestricted() const
 {
-  assert_choice_type("CE-ModeBRestricted", type_.to_string(), "Value");
+  assert_choice_type(types::ce_mode_brestricted, type_, "Value");
   return c.get<ce_mode_brestricted_e>();
 }
 const pending_data_ind_e& path_switch_request_ack_ies_o::value_c::pending_data_ind() const
 {
-  assert_choice_type("PendingDataIndication", type_.to_string(), "Value");
+  assert_choice_type(types::pending_data_ind, type_, "Value");
   return c.get<pending_data_ind_e>();
 }
 void path_switch_request_ack_ies_o::value_c::destroy_()
@@ -38274,42 +38274,42 @@ presence_e path_switch_request_fail_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& path_switch_request_fail_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& path_switch_request_fail_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 cause_c& path_switch_request_fail_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 crit_diagnostics_s& path_switch_request_fail_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& path_switch_request_fail_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& path_switch_request_fail_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const cause_c& path_switch_request_fail_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const crit_diagnostics_s& path_switch_request_fail_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void path_switch_request_fail_ies_o::value_c::destroy_()
@@ -38607,134 +38607,134 @@ presence_e path_switch_request_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint32_t& path_switch_request_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 erab_ie_container_list_l<erab_to_be_switched_dl_item_ies_o>&
 path_switch_request_ies_o::value_c::erab_to_be_switched_dl_list()
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABToBeSwitchedDLItemIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_switched_dl_list, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_to_be_switched_dl_item_ies_o> >();
 }
 uint64_t& path_switch_request_ies_o::value_c::source_mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::source_mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 eutran_cgi_s& path_switch_request_ies_o::value_c::eutran_cgi()
 {
-  assert_choice_type("EUTRAN-CGI", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_cgi, type_, "Value");
   return c.get<eutran_cgi_s>();
 }
 tai_s& path_switch_request_ies_o::value_c::tai()
 {
-  assert_choice_type("TAI", type_.to_string(), "Value");
+  assert_choice_type(types::tai, type_, "Value");
   return c.get<tai_s>();
 }
 ue_security_cap_s& path_switch_request_ies_o::value_c::ue_security_cap()
 {
-  assert_choice_type("UESecurityCapabilities", type_.to_string(), "Value");
+  assert_choice_type(types::ue_security_cap, type_, "Value");
   return c.get<ue_security_cap_s>();
 }
 fixed_bitstring<27, false, true>& path_switch_request_ies_o::value_c::csg_id()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id, type_, "Value");
   return c.get<fixed_bitstring<27, false, true> >();
 }
 cell_access_mode_e& path_switch_request_ies_o::value_c::cell_access_mode()
 {
-  assert_choice_type("CellAccessMode", type_.to_string(), "Value");
+  assert_choice_type(types::cell_access_mode, type_, "Value");
   return c.get<cell_access_mode_e>();
 }
 gummei_s& path_switch_request_ies_o::value_c::source_mme_gummei()
 {
-  assert_choice_type("GUMMEI", type_.to_string(), "Value");
+  assert_choice_type(types::source_mme_gummei, type_, "Value");
   return c.get<gummei_s>();
 }
 csg_membership_status_e& path_switch_request_ies_o::value_c::csg_membership_status()
 {
-  assert_choice_type("CSGMembershipStatus", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_status, type_, "Value");
   return c.get<csg_membership_status_e>();
 }
 tunnel_info_s& path_switch_request_ies_o::value_c::tunnel_info_for_bbf()
 {
-  assert_choice_type("TunnelInformation", type_.to_string(), "Value");
+  assert_choice_type(types::tunnel_info_for_bbf, type_, "Value");
   return c.get<tunnel_info_s>();
 }
 unbounded_octstring<true>& path_switch_request_ies_o::value_c::lhn_id()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lhn_id, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 rrc_establishment_cause_e& path_switch_request_ies_o::value_c::rrc_resume_cause()
 {
-  assert_choice_type("RRC-Establishment-Cause", type_.to_string(), "Value");
+  assert_choice_type(types::rrc_resume_cause, type_, "Value");
   return c.get<rrc_establishment_cause_e>();
 }
 const uint32_t& path_switch_request_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const erab_ie_container_list_l<erab_to_be_switched_dl_item_ies_o>&
 path_switch_request_ies_o::value_c::erab_to_be_switched_dl_list() const
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABToBeSwitchedDLItemIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_to_be_switched_dl_list, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_to_be_switched_dl_item_ies_o> >();
 }
 const uint64_t& path_switch_request_ies_o::value_c::source_mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::source_mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const eutran_cgi_s& path_switch_request_ies_o::value_c::eutran_cgi() const
 {
-  assert_choice_type("EUTRAN-CGI", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_cgi, type_, "Value");
   return c.get<eutran_cgi_s>();
 }
 const tai_s& path_switch_request_ies_o::value_c::tai() const
 {
-  assert_choice_type("TAI", type_.to_string(), "Value");
+  assert_choice_type(types::tai, type_, "Value");
   return c.get<tai_s>();
 }
 const ue_security_cap_s& path_switch_request_ies_o::value_c::ue_security_cap() const
 {
-  assert_choice_type("UESecurityCapabilities", type_.to_string(), "Value");
+  assert_choice_type(types::ue_security_cap, type_, "Value");
   return c.get<ue_security_cap_s>();
 }
 const fixed_bitstring<27, false, true>& path_switch_request_ies_o::value_c::csg_id() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id, type_, "Value");
   return c.get<fixed_bitstring<27, false, true> >();
 }
 const cell_access_mode_e& path_switch_request_ies_o::value_c::cell_access_mode() const
 {
-  assert_choice_type("CellAccessMode", type_.to_string(), "Value");
+  assert_choice_type(types::cell_access_mode, type_, "Value");
   return c.get<cell_access_mode_e>();
 }
 const gummei_s& path_switch_request_ies_o::value_c::source_mme_gummei() const
 {
-  assert_choice_type("GUMMEI", type_.to_string(), "Value");
+  assert_choice_type(types::source_mme_gummei, type_, "Value");
   return c.get<gummei_s>();
 }
 const csg_membership_status_e& path_switch_request_ies_o::value_c::csg_membership_status() const
 {
-  assert_choice_type("CSGMembershipStatus", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_status, type_, "Value");
   return c.get<csg_membership_status_e>();
 }
 const tunnel_info_s& path_switch_request_ies_o::value_c::tunnel_info_for_bbf() const
 {
-  assert_choice_type("TunnelInformation", type_.to_string(), "Value");
+  assert_choice_type(types::tunnel_info_for_bbf, type_, "Value");
   return c.get<tunnel_info_s>();
 }
 const unbounded_octstring<true>& path_switch_request_ies_o::value_c::lhn_id() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lhn_id, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const rrc_establishment_cause_e& path_switch_request_ies_o::value_c::rrc_resume_cause() const
 {
-  assert_choice_type("RRC-Establishment-Cause", type_.to_string(), "Value");
+  assert_choice_type(types::rrc_resume_cause, type_, "Value");
   return c.get<rrc_establishment_cause_e>();
 }
 void path_switch_request_ies_o::value_c::destroy_()
@@ -39199,62 +39199,62 @@ presence_e reroute_nas_request_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint32_t& reroute_nas_request_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 uint64_t& reroute_nas_request_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 unbounded_octstring<true>& reroute_nas_request_ies_o::value_c::s1_msg()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::s1_msg, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 fixed_octstring<2, true>& reroute_nas_request_ies_o::value_c::mme_group_id()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::mme_group_id, type_, "Value");
   return c.get<fixed_octstring<2, true> >();
 }
 add_guti_s& reroute_nas_request_ies_o::value_c::add_guti()
 {
-  assert_choice_type("Additional-GUTI", type_.to_string(), "Value");
+  assert_choice_type(types::add_guti, type_, "Value");
   return c.get<add_guti_s>();
 }
 uint16_t& reroute_nas_request_ies_o::value_c::ue_usage_type()
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::ue_usage_type, type_, "Value");
   return c.get<uint16_t>();
 }
 const uint32_t& reroute_nas_request_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const uint64_t& reroute_nas_request_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const unbounded_octstring<true>& reroute_nas_request_ies_o::value_c::s1_msg() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::s1_msg, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const fixed_octstring<2, true>& reroute_nas_request_ies_o::value_c::mme_group_id() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::mme_group_id, type_, "Value");
   return c.get<fixed_octstring<2, true> >();
 }
 const add_guti_s& reroute_nas_request_ies_o::value_c::add_guti() const
 {
-  assert_choice_type("Additional-GUTI", type_.to_string(), "Value");
+  assert_choice_type(types::add_guti, type_, "Value");
   return c.get<add_guti_s>();
 }
 const uint16_t& reroute_nas_request_ies_o::value_c::ue_usage_type() const
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::ue_usage_type, type_, "Value");
   return c.get<uint16_t>();
 }
 void reroute_nas_request_ies_o::value_c::destroy_()
@@ -39516,22 +39516,22 @@ presence_e reset_ack_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 ue_associated_lc_s1_conn_list_res_ack_l& reset_ack_ies_o::value_c::ue_associated_lc_s1_conn_list_res_ack()
 {
-  assert_choice_type("UE-associatedLogicalS1-ConnectionListResAck", type_.to_string(), "Value");
+  assert_choice_type(types::ue_associated_lc_s1_conn_list_res_ack, type_, "Value");
   return c.get<ue_associated_lc_s1_conn_list_res_ack_l>();
 }
 crit_diagnostics_s& reset_ack_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const ue_associated_lc_s1_conn_list_res_ack_l& reset_ack_ies_o::value_c::ue_associated_lc_s1_conn_list_res_ack() const
 {
-  assert_choice_type("UE-associatedLogicalS1-ConnectionListResAck", type_.to_string(), "Value");
+  assert_choice_type(types::ue_associated_lc_s1_conn_list_res_ack, type_, "Value");
   return c.get<ue_associated_lc_s1_conn_list_res_ack_l>();
 }
 const crit_diagnostics_s& reset_ack_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void reset_ack_ies_o::value_c::destroy_()
@@ -39724,22 +39724,22 @@ presence_e reset_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 cause_c& reset_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 reset_type_c& reset_ies_o::value_c::reset_type()
 {
-  assert_choice_type("ResetType", type_.to_string(), "Value");
+  assert_choice_type(types::reset_type, type_, "Value");
   return c.get<reset_type_c>();
 }
 const cause_c& reset_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const reset_type_c& reset_ies_o::value_c::reset_type() const
 {
-  assert_choice_type("ResetType", type_.to_string(), "Value");
+  assert_choice_type(types::reset_type, type_, "Value");
   return c.get<reset_type_c>();
 }
 void reset_ies_o::value_c::destroy_()
@@ -39993,32 +39993,32 @@ presence_e s1_setup_fail_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 cause_c& s1_setup_fail_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 time_to_wait_e& s1_setup_fail_ies_o::value_c::time_to_wait()
 {
-  assert_choice_type("TimeToWait", type_.to_string(), "Value");
+  assert_choice_type(types::time_to_wait, type_, "Value");
   return c.get<time_to_wait_e>();
 }
 crit_diagnostics_s& s1_setup_fail_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const cause_c& s1_setup_fail_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const time_to_wait_e& s1_setup_fail_ies_o::value_c::time_to_wait() const
 {
-  assert_choice_type("TimeToWait", type_.to_string(), "Value");
+  assert_choice_type(types::time_to_wait, type_, "Value");
   return c.get<time_to_wait_e>();
 }
 const crit_diagnostics_s& s1_setup_fail_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void s1_setup_fail_ies_o::value_c::destroy_()
@@ -40255,72 +40255,72 @@ presence_e s1_setup_request_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 global_enb_id_s& s1_setup_request_ies_o::value_c::global_enb_id()
 {
-  assert_choice_type("Global-ENB-ID", type_.to_string(), "Value");
+  assert_choice_type(types::global_enb_id, type_, "Value");
   return c.get<global_enb_id_s>();
 }
 printable_string<1, 150, true, true>& s1_setup_request_ies_o::value_c::enbname()
 {
-  assert_choice_type("PrintableString", type_.to_string(), "Value");
+  assert_choice_type(types::enbname, type_, "Value");
   return c.get<printable_string<1, 150, true, true> >();
 }
 supported_tas_l& s1_setup_request_ies_o::value_c::supported_tas()
 {
-  assert_choice_type("SupportedTAs", type_.to_string(), "Value");
+  assert_choice_type(types::supported_tas, type_, "Value");
   return c.get<supported_tas_l>();
 }
 paging_drx_e& s1_setup_request_ies_o::value_c::default_paging_drx()
 {
-  assert_choice_type("PagingDRX", type_.to_string(), "Value");
+  assert_choice_type(types::default_paging_drx, type_, "Value");
   return c.get<paging_drx_e>();
 }
 csg_id_list_l& s1_setup_request_ies_o::value_c::csg_id_list()
 {
-  assert_choice_type("CSG-IdList", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id_list, type_, "Value");
   return c.get<csg_id_list_l>();
 }
 ue_retention_info_e& s1_setup_request_ies_o::value_c::ue_retention_info()
 {
-  assert_choice_type("UE-RetentionInformation", type_.to_string(), "Value");
+  assert_choice_type(types::ue_retention_info, type_, "Value");
   return c.get<ue_retention_info_e>();
 }
 nb_io_t_default_paging_drx_e& s1_setup_request_ies_o::value_c::nb_io_t_default_paging_drx()
 {
-  assert_choice_type("NB-IoT-DefaultPagingDRX", type_.to_string(), "Value");
+  assert_choice_type(types::nb_io_t_default_paging_drx, type_, "Value");
   return c.get<nb_io_t_default_paging_drx_e>();
 }
 const global_enb_id_s& s1_setup_request_ies_o::value_c::global_enb_id() const
 {
-  assert_choice_type("Global-ENB-ID", type_.to_string(), "Value");
+  assert_choice_type(types::global_enb_id, type_, "Value");
   return c.get<global_enb_id_s>();
 }
 const printable_string<1, 150, true, true>& s1_setup_request_ies_o::value_c::enbname() const
 {
-  assert_choice_type("PrintableString", type_.to_string(), "Value");
+  assert_choice_type(types::enbname, type_, "Value");
   return c.get<printable_string<1, 150, true, true> >();
 }
 const supported_tas_l& s1_setup_request_ies_o::value_c::supported_tas() const
 {
-  assert_choice_type("SupportedTAs", type_.to_string(), "Value");
+  assert_choice_type(types::supported_tas, type_, "Value");
   return c.get<supported_tas_l>();
 }
 const paging_drx_e& s1_setup_request_ies_o::value_c::default_paging_drx() const
 {
-  assert_choice_type("PagingDRX", type_.to_string(), "Value");
+  assert_choice_type(types::default_paging_drx, type_, "Value");
   return c.get<paging_drx_e>();
 }
 const csg_id_list_l& s1_setup_request_ies_o::value_c::csg_id_list() const
 {
-  assert_choice_type("CSG-IdList", type_.to_string(), "Value");
+  assert_choice_type(types::csg_id_list, type_, "Value");
   return c.get<csg_id_list_l>();
 }
 const ue_retention_info_e& s1_setup_request_ies_o::value_c::ue_retention_info() const
 {
-  assert_choice_type("UE-RetentionInformation", type_.to_string(), "Value");
+  assert_choice_type(types::ue_retention_info, type_, "Value");
   return c.get<ue_retention_info_e>();
 }
 const nb_io_t_default_paging_drx_e& s1_setup_request_ies_o::value_c::nb_io_t_default_paging_drx() const
 {
-  assert_choice_type("NB-IoT-DefaultPagingDRX", type_.to_string(), "Value");
+  assert_choice_type(types::nb_io_t_default_paging_drx, type_, "Value");
   return c.get<nb_io_t_default_paging_drx_e>();
 }
 void s1_setup_request_ies_o::value_c::destroy_()
@@ -40647,72 +40647,72 @@ presence_e s1_setup_resp_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 printable_string<1, 150, true, true>& s1_setup_resp_ies_o::value_c::mm_ename()
 {
-  assert_choice_type("PrintableString", type_.to_string(), "Value");
+  assert_choice_type(types::mm_ename, type_, "Value");
   return c.get<printable_string<1, 150, true, true> >();
 }
 served_gummeis_l& s1_setup_resp_ies_o::value_c::served_gummeis()
 {
-  assert_choice_type("ServedGUMMEIs", type_.to_string(), "Value");
+  assert_choice_type(types::served_gummeis, type_, "Value");
   return c.get<served_gummeis_l>();
 }
 uint16_t& s1_setup_resp_ies_o::value_c::relative_mme_capacity()
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::relative_mme_capacity, type_, "Value");
   return c.get<uint16_t>();
 }
 mme_relay_support_ind_e& s1_setup_resp_ies_o::value_c::mme_relay_support_ind()
 {
-  assert_choice_type("MMERelaySupportIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::mme_relay_support_ind, type_, "Value");
   return c.get<mme_relay_support_ind_e>();
 }
 crit_diagnostics_s& s1_setup_resp_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 ue_retention_info_e& s1_setup_resp_ies_o::value_c::ue_retention_info()
 {
-  assert_choice_type("UE-RetentionInformation", type_.to_string(), "Value");
+  assert_choice_type(types::ue_retention_info, type_, "Value");
   return c.get<ue_retention_info_e>();
 }
 served_dcns_l& s1_setup_resp_ies_o::value_c::served_dcns()
 {
-  assert_choice_type("ServedDCNs", type_.to_string(), "Value");
+  assert_choice_type(types::served_dcns, type_, "Value");
   return c.get<served_dcns_l>();
 }
 const printable_string<1, 150, true, true>& s1_setup_resp_ies_o::value_c::mm_ename() const
 {
-  assert_choice_type("PrintableString", type_.to_string(), "Value");
+  assert_choice_type(types::mm_ename, type_, "Value");
   return c.get<printable_string<1, 150, true, true> >();
 }
 const served_gummeis_l& s1_setup_resp_ies_o::value_c::served_gummeis() const
 {
-  assert_choice_type("ServedGUMMEIs", type_.to_string(), "Value");
+  assert_choice_type(types::served_gummeis, type_, "Value");
   return c.get<served_gummeis_l>();
 }
 const uint16_t& s1_setup_resp_ies_o::value_c::relative_mme_capacity() const
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::relative_mme_capacity, type_, "Value");
   return c.get<uint16_t>();
 }
 const mme_relay_support_ind_e& s1_setup_resp_ies_o::value_c::mme_relay_support_ind() const
 {
-  assert_choice_type("MMERelaySupportIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::mme_relay_support_ind, type_, "Value");
   return c.get<mme_relay_support_ind_e>();
 }
 const crit_diagnostics_s& s1_setup_resp_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const ue_retention_info_e& s1_setup_resp_ies_o::value_c::ue_retention_info() const
 {
-  assert_choice_type("UE-RetentionInformation", type_.to_string(), "Value");
+  assert_choice_type(types::ue_retention_info, type_, "Value");
   return c.get<ue_retention_info_e>();
 }
 const served_dcns_l& s1_setup_resp_ies_o::value_c::served_dcns() const
 {
-  assert_choice_type("ServedDCNs", type_.to_string(), "Value");
+  assert_choice_type(types::served_dcns, type_, "Value");
   return c.get<served_dcns_l>();
 }
 void s1_setup_resp_ies_o::value_c::destroy_()
@@ -41025,42 +41025,42 @@ presence_e trace_fail_ind_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& trace_fail_ind_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& trace_fail_ind_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 fixed_octstring<8, true>& trace_fail_ind_ies_o::value_c::e_utran_trace_id()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::e_utran_trace_id, type_, "Value");
   return c.get<fixed_octstring<8, true> >();
 }
 cause_c& trace_fail_ind_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const uint64_t& trace_fail_ind_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& trace_fail_ind_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const fixed_octstring<8, true>& trace_fail_ind_ies_o::value_c::e_utran_trace_id() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::e_utran_trace_id, type_, "Value");
   return c.get<fixed_octstring<8, true> >();
 }
 const cause_c& trace_fail_ind_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 void trace_fail_ind_ies_o::value_c::destroy_()
@@ -41285,32 +41285,32 @@ presence_e trace_start_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& trace_start_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& trace_start_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 trace_activation_s& trace_start_ies_o::value_c::trace_activation()
 {
-  assert_choice_type("TraceActivation", type_.to_string(), "Value");
+  assert_choice_type(types::trace_activation, type_, "Value");
   return c.get<trace_activation_s>();
 }
 const uint64_t& trace_start_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& trace_start_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const trace_activation_s& trace_start_ies_o::value_c::trace_activation() const
 {
-  assert_choice_type("TraceActivation", type_.to_string(), "Value");
+  assert_choice_type(types::trace_activation, type_, "Value");
   return c.get<trace_activation_s>();
 }
 void trace_start_ies_o::value_c::destroy_()
@@ -41521,42 +41521,42 @@ presence_e ue_cap_info_ind_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_cap_info_ind_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_cap_info_ind_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 unbounded_octstring<true>& ue_cap_info_ind_ies_o::value_c::ue_radio_cap()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 unbounded_octstring<true>& ue_cap_info_ind_ies_o::value_c::ue_radio_cap_for_paging()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap_for_paging, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const uint64_t& ue_cap_info_ind_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_cap_info_ind_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const unbounded_octstring<true>& ue_cap_info_ind_ies_o::value_c::ue_radio_cap() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const unbounded_octstring<true>& ue_cap_info_ind_ies_o::value_c::ue_radio_cap_for_paging() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap_for_paging, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 void ue_cap_info_ind_ies_o::value_c::destroy_()
@@ -41787,42 +41787,42 @@ presence_e ue_context_mod_confirm_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_context_mod_confirm_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_context_mod_confirm_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 csg_membership_status_e& ue_context_mod_confirm_ies_o::value_c::csg_membership_status()
 {
-  assert_choice_type("CSGMembershipStatus", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_status, type_, "Value");
   return c.get<csg_membership_status_e>();
 }
 crit_diagnostics_s& ue_context_mod_confirm_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& ue_context_mod_confirm_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_context_mod_confirm_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const csg_membership_status_e& ue_context_mod_confirm_ies_o::value_c::csg_membership_status() const
 {
-  assert_choice_type("CSGMembershipStatus", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_status, type_, "Value");
   return c.get<csg_membership_status_e>();
 }
 const crit_diagnostics_s& ue_context_mod_confirm_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void ue_context_mod_confirm_ies_o::value_c::destroy_()
@@ -42052,42 +42052,42 @@ presence_e ue_context_mod_fail_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_context_mod_fail_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_context_mod_fail_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 cause_c& ue_context_mod_fail_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 crit_diagnostics_s& ue_context_mod_fail_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& ue_context_mod_fail_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_context_mod_fail_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const cause_c& ue_context_mod_fail_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const crit_diagnostics_s& ue_context_mod_fail_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void ue_context_mod_fail_ies_o::value_c::destroy_()
@@ -42315,32 +42315,32 @@ presence_e ue_context_mod_ind_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_context_mod_ind_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_context_mod_ind_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 csg_membership_info_s& ue_context_mod_ind_ies_o::value_c::csg_membership_info()
 {
-  assert_choice_type("CSGMembershipInfo", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_info, type_, "Value");
   return c.get<csg_membership_info_s>();
 }
 const uint64_t& ue_context_mod_ind_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_context_mod_ind_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const csg_membership_info_s& ue_context_mod_ind_ies_o::value_c::csg_membership_info() const
 {
-  assert_choice_type("CSGMembershipInfo", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_info, type_, "Value");
   return c.get<csg_membership_info_s>();
 }
 void ue_context_mod_ind_ies_o::value_c::destroy_()
@@ -42629,153 +42629,153 @@ presence_e ue_context_mod_request_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_context_mod_request_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_context_mod_request_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 fixed_bitstring<256, false, true>& ue_context_mod_request_ies_o::value_c::security_key()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::security_key, type_, "Value");
   return c.get<fixed_bitstring<256, false, true> >();
 }
 uint16_t& ue_context_mod_request_ies_o::value_c::subscriber_profile_idfor_rfp()
 {
-  assert_choice_type("INTEGER (1..256)", type_.to_string(), "Value");
+  assert_choice_type(types::subscriber_profile_idfor_rfp, type_, "Value");
   return c.get<uint16_t>();
 }
 ue_aggregate_maximum_bitrate_s& ue_context_mod_request_ies_o::value_c::ueaggregate_maximum_bitrate()
 {
-  assert_choice_type("UEAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ueaggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_aggregate_maximum_bitrate_s>();
 }
 cs_fallback_ind_e& ue_context_mod_request_ies_o::value_c::cs_fallback_ind()
 {
-  assert_choice_type("CSFallbackIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::cs_fallback_ind, type_, "Value");
   return c.get<cs_fallback_ind_e>();
 }
 ue_security_cap_s& ue_context_mod_request_ies_o::value_c::ue_security_cap()
 {
-  assert_choice_type("UESecurityCapabilities", type_.to_string(), "Value");
+  assert_choice_type(types::ue_security_cap, type_, "Value");
   return c.get<ue_security_cap_s>();
 }
 csg_membership_status_e& ue_context_mod_request_ies_o::value_c::csg_membership_status()
 {
-  assert_choice_type("CSGMembershipStatus", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_status, type_, "Value");
   return c.get<csg_membership_status_e>();
 }
 lai_s& ue_context_mod_request_ies_o::value_c::registered_lai()
 {
-  assert_choice_type("LAI", type_.to_string(), "Value");
+  assert_choice_type(types::registered_lai, type_, "Value");
   return c.get<lai_s>();
 }
 add_cs_fallback_ind_e& ue_context_mod_request_ies_o::value_c::add_cs_fallback_ind()
 {
-  assert_choice_type("AdditionalCSFallbackIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::add_cs_fallback_ind, type_, "Value");
   return c.get<add_cs_fallback_ind_e>();
 }
 pro_se_authorized_s& ue_context_mod_request_ies_o::value_c::pro_se_authorized()
 {
-  assert_choice_type("ProSeAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::pro_se_authorized, type_, "Value");
   return c.get<pro_se_authorized_s>();
 }
 srvcc_operation_possible_e& ue_context_mod_request_ies_o::value_c::srvcc_operation_possible()
 {
-  assert_choice_type("SRVCCOperationPossible", type_.to_string(), "Value");
+  assert_choice_type(types::srvcc_operation_possible, type_, "Value");
   return c.get<srvcc_operation_possible_e>();
 }
 srvcc_operation_not_possible_e& ue_context_mod_request_ies_o::value_c::srvcc_operation_not_possible()
 {
-  assert_choice_type("SRVCCOperationNotPossible", type_.to_string(), "Value");
+  assert_choice_type(types::srvcc_operation_not_possible, type_, "Value");
   return c.get<srvcc_operation_not_possible_e>();
 }
 v2xservices_authorized_s& ue_context_mod_request_ies_o::value_c::v2xservices_authorized()
 {
-  assert_choice_type("V2XServicesAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::v2xservices_authorized, type_, "Value");
   return c.get<v2xservices_authorized_s>();
 }
 ue_sidelink_aggregate_maximum_bitrate_s& ue_context_mod_request_ies_o::value_c::ue_sidelink_aggregate_maximum_bitrate()
 {
-  assert_choice_type("UESidelinkAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ue_sidelink_aggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_sidelink_aggregate_maximum_bitrate_s>();
 }
 const uint64_t& ue_context_mod_request_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_context_mod_request_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const fixed_bitstring<256, false, true>& ue_context_mod_request_ies_o::value_c::security_key() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::security_key, type_, "Value");
   return c.get<fixed_bitstring<256, false, true> >();
 }
 const uint16_t& ue_context_mod_request_ies_o::value_c::subscriber_profile_idfor_rfp() const
 {
-  assert_choice_type("INTEGER (1..256)", type_.to_string(), "Value");
+  assert_choice_type(types::subscriber_profile_idfor_rfp, type_, "Value");
   return c.get<uint16_t>();
 }
 const ue_aggregate_maximum_bitrate_s& ue_context_mod_request_ies_o::value_c::ueaggregate_maximum_bitrate() const
 {
-  assert_choice_type("UEAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ueaggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_aggregate_maximum_bitrate_s>();
 }
 const cs_fallback_ind_e& ue_context_mod_request_ies_o::value_c::cs_fallback_ind() const
 {
-  assert_choice_type("CSFallbackIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::cs_fallback_ind, type_, "Value");
   return c.get<cs_fallback_ind_e>();
 }
 const ue_security_cap_s& ue_context_mod_request_ies_o::value_c::ue_security_cap() const
 {
-  assert_choice_type("UESecurityCapabilities", type_.to_string(), "Value");
+  assert_choice_type(types::ue_security_cap, type_, "Value");
   return c.get<ue_security_cap_s>();
 }
 const csg_membership_status_e& ue_context_mod_request_ies_o::value_c::csg_membership_status() const
 {
-  assert_choice_type("CSGMembershipStatus", type_.to_string(), "Value");
+  assert_choice_type(types::csg_membership_status, type_, "Value");
   return c.get<csg_membership_status_e>();
 }
 const lai_s& ue_context_mod_request_ies_o::value_c::registered_lai() const
 {
-  assert_choice_type("LAI", type_.to_string(), "Value");
+  assert_choice_type(types::registered_lai, type_, "Value");
   return c.get<lai_s>();
 }
 const add_cs_fallback_ind_e& ue_context_mod_request_ies_o::value_c::add_cs_fallback_ind() const
 {
-  assert_choice_type("AdditionalCSFallbackIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::add_cs_fallback_ind, type_, "Value");
   return c.get<add_cs_fallback_ind_e>();
 }
 const pro_se_authorized_s& ue_context_mod_request_ies_o::value_c::pro_se_authorized() const
 {
-  assert_choice_type("ProSeAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::pro_se_authorized, type_, "Value");
   return c.get<pro_se_authorized_s>();
 }
 const srvcc_operation_possible_e& ue_context_mod_request_ies_o::value_c::srvcc_operation_possible() const
 {
-  assert_choice_type("SRVCCOperationPossible", type_.to_string(), "Value");
+  assert_choice_type(types::srvcc_operation_possible, type_, "Value");
   return c.get<srvcc_operation_possible_e>();
 }
 const srvcc_operation_not_possible_e& ue_context_mod_request_ies_o::value_c::srvcc_operation_not_possible() const
 {
-  assert_choice_type("SRVCCOperationNotPossible", type_.to_string(), "Value");
+  assert_choice_type(types::srvcc_operation_not_possible, type_, "Value");
   return c.get<srvcc_operation_not_possible_e>();
 }
 const v2xservices_authorized_s& ue_context_mod_request_ies_o::value_c::v2xservices_authorized() const
 {
-  assert_choice_type("V2XServicesAuthorized", type_.to_string(), "Value");
+  assert_choice_type(types::v2xservices_authorized, type_, "Value");
   return c.get<v2xservices_authorized_s>();
 }
 const ue_sidelink_aggregate_maximum_bitrate_s&
 ue_context_mod_request_ies_o::value_c::ue_sidelink_aggregate_maximum_bitrate() const
 {
-  assert_choice_type("UESidelinkAggregateMaximumBitrate", type_.to_string(), "Value");
+  assert_choice_type(types::ue_sidelink_aggregate_maximum_bitrate, type_, "Value");
   return c.get<ue_sidelink_aggregate_maximum_bitrate_s>();
 }
 void ue_context_mod_request_ies_o::value_c::destroy_()
@@ -43227,32 +43227,32 @@ presence_e ue_context_mod_resp_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_context_mod_resp_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_context_mod_resp_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 crit_diagnostics_s& ue_context_mod_resp_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& ue_context_mod_resp_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_context_mod_resp_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const crit_diagnostics_s& ue_context_mod_resp_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void ue_context_mod_resp_ies_o::value_c::destroy_()
@@ -43450,22 +43450,22 @@ presence_e ue_context_release_cmd_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 ue_s1ap_ids_c& ue_context_release_cmd_ies_o::value_c::ue_s1ap_ids()
 {
-  assert_choice_type("UE-S1AP-IDs", type_.to_string(), "Value");
+  assert_choice_type(types::ue_s1ap_ids, type_, "Value");
   return c.get<ue_s1ap_ids_c>();
 }
 cause_c& ue_context_release_cmd_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const ue_s1ap_ids_c& ue_context_release_cmd_ies_o::value_c::ue_s1ap_ids() const
 {
-  assert_choice_type("UE-S1AP-IDs", type_.to_string(), "Value");
+  assert_choice_type(types::ue_s1ap_ids, type_, "Value");
   return c.get<ue_s1ap_ids_c>();
 }
 const cause_c& ue_context_release_cmd_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 void ue_context_release_cmd_ies_o::value_c::destroy_()
@@ -43684,66 +43684,66 @@ presence_e ue_context_release_complete_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_context_release_complete_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_context_release_complete_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 crit_diagnostics_s& ue_context_release_complete_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 user_location_info_s& ue_context_release_complete_ies_o::value_c::user_location_info()
 {
-  assert_choice_type("UserLocationInformation", type_.to_string(), "Value");
+  assert_choice_type(types::user_location_info, type_, "Value");
   return c.get<user_location_info_s>();
 }
 info_on_recommended_cells_and_enbs_for_paging_s&
 ue_context_release_complete_ies_o::value_c::info_on_recommended_cells_and_enbs_for_paging()
 {
-  assert_choice_type("InformationOnRecommendedCellsAndENBsForPaging", type_.to_string(), "Value");
+  assert_choice_type(types::info_on_recommended_cells_and_enbs_for_paging, type_, "Value");
   return c.get<info_on_recommended_cells_and_enbs_for_paging_s>();
 }
 cell_id_and_ce_level_for_ce_capable_ues_s&
 ue_context_release_complete_ies_o::value_c::cell_id_and_ce_level_for_ce_capable_ues()
 {
-  assert_choice_type("CellIdentifierAndCELevelForCECapableUEs", type_.to_string(), "Value");
+  assert_choice_type(types::cell_id_and_ce_level_for_ce_capable_ues, type_, "Value");
   return c.get<cell_id_and_ce_level_for_ce_capable_ues_s>();
 }
 const uint64_t& ue_context_release_complete_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_context_release_complete_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const crit_diagnostics_s& ue_context_release_complete_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const user_location_info_s& ue_context_release_complete_ies_o::value_c::user_location_info() const
 {
-  assert_choice_type("UserLocationInformation", type_.to_string(), "Value");
+  assert_choice_type(types::user_location_info, type_, "Value");
   return c.get<user_location_info_s>();
 }
 const info_on_recommended_cells_and_enbs_for_paging_s&
 ue_context_release_complete_ies_o::value_c::info_on_recommended_cells_and_enbs_for_paging() const
 {
-  assert_choice_type("InformationOnRecommendedCellsAndENBsForPaging", type_.to_string(), "Value");
+  assert_choice_type(types::info_on_recommended_cells_and_enbs_for_paging, type_, "Value");
   return c.get<info_on_recommended_cells_and_enbs_for_paging_s>();
 }
 const cell_id_and_ce_level_for_ce_capable_ues_s&
 ue_context_release_complete_ies_o::value_c::cell_id_and_ce_level_for_ce_capable_ues() const
 {
-  assert_choice_type("CellIdentifierAndCELevelForCECapableUEs", type_.to_string(), "Value");
+  assert_choice_type(types::cell_id_and_ce_level_for_ce_capable_ues, type_, "Value");
   return c.get<cell_id_and_ce_level_for_ce_capable_ues_s>();
 }
 void ue_context_release_complete_ies_o::value_c::destroy_()
@@ -44026,42 +44026,42 @@ presence_e ue_context_release_request_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_context_release_request_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_context_release_request_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 cause_c& ue_context_release_request_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 gw_context_release_ind_e& ue_context_release_request_ies_o::value_c::gw_context_release_ind()
 {
-  assert_choice_type("GWContextReleaseIndication", type_.to_string(), "Value");
+  assert_choice_type(types::gw_context_release_ind, type_, "Value");
   return c.get<gw_context_release_ind_e>();
 }
 const uint64_t& ue_context_release_request_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_context_release_request_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const cause_c& ue_context_release_request_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const gw_context_release_ind_e& ue_context_release_request_ies_o::value_c::gw_context_release_ind() const
 {
-  assert_choice_type("GWContextReleaseIndication", type_.to_string(), "Value");
+  assert_choice_type(types::gw_context_release_ind, type_, "Value");
   return c.get<gw_context_release_ind_e>();
 }
 void ue_context_release_request_ies_o::value_c::destroy_()
@@ -44291,42 +44291,42 @@ presence_e ue_context_resume_fail_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_context_resume_fail_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_context_resume_fail_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 cause_c& ue_context_resume_fail_ies_o::value_c::cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 crit_diagnostics_s& ue_context_resume_fail_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& ue_context_resume_fail_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_context_resume_fail_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const cause_c& ue_context_resume_fail_ies_o::value_c::cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Value");
+  assert_choice_type(types::cause, type_, "Value");
   return c.get<cause_c>();
 }
 const crit_diagnostics_s& ue_context_resume_fail_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void ue_context_resume_fail_ies_o::value_c::destroy_()
@@ -44561,44 +44561,44 @@ presence_e ue_context_resume_request_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_context_resume_request_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_context_resume_request_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 erab_ie_container_list_l<erab_failed_to_resume_item_resume_req_ies_o>&
 ue_context_resume_request_ies_o::value_c::erab_failed_to_resume_list_resume_req()
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABFailedToResumeItemResumeReqIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_resume_list_resume_req, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_failed_to_resume_item_resume_req_ies_o> >();
 }
 rrc_establishment_cause_e& ue_context_resume_request_ies_o::value_c::rrc_resume_cause()
 {
-  assert_choice_type("RRC-Establishment-Cause", type_.to_string(), "Value");
+  assert_choice_type(types::rrc_resume_cause, type_, "Value");
   return c.get<rrc_establishment_cause_e>();
 }
 const uint64_t& ue_context_resume_request_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_context_resume_request_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const erab_ie_container_list_l<erab_failed_to_resume_item_resume_req_ies_o>&
 ue_context_resume_request_ies_o::value_c::erab_failed_to_resume_list_resume_req() const
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABFailedToResumeItemResumeReqIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_resume_list_resume_req, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_failed_to_resume_item_resume_req_ies_o> >();
 }
 const rrc_establishment_cause_e& ue_context_resume_request_ies_o::value_c::rrc_resume_cause() const
 {
-  assert_choice_type("RRC-Establishment-Cause", type_.to_string(), "Value");
+  assert_choice_type(types::rrc_resume_cause, type_, "Value");
   return c.get<rrc_establishment_cause_e>();
 }
 void ue_context_resume_request_ies_o::value_c::destroy_()
@@ -44845,64 +44845,64 @@ presence_e ue_context_resume_resp_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_context_resume_resp_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_context_resume_resp_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 erab_ie_container_list_l<erab_failed_to_resume_item_resume_res_ies_o>&
 ue_context_resume_resp_ies_o::value_c::erab_failed_to_resume_list_resume_res()
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABFailedToResumeItemResumeResIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_resume_list_resume_res, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_failed_to_resume_item_resume_res_ies_o> >();
 }
 crit_diagnostics_s& ue_context_resume_resp_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 security_context_s& ue_context_resume_resp_ies_o::value_c::security_context()
 {
-  assert_choice_type("SecurityContext", type_.to_string(), "Value");
+  assert_choice_type(types::security_context, type_, "Value");
   return c.get<security_context_s>();
 }
 pending_data_ind_e& ue_context_resume_resp_ies_o::value_c::pending_data_ind()
 {
-  assert_choice_type("PendingDataIndication", type_.to_string(), "Value");
+  assert_choice_type(types::pending_data_ind, type_, "Value");
   return c.get<pending_data_ind_e>();
 }
 const uint64_t& ue_context_resume_resp_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_context_resume_resp_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const erab_ie_container_list_l<erab_failed_to_resume_item_resume_res_ies_o>&
 ue_context_resume_resp_ies_o::value_c::erab_failed_to_resume_list_resume_res() const
 {
-  assert_choice_type("E-RAB-IE-ContainerList{{E-RABFailedToResumeItemResumeResIEs}}", type_.to_string(), "Value");
+  assert_choice_type(types::erab_failed_to_resume_list_resume_res, type_, "Value");
   return c.get<erab_ie_container_list_l<erab_failed_to_resume_item_resume_res_ies_o> >();
 }
 const crit_diagnostics_s& ue_context_resume_resp_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const security_context_s& ue_context_resume_resp_ies_o::value_c::security_context() const
 {
-  assert_choice_type("SecurityContext", type_.to_string(), "Value");
+  assert_choice_type(types::security_context, type_, "Value");
   return c.get<security_context_s>();
 }
 const pending_data_ind_e& ue_context_resume_resp_ies_o::value_c::pending_data_ind() const
 {
-  assert_choice_type("PendingDataIndication", type_.to_string(), "Value");
+  assert_choice_type(types::pending_data_ind, type_, "Value");
   return c.get<pending_data_ind_e>();
 }
 void ue_context_resume_resp_ies_o::value_c::destroy_()
@@ -45181,46 +45181,46 @@ presence_e ue_context_suspend_request_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_context_suspend_request_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_context_suspend_request_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 info_on_recommended_cells_and_enbs_for_paging_s&
 ue_context_suspend_request_ies_o::value_c::info_on_recommended_cells_and_enbs_for_paging()
 {
-  assert_choice_type("InformationOnRecommendedCellsAndENBsForPaging", type_.to_string(), "Value");
+  assert_choice_type(types::info_on_recommended_cells_and_enbs_for_paging, type_, "Value");
   return c.get<info_on_recommended_cells_and_enbs_for_paging_s>();
 }
 cell_id_and_ce_level_for_ce_capable_ues_s&
 ue_context_suspend_request_ies_o::value_c::cell_id_and_ce_level_for_ce_capable_ues()
 {
-  assert_choice_type("CellIdentifierAndCELevelForCECapableUEs", type_.to_string(), "Value");
+  assert_choice_type(types::cell_id_and_ce_level_for_ce_capable_ues, type_, "Value");
   return c.get<cell_id_and_ce_level_for_ce_capable_ues_s>();
 }
 const uint64_t& ue_context_suspend_request_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_context_suspend_request_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const info_on_recommended_cells_and_enbs_for_paging_s&
 ue_context_suspend_request_ies_o::value_c::info_on_recommended_cells_and_enbs_for_paging() const
 {
-  assert_choice_type("InformationOnRecommendedCellsAndENBsForPaging", type_.to_string(), "Value");
+  assert_choice_type(types::info_on_recommended_cells_and_enbs_for_paging, type_, "Value");
   return c.get<info_on_recommended_cells_and_enbs_for_paging_s>();
 }
 const cell_id_and_ce_level_for_ce_capable_ues_s&
 ue_context_suspend_request_ies_o::value_c::cell_id_and_ce_level_for_ce_capable_ues() const
 {
-  assert_choice_type("CellIdentifierAndCELevelForCECapableUEs", type_.to_string(), "Value");
+  assert_choice_type(types::cell_id_and_ce_level_for_ce_capable_ues, type_, "Value");
   return c.get<cell_id_and_ce_level_for_ce_capable_ues_s>();
 }
 void ue_context_suspend_request_ies_o::value_c::destroy_()
@@ -45457,42 +45457,42 @@ presence_e ue_context_suspend_resp_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_context_suspend_resp_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_context_suspend_resp_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 crit_diagnostics_s& ue_context_suspend_resp_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 security_context_s& ue_context_suspend_resp_ies_o::value_c::security_context()
 {
-  assert_choice_type("SecurityContext", type_.to_string(), "Value");
+  assert_choice_type(types::security_context, type_, "Value");
   return c.get<security_context_s>();
 }
 const uint64_t& ue_context_suspend_resp_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_context_suspend_resp_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const crit_diagnostics_s& ue_context_suspend_resp_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const security_context_s& ue_context_suspend_resp_ies_o::value_c::security_context() const
 {
-  assert_choice_type("SecurityContext", type_.to_string(), "Value");
+  assert_choice_type(types::security_context, type_, "Value");
   return c.get<security_context_s>();
 }
 void ue_context_suspend_resp_ies_o::value_c::destroy_()
@@ -45727,42 +45727,42 @@ presence_e ue_info_transfer_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 s_tmsi_s& ue_info_transfer_ies_o::value_c::s_tmsi()
 {
-  assert_choice_type("S-TMSI", type_.to_string(), "Value");
+  assert_choice_type(types::s_tmsi, type_, "Value");
   return c.get<s_tmsi_s>();
 }
 erab_level_qos_params_s& ue_info_transfer_ies_o::value_c::ue_level_qos_params()
 {
-  assert_choice_type("E-RABLevelQoSParameters", type_.to_string(), "Value");
+  assert_choice_type(types::ue_level_qos_params, type_, "Value");
   return c.get<erab_level_qos_params_s>();
 }
 unbounded_octstring<true>& ue_info_transfer_ies_o::value_c::ue_radio_cap()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 pending_data_ind_e& ue_info_transfer_ies_o::value_c::pending_data_ind()
 {
-  assert_choice_type("PendingDataIndication", type_.to_string(), "Value");
+  assert_choice_type(types::pending_data_ind, type_, "Value");
   return c.get<pending_data_ind_e>();
 }
 const s_tmsi_s& ue_info_transfer_ies_o::value_c::s_tmsi() const
 {
-  assert_choice_type("S-TMSI", type_.to_string(), "Value");
+  assert_choice_type(types::s_tmsi, type_, "Value");
   return c.get<s_tmsi_s>();
 }
 const erab_level_qos_params_s& ue_info_transfer_ies_o::value_c::ue_level_qos_params() const
 {
-  assert_choice_type("E-RABLevelQoSParameters", type_.to_string(), "Value");
+  assert_choice_type(types::ue_level_qos_params, type_, "Value");
   return c.get<erab_level_qos_params_s>();
 }
 const unbounded_octstring<true>& ue_info_transfer_ies_o::value_c::ue_radio_cap() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const pending_data_ind_e& ue_info_transfer_ies_o::value_c::pending_data_ind() const
 {
-  assert_choice_type("PendingDataIndication", type_.to_string(), "Value");
+  assert_choice_type(types::pending_data_ind, type_, "Value");
   return c.get<pending_data_ind_e>();
 }
 void ue_info_transfer_ies_o::value_c::destroy_()
@@ -45993,32 +45993,32 @@ presence_e ue_radio_cap_match_request_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_radio_cap_match_request_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_radio_cap_match_request_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 unbounded_octstring<true>& ue_radio_cap_match_request_ies_o::value_c::ue_radio_cap()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const uint64_t& ue_radio_cap_match_request_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_radio_cap_match_request_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const unbounded_octstring<true>& ue_radio_cap_match_request_ies_o::value_c::ue_radio_cap() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::ue_radio_cap, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 void ue_radio_cap_match_request_ies_o::value_c::destroy_()
@@ -46229,42 +46229,42 @@ presence_e ue_radio_cap_match_resp_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ue_radio_cap_match_resp_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ue_radio_cap_match_resp_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 voice_support_match_ind_e& ue_radio_cap_match_resp_ies_o::value_c::voice_support_match_ind()
 {
-  assert_choice_type("VoiceSupportMatchIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::voice_support_match_ind, type_, "Value");
   return c.get<voice_support_match_ind_e>();
 }
 crit_diagnostics_s& ue_radio_cap_match_resp_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const uint64_t& ue_radio_cap_match_resp_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ue_radio_cap_match_resp_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const voice_support_match_ind_e& ue_radio_cap_match_resp_ies_o::value_c::voice_support_match_ind() const
 {
-  assert_choice_type("VoiceSupportMatchIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::voice_support_match_ind, type_, "Value");
   return c.get<voice_support_match_ind_e>();
 }
 const crit_diagnostics_s& ue_radio_cap_match_resp_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void ue_radio_cap_match_resp_ies_o::value_c::destroy_()
@@ -46522,82 +46522,82 @@ presence_e ul_nas_transport_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ul_nas_transport_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ul_nas_transport_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 unbounded_octstring<true>& ul_nas_transport_ies_o::value_c::nas_pdu()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nas_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 eutran_cgi_s& ul_nas_transport_ies_o::value_c::eutran_cgi()
 {
-  assert_choice_type("EUTRAN-CGI", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_cgi, type_, "Value");
   return c.get<eutran_cgi_s>();
 }
 tai_s& ul_nas_transport_ies_o::value_c::tai()
 {
-  assert_choice_type("TAI", type_.to_string(), "Value");
+  assert_choice_type(types::tai, type_, "Value");
   return c.get<tai_s>();
 }
 bounded_bitstring<1, 160, true, true>& ul_nas_transport_ies_o::value_c::gw_transport_layer_address()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::gw_transport_layer_address, type_, "Value");
   return c.get<bounded_bitstring<1, 160, true, true> >();
 }
 bounded_bitstring<1, 160, true, true>& ul_nas_transport_ies_o::value_c::sipto_l_gw_transport_layer_address()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::sipto_l_gw_transport_layer_address, type_, "Value");
   return c.get<bounded_bitstring<1, 160, true, true> >();
 }
 unbounded_octstring<true>& ul_nas_transport_ies_o::value_c::lhn_id()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lhn_id, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const uint64_t& ul_nas_transport_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ul_nas_transport_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const unbounded_octstring<true>& ul_nas_transport_ies_o::value_c::nas_pdu() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::nas_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const eutran_cgi_s& ul_nas_transport_ies_o::value_c::eutran_cgi() const
 {
-  assert_choice_type("EUTRAN-CGI", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_cgi, type_, "Value");
   return c.get<eutran_cgi_s>();
 }
 const tai_s& ul_nas_transport_ies_o::value_c::tai() const
 {
-  assert_choice_type("TAI", type_.to_string(), "Value");
+  assert_choice_type(types::tai, type_, "Value");
   return c.get<tai_s>();
 }
 const bounded_bitstring<1, 160, true, true>& ul_nas_transport_ies_o::value_c::gw_transport_layer_address() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::gw_transport_layer_address, type_, "Value");
   return c.get<bounded_bitstring<1, 160, true, true> >();
 }
 const bounded_bitstring<1, 160, true, true>& ul_nas_transport_ies_o::value_c::sipto_l_gw_transport_layer_address() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::sipto_l_gw_transport_layer_address, type_, "Value");
   return c.get<bounded_bitstring<1, 160, true, true> >();
 }
 const unbounded_octstring<true>& ul_nas_transport_ies_o::value_c::lhn_id() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lhn_id, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 void ul_nas_transport_ies_o::value_c::destroy_()
@@ -46909,22 +46909,22 @@ presence_e ul_non_ueassociated_lp_pa_transport_ies_o::get_presence(const uint32_
 // Value ::= OPEN TYPE
 uint16_t& ul_non_ueassociated_lp_pa_transport_ies_o::value_c::routing_id()
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::routing_id, type_, "Value");
   return c.get<uint16_t>();
 }
 unbounded_octstring<true>& ul_non_ueassociated_lp_pa_transport_ies_o::value_c::lp_pa_pdu()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lp_pa_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const uint16_t& ul_non_ueassociated_lp_pa_transport_ies_o::value_c::routing_id() const
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::routing_id, type_, "Value");
   return c.get<uint16_t>();
 }
 const unbounded_octstring<true>& ul_non_ueassociated_lp_pa_transport_ies_o::value_c::lp_pa_pdu() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lp_pa_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 void ul_non_ueassociated_lp_pa_transport_ies_o::value_c::destroy_()
@@ -47159,92 +47159,92 @@ presence_e ul_s1cdma2000tunnelling_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 uint64_t& ul_s1cdma2000tunnelling_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ul_s1cdma2000tunnelling_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 cdma2000_rat_type_e& ul_s1cdma2000tunnelling_ies_o::value_c::cdma2000_rat_type()
 {
-  assert_choice_type("Cdma2000RATType", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_rat_type, type_, "Value");
   return c.get<cdma2000_rat_type_e>();
 }
 unbounded_octstring<true>& ul_s1cdma2000tunnelling_ies_o::value_c::cdma2000_sector_id()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_sector_id, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 cdma2000_ho_required_ind_e& ul_s1cdma2000tunnelling_ies_o::value_c::cdma2000_ho_required_ind()
 {
-  assert_choice_type("Cdma2000HORequiredIndication", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_ho_required_ind, type_, "Value");
   return c.get<cdma2000_ho_required_ind_e>();
 }
 cdma2000_one_xsrvcc_info_s& ul_s1cdma2000tunnelling_ies_o::value_c::cdma2000_one_xsrvcc_info()
 {
-  assert_choice_type("Cdma2000OneXSRVCCInfo", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_one_xsrvcc_info, type_, "Value");
   return c.get<cdma2000_one_xsrvcc_info_s>();
 }
 unbounded_octstring<true>& ul_s1cdma2000tunnelling_ies_o::value_c::cdma2000_one_xrand()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_one_xrand, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 unbounded_octstring<true>& ul_s1cdma2000tunnelling_ies_o::value_c::cdma2000_pdu()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 uint16_t& ul_s1cdma2000tunnelling_ies_o::value_c::eutran_round_trip_delay_estimation_info()
 {
-  assert_choice_type("INTEGER (0..2047)", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_round_trip_delay_estimation_info, type_, "Value");
   return c.get<uint16_t>();
 }
 const uint64_t& ul_s1cdma2000tunnelling_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ul_s1cdma2000tunnelling_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const cdma2000_rat_type_e& ul_s1cdma2000tunnelling_ies_o::value_c::cdma2000_rat_type() const
 {
-  assert_choice_type("Cdma2000RATType", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_rat_type, type_, "Value");
   return c.get<cdma2000_rat_type_e>();
 }
 const unbounded_octstring<true>& ul_s1cdma2000tunnelling_ies_o::value_c::cdma2000_sector_id() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_sector_id, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const cdma2000_ho_required_ind_e& ul_s1cdma2000tunnelling_ies_o::value_c::cdma2000_ho_required_ind() const
 {
-  assert_choice_type("Cdma2000HORequiredIndication", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_ho_required_ind, type_, "Value");
   return c.get<cdma2000_ho_required_ind_e>();
 }
 const cdma2000_one_xsrvcc_info_s& ul_s1cdma2000tunnelling_ies_o::value_c::cdma2000_one_xsrvcc_info() const
 {
-  assert_choice_type("Cdma2000OneXSRVCCInfo", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_one_xsrvcc_info, type_, "Value");
   return c.get<cdma2000_one_xsrvcc_info_s>();
 }
 const unbounded_octstring<true>& ul_s1cdma2000tunnelling_ies_o::value_c::cdma2000_one_xrand() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_one_xrand, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const unbounded_octstring<true>& ul_s1cdma2000tunnelling_ies_o::value_c::cdma2000_pdu() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::cdma2000_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const uint16_t& ul_s1cdma2000tunnelling_ies_o::value_c::eutran_round_trip_delay_estimation_info() const
 {
-  assert_choice_type("INTEGER (0..2047)", type_.to_string(), "Value");
+  assert_choice_type(types::eutran_round_trip_delay_estimation_info, type_, "Value");
   return c.get<uint16_t>();
 }
 void ul_s1cdma2000tunnelling_ies_o::value_c::destroy_()
@@ -47578,42 +47578,42 @@ presence_e ul_ueassociated_lp_pa_transport_ies_o::get_presence(const uint32_t& i
 // Value ::= OPEN TYPE
 uint64_t& ul_ueassociated_lp_pa_transport_ies_o::value_c::mme_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 uint32_t& ul_ueassociated_lp_pa_transport_ies_o::value_c::enb_ue_s1ap_id()
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 uint16_t& ul_ueassociated_lp_pa_transport_ies_o::value_c::routing_id()
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::routing_id, type_, "Value");
   return c.get<uint16_t>();
 }
 unbounded_octstring<true>& ul_ueassociated_lp_pa_transport_ies_o::value_c::lp_pa_pdu()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lp_pa_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const uint64_t& ul_ueassociated_lp_pa_transport_ies_o::value_c::mme_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..4294967295)", type_.to_string(), "Value");
+  assert_choice_type(types::mme_ue_s1ap_id, type_, "Value");
   return c.get<uint64_t>();
 }
 const uint32_t& ul_ueassociated_lp_pa_transport_ies_o::value_c::enb_ue_s1ap_id() const
 {
-  assert_choice_type("INTEGER (0..16777215)", type_.to_string(), "Value");
+  assert_choice_type(types::enb_ue_s1ap_id, type_, "Value");
   return c.get<uint32_t>();
 }
 const uint16_t& ul_ueassociated_lp_pa_transport_ies_o::value_c::routing_id() const
 {
-  assert_choice_type("INTEGER (0..255)", type_.to_string(), "Value");
+  assert_choice_type(types::routing_id, type_, "Value");
   return c.get<uint16_t>();
 }
 const unbounded_octstring<true>& ul_ueassociated_lp_pa_transport_ies_o::value_c::lp_pa_pdu() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::lp_pa_pdu, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 void ul_ueassociated_lp_pa_transport_ies_o::value_c::destroy_()
@@ -47891,112 +47891,112 @@ presence_e write_replace_warning_request_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 fixed_bitstring<16, false, true>& write_replace_warning_request_ies_o::value_c::msg_id()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::msg_id, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 fixed_bitstring<16, false, true>& write_replace_warning_request_ies_o::value_c::serial_num()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::serial_num, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 warning_area_list_c& write_replace_warning_request_ies_o::value_c::warning_area_list()
 {
-  assert_choice_type("WarningAreaList", type_.to_string(), "Value");
+  assert_choice_type(types::warning_area_list, type_, "Value");
   return c.get<warning_area_list_c>();
 }
 uint16_t& write_replace_warning_request_ies_o::value_c::repeat_period()
 {
-  assert_choice_type("INTEGER (0..4095)", type_.to_string(), "Value");
+  assert_choice_type(types::repeat_period, type_, "Value");
   return c.get<uint16_t>();
 }
 uint32_t& write_replace_warning_request_ies_o::value_c::extended_repeat_period()
 {
-  assert_choice_type("INTEGER (4096..131071)", type_.to_string(), "Value");
+  assert_choice_type(types::extended_repeat_period, type_, "Value");
   return c.get<uint32_t>();
 }
 uint32_t& write_replace_warning_request_ies_o::value_c::numof_broadcast_request()
 {
-  assert_choice_type("INTEGER (0..65535)", type_.to_string(), "Value");
+  assert_choice_type(types::numof_broadcast_request, type_, "Value");
   return c.get<uint32_t>();
 }
 fixed_octstring<2, true>& write_replace_warning_request_ies_o::value_c::warning_type()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::warning_type, type_, "Value");
   return c.get<fixed_octstring<2, true> >();
 }
 fixed_octstring<50, true>& write_replace_warning_request_ies_o::value_c::warning_security_info()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::warning_security_info, type_, "Value");
   return c.get<fixed_octstring<50, true> >();
 }
 fixed_bitstring<8, false, true>& write_replace_warning_request_ies_o::value_c::data_coding_scheme()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::data_coding_scheme, type_, "Value");
   return c.get<fixed_bitstring<8, false, true> >();
 }
 unbounded_octstring<true>& write_replace_warning_request_ies_o::value_c::warning_msg_contents()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::warning_msg_contents, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 concurrent_warning_msg_ind_e& write_replace_warning_request_ies_o::value_c::concurrent_warning_msg_ind()
 {
-  assert_choice_type("ConcurrentWarningMessageIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::concurrent_warning_msg_ind, type_, "Value");
   return c.get<concurrent_warning_msg_ind_e>();
 }
 const fixed_bitstring<16, false, true>& write_replace_warning_request_ies_o::value_c::msg_id() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::msg_id, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 const fixed_bitstring<16, false, true>& write_replace_warning_request_ies_o::value_c::serial_num() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::serial_num, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 const warning_area_list_c& write_replace_warning_request_ies_o::value_c::warning_area_list() const
 {
-  assert_choice_type("WarningAreaList", type_.to_string(), "Value");
+  assert_choice_type(types::warning_area_list, type_, "Value");
   return c.get<warning_area_list_c>();
 }
 const uint16_t& write_replace_warning_request_ies_o::value_c::repeat_period() const
 {
-  assert_choice_type("INTEGER (0..4095)", type_.to_string(), "Value");
+  assert_choice_type(types::repeat_period, type_, "Value");
   return c.get<uint16_t>();
 }
 const uint32_t& write_replace_warning_request_ies_o::value_c::extended_repeat_period() const
 {
-  assert_choice_type("INTEGER (4096..131071)", type_.to_string(), "Value");
+  assert_choice_type(types::extended_repeat_period, type_, "Value");
   return c.get<uint32_t>();
 }
 const uint32_t& write_replace_warning_request_ies_o::value_c::numof_broadcast_request() const
 {
-  assert_choice_type("INTEGER (0..65535)", type_.to_string(), "Value");
+  assert_choice_type(types::numof_broadcast_request, type_, "Value");
   return c.get<uint32_t>();
 }
 const fixed_octstring<2, true>& write_replace_warning_request_ies_o::value_c::warning_type() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::warning_type, type_, "Value");
   return c.get<fixed_octstring<2, true> >();
 }
 const fixed_octstring<50, true>& write_replace_warning_request_ies_o::value_c::warning_security_info() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::warning_security_info, type_, "Value");
   return c.get<fixed_octstring<50, true> >();
 }
 const fixed_bitstring<8, false, true>& write_replace_warning_request_ies_o::value_c::data_coding_scheme() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::data_coding_scheme, type_, "Value");
   return c.get<fixed_bitstring<8, false, true> >();
 }
 const unbounded_octstring<true>& write_replace_warning_request_ies_o::value_c::warning_msg_contents() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Value");
+  assert_choice_type(types::warning_msg_contents, type_, "Value");
   return c.get<unbounded_octstring<true> >();
 }
 const concurrent_warning_msg_ind_e& write_replace_warning_request_ies_o::value_c::concurrent_warning_msg_ind() const
 {
-  assert_choice_type("ConcurrentWarningMessageIndicator", type_.to_string(), "Value");
+  assert_choice_type(types::concurrent_warning_msg_ind, type_, "Value");
   return c.get<concurrent_warning_msg_ind_e>();
 }
 void write_replace_warning_request_ies_o::value_c::destroy_()
@@ -48378,42 +48378,42 @@ presence_e write_replace_warning_resp_ies_o::get_presence(const uint32_t& id)
 // Value ::= OPEN TYPE
 fixed_bitstring<16, false, true>& write_replace_warning_resp_ies_o::value_c::msg_id()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::msg_id, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 fixed_bitstring<16, false, true>& write_replace_warning_resp_ies_o::value_c::serial_num()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::serial_num, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 broadcast_completed_area_list_c& write_replace_warning_resp_ies_o::value_c::broadcast_completed_area_list()
 {
-  assert_choice_type("BroadcastCompletedAreaList", type_.to_string(), "Value");
+  assert_choice_type(types::broadcast_completed_area_list, type_, "Value");
   return c.get<broadcast_completed_area_list_c>();
 }
 crit_diagnostics_s& write_replace_warning_resp_ies_o::value_c::crit_diagnostics()
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 const fixed_bitstring<16, false, true>& write_replace_warning_resp_ies_o::value_c::msg_id() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::msg_id, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 const fixed_bitstring<16, false, true>& write_replace_warning_resp_ies_o::value_c::serial_num() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Value");
+  assert_choice_type(types::serial_num, type_, "Value");
   return c.get<fixed_bitstring<16, false, true> >();
 }
 const broadcast_completed_area_list_c& write_replace_warning_resp_ies_o::value_c::broadcast_completed_area_list() const
 {
-  assert_choice_type("BroadcastCompletedAreaList", type_.to_string(), "Value");
+  assert_choice_type(types::broadcast_completed_area_list, type_, "Value");
   return c.get<broadcast_completed_area_list_c>();
 }
 const crit_diagnostics_s& write_replace_warning_resp_ies_o::value_c::crit_diagnostics() const
 {
-  assert_choice_type("CriticalityDiagnostics", type_.to_string(), "Value");
+  assert_choice_type(types::crit_diagnostics, type_, "Value");
   return c.get<crit_diagnostics_s>();
 }
 void write_replace_warning_resp_ies_o::value_c::destroy_()
@@ -55280,442 +55280,442 @@ crit_e s1ap_elem_procs_o::get_crit(const uint16_t& proc_code)
 // InitiatingMessage ::= OPEN TYPE
 ho_required_s& s1ap_elem_procs_o::init_msg_c::ho_required()
 {
-  assert_choice_type("HandoverRequired", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ho_required, type_, "InitiatingMessage");
   return c.get<ho_required_s>();
 }
 ho_request_s& s1ap_elem_procs_o::init_msg_c::ho_request()
 {
-  assert_choice_type("HandoverRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ho_request, type_, "InitiatingMessage");
   return c.get<ho_request_s>();
 }
 path_switch_request_s& s1ap_elem_procs_o::init_msg_c::path_switch_request()
 {
-  assert_choice_type("PathSwitchRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::path_switch_request, type_, "InitiatingMessage");
   return c.get<path_switch_request_s>();
 }
 erab_setup_request_s& s1ap_elem_procs_o::init_msg_c::erab_setup_request()
 {
-  assert_choice_type("E-RABSetupRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::erab_setup_request, type_, "InitiatingMessage");
   return c.get<erab_setup_request_s>();
 }
 erab_modify_request_s& s1ap_elem_procs_o::init_msg_c::erab_modify_request()
 {
-  assert_choice_type("E-RABModifyRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::erab_modify_request, type_, "InitiatingMessage");
   return c.get<erab_modify_request_s>();
 }
 erab_release_cmd_s& s1ap_elem_procs_o::init_msg_c::erab_release_cmd()
 {
-  assert_choice_type("E-RABReleaseCommand", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::erab_release_cmd, type_, "InitiatingMessage");
   return c.get<erab_release_cmd_s>();
 }
 init_context_setup_request_s& s1ap_elem_procs_o::init_msg_c::init_context_setup_request()
 {
-  assert_choice_type("InitialContextSetupRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::init_context_setup_request, type_, "InitiatingMessage");
   return c.get<init_context_setup_request_s>();
 }
 ho_cancel_s& s1ap_elem_procs_o::init_msg_c::ho_cancel()
 {
-  assert_choice_type("HandoverCancel", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ho_cancel, type_, "InitiatingMessage");
   return c.get<ho_cancel_s>();
 }
 kill_request_s& s1ap_elem_procs_o::init_msg_c::kill_request()
 {
-  assert_choice_type("KillRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::kill_request, type_, "InitiatingMessage");
   return c.get<kill_request_s>();
 }
 reset_s& s1ap_elem_procs_o::init_msg_c::reset()
 {
-  assert_choice_type("Reset", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::reset, type_, "InitiatingMessage");
   return c.get<reset_s>();
 }
 s1_setup_request_s& s1ap_elem_procs_o::init_msg_c::s1_setup_request()
 {
-  assert_choice_type("S1SetupRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::s1_setup_request, type_, "InitiatingMessage");
   return c.get<s1_setup_request_s>();
 }
 ue_context_mod_request_s& s1ap_elem_procs_o::init_msg_c::ue_context_mod_request()
 {
-  assert_choice_type("UEContextModificationRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ue_context_mod_request, type_, "InitiatingMessage");
   return c.get<ue_context_mod_request_s>();
 }
 ue_context_release_cmd_s& s1ap_elem_procs_o::init_msg_c::ue_context_release_cmd()
 {
-  assert_choice_type("UEContextReleaseCommand", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ue_context_release_cmd, type_, "InitiatingMessage");
   return c.get<ue_context_release_cmd_s>();
 }
 enb_cfg_upd_s& s1ap_elem_procs_o::init_msg_c::enb_cfg_upd()
 {
-  assert_choice_type("ENBConfigurationUpdate", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::enb_cfg_upd, type_, "InitiatingMessage");
   return c.get<enb_cfg_upd_s>();
 }
 mme_cfg_upd_s& s1ap_elem_procs_o::init_msg_c::mme_cfg_upd()
 {
-  assert_choice_type("MMEConfigurationUpdate", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::mme_cfg_upd, type_, "InitiatingMessage");
   return c.get<mme_cfg_upd_s>();
 }
 write_replace_warning_request_s& s1ap_elem_procs_o::init_msg_c::write_replace_warning_request()
 {
-  assert_choice_type("WriteReplaceWarningRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::write_replace_warning_request, type_, "InitiatingMessage");
   return c.get<write_replace_warning_request_s>();
 }
 ho_notify_s& s1ap_elem_procs_o::init_msg_c::ho_notify()
 {
-  assert_choice_type("HandoverNotify", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ho_notify, type_, "InitiatingMessage");
   return c.get<ho_notify_s>();
 }
 erab_release_ind_s& s1ap_elem_procs_o::init_msg_c::erab_release_ind()
 {
-  assert_choice_type("E-RABReleaseIndication", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::erab_release_ind, type_, "InitiatingMessage");
   return c.get<erab_release_ind_s>();
 }
 paging_s& s1ap_elem_procs_o::init_msg_c::paging()
 {
-  assert_choice_type("Paging", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::paging, type_, "InitiatingMessage");
   return c.get<paging_s>();
 }
 dl_nas_transport_s& s1ap_elem_procs_o::init_msg_c::dl_nas_transport()
 {
-  assert_choice_type("DownlinkNASTransport", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::dl_nas_transport, type_, "InitiatingMessage");
   return c.get<dl_nas_transport_s>();
 }
 init_ue_msg_s& s1ap_elem_procs_o::init_msg_c::init_ue_msg()
 {
-  assert_choice_type("InitialUEMessage", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::init_ue_msg, type_, "InitiatingMessage");
   return c.get<init_ue_msg_s>();
 }
 ul_nas_transport_s& s1ap_elem_procs_o::init_msg_c::ul_nas_transport()
 {
-  assert_choice_type("UplinkNASTransport", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ul_nas_transport, type_, "InitiatingMessage");
   return c.get<ul_nas_transport_s>();
 }
 error_ind_s& s1ap_elem_procs_o::init_msg_c::error_ind()
 {
-  assert_choice_type("ErrorIndication", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::error_ind, type_, "InitiatingMessage");
   return c.get<error_ind_s>();
 }
 nas_non_delivery_ind_s& s1ap_elem_procs_o::init_msg_c::nas_non_delivery_ind()
 {
-  assert_choice_type("NASNonDeliveryIndication", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::nas_non_delivery_ind, type_, "InitiatingMessage");
   return c.get<nas_non_delivery_ind_s>();
 }
 ue_context_release_request_s& s1ap_elem_procs_o::init_msg_c::ue_context_release_request()
 {
-  assert_choice_type("UEContextReleaseRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ue_context_release_request, type_, "InitiatingMessage");
   return c.get<ue_context_release_request_s>();
 }
 dl_s1cdma2000tunnelling_s& s1ap_elem_procs_o::init_msg_c::dl_s1cdma2000tunnelling()
 {
-  assert_choice_type("DownlinkS1cdma2000tunnelling", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::dl_s1cdma2000tunnelling, type_, "InitiatingMessage");
   return c.get<dl_s1cdma2000tunnelling_s>();
 }
 ul_s1cdma2000tunnelling_s& s1ap_elem_procs_o::init_msg_c::ul_s1cdma2000tunnelling()
 {
-  assert_choice_type("UplinkS1cdma2000tunnelling", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ul_s1cdma2000tunnelling, type_, "InitiatingMessage");
   return c.get<ul_s1cdma2000tunnelling_s>();
 }
 ue_cap_info_ind_s& s1ap_elem_procs_o::init_msg_c::ue_cap_info_ind()
 {
-  assert_choice_type("UECapabilityInfoIndication", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ue_cap_info_ind, type_, "InitiatingMessage");
   return c.get<ue_cap_info_ind_s>();
 }
 enb_status_transfer_s& s1ap_elem_procs_o::init_msg_c::enb_status_transfer()
 {
-  assert_choice_type("ENBStatusTransfer", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::enb_status_transfer, type_, "InitiatingMessage");
   return c.get<enb_status_transfer_s>();
 }
 mme_status_transfer_s& s1ap_elem_procs_o::init_msg_c::mme_status_transfer()
 {
-  assert_choice_type("MMEStatusTransfer", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::mme_status_transfer, type_, "InitiatingMessage");
   return c.get<mme_status_transfer_s>();
 }
 deactiv_trace_s& s1ap_elem_procs_o::init_msg_c::deactiv_trace()
 {
-  assert_choice_type("DeactivateTrace", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::deactiv_trace, type_, "InitiatingMessage");
   return c.get<deactiv_trace_s>();
 }
 trace_start_s& s1ap_elem_procs_o::init_msg_c::trace_start()
 {
-  assert_choice_type("TraceStart", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::trace_start, type_, "InitiatingMessage");
   return c.get<trace_start_s>();
 }
 trace_fail_ind_s& s1ap_elem_procs_o::init_msg_c::trace_fail_ind()
 {
-  assert_choice_type("TraceFailureIndication", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::trace_fail_ind, type_, "InitiatingMessage");
   return c.get<trace_fail_ind_s>();
 }
 cell_traffic_trace_s& s1ap_elem_procs_o::init_msg_c::cell_traffic_trace()
 {
-  assert_choice_type("CellTrafficTrace", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::cell_traffic_trace, type_, "InitiatingMessage");
   return c.get<cell_traffic_trace_s>();
 }
 location_report_ctrl_s& s1ap_elem_procs_o::init_msg_c::location_report_ctrl()
 {
-  assert_choice_type("LocationReportingControl", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::location_report_ctrl, type_, "InitiatingMessage");
   return c.get<location_report_ctrl_s>();
 }
 location_report_fail_ind_s& s1ap_elem_procs_o::init_msg_c::location_report_fail_ind()
 {
-  assert_choice_type("LocationReportingFailureIndication", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::location_report_fail_ind, type_, "InitiatingMessage");
   return c.get<location_report_fail_ind_s>();
 }
 location_report_s& s1ap_elem_procs_o::init_msg_c::location_report()
 {
-  assert_choice_type("LocationReport", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::location_report, type_, "InitiatingMessage");
   return c.get<location_report_s>();
 }
 overload_start_s& s1ap_elem_procs_o::init_msg_c::overload_start()
 {
-  assert_choice_type("OverloadStart", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::overload_start, type_, "InitiatingMessage");
   return c.get<overload_start_s>();
 }
 overload_stop_s& s1ap_elem_procs_o::init_msg_c::overload_stop()
 {
-  assert_choice_type("OverloadStop", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::overload_stop, type_, "InitiatingMessage");
   return c.get<overload_stop_s>();
 }
 enb_direct_info_transfer_s& s1ap_elem_procs_o::init_msg_c::enb_direct_info_transfer()
 {
-  assert_choice_type("ENBDirectInformationTransfer", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::enb_direct_info_transfer, type_, "InitiatingMessage");
   return c.get<enb_direct_info_transfer_s>();
 }
 mme_direct_info_transfer_s& s1ap_elem_procs_o::init_msg_c::mme_direct_info_transfer()
 {
-  assert_choice_type("MMEDirectInformationTransfer", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::mme_direct_info_transfer, type_, "InitiatingMessage");
   return c.get<mme_direct_info_transfer_s>();
 }
 enb_cfg_transfer_s& s1ap_elem_procs_o::init_msg_c::enb_cfg_transfer()
 {
-  assert_choice_type("ENBConfigurationTransfer", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::enb_cfg_transfer, type_, "InitiatingMessage");
   return c.get<enb_cfg_transfer_s>();
 }
 mme_cfg_transfer_s& s1ap_elem_procs_o::init_msg_c::mme_cfg_transfer()
 {
-  assert_choice_type("MMEConfigurationTransfer", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::mme_cfg_transfer, type_, "InitiatingMessage");
   return c.get<mme_cfg_transfer_s>();
 }
 private_msg_s& s1ap_elem_procs_o::init_msg_c::private_msg()
 {
-  assert_choice_type("PrivateMessage", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::private_msg, type_, "InitiatingMessage");
   return c.get<private_msg_s>();
 }
 const ho_required_s& s1ap_elem_procs_o::init_msg_c::ho_required() const
 {
-  assert_choice_type("HandoverRequired", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ho_required, type_, "InitiatingMessage");
   return c.get<ho_required_s>();
 }
 const ho_request_s& s1ap_elem_procs_o::init_msg_c::ho_request() const
 {
-  assert_choice_type("HandoverRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ho_request, type_, "InitiatingMessage");
   return c.get<ho_request_s>();
 }
 const path_switch_request_s& s1ap_elem_procs_o::init_msg_c::path_switch_request() const
 {
-  assert_choice_type("PathSwitchRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::path_switch_request, type_, "InitiatingMessage");
   return c.get<path_switch_request_s>();
 }
 const erab_setup_request_s& s1ap_elem_procs_o::init_msg_c::erab_setup_request() const
 {
-  assert_choice_type("E-RABSetupRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::erab_setup_request, type_, "InitiatingMessage");
   return c.get<erab_setup_request_s>();
 }
 const erab_modify_request_s& s1ap_elem_procs_o::init_msg_c::erab_modify_request() const
 {
-  assert_choice_type("E-RABModifyRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::erab_modify_request, type_, "InitiatingMessage");
   return c.get<erab_modify_request_s>();
 }
 const erab_release_cmd_s& s1ap_elem_procs_o::init_msg_c::erab_release_cmd() const
 {
-  assert_choice_type("E-RABReleaseCommand", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::erab_release_cmd, type_, "InitiatingMessage");
   return c.get<erab_release_cmd_s>();
 }
 const init_context_setup_request_s& s1ap_elem_procs_o::init_msg_c::init_context_setup_request() const
 {
-  assert_choice_type("InitialContextSetupRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::init_context_setup_request, type_, "InitiatingMessage");
   return c.get<init_context_setup_request_s>();
 }
 const ho_cancel_s& s1ap_elem_procs_o::init_msg_c::ho_cancel() const
 {
-  assert_choice_type("HandoverCancel", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ho_cancel, type_, "InitiatingMessage");
   return c.get<ho_cancel_s>();
 }
 const kill_request_s& s1ap_elem_procs_o::init_msg_c::kill_request() const
 {
-  assert_choice_type("KillRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::kill_request, type_, "InitiatingMessage");
   return c.get<kill_request_s>();
 }
 const reset_s& s1ap_elem_procs_o::init_msg_c::reset() const
 {
-  assert_choice_type("Reset", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::reset, type_, "InitiatingMessage");
   return c.get<reset_s>();
 }
 const s1_setup_request_s& s1ap_elem_procs_o::init_msg_c::s1_setup_request() const
 {
-  assert_choice_type("S1SetupRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::s1_setup_request, type_, "InitiatingMessage");
   return c.get<s1_setup_request_s>();
 }
 const ue_context_mod_request_s& s1ap_elem_procs_o::init_msg_c::ue_context_mod_request() const
 {
-  assert_choice_type("UEContextModificationRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ue_context_mod_request, type_, "InitiatingMessage");
   return c.get<ue_context_mod_request_s>();
 }
 const ue_context_release_cmd_s& s1ap_elem_procs_o::init_msg_c::ue_context_release_cmd() const
 {
-  assert_choice_type("UEContextReleaseCommand", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ue_context_release_cmd, type_, "InitiatingMessage");
   return c.get<ue_context_release_cmd_s>();
 }
 const enb_cfg_upd_s& s1ap_elem_procs_o::init_msg_c::enb_cfg_upd() const
 {
-  assert_choice_type("ENBConfigurationUpdate", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::enb_cfg_upd, type_, "InitiatingMessage");
   return c.get<enb_cfg_upd_s>();
 }
 const mme_cfg_upd_s& s1ap_elem_procs_o::init_msg_c::mme_cfg_upd() const
 {
-  assert_choice_type("MMEConfigurationUpdate", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::mme_cfg_upd, type_, "InitiatingMessage");
   return c.get<mme_cfg_upd_s>();
 }
 const write_replace_warning_request_s& s1ap_elem_procs_o::init_msg_c::write_replace_warning_request() const
 {
-  assert_choice_type("WriteReplaceWarningRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::write_replace_warning_request, type_, "InitiatingMessage");
   return c.get<write_replace_warning_request_s>();
 }
 const ho_notify_s& s1ap_elem_procs_o::init_msg_c::ho_notify() const
 {
-  assert_choice_type("HandoverNotify", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ho_notify, type_, "InitiatingMessage");
   return c.get<ho_notify_s>();
 }
 const erab_release_ind_s& s1ap_elem_procs_o::init_msg_c::erab_release_ind() const
 {
-  assert_choice_type("E-RABReleaseIndication", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::erab_release_ind, type_, "InitiatingMessage");
   return c.get<erab_release_ind_s>();
 }
 const paging_s& s1ap_elem_procs_o::init_msg_c::paging() const
 {
-  assert_choice_type("Paging", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::paging, type_, "InitiatingMessage");
   return c.get<paging_s>();
 }
 const dl_nas_transport_s& s1ap_elem_procs_o::init_msg_c::dl_nas_transport() const
 {
-  assert_choice_type("DownlinkNASTransport", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::dl_nas_transport, type_, "InitiatingMessage");
   return c.get<dl_nas_transport_s>();
 }
 const init_ue_msg_s& s1ap_elem_procs_o::init_msg_c::init_ue_msg() const
 {
-  assert_choice_type("InitialUEMessage", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::init_ue_msg, type_, "InitiatingMessage");
   return c.get<init_ue_msg_s>();
 }
 const ul_nas_transport_s& s1ap_elem_procs_o::init_msg_c::ul_nas_transport() const
 {
-  assert_choice_type("UplinkNASTransport", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ul_nas_transport, type_, "InitiatingMessage");
   return c.get<ul_nas_transport_s>();
 }
 const error_ind_s& s1ap_elem_procs_o::init_msg_c::error_ind() const
 {
-  assert_choice_type("ErrorIndication", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::error_ind, type_, "InitiatingMessage");
   return c.get<error_ind_s>();
 }
 const nas_non_delivery_ind_s& s1ap_elem_procs_o::init_msg_c::nas_non_delivery_ind() const
 {
-  assert_choice_type("NASNonDeliveryIndication", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::nas_non_delivery_ind, type_, "InitiatingMessage");
   return c.get<nas_non_delivery_ind_s>();
 }
 const ue_context_release_request_s& s1ap_elem_procs_o::init_msg_c::ue_context_release_request() const
 {
-  assert_choice_type("UEContextReleaseRequest", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ue_context_release_request, type_, "InitiatingMessage");
   return c.get<ue_context_release_request_s>();
 }
 const dl_s1cdma2000tunnelling_s& s1ap_elem_procs_o::init_msg_c::dl_s1cdma2000tunnelling() const
 {
-  assert_choice_type("DownlinkS1cdma2000tunnelling", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::dl_s1cdma2000tunnelling, type_, "InitiatingMessage");
   return c.get<dl_s1cdma2000tunnelling_s>();
 }
 const ul_s1cdma2000tunnelling_s& s1ap_elem_procs_o::init_msg_c::ul_s1cdma2000tunnelling() const
 {
-  assert_choice_type("UplinkS1cdma2000tunnelling", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ul_s1cdma2000tunnelling, type_, "InitiatingMessage");
   return c.get<ul_s1cdma2000tunnelling_s>();
 }
 const ue_cap_info_ind_s& s1ap_elem_procs_o::init_msg_c::ue_cap_info_ind() const
 {
-  assert_choice_type("UECapabilityInfoIndication", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::ue_cap_info_ind, type_, "InitiatingMessage");
   return c.get<ue_cap_info_ind_s>();
 }
 const enb_status_transfer_s& s1ap_elem_procs_o::init_msg_c::enb_status_transfer() const
 {
-  assert_choice_type("ENBStatusTransfer", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::enb_status_transfer, type_, "InitiatingMessage");
   return c.get<enb_status_transfer_s>();
 }
 const mme_status_transfer_s& s1ap_elem_procs_o::init_msg_c::mme_status_transfer() const
 {
-  assert_choice_type("MMEStatusTransfer", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::mme_status_transfer, type_, "InitiatingMessage");
   return c.get<mme_status_transfer_s>();
 }
 const deactiv_trace_s& s1ap_elem_procs_o::init_msg_c::deactiv_trace() const
 {
-  assert_choice_type("DeactivateTrace", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::deactiv_trace, type_, "InitiatingMessage");
   return c.get<deactiv_trace_s>();
 }
 const trace_start_s& s1ap_elem_procs_o::init_msg_c::trace_start() const
 {
-  assert_choice_type("TraceStart", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::trace_start, type_, "InitiatingMessage");
   return c.get<trace_start_s>();
 }
 const trace_fail_ind_s& s1ap_elem_procs_o::init_msg_c::trace_fail_ind() const
 {
-  assert_choice_type("TraceFailureIndication", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::trace_fail_ind, type_, "InitiatingMessage");
   return c.get<trace_fail_ind_s>();
 }
 const cell_traffic_trace_s& s1ap_elem_procs_o::init_msg_c::cell_traffic_trace() const
 {
-  assert_choice_type("CellTrafficTrace", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::cell_traffic_trace, type_, "InitiatingMessage");
   return c.get<cell_traffic_trace_s>();
 }
 const location_report_ctrl_s& s1ap_elem_procs_o::init_msg_c::location_report_ctrl() const
 {
-  assert_choice_type("LocationReportingControl", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::location_report_ctrl, type_, "InitiatingMessage");
   return c.get<location_report_ctrl_s>();
 }
 const location_report_fail_ind_s& s1ap_elem_procs_o::init_msg_c::location_report_fail_ind() const
 {
-  assert_choice_type("LocationReportingFailureIndication", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::location_report_fail_ind, type_, "InitiatingMessage");
   return c.get<location_report_fail_ind_s>();
 }
 const location_report_s& s1ap_elem_procs_o::init_msg_c::location_report() const
 {
-  assert_choice_type("LocationReport", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::location_report, type_, "InitiatingMessage");
   return c.get<location_report_s>();
 }
 const overload_start_s& s1ap_elem_procs_o::init_msg_c::overload_start() const
 {
-  assert_choice_type("OverloadStart", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::overload_start, type_, "InitiatingMessage");
   return c.get<overload_start_s>();
 }
 const overload_stop_s& s1ap_elem_procs_o::init_msg_c::overload_stop() const
 {
-  assert_choice_type("OverloadStop", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::overload_stop, type_, "InitiatingMessage");
   return c.get<overload_stop_s>();
 }
 const enb_direct_info_transfer_s& s1ap_elem_procs_o::init_msg_c::enb_direct_info_transfer() const
 {
-  assert_choice_type("ENBDirectInformationTransfer", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::enb_direct_info_transfer, type_, "InitiatingMessage");
   return c.get<enb_direct_info_transfer_s>();
 }
 const mme_direct_info_transfer_s& s1ap_elem_procs_o::init_msg_c::mme_direct_info_transfer() const
 {
-  assert_choice_type("MMEDirectInformationTransfer", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::mme_direct_info_transfer, type_, "InitiatingMessage");
   return c.get<mme_direct_info_transfer_s>();
 }
 const enb_cfg_transfer_s& s1ap_elem_procs_o::init_msg_c::enb_cfg_transfer() const
 {
-  assert_choice_type("ENBConfigurationTransfer", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::enb_cfg_transfer, type_, "InitiatingMessage");
   return c.get<enb_cfg_transfer_s>();
 }
 const mme_cfg_transfer_s& s1ap_elem_procs_o::init_msg_c::mme_cfg_transfer() const
 {
-  assert_choice_type("MMEConfigurationTransfer", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::mme_cfg_transfer, type_, "InitiatingMessage");
   return c.get<mme_cfg_transfer_s>();
 }
 const private_msg_s& s1ap_elem_procs_o::init_msg_c::private_msg() const
 {
-  assert_choice_type("PrivateMessage", type_.to_string(), "InitiatingMessage");
+  assert_choice_type(types::private_msg, type_, "InitiatingMessage");
   return c.get<private_msg_s>();
 }
 void s1ap_elem_procs_o::init_msg_c::destroy_()
@@ -56811,162 +56811,162 @@ std::string s1ap_elem_procs_o::init_msg_c::types_opts::to_string() const
 // SuccessfulOutcome ::= OPEN TYPE
 ho_cmd_s& s1ap_elem_procs_o::successful_outcome_c::ho_cmd()
 {
-  assert_choice_type("HandoverCommand", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::ho_cmd, type_, "SuccessfulOutcome");
   return c.get<ho_cmd_s>();
 }
 ho_request_ack_s& s1ap_elem_procs_o::successful_outcome_c::ho_request_ack()
 {
-  assert_choice_type("HandoverRequestAcknowledge", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::ho_request_ack, type_, "SuccessfulOutcome");
   return c.get<ho_request_ack_s>();
 }
 path_switch_request_ack_s& s1ap_elem_procs_o::successful_outcome_c::path_switch_request_ack()
 {
-  assert_choice_type("PathSwitchRequestAcknowledge", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::path_switch_request_ack, type_, "SuccessfulOutcome");
   return c.get<path_switch_request_ack_s>();
 }
 erab_setup_resp_s& s1ap_elem_procs_o::successful_outcome_c::erab_setup_resp()
 {
-  assert_choice_type("E-RABSetupResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::erab_setup_resp, type_, "SuccessfulOutcome");
   return c.get<erab_setup_resp_s>();
 }
 erab_modify_resp_s& s1ap_elem_procs_o::successful_outcome_c::erab_modify_resp()
 {
-  assert_choice_type("E-RABModifyResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::erab_modify_resp, type_, "SuccessfulOutcome");
   return c.get<erab_modify_resp_s>();
 }
 erab_release_resp_s& s1ap_elem_procs_o::successful_outcome_c::erab_release_resp()
 {
-  assert_choice_type("E-RABReleaseResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::erab_release_resp, type_, "SuccessfulOutcome");
   return c.get<erab_release_resp_s>();
 }
 init_context_setup_resp_s& s1ap_elem_procs_o::successful_outcome_c::init_context_setup_resp()
 {
-  assert_choice_type("InitialContextSetupResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::init_context_setup_resp, type_, "SuccessfulOutcome");
   return c.get<init_context_setup_resp_s>();
 }
 ho_cancel_ack_s& s1ap_elem_procs_o::successful_outcome_c::ho_cancel_ack()
 {
-  assert_choice_type("HandoverCancelAcknowledge", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::ho_cancel_ack, type_, "SuccessfulOutcome");
   return c.get<ho_cancel_ack_s>();
 }
 kill_resp_s& s1ap_elem_procs_o::successful_outcome_c::kill_resp()
 {
-  assert_choice_type("KillResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::kill_resp, type_, "SuccessfulOutcome");
   return c.get<kill_resp_s>();
 }
 reset_ack_s& s1ap_elem_procs_o::successful_outcome_c::reset_ack()
 {
-  assert_choice_type("ResetAcknowledge", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::reset_ack, type_, "SuccessfulOutcome");
   return c.get<reset_ack_s>();
 }
 s1_setup_resp_s& s1ap_elem_procs_o::successful_outcome_c::s1_setup_resp()
 {
-  assert_choice_type("S1SetupResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::s1_setup_resp, type_, "SuccessfulOutcome");
   return c.get<s1_setup_resp_s>();
 }
 ue_context_mod_resp_s& s1ap_elem_procs_o::successful_outcome_c::ue_context_mod_resp()
 {
-  assert_choice_type("UEContextModificationResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::ue_context_mod_resp, type_, "SuccessfulOutcome");
   return c.get<ue_context_mod_resp_s>();
 }
 ue_context_release_complete_s& s1ap_elem_procs_o::successful_outcome_c::ue_context_release_complete()
 {
-  assert_choice_type("UEContextReleaseComplete", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::ue_context_release_complete, type_, "SuccessfulOutcome");
   return c.get<ue_context_release_complete_s>();
 }
 enb_cfg_upd_ack_s& s1ap_elem_procs_o::successful_outcome_c::enb_cfg_upd_ack()
 {
-  assert_choice_type("ENBConfigurationUpdateAcknowledge", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::enb_cfg_upd_ack, type_, "SuccessfulOutcome");
   return c.get<enb_cfg_upd_ack_s>();
 }
 mme_cfg_upd_ack_s& s1ap_elem_procs_o::successful_outcome_c::mme_cfg_upd_ack()
 {
-  assert_choice_type("MMEConfigurationUpdateAcknowledge", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::mme_cfg_upd_ack, type_, "SuccessfulOutcome");
   return c.get<mme_cfg_upd_ack_s>();
 }
 write_replace_warning_resp_s& s1ap_elem_procs_o::successful_outcome_c::write_replace_warning_resp()
 {
-  assert_choice_type("WriteReplaceWarningResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::write_replace_warning_resp, type_, "SuccessfulOutcome");
   return c.get<write_replace_warning_resp_s>();
 }
 const ho_cmd_s& s1ap_elem_procs_o::successful_outcome_c::ho_cmd() const
 {
-  assert_choice_type("HandoverCommand", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::ho_cmd, type_, "SuccessfulOutcome");
   return c.get<ho_cmd_s>();
 }
 const ho_request_ack_s& s1ap_elem_procs_o::successful_outcome_c::ho_request_ack() const
 {
-  assert_choice_type("HandoverRequestAcknowledge", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::ho_request_ack, type_, "SuccessfulOutcome");
   return c.get<ho_request_ack_s>();
 }
 const path_switch_request_ack_s& s1ap_elem_procs_o::successful_outcome_c::path_switch_request_ack() const
 {
-  assert_choice_type("PathSwitchRequestAcknowledge", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::path_switch_request_ack, type_, "SuccessfulOutcome");
   return c.get<path_switch_request_ack_s>();
 }
 const erab_setup_resp_s& s1ap_elem_procs_o::successful_outcome_c::erab_setup_resp() const
 {
-  assert_choice_type("E-RABSetupResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::erab_setup_resp, type_, "SuccessfulOutcome");
   return c.get<erab_setup_resp_s>();
 }
 const erab_modify_resp_s& s1ap_elem_procs_o::successful_outcome_c::erab_modify_resp() const
 {
-  assert_choice_type("E-RABModifyResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::erab_modify_resp, type_, "SuccessfulOutcome");
   return c.get<erab_modify_resp_s>();
 }
 const erab_release_resp_s& s1ap_elem_procs_o::successful_outcome_c::erab_release_resp() const
 {
-  assert_choice_type("E-RABReleaseResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::erab_release_resp, type_, "SuccessfulOutcome");
   return c.get<erab_release_resp_s>();
 }
 const init_context_setup_resp_s& s1ap_elem_procs_o::successful_outcome_c::init_context_setup_resp() const
 {
-  assert_choice_type("InitialContextSetupResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::init_context_setup_resp, type_, "SuccessfulOutcome");
   return c.get<init_context_setup_resp_s>();
 }
 const ho_cancel_ack_s& s1ap_elem_procs_o::successful_outcome_c::ho_cancel_ack() const
 {
-  assert_choice_type("HandoverCancelAcknowledge", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::ho_cancel_ack, type_, "SuccessfulOutcome");
   return c.get<ho_cancel_ack_s>();
 }
 const kill_resp_s& s1ap_elem_procs_o::successful_outcome_c::kill_resp() const
 {
-  assert_choice_type("KillResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::kill_resp, type_, "SuccessfulOutcome");
   return c.get<kill_resp_s>();
 }
 const reset_ack_s& s1ap_elem_procs_o::successful_outcome_c::reset_ack() const
 {
-  assert_choice_type("ResetAcknowledge", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::reset_ack, type_, "SuccessfulOutcome");
   return c.get<reset_ack_s>();
 }
 const s1_setup_resp_s& s1ap_elem_procs_o::successful_outcome_c::s1_setup_resp() const
 {
-  assert_choice_type("S1SetupResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::s1_setup_resp, type_, "SuccessfulOutcome");
   return c.get<s1_setup_resp_s>();
 }
 const ue_context_mod_resp_s& s1ap_elem_procs_o::successful_outcome_c::ue_context_mod_resp() const
 {
-  assert_choice_type("UEContextModificationResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::ue_context_mod_resp, type_, "SuccessfulOutcome");
   return c.get<ue_context_mod_resp_s>();
 }
 const ue_context_release_complete_s& s1ap_elem_procs_o::successful_outcome_c::ue_context_release_complete() const
 {
-  assert_choice_type("UEContextReleaseComplete", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::ue_context_release_complete, type_, "SuccessfulOutcome");
   return c.get<ue_context_release_complete_s>();
 }
 const enb_cfg_upd_ack_s& s1ap_elem_procs_o::successful_outcome_c::enb_cfg_upd_ack() const
 {
-  assert_choice_type("ENBConfigurationUpdateAcknowledge", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::enb_cfg_upd_ack, type_, "SuccessfulOutcome");
   return c.get<enb_cfg_upd_ack_s>();
 }
 const mme_cfg_upd_ack_s& s1ap_elem_procs_o::successful_outcome_c::mme_cfg_upd_ack() const
 {
-  assert_choice_type("MMEConfigurationUpdateAcknowledge", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::mme_cfg_upd_ack, type_, "SuccessfulOutcome");
   return c.get<mme_cfg_upd_ack_s>();
 }
 const write_replace_warning_resp_s& s1ap_elem_procs_o::successful_outcome_c::write_replace_warning_resp() const
 {
-  assert_choice_type("WriteReplaceWarningResponse", type_.to_string(), "SuccessfulOutcome");
+  assert_choice_type(types::write_replace_warning_resp, type_, "SuccessfulOutcome");
   return c.get<write_replace_warning_resp_s>();
 }
 void s1ap_elem_procs_o::successful_outcome_c::destroy_()
@@ -57427,82 +57427,82 @@ uint8_t s1ap_elem_procs_o::successful_outcome_c::types_opts::to_number() const
 // UnsuccessfulOutcome ::= OPEN TYPE
 ho_prep_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::ho_prep_fail()
 {
-  assert_choice_type("HandoverPreparationFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::ho_prep_fail, type_, "UnsuccessfulOutcome");
   return c.get<ho_prep_fail_s>();
 }
 ho_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::ho_fail()
 {
-  assert_choice_type("HandoverFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::ho_fail, type_, "UnsuccessfulOutcome");
   return c.get<ho_fail_s>();
 }
 path_switch_request_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::path_switch_request_fail()
 {
-  assert_choice_type("PathSwitchRequestFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::path_switch_request_fail, type_, "UnsuccessfulOutcome");
   return c.get<path_switch_request_fail_s>();
 }
 init_context_setup_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::init_context_setup_fail()
 {
-  assert_choice_type("InitialContextSetupFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::init_context_setup_fail, type_, "UnsuccessfulOutcome");
   return c.get<init_context_setup_fail_s>();
 }
 s1_setup_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::s1_setup_fail()
 {
-  assert_choice_type("S1SetupFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::s1_setup_fail, type_, "UnsuccessfulOutcome");
   return c.get<s1_setup_fail_s>();
 }
 ue_context_mod_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::ue_context_mod_fail()
 {
-  assert_choice_type("UEContextModificationFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::ue_context_mod_fail, type_, "UnsuccessfulOutcome");
   return c.get<ue_context_mod_fail_s>();
 }
 enb_cfg_upd_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::enb_cfg_upd_fail()
 {
-  assert_choice_type("ENBConfigurationUpdateFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::enb_cfg_upd_fail, type_, "UnsuccessfulOutcome");
   return c.get<enb_cfg_upd_fail_s>();
 }
 mme_cfg_upd_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::mme_cfg_upd_fail()
 {
-  assert_choice_type("MMEConfigurationUpdateFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::mme_cfg_upd_fail, type_, "UnsuccessfulOutcome");
   return c.get<mme_cfg_upd_fail_s>();
 }
 const ho_prep_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::ho_prep_fail() const
 {
-  assert_choice_type("HandoverPreparationFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::ho_prep_fail, type_, "UnsuccessfulOutcome");
   return c.get<ho_prep_fail_s>();
 }
 const ho_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::ho_fail() const
 {
-  assert_choice_type("HandoverFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::ho_fail, type_, "UnsuccessfulOutcome");
   return c.get<ho_fail_s>();
 }
 const path_switch_request_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::path_switch_request_fail() const
 {
-  assert_choice_type("PathSwitchRequestFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::path_switch_request_fail, type_, "UnsuccessfulOutcome");
   return c.get<path_switch_request_fail_s>();
 }
 const init_context_setup_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::init_context_setup_fail() const
 {
-  assert_choice_type("InitialContextSetupFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::init_context_setup_fail, type_, "UnsuccessfulOutcome");
   return c.get<init_context_setup_fail_s>();
 }
 const s1_setup_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::s1_setup_fail() const
 {
-  assert_choice_type("S1SetupFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::s1_setup_fail, type_, "UnsuccessfulOutcome");
   return c.get<s1_setup_fail_s>();
 }
 const ue_context_mod_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::ue_context_mod_fail() const
 {
-  assert_choice_type("UEContextModificationFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::ue_context_mod_fail, type_, "UnsuccessfulOutcome");
   return c.get<ue_context_mod_fail_s>();
 }
 const enb_cfg_upd_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::enb_cfg_upd_fail() const
 {
-  assert_choice_type("ENBConfigurationUpdateFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::enb_cfg_upd_fail, type_, "UnsuccessfulOutcome");
   return c.get<enb_cfg_upd_fail_s>();
 }
 const mme_cfg_upd_fail_s& s1ap_elem_procs_o::unsuccessful_outcome_c::mme_cfg_upd_fail() const
 {
-  assert_choice_type("MMEConfigurationUpdateFailure", type_.to_string(), "UnsuccessfulOutcome");
+  assert_choice_type(types::mme_cfg_upd_fail, type_, "UnsuccessfulOutcome");
   return c.get<mme_cfg_upd_fail_s>();
 }
 void s1ap_elem_procs_o::unsuccessful_outcome_c::destroy_()
@@ -57875,22 +57875,22 @@ presence_e last_visited_eutran_cell_info_ext_ies_o::get_presence(const uint32_t&
 // Extension ::= OPEN TYPE
 uint16_t& last_visited_eutran_cell_info_ext_ies_o::ext_c::time_ue_stayed_in_cell_enhanced_granularity()
 {
-  assert_choice_type("INTEGER (0..40950)", type_.to_string(), "Extension");
+  assert_choice_type(types::time_ue_stayed_in_cell_enhanced_granularity, type_, "Extension");
   return c.get<uint16_t>();
 }
 cause_c& last_visited_eutran_cell_info_ext_ies_o::ext_c::ho_cause()
 {
-  assert_choice_type("Cause", type_.to_string(), "Extension");
+  assert_choice_type(types::ho_cause, type_, "Extension");
   return c.get<cause_c>();
 }
 const uint16_t& last_visited_eutran_cell_info_ext_ies_o::ext_c::time_ue_stayed_in_cell_enhanced_granularity() const
 {
-  assert_choice_type("INTEGER (0..40950)", type_.to_string(), "Extension");
+  assert_choice_type(types::time_ue_stayed_in_cell_enhanced_granularity, type_, "Extension");
   return c.get<uint16_t>();
 }
 const cause_c& last_visited_eutran_cell_info_ext_ies_o::ext_c::ho_cause() const
 {
-  assert_choice_type("Cause", type_.to_string(), "Extension");
+  assert_choice_type(types::ho_cause, type_, "Extension");
   return c.get<cause_c>();
 }
 void last_visited_eutran_cell_info_ext_ies_o::ext_c::destroy_()
@@ -59506,23 +59506,23 @@ presence_e sourceenb_to_targetenb_transparent_container_ext_ies_o::get_presence(
 // Extension ::= OPEN TYPE
 fixed_bitstring<32, false, true>& sourceenb_to_targetenb_transparent_container_ext_ies_o::ext_c::mob_info()
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::mob_info, type_, "Extension");
   return c.get<fixed_bitstring<32, false, true> >();
 }
 unbounded_octstring<true>& sourceenb_to_targetenb_transparent_container_ext_ies_o::ext_c::ue_history_info_from_the_ue()
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::ue_history_info_from_the_ue, type_, "Extension");
   return c.get<unbounded_octstring<true> >();
 }
 const fixed_bitstring<32, false, true>& sourceenb_to_targetenb_transparent_container_ext_ies_o::ext_c::mob_info() const
 {
-  assert_choice_type("BIT STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::mob_info, type_, "Extension");
   return c.get<fixed_bitstring<32, false, true> >();
 }
 const unbounded_octstring<true>&
 sourceenb_to_targetenb_transparent_container_ext_ies_o::ext_c::ue_history_info_from_the_ue() const
 {
-  assert_choice_type("OCTET STRING", type_.to_string(), "Extension");
+  assert_choice_type(types::ue_history_info_from_the_ue, type_, "Extension");
   return c.get<unbounded_octstring<true> >();
 }
 void sourceenb_to_targetenb_transparent_container_ext_ies_o::ext_c::destroy_()
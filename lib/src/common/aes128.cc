@@ -0,0 +1,443 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srslte/common/aes128.h"
+#include <string.h>
+
+#ifdef __AES__
+#include <wmmintrin.h>
+#endif // __AES__
+
+// Number of independent blocks kept in flight. AES-NI has a latency of several cycles per round but can issue one
+// round per cycle, so interleaving blocks (CTR counters or the CMAC chains of different PDUs) hides the latency.
+#define AES128_LANES 8
+
+namespace srslte {
+
+namespace {
+
+const uint8_t aes_sbox[256] = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76, 0xca, 0x82, 0xc9,
+    0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0, 0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f,
+    0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15, 0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07,
+    0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75, 0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3,
+    0x29, 0xe3, 0x2f, 0x84, 0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58,
+    0xcf, 0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8, 0x51, 0xa3,
+    0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2, 0xcd, 0x0c, 0x13, 0xec, 0x5f,
+    0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73, 0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88,
+    0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb, 0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac,
+    0x62, 0x91, 0x95, 0xe4, 0x79, 0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a,
+    0xae, 0x08, 0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a, 0x70,
+    0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e, 0xe1, 0xf8, 0x98, 0x11,
+    0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf, 0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42,
+    0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16};
+
+const uint8_t aes_rcon[AES128_NOF_ROUNDS] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36};
+
+inline uint32_t get_u32(const uint8_t* p)
+{
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+inline void put_u32(uint8_t* p, uint32_t w)
+{
+  p[0] = (uint8_t)(w >> 24);
+  p[1] = (uint8_t)(w >> 16);
+  p[2] = (uint8_t)(w >> 8);
+  p[3] = (uint8_t)w;
+}
+
+inline uint32_t ror8(uint32_t w)
+{
+  return (w >> 8) | (w << 24);
+}
+
+inline uint32_t sub_word(uint32_t w)
+{
+  return ((uint32_t)aes_sbox[w >> 24] << 24) | ((uint32_t)aes_sbox[(w >> 16) & 0xff] << 16) |
+         ((uint32_t)aes_sbox[(w >> 8) & 0xff] << 8) | (uint32_t)aes_sbox[w & 0xff];
+}
+
+// Combined SubBytes/MixColumns tables of the software implementation, built on first use
+struct aes_tables_t {
+  uint32_t te[4][256];
+
+  aes_tables_t()
+  {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t s  = aes_sbox[i];
+      uint32_t s2 = ((s << 1) ^ ((s & 0x80) ? 0x1b : 0x00)) & 0xff;
+      uint32_t s3 = s2 ^ s;
+      te[0][i]    = (s2 << 24) | (s << 16) | (s << 8) | s3;
+      te[1][i]    = ror8(te[0][i]);
+      te[2][i]    = ror8(te[1][i]);
+      te[3][i]    = ror8(te[2][i]);
+    }
+  }
+};
+
+const aes_tables_t& aes_tables()
+{
+  static const aes_tables_t tables;
+  return tables;
+}
+
+void aes128_sw_encrypt(const aes128_key_ctx_t* ctx, const uint8_t* in, uint8_t* out)
+{
+  const aes_tables_t& t   = aes_tables();
+  const uint32_t*     te0 = t.te[0];
+  const uint32_t*     te1 = t.te[1];
+  const uint32_t*     te2 = t.te[2];
+  const uint32_t*     te3 = t.te[3];
+  const uint32_t*     rk  = ctx->rk_w;
+
+  uint32_t s0 = get_u32(in) ^ rk[0];
+  uint32_t s1 = get_u32(in + 4) ^ rk[1];
+  uint32_t s2 = get_u32(in + 8) ^ rk[2];
+  uint32_t s3 = get_u32(in + 12) ^ rk[3];
+
+  for (uint32_t r = 1; r < AES128_NOF_ROUNDS; r++) {
+    rk += 4;
+    uint32_t t0 = te0[s0 >> 24] ^ te1[(s1 >> 16) & 0xff] ^ te2[(s2 >> 8) & 0xff] ^ te3[s3 & 0xff] ^ rk[0];
+    uint32_t t1 = te0[s1 >> 24] ^ te1[(s2 >> 16) & 0xff] ^ te2[(s3 >> 8) & 0xff] ^ te3[s0 & 0xff] ^ rk[1];
+    uint32_t t2 = te0[s2 >> 24] ^ te1[(s3 >> 16) & 0xff] ^ te2[(s0 >> 8) & 0xff] ^ te3[s1 & 0xff] ^ rk[2];
+    uint32_t t3 = te0[s3 >> 24] ^ te1[(s0 >> 16) & 0xff] ^ te2[(s1 >> 8) & 0xff] ^ te3[s2 & 0xff] ^ rk[3];
+    s0          = t0;
+    s1          = t1;
+    s2          = t2;
+    s3          = t3;
+  }
+
+  // Last round has no MixColumns
+  rk += 4;
+  put_u32(out, sub_word((s0 & 0xff000000) | (s1 & 0xff0000) | (s2 & 0xff00) | (s3 & 0xff)) ^ rk[0]);
+  put_u32(out + 4, sub_word((s1 & 0xff000000) | (s2 & 0xff0000) | (s3 & 0xff00) | (s0 & 0xff)) ^ rk[1]);
+  put_u32(out + 8, sub_word((s2 & 0xff000000) | (s3 & 0xff0000) | (s0 & 0xff00) | (s1 & 0xff)) ^ rk[2]);
+  put_u32(out + 12, sub_word((s3 & 0xff000000) | (s0 & 0xff0000) | (s1 & 0xff00) | (s2 & 0xff)) ^ rk[3]);
+}
+
+// Encrypts nof_blocks (at most AES128_LANES) independent blocks in place
+void aes128_encrypt_blocks(const aes128_key_ctx_t* ctx, uint8_t (*blocks)[AES128_BLOCK_LEN], uint32_t nof_blocks)
+{
+#ifdef __AES__
+  __m128i rk[AES128_NOF_ROUNDS + 1];
+  __m128i b[AES128_LANES];
+  for (uint32_t r = 0; r <= AES128_NOF_ROUNDS; r++) {
+    rk[r] = _mm_loadu_si128((const __m128i*)&ctx->rk[r * AES128_BLOCK_LEN]);
+  }
+  for (uint32_t j = 0; j < nof_blocks; j++) {
+    b[j] = _mm_xor_si128(_mm_loadu_si128((const __m128i*)blocks[j]), rk[0]);
+  }
+  for (uint32_t r = 1; r < AES128_NOF_ROUNDS; r++) {
+    for (uint32_t j = 0; j < nof_blocks; j++) {
+      b[j] = _mm_aesenc_si128(b[j], rk[r]);
+    }
+  }
+  for (uint32_t j = 0; j < nof_blocks; j++) {
+    _mm_storeu_si128((__m128i*)blocks[j], _mm_aesenclast_si128(b[j], rk[AES128_NOF_ROUNDS]));
+  }
+#else  // __AES__
+  for (uint32_t j = 0; j < nof_blocks; j++) {
+    aes128_sw_encrypt(ctx, blocks[j], blocks[j]);
+  }
+#endif // __AES__
+}
+
+// Same as aes128_encrypt_blocks, with block j encrypted under ctxs[j]
+void aes128_encrypt_blocks_multi(const aes128_key_ctx_t* const* ctxs,
+                                 uint8_t (*blocks)[AES128_BLOCK_LEN],
+                                 uint32_t nof_blocks)
+{
+#ifdef __AES__
+  __m128i b[AES128_LANES];
+  for (uint32_t j = 0; j < nof_blocks; j++) {
+    b[j] = _mm_xor_si128(_mm_loadu_si128((const __m128i*)blocks[j]), _mm_loadu_si128((const __m128i*)ctxs[j]->rk));
+  }
+  for (uint32_t r = 1; r < AES128_NOF_ROUNDS; r++) {
+    for (uint32_t j = 0; j < nof_blocks; j++) {
+      b[j] = _mm_aesenc_si128(b[j], _mm_loadu_si128((const __m128i*)&ctxs[j]->rk[r * AES128_BLOCK_LEN]));
+    }
+  }
+  for (uint32_t j = 0; j < nof_blocks; j++) {
+    __m128i last = _mm_loadu_si128((const __m128i*)&ctxs[j]->rk[AES128_NOF_ROUNDS * AES128_BLOCK_LEN]);
+    _mm_storeu_si128((__m128i*)blocks[j], _mm_aesenclast_si128(b[j], last));
+  }
+#else  // __AES__
+  for (uint32_t j = 0; j < nof_blocks; j++) {
+    aes128_sw_encrypt(ctxs[j], blocks[j], blocks[j]);
+  }
+#endif // __AES__
+}
+
+#ifndef __AES__
+// Increments the 128-bit big-endian counter block
+inline void ctr_increment(uint8_t* ctr)
+{
+  for (int i = AES128_BLOCK_LEN - 1; i >= 0; i--) {
+    if (++ctr[i] != 0) {
+      break;
+    }
+  }
+}
+
+void ctr_job(const aes128_key_ctx_t* ctx, aes128_job_t* job)
+{
+  uint8_t  ctr[AES128_BLOCK_LEN];
+  uint8_t  ks[AES128_LANES][AES128_BLOCK_LEN];
+  uint32_t offset = 0;
+
+  memcpy(ctr, job->iv, AES128_BLOCK_LEN);
+  while (offset < job->len) {
+    uint32_t nof_bytes  = job->len - offset;
+    uint32_t nof_blocks = (nof_bytes + AES128_BLOCK_LEN - 1) / AES128_BLOCK_LEN;
+    if (nof_blocks > AES128_LANES) {
+      nof_blocks = AES128_LANES;
+      nof_bytes  = AES128_LANES * AES128_BLOCK_LEN;
+    }
+
+    for (uint32_t j = 0; j < nof_blocks; j++) {
+      memcpy(ks[j], ctr, AES128_BLOCK_LEN);
+      ctr_increment(ctr);
+    }
+    aes128_encrypt_blocks(ctx, ks, nof_blocks);
+
+    const uint8_t* ks_ptr = &ks[0][0];
+    for (uint32_t i = 0; i < nof_bytes; i++) {
+      job->out[offset + i] = job->msg[offset + i] ^ ks_ptr[i];
+    }
+    offset += nof_bytes;
+  }
+}
+#else  // __AES__
+void ctr_job(const aes128_key_ctx_t* ctx, aes128_job_t* job)
+{
+  __m128i rk[AES128_NOF_ROUNDS + 1];
+  for (uint32_t r = 0; r <= AES128_NOF_ROUNDS; r++) {
+    rk[r] = _mm_loadu_si128((const __m128i*)&ctx->rk[r * AES128_BLOCK_LEN]);
+  }
+
+  // Counter kept as two host-order 64-bit halves, converted to big-endian when loaded into a block
+  uint64_t ctr_hi = 0;
+  uint64_t ctr_lo = 0;
+  for (uint32_t i = 0; i < 8; i++) {
+    ctr_hi = (ctr_hi << 8) | job->iv[i];
+    ctr_lo = (ctr_lo << 8) | job->iv[8 + i];
+  }
+
+  const uint8_t* in     = job->msg;
+  uint8_t*       out    = job->out;
+  uint32_t       remain = job->len;
+  while (remain > 0) {
+    uint32_t nof_blocks = (remain + AES128_BLOCK_LEN - 1) / AES128_BLOCK_LEN;
+    if (nof_blocks > AES128_LANES) {
+      nof_blocks = AES128_LANES;
+    }
+
+    __m128i b[AES128_LANES];
+    for (uint32_t j = 0; j < nof_blocks; j++) {
+      b[j] = _mm_xor_si128(_mm_set_epi64x(__builtin_bswap64(ctr_lo), __builtin_bswap64(ctr_hi)), rk[0]);
+      if (++ctr_lo == 0) {
+        ctr_hi++;
+      }
+    }
+    for (uint32_t r = 1; r < AES128_NOF_ROUNDS; r++) {
+      for (uint32_t j = 0; j < nof_blocks; j++) {
+        b[j] = _mm_aesenc_si128(b[j], rk[r]);
+      }
+    }
+    for (uint32_t j = 0; j < nof_blocks; j++) {
+      b[j] = _mm_aesenclast_si128(b[j], rk[AES128_NOF_ROUNDS]);
+    }
+
+    for (uint32_t j = 0; j < nof_blocks; j++) {
+      if (remain >= AES128_BLOCK_LEN) {
+        _mm_storeu_si128((__m128i*)out, _mm_xor_si128(_mm_loadu_si128((const __m128i*)in), b[j]));
+        in += AES128_BLOCK_LEN;
+        out += AES128_BLOCK_LEN;
+        remain -= AES128_BLOCK_LEN;
+      } else {
+        // Trailing partial block
+        uint8_t ks[AES128_BLOCK_LEN];
+        _mm_storeu_si128((__m128i*)ks, b[j]);
+        for (uint32_t i = 0; i < remain; i++) {
+          out[i] = in[i] ^ ks[i];
+        }
+        remain = 0;
+      }
+    }
+  }
+}
+#endif // __AES__
+
+// Fetches CMAC block idx of M = iv[0..7] || msg, applying padding and subkey to the last block
+void cmac_get_block(const aes128_key_ctx_t* ctx,
+                    const aes128_job_t*     job,
+                    uint32_t                idx,
+                    uint32_t                nof_blocks,
+                    uint8_t*                blk)
+{
+  uint32_t total = job->len + 8;
+  uint32_t start = idx * AES128_BLOCK_LEN;
+  uint32_t avail = total - start;
+  if (avail > AES128_BLOCK_LEN) {
+    avail = AES128_BLOCK_LEN;
+  }
+
+  if (idx == 0) {
+    memcpy(blk, job->iv, 8);
+    memcpy(blk + 8, job->msg, avail - 8);
+  } else {
+    memcpy(blk, job->msg + start - 8, avail);
+  }
+
+  if (idx == nof_blocks - 1) {
+    const uint8_t* subkey = ctx->cmac_k1;
+    if (avail < AES128_BLOCK_LEN) {
+      blk[avail] = 0x80;
+      memset(blk + avail + 1, 0, AES128_BLOCK_LEN - avail - 1);
+      subkey = ctx->cmac_k2;
+    }
+    for (uint32_t i = 0; i < AES128_BLOCK_LEN; i++) {
+      blk[i] ^= subkey[i];
+    }
+  }
+}
+
+void cmac_subkey_shift(const uint8_t* in, uint8_t* out)
+{
+  for (uint32_t i = 0; i < AES128_BLOCK_LEN - 1; i++) {
+    out[i] = (in[i] << 1) | ((in[i + 1] >> 7) & 0x01);
+  }
+  out[AES128_BLOCK_LEN - 1] = in[AES128_BLOCK_LEN - 1] << 1;
+  if (in[0] & 0x80) {
+    out[AES128_BLOCK_LEN - 1] ^= 0x87;
+  }
+}
+
+} // namespace
+
+void aes128_set_key(aes128_key_ctx_t* ctx, const uint8_t* key)
+{
+  // Key expansion, FIPS-197 Section 5.2
+  for (uint32_t i = 0; i < 4; i++) {
+    ctx->rk_w[i] = get_u32(&key[4 * i]);
+  }
+  for (uint32_t i = 4; i < (AES128_NOF_ROUNDS + 1) * 4; i++) {
+    uint32_t temp = ctx->rk_w[i - 1];
+    if (i % 4 == 0) {
+      temp = sub_word((temp << 8) | (temp >> 24)) ^ ((uint32_t)aes_rcon[i / 4 - 1] << 24);
+    }
+    ctx->rk_w[i] = ctx->rk_w[i - 4] ^ temp;
+  }
+  for (uint32_t i = 0; i < (AES128_NOF_ROUNDS + 1) * 4; i++) {
+    put_u32(&ctx->rk[4 * i], ctx->rk_w[i]);
+  }
+
+  // CMAC subkeys, RFC 4493 Section 2.3
+  uint8_t l[AES128_BLOCK_LEN] = {};
+  aes128_sw_encrypt(ctx, l, l);
+  cmac_subkey_shift(l, ctx->cmac_k1);
+  cmac_subkey_shift(ctx->cmac_k1, ctx->cmac_k2);
+
+  ctx->valid = true;
+}
+
+void aes128_encrypt_block(const aes128_key_ctx_t* ctx, const uint8_t* in, uint8_t* out)
+{
+  uint8_t blk[1][AES128_BLOCK_LEN];
+  memcpy(blk[0], in, AES128_BLOCK_LEN);
+  aes128_encrypt_blocks(ctx, blk, 1);
+  memcpy(out, blk[0], AES128_BLOCK_LEN);
+}
+
+void aes128_ecb_multi(const aes128_key_ctx_t* const* ctxs, uint8_t (*blocks)[AES128_BLOCK_LEN], uint32_t nof_blocks)
+{
+  for (uint32_t first = 0; first < nof_blocks; first += AES128_LANES) {
+    uint32_t n = nof_blocks - first;
+    aes128_encrypt_blocks_multi(&ctxs[first], &blocks[first], n > AES128_LANES ? AES128_LANES : n);
+  }
+}
+
+void aes128_ctr(const aes128_key_ctx_t* ctx, aes128_job_t* jobs, uint32_t nof_jobs)
+{
+  for (uint32_t i = 0; i < nof_jobs; i++) {
+    ctr_job(ctx, &jobs[i]);
+  }
+}
+
+void aes128_cmac(const aes128_key_ctx_t* ctx, aes128_job_t* jobs, uint32_t nof_jobs)
+{
+  // The CMAC chain of a single PDU is sequential, so up to AES128_LANES PDUs are processed side by side
+  for (uint32_t first = 0; first < nof_jobs; first += AES128_LANES) {
+    uint32_t nof_lanes = nof_jobs - first;
+    if (nof_lanes > AES128_LANES) {
+      nof_lanes = AES128_LANES;
+    }
+
+    uint8_t  state[AES128_LANES][AES128_BLOCK_LEN] = {};
+    uint32_t nof_blocks[AES128_LANES];
+    uint32_t max_blocks = 0;
+    for (uint32_t l = 0; l < nof_lanes; l++) {
+      nof_blocks[l] = (jobs[first + l].len + 8 + AES128_BLOCK_LEN - 1) / AES128_BLOCK_LEN;
+      if (nof_blocks[l] > max_blocks) {
+        max_blocks = nof_blocks[l];
+      }
+    }
+
+    for (uint32_t idx = 0; idx < max_blocks; idx++) {
+      // Gather the lanes that still have blocks left
+      uint8_t  blks[AES128_LANES][AES128_BLOCK_LEN];
+      uint32_t active[AES128_LANES];
+      uint32_t nof_active = 0;
+      for (uint32_t l = 0; l < nof_lanes; l++) {
+        if (idx < nof_blocks[l]) {
+          uint8_t* blk = blks[nof_active];
+          cmac_get_block(ctx, &jobs[first + l], idx, nof_blocks[l], blk);
+          for (uint32_t i = 0; i < AES128_BLOCK_LEN; i++) {
+            blk[i] ^= state[l][i];
+          }
+          active[nof_active++] = l;
+        }
+      }
+
+      aes128_encrypt_blocks(ctx, blks, nof_active);
+
+      for (uint32_t a = 0; a < nof_active; a++) {
+        uint32_t l = active[a];
+        memcpy(state[l], blks[a], AES128_BLOCK_LEN);
+        if (idx == nof_blocks[l] - 1) {
+          memcpy(jobs[first + l].out, state[l], AES128_BLOCK_LEN);
+        }
+      }
+    }
+  }
+}
+
+const char* aes128_impl_name()
+{
+#ifdef __AES__
+  return "AES-NI";
+#else  // __AES__
+  return "software";
+#endif // __AES__
+}
+
+} // namespace srslte
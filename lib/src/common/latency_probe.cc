@@ -0,0 +1,255 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srslte/common/latency_probe.h"
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <pthread.h>
+#include <signal.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace srslte {
+
+const char* to_string(probe_point p)
+{
+  switch (p) {
+    case probe_point::radio_rx:
+      return "radio_rx";
+    case probe_point::worker_ul:
+      return "worker_ul";
+    case probe_point::worker_dl:
+      return "worker_dl";
+    case probe_point::mac_dl_sched:
+      return "mac_dl_sched";
+    case probe_point::sched_dl:
+      return "sched_dl";
+    case probe_point::pdsch_encode:
+      return "pdsch_encode";
+    case probe_point::sch_decode:
+      return "sch_decode";
+    case probe_point::radio_tx:
+      return "radio_tx";
+    default:
+      break;
+  }
+  return "invalid";
+}
+
+/*******************
+ * HDR histogram
+ *******************/
+
+void hdr_histogram::merge(const hdr_histogram& other)
+{
+  for (uint32_t i = 0; i < NOF_BUCKETS; i++) {
+    inc(buckets[i], other.buckets[i].load(std::memory_order_relaxed));
+  }
+  inc(total, other.total.load(std::memory_order_relaxed));
+  inc(sum, other.sum.load(std::memory_order_relaxed));
+  uint64_t other_max = other.max.load(std::memory_order_relaxed);
+  if (other_max > max.load(std::memory_order_relaxed)) {
+    max.store(other_max, std::memory_order_relaxed);
+  }
+}
+
+void hdr_histogram::reset()
+{
+  for (std::atomic<uint64_t>& b : buckets) {
+    b.store(0, std::memory_order_relaxed);
+  }
+  total.store(0, std::memory_order_relaxed);
+  sum.store(0, std::memory_order_relaxed);
+  max.store(0, std::memory_order_relaxed);
+}
+
+double hdr_histogram::mean() const
+{
+  uint64_t n = count();
+  return n ? (double)sum.load(std::memory_order_relaxed) / n : 0.0;
+}
+
+uint64_t hdr_histogram::percentile(double q) const
+{
+  uint64_t n = count();
+  if (n == 0) {
+    return 0;
+  }
+  uint64_t rank = (uint64_t)(q * n + 0.5);
+  rank          = std::max<uint64_t>(1, std::min<uint64_t>(rank, n));
+
+  uint64_t acc = 0;
+  for (uint32_t i = 0; i < NOF_BUCKETS; i++) {
+    acc += buckets[i].load(std::memory_order_relaxed);
+    if (acc >= rank) {
+      // Middle of the bucket, never above the largest recorded value
+      uint64_t lo = bucket_lower_bound(i);
+      uint64_t hi = (i + 1 < NOF_BUCKETS) ? bucket_lower_bound(i + 1) : lo + 1;
+      return std::min<uint64_t>(lo + (hi - lo) / 2, max_value());
+    }
+  }
+  return max_value();
+}
+
+/*******************
+ * Probe registry
+ *******************/
+
+namespace {
+
+struct thread_probes_t {
+  std::string                                 name;
+  std::array<hdr_histogram, nof_probe_points> hist;
+};
+
+struct probe_registry_t {
+  std::mutex                                    mutex;
+  std::vector<std::unique_ptr<thread_probes_t>> threads;
+  double                                        ns_per_tick = 1.0;
+  std::once_flag                                calibrated;
+};
+
+probe_registry_t& registry()
+{
+  static probe_registry_t* r = new probe_registry_t; // Never destroyed, threads may record until exit
+  return *r;
+}
+
+// Histograms of the calling thread, registered the first time it records. They are kept after the thread exits so
+// its samples remain in the statistics.
+thread_probes_t* local_probes()
+{
+  static thread_local thread_probes_t* local = nullptr;
+  if (local == nullptr) {
+    std::unique_ptr<thread_probes_t> t(new thread_probes_t);
+    char                             name[16] = {};
+    if (pthread_getname_np(pthread_self(), name, sizeof(name)) == 0) {
+      t->name = name;
+    }
+    local = t.get();
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    registry().threads.push_back(std::move(t));
+  }
+  return local;
+}
+
+void calibrate()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  auto     t0 = std::chrono::steady_clock::now();
+  uint64_t c0 = latency_probes::now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  auto     t1 = std::chrono::steady_clock::now();
+  uint64_t c1 = latency_probes::now();
+
+  double ns = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+  if (c1 > c0) {
+    registry().ns_per_tick = ns / (double)(c1 - c0);
+  }
+#endif
+}
+
+} // namespace
+
+std::atomic<bool> latency_probes::enabled{false};
+std::atomic<bool> latency_probes::dump_request{false};
+
+void latency_probes::set_enabled(bool enable)
+{
+  if (enable) {
+    std::call_once(registry().calibrated, calibrate);
+  }
+  enabled.store(enable, std::memory_order_relaxed);
+}
+
+void latency_probes::record(probe_point p, uint64_t ticks)
+{
+  if (p >= probe_point::nof_points) {
+    return;
+  }
+  uint64_t ns = (uint64_t)(ticks * registry().ns_per_tick);
+  local_probes()->hist[static_cast<uint32_t>(p)].record(ns);
+}
+
+void latency_probes::get_stats(latency_probe_stats_list_t& stats)
+{
+  using merged_t = std::array<hdr_histogram, nof_probe_points>;
+  std::unique_ptr<merged_t> merged(new merged_t);
+
+  {
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    for (const std::unique_ptr<thread_probes_t>& t : registry().threads) {
+      for (uint32_t i = 0; i < nof_probe_points; i++) {
+        (*merged)[i].merge(t->hist[i]);
+      }
+    }
+  }
+
+  for (uint32_t i = 0; i < nof_probe_points; i++) {
+    const hdr_histogram& h = (*merged)[i];
+    stats[i].count         = h.count();
+    stats[i].mean_us       = h.mean() / 1e3;
+    stats[i].p50_us        = h.percentile(0.5) / 1e3;
+    stats[i].p99_us        = h.percentile(0.99) / 1e3;
+    stats[i].p999_us       = h.percentile(0.999) / 1e3;
+    stats[i].max_us        = h.max_value() / 1e3;
+  }
+}
+
+void latency_probes::dump(FILE* f)
+{
+  if (not is_enabled()) {
+    fprintf(f, "Latency probes are disabled\n");
+    return;
+  }
+
+  latency_probe_stats_list_t stats;
+  get_stats(stats);
+
+  fprintf(f, "%-14s %10s %9s %9s %9s %9s %9s\n", "probe", "count", "mean", "p50", "p99", "p99.9", "max");
+  for (uint32_t i = 0; i < nof_probe_points; i++) {
+    const latency_probe_stats_t& s = stats[i];
+    if (s.count == 0) {
+      continue;
+    }
+    fprintf(f,
+            "%-14s %10lu %9.1f %9.1f %9.1f %9.1f %9.1f\n",
+            to_string(static_cast<probe_point>(i)),
+            (unsigned long)s.count,
+            s.mean_us,
+            s.p50_us,
+            s.p99_us,
+            s.p999_us,
+            s.max_us);
+  }
+  fprintf(f, "(times in usec)\n");
+  fflush(f);
+}
+
+void latency_probes::install_dump_handler(int signum)
+{
+  // The handler only raises the flag, the dump itself is done outside of the signal context
+  signal(signum, [](int) { dump_request.store(true); });
+}
+
+} // namespace srslte
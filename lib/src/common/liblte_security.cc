@@ -36,6 +36,7 @@
 
 #include "srslte/common/liblte_security.h"
 #include "math.h"
+#include "srslte/common/aes128.h"
 #include "srslte/common/liblte_ssl.h"
 #include "srslte/common/s3g.h"
 #include "srslte/common/zuc.h"
@@ -385,79 +386,28 @@ LIBLTE_ERROR_ENUM liblte_security_128_eia2(const uint8* key,
                                            uint32       msg_len,
                                            uint8*       mac)
 {
-  LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
-  uint8             M[msg_len + 8 + 16];
-  aes_context       ctx;
-  uint32            i;
-  uint32            j;
-  uint32            n;
-  uint32            pad_bits;
-  uint8             const_zero[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-  uint8             L[16];
-  uint8             K1[16];
-  uint8             K2[16];
-  uint8             T[16];
-  uint8             tmp[16];
+  LIBLTE_ERROR_ENUM        err = LIBLTE_ERROR_INVALID_INPUTS;
+  srslte::aes128_key_ctx_t ctx;
+  srslte::aes128_job_t     job = {};
+  uint8                    T[16];
+  uint32                   i;
 
   if (key != NULL && msg != NULL && mac != NULL) {
-    // Subkey L generation
-    aes_setkey_enc(&ctx, key, 128);
-    aes_crypt_ecb(&ctx, AES_ENCRYPT, const_zero, L);
-
-    // Subkey K1 generation
-    for (i = 0; i < 15; i++) {
-      K1[i] = (L[i] << 1) | ((L[i + 1] >> 7) & 0x01);
-    }
-    K1[15] = L[15] << 1;
-    if (L[0] & 0x80) {
-      K1[15] ^= 0x87;
-    }
-
-    // Subkey K2 generation
-    for (i = 0; i < 15; i++) {
-      K2[i] = (K1[i] << 1) | ((K1[i + 1] >> 7) & 0x01);
-    }
-    K2[15] = K1[15] << 1;
-    if (K1[0] & 0x80) {
-      K2[15] ^= 0x87;
-    }
-
-    // Construct M
-    memset(M, 0, msg_len + 8 + 16);
-    M[0] = (count >> 24) & 0xFF;
-    M[1] = (count >> 16) & 0xFF;
-    M[2] = (count >> 8) & 0xFF;
-    M[3] = count & 0xFF;
-    M[4] = (bearer << 3) | (direction << 2);
-    for (i = 0; i < msg_len; i++) {
-      M[8 + i] = msg[i];
-    }
+    // Key schedule and subkeys K1/K2
+    srslte::aes128_set_key(&ctx, key);
+
+    // First 8 bytes of M, followed by the message
+    job.iv[0] = (count >> 24) & 0xFF;
+    job.iv[1] = (count >> 16) & 0xFF;
+    job.iv[2] = (count >> 8) & 0xFF;
+    job.iv[3] = count & 0xFF;
+    job.iv[4] = (bearer << 3) | (direction << 2);
+    job.msg   = msg;
+    job.len   = msg_len;
+    job.out   = T;
 
     // MAC generation
-    n = (uint32)(ceilf((float)(msg_len + 8) / (float)(16)));
-    for (i = 0; i < 16; i++) {
-      T[i] = 0;
-    }
-    for (i = 0; i < n - 1; i++) {
-      for (j = 0; j < 16; j++) {
-        tmp[j] = T[j] ^ M[i * 16 + j];
-      }
-      aes_crypt_ecb(&ctx, AES_ENCRYPT, tmp, T);
-    }
-    pad_bits = ((msg_len * 8) + 64) % 128;
-    if (pad_bits == 0) {
-      for (j = 0; j < 16; j++) {
-        tmp[j] = T[j] ^ K1[j] ^ M[i * 16 + j];
-      }
-      aes_crypt_ecb(&ctx, AES_ENCRYPT, tmp, T);
-    } else {
-      pad_bits = (128 - pad_bits) - 1;
-      M[i * 16 + (15 - (pad_bits / 8))] |= 0x1 << (pad_bits % 8);
-      for (j = 0; j < 16; j++) {
-        tmp[j] = T[j] ^ K2[j] ^ M[i * 16 + j];
-      }
-      aes_crypt_ecb(&ctx, AES_ENCRYPT, tmp, T);
-    }
+    srslte::aes128_cmac(&ctx, &job, 1);
 
     for (i = 0; i < 4; i++) {
       mac[i] = T[i];
@@ -634,10 +584,24 @@ LIBLTE_ERROR_ENUM liblte_security_128_eia3(const uint8* key,
 
     zuc_generate_keystream(&zuc_state, L, ks);
 
+    // Process the message 32 bits at a time: the keystream word starting at bit 32 * w + j is taken from a 64 bit
+    // window over ks[w] and ks[w + 1], and selected with a mask instead of a branch per message bit
     uint32_t T = 0;
-    for (uint32_t i = 0; i < msg_len; i++) {
-      if (GET_BIT(msg, i)) {
-        T ^= GET_WORD(ks, i);
+    for (uint32_t w = 0; w < msg_len_block_32; w++) {
+      uint32_t m = 0;
+      for (uint32_t b = 0; b < 4; b++) {
+        m <<= 8;
+        if (4 * w + b < msg_len_block_8) {
+          m |= msg[4 * w + b];
+        }
+      }
+      if (msg_len - 32 * w < 32) {
+        m &= ~(0xFFFFFFFF >> (msg_len - 32 * w));
+      }
+
+      uint64_t win = ((uint64_t)ks[w] << 32) | ks[w + 1];
+      for (uint32_t j = 0; j < 32; j++) {
+        T ^= (uint32_t)(win >> (32 - j)) & (0 - ((m >> (31 - j)) & 1));
       }
     }
 
@@ -650,6 +614,8 @@ LIBLTE_ERROR_ENUM liblte_security_128_eia3(const uint8* key,
     mac[3]           = mac_tmp & 0xFF;
 
     free(ks);
+
+    err = LIBLTE_SUCCESS;
   }
 
   return (err);
@@ -768,34 +734,29 @@ LIBLTE_ERROR_ENUM liblte_security_encryption_eea2(uint8* key,
                                                   uint32 msg_len,
                                                   uint8* out)
 {
-  LIBLTE_ERROR_ENUM err = LIBLTE_ERROR_INVALID_INPUTS;
-  aes_context       ctx;
-  unsigned char     stream_blk[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-  unsigned char     nonce_cnt[16]  = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-  int32             i;
-  int               ret;
-  size_t            nc_off = 0;
+  LIBLTE_ERROR_ENUM        err = LIBLTE_ERROR_INVALID_INPUTS;
+  srslte::aes128_key_ctx_t ctx;
+  srslte::aes128_job_t     job = {};
 
   if (key != NULL && msg != NULL && out != NULL) {
-    ret = aes_setkey_enc(&ctx, key, 128);
-
-    if (ret == 0) {
-      // Construct nonce
-      nonce_cnt[0] = (count >> 24) & 0xFF;
-      nonce_cnt[1] = (count >> 16) & 0xFF;
-      nonce_cnt[2] = (count >> 8) & 0xFF;
-      nonce_cnt[3] = (count)&0xFF;
-      nonce_cnt[4] = ((bearer & 0x1F) << 3) | ((direction & 0x01) << 2);
-
-      // Encryption
-      ret = aes_crypt_ctr(&ctx, (msg_len + 7) / 8, &nc_off, nonce_cnt, stream_blk, msg, out);
-    }
+    srslte::aes128_set_key(&ctx, key);
 
-    if (ret == 0) {
-      // Zero tailing bits
-      zero_tailing_bits(out, msg_len);
-      err = LIBLTE_SUCCESS;
-    }
+    // Construct nonce
+    job.iv[0] = (count >> 24) & 0xFF;
+    job.iv[1] = (count >> 16) & 0xFF;
+    job.iv[2] = (count >> 8) & 0xFF;
+    job.iv[3] = (count)&0xFF;
+    job.iv[4] = ((bearer & 0x1F) << 3) | ((direction & 0x01) << 2);
+    job.msg   = msg;
+    job.len   = (msg_len + 7) / 8;
+    job.out   = out;
+
+    // Encryption
+    srslte::aes128_ctr(&ctx, &job, 1);
+
+    // Zero tailing bits
+    zero_tailing_bits(out, msg_len);
+    err = LIBLTE_SUCCESS;
   }
 
   return (err);
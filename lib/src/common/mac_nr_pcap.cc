@@ -29,7 +29,7 @@ mac_nr_pcap::mac_nr_pcap() {}
 
 mac_nr_pcap::~mac_nr_pcap()
 {
-  if (pcap_file) {
+  if (writer.is_open()) {
     close();
   }
 }
@@ -38,20 +38,25 @@ void mac_nr_pcap::enable(const bool& enable_)
 {
   enable_write = enable_;
 }
-void mac_nr_pcap::open(const std::string& filename_, const uint16_t& ue_id_)
+void mac_nr_pcap::open(const std::string& filename_, const uint16_t& ue_id_, const pcap_writer_args_t& args)
 {
   fprintf(stdout, "Opening MAC-NR PCAP with DLT=%d\n", UDP_DLT);
-  filename     = filename_;
-  pcap_file    = LTE_PCAP_Open(UDP_DLT, filename.c_str());
+  filename = filename_;
+  writer.open(filename, UDP_DLT, args);
   ue_id        = ue_id_;
   enable_write = true;
 }
 void mac_nr_pcap::close()
 {
   enable_write = false;
-  fprintf(stdout, "Saving MAC-NR PCAP to %s\n", filename.c_str());
-  LTE_PCAP_Close(pcap_file);
-  pcap_file = nullptr;
+  writer.close();
+  pcap_writer_stats_t stats = writer.get_stats();
+  fprintf(stdout,
+          "Saving MAC-NR PCAP to %s (%" PRIu64 " packets, %" PRIu64 " dropped, %" PRIu64 " filtered)\n",
+          filename.c_str(),
+          stats.nof_records,
+          stats.nof_dropped,
+          stats.nof_filtered);
 }
 
 void mac_nr_pcap::set_ue_id(const uint16_t& ue_id_)
@@ -68,6 +73,10 @@ void mac_nr_pcap::pack_and_write(uint8_t* pdu,
                                  uint8_t  rnti_type)
 {
   if (enable_write) {
+    if (rnti_type == C_RNTI and not filter.match_rnti(crnti)) {
+      writer.count_filtered();
+      return;
+    }
     mac_nr_context_info_t context = {};
     context.radioType             = FDD_RADIO;
     context.direction             = direction;
@@ -79,7 +88,9 @@ void mac_nr_pcap::pack_and_write(uint8_t* pdu,
     context.sub_frame_number      = tti % 10;
 
     if (pdu) {
-      NR_PCAP_MAC_WritePDU(pcap_file, &context, pdu, pdu_len_bytes);
+      uint8_t context_header[PCAP_CONTEXT_HEADER_MAX];
+      int     context_len = NR_PCAP_MAC_Pack_Context(context_header, &context, pdu_len_bytes);
+      writer.write(context_header, context_len, pdu, pdu_len_bytes);
     }
   }
 }
@@ -27,7 +27,7 @@
 
 namespace srslte {
 
-mac_pcap::mac_pcap() : enable_write(false), ue_id(0), pcap_file(nullptr) {}
+mac_pcap::mac_pcap() : enable_write(false), ue_id(0) {}
 
 mac_pcap::~mac_pcap()
 {
@@ -38,19 +38,23 @@ void mac_pcap::enable(bool en)
 {
   enable_write = true;
 }
-void mac_pcap::open(const char* filename, uint32_t ue_id)
+void mac_pcap::open(const char* filename, uint32_t ue_id, const pcap_writer_args_t& args)
 {
-  pcap_file    = LTE_PCAP_Open(MAC_LTE_DLT, filename);
+  writer.open(filename, MAC_LTE_DLT, args);
   this->ue_id  = ue_id;
   enable_write = true;
 }
 void mac_pcap::close()
 {
   enable_write = false;
-  if (pcap_file != nullptr) {
-    fprintf(stdout, "Saving MAC PCAP file\n");
-    LTE_PCAP_Close(pcap_file);
-    pcap_file = nullptr;
+  if (writer.is_open()) {
+    writer.close();
+    pcap_writer_stats_t stats = writer.get_stats();
+    fprintf(stdout,
+            "Saving MAC PCAP file (%" PRIu64 " packets, %" PRIu64 " dropped, %" PRIu64 " filtered)\n",
+            stats.nof_records,
+            stats.nof_dropped,
+            stats.nof_filtered);
   }
 }
 
@@ -70,6 +74,10 @@ void mac_pcap::pack_and_write(uint8_t* pdu,
                               uint8_t  rnti_type)
 {
   if (enable_write) {
+    if ((rnti_type == C_RNTI or rnti_type == SL_RNTI) and not filter.match_rnti(crnti)) {
+      writer.count_filtered();
+      return;
+    }
     MAC_Context_Info_t context = {};
     context.radioType          = FDD_RADIO;
     context.direction          = direction;
@@ -82,7 +90,9 @@ void mac_pcap::pack_and_write(uint8_t* pdu,
     context.sysFrameNumber     = (uint16_t)(tti / 10);
     context.subFrameNumber     = (uint16_t)(tti % 10);
     if (pdu) {
-      LTE_PCAP_MAC_WritePDU(pcap_file, &context, pdu, pdu_len_bytes);
+      uint8_t context_header[PCAP_CONTEXT_HEADER_MAX];
+      int     context_len = LTE_PCAP_MAC_Pack_Context(context_header, &context);
+      writer.write(context_header, context_len, pdu, pdu_len_bytes);
     }
   }
 }
@@ -30,24 +30,30 @@ void nas_pcap::enable()
 {
   enable_write = true;
 }
-void nas_pcap::open(const char* filename, uint32_t ue_id_)
+void nas_pcap::open(const char* filename, uint32_t ue_id_, const pcap_writer_args_t& args)
 {
-  pcap_file    = LTE_PCAP_Open(NAS_LTE_DLT, filename);
+  writer.open(filename, NAS_LTE_DLT, args);
   ue_id        = ue_id_;
   enable_write = true;
 }
 void nas_pcap::close()
 {
-  fprintf(stdout, "Saving NAS PCAP file (DLT=%d)\n", NAS_LTE_DLT);
-  LTE_PCAP_Close(pcap_file);
+  enable_write = false;
+  writer.close();
+  pcap_writer_stats_t stats = writer.get_stats();
+  fprintf(stdout,
+          "Saving NAS PCAP file (DLT=%d, %" PRIu64 " packets, %" PRIu64 " dropped)\n",
+          NAS_LTE_DLT,
+          stats.nof_records,
+          stats.nof_dropped);
 }
 
 void nas_pcap::write_nas(uint8_t* pdu, uint32_t pdu_len_bytes)
 {
   if (enable_write) {
-    NAS_Context_Info_t context;
+    // NAS records have no context header
     if (pdu) {
-      LTE_PCAP_NAS_WritePDU(pcap_file, &context, pdu, pdu_len_bytes);
+      writer.write(nullptr, 0, pdu, pdu_len_bytes);
     }
   }
 }
@@ -401,6 +401,69 @@ private:
   callback_t                func;
 };
 
+/**
+ * Description: Variant of recvfrom_pdu_task that drains up to max_batch datagrams per socket
+ * wakeup with recvmmsg(...), and hands them over to the callback in a single call. The
+ * receive buffers not filled by a call are kept for the next one.
+ */
+class recvmmsg_pdu_task final : public rx_multisocket_handler::recv_task
+{
+public:
+  static const uint32_t max_batch = 32;
+
+  using callback_t = rx_multisocket_handler::recvmmsg_callback_t;
+  explicit recvmmsg_pdu_task(srslte::byte_buffer_pool* pool_, srslte::log_ref log_, callback_t func_) :
+    pool(pool_),
+    log_h(log_),
+    func(std::move(func_))
+  {
+  }
+
+  bool operator()(int fd) override
+  {
+    for (uint32_t i = 0; i < max_batch; i++) {
+      if (bufs[i] == nullptr) {
+        bufs[i] = srslte::allocate_unique_buffer(*pool, "Rxsocket", true);
+      }
+      iovs[i].iov_base            = bufs[i]->msg;
+      iovs[i].iov_len             = bufs[i]->get_tailroom();
+      msgs[i]                     = {};
+      msgs[i].msg_hdr.msg_name    = &from[i];
+      msgs[i].msg_hdr.msg_namelen = sizeof(from[i]);
+      msgs[i].msg_hdr.msg_iov     = &iovs[i];
+      msgs[i].msg_hdr.msg_iovlen  = 1;
+    }
+
+    int n_recv = recvmmsg(fd, msgs, max_batch, MSG_DONTWAIT, nullptr);
+    if (n_recv == -1 and errno != EAGAIN) {
+      log_h->error("Error reading from socket: %s\n", strerror(errno));
+      return true;
+    }
+    if (n_recv == -1 and errno == EAGAIN) {
+      log_h->debug("Socket timeout reached\n");
+      return true;
+    }
+
+    srslte::unique_byte_buffer_list_t pdus;
+    pdus.reserve(n_recv);
+    for (int i = 0; i < n_recv; i++) {
+      bufs[i]->N_bytes = msgs[i].msg_len;
+      pdus.push_back(std::move(bufs[i]));
+    }
+    func(std::move(pdus), std::vector<sockaddr_in>(from, from + n_recv));
+    return true;
+  }
+
+private:
+  srslte::byte_buffer_pool*    pool = nullptr;
+  srslte::log_ref              log_h;
+  callback_t                   func;
+  srslte::unique_byte_buffer_t bufs[max_batch];
+  mmsghdr                      msgs[max_batch] = {};
+  iovec                        iovs[max_batch] = {};
+  sockaddr_in                  from[max_batch] = {};
+};
+
 class sctp_recvmsg_pdu_task final : public rx_multisocket_handler::recv_task
 {
 public:
@@ -519,6 +582,16 @@ bool rx_multisocket_handler::add_socket_sctp_pdu_handler(int fd, sctp_recv_callb
   return add_socket_handler(fd, std::move(task));
 }
 
+/**
+ * Convenience method for reading batches of PDUs from socket
+ */
+bool rx_multisocket_handler::add_socket_pdu_batch_handler(int fd, recvmmsg_callback_t pdu_task)
+{
+  srslte::rx_multisocket_handler::task_callback_t task;
+  task.reset(new srslte::recvmmsg_pdu_task(pool, log_h, std::move(pdu_task)));
+  return add_socket_handler(fd, std::move(task));
+}
+
 bool rx_multisocket_handler::add_socket_handler(int fd, task_callback_t handler)
 {
   std::lock_guard<std::mutex> lock(socket_mutex);
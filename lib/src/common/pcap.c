@@ -25,18 +25,23 @@
 #include <string.h>
 #include <sys/time.h>
 
+/* Fill in the header written at the start of every file */
+void LTE_PCAP_Init_File_Header(pcap_hdr_t* file_header, uint32_t DLT)
+{
+  file_header->magic_number  = 0xa1b2c3d4;
+  file_header->version_major = 2;
+  file_header->version_minor = 4;     /* version number is 2.4 */
+  file_header->thiszone      = 0;     /* timezone */
+  file_header->sigfigs       = 0;     /* sigfigs - apparently all tools do this */
+  file_header->snaplen       = 65535; /* snaplen - this should be long enough */
+  file_header->network       = DLT;   /* Data Link Type (DLT).  Set as unused value 147 for now */
+}
+
 /* Open the file and write file header */
 FILE* LTE_PCAP_Open(uint32_t DLT, const char* fileName)
 {
-  pcap_hdr_t file_header = {
-      0xa1b2c3d4, /* magic number */
-      2,
-      4,     /* version number is 2.4 */
-      0,     /* timezone */
-      0,     /* sigfigs - apparently all tools do this */
-      65535, /* snaplen - this should be long enough */
-      DLT    /* Data Link Type (DLT).  Set as unused value 147 for now */
-  };
+  pcap_hdr_t file_header;
+  LTE_PCAP_Init_File_Header(&file_header, DLT);
 
   FILE* fd = fopen(fileName, "w");
   if (fd == NULL) {
@@ -58,13 +63,25 @@ void LTE_PCAP_Close(FILE* fd)
   }
 }
 
-/* Write an individual PDU (PCAP packet header + mac-context + mac-pdu) */
-int LTE_PCAP_MAC_WritePDU(FILE* fd, MAC_Context_Info_t* context, const unsigned char* PDU, unsigned int length)
+/* Fill in the PCAP packet header of a record with the current time */
+void LTE_PCAP_Init_Packet_Header(pcaprec_hdr_t* packet_header, unsigned int length)
+{
+  struct timeval t;
+  gettimeofday(&t, NULL);
+  packet_header->ts_sec   = t.tv_sec;
+  packet_header->ts_usec  = t.tv_usec;
+  packet_header->incl_len = length;
+  packet_header->orig_len = length;
+}
+
+/* Write the header, the context header and the PDU of a record */
+static int LTE_PCAP_Write_Record(FILE*                fd,
+                                 const uint8_t*       context_header,
+                                 int                  offset,
+                                 const unsigned char* PDU,
+                                 unsigned int         length)
 {
   pcaprec_hdr_t packet_header;
-  char          context_header[256];
-  int           offset = 0;
-  uint16_t      tmp16;
 
   /* Can't write if file wasn't successfully opened */
   if (fd == NULL) {
@@ -72,6 +89,27 @@ int LTE_PCAP_MAC_WritePDU(FILE* fd, MAC_Context_Info_t* context, const unsigned
     return 0;
   }
 
+  /****************************************************************/
+  /* PCAP Header                                                  */
+  LTE_PCAP_Init_Packet_Header(&packet_header, offset + length);
+
+  /***************************************************************/
+  /* Now write everything to the file                            */
+  fwrite(&packet_header, sizeof(pcaprec_hdr_t), 1, fd);
+  if (offset > 0) {
+    fwrite(context_header, 1, offset, fd);
+  }
+  fwrite(PDU, 1, length, fd);
+
+  return 1;
+}
+
+/* Pack the mac-context that precedes a MAC PDU */
+int LTE_PCAP_MAC_Pack_Context(uint8_t* context_header, const MAC_Context_Info_t* context)
+{
+  int      offset = 0;
+  uint16_t tmp16;
+
   /*****************************************************************/
   /* Context information (same as written by UDP heuristic clients */
   context_header[offset++] = context->radioType;
@@ -113,69 +151,32 @@ int LTE_PCAP_MAC_WritePDU(FILE* fd, MAC_Context_Info_t* context, const unsigned
   /* Data tag immediately preceding PDU */
   context_header[offset++] = MAC_LTE_PAYLOAD_TAG;
 
-  /****************************************************************/
-  /* PCAP Header                                                  */
-  struct timeval t;
-  gettimeofday(&t, NULL);
-  packet_header.ts_sec   = t.tv_sec;
-  packet_header.ts_usec  = t.tv_usec;
-  packet_header.incl_len = offset + length;
-  packet_header.orig_len = offset + length;
-
-  /***************************************************************/
-  /* Now write everything to the file                            */
-  fwrite(&packet_header, sizeof(pcaprec_hdr_t), 1, fd);
-  fwrite(context_header, 1, offset, fd);
-  fwrite(PDU, 1, length, fd);
+  return offset;
+}
 
-  return 1;
+/* Write an individual PDU (PCAP packet header + mac-context + mac-pdu) */
+int LTE_PCAP_MAC_WritePDU(FILE* fd, MAC_Context_Info_t* context, const unsigned char* PDU, unsigned int length)
+{
+  uint8_t context_header[PCAP_CONTEXT_HEADER_MAX];
+  int     offset = LTE_PCAP_MAC_Pack_Context(context_header, context);
+  return LTE_PCAP_Write_Record(fd, context_header, offset, PDU, length);
 }
 
 /* Write an individual PDU (PCAP packet header + nas-context + nas-pdu) */
 int LTE_PCAP_NAS_WritePDU(FILE* fd, NAS_Context_Info_t* context, const unsigned char* PDU, unsigned int length)
 {
-  pcaprec_hdr_t packet_header;
-
-  /* Can't write if file wasn't successfully opened */
-  if (fd == NULL) {
-    printf("Error: Can't write to empty file handle\n");
-    return 0;
-  }
-
-  /****************************************************************/
-  /* PCAP Header                                                  */
-  struct timeval t;
-  gettimeofday(&t, NULL);
-  packet_header.ts_sec   = t.tv_sec;
-  packet_header.ts_usec  = t.tv_usec;
-  packet_header.incl_len = length;
-  packet_header.orig_len = length;
-
-  /***************************************************************/
-  /* Now write everything to the file                            */
-  fwrite(&packet_header, sizeof(pcaprec_hdr_t), 1, fd);
-  fwrite(PDU, 1, length, fd);
-
-  return 1;
+  return LTE_PCAP_Write_Record(fd, NULL, 0, PDU, length);
 }
 
 /**************************************************************************
  * API functions for writing RLC-LTE PCAP files                           *
  **************************************************************************/
 
-/* Write an individual RLC PDU (PCAP packet header + UDP header + rlc-context + rlc-pdu) */
-int LTE_PCAP_RLC_WritePDU(FILE* fd, RLC_Context_Info_t* context, const unsigned char* PDU, unsigned int length)
+/* Pack the UDP header and rlc-context that precede an RLC PDU of the given length */
+int LTE_PCAP_RLC_Pack_Context(uint8_t* context_header, const RLC_Context_Info_t* context, unsigned int length)
 {
-  pcaprec_hdr_t packet_header;
-  char          context_header[256] = {};
-  int           offset = 0;
-  uint16_t      tmp16;
-
-  /* Can't write if file wasn't successfully opened */
-  if (fd == NULL) {
-    printf("Error: Can't write to empty file handle\n");
-    return 0;
-  }
+  int      offset = 0;
+  uint16_t tmp16;
 
   /*****************************************************************/
 
@@ -233,65 +234,31 @@ int LTE_PCAP_RLC_WritePDU(FILE* fd, RLC_Context_Info_t* context, const unsigned
   // Now the actual PDU
   context_header[offset++] = RLC_LTE_PAYLOAD_TAG;
 
-  // PCAP header
-  struct timeval t;
-  gettimeofday(&t, NULL);
-  packet_header.ts_sec   = t.tv_sec;
-  packet_header.ts_usec  = t.tv_usec;
-  packet_header.incl_len = offset + length;
-  packet_header.orig_len = offset + length;
-
-  // Write everything to file
-  fwrite(&packet_header, sizeof(pcaprec_hdr_t), 1, fd);
-  fwrite(context_header, 1, offset, fd);
-  fwrite(PDU, 1, length, fd);
+  return offset;
+}
 
-  return 1;
+/* Write an individual RLC PDU (PCAP packet header + UDP header + rlc-context + rlc-pdu) */
+int LTE_PCAP_RLC_WritePDU(FILE* fd, RLC_Context_Info_t* context, const unsigned char* PDU, unsigned int length)
+{
+  uint8_t context_header[PCAP_CONTEXT_HEADER_MAX];
+  int     offset = LTE_PCAP_RLC_Pack_Context(context_header, context, length);
+  return LTE_PCAP_Write_Record(fd, context_header, offset, PDU, length);
 }
 
 /* Write an individual PDU (PCAP packet header + s1ap-context + s1ap-pdu) */
 int LTE_PCAP_S1AP_WritePDU(FILE* fd, S1AP_Context_Info_t* context, const unsigned char* PDU, unsigned int length)
 {
-  pcaprec_hdr_t packet_header;
-
-  /* Can't write if file wasn't successfully opened */
-  if (fd == NULL) {
-    printf("Error: Can't write to empty file handle\n");
-    return 0;
-  }
-
-  /****************************************************************/
-  /* PCAP Header                                                  */
-  struct timeval t;
-  gettimeofday(&t, NULL);
-  packet_header.ts_sec   = t.tv_sec;
-  packet_header.ts_usec  = t.tv_usec;
-  packet_header.incl_len = length;
-  packet_header.orig_len = length;
-
-  /***************************************************************/
-  /* Now write everything to the file                            */
-  fwrite(&packet_header, sizeof(pcaprec_hdr_t), 1, fd);
-  fwrite(PDU, 1, length, fd);
-
-  return 1;
+  return LTE_PCAP_Write_Record(fd, NULL, 0, PDU, length);
 }
 
 /**************************************************************************
  * API functions for writing MAC-NR PCAP files                           *
  **************************************************************************/
 
-/* Write an individual NR MAC PDU (PCAP packet header + UDP header + nr-mac-context + mac-pdu) */
-int NR_PCAP_MAC_WritePDU(FILE* fd, mac_nr_context_info_t* context, const unsigned char* PDU, unsigned int length)
+/* Pack the UDP header and nr-mac-context that precede an NR MAC PDU of the given length */
+int NR_PCAP_MAC_Pack_Context(uint8_t* context_header, const mac_nr_context_info_t* context, unsigned int length)
 {
-  char context_header[256] = {};
-  int  offset              = 0;
-
-  /* Can't write if file wasn't successfully opened */
-  if (fd == NULL) {
-    printf("Error: Can't write to empty file handle\n");
-    return 0;
-  }
+  int offset = 0;
 
   // Add dummy UDP header, start with src and dest port
   context_header[offset++] = 0xde;
@@ -347,21 +314,13 @@ int NR_PCAP_MAC_WritePDU(FILE* fd, mac_nr_context_info_t* context, const unsigne
   /* Data tag immediately preceding PDU */
   context_header[offset++] = MAC_LTE_PAYLOAD_TAG;
 
-  /****************************************************************/
-  /* PCAP Header                                                  */
-  struct timeval t;
-  gettimeofday(&t, NULL);
-  pcaprec_hdr_t packet_header;
-  packet_header.ts_sec   = t.tv_sec;
-  packet_header.ts_usec  = t.tv_usec;
-  packet_header.incl_len = offset + length;
-  packet_header.orig_len = offset + length;
-
-  /***************************************************************/
-  /* Now write everything to the file                            */
-  fwrite(&packet_header, sizeof(pcaprec_hdr_t), 1, fd);
-  fwrite(context_header, 1, offset, fd);
-  fwrite(PDU, 1, length, fd);
+  return offset;
+}
 
-  return 1;
+/* Write an individual NR MAC PDU (PCAP packet header + UDP header + nr-mac-context + mac-pdu) */
+int NR_PCAP_MAC_WritePDU(FILE* fd, mac_nr_context_info_t* context, const unsigned char* PDU, unsigned int length)
+{
+  uint8_t context_header[PCAP_CONTEXT_HEADER_MAX];
+  int     offset = NR_PCAP_MAC_Pack_Context(context_header, context, length);
+  return LTE_PCAP_Write_Record(fd, context_header, offset, PDU, length);
 }
\ No newline at end of file
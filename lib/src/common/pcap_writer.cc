@@ -0,0 +1,414 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srslte/common/pcap_writer.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+namespace srslte {
+
+/*
+ * Every record in the ring starts with this header, followed by the PCAP packet header, the context header and the PDU,
+ * padded to a multiple of 8 bytes. size is the number of ring bytes taken by the record. It is stored last, with
+ * release semantics, which hands the record over to the writer thread. A record that does not fit before the end of
+ * the ring is preceded by a padding record covering the rest of the ring. The writer zeroes the bytes it consumes, so
+ * a zero size means the record at that position is not complete yet.
+ */
+struct pcap_writer::record_header_t {
+  std::atomic<uint32_t> size;
+  uint32_t              len; // PCAP bytes following this header
+};
+
+static const uint32_t record_padding_flag = 1u << 31;
+static const uint32_t record_alignment    = 8;
+static const uint64_t min_ring_size       = 64 * 1024;
+
+/*******************************************************
+ *                    pcap_filter
+ *******************************************************/
+
+static bool parse_list(const std::string& list, uint32_t max_value, std::vector<uint32_t>& values)
+{
+  values.clear();
+  size_t pos = 0;
+  while (pos < list.size()) {
+    size_t end = list.find(',', pos);
+    if (end == std::string::npos) {
+      end = list.size();
+    }
+    size_t first = list.find_first_not_of(" \t", pos);
+    size_t last  = list.find_last_not_of(" \t", end - 1);
+    if (first < end and last != std::string::npos and last >= first) {
+      std::string   item = list.substr(first, last - first + 1);
+      char*         item_end;
+      unsigned long value;
+      errno = 0;
+      value = strtoul(item.c_str(), &item_end, 0);
+      if (*item_end != '\0' or errno != 0 or value > max_value) {
+        return false;
+      }
+      values.push_back(value);
+    }
+    pos = end + 1;
+  }
+  return true;
+}
+
+void pcap_filter::set_rntis(const std::vector<uint16_t>& rntis_)
+{
+  rntis.reset();
+  for (uint16_t rnti : rntis_) {
+    rntis.set(rnti);
+  }
+  all_rntis = rntis_.empty();
+}
+
+void pcap_filter::set_lcids(const std::vector<uint32_t>& lcids_)
+{
+  lcids.reset();
+  for (uint32_t lcid : lcids_) {
+    if (lcid < max_lcids) {
+      lcids.set(lcid);
+    }
+  }
+  all_lcids = lcids_.empty();
+}
+
+bool pcap_filter::set_rntis(const std::string& list)
+{
+  std::vector<uint32_t> values;
+  if (not parse_list(list, UINT16_MAX, values)) {
+    return false;
+  }
+  set_rntis(std::vector<uint16_t>(values.begin(), values.end()));
+  return true;
+}
+
+bool pcap_filter::set_lcids(const std::string& list)
+{
+  std::vector<uint32_t> values;
+  if (not parse_list(list, max_lcids - 1, values)) {
+    return false;
+  }
+  set_lcids(values);
+  return true;
+}
+
+/*******************************************************
+ *                    pcap_writer
+ *******************************************************/
+
+pcap_writer::pcap_writer() : thread("PCAP_WRITER") {}
+
+pcap_writer::~pcap_writer()
+{
+  close();
+}
+
+bool pcap_writer::open(const std::string& filename, uint32_t dlt_, const pcap_writer_args_t& args_)
+{
+  close();
+
+  args          = args_;
+  base_filename = filename;
+  dlt           = dlt_;
+
+  uint64_t size = min_ring_size;
+  while (size < (uint64_t)args.ring_size_kb * 1024) {
+    size <<= 1;
+  }
+  if (size != ring_size) {
+    ring.reset(new uint8_t[size]());
+    ring_size = size;
+  } else {
+    memset(ring.get(), 0, ring_size);
+  }
+  head.store(0, std::memory_order_relaxed);
+  tail.store(0, std::memory_order_relaxed);
+  batch.clear();
+  batch.reserve((size_t)args.batch_size_kb * 1024);
+
+  nof_records.store(0, std::memory_order_relaxed);
+  nof_bytes.store(0, std::memory_order_relaxed);
+  nof_dropped.store(0, std::memory_order_relaxed);
+  nof_filtered.store(0, std::memory_order_relaxed);
+  nof_write_errors.store(0, std::memory_order_relaxed);
+  nof_files.store(0, std::memory_order_relaxed);
+
+  if (not open_file()) {
+    return false;
+  }
+
+  running.store(true, std::memory_order_relaxed);
+  accepting.store(true, std::memory_order_release);
+  start();
+  return true;
+}
+
+void pcap_writer::close()
+{
+  if (not running.load(std::memory_order_relaxed)) {
+    return;
+  }
+  accepting.store(false, std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    running.store(false, std::memory_order_relaxed);
+  }
+  cvar.notify_one();
+  wait_thread_finish();
+}
+
+bool pcap_writer::write(const uint8_t* context, uint32_t context_len, const uint8_t* pdu, uint32_t pdu_len)
+{
+  if (not accepting.load(std::memory_order_acquire)) {
+    nof_dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  uint32_t len  = sizeof(pcaprec_hdr_t) + context_len + pdu_len;
+  uint64_t size = (sizeof(record_header_t) + len + record_alignment - 1) & ~(uint64_t)(record_alignment - 1);
+  if (size > ring_size / 2) {
+    nof_dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  // Reserve size bytes, plus the rest of the ring if the record would wrap around
+  uint64_t pos = head.load(std::memory_order_relaxed);
+  uint64_t need, used;
+  do {
+    uint64_t offset = pos & (ring_size - 1);
+    need            = size + (offset + size > ring_size ? ring_size - offset : 0);
+    used            = pos - tail.load(std::memory_order_acquire);
+    if (used + need > ring_size) {
+      nof_dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+  } while (not head.compare_exchange_weak(pos, pos + need, std::memory_order_relaxed));
+
+  if (need != size) {
+    uint64_t         skip    = ring_size - (pos & (ring_size - 1));
+    record_header_t* padding = header_at(pos);
+    padding->len             = 0;
+    padding->size.store(skip | record_padding_flag, std::memory_order_release);
+    pos += skip;
+  }
+
+  record_header_t* hdr = header_at(pos);
+  uint8_t*         ptr = reinterpret_cast<uint8_t*>(hdr + 1);
+  pcaprec_hdr_t    packet_header;
+  LTE_PCAP_Init_Packet_Header(&packet_header, context_len + pdu_len);
+  memcpy(ptr, &packet_header, sizeof(packet_header));
+  ptr += sizeof(packet_header);
+  if (context_len > 0) {
+    memcpy(ptr, context, context_len);
+    ptr += context_len;
+  }
+  memcpy(ptr, pdu, pdu_len);
+  hdr->len = len;
+  hdr->size.store(size, std::memory_order_release);
+
+  // Wake up the writer early if the ring is filling up faster than the flush period
+  if (used < ring_size / 2 and used + need >= ring_size / 2) {
+    cvar.notify_one();
+  }
+  return true;
+}
+
+pcap_writer_stats_t pcap_writer::get_stats() const
+{
+  pcap_writer_stats_t stats = {};
+  stats.nof_records         = nof_records.load(std::memory_order_relaxed);
+  stats.nof_bytes           = nof_bytes.load(std::memory_order_relaxed);
+  stats.nof_dropped         = nof_dropped.load(std::memory_order_relaxed);
+  stats.nof_filtered        = nof_filtered.load(std::memory_order_relaxed);
+  stats.nof_write_errors    = nof_write_errors.load(std::memory_order_relaxed);
+  stats.nof_files           = nof_files.load(std::memory_order_relaxed);
+  return stats;
+}
+
+std::string pcap_writer::get_filename() const
+{
+  std::lock_guard<std::mutex> lock(filename_mutex);
+  return cur_filename;
+}
+
+pcap_writer::record_header_t* pcap_writer::header_at(uint64_t pos) const
+{
+  return reinterpret_cast<record_header_t*>(ring.get() + (pos & (ring_size - 1)));
+}
+
+void pcap_writer::run_thread()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  while (running.load(std::memory_order_relaxed)) {
+    lock.unlock();
+    bool progress = drain();
+    if (rotation_due()) {
+      rotate();
+    }
+    if (not progress) {
+      flush_batch();
+    }
+    lock.lock();
+    if (not progress and running.load(std::memory_order_relaxed)) {
+      cvar.wait_for(lock, std::chrono::milliseconds(args.flush_period_ms));
+    }
+  }
+  lock.unlock();
+
+  // Producers that got past the accepting check before close() may still be copying their record
+  for (uint32_t i = 0; i < 100 and tail.load(std::memory_order_relaxed) != head.load(std::memory_order_acquire); i++) {
+    if (not drain()) {
+      usleep(1000);
+    }
+  }
+  close_file();
+}
+
+bool pcap_writer::drain()
+{
+  bool     progress = false;
+  uint64_t pos      = tail.load(std::memory_order_relaxed);
+  while (true) {
+    record_header_t* hdr  = header_at(pos);
+    uint32_t         size = hdr->size.load(std::memory_order_acquire);
+    if (size == 0) {
+      break;
+    }
+    uint32_t nof_bytes_ring = size & ~record_padding_flag;
+    if ((size & record_padding_flag) == 0) {
+      if (args.max_file_size_mb > 0 and file_bytes > sizeof(pcap_hdr_t) and
+          file_bytes + hdr->len > (uint64_t)args.max_file_size_mb * 1024 * 1024) {
+        rotate();
+      }
+      append(reinterpret_cast<const uint8_t*>(hdr + 1), hdr->len);
+      nof_records.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Hand the space back to the producers with all bytes zeroed, see record_header_t
+    hdr->size.store(0, std::memory_order_relaxed);
+    memset(reinterpret_cast<uint8_t*>(hdr) + sizeof(hdr->size), 0, nof_bytes_ring - sizeof(hdr->size));
+    pos += nof_bytes_ring;
+    tail.store(pos, std::memory_order_release);
+    progress = true;
+  }
+  return progress;
+}
+
+void pcap_writer::append(const uint8_t* data, uint32_t len)
+{
+  batch.insert(batch.end(), data, data + len);
+  file_bytes += len;
+  if (batch.size() >= (size_t)args.batch_size_kb * 1024) {
+    flush_batch();
+  }
+}
+
+void pcap_writer::flush_batch()
+{
+  if (batch.empty()) {
+    return;
+  }
+  size_t offset = 0;
+  while (fd >= 0 and offset < batch.size()) {
+    ssize_t n = ::write(fd, batch.data() + offset, batch.size() - offset);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      break;
+    }
+    offset += n;
+  }
+  if (offset < batch.size()) {
+    nof_write_errors.fetch_add(1, std::memory_order_relaxed);
+  }
+  nof_bytes.fetch_add(offset, std::memory_order_relaxed);
+  batch.clear();
+}
+
+bool pcap_writer::open_file()
+{
+  // The first file gets the configured name, rotated ones get _<n> inserted before the extension
+  std::string name  = base_filename;
+  uint32_t    index = nof_files.load(std::memory_order_relaxed);
+  if (index > 0) {
+    size_t slash = name.rfind('/');
+    size_t dot   = name.rfind('.');
+    if (dot == std::string::npos or (slash != std::string::npos and dot < slash)) {
+      dot = name.size();
+    }
+    name.insert(dot, "_" + std::to_string(index));
+  }
+
+  fd = ::open(name.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    printf("Failed to open file \"%s\" for writing\n", name.c_str());
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(filename_mutex);
+    cur_filename = name;
+  }
+  nof_files.fetch_add(1, std::memory_order_relaxed);
+  clock_gettime(CLOCK_MONOTONIC, &file_start);
+
+  pcap_hdr_t file_header;
+  LTE_PCAP_Init_File_Header(&file_header, dlt);
+  file_bytes = 0;
+  append(reinterpret_cast<const uint8_t*>(&file_header), sizeof(file_header));
+  return true;
+}
+
+void pcap_writer::close_file()
+{
+  flush_batch();
+  if (fd >= 0) {
+    ::close(fd);
+    fd = -1;
+  }
+}
+
+void pcap_writer::rotate()
+{
+  close_file();
+  // If the new file can't be created, records are counted as write errors until the next rotation attempt
+  open_file();
+}
+
+bool pcap_writer::rotation_due() const
+{
+  if (args.max_file_size_mb > 0 and file_bytes >= (uint64_t)args.max_file_size_mb * 1024 * 1024) {
+    return true;
+  }
+  if (args.rotate_period_s > 0) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec - file_start.tv_sec >= (time_t)args.rotate_period_s;
+  }
+  return false;
+}
+
+} // namespace srslte
@@ -31,10 +31,10 @@ void rlc_pcap::enable(bool en)
   enable_write = true;
 }
 
-void rlc_pcap::open(const char* filename, rlc_config_t config)
+void rlc_pcap::open(const char* filename, rlc_config_t config, const pcap_writer_args_t& args)
 {
   fprintf(stdout, "Opening RLC PCAP with DLT=%d\n", UDP_DLT);
-  pcap_file    = LTE_PCAP_Open(UDP_DLT, filename);
+  writer.open(filename, UDP_DLT, args);
   enable_write = true;
 
   if (config.rlc_mode == rlc_mode_t::am) {
@@ -53,8 +53,14 @@ void rlc_pcap::open(const char* filename, rlc_config_t config)
 }
 void rlc_pcap::close()
 {
-  fprintf(stdout, "Saving RLC PCAP file\n");
-  LTE_PCAP_Close(pcap_file);
+  enable_write = false;
+  writer.close();
+  pcap_writer_stats_t stats = writer.get_stats();
+  fprintf(stdout,
+          "Saving RLC PCAP file (%" PRIu64 " packets, %" PRIu64 " dropped, %" PRIu64 " filtered)\n",
+          stats.nof_records,
+          stats.nof_dropped,
+          stats.nof_filtered);
 }
 
 void rlc_pcap::set_ue_id(uint16_t ue_id_)
@@ -73,6 +79,10 @@ void rlc_pcap::pack_and_write(uint8_t* pdu,
                               uint16_t channel_id)
 {
   if (enable_write) {
+    if (not filter.match_rnti(ueid) or not filter.match_lcid(channel_id)) {
+      writer.count_filtered();
+      return;
+    }
     RLC_Context_Info_t context;
     context.rlcMode              = mode_;
     context.direction            = direction;
@@ -83,7 +93,9 @@ void rlc_pcap::pack_and_write(uint8_t* pdu,
     context.channelId            = channel_id;
     context.pduLength            = pdu_len_bytes;
     if (pdu) {
-      LTE_PCAP_RLC_WritePDU(pcap_file, &context, pdu, pdu_len_bytes);
+      uint8_t context_header[PCAP_CONTEXT_HEADER_MAX];
+      int     context_len = LTE_PCAP_RLC_Pack_Context(context_header, &context, pdu_len_bytes);
+      writer.write(context_header, context_len, pdu, pdu_len_bytes);
     }
   }
 }
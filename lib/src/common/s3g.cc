@@ -160,6 +160,28 @@ void s3g_deinitialize(S3G_STATE* state);
 *********************************************************************/
 void s3g_generate_keystream(S3G_STATE* state, uint32_t n, uint32_t* ks);
 
+/*********************************************************************
+    Name: s3g_tables
+
+    Description: Word-oriented lookup tables, built on first use from
+                 the byte-oriented definitions below. MULalpha and
+                 DIValpha are indexed by the byte being multiplied, the
+                 S1/S2 tables by the input byte position, so that each
+                 S-box evaluation is four lookups and three XORs.
+
+    Document Reference: Specification of the 3GPP Confidentiality and
+                            Integrity Algorithms UEA2 & UIA2 D2 v1.1
+                            Sections 3.3 and 3.4
+*********************************************************************/
+typedef struct {
+  uint32_t mul_alpha[256];
+  uint32_t div_alpha[256];
+  uint32_t s1[4][256];
+  uint32_t s2[4][256];
+} S3G_TABLES;
+
+static const S3G_TABLES* s3g_tables();
+
 /*********************************************************************
     Name: s3g_mul_x
 
@@ -291,10 +313,10 @@ uint32_t s3g_s2(uint32_t w)
 *********************************************************************/
 void s3g_clock_lfsr(S3G_STATE* state, uint32_t f)
 {
-  uint32_t v = (((state->lfsr[0] << 8) & 0xffffff00) ^ (s3g_mul_alpha((uint8_t)((state->lfsr[0] >> 24) & 0xff))) ^
-                (state->lfsr[2]) ^ ((state->lfsr[11] >> 8) & 0x00ffffff) ^
-                (s3g_div_alpha((uint8_t)((state->lfsr[11]) & 0xff))) ^ (f));
-  uint8_t  i;
+  const S3G_TABLES* t = s3g_tables();
+  uint32_t v = (state->lfsr[0] << 8) ^ t->mul_alpha[state->lfsr[0] >> 24] ^ state->lfsr[2] ^ (state->lfsr[11] >> 8) ^
+               t->div_alpha[state->lfsr[11] & 0xff] ^ f;
+  uint8_t i;
 
   for (i = 0; i < 15; i++) {
     state->lfsr[i] = state->lfsr[i + 1];
@@ -316,8 +338,12 @@ uint32_t s3g_clock_fsm(S3G_STATE* state)
   uint32_t f = ((state->lfsr[15] + state->fsm[0]) & 0xffffffff) ^ state->fsm[1];
   uint32_t r = (state->fsm[1] + (state->fsm[2] ^ state->lfsr[5])) & 0xffffffff;
 
-  state->fsm[2] = s3g_s2(state->fsm[1]);
-  state->fsm[1] = s3g_s1(state->fsm[0]);
+  const S3G_TABLES* t = s3g_tables();
+  uint32_t          r1 = state->fsm[0];
+  uint32_t          r2 = state->fsm[1];
+
+  state->fsm[2] = t->s2[0][r2 >> 24] ^ t->s2[1][(r2 >> 16) & 0xff] ^ t->s2[2][(r2 >> 8) & 0xff] ^ t->s2[3][r2 & 0xff];
+  state->fsm[1] = t->s1[0][r1 >> 24] ^ t->s1[1][(r1 >> 16) & 0xff] ^ t->s1[2][(r1 >> 8) & 0xff] ^ t->s1[3][r1 & 0xff];
   state->fsm[0] = r;
 
   return f;
@@ -337,9 +363,6 @@ void s3g_initialize(S3G_STATE* state, uint32_t k[4], uint32_t iv[4])
   uint8_t  i = 0;
   uint32_t f = 0x0;
 
-  state->lfsr = (uint32_t*)calloc(16, sizeof(uint32_t));
-  state->fsm  = (uint32_t*)calloc(3, sizeof(uint32_t));
-
   state->lfsr[15] = k[3] ^ iv[0];
   state->lfsr[14] = k[2];
   state->lfsr[13] = k[1];
@@ -377,8 +400,7 @@ void s3g_initialize(S3G_STATE* state, uint32_t k[4], uint32_t iv[4])
 *********************************************************************/
 void s3g_deinitialize(S3G_STATE* state)
 {
-  free(state->lfsr);
-  free(state->fsm);
+  // The state holds no dynamically allocated memory
 }
 
 /*********************************************************************
@@ -392,20 +414,88 @@ void s3g_deinitialize(S3G_STATE* state)
 *********************************************************************/
 void s3g_generate_keystream(S3G_STATE* state, uint32_t n, uint32_t* ks)
 {
-  uint32_t t = 0;
-  uint32_t f = 0x0;
+  const S3G_TABLES* t    = s3g_tables();
+  uint32_t*         lfsr = state->lfsr;
+  uint32_t          tmp[16];
+  uint32_t          i;
 
   // Clock FSM once. Discard the output.
   s3g_clock_fsm(state);
   //  Clock LFSR in keystream mode once.
   s3g_clock_lfsr(state, 0x0);
 
-  for (t = 0; t < n; t++) {
-    f = s3g_clock_fsm(state);
-    // Note that ks[t] corresponds to z_{t+1} in section 4.2
-    ks[t] = f ^ state->lfsr[0];
-    s3g_clock_lfsr(state, 0x0);
+  // The LFSR is used as a circular buffer instead of shifting all 16 words on every clock: at clock i the logical
+  // s_k is stored at lfsr[(i + k) % 16], and the new s_15 overwrites the outgoing s_0.
+  uint32_t r1 = state->fsm[0];
+  uint32_t r2 = state->fsm[1];
+  uint32_t r3 = state->fsm[2];
+  for (i = 0; i < n; i++) {
+#define S3G_S(k) lfsr[(i + (k)) & 15]
+    uint32_t s0  = S3G_S(0);
+    uint32_t s11 = S3G_S(11);
+
+    // Clock FSM, note that ks[i] corresponds to z_{i+1} in section 4.2
+    uint32_t f = (S3G_S(15) + r1) ^ r2;
+    uint32_t r = r2 + (r3 ^ S3G_S(5));
+    r3         = t->s2[0][r2 >> 24] ^ t->s2[1][(r2 >> 16) & 0xff] ^ t->s2[2][(r2 >> 8) & 0xff] ^ t->s2[3][r2 & 0xff];
+    r2         = t->s1[0][r1 >> 24] ^ t->s1[1][(r1 >> 16) & 0xff] ^ t->s1[2][(r1 >> 8) & 0xff] ^ t->s1[3][r1 & 0xff];
+    r1         = r;
+    ks[i]      = f ^ s0;
+
+    // Clock LFSR in keystream mode
+    S3G_S(0) = (s0 << 8) ^ t->mul_alpha[s0 >> 24] ^ S3G_S(2) ^ (s11 >> 8) ^ t->div_alpha[s11 & 0xff];
+#undef S3G_S
+  }
+  state->fsm[0] = r1;
+  state->fsm[1] = r2;
+  state->fsm[2] = r3;
+
+  // Restore the canonical order of the LFSR words
+  if ((n & 15) != 0) {
+    for (i = 0; i < 16; i++) {
+      tmp[i] = lfsr[(n + i) & 15];
+    }
+    memcpy(lfsr, tmp, sizeof(tmp));
+  }
+}
+
+/*********************************************************************
+    Name: s3g_tables
+
+    Description: Word-oriented lookup tables.
+*********************************************************************/
+static uint32_t s3g_ror8(uint32_t w)
+{
+  return (w >> 8) | (w << 24);
+}
+
+static S3G_TABLES s3g_build_tables()
+{
+  S3G_TABLES t;
+  for (uint32_t c = 0; c < 256; c++) {
+    t.mul_alpha[c] = s3g_mul_alpha((uint8_t)c);
+    t.div_alpha[c] = s3g_div_alpha((uint8_t)c);
+
+    // Contribution of the most significant input byte to the output of s3g_s1/s3g_s2, the other byte positions
+    // are rotations of it
+    uint8_t sr = S[c];
+    uint8_t sq = SQ[c];
+    uint8_t mr = s3g_mul_x(sr, 0x1b);
+    uint8_t mq = s3g_mul_x(sq, 0x69);
+    t.s1[0][c] = ((uint32_t)mr << 24) | ((uint32_t)(mr ^ sr) << 16) | ((uint32_t)sr << 8) | sr;
+    t.s2[0][c] = ((uint32_t)mq << 24) | ((uint32_t)(mq ^ sq) << 16) | ((uint32_t)sq << 8) | sq;
+    for (uint32_t j = 1; j < 4; j++) {
+      t.s1[j][c] = s3g_ror8(t.s1[j - 1][c]);
+      t.s2[j][c] = s3g_ror8(t.s2[j - 1][c]);
+    }
   }
+  return t;
+}
+
+static const S3G_TABLES* s3g_tables()
+{
+  static const S3G_TABLES tables = s3g_build_tables();
+  return &tables;
 }
 
 /* MUL64x.
@@ -454,9 +544,27 @@ uint64_t s3g_MUL64(uint64_t V, uint64_t P, uint64_t c)
   uint64_t result = 0;
   int      i      = 0;
 
+  // Sum of MUL64xPOW(V, i, c) over the set bits i of P, with the powers of V computed incrementally
   for (i = 0; i < 64; i++) {
     if ((P >> i) & 0x1)
-      result ^= s3g_MUL64xPOW(V, i, c);
+      result ^= V;
+    V = s3g_MUL64x(V, c);
+  }
+  return result;
+}
+
+/* MUL64 with a fixed operand.
+ * Input V: a 64-bit input.
+ * Input P_pow: MUL64xPOW(P, i, c) for i = 0..63.
+ * Output : MUL64(V, P, c), computed without data dependent branches.
+ */
+static uint64_t s3g_MUL64_pow(uint64_t V, const uint64_t* P_pow)
+{
+  uint64_t result = 0;
+  int      i      = 0;
+
+  for (i = 0; i < 64; i++) {
+    result ^= P_pow[i] & (0 - ((V >> i) & 0x1));
   }
   return result;
 }
@@ -491,6 +599,7 @@ uint8_t* s3g_f9(const uint8_t* key, uint32_t count, uint32_t fresh, uint32_t dir
   uint64_t       P;
   uint64_t       Q;
   uint64_t       c;
+  uint64_t       P_pow[64];
   S3G_STATE      state, *state_ptr;
 
   uint64_t M_D_2;
@@ -524,12 +633,17 @@ uint8_t* s3g_f9(const uint8_t* key, uint32_t count, uint32_t fresh, uint32_t dir
   EVAL = 0;
   c    = 0x1b;
 
+  /* Powers of P, shared by all the message blocks */
+  P_pow[0] = P;
+  for (i = 1; i < 64; i++)
+    P_pow[i] = s3g_MUL64x(P_pow[i - 1], c);
+
   /* for 0 <= i <= D-3 */
   for (i = 0; i < D - 2; i++) {
     V    = EVAL ^ ((uint64_t)data[8 * i] << 56 | (uint64_t)data[8 * i + 1] << 48 | (uint64_t)data[8 * i + 2] << 40 |
                 (uint64_t)data[8 * i + 3] << 32 | (uint64_t)data[8 * i + 4] << 24 | (uint64_t)data[8 * i + 5] << 16 |
                 (uint64_t)data[8 * i + 6] << 8 | (uint64_t)data[8 * i + 7]);
-    EVAL = s3g_MUL64(V, P, c);
+    EVAL = s3g_MUL64_pow(V, P_pow);
   }
 
   /* for D-2 */
@@ -548,7 +662,7 @@ uint8_t* s3g_f9(const uint8_t* key, uint32_t count, uint32_t fresh, uint32_t dir
     M_D_2 |= (uint64_t)(data[8 * (D - 2) + i] & mask8bit(rem_bits)) << (8 * (7 - i));
 
   V    = EVAL ^ M_D_2;
-  EVAL = s3g_MUL64(V, P, c);
+  EVAL = s3g_MUL64_pow(V, P_pow);
 
   /* for D-1 */
   EVAL ^= length;
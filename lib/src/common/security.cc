@@ -22,6 +22,7 @@
 #include "srslte/common/security.h"
 #include "srslte/common/liblte_security.h"
 #include "srslte/common/s3g.h"
+#include <algorithm>
 
 #ifdef HAVE_MBEDTLS
 #include "mbedtls/md5.h"
@@ -30,8 +31,22 @@
 #include "polarssl/md5.h"
 #endif
 
+#define SECURITY_AES128_MAX_BATCH 16
+#define SECURITY_MILENAGE_MAX_BATCH 16
+
 namespace srslte {
 
+// Builds the EEA2 initial counter block / first 8 bytes of the EIA2 message M, 33.401 B.1.3 and B.2.3
+static void security_aes128_iv(uint32_t count, uint8_t bearer, uint8_t direction, uint8_t* iv)
+{
+  memset(iv, 0, AES128_BLOCK_LEN);
+  iv[0] = (count >> 24) & 0xFF;
+  iv[1] = (count >> 16) & 0xFF;
+  iv[2] = (count >> 8) & 0xFF;
+  iv[3] = count & 0xFF;
+  iv[4] = ((bearer & 0x1F) << 3) | ((direction & 0x01) << 2);
+}
+
 /******************************************************************************
  * Key Generation
  *****************************************************************************/
@@ -127,6 +142,48 @@ uint8_t security_128_eia2(const uint8_t* key,
   return liblte_security_128_eia2(key, count, bearer, direction, msg, msg_len, mac);
 }
 
+uint8_t security_128_eia2(const aes128_key_ctx_t* ctx,
+                          uint32_t                count,
+                          uint32_t                bearer,
+                          uint8_t                 direction,
+                          uint8_t*                msg,
+                          uint32_t                msg_len,
+                          uint8_t*                mac)
+{
+  security_pdu_t pdu = {msg, msg_len, count, mac};
+  return security_128_eia2_batch(ctx, bearer, direction, &pdu, 1);
+}
+
+uint8_t security_128_eia2_batch(const aes128_key_ctx_t* ctx,
+                                uint32_t                bearer,
+                                uint8_t                 direction,
+                                security_pdu_t*         pdus,
+                                uint32_t                nof_pdus)
+{
+  aes128_job_t jobs[SECURITY_AES128_MAX_BATCH];
+  uint8_t      tags[SECURITY_AES128_MAX_BATCH][AES128_BLOCK_LEN];
+
+  if (ctx == nullptr || not ctx->valid || pdus == nullptr) {
+    return SRSLTE_ERROR;
+  }
+
+  for (uint32_t first = 0; first < nof_pdus; first += SECURITY_AES128_MAX_BATCH) {
+    uint32_t nof_jobs = std::min(nof_pdus - first, (uint32_t)SECURITY_AES128_MAX_BATCH);
+    for (uint32_t i = 0; i < nof_jobs; i++) {
+      const security_pdu_t& pdu = pdus[first + i];
+      jobs[i].msg               = pdu.msg;
+      jobs[i].len               = pdu.msg_len;
+      jobs[i].out               = tags[i];
+      security_aes128_iv(pdu.count, bearer, direction, jobs[i].iv);
+    }
+    aes128_cmac(ctx, jobs, nof_jobs);
+    for (uint32_t i = 0; i < nof_jobs; i++) {
+      memcpy(pdus[first + i].out, tags[i], 4);
+    }
+  }
+  return SRSLTE_SUCCESS;
+}
+
 uint8_t security_128_eia3(const uint8_t* key,
                           uint32_t       count,
                           uint32_t       bearer,
@@ -178,6 +235,44 @@ uint8_t security_128_eea2(uint8_t* key,
   return liblte_security_encryption_eea2(key, count, bearer, direction, msg, msg_len * 8, msg_out);
 }
 
+uint8_t security_128_eea2(const aes128_key_ctx_t* ctx,
+                          uint32_t                count,
+                          uint8_t                 bearer,
+                          uint8_t                 direction,
+                          uint8_t*                msg,
+                          uint32_t                msg_len,
+                          uint8_t*                msg_out)
+{
+  security_pdu_t pdu = {msg, msg_len, count, msg_out};
+  return security_128_eea2_batch(ctx, bearer, direction, &pdu, 1);
+}
+
+uint8_t security_128_eea2_batch(const aes128_key_ctx_t* ctx,
+                                uint8_t                 bearer,
+                                uint8_t                 direction,
+                                security_pdu_t*         pdus,
+                                uint32_t                nof_pdus)
+{
+  aes128_job_t jobs[SECURITY_AES128_MAX_BATCH];
+
+  if (ctx == nullptr || not ctx->valid || pdus == nullptr) {
+    return SRSLTE_ERROR;
+  }
+
+  for (uint32_t first = 0; first < nof_pdus; first += SECURITY_AES128_MAX_BATCH) {
+    uint32_t nof_jobs = std::min(nof_pdus - first, (uint32_t)SECURITY_AES128_MAX_BATCH);
+    for (uint32_t i = 0; i < nof_jobs; i++) {
+      const security_pdu_t& pdu = pdus[first + i];
+      jobs[i].msg               = pdu.msg;
+      jobs[i].len               = pdu.msg_len;
+      jobs[i].out               = pdu.out;
+      security_aes128_iv(pdu.count, bearer, direction, jobs[i].iv);
+    }
+    aes128_ctr(ctx, jobs, nof_jobs);
+  }
+  return SRSLTE_SUCCESS;
+}
+
 uint8_t security_128_eea3(uint8_t* key,
                           uint32_t count,
                           uint8_t  bearer,
@@ -219,4 +314,86 @@ uint8_t security_milenage_f5_star(uint8_t* k, uint8_t* op, uint8_t* rand, uint8_
   return liblte_security_milenage_f5_star(k, op, rand, ak);
 }
 
+void security_milenage_init(milenage_ctx_t* ctx, const uint8_t* k, const uint8_t* opc)
+{
+  aes128_set_key(&ctx->k, k);
+  memcpy(ctx->opc, opc, sizeof(ctx->opc));
+}
+
+uint8_t security_milenage_f12345_batch(milenage_vector_t* vectors, uint32_t nof_vectors)
+{
+  // Rotation (in bytes) and constant of f1, f2, f3 and f4, TS 35.206 Section 4.1
+  static const uint32_t rot[4] = {8, 0, 12, 8};
+  static const uint8_t  c[4]   = {0, 1, 2, 4};
+
+  const aes128_key_ctx_t* ctxs[SECURITY_MILENAGE_MAX_BATCH * 4];
+  uint8_t                 temp[SECURITY_MILENAGE_MAX_BATCH][AES128_BLOCK_LEN];
+  uint8_t                 out[SECURITY_MILENAGE_MAX_BATCH * 4][AES128_BLOCK_LEN];
+
+  if (vectors == nullptr) {
+    return SRSLTE_ERROR;
+  }
+
+  for (uint32_t first = 0; first < nof_vectors; first += SECURITY_MILENAGE_MAX_BATCH) {
+    uint32_t           nof = std::min(nof_vectors - first, (uint32_t)SECURITY_MILENAGE_MAX_BATCH);
+    milenage_vector_t* v   = &vectors[first];
+
+    // TEMP = E_K(RAND xor OPc)
+    for (uint32_t i = 0; i < nof; i++) {
+      if (v[i].ctx == nullptr || not v[i].ctx->k.valid) {
+        return SRSLTE_ERROR;
+      }
+      ctxs[i] = &v[i].ctx->k;
+      for (uint32_t j = 0; j < AES128_BLOCK_LEN; j++) {
+        temp[i][j] = v[i].rand[j] ^ v[i].ctx->opc[j];
+      }
+    }
+    aes128_ecb_multi(ctxs, temp, nof);
+
+    // OUT1 to OUT4 are independent, so the 4 blocks of all vectors go through the cipher together
+    for (uint32_t i = 0; i < nof; i++) {
+      const uint8_t* opc = v[i].ctx->opc;
+      uint8_t        in1[AES128_BLOCK_LEN];
+      memcpy(&in1[0], v[i].sqn, 6);
+      memcpy(&in1[6], v[i].amf, 2);
+      memcpy(&in1[8], v[i].sqn, 6);
+      memcpy(&in1[14], v[i].amf, 2);
+
+      for (uint32_t f = 0; f < 4; f++) {
+        uint8_t* blk    = out[4 * i + f];
+        ctxs[4 * i + f] = &v[i].ctx->k;
+        for (uint32_t j = 0; j < AES128_BLOCK_LEN; j++) {
+          if (f == 0) {
+            blk[(j + rot[f]) % AES128_BLOCK_LEN] = in1[j] ^ opc[j];
+          } else {
+            blk[(j + rot[f]) % AES128_BLOCK_LEN] = temp[i][j] ^ opc[j];
+          }
+        }
+        if (f == 0) {
+          for (uint32_t j = 0; j < AES128_BLOCK_LEN; j++) {
+            blk[j] ^= temp[i][j];
+          }
+        }
+        blk[AES128_BLOCK_LEN - 1] ^= c[f];
+      }
+    }
+    aes128_ecb_multi(ctxs, out, 4 * nof);
+
+    for (uint32_t i = 0; i < nof; i++) {
+      const uint8_t* opc = v[i].ctx->opc;
+      for (uint32_t f = 0; f < 4; f++) {
+        for (uint32_t j = 0; j < AES128_BLOCK_LEN; j++) {
+          out[4 * i + f][j] ^= opc[j];
+        }
+      }
+      memcpy(v[i].mac_a, &out[4 * i][0], 8);
+      memcpy(v[i].res, &out[4 * i + 1][8], 8);
+      memcpy(v[i].ak, &out[4 * i + 1][0], 6);
+      memcpy(v[i].ck, out[4 * i + 2], 16);
+      memcpy(v[i].ik, out[4 * i + 3], 16);
+    }
+  }
+  return SRSLTE_SUCCESS;
+}
+
 } // namespace srslte
@@ -0,0 +1,422 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srslte/common/thread_topology.h"
+#include <algorithm>
+#include <dirent.h>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1
+#endif
+
+namespace srslte {
+
+namespace {
+
+struct class_prefix_t {
+  const char* prefix;
+  const char* class_name;
+};
+
+// Thread name prefixes of every class. The longest matching prefix wins, so SYNC_INTRA_MEASURE is not taken by SYNC
+const class_prefix_t class_prefixes[] = {{"WORKER", "phy_worker"},
+                                         {"TXRX", "txrx"},
+                                         {"SYNC", "txrx"},
+                                         {"PRACH_WORKER", "prach"},
+                                         {"SYNC_INTRA", "measure"},
+                                         {"STACK", "stack"},
+                                         {"gNB", "stack"},
+                                         {"ENBSOCKETS", "sockets"},
+                                         {"GW_RX", "gw"},
+                                         {"TASKWORKER", "task_worker"},
+                                         {"SRSLOG", "log"},
+                                         {"RIC", "ric"},
+                                         {"TIMER_QUEUE", "ric_timer"},
+                                         {"METRICS_HUB", "metrics"},
+                                         {"PCAP_WRITER", "pcap"},
+                                         {"MME", "mme"},
+                                         {"SPGW", "spgw"},
+                                         {"MBMS_GW", "mbms_gw"}};
+
+std::string cpu_list_to_string(const cpu_set_t& set)
+{
+  std::string s;
+  for (int i = 0; i < CPU_SETSIZE; i++) {
+    if (not CPU_ISSET(i, &set)) {
+      continue;
+    }
+    int j = i;
+    while (j + 1 < CPU_SETSIZE and CPU_ISSET(j + 1, &set)) {
+      j++;
+    }
+    if (not s.empty()) {
+      s += ",";
+    }
+    s += std::to_string(i);
+    if (j > i) {
+      s += "-" + std::to_string(j);
+    }
+    i = j;
+  }
+  return s;
+}
+
+const char* policy_to_string(int policy)
+{
+  switch (policy) {
+    case SCHED_FIFO:
+      return "fifo";
+    case SCHED_RR:
+      return "rr";
+    case SCHED_OTHER:
+      return "other";
+    default:
+      return "?";
+  }
+}
+
+std::vector<pid_t> list_tasks()
+{
+  std::vector<pid_t> tids;
+  DIR*               dir = opendir("/proc/self/task");
+  if (dir == nullptr) {
+    return tids;
+  }
+  while (struct dirent* e = readdir(dir)) {
+    if (e->d_name[0] != '.') {
+      tids.push_back((pid_t)strtol(e->d_name, nullptr, 10));
+    }
+  }
+  closedir(dir);
+  std::sort(tids.begin(), tids.end());
+  return tids;
+}
+
+std::string task_name(pid_t tid)
+{
+  std::ifstream f("/proc/self/task/" + std::to_string(tid) + "/comm");
+  std::string   name;
+  std::getline(f, name);
+  return name;
+}
+
+} // namespace
+
+thread_topology& thread_topology::get()
+{
+  static thread_topology instance;
+  return instance;
+}
+
+const std::vector<std::string>& thread_topology::class_names()
+{
+  static const std::vector<std::string> names = [] {
+    std::vector<std::string> v;
+    for (const class_prefix_t& p : class_prefixes) {
+      if (std::find(v.begin(), v.end(), p.class_name) == v.end()) {
+        v.push_back(p.class_name);
+      }
+    }
+    return v;
+  }();
+  return names;
+}
+
+std::string thread_topology::classify(const std::string& thread_name)
+{
+  const class_prefix_t* best     = nullptr;
+  size_t                best_len = 0;
+  for (const class_prefix_t& p : class_prefixes) {
+    size_t len = strlen(p.prefix);
+    if (len > best_len and thread_name.compare(0, len, p.prefix) == 0) {
+      best     = &p;
+      best_len = len;
+    }
+  }
+  return best != nullptr ? best->class_name : "";
+}
+
+bool thread_topology::parse_cpu_list(const std::string& list, cpu_set_t* set)
+{
+  CPU_ZERO(set);
+  size_t pos = 0;
+  size_t end = 0;
+  while (end < list.size()) {
+    end = list.find(',', pos);
+    if (end == std::string::npos) {
+      end = list.size();
+    }
+    std::string item = list.substr(pos, end - pos);
+    item.erase(std::remove(item.begin(), item.end(), ' '), item.end());
+
+    char* endptr = nullptr;
+    long  first  = strtol(item.c_str(), &endptr, 10);
+    long  last   = first;
+    if (endptr == item.c_str()) {
+      return false;
+    }
+    if (*endptr == '-') {
+      const char* start = endptr + 1;
+      last              = strtol(start, &endptr, 10);
+      if (endptr == start) {
+        return false;
+      }
+    }
+    if (*endptr != '\0' or first < 0 or last < first or last >= CPU_SETSIZE) {
+      return false;
+    }
+    for (long cpu = first; cpu <= last; cpu++) {
+      CPU_SET(cpu, set);
+    }
+    pos = end + 1;
+  }
+  return CPU_COUNT(set) > 0;
+}
+
+bool thread_topology::parse_policy(const std::string& policy, int* sched_policy)
+{
+  std::string p = policy;
+  std::transform(p.begin(), p.end(), p.begin(), ::tolower);
+  if (p == "fifo") {
+    *sched_policy = SCHED_FIFO;
+  } else if (p == "rr") {
+    *sched_policy = SCHED_RR;
+  } else if (p == "other") {
+    *sched_policy = SCHED_OTHER;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool thread_topology::configure(const thread_topology_args_t& args)
+{
+  std::map<std::string, class_cfg_t> new_cfg;
+
+  if (args.numa) {
+    scan_numa_nodes();
+  }
+
+  for (const auto& entry : args.classes) {
+    const thread_class_args_t& a = entry.second;
+    if (std::find(class_names().begin(), class_names().end(), entry.first) == class_names().end()) {
+      fprintf(stderr, "Error: unknown thread class '%s'\n", entry.first.c_str());
+      return false;
+    }
+    if (a.cpus.empty() and a.policy.empty()) {
+      continue;
+    }
+
+    class_cfg_t c = {};
+    if (not a.cpus.empty()) {
+      if (not parse_cpu_list(a.cpus, &c.cpus)) {
+        fprintf(stderr, "Error: invalid CPU list '%s' for thread class %s\n", a.cpus.c_str(), entry.first.c_str());
+        return false;
+      }
+      c.has_cpus  = true;
+      c.numa_node = args.numa ? node_of(c.cpus) : -1;
+    }
+    if (not a.policy.empty()) {
+      if (not parse_policy(a.policy, &c.policy)) {
+        fprintf(stderr, "Error: invalid policy '%s' for thread class %s\n", a.policy.c_str(), entry.first.c_str());
+        return false;
+      }
+      c.has_policy = true;
+      if (c.policy != SCHED_OTHER) {
+        int min = sched_get_priority_min(c.policy);
+        int max = sched_get_priority_max(c.policy);
+        c.prio  = a.prio < 0 ? min : a.prio;
+        if (c.prio < min or c.prio > max) {
+          fprintf(stderr,
+                  "Error: priority %d of thread class %s out of range [%d, %d]\n",
+                  a.prio,
+                  entry.first.c_str(),
+                  min,
+                  max);
+          return false;
+        }
+      }
+    }
+    new_cfg[entry.first] = c;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    cfg  = std::move(new_cfg);
+    numa = args.numa;
+  }
+  configured = not cfg.empty();
+
+  // Move the threads started before the layout was known, e.g. the log backend
+  pid_t self = (pid_t)syscall(SYS_gettid);
+  for (pid_t tid : list_tasks()) {
+    if (tid != self) {
+      apply(tid, task_name(tid));
+    }
+  }
+
+  // Buffers allocated while initializing the PHY are mostly touched by the workers
+  if (numa) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto                        it = cfg.find("phy_worker");
+    if (it != cfg.end() and it->second.numa_node >= 0) {
+      unsigned long mask = 1UL << it->second.numa_node;
+      if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, &mask, sizeof(mask) * 8) < 0) {
+        perror("set_mempolicy");
+      }
+    }
+  }
+  return true;
+}
+
+void thread_topology::apply_self(const std::string& thread_name)
+{
+  if (not configured) {
+    return;
+  }
+  apply(0, thread_name);
+}
+
+bool thread_topology::apply(pid_t tid, const std::string& thread_name)
+{
+  std::string cls = classify(thread_name);
+  if (cls.empty()) {
+    return true;
+  }
+
+  class_cfg_t c;
+  bool        use_numa;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto                        it = cfg.find(cls);
+    if (it == cfg.end()) {
+      return true;
+    }
+    c        = it->second;
+    use_numa = numa;
+  }
+
+  bool ret = true;
+  if (c.has_cpus and sched_setaffinity(tid, sizeof(c.cpus), &c.cpus) != 0) {
+    fprintf(stderr,
+            "Warning: could not pin thread %s to CPUs %s\n",
+            thread_name.c_str(),
+            cpu_list_to_string(c.cpus).c_str());
+    ret = false;
+  }
+  if (c.has_policy) {
+    struct sched_param param = {};
+    param.sched_priority     = c.prio;
+    if (sched_setscheduler(tid, c.policy, &param) != 0) {
+      fprintf(stderr,
+              "Warning: could not set %s priority %d to thread %s\n",
+              policy_to_string(c.policy),
+              c.prio,
+              thread_name.c_str());
+      ret = false;
+    }
+  }
+  // The memory policy can only be set by the thread itself
+  if (use_numa and tid == 0 and c.numa_node >= 0) {
+    unsigned long mask = 1UL << c.numa_node;
+    if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, &mask, sizeof(mask) * 8) < 0) {
+      ret = false;
+    }
+  }
+  return ret;
+}
+
+void thread_topology::scan_numa_nodes()
+{
+  numa_nodes.clear();
+  for (uint32_t n = 0; n < sizeof(unsigned long) * 8; n++) {
+    std::ifstream f("/sys/devices/system/node/node" + std::to_string(n) + "/cpulist");
+    std::string   list;
+    if (not f.is_open() or not std::getline(f, list)) {
+      break;
+    }
+    cpu_set_t set;
+    if (not parse_cpu_list(list, &set)) {
+      CPU_ZERO(&set);
+    }
+    numa_nodes.push_back(set);
+  }
+}
+
+int thread_topology::node_of(const cpu_set_t& set) const
+{
+  for (uint32_t n = 0; n < numa_nodes.size(); n++) {
+    cpu_set_t inter;
+    CPU_AND(&inter, &set, &numa_nodes[n]);
+    if (CPU_EQUAL(&inter, &set)) {
+      return n;
+    }
+  }
+  // CPU set spans several nodes
+  return -1;
+}
+
+void thread_topology::print_report(FILE* f) const
+{
+  struct row_t {
+    std::string cls;
+    pid_t       tid;
+    std::string name;
+  };
+  std::vector<row_t> rows;
+  for (pid_t tid : list_tasks()) {
+    std::string name = task_name(tid);
+    std::string cls  = classify(name);
+    rows.push_back({cls.empty() ? "-" : cls, tid, name});
+  }
+  std::stable_sort(rows.begin(), rows.end(), [](const row_t& a, const row_t& b) { return a.cls < b.cls; });
+
+  fprintf(f, "\n==== Thread topology ====\n");
+  fprintf(f, "%-12s %-16s %7s %-6s %4s %-16s %s\n", "class", "thread", "tid", "policy", "prio", "cpus", "node");
+  for (const row_t& r : rows) {
+    cpu_set_t          set   = {};
+    struct sched_param param = {};
+    int                pol   = sched_getscheduler(r.tid);
+    sched_getparam(r.tid, &param);
+    std::string cpus = "?";
+    if (sched_getaffinity(r.tid, sizeof(set), &set) == 0) {
+      cpus = cpu_list_to_string(set);
+    }
+    int node = numa_nodes.empty() ? -1 : node_of(set);
+    fprintf(f,
+            "%-12s %-16s %7d %-6s %4d %-16s %s\n",
+            r.cls.c_str(),
+            r.name.c_str(),
+            r.tid,
+            policy_to_string(pol),
+            param.sched_priority,
+            cpus.c_str(),
+            node < 0 ? "-" : std::to_string(node).c_str());
+  }
+  fprintf(f, "\n");
+}
+
+} // namespace srslte
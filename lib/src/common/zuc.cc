@@ -9,6 +9,8 @@
 ---------------------------------------------------------*/
 
 #include "srslte/common/zuc.h"
+#include <stdint.h>
+#include <string.h>
 
 #define MAKEU32(a, b, c, d) (((u32)(a) << 24) | ((u32)(b) << 16) | ((u32)(c) << 8) | ((u32)(d)))
 #define MulByPow2(x, k) ((((x) << k) | ((x) >> (31 - k))) & 0x7FFFFFFF)
@@ -74,84 +76,12 @@ u32 AddM(u32 a, u32 b)
   return (c & 0x7FFFFFFF) + (c >> 31);
 }
 
-/* LFSR with initialization mode */
-void LFSRWithInitialisationMode(zuc_state_t* state, u32 u)
+/* x mod (2^31 - 1) for a sum x of up to eight 31-bit words, same representation as repeated AddM */
+static inline u32 ReduceM(uint64_t x)
 {
-  u32 f, v;
-  f = state->LFSR_S0;
-  v = MulByPow2(state->LFSR_S0, 8);
-  f = AddM(f, v);
-  v = MulByPow2(state->LFSR_S4, 20);
-  f = AddM(f, v);
-  v = MulByPow2(state->LFSR_S10, 21);
-  f = AddM(f, v);
-  v = MulByPow2(state->LFSR_S13, 17);
-  f = AddM(f, v);
-  v = MulByPow2(state->LFSR_S15, 15);
-  f = AddM(f, v);
-  f = AddM(f, u);
-
-  /* update the state */
-  state->LFSR_S0  = state->LFSR_S1;
-  state->LFSR_S1  = state->LFSR_S2;
-  state->LFSR_S2  = state->LFSR_S3;
-  state->LFSR_S3  = state->LFSR_S4;
-  state->LFSR_S4  = state->LFSR_S5;
-  state->LFSR_S5  = state->LFSR_S6;
-  state->LFSR_S6  = state->LFSR_S7;
-  state->LFSR_S7  = state->LFSR_S8;
-  state->LFSR_S8  = state->LFSR_S9;
-  state->LFSR_S9  = state->LFSR_S10;
-  state->LFSR_S10 = state->LFSR_S11;
-  state->LFSR_S11 = state->LFSR_S12;
-  state->LFSR_S12 = state->LFSR_S13;
-  state->LFSR_S13 = state->LFSR_S14;
-  state->LFSR_S14 = state->LFSR_S15;
-  state->LFSR_S15 = f;
-}
-
-/* LFSR with work mode */
-void LFSRWithWorkMode(zuc_state_t* state)
-{
-  u32 f, v;
-  f = state->LFSR_S0;
-  v = MulByPow2(state->LFSR_S0, 8);
-  f = AddM(f, v);
-  v = MulByPow2(state->LFSR_S4, 20);
-  f = AddM(f, v);
-  v = MulByPow2(state->LFSR_S10, 21);
-  f = AddM(f, v);
-  v = MulByPow2(state->LFSR_S13, 17);
-  f = AddM(f, v);
-  v = MulByPow2(state->LFSR_S15, 15);
-  f = AddM(f, v);
-
-  /* update the state */
-  state->LFSR_S0  = state->LFSR_S1;
-  state->LFSR_S1  = state->LFSR_S2;
-  state->LFSR_S2  = state->LFSR_S3;
-  state->LFSR_S3  = state->LFSR_S4;
-  state->LFSR_S4  = state->LFSR_S5;
-  state->LFSR_S5  = state->LFSR_S6;
-  state->LFSR_S6  = state->LFSR_S7;
-  state->LFSR_S7  = state->LFSR_S8;
-  state->LFSR_S8  = state->LFSR_S9;
-  state->LFSR_S9  = state->LFSR_S10;
-  state->LFSR_S10 = state->LFSR_S11;
-  state->LFSR_S11 = state->LFSR_S12;
-  state->LFSR_S12 = state->LFSR_S13;
-  state->LFSR_S13 = state->LFSR_S14;
-  state->LFSR_S14 = state->LFSR_S15;
-  state->LFSR_S15 = f;
-}
-
-/* BitReorganization */
-void BitReorganization(zuc_state_t* state)
-{
-  state->BRC_X0 = ((state->LFSR_S15 & 0x7FFF8000) << 1) | (state->LFSR_S14 & 0xFFFF);
-  state->BRC_X1 = ((state->LFSR_S11 & 0xFFFF) << 16) | (state->LFSR_S9 >> 15);
-  state->BRC_X2 = ((state->LFSR_S7 & 0xFFFF) << 16) | (state->LFSR_S5 >> 15);
-  state->BRC_X3 = ((state->LFSR_S2 & 0xFFFF) << 16) | (state->LFSR_S0 >> 15);
+  x = (x & 0x7FFFFFFF) + (x >> 31);
+  x = (x & 0x7FFFFFFF) + (x >> 31);
+  return (u32)x;
 }
 
 /* L1 */
@@ -166,68 +96,86 @@ u32 L2(u32 X)
   return (X ^ ROT(X, 8) ^ ROT(X, 14) ^ ROT(X, 22) ^ ROT(X, 30));
 }
 
-/* F */
-u32 F(zuc_state_t* state)
+/* One clock of BitReorganization, F and the LFSR.
+ * The LFSR is used as a circular buffer: at clock i the register s_k is stored in LFSR_S[(i + k) % 16], and the
+ * new s_15 overwrites the outgoing s_0. After a multiple of 16 clocks the registers are back in order.
+ * Returns W ^ X3. In initialisation mode W >> 1 is also fed back into the LFSR. */
+static inline u32 Clock(u32* s, u32& R1, u32& R2, u32 i, bool init_mode)
 {
-  u32 W, W1, W2, u, v;
-  W  = (state->BRC_X0 ^ state->F_R1) + state->F_R2;
-  W1 = state->F_R1 + state->BRC_X1;
-  W2 = state->F_R2 ^ state->BRC_X2;
-  u  = L1((W1 << 16) | (W2 >> 16));
-  v  = L2((W2 << 16) | (W1 >> 16));
-
-  state->F_R1 = MAKEU32(S0[u >> 24], S1[(u >> 16) & 0xFF], S0[(u >> 8) & 0xFF], S1[u & 0xFF]);
-  state->F_R2 = MAKEU32(S0[v >> 24], S1[(v >> 16) & 0xFF], S0[(v >> 8) & 0xFF], S1[v & 0xFF]);
-  return W;
+#define ZUC_S(k) s[(i + (k)) & 15]
+
+  /* BitReorganization */
+  u32 X0 = ((ZUC_S(15) & 0x7FFF8000) << 1) | (ZUC_S(14) & 0xFFFF);
+  u32 X1 = ((ZUC_S(11) & 0xFFFF) << 16) | (ZUC_S(9) >> 15);
+  u32 X2 = ((ZUC_S(7) & 0xFFFF) << 16) | (ZUC_S(5) >> 15);
+  u32 X3 = ((ZUC_S(2) & 0xFFFF) << 16) | (ZUC_S(0) >> 15);
+
+  /* F */
+  u32 W  = (X0 ^ R1) + R2;
+  u32 W1 = R1 + X1;
+  u32 W2 = R2 ^ X2;
+  u32 u  = L1((W1 << 16) | (W2 >> 16));
+  u32 v  = L2((W2 << 16) | (W1 >> 16));
+
+  R1 = MAKEU32(S0[u >> 24], S1[(u >> 16) & 0xFF], S0[(u >> 8) & 0xFF], S1[u & 0xFF]);
+  R2 = MAKEU32(S0[v >> 24], S1[(v >> 16) & 0xFF], S0[(v >> 8) & 0xFF], S1[v & 0xFF]);
+
+  /* LFSR, all the terms are added first and reduced once */
+  uint64_t f = (uint64_t)ZUC_S(0) + MulByPow2(ZUC_S(0), 8) + MulByPow2(ZUC_S(4), 20) + MulByPow2(ZUC_S(10), 21) +
+               MulByPow2(ZUC_S(13), 17) + MulByPow2(ZUC_S(15), 15);
+  if (init_mode) {
+    f += W >> 1;
+  }
+  ZUC_S(0) = ReduceM(f);
+
+#undef ZUC_S
+  return W ^ X3;
 }
 
 /* initialize */
 
 void zuc_initialize(zuc_state_t* state, const u8* k, u8* iv)
 {
-  u32 w, nCount;
+  u32 i;
 
   /* expand key */
-  state->LFSR_S0  = MAKEU31(k[0], EK_d[0], iv[0]);
-  state->LFSR_S1  = MAKEU31(k[1], EK_d[1], iv[1]);
-  state->LFSR_S2  = MAKEU31(k[2], EK_d[2], iv[2]);
-  state->LFSR_S3  = MAKEU31(k[3], EK_d[3], iv[3]);
-  state->LFSR_S4  = MAKEU31(k[4], EK_d[4], iv[4]);
-  state->LFSR_S5  = MAKEU31(k[5], EK_d[5], iv[5]);
-  state->LFSR_S6  = MAKEU31(k[6], EK_d[6], iv[6]);
-  state->LFSR_S7  = MAKEU31(k[7], EK_d[7], iv[7]);
-  state->LFSR_S8  = MAKEU31(k[8], EK_d[8], iv[8]);
-  state->LFSR_S9  = MAKEU31(k[9], EK_d[9], iv[9]);
-  state->LFSR_S10 = MAKEU31(k[10], EK_d[10], iv[10]);
-  state->LFSR_S11 = MAKEU31(k[11], EK_d[11], iv[11]);
-  state->LFSR_S12 = MAKEU31(k[12], EK_d[12], iv[12]);
-  state->LFSR_S13 = MAKEU31(k[13], EK_d[13], iv[13]);
-  state->LFSR_S14 = MAKEU31(k[14], EK_d[14], iv[14]);
-  state->LFSR_S15 = MAKEU31(k[15], EK_d[15], iv[15]);
+  for (i = 0; i < 16; i++) {
+    state->LFSR_S[i] = MAKEU31(k[i], EK_d[i], iv[i]);
+  }
 
   /* set F_R1 and F_R2 to zero */
-  state->F_R1 = 0;
-  state->F_R2 = 0;
-  nCount      = 32;
-  while (nCount > 0) {
-    BitReorganization(state);
-    w = F(state);
-    LFSRWithInitialisationMode(state, w >> 1);
-    nCount--;
+  u32 R1 = 0;
+  u32 R2 = 0;
+  for (i = 0; i < 32; i++) {
+    Clock(state->LFSR_S, R1, R2, i, true);
   }
+  state->F_R1 = R1;
+  state->F_R2 = R2;
 }
 
 void zuc_generate_keystream(zuc_state_t* state, int key_stream_len, u32* p_keystream)
 {
+  u32 tmp[16];
+  u32 s[16];
+  u32 R1 = state->F_R1;
+  u32 R2 = state->F_R2;
   int i;
-  {
-    BitReorganization(state);
-    F(state); /* discard the output of F */
-    LFSRWithWorkMode(state);
-  }
+
+  memcpy(s, state->LFSR_S, sizeof(s));
+  Clock(s, R1, R2, 0, false); /* discard the output of F */
   for (i = 0; i < key_stream_len; i++) {
-    BitReorganization(state);
-    p_keystream[i] = F(state) ^ state->BRC_X3;
-    LFSRWithWorkMode(state);
+    p_keystream[i] = Clock(s, R1, R2, i + 1, false);
+  }
+  memcpy(state->LFSR_S, s, sizeof(s));
+  state->F_R1 = R1;
+  state->F_R2 = R2;
+
+  /* restore the order of the LFSR registers */
+  u32 offset = (key_stream_len + 1) & 15;
+  if (offset != 0) {
+    for (i = 0; i < 16; i++) {
+      tmp[i] = state->LFSR_S[(offset + i) & 15];
+    }
+    memcpy(state->LFSR_S, tmp, sizeof(tmp));
   }
 }
@@ -412,6 +412,26 @@ int srslte_chest_ul_estimate_pucch(srslte_chest_ul_t*     q,
     return SRSLTE_ERROR;
   }
 
+  /* Get references from the input signal */
+  srslte_refsignal_dmrs_pucch_get(&q->dmrs_signal, cfg, input, q->pilot_recv_signal);
+
+  return srslte_chest_ul_estimate_pucch_pilots(q, sf, cfg, q->pilot_recv_signal, res);
+}
+
+/* Estimates the PUCCH channel from DMRS already extracted with srslte_refsignal_dmrs_pucch_get(). The received pilots
+ * are not modified, so resources sharing the same PUCCH RBs can be estimated from a single extraction.
+ */
+int srslte_chest_ul_estimate_pucch_pilots(srslte_chest_ul_t*     q,
+                                          srslte_ul_sf_cfg_t*    sf,
+                                          srslte_pucch_cfg_t*    cfg,
+                                          const cf_t*            pilots,
+                                          srslte_chest_ul_res_t* res)
+{
+  if (!q->dmrs_signal_configured) {
+    ERROR("Error must call srslte_chest_ul_set_cfg() before using the UL estimator\n");
+    return SRSLTE_ERROR;
+  }
+
   int n_rs = srslte_refsignal_dmrs_N_rs(cfg->format, q->cell.cp);
   if (!n_rs) {
     ERROR("Error computing N_rs\n");
@@ -419,9 +439,6 @@ int srslte_chest_ul_estimate_pucch(srslte_chest_ul_t*     q,
   }
   int nrefs_sf = SRSLTE_NRE * n_rs * 2;
 
-  /* Get references from the input signal */
-  srslte_refsignal_dmrs_pucch_get(&q->dmrs_signal, cfg, input, q->pilot_recv_signal);
-
   /* Generate known pilots */
   if (cfg->format == SRSLTE_PUCCH_FORMAT_2A || cfg->format == SRSLTE_PUCCH_FORMAT_2B) {
     float max   = -1e9;
@@ -438,7 +455,7 @@ int srslte_chest_ul_estimate_pucch(srslte_chest_ul_t*     q,
       cfg->pucch2_drs_bits[0] = i % 2;
       cfg->pucch2_drs_bits[1] = i / 2;
       srslte_refsignal_dmrs_pucch_gen(&q->dmrs_signal, sf, cfg, q->pilot_known_signal);
-      srslte_vec_prod_conj_ccc(q->pilot_recv_signal, q->pilot_known_signal, q->pilot_estimates_tmp[i], nrefs_sf);
+      srslte_vec_prod_conj_ccc(pilots, q->pilot_known_signal, q->pilot_estimates_tmp[i], nrefs_sf);
       float x = cabsf(srslte_vec_acc_cc(q->pilot_estimates_tmp[i], nrefs_sf));
       if (x >= max) {
         max   = x;
@@ -452,7 +469,7 @@ int srslte_chest_ul_estimate_pucch(srslte_chest_ul_t*     q,
   } else {
     srslte_refsignal_dmrs_pucch_gen(&q->dmrs_signal, sf, cfg, q->pilot_known_signal);
     /* Use the known DMRS signal to compute Least-squares estimates */
-    srslte_vec_prod_conj_ccc(q->pilot_recv_signal, q->pilot_known_signal, q->pilot_estimates, nrefs_sf);
+    srslte_vec_prod_conj_ccc(pilots, q->pilot_known_signal, q->pilot_estimates, nrefs_sf);
   }
 
   if (cfg->meas_ta_en && n_rs > 0) {
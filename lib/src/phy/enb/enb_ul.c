@@ -47,6 +47,12 @@ int srslte_enb_ul_init(srslte_enb_ul_t* q, cf_t* in_buffer, uint32_t max_prb)
       goto clean_exit;
     }
 
+    q->pucch_rb = calloc(SRSLTE_ENB_UL_PUCCH_MAX_RB, sizeof(srslte_enb_ul_pucch_rb_t));
+    if (!q->pucch_rb) {
+      perror("malloc");
+      goto clean_exit;
+    }
+
     srslte_ofdm_cfg_t ofdm_cfg = {};
     ofdm_cfg.nof_prb           = max_prb;
     ofdm_cfg.in_buffer         = in_buffer;
@@ -103,6 +109,9 @@ void srslte_enb_ul_free(srslte_enb_ul_t* q)
     if (q->chest_res.ce) {
       free(q->chest_res.ce);
     }
+    if (q->pucch_rb) {
+      free(q->pucch_rb);
+    }
     bzero(q, sizeof(srslte_enb_ul_t));
   }
 }
@@ -171,6 +180,71 @@ void srslte_enb_ul_rem_rnti(srslte_enb_ul_t* q, uint16_t rnti)
 void srslte_enb_ul_fft(srslte_enb_ul_t* q)
 {
   srslte_ofdm_rx_sf(&q->fft);
+
+  // The PUCCH RBs of the previous subframe are no longer valid
+  q->nof_pucch_rb = 0;
+}
+
+/* PUCCH formats whose DMRS and data occupy the same symbols share the extracted REs */
+static srslte_pucch_format_t pucch_rb_layout(srslte_pucch_format_t format, srslte_cp_t cp)
+{
+  switch (format) {
+    case SRSLTE_PUCCH_FORMAT_1A:
+    case SRSLTE_PUCCH_FORMAT_1B:
+      return SRSLTE_PUCCH_FORMAT_1;
+    case SRSLTE_PUCCH_FORMAT_2A:
+    case SRSLTE_PUCCH_FORMAT_2B:
+      return SRSLTE_CP_ISNORM(cp) ? SRSLTE_PUCCH_FORMAT_2 : format;
+    default:
+      return format;
+  }
+}
+
+/* Returns the PUCCH RB pair the resource in cfg is mapped on, extracting its REs the first time it is used in the
+ * subframe. Many UEs share the same RBs, but each resource is still estimated and decoded on its own from the shared
+ * REs, correlating against its own cyclic shift and orthogonal cover.
+ */
+static srslte_enb_ul_pucch_rb_t* pucch_rb_get(srslte_enb_ul_t* q, srslte_ul_sf_cfg_t* ul_sf, srslte_pucch_cfg_t* cfg)
+{
+  uint32_t              n_prb[SRSLTE_NOF_SLOTS_PER_SF];
+  srslte_pucch_format_t layout = pucch_rb_layout(cfg->format, q->cell.cp);
+  for (uint32_t ns = 0; ns < SRSLTE_NOF_SLOTS_PER_SF; ns++) {
+    n_prb[ns] = srslte_pucch_n_prb(&q->cell, cfg, ns);
+  }
+
+  if (ul_sf->tti != q->pucch_rb_tti) {
+    q->nof_pucch_rb = 0;
+    q->pucch_rb_tti = ul_sf->tti;
+  }
+
+  for (uint32_t i = 0; i < q->nof_pucch_rb; i++) {
+    srslte_enb_ul_pucch_rb_t* rb = &q->pucch_rb[i];
+    if (rb->n_prb[0] == n_prb[0] && rb->n_prb[1] == n_prb[1] && rb->layout == layout &&
+        rb->shortened == ul_sf->shortened) {
+      return rb;
+    }
+  }
+
+  // Extract the RB pair, the last entry is reused if all of them are taken
+  uint32_t                  idx = SRSLTE_MIN(q->nof_pucch_rb, SRSLTE_ENB_UL_PUCCH_MAX_RB - 1);
+  srslte_enb_ul_pucch_rb_t* rb  = &q->pucch_rb[idx];
+  q->nof_pucch_rb               = idx;
+
+  int nof_re = srslte_pucch_get_symbols(&q->pucch, ul_sf, cfg, q->sf_symbols, rb->symbols);
+  if (nof_re < SRSLTE_SUCCESS) {
+    return NULL;
+  }
+  if (srslte_refsignal_dmrs_pucch_get(&q->chest.dmrs_signal, cfg, q->sf_symbols, rb->dmrs)) {
+    return NULL;
+  }
+  rb->n_prb[0]  = n_prb[0];
+  rb->n_prb[1]  = n_prb[1];
+  rb->layout    = layout;
+  rb->shortened = ul_sf->shortened;
+  rb->nof_re    = (uint32_t)nof_re;
+  q->nof_pucch_rb++;
+
+  return rb;
 }
 
 static int get_pucch(srslte_enb_ul_t* q, srslte_ul_sf_cfg_t* ul_sf, srslte_pucch_cfg_t* cfg, srslte_pucch_res_t* res)
@@ -208,13 +282,20 @@ static int get_pucch(srslte_enb_ul_t* q, srslte_ul_sf_cfg_t* ul_sf, srslte_pucch
     // Configure resource
     cfg->n_pucch = n_pucch_i[i];
 
+    // Get the REs of the resource RBs
+    srslte_enb_ul_pucch_rb_t* rb = pucch_rb_get(q, ul_sf, cfg);
+    if (rb == NULL) {
+      ERROR("Error getting PUCCH RB\n");
+      return SRSLTE_ERROR;
+    }
+
     // Prepare configuration
-    if (srslte_chest_ul_estimate_pucch(&q->chest, ul_sf, cfg, q->sf_symbols, &q->chest_res)) {
+    if (srslte_chest_ul_estimate_pucch_pilots(&q->chest, ul_sf, cfg, rb->dmrs, &q->chest_res)) {
       ERROR("Error estimating PUCCH DMRS\n");
       return SRSLTE_ERROR;
     }
 
-    ret = srslte_pucch_decode(&q->pucch, ul_sf, cfg, &q->chest_res, q->sf_symbols, &pucch_res);
+    ret = srslte_pucch_decode_symbols(&q->pucch, ul_sf, cfg, &q->chest_res, rb->symbols, rb->nof_re, &pucch_res);
     if (ret < SRSLTE_SUCCESS) {
       ERROR("Error decoding PUCCH\n");
     } else {
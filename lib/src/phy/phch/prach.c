@@ -27,6 +27,7 @@
 #include "srslte/phy/common/phy_common.h"
 #include "srslte/phy/phch/prach.h"
 #include "srslte/phy/utils/debug.h"
+#include "srslte/phy/utils/simd.h"
 #include "srslte/phy/utils/vector.h"
 
 #include "prach_tables.h"
@@ -44,6 +45,7 @@ float save_corr[4096];
 #define PHI 7             // PRACH phi parameter
 #define PHI_4 2           // PRACH phi parameter for format 4
 #define MAX_ROOTS 838     // Max number of root sequences
+#define N_BATCHES ((N_SEQS + SRSLTE_PRACH_ROOTS_PER_BATCH - 1) / SRSLTE_PRACH_ROOTS_PER_BATCH)
 //#define PRACH_CANCELLATION_HARD
 #define PRACH_AMP 1.0
 
@@ -237,6 +239,13 @@ static cf_t* get_precoded_dft(srslte_prach_t* p, uint32_t idx)
   return p->dft_seqs[idx];
 }
 
+/// Distance between the correlation buffers of two roots, rounded up so that every root starts aligned.
+static uint32_t prach_corr_stride(uint32_t N_zc)
+{
+  uint32_t align = SRSLTE_SIMD_BIT_ALIGN / (8 * sizeof(float));
+  return ((N_zc + align - 1) / align) * align;
+}
+
 int srslte_prach_gen_seqs(srslte_prach_t* p)
 {
   uint32_t u           = 0;
@@ -355,8 +364,18 @@ int srslte_prach_init(srslte_prach_t* p, uint32_t max_N_ifft_ul)
     p->prach_bins = srslte_vec_cf_malloc(MAX_N_zc);
     p->corr_spec  = srslte_vec_cf_malloc(MAX_N_zc);
     p->corr       = srslte_vec_f_malloc(MAX_N_zc);
-    p->cross      = srslte_vec_cf_malloc(MAX_N_zc);
-    p->corr_freq  = srslte_vec_cf_malloc(MAX_N_zc);
+
+    // Correlation buffers of every root, padded to whole batches
+    p->corr_stride    = prach_corr_stride(MAX_N_zc);
+    uint32_t corr_len = N_BATCHES * SRSLTE_PRACH_ROOTS_PER_BATCH * p->corr_stride;
+    p->corr_roots     = srslte_vec_cf_malloc(corr_len);
+    p->corr_roots_pow = srslte_vec_f_malloc(corr_len);
+    p->cross_batch    = srslte_vec_cf_malloc(N_BATCHES * p->corr_stride);
+    if (!p->corr_roots || !p->corr_roots_pow || !p->cross_batch) {
+      ERROR("Error allocating memory\n");
+      return SRSLTE_ERROR;
+    }
+    srslte_vec_cf_zero(p->corr_roots, corr_len);
 
     // Set up ZC FFTS
     if (srslte_dft_plan(&p->zc_fft, MAX_N_zc, SRSLTE_DFT_FORWARD, SRSLTE_DFT_COMPLEX)) {
@@ -371,6 +390,21 @@ int srslte_prach_init(srslte_prach_t* p, uint32_t max_N_ifft_ul)
     srslte_dft_plan_set_mirror(&p->zc_ifft, false);
     srslte_dft_plan_set_norm(&p->zc_ifft, false);
 
+    // In-place IFFT of the SRSLTE_PRACH_ROOTS_PER_BATCH roots of a batch
+    if (srslte_dft_plan_guru_c(&p->zc_ifft_batch,
+                               MAX_N_zc,
+                               SRSLTE_DFT_BACKWARD,
+                               p->corr_roots,
+                               p->corr_roots,
+                               1,
+                               1,
+                               SRSLTE_PRACH_ROOTS_PER_BATCH,
+                               p->corr_stride,
+                               p->corr_stride)) {
+      ERROR("Error creating DFT plan\n");
+      return SRSLTE_ERROR;
+    }
+
     uint32_t fft_size_alloc = max_N_ifft_ul * DELTA_F / DELTA_F_RA;
 
     p->ifft_in  = srslte_vec_cf_malloc(fft_size_alloc);
@@ -473,9 +507,28 @@ int srslte_prach_set_cell_(srslte_prach_t*      p,
       }
     }
 
+    p->corr_stride = prach_corr_stride(p->N_zc);
+    if (srslte_dft_replan_guru_c(&p->zc_ifft_batch,
+                                 p->N_zc,
+                                 p->corr_roots,
+                                 p->corr_roots,
+                                 1,
+                                 1,
+                                 SRSLTE_PRACH_ROOTS_PER_BATCH,
+                                 p->corr_stride,
+                                 p->corr_stride)) {
+      return SRSLTE_ERROR;
+    }
+
     // Generate our 64 sequences
     p->N_roots = 0;
     srslte_prach_gen_seqs(p);
+
+    // Transform all the root sequences now, detection only reads them and can run on several threads
+    for (uint32_t i = 0; i < p->N_roots; i++) {
+      get_precoded_dft(p, p->root_seqs_idx[i]);
+    }
+
     // Ensure num_ra_preambles is valid, if not assign default value
     if (p->num_ra_preambles < 4 || p->num_ra_preambles > p->N_roots) {
       p->num_ra_preambles = p->N_roots;
@@ -519,6 +572,13 @@ int srslte_prach_set_cell_(srslte_prach_t*      p,
           p->td_signals[i] = srslte_vec_malloc(sizeof(cf_t) * (p->N_seq + p->N_cp));
         }
       }
+      if (!p->corr_freq_roots) {
+        p->corr_freq_roots = srslte_vec_cf_malloc(N_SEQS * prach_corr_stride(MAX_N_zc));
+        if (!p->corr_freq_roots) {
+          ERROR("Error allocating memory\n");
+          return SRSLTE_ERROR;
+        }
+      }
     }
     ret = SRSLTE_SUCCESS;
   } else {
@@ -626,10 +686,10 @@ float srslte_prach_get_offset_secs(srslte_prach_t* p, int n_win)
 
 // calculates the timing offset of the incoming PRACH by calculating the phase in frequency - alternative to time domain
 // approach
-float srslte_prach_calculate_time_offset_secs(srslte_prach_t* p, cf_t* cross)
+float srslte_prach_calculate_time_offset_secs(srslte_prach_t* p, cf_t cross)
 {
-  // calculate the phase of the cross correlation
-  float freq_domain_phase = cargf(srslte_vec_acc_cc(cross, p->N_zc));
+  // calculate the phase of the accumulated cross correlation
+  float freq_domain_phase = cargf(cross);
   float ratio             = (float)(p->N_ifft_ul * DELTA_F) / (float)(MAX_N_zc * DELTA_F_RA);
   // converting from phase to number of samples
   float num_samples = roundf((ratio * freq_domain_phase * p->N_zc) / (2 * M_PI));
@@ -647,6 +707,44 @@ void srslte_prach_calculate_correction_array(srslte_prach_t* p, cf_t* corr_freq)
   }
 }
 
+void srslte_prach_set_executor(srslte_prach_t* p, srslte_prach_executor_t executor, void* arg)
+{
+  p->executor     = executor;
+  p->executor_arg = arg;
+}
+
+// Correlates the received bins with the roots of one batch, batches write to disjoint buffers
+void srslte_prach_correlate_batch(srslte_prach_t* p, uint32_t batch)
+{
+  uint32_t first = batch * SRSLTE_PRACH_ROOTS_PER_BATCH;
+  uint32_t last  = SRSLTE_MIN(first + SRSLTE_PRACH_ROOTS_PER_BATCH, p->num_ra_preambles);
+  cf_t*    cross = &p->cross_batch[batch * p->corr_stride];
+
+  cross[p->N_zc - 1] = 0;
+  for (uint32_t i = first; i < last; i++) {
+    cf_t* corr_spec = &p->corr_roots[i * p->corr_stride];
+
+    // The root sequences were transformed in set_cell
+    srslte_vec_prod_conj_ccc(p->prach_bins, p->dft_seqs[p->root_seqs_idx[i]], corr_spec, p->N_zc);
+
+    srslte_vec_prod_conj_ccc(corr_spec, &corr_spec[1], cross, p->N_zc - 1);
+    p->cross_roots[i] = srslte_vec_acc_cc(cross, p->N_zc);
+    if (p->successive_cancellation) {
+      srslte_vec_cf_copy(&p->corr_freq_roots[i * p->corr_stride], corr_spec, p->N_zc);
+    }
+  }
+
+  // One IFFT for all the roots of the batch, the unused ones at the end of the last batch are ignored
+  cf_t* batch_ptr = &p->corr_roots[first * p->corr_stride];
+  srslte_dft_run_c_zerocopy(&p->zc_ifft_batch, batch_ptr, batch_ptr);
+
+  for (uint32_t i = first; i < last; i++) {
+    float* corr = &p->corr_roots_pow[i * p->corr_stride];
+    srslte_vec_abs_square_cf(&p->corr_roots[i * p->corr_stride], corr, p->N_zc);
+    p->corr_ave_roots[i] = srslte_vec_acc_ff(corr, p->N_zc) / p->N_zc;
+  }
+}
+
 // This function carries out the main processing on the incomming PRACH signal
 int srslte_prach_process(srslte_prach_t* p,
                          cf_t*           signal,
@@ -661,22 +759,20 @@ int srslte_prach_process(srslte_prach_t* p,
   float max_to_cancel = 0;
   cancellation_idx    = -1;
   int max_idx         = 0;
-  srslte_vec_cf_zero(p->cross, p->N_zc);
-  srslte_vec_cf_zero(p->corr_freq, p->N_zc);
-  for (int i = 0; i < p->num_ra_preambles; i++) {
-    cf_t* root_spec = get_precoded_dft(p, p->root_seqs_idx[i]);
-
-    srslte_vec_prod_conj_ccc(p->prach_bins, root_spec, p->corr_spec, p->N_zc);
 
-    srslte_vec_prod_conj_ccc(p->corr_spec, &p->corr_spec[1], p->cross, p->N_zc - 1);
-    if (p->successive_cancellation) {
-      srslte_vec_cf_copy(p->corr_freq, p->corr_spec, p->N_zc);
+  // Correlate with all the roots first, in parallel if an executor is set
+  uint32_t nof_batches = (p->num_ra_preambles + SRSLTE_PRACH_ROOTS_PER_BATCH - 1) / SRSLTE_PRACH_ROOTS_PER_BATCH;
+  if (p->executor) {
+    p->executor(p->executor_arg, nof_batches);
+  } else {
+    for (uint32_t b = 0; b < nof_batches; b++) {
+      srslte_prach_correlate_batch(p, b);
     }
-    srslte_dft_run(&p->zc_ifft, p->corr_spec, p->corr_spec);
-
-    srslte_vec_abs_square_cf(p->corr_spec, p->corr, p->N_zc);
+  }
 
-    float corr_ave = srslte_vec_acc_ff(p->corr, p->N_zc) / p->N_zc;
+  for (int i = 0; i < p->num_ra_preambles; i++) {
+    float* corr     = &p->corr_roots_pow[i * p->corr_stride];
+    float  corr_ave = p->corr_ave_roots[i];
 
     uint32_t winsize = 0;
     if (p->N_cs != 0) {
@@ -696,8 +792,8 @@ int srslte_prach_process(srslte_prach_t* p,
       start += p->deadzone;
       p->peak_values[j] = 0;
       for (int k = start; k < end; k++) {
-        if (p->corr[k] > p->peak_values[j]) {
-          p->peak_values[j]  = p->corr[k];
+        if (corr[k] > p->peak_values[j]) {
+          p->peak_values[j]  = corr[k];
           p->peak_offsets[j] = k - start;
           if (p->peak_values[j] > max_peak) {
             max_peak = p->peak_values[j];
@@ -716,7 +812,7 @@ int srslte_prach_process(srslte_prach_t* p,
                 max_to_cancel          = max_peak;
                 p->prach_cancel.idx    = cancellation_idx;
                 p->prach_cancel.factor = (sqrt(max_peak / (p->N_zc * p->N_zc)));
-                srslte_prach_calculate_correction_array(p, p->corr_freq);
+                srslte_prach_calculate_correction_array(p, &p->corr_freq_roots[i * p->corr_stride]);
               }
               if (srslte_prach_have_stored(((i * n_wins) + j), indices, *n_indices)) {
                 break;
@@ -730,7 +826,7 @@ int srslte_prach_process(srslte_prach_t* p,
           if (t_offsets) {
             // saves the PRACH offset in seconds to t_offsets, time domain or freq domain base calc
             t_offsets[*n_indices] = (p->freq_domain_offset_calc)
-                                        ? (srslte_prach_calculate_time_offset_secs(p, p->cross))
+                                        ? (srslte_prach_calculate_time_offset_secs(p, p->cross_roots[i]))
                                         : (srslte_prach_get_offset_secs(p, j));
           }
           (*n_indices)++;
@@ -801,11 +897,14 @@ int srslte_prach_free(srslte_prach_t* p)
   srslte_dft_plan_free(&p->ifft);
   free(p->ifft_in);
   free(p->ifft_out);
-  free(p->cross);
-  free(p->corr_freq);
+  free(p->corr_roots);
+  free(p->corr_roots_pow);
+  free(p->corr_freq_roots);
+  free(p->cross_batch);
   srslte_dft_plan_free(&p->fft);
   srslte_dft_plan_free(&p->zc_fft);
   srslte_dft_plan_free(&p->zc_ifft);
+  srslte_dft_plan_free(&p->zc_ifft_batch);
 
   if (p->signal_fft) {
     free(p->signal_fft);
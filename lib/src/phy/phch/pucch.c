@@ -894,30 +894,58 @@ int srslte_pucch_decode(srslte_pucch_t*        q,
                         srslte_chest_ul_res_t* channel,
                         cf_t*                  sf_symbols,
                         srslte_pucch_res_t*    data)
+{
+  if (q == NULL || cfg == NULL) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+
+  int nof_re = pucch_get(q, sf, cfg, sf_symbols, q->z_tmp);
+  if (nof_re < 0) {
+    ERROR("Error getting PUCCH symbols\n");
+    return SRSLTE_ERROR;
+  }
+
+  return srslte_pucch_decode_symbols(q, sf, cfg, channel, q->z_tmp, nof_re, data);
+}
+
+/* Extracts the PUCCH REs of the resource in cfg from the subframe grid. Returns the number of REs or a negative value
+ * if error. All the resources mapped on the same RBs, with a PUCCH format using the same symbols, get the same REs.
+ */
+int srslte_pucch_get_symbols(srslte_pucch_t*     q,
+                             srslte_ul_sf_cfg_t* sf,
+                             srslte_pucch_cfg_t* cfg,
+                             cf_t*               sf_symbols,
+                             cf_t*               z)
+{
+  return pucch_get(q, sf, cfg, sf_symbols, z);
+}
+
+/* Same as srslte_pucch_decode() from REs extracted with srslte_pucch_get_symbols(), which are not modified */
+int srslte_pucch_decode_symbols(srslte_pucch_t*        q,
+                                srslte_ul_sf_cfg_t*    sf,
+                                srslte_pucch_cfg_t*    cfg,
+                                srslte_chest_ul_res_t* channel,
+                                cf_t*                  symbols,
+                                uint32_t               nof_re,
+                                srslte_pucch_res_t*    data)
 {
   uint8_t pucch_bits[SRSLTE_CQI_MAX_BITS];
   bzero(pucch_bits, SRSLTE_CQI_MAX_BITS * sizeof(uint8_t));
 
   int ret = SRSLTE_ERROR_INVALID_INPUTS;
 
-  if (q != NULL && cfg != NULL && channel != NULL && data != NULL) {
+  if (q != NULL && cfg != NULL && channel != NULL && symbols != NULL && data != NULL) {
 
     uint32_t nof_cqi_bits = srslte_cqi_size(&cfg->uci_cfg.cqi);
     uint32_t nof_uci_bits = cfg->uci_cfg.cqi.ri_len ? cfg->uci_cfg.cqi.ri_len : nof_cqi_bits;
 
-    int nof_re = pucch_get(q, sf, cfg, sf_symbols, q->z_tmp);
-    if (nof_re < 0) {
-      ERROR("Error getting PUCCH symbols\n");
-      return SRSLTE_ERROR;
-    }
-
     if (pucch_get(q, sf, cfg, channel->ce, q->ce) < 0) {
       ERROR("Error getting PUCCH symbols\n");
       return SRSLTE_ERROR;
     }
 
     // Equalization
-    srslte_predecoding_single(q->z_tmp, q->ce, q->z, NULL, nof_re, 1.0f, channel->noise_estimate);
+    srslte_predecoding_single(symbols, q->ce, q->z, NULL, nof_re, 1.0f, channel->noise_estimate);
 
     // Perform DMRS Detection, if enabled
     if (isnormal(cfg->threshold_dmrs_detection)) {
@@ -0,0 +1,248 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "srslte/srslte.h"
+
+#define MAX_LEN 70176
+#define MAX_THREADS 16
+
+uint32_t nof_prb         = 100;
+uint32_t config_idx      = 3;
+uint32_t zero_corr_zone  = 0;
+uint32_t nof_threads     = 3;
+uint32_t nof_repetitions = 10;
+
+/* Minimal thread pool to spread the correlation batches, the detecting thread takes batches as well */
+typedef struct {
+  srslte_prach_t* prach;
+  pthread_t       threads[MAX_THREADS];
+  pthread_mutex_t mutex;
+  pthread_cond_t  cvar_start;
+  pthread_cond_t  cvar_done;
+  uint32_t        generation;
+  uint32_t        nof_batches;
+  uint32_t        next_batch;
+  uint32_t        done_batches;
+  bool            quit;
+} bench_pool_t;
+
+static void run_batches(bench_pool_t* q)
+{
+  // Called with the mutex locked
+  while (q->next_batch < q->nof_batches) {
+    uint32_t b = q->next_batch++;
+    pthread_mutex_unlock(&q->mutex);
+    srslte_prach_correlate_batch(q->prach, b);
+    pthread_mutex_lock(&q->mutex);
+    if (++q->done_batches == q->nof_batches) {
+      pthread_cond_signal(&q->cvar_done);
+    }
+  }
+}
+
+static void* pool_thread(void* arg)
+{
+  bench_pool_t* q          = (bench_pool_t*)arg;
+  uint32_t      generation = 0;
+
+  pthread_mutex_lock(&q->mutex);
+  while (!q->quit) {
+    if (generation == q->generation) {
+      pthread_cond_wait(&q->cvar_start, &q->mutex);
+      continue;
+    }
+    generation = q->generation;
+    run_batches(q);
+  }
+  pthread_mutex_unlock(&q->mutex);
+  return NULL;
+}
+
+static void pool_executor(void* arg, uint32_t nof_batches)
+{
+  bench_pool_t* q = (bench_pool_t*)arg;
+
+  pthread_mutex_lock(&q->mutex);
+  q->nof_batches  = nof_batches;
+  q->next_batch   = 0;
+  q->done_batches = 0;
+  q->generation++;
+  pthread_cond_broadcast(&q->cvar_start);
+  run_batches(q);
+  while (q->done_batches < q->nof_batches) {
+    pthread_cond_wait(&q->cvar_done, &q->mutex);
+  }
+  pthread_mutex_unlock(&q->mutex);
+}
+
+void usage(char* prog)
+{
+  printf("Usage: %s\n", prog);
+  printf("\t-n Uplink number of PRB [Default %d]\n", nof_prb);
+  printf("\t-f PRACH configuration index [Default %d]\n", config_idx);
+  printf("\t-z Zero correlation zone config [Default %d]\n", zero_corr_zone);
+  printf("\t-t Number of correlation threads besides the detecting one [Default %d]\n", nof_threads);
+  printf("\t-N Number of detections per preamble [Default %d]\n", nof_repetitions);
+}
+
+void parse_args(int argc, char** argv)
+{
+  int opt;
+  while ((opt = getopt(argc, argv, "nfztN")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_prb = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'f':
+        config_idx = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'z':
+        zero_corr_zone = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 't':
+        nof_threads = SRSLTE_MIN((uint32_t)strtol(argv[optind], NULL, 10), MAX_THREADS);
+        break;
+      case 'N':
+        nof_repetitions = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+static double elapsed_us(const struct timespec* t0, const struct timespec* t1)
+{
+  return (t1->tv_sec - t0->tv_sec) * 1e6 + (t1->tv_nsec - t0->tv_nsec) / 1e3;
+}
+
+/* Detects every preamble nof_repetitions times, checks the detected index and prints the latency */
+static int bench(srslte_prach_t* prach, cf_t* preamble, const char* name)
+{
+  uint32_t indices[64] = {};
+  uint32_t n_indices   = 0;
+  double   t_min       = 1e9;
+  double   t_max       = 0;
+  double   t_sum       = 0;
+  uint32_t count       = 0;
+
+  for (uint32_t seq_index = 0; seq_index < 64; seq_index++) {
+    srslte_prach_gen(prach, seq_index, 0, preamble);
+
+    for (uint32_t n = 0; n < nof_repetitions; n++) {
+      struct timespec t0, t1;
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+      srslte_prach_detect(prach, 0, &preamble[prach->N_cp], prach->N_seq, indices, &n_indices);
+      clock_gettime(CLOCK_MONOTONIC, &t1);
+
+      if (n_indices != 1 || indices[0] != seq_index) {
+        ERROR("%s: preamble %d detected as %d (%d detections)\n", name, seq_index, indices[0], n_indices);
+        return SRSLTE_ERROR;
+      }
+
+      double t = elapsed_us(&t0, &t1);
+      t_min    = SRSLTE_MIN(t_min, t);
+      t_max    = SRSLTE_MAX(t_max, t);
+      t_sum += t;
+      count++;
+    }
+  }
+
+  printf("%-10s detection latency: mean=%.1f us, min=%.1f us, max=%.1f us\n", name, t_sum / count, t_min, t_max);
+  return SRSLTE_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  parse_args(argc, argv);
+
+  int            ret      = SRSLTE_ERROR;
+  srslte_prach_t prach    = {};
+  bench_pool_t   pool     = {};
+  cf_t*          preamble = srslte_vec_cf_malloc(MAX_LEN);
+  if (!preamble) {
+    return SRSLTE_ERROR;
+  }
+  srslte_vec_cf_zero(preamble, MAX_LEN);
+
+  srslte_prach_cfg_t prach_cfg = {};
+  prach_cfg.config_idx         = config_idx;
+  prach_cfg.zero_corr_zone     = zero_corr_zone;
+
+  if (srslte_prach_init(&prach, srslte_symbol_sz(nof_prb))) {
+    return SRSLTE_ERROR;
+  }
+  if (srslte_prach_set_cfg(&prach, &prach_cfg, nof_prb)) {
+    ERROR("Error initiating PRACH object\n");
+    return SRSLTE_ERROR;
+  }
+  printf("N_zc=%d, %d root sequences, %d per batch\n",
+         prach.N_zc,
+         prach.num_ra_preambles,
+         SRSLTE_PRACH_ROOTS_PER_BATCH);
+
+  // Serial correlation in the detecting thread
+  if (bench(&prach, preamble, "serial")) {
+    goto clean_exit;
+  }
+
+  // Correlation batches spread across the pool
+  pool.prach = &prach;
+  pthread_mutex_init(&pool.mutex, NULL);
+  pthread_cond_init(&pool.cvar_start, NULL);
+  pthread_cond_init(&pool.cvar_done, NULL);
+  for (uint32_t i = 0; i < nof_threads; i++) {
+    pthread_create(&pool.threads[i], NULL, pool_thread, &pool);
+  }
+  srslte_prach_set_executor(&prach, pool_executor, &pool);
+
+  char name[32];
+  snprintf(name, sizeof(name), "%d threads", nof_threads + 1);
+  ret = bench(&prach, preamble, name);
+
+  pthread_mutex_lock(&pool.mutex);
+  pool.quit = true;
+  pthread_cond_broadcast(&pool.cvar_start);
+  pthread_mutex_unlock(&pool.mutex);
+  for (uint32_t i = 0; i < nof_threads; i++) {
+    pthread_join(pool.threads[i], NULL);
+  }
+  pthread_mutex_destroy(&pool.mutex);
+  pthread_cond_destroy(&pool.cvar_start);
+  pthread_cond_destroy(&pool.cvar_done);
+
+clean_exit:
+  srslte_prach_free(&prach);
+  free(preamble);
+
+  if (ret == SRSLTE_SUCCESS) {
+    printf("Done\n");
+  }
+  return ret;
+}
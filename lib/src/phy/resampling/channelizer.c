@@ -0,0 +1,115 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <complex.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "srslte/phy/resampling/channelizer.h"
+#include "srslte/phy/utils/debug.h"
+#include "srslte/phy/utils/vector.h"
+
+/* Input samples mixed per decimator call, a multiple of the resampler window for all the ratios up to 16 */
+#define CHANNELIZER_CHUNK_SZ(ratio) (1920 * (ratio))
+
+int srslte_channelizer_init(srslte_channelizer_t* q, uint32_t ratio)
+{
+  if (q == NULL || ratio == 0) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+
+  memset(q, 0, sizeof(srslte_channelizer_t));
+
+  if (ratio > 1) {
+    if (srslte_resampler_fft_init(&q->decimator, SRSLTE_RESAMPLER_MODE_DECIMATE, ratio)) {
+      ERROR("Error initiating channelizer decimator\n");
+      srslte_channelizer_free(q);
+      return SRSLTE_ERROR;
+    }
+  }
+
+  q->ratio      = ratio;
+  q->chunk_sz   = CHANNELIZER_CHUNK_SZ(ratio);
+  q->mix_buffer = srslte_vec_cf_malloc(q->chunk_sz);
+  if (q->mix_buffer == NULL) {
+    srslte_channelizer_free(q);
+    return SRSLTE_ERROR;
+  }
+
+  return SRSLTE_SUCCESS;
+}
+
+void srslte_channelizer_set_freq(srslte_channelizer_t* q, float freq)
+{
+  if (q == NULL) {
+    return;
+  }
+
+  q->freq  = freq;
+  q->phase = 0.0;
+  if (q->ratio > 1) {
+    srslte_resampler_fft_reset(&q->decimator);
+  }
+}
+
+uint32_t srslte_channelizer_run(srslte_channelizer_t* q, const cf_t* input, cf_t* output, uint32_t nsamples)
+{
+  if (q == NULL || input == NULL || output == NULL || q->mix_buffer == NULL) {
+    return 0;
+  }
+
+  uint32_t count = 0;
+  while (count < nsamples) {
+    uint32_t n = SRSLTE_MIN(q->chunk_sz, nsamples - count);
+
+    // Shift the channel to baseband, the mixer restarts at phase 0 so rotate the chunk to keep continuity
+    srslte_vec_apply_cfo(&input[count], -q->freq, q->mix_buffer, n);
+    srslte_vec_sc_prod_ccc(q->mix_buffer, cexpf(-_Complex_I * 2.0f * (float)M_PI * (float)q->phase), q->mix_buffer, n);
+    q->phase = fmod(q->phase + (double)q->freq * n, 1.0);
+
+    if (q->ratio > 1) {
+      srslte_resampler_fft_run(&q->decimator, q->mix_buffer, &output[count / q->ratio], n);
+    } else {
+      srslte_vec_cf_copy(&output[count], q->mix_buffer, n);
+    }
+
+    count += n;
+  }
+
+  return nsamples / q->ratio;
+}
+
+void srslte_channelizer_free(srslte_channelizer_t* q)
+{
+  if (q == NULL) {
+    return;
+  }
+
+  if (q->ratio > 1) {
+    srslte_resampler_fft_free(&q->decimator);
+  }
+  if (q->mix_buffer) {
+    free(q->mix_buffer);
+  }
+
+  memset(q, 0, sizeof(srslte_channelizer_t));
+}
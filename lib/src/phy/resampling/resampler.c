@@ -263,6 +263,16 @@ void srslte_resampler_fft_run(srslte_resampler_fft_t* q, const cf_t* input, cf_t
   }
 }
 
+void srslte_resampler_fft_reset(srslte_resampler_fft_t* q)
+{
+  if (q == NULL || q->state == NULL) {
+    return;
+  }
+
+  q->state_len = 0;
+  srslte_vec_cf_zero(q->state, q->ifft.size);
+}
+
 void srslte_resampler_fft_free(srslte_resampler_fft_t* q)
 {
   if (q == NULL) {
@@ -295,4 +305,209 @@ uint32_t srslte_resampler_fft_get_delay(srslte_resampler_fft_t* q)
   }
 
   return q->ifft.size / 2;
-}
\ No newline at end of file
+}
+/**
+ * Half length of the polyphase prototype filter, in samples of the lowest of the input and output rates
+ */
+#define RESAMPLER_POLY_ZERO_CROSSINGS 8
+
+/**
+ * The taps of each polyphase filter phase are padded to a multiple of this, so the SIMD dot product has no tail
+ */
+#define RESAMPLER_POLY_TAPS_MULTIPLE 8
+
+/**
+ * Upper bound of the reduced interpolation and decimation factors, it limits the prototype filter size
+ */
+#define RESAMPLER_POLY_MAX_FACTOR 1024
+
+static uint32_t resampler_gcd(uint32_t a, uint32_t b)
+{
+  while (b != 0) {
+    uint32_t t = a % b;
+    a          = b;
+    b          = t;
+  }
+  return a;
+}
+
+int srslte_resampler_poly_init(srslte_resampler_poly_t* q, uint32_t interp, uint32_t decim)
+{
+  if (q == NULL || interp == 0 || decim == 0) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+
+  // Make sure resampler is freed
+  srslte_resampler_poly_free(q);
+
+  uint32_t gcd = resampler_gcd(interp, decim);
+  interp /= gcd;
+  decim /= gcd;
+
+  // Initialising the resampler is unnecessary
+  if (interp == decim) {
+    q->interp = 1;
+    q->decim  = 1;
+    return SRSLTE_ERROR_OUT_OF_BOUNDS;
+  }
+
+  uint32_t factor = SRSLTE_MAX(interp, decim);
+  if (factor > RESAMPLER_POLY_MAX_FACTOR) {
+    ERROR("Resampling ratio %d/%d exceeds the maximum factor %d\n", interp, decim, RESAMPLER_POLY_MAX_FACTOR);
+    return SRSLTE_ERROR_OUT_OF_BOUNDS;
+  }
+
+  // The prototype filter runs at interp times the input rate and cuts at the Nyquist frequency of the lowest rate
+  uint32_t nof_taps = (2 * RESAMPLER_POLY_ZERO_CROSSINGS * factor + interp - 1) / interp;
+  uint32_t multiple = RESAMPLER_POLY_TAPS_MULTIPLE;
+  nof_taps          = multiple * ((nof_taps + multiple - 1) / multiple);
+  uint32_t len      = interp * nof_taps;
+
+  q->interp   = interp;
+  q->decim    = decim;
+  q->nof_taps = nof_taps;
+
+  q->taps = srslte_vec_f_malloc(len);
+  if (q->taps == NULL) {
+    return SRSLTE_ERROR;
+  }
+
+  q->window = srslte_vec_cf_malloc(2 * (nof_taps - 1));
+  if (q->window == NULL) {
+    return SRSLTE_ERROR;
+  }
+
+  // Blackman windowed sinc, each phase p takes the taps p, p + interp, p + 2 * interp... in reversed order
+  double center = (double)(len - 1) / 2.0;
+  double fc     = 0.5 / (double)factor;
+  double sum    = 0.0;
+  for (uint32_t i = 0; i < len; i++) {
+    double t = (double)i - center;
+    double h = 2.0 * fc;
+    if (isnormal(t)) {
+      h = sin(2.0 * M_PI * fc * t) / (M_PI * t);
+    }
+    h *= 0.42 - 0.5 * cos(2.0 * M_PI * i / (len - 1)) + 0.08 * cos(4.0 * M_PI * i / (len - 1));
+
+    q->taps[(i % interp) * nof_taps + nof_taps - 1 - i / interp] = (float)h;
+    sum += h;
+  }
+
+  // Normalise filter for unitary gain in every phase
+  srslte_vec_sc_prod_fff(q->taps, (float)(interp / sum), q->taps, len);
+
+  srslte_resampler_poly_reset(q);
+
+  return SRSLTE_SUCCESS;
+}
+
+uint32_t srslte_resampler_poly_get_nof_output(const srslte_resampler_poly_t* q, uint32_t nof_input)
+{
+  if (q == NULL || q->interp == 0) {
+    return 0;
+  }
+
+  uint64_t end   = (uint64_t)nof_input * q->interp;
+  uint64_t start = (uint64_t)q->offset * q->interp + q->phase;
+  if (end <= start) {
+    return 0;
+  }
+
+  return (uint32_t)((end - start + q->decim - 1) / q->decim);
+}
+
+uint32_t srslte_resampler_poly_get_nof_input(const srslte_resampler_poly_t* q, uint32_t nof_output)
+{
+  if (q == NULL || q->interp == 0 || nof_output == 0) {
+    return 0;
+  }
+
+  return q->offset + (uint32_t)((q->phase + (uint64_t)(nof_output - 1) * q->decim) / q->interp) + 1;
+}
+
+float srslte_resampler_poly_get_delay(const srslte_resampler_poly_t* q)
+{
+  if (q == NULL || q->interp == 0) {
+    return 0.0f;
+  }
+
+  return (float)(q->interp * q->nof_taps - 1) / (2.0f * q->interp);
+}
+
+uint32_t srslte_resampler_poly_run(srslte_resampler_poly_t* q, const cf_t* input, cf_t* output, uint32_t nsamples)
+{
+  if (q == NULL || q->taps == NULL) {
+    return 0;
+  }
+
+  bool     valid  = (input != NULL && output != NULL);
+  uint32_t hist   = q->nof_taps - 1;
+  uint32_t head   = SRSLTE_MIN(nsamples, hist);
+  uint32_t step   = q->decim / q->interp;
+  uint32_t frac   = q->decim % q->interp;
+  uint32_t count  = 0;
+  cf_t*    window = q->window;
+
+  // Outputs overlapping the previous run are computed from the window, which keeps the previous input samples
+  if (valid) {
+    srslte_vec_cf_copy(&window[hist], input, head);
+  } else {
+    srslte_vec_cf_zero(&window[hist], head);
+  }
+
+  while (q->offset < nsamples) {
+    if (valid) {
+      const cf_t* x  = (q->offset < head) ? &window[q->offset] : &input[q->offset - hist];
+      output[count] = srslte_vec_dot_prod_cfc(x, &q->taps[q->phase * q->nof_taps], q->nof_taps);
+    }
+    count++;
+
+    q->phase += frac;
+    q->offset += step;
+    if (q->phase >= q->interp) {
+      q->phase -= q->interp;
+      q->offset++;
+    }
+  }
+  q->offset -= nsamples;
+
+  // Keep the last input samples for the next run
+  if (nsamples >= hist) {
+    if (valid) {
+      srslte_vec_cf_copy(window, &input[nsamples - hist], hist);
+    } else {
+      srslte_vec_cf_zero(window, hist);
+    }
+  } else {
+    memmove(window, &window[nsamples], sizeof(cf_t) * hist);
+  }
+
+  return count;
+}
+
+void srslte_resampler_poly_reset(srslte_resampler_poly_t* q)
+{
+  if (q == NULL || q->window == NULL) {
+    return;
+  }
+
+  q->phase  = 0;
+  q->offset = 0;
+  srslte_vec_cf_zero(q->window, 2 * (q->nof_taps - 1));
+}
+
+void srslte_resampler_poly_free(srslte_resampler_poly_t* q)
+{
+  if (q == NULL) {
+    return;
+  }
+
+  if (q->taps) {
+    free(q->taps);
+  }
+  if (q->window) {
+    free(q->window);
+  }
+
+  memset(q, 0, sizeof(srslte_resampler_poly_t));
+}
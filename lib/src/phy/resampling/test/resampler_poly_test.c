@@ -0,0 +1,163 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srslte/phy/resampling/resampler.h"
+#include "srslte/phy/utils/debug.h"
+#include "srslte/phy/utils/vector.h"
+#include <complex.h>
+#include <getopt.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+static uint32_t buffer_size = 19200;
+static uint32_t interp      = 1;
+static uint32_t decim       = 12;
+static uint32_t repetitions = 10;
+
+static void usage(char* prog)
+{
+  printf("Usage: %s [sidr]\n", prog);
+  printf("\t-s Input buffer size [Default %d]\n", buffer_size);
+  printf("\t-i Interpolation factor [Default %d]\n", interp);
+  printf("\t-d Decimation factor [Default %d]\n", decim);
+  printf("\t-r Repetitions for the throughput measurement [Default %d]\n", repetitions);
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int opt;
+
+  while ((opt = getopt(argc, argv, "sidr")) != -1) {
+    switch (opt) {
+      case 's':
+        buffer_size = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'i':
+        interp = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'd':
+        decim = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'r':
+        repetitions = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+int main(int argc, char** argv)
+{
+  struct timeval          t[3]  = {};
+  srslte_resampler_poly_t q     = {};
+  int                     ret   = SRSLTE_ERROR;
+  uint32_t                count = 0;
+
+  parse_args(argc, argv);
+
+  if (srslte_resampler_poly_init(&q, interp, decim)) {
+    return SRSLTE_ERROR;
+  }
+
+  uint32_t nof_output = srslte_resampler_poly_get_nof_output(&q, buffer_size);
+  cf_t*    src        = srslte_vec_cf_malloc(buffer_size);
+  cf_t*    output     = srslte_vec_cf_malloc(nof_output);
+  cf_t*    stream     = srslte_vec_cf_malloc(nof_output);
+
+  // Tone well inside the band of the lowest rate
+  float freq = 0.1f * SRSLTE_MIN(1.0f, (float)interp / (float)decim);
+  for (uint32_t i = 0; i < buffer_size; i++) {
+    src[i] = cexpf(_Complex_I * 2.0f * (float)M_PI * freq * i);
+  }
+
+  // Single run
+  if (srslte_resampler_poly_run(&q, src, output, buffer_size) != nof_output) {
+    ERROR("Unexpected number of output samples\n");
+    goto clean_exit;
+  }
+
+  // Compare with the ideal tone once the filter has been filled
+  float    delay = srslte_resampler_poly_get_delay(&q);
+  uint32_t start = (uint32_t)((q.nof_taps + 1) * interp / decim) + 1;
+  float    err   = 0.0f;
+  for (uint32_t k = start; k < nof_output; k++) {
+    float ts = (float)((double)k * decim / interp) - delay;
+    cf_t  e  = output[k] - cexpf(_Complex_I * 2.0f * (float)M_PI * freq * ts);
+    err += __real__ e * __real__ e + __imag__ e * __imag__ e;
+  }
+  float mse = sqrtf(err / (nof_output - start));
+  printf("MSE: %f\n", mse);
+  if (!(mse < 0.01f)) {
+    ERROR("MSE exceeds the limit\n");
+    goto clean_exit;
+  }
+
+  // The same stream in runs of varying size must give the same output
+  srslte_resampler_poly_reset(&q);
+  for (uint32_t n = 0, i = 0; n < buffer_size; i++) {
+    uint32_t len      = SRSLTE_MIN((i * 7919) % (3 * q.nof_taps) + 1, buffer_size - n);
+    uint32_t expected = srslte_resampler_poly_get_nof_output(&q, len);
+    if (srslte_resampler_poly_run(&q, &src[n], &stream[count], len) != expected) {
+      ERROR("Unexpected number of output samples in run %d\n", i);
+      goto clean_exit;
+    }
+    count += expected;
+    n += len;
+  }
+  if (count != nof_output || memcmp(output, stream, sizeof(cf_t) * nof_output) != 0) {
+    ERROR("Split runs do not match the single run\n");
+    goto clean_exit;
+  }
+
+  // When decimating, the number of input samples for a given number of outputs is exact
+  if (decim > interp) {
+    srslte_resampler_poly_reset(&q);
+    for (uint32_t i = 0; i < 100; i++) {
+      uint32_t n = srslte_resampler_poly_get_nof_input(&q, 1 + i);
+      if (n > buffer_size || srslte_resampler_poly_run(&q, src, output, n) != 1 + i) {
+        ERROR("Unexpected number of output samples for %d input samples\n", n);
+        goto clean_exit;
+      }
+    }
+  }
+
+  gettimeofday(&t[1], NULL);
+  for (uint32_t r = 0; r < repetitions; r++) {
+    srslte_resampler_poly_run(&q, src, output, buffer_size);
+  }
+  gettimeofday(&t[2], NULL);
+  get_time_interval(t);
+  uint64_t duration_us = (uint64_t)(t[0].tv_sec * 1000000UL + t[0].tv_usec);
+  printf("Done %.1f Msps\n", buffer_size * repetitions / (double)duration_us);
+
+  ret = SRSLTE_SUCCESS;
+
+clean_exit:
+  srslte_resampler_poly_free(&q);
+  free(src);
+  free(output);
+  free(stream);
+
+  return ret;
+}
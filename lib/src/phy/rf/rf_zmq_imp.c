@@ -732,7 +732,7 @@ int rf_zmq_recv_with_time_multi(void*    h,
     rf_zmq_info(handler->id,
                 " - read %d samples. %d samples available\n",
                 NBYTES2NSAMPLES(nbytes),
-                NBYTES2NSAMPLES(srslte_ringbuffer_status(&handler->receiver[0].ringbuffer)));
+                NBYTES2NSAMPLES(srslte_spsc_ringbuffer_status(&handler->receiver[0].ringbuffer)));
 
     // decimate if needed
     if (decim_factor != 1) {
@@ -31,9 +31,10 @@ static void* rf_zmq_async_rx_thread(void* h)
   rf_zmq_rx_t* q = (rf_zmq_rx_t*)h;
 
   while (q->sock && q->running) {
-    int     nbytes = 0;
-    int     n      = SRSLTE_ERROR;
-    uint8_t dummy  = 0xFF;
+    int       nbytes = 0;
+    int       n      = SRSLTE_ERROR;
+    uint8_t   dummy  = 0xFF;
+    zmq_msg_t msg;
 
     rf_zmq_info(q->id, "-- ASYNC RX wait...\n");
 
@@ -52,11 +53,13 @@ static void* rf_zmq_async_rx_thread(void* h)
       n = 0;
     }
 
-    // Receive baseband
+    // Receive baseband, the message is kept by ZMQ and copied once into the ring buffer
+    zmq_msg_init(&msg);
     for (n = (n < 0) ? 0 : -1; n < 0 && q->running;) {
-      n = zmq_recv(q->sock, q->temp_buffer, ZMQ_MAX_BUFFER_SIZE, 0);
+      n = zmq_msg_recv(&msg, q->sock, 0);
       if (n == -1) {
         if (rf_zmq_handle_error(q->id, "asynchronous rx baseband receive")) {
+          zmq_msg_close(&msg);
           return NULL;
         }
 
@@ -66,6 +69,7 @@ static void* rf_zmq_async_rx_thread(void* h)
                 ZMQ_MAX_BUFFER_SIZE,
                 n,
                 0);
+        zmq_msg_close(&msg);
         return NULL;
       } else {
         nbytes = n;
@@ -76,20 +80,27 @@ static void* rf_zmq_async_rx_thread(void* h)
     if (nbytes > 0) {
       n = -1;
 
-      // Try to write in ring buffer
+      // Try to reserve space in ring buffer
+      srslte_spsc_ringbuffer_span_t span = {};
       while (n < 0 && q->running) {
-        n = srslte_ringbuffer_write_timed(&q->ringbuffer, q->temp_buffer, nbytes, ZMQ_TIMEOUT_MS);
+        n = srslte_spsc_ringbuffer_reserve(&q->ringbuffer, nbytes, ZMQ_TIMEOUT_MS, &span);
       }
 
       // Check write
       if (nbytes == n) {
+        uint8_t* data = (uint8_t*)zmq_msg_data(&msg);
+        memcpy(span.ptr[0], data, span.len[0]);
+        memcpy(span.ptr[1], &data[span.len[0]], span.len[1]);
+        srslte_spsc_ringbuffer_commit(&q->ringbuffer, nbytes);
+
         rf_zmq_info(q->id,
                     "   - received %d baseband samples (%d B). %d samples available.\n",
                     NBYTES2NSAMPLES(n),
                     n,
-                    NBYTES2NSAMPLES(srslte_ringbuffer_status(&q->ringbuffer)));
+                    NBYTES2NSAMPLES(srslte_spsc_ringbuffer_status(&q->ringbuffer)));
       }
     }
+    zmq_msg_close(&msg);
   }
 
   return NULL;
@@ -166,23 +177,11 @@ int rf_zmq_rx_open(rf_zmq_rx_t* q, rf_zmq_opts_t opts, void* zmq_ctx, char* sock
     }
 #endif
 
-    if (srslte_ringbuffer_init(&q->ringbuffer, ZMQ_MAX_BUFFER_SIZE)) {
+    if (srslte_spsc_ringbuffer_init(&q->ringbuffer, ZMQ_MAX_BUFFER_SIZE)) {
       fprintf(stderr, "Error: initiating ringbuffer\n");
       goto clean_exit;
     }
 
-    q->temp_buffer = srslte_vec_malloc(ZMQ_MAX_BUFFER_SIZE);
-    if (!q->temp_buffer) {
-      fprintf(stderr, "Error: allocating rx buffer\n");
-      goto clean_exit;
-    }
-
-    q->temp_buffer_convert = srslte_vec_malloc(ZMQ_MAX_BUFFER_SIZE);
-    if (!q->temp_buffer_convert) {
-      fprintf(stderr, "Error: allocating rx buffer\n");
-      goto clean_exit;
-    }
-
     if (pthread_mutex_init(&q->mutex, NULL)) {
       fprintf(stderr, "Error: creating mutex\n");
       goto clean_exit;
@@ -203,21 +202,22 @@ clean_exit:
 
 int rf_zmq_rx_baseband(rf_zmq_rx_t* q, cf_t* buffer, uint32_t nsamples)
 {
-  void*    dst_buffer = buffer;
-  uint32_t sample_sz  = sizeof(cf_t);
-  if (q->sample_format != ZMQ_TYPE_FC32) {
-    dst_buffer = q->temp_buffer_convert;
-    sample_sz  = 2 * sizeof(short);
+  if (q->sample_format == ZMQ_TYPE_FC32) {
+    return srslte_spsc_ringbuffer_read(&q->ringbuffer, buffer, sizeof(cf_t) * nsamples, ZMQ_TIMEOUT_MS);
   }
 
-  int n = srslte_ringbuffer_read_timed(&q->ringbuffer, dst_buffer, sample_sz * nsamples, ZMQ_TIMEOUT_MS);
-  if (n < 0) {
+  // Convert the samples straight from the ring buffer memory
+  srslte_spsc_ringbuffer_span_t span = {};
+
+  int n = srslte_spsc_ringbuffer_peek(&q->ringbuffer, 2 * sizeof(short) * nsamples, ZMQ_TIMEOUT_MS, &span);
+  if (n <= 0) {
     return n;
   }
 
-  if (q->sample_format == ZMQ_TYPE_SC16) {
-    srslte_vec_convert_if(dst_buffer, INT16_MAX, (float*)buffer, 2 * nsamples);
-  }
+  uint32_t nof_values = span.len[0] / sizeof(short);
+  srslte_vec_convert_if((int16_t*)span.ptr[0], INT16_MAX, (float*)buffer, nof_values);
+  srslte_vec_convert_if((int16_t*)span.ptr[1], INT16_MAX, &((float*)buffer)[nof_values], 2 * nsamples - nof_values);
+  srslte_spsc_ringbuffer_release(&q->ringbuffer, n);
 
   return n;
 }
@@ -241,15 +241,7 @@ void rf_zmq_rx_close(rf_zmq_rx_t* q)
     pthread_detach(q->thread);
   }
 
-  srslte_ringbuffer_free(&q->ringbuffer);
-
-  if (q->temp_buffer) {
-    free(q->temp_buffer);
-  }
-
-  if (q->temp_buffer_convert) {
-    free(q->temp_buffer_convert);
-  }
+  srslte_spsc_ringbuffer_free(&q->ringbuffer);
 
   if (q->sock) {
     zmq_close(q->sock);
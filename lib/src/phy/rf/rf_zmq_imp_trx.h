@@ -23,7 +23,7 @@
 #define SRSLTE_RF_ZMQ_IMP_TRX_H
 
 #include <pthread.h>
-#include <srslte/phy/utils/ringbuffer.h>
+#include <srslte/phy/utils/spsc_ringbuffer.h>
 #include <stdbool.h>
 
 /* Definitions */
@@ -62,15 +62,13 @@ typedef struct {
   void* socket_monitor;
   bool  tx_connected;
 #endif
-  uint64_t            nsamples;
-  bool                running;
-  pthread_t           thread;
-  pthread_mutex_t     mutex;
-  srslte_ringbuffer_t ringbuffer;
-  cf_t*               temp_buffer;
-  void*               temp_buffer_convert;
-  uint32_t            frequency_mhz;
-  bool                fail_on_disconnect;
+  uint64_t                 nsamples;
+  bool                     running;
+  pthread_t                thread;
+  pthread_mutex_t          mutex;
+  srslte_spsc_ringbuffer_t ringbuffer;
+  uint32_t                 frequency_mhz;
+  bool                     fail_on_disconnect;
 } rf_zmq_rx_t;
 
 typedef struct {
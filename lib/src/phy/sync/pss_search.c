@@ -0,0 +1,323 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <complex.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "srslte/phy/sync/pss.h"
+#include "srslte/phy/sync/pss_search.h"
+#include "srslte/phy/utils/debug.h"
+#include "srslte/phy/utils/vector.h"
+
+// Number of new correlation outputs produced by each overlap-save block
+#define PSS_SEARCH_STEP (SRSLTE_PSS_SEARCH_BLOCK_SZ - SRSLTE_PSS_SEARCH_SYMBOL_SZ)
+
+/* Generates the conjugated time-domain PSS (same scaling as srslte_pss_t) and the frequency response of the matched
+ * filter, so that IDFT(DFT(x) * filter) yields corr[n] = sum_k x[n + k] * pss_time[k] for the first PSS_SEARCH_STEP
+ * outputs of every block.
+ */
+static int pss_search_init_N_id_2(srslte_pss_search_t* q, uint32_t N_id_2)
+{
+  srslte_dft_plan_t plan     = {};
+  cf_t              pss_freq[SRSLTE_PSS_LEN];
+  cf_t              pss_pad[SRSLTE_PSS_SEARCH_SYMBOL_SZ];
+  const uint32_t    symbol_sz = SRSLTE_PSS_SEARCH_SYMBOL_SZ;
+
+  if (srslte_pss_generate(pss_freq, N_id_2)) {
+    return SRSLTE_ERROR;
+  }
+
+  srslte_vec_cf_zero(pss_pad, symbol_sz);
+  srslte_vec_cf_copy(&pss_pad[(symbol_sz - SRSLTE_PSS_LEN) / 2], pss_freq, SRSLTE_PSS_LEN);
+
+  if (srslte_dft_plan(&plan, symbol_sz, SRSLTE_DFT_BACKWARD, SRSLTE_DFT_COMPLEX)) {
+    return SRSLTE_ERROR;
+  }
+  srslte_dft_plan_set_mirror(&plan, true);
+  srslte_dft_plan_set_dc(&plan, true);
+  srslte_dft_plan_set_norm(&plan, true);
+  srslte_dft_run_c(&plan, pss_pad, q->pss_time[N_id_2]);
+  srslte_dft_plan_free(&plan);
+
+  srslte_vec_conj_cc(q->pss_time[N_id_2], q->pss_time[N_id_2], symbol_sz);
+  srslte_vec_sc_prod_cfc(q->pss_time[N_id_2], 1.0f / SRSLTE_PSS_LEN, q->pss_time[N_id_2], symbol_sz);
+
+  // Time-reversed filter, so the circular convolution becomes a correlation
+  cf_t* filter = q->tmp_block[N_id_2];
+  srslte_vec_cf_zero(filter, SRSLTE_PSS_SEARCH_BLOCK_SZ);
+  filter[0] = q->pss_time[N_id_2][0];
+  for (uint32_t k = 1; k < symbol_sz; k++) {
+    filter[SRSLTE_PSS_SEARCH_BLOCK_SZ - k] = q->pss_time[N_id_2][k];
+  }
+  srslte_dft_run_c_zerocopy(&q->dftp, filter, q->pss_filter_fft[N_id_2]);
+
+  // Compensate the unnormalized forward and inverse transforms once here
+  srslte_vec_sc_prod_cfc(
+      q->pss_filter_fft[N_id_2], 1.0f / SRSLTE_PSS_SEARCH_BLOCK_SZ, q->pss_filter_fft[N_id_2], SRSLTE_PSS_SEARCH_BLOCK_SZ);
+
+  return SRSLTE_SUCCESS;
+}
+
+int srslte_pss_search_init(srslte_pss_search_t* q, uint32_t max_samples)
+{
+  int ret = SRSLTE_ERROR_INVALID_INPUTS;
+
+  if (q != NULL && max_samples >= SRSLTE_PSS_SEARCH_SYMBOL_SZ) {
+    ret = SRSLTE_ERROR;
+    bzero(q, sizeof(srslte_pss_search_t));
+
+    q->max_samples = max_samples;
+    q->max_blocks  = (max_samples + PSS_SEARCH_STEP - 1) / PSS_SEARCH_STEP;
+
+    if (srslte_dft_plan_c(&q->dftp, SRSLTE_PSS_SEARCH_BLOCK_SZ, SRSLTE_DFT_FORWARD)) {
+      ERROR("Error creating PSS search DFT plan\n");
+      goto clean_exit;
+    }
+
+    q->input_fft = srslte_vec_cf_malloc(q->max_blocks * SRSLTE_PSS_SEARCH_BLOCK_SZ);
+    if (!q->input_fft) {
+      perror("malloc");
+      goto clean_exit;
+    }
+
+    for (uint32_t N_id_2 = 0; N_id_2 < 3; N_id_2++) {
+      if (srslte_dft_plan_c(&q->idftp[N_id_2], SRSLTE_PSS_SEARCH_BLOCK_SZ, SRSLTE_DFT_BACKWARD)) {
+        ERROR("Error creating PSS search IDFT plan\n");
+        goto clean_exit;
+      }
+      q->pss_filter_fft[N_id_2] = srslte_vec_cf_malloc(SRSLTE_PSS_SEARCH_BLOCK_SZ);
+      q->tmp_block[N_id_2]      = srslte_vec_cf_malloc(SRSLTE_PSS_SEARCH_BLOCK_SZ);
+      q->tmp_corr[N_id_2]       = srslte_vec_cf_malloc(SRSLTE_PSS_SEARCH_BLOCK_SZ);
+      q->corr_power[N_id_2]     = srslte_vec_f_malloc(SRSLTE_PSS_SEARCH_PERIOD);
+      q->corr_count[N_id_2]     = srslte_vec_u32_malloc(SRSLTE_PSS_SEARCH_PERIOD);
+      if (!q->pss_filter_fft[N_id_2] || !q->tmp_block[N_id_2] || !q->tmp_corr[N_id_2] || !q->corr_power[N_id_2] ||
+          !q->corr_count[N_id_2]) {
+        perror("malloc");
+        goto clean_exit;
+      }
+      if (pss_search_init_N_id_2(q, N_id_2)) {
+        ERROR("Error initiating PSS search for N_id_2=%d\n", N_id_2);
+        goto clean_exit;
+      }
+    }
+
+    ret = SRSLTE_SUCCESS;
+  }
+
+clean_exit:
+  if (ret == SRSLTE_ERROR) {
+    srslte_pss_search_free(q);
+  }
+  return ret;
+}
+
+void srslte_pss_search_free(srslte_pss_search_t* q)
+{
+  if (q) {
+    srslte_dft_plan_free(&q->dftp);
+    if (q->input_fft) {
+      free(q->input_fft);
+    }
+    for (uint32_t N_id_2 = 0; N_id_2 < 3; N_id_2++) {
+      srslte_dft_plan_free(&q->idftp[N_id_2]);
+      if (q->pss_filter_fft[N_id_2]) {
+        free(q->pss_filter_fft[N_id_2]);
+      }
+      if (q->tmp_block[N_id_2]) {
+        free(q->tmp_block[N_id_2]);
+      }
+      if (q->tmp_corr[N_id_2]) {
+        free(q->tmp_corr[N_id_2]);
+      }
+      if (q->corr_power[N_id_2]) {
+        free(q->corr_power[N_id_2]);
+      }
+      if (q->corr_count[N_id_2]) {
+        free(q->corr_count[N_id_2]);
+      }
+    }
+    bzero(q, sizeof(srslte_pss_search_t));
+  }
+}
+
+/* Transforms the overlap-save blocks of the input. This is the only part of the search shared by the three
+ * hypotheses. The input buffer must remain valid until the last call to srslte_pss_search_run().
+ */
+int srslte_pss_search_set_input(srslte_pss_search_t* q, const cf_t* input, uint32_t nof_samples)
+{
+  if (q == NULL || input == NULL || nof_samples < SRSLTE_PSS_SEARCH_SYMBOL_SZ || nof_samples > q->max_samples) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+
+  q->input       = input;
+  q->nof_samples = nof_samples;
+  q->nof_blocks  = (nof_samples - SRSLTE_PSS_SEARCH_SYMBOL_SZ + PSS_SEARCH_STEP) / PSS_SEARCH_STEP;
+
+  // Reuse the first hypothesis scratch buffer, runs are not allowed while the input is being set
+  cf_t* block = q->tmp_block[0];
+  for (uint32_t b = 0; b < q->nof_blocks; b++) {
+    uint32_t offset = b * PSS_SEARCH_STEP;
+    uint32_t len    = SRSLTE_MIN(SRSLTE_PSS_SEARCH_BLOCK_SZ, nof_samples - offset);
+    srslte_vec_cf_copy(block, &input[offset], len);
+    if (len < SRSLTE_PSS_SEARCH_BLOCK_SZ) {
+      srslte_vec_cf_zero(&block[len], SRSLTE_PSS_SEARCH_BLOCK_SZ - len);
+    }
+    srslte_dft_run_c_zerocopy(&q->dftp, block, &q->input_fft[b * SRSLTE_PSS_SEARCH_BLOCK_SZ]);
+  }
+
+  return SRSLTE_SUCCESS;
+}
+
+/* Peak to side-lobe ratio of the folded correlation, the main lobe extends while the correlation decreases */
+static float pss_search_psr(const float* corr, uint32_t peak_pos)
+{
+  const uint32_t len = SRSLTE_PSS_SEARCH_PERIOD;
+
+  uint32_t ub = 0;
+  while (ub < len / 2 && corr[(peak_pos + ub + 1) % len] <= corr[(peak_pos + ub) % len]) {
+    ub++;
+  }
+  uint32_t lb = 0;
+  while (lb < len / 2 && corr[(peak_pos + len - lb - 1) % len] <= corr[(peak_pos + len - lb) % len]) {
+    lb++;
+  }
+
+  float side_lobe = 0.0f;
+  for (uint32_t i = ub + 1; i < len - lb; i++) {
+    side_lobe = SRSLTE_MAX(side_lobe, corr[(peak_pos + i) % len]);
+  }
+
+  return side_lobe > 0.0f ? corr[peak_pos] / side_lobe : 0.0f;
+}
+
+/* Correlates the input set with srslte_pss_search_set_input() against the PSS of N_id_2, accumulates the correlation
+ * power modulo the PSS period and returns its strongest peak. The CFO is estimated averaging the half-symbol
+ * phase difference of all the PSS occurrences at the peak. Returns SRSLTE_SUCCESS or an error code.
+ */
+int srslte_pss_search_run(srslte_pss_search_t* q, uint32_t N_id_2, srslte_pss_search_result_t* result)
+{
+  if (q == NULL || result == NULL || q->input == NULL || !srslte_N_id_2_isvalid(N_id_2)) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+
+  const uint32_t symbol_sz = SRSLTE_PSS_SEARCH_SYMBOL_SZ;
+  const uint32_t period    = SRSLTE_PSS_SEARCH_PERIOD;
+  const uint32_t nof_corr  = q->nof_samples - symbol_sz + 1;
+
+  float*    corr_power = q->corr_power[N_id_2];
+  uint32_t* corr_count = q->corr_count[N_id_2];
+  float*    corr_pow   = (float*)q->tmp_block[N_id_2];
+
+  srslte_vec_f_zero(corr_power, period);
+  memset(corr_count, 0, sizeof(uint32_t) * period);
+
+  for (uint32_t b = 0; b < q->nof_blocks; b++) {
+    srslte_vec_prod_ccc(&q->input_fft[b * SRSLTE_PSS_SEARCH_BLOCK_SZ],
+                        q->pss_filter_fft[N_id_2],
+                        q->tmp_block[N_id_2],
+                        SRSLTE_PSS_SEARCH_BLOCK_SZ);
+    srslte_dft_run_c_zerocopy(&q->idftp[N_id_2], q->tmp_block[N_id_2], q->tmp_corr[N_id_2]);
+
+    uint32_t offset = b * PSS_SEARCH_STEP;
+    uint32_t len    = SRSLTE_MIN(PSS_SEARCH_STEP, nof_corr - offset);
+    srslte_vec_abs_square_cf(q->tmp_corr[N_id_2], corr_pow, len);
+
+    // Fold into the PSS period in contiguous chunks so the accumulation stays vectorized
+    uint32_t i = 0;
+    while (i < len) {
+      uint32_t pos   = (offset + i) % period;
+      uint32_t chunk = SRSLTE_MIN(len - i, period - pos);
+      srslte_vec_sum_fff(&corr_power[pos], &corr_pow[i], &corr_power[pos], chunk);
+      for (uint32_t k = 0; k < chunk; k++) {
+        corr_count[pos + k]++;
+      }
+      i += chunk;
+    }
+  }
+
+  // Average each folded position over the number of times it was observed
+  uint32_t max_count = 0;
+  for (uint32_t i = 0; i < period; i++) {
+    if (corr_count[i]) {
+      corr_power[i] /= corr_count[i];
+    }
+    max_count = SRSLTE_MAX(max_count, corr_count[i]);
+  }
+
+  uint32_t peak_pos = srslte_vec_max_fi(corr_power, period);
+
+  // PSS-based CFO averaged over all occurrences
+  cf_t     cfo_acc = 0;
+  uint32_t nof_pss = 0;
+  for (uint32_t n = peak_pos; n + symbol_sz <= q->nof_samples; n += period) {
+    cf_t y0 = srslte_vec_dot_prod_ccc(q->pss_time[N_id_2], &q->input[n], symbol_sz / 2);
+    cf_t y1 = srslte_vec_dot_prod_ccc(&q->pss_time[N_id_2][symbol_sz / 2], &q->input[n + symbol_sz / 2], symbol_sz / 2);
+    cfo_acc += conjf(y0) * y1;
+    nof_pss++;
+  }
+
+  result->N_id_2     = N_id_2;
+  result->peak_pos   = peak_pos;
+  result->peak_value = corr_power[peak_pos];
+  result->psr        = pss_search_psr(corr_power, peak_pos);
+  result->cfo        = cargf(cfo_acc) / M_PI;
+  result->nof_pss    = nof_pss;
+
+  DEBUG("PSS search: N_id_2=%d, peak_pos=%d, peak_value=%f, psr=%.1f, cfo=%.3f, blocks=%d, folds=%d\n",
+        N_id_2,
+        peak_pos,
+        result->peak_value,
+        result->psr,
+        result->cfo,
+        q->nof_blocks,
+        max_count);
+
+  return SRSLTE_SUCCESS;
+}
+
+/* Decides the CP length from the correlation between the CP and the end of the three symbols preceding the end of
+ * the PSS, as srslte_sync_detect_cp() does. pss_symbol points at the PSS symbol without CP and must be preceded by
+ * three symbols with extended CP.
+ */
+srslte_cp_t srslte_pss_search_detect_cp(const cf_t* pss_symbol)
+{
+  const uint32_t symbol_sz = SRSLTE_PSS_SEARCH_SYMBOL_SZ;
+  const uint32_t cp_len[2] = {SRSLTE_CP_LEN_NORM(7, symbol_sz), SRSLTE_CP_LEN_EXT(symbol_sz)};
+  float          M[2]      = {};
+
+  for (uint32_t i = 0; i < 2; i++) {
+    const cf_t* ptr = &pss_symbol[(int)symbol_sz - 3 * (int)(symbol_sz + cp_len[i])];
+    float       R   = 0.0f;
+    float       C   = 0.0f;
+    for (uint32_t s = 0; s < 3; s++) {
+      R += crealf(srslte_vec_dot_prod_conj_ccc(&ptr[symbol_sz], ptr, cp_len[i]));
+      C += cp_len[i] * srslte_vec_avg_power_cf(ptr, cp_len[i]);
+      ptr += symbol_sz + cp_len[i];
+    }
+    if (C > 0) {
+      M[i] = R / C;
+    }
+  }
+
+  return M[0] >= M[1] ? SRSLTE_CP_NORM : SRSLTE_CP_EXT;
+}
@@ -82,11 +82,21 @@ static inline void refsignal_sf_prepare_correlation(srslte_refsignal_dl_sync_t*
   srslte_dft_run_c(&q->conv_fft_cc.filter_plan, ptr_filt, ptr_filt);
 }
 
-static inline void
-refsignal_sf_correlate(srslte_refsignal_dl_sync_t* q, cf_t* ptr_in, float* peak_value, uint32_t* peak_idx, float* rms)
+static inline void refsignal_sf_correlate(srslte_refsignal_dl_sync_t* q,
+                                          cf_t*                       ptr_in,
+                                          const cf_t*                 input_fft,
+                                          float*                      peak_value,
+                                          uint32_t*                   peak_idx,
+                                          float*                      rms)
 {
-  // Correlate
-  srslte_corr_fft_cc_run_opt(&q->conv_fft_cc, ptr_in, q->conv_fft_cc.filter_fft, q->correlation);
+  // Correlate, skipping the input FFT if it was already computed
+  if (input_fft) {
+    srslte_conv_fft_cc_t* conv = &q->conv_fft_cc;
+    srslte_vec_prod_conj_ccc(input_fft, conv->filter_fft, conv->output_fft, conv->output_len);
+    srslte_dft_run_c(&conv->output_plan, conv->output_fft, q->correlation);
+  } else {
+    srslte_corr_fft_cc_run_opt(&q->conv_fft_cc, ptr_in, q->conv_fft_cc.filter_fft, q->correlation);
+  }
 
   // Find maximum, calculate RMS and peak
   uint32_t imax = srslte_vec_max_abs_ci(q->correlation, q->ifft.sf_sz);
@@ -298,7 +308,10 @@ void srslte_refsignal_dl_sync_free(srslte_refsignal_dl_sync_t* q)
   }
 }
 
-int srslte_refsignal_dl_sync_find_peak(srslte_refsignal_dl_sync_t* q, cf_t* buffer, uint32_t nsamples)
+static int refsignal_dl_sync_find_peak(srslte_refsignal_dl_sync_t*             q,
+                                       const srslte_refsignal_dl_sync_input_t* input,
+                                       cf_t*                                   buffer,
+                                       uint32_t                                nsamples)
 {
   int      ret        = SRSLTE_ERROR;
   float    peak_value = 0.0f;
@@ -318,7 +331,8 @@ int srslte_refsignal_dl_sync_find_peak(srslte_refsignal_dl_sync_t* q, cf_t* buff
     uint32_t imax = 0;
     float    peak = 0.0f;
     float    rms  = 0.0f;
-    refsignal_sf_correlate(q, &buffer[n], &peak, &imax, &rms);
+    const cf_t* input_fft = (input && n / sf_len < input->nof_sf) ? input->input_fft[n / sf_len] : NULL;
+    refsignal_sf_correlate(q, &buffer[n], input_fft, &peak, &imax, &rms);
 
     rms_avg += rms;
 
@@ -364,7 +378,15 @@ int srslte_refsignal_dl_sync_find_peak(srslte_refsignal_dl_sync_t* q, cf_t* buff
   return ret;
 }
 
-void srslte_refsignal_dl_sync_run(srslte_refsignal_dl_sync_t* q, cf_t* buffer, uint32_t nsamples)
+int srslte_refsignal_dl_sync_find_peak(srslte_refsignal_dl_sync_t* q, cf_t* buffer, uint32_t nsamples)
+{
+  return refsignal_dl_sync_find_peak(q, NULL, buffer, nsamples);
+}
+
+static void refsignal_dl_sync_run(srslte_refsignal_dl_sync_t*             q,
+                                  const srslte_refsignal_dl_sync_input_t* input,
+                                  cf_t*                                   buffer,
+                                  uint32_t                                nsamples)
 {
   if (q) {
     uint32_t sf_len                 = q->ifft.sf_sz;
@@ -382,7 +404,7 @@ void srslte_refsignal_dl_sync_run(srslte_refsignal_dl_sync_t* q, cf_t* buffer, u
     bool     false_alarm            = false;
 
     // Stage 1: find peak
-    int peak_idx = srslte_refsignal_dl_sync_find_peak(q, buffer, nsamples);
+    int peak_idx = refsignal_dl_sync_find_peak(q, input, buffer, nsamples);
 
     // Stage 2: Proccess subframes
     if (peak_idx >= 0) {
@@ -512,6 +534,96 @@ void srslte_refsignal_dl_sync_run(srslte_refsignal_dl_sync_t* q, cf_t* buffer, u
   }
 }
 
+void srslte_refsignal_dl_sync_run(srslte_refsignal_dl_sync_t* q, cf_t* buffer, uint32_t nsamples)
+{
+  refsignal_dl_sync_run(q, NULL, buffer, nsamples);
+}
+
+void srslte_refsignal_dl_sync_run_input(srslte_refsignal_dl_sync_t*             q,
+                                        const srslte_refsignal_dl_sync_input_t* input,
+                                        cf_t*                                   buffer,
+                                        uint32_t                                nsamples)
+{
+  // Fall back to the stand-alone correlation if the input was computed for another bandwidth
+  if (input && input->nof_prb != q->refsignal.cell.nof_prb) {
+    input = NULL;
+  }
+  refsignal_dl_sync_run(q, input, buffer, nsamples);
+}
+
+int srslte_refsignal_dl_sync_input_init(srslte_refsignal_dl_sync_input_t* q)
+{
+  if (q == NULL) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+
+  memset(q, 0, sizeof(srslte_refsignal_dl_sync_input_t));
+
+  // Same length and normalization as the input plan of the correlation in srslte_refsignal_dl_sync_t
+  q->fft_len = 2 * SRSLTE_SF_LEN_MAX;
+  if (srslte_dft_plan(&q->plan, q->fft_len, SRSLTE_DFT_FORWARD, SRSLTE_DFT_COMPLEX)) {
+    ERROR("Error initiating input plan\n");
+    return SRSLTE_ERROR;
+  }
+  srslte_dft_plan_set_norm(&q->plan, true);
+
+  for (int i = 0; i < SRSLTE_NOF_SF_X_FRAME; i++) {
+    q->input_fft[i] = srslte_vec_cf_malloc(q->fft_len);
+    if (!q->input_fft[i]) {
+      perror("Allocating input_fft\n");
+      return SRSLTE_ERROR;
+    }
+  }
+
+  return SRSLTE_SUCCESS;
+}
+
+int srslte_refsignal_dl_sync_input_set(srslte_refsignal_dl_sync_input_t* q,
+                                       const cf_t*                       buffer,
+                                       uint32_t                          nsamples,
+                                       uint32_t                          nof_prb)
+{
+  if (q == NULL || buffer == NULL || !srslte_nofprb_isvalid(nof_prb)) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+
+  uint32_t sf_len  = SRSLTE_SF_LEN_PRB(nof_prb);
+  uint32_t fft_len = 2 * sf_len;
+
+  if (q->fft_len != fft_len) {
+    if (srslte_dft_replan(&q->plan, fft_len)) {
+      ERROR("Error replanning input plan\n");
+      return SRSLTE_ERROR;
+    }
+    q->fft_len = fft_len;
+  }
+  q->nof_prb = nof_prb;
+
+  // Same subframes as the peak search correlates
+  q->nof_sf = 0;
+  if (nsamples > sf_len) {
+    uint32_t len = SRSLTE_MIN(nsamples - sf_len, SRSLTE_NOF_SF_X_FRAME * sf_len);
+    for (uint32_t n = 0; n < len; n += sf_len) {
+      srslte_dft_run_c(&q->plan, &buffer[n], q->input_fft[q->nof_sf++]);
+    }
+  }
+
+  return SRSLTE_SUCCESS;
+}
+
+void srslte_refsignal_dl_sync_input_free(srslte_refsignal_dl_sync_input_t* q)
+{
+  if (q) {
+    srslte_dft_plan_free(&q->plan);
+    for (int i = 0; i < SRSLTE_NOF_SF_X_FRAME; i++) {
+      if (q->input_fft[i]) {
+        free(q->input_fft[i]);
+      }
+    }
+    memset(q, 0, sizeof(srslte_refsignal_dl_sync_input_t));
+  }
+}
+
 void srslte_refsignal_dl_sync_measure_sf(srslte_refsignal_dl_sync_t* q,
                                          cf_t*                       buffer,
                                          uint32_t                    sf_idx,
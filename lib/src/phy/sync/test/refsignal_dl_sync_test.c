@@ -0,0 +1,164 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "srslte/srslte.h"
+
+static uint32_t nof_prb   = 6;
+static uint32_t cell_id   = 1;
+static uint32_t nof_sf    = 20;
+static float    snr_db    = 10.0f;
+static uint32_t nof_cells = 8;
+
+void usage(char* prog)
+{
+  printf("Usage: %s [pcns]\n", prog);
+  printf("\t-p nof_prb [Default %d]\n", nof_prb);
+  printf("\t-c cell_id [Default %d]\n", cell_id);
+  printf("\t-n nof_sf [Default %d]\n", nof_sf);
+  printf("\t-s SNR in dB [Default %.1f]\n", snr_db);
+}
+
+void parse_args(int argc, char** argv)
+{
+  int opt;
+  while ((opt = getopt(argc, argv, "pcns")) != -1) {
+    switch (opt) {
+      case 'p':
+        nof_prb = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'c':
+        cell_id = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'n':
+        nof_sf = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 's':
+        snr_db = strtof(argv[optind], NULL);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+/* Checks that measuring several cells with the shared subframe FFTs gives the same results as measuring them one by
+ * one with srslte_refsignal_dl_sync_run() */
+int main(int argc, char** argv)
+{
+  int                              ret    = SRSLTE_ERROR;
+  srslte_refsignal_dl_sync_t       q      = {};
+  srslte_refsignal_dl_sync_input_t input  = {};
+  srslte_cell_t                    cell   = {};
+  cf_t*                            buffer = NULL;
+
+  parse_args(argc, argv);
+
+  cell.nof_prb   = nof_prb;
+  cell.nof_ports = 1;
+  cell.cp        = SRSLTE_CP_NORM;
+  cell.id        = cell_id;
+
+  uint32_t sf_len   = SRSLTE_SF_LEN_PRB(nof_prb);
+  uint32_t nsamples = nof_sf * sf_len;
+  uint32_t offset   = sf_len / 3;
+
+  buffer = srslte_vec_cf_malloc(nsamples);
+  if (!buffer || srslte_refsignal_dl_sync_init(&q) || srslte_refsignal_dl_sync_input_init(&input)) {
+    ERROR("Error initiating\n");
+    goto clean_exit;
+  }
+
+  // Generate the reference signals of the cell with a timing offset and add noise
+  if (srslte_refsignal_dl_sync_set_cell(&q, cell)) {
+    ERROR("Error setting cell\n");
+    goto clean_exit;
+  }
+  srslte_vec_cf_zero(buffer, nsamples);
+  for (uint32_t sf = 0; sf < nof_sf; sf++) {
+    uint32_t n   = offset + sf * sf_len;
+    uint32_t len = SRSLTE_MIN(sf_len, nsamples - n);
+    if (n < nsamples) {
+      srslte_vec_cf_copy(&buffer[n], q.sequences[sf % SRSLTE_NOF_SF_X_FRAME], len);
+    }
+  }
+  float signal_power = srslte_vec_avg_power_cf(buffer, nsamples);
+  srslte_ch_awgn_c(buffer, buffer, sqrtf(signal_power * srslte_convert_dB_to_power(-snr_db)), nsamples);
+
+  if (srslte_refsignal_dl_sync_input_set(&input, buffer, nsamples, nof_prb)) {
+    ERROR("Error setting input\n");
+    goto clean_exit;
+  }
+
+  bool found_cell = false;
+  for (uint32_t i = 0; i < nof_cells; i++) {
+    srslte_cell_t c = cell;
+    c.id            = (cell_id + i) % SRSLTE_NUM_PCI;
+    srslte_refsignal_dl_sync_set_cell(&q, c);
+
+    srslte_refsignal_dl_sync_run(&q, buffer, nsamples);
+    bool     found      = q.found;
+    float    rsrp       = q.rsrp_dBfs;
+    uint32_t peak_index = q.peak_index;
+
+    srslte_refsignal_dl_sync_run_input(&q, &input, buffer, nsamples);
+
+    printf("pci=%03d; found=%d/%d; rsrp=%+.2f/%+.2f; peak=%d/%d\n",
+           c.id,
+           found,
+           q.found,
+           rsrp,
+           q.rsrp_dBfs,
+           peak_index,
+           q.peak_index);
+
+    if (found != q.found || peak_index != q.peak_index || (found && fabsf(rsrp - q.rsrp_dBfs) > 0.01f)) {
+      ERROR("Shared FFT measurement differs for PCI %d\n", c.id);
+      goto clean_exit;
+    }
+    if (c.id == cell_id) {
+      found_cell = found && peak_index == offset;
+    }
+  }
+
+  if (!found_cell) {
+    ERROR("Cell %d not found at offset %d\n", cell_id, offset);
+    goto clean_exit;
+  }
+
+  ret = SRSLTE_SUCCESS;
+
+clean_exit:
+  srslte_refsignal_dl_sync_free(&q);
+  srslte_refsignal_dl_sync_input_free(&input);
+  if (buffer) {
+    free(buffer);
+  }
+  printf("%s\n", ret ? "Failed" : "Ok");
+  return ret;
+}
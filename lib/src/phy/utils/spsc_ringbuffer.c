@@ -0,0 +1,333 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "srslte/phy/utils/debug.h"
+#include "srslte/phy/utils/spsc_ringbuffer.h"
+#include "srslte/phy/utils/vector.h"
+
+#define LOAD_ACQUIRE(x) __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define STORE_RELEASE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#define STORE_SEQ_CST(x, v) __atomic_store_n(&(x), (v), __ATOMIC_SEQ_CST)
+#define FENCE_SEQ_CST() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+// Times a side yields the CPU to the other one before it goes to sleep
+#define RING_YIELD_COUNT 16
+
+// Sleeps until seq is notified, returns straight away if it already changed from val
+static void ring_sleep(uint32_t* seq, uint32_t val, const struct timespec* timeout)
+{
+#ifdef __linux__
+  syscall(SYS_futex, seq, FUTEX_WAIT_PRIVATE, val, timeout, NULL, 0);
+#else
+  // Without futexes, poll the other side
+  struct timespec t = {0, 50000};
+  if (LOAD_ACQUIRE(*seq) == val) {
+    nanosleep(&t, NULL);
+  }
+#endif
+}
+
+// Wakes up the side sleeping on seq. It may already have seen the new state and left, a spurious wake-up is harmless
+static void ring_notify(uint32_t* seq)
+{
+  __atomic_add_fetch(seq, 1, __ATOMIC_SEQ_CST);
+#ifdef __linux__
+  syscall(SYS_futex, seq, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+#endif
+}
+
+static inline uint32_t ring_count(const srslte_spsc_ringbuffer_t* q, uint32_t w, uint32_t r)
+{
+  return (w >= r) ? w - r : w + 2 * q->capacity - r;
+}
+
+static inline uint32_t ring_advance(const srslte_spsc_ringbuffer_t* q, uint32_t idx, uint32_t nof_bytes)
+{
+  idx += nof_bytes;
+  return (idx >= 2 * q->capacity) ? idx - 2 * q->capacity : idx;
+}
+
+static void
+ring_span(const srslte_spsc_ringbuffer_t* q, uint32_t idx, uint32_t nof_bytes, srslte_spsc_ringbuffer_span_t* span)
+{
+  uint32_t offset = (idx >= q->capacity) ? idx - q->capacity : idx;
+  uint32_t first  = SRSLTE_MIN(nof_bytes, q->capacity - offset);
+  span->ptr[0]    = &q->buffer[offset];
+  span->len[0]    = first;
+  span->ptr[1]    = q->buffer;
+  span->len[1]    = nof_bytes - first;
+}
+
+static void deadline_init(struct timespec* deadline, int32_t timeout_ms)
+{
+  clock_gettime(CLOCK_MONOTONIC, deadline);
+  deadline->tv_sec += timeout_ms / 1000;
+  deadline->tv_nsec += (timeout_ms % 1000) * 1000000L;
+  if (deadline->tv_nsec >= 1000000000L) {
+    deadline->tv_sec++;
+    deadline->tv_nsec -= 1000000000L;
+  }
+}
+
+// Time left until the deadline, false once it has passed
+static bool deadline_remaining(const struct timespec* deadline, struct timespec* remaining)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  remaining->tv_sec  = deadline->tv_sec - now.tv_sec;
+  remaining->tv_nsec = deadline->tv_nsec - now.tv_nsec;
+  if (remaining->tv_nsec < 0) {
+    remaining->tv_sec--;
+    remaining->tv_nsec += 1000000000L;
+  }
+  return remaining->tv_sec >= 0;
+}
+
+// Updates the cached index of the other side, true if the producer has nof_bytes of space or the consumer of data
+static bool ring_ready(srslte_spsc_ringbuffer_t* q, bool is_producer, uint32_t nof_bytes)
+{
+  if (is_producer) {
+    q->read_idx_cache = LOAD_ACQUIRE(q->read_idx);
+    return q->capacity - ring_count(q, q->write_idx, q->read_idx_cache) >= nof_bytes || !LOAD_ACQUIRE(q->active);
+  }
+  q->write_idx_cache = LOAD_ACQUIRE(q->write_idx);
+  return ring_count(q, q->write_idx_cache, q->read_idx) >= nof_bytes || !LOAD_ACQUIRE(q->active);
+}
+
+/* Waits until the producer (is_producer) has nof_bytes of space or the consumer nof_bytes of data. Before sleeping,
+ * the waiting flag is set and then the condition checked again, while the other side moves its index and then checks
+ * the flag, so at least one of them sees the other and no wake-up is lost.
+ */
+static int ring_wait(srslte_spsc_ringbuffer_t* q, bool is_producer, uint32_t nof_bytes, int32_t timeout_ms)
+{
+  uint32_t* waiting = is_producer ? &q->write_waiting : &q->read_waiting;
+  uint32_t* seq     = is_producer ? &q->space_seq : &q->data_seq;
+
+  if (timeout_ms == 0) {
+    return SRSLTE_ERROR_TIMEOUT;
+  }
+
+  // Let the other side run first, it is often only a few microseconds away
+  for (uint32_t i = 0; i < RING_YIELD_COUNT; i++) {
+    sched_yield();
+    if (ring_ready(q, is_producer, nof_bytes)) {
+      return SRSLTE_SUCCESS;
+    }
+  }
+
+  struct timespec deadline  = {};
+  struct timespec remaining = {};
+  if (timeout_ms > 0) {
+    deadline_init(&deadline, timeout_ms);
+  }
+
+  int ret = SRSLTE_ERROR_TIMEOUT;
+  while (true) {
+    uint32_t s = LOAD_ACQUIRE(*seq);
+    STORE_SEQ_CST(*waiting, 1);
+    FENCE_SEQ_CST();
+
+    if (ring_ready(q, is_producer, nof_bytes)) {
+      ret = SRSLTE_SUCCESS;
+      break;
+    }
+    if (timeout_ms > 0) {
+      if (!deadline_remaining(&deadline, &remaining)) {
+        break;
+      }
+      ring_sleep(seq, s, &remaining);
+    } else {
+      ring_sleep(seq, s, NULL);
+    }
+  }
+  STORE_RELEASE(*waiting, 0);
+  return ret;
+}
+
+int srslte_spsc_ringbuffer_init(srslte_spsc_ringbuffer_t* q, uint32_t capacity)
+{
+  if (q == NULL || capacity == 0 || capacity > INT32_MAX) {
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+  memset(q, 0, sizeof(srslte_spsc_ringbuffer_t));
+  q->buffer = srslte_vec_u8_malloc(capacity);
+  if (!q->buffer) {
+    return SRSLTE_ERROR;
+  }
+  q->capacity = capacity;
+  q->active   = 1;
+
+  return SRSLTE_SUCCESS;
+}
+
+void srslte_spsc_ringbuffer_free(srslte_spsc_ringbuffer_t* q)
+{
+  if (q) {
+    srslte_spsc_ringbuffer_stop(q);
+    if (q->buffer) {
+      free(q->buffer);
+    }
+    memset(q, 0, sizeof(srslte_spsc_ringbuffer_t));
+  }
+}
+
+void srslte_spsc_ringbuffer_reset(srslte_spsc_ringbuffer_t* q)
+{
+  STORE_RELEASE(q->write_idx, 0);
+  STORE_RELEASE(q->read_idx, 0);
+  q->read_idx_cache  = 0;
+  q->write_idx_cache = 0;
+}
+
+void srslte_spsc_ringbuffer_stop(srslte_spsc_ringbuffer_t* q)
+{
+  if (q->capacity == 0) {
+    return;
+  }
+  STORE_SEQ_CST(q->active, 0);
+  ring_notify(&q->data_seq);
+  ring_notify(&q->space_seq);
+}
+
+uint32_t srslte_spsc_ringbuffer_status(srslte_spsc_ringbuffer_t* q)
+{
+  return ring_count(q, LOAD_ACQUIRE(q->write_idx), LOAD_ACQUIRE(q->read_idx));
+}
+
+uint32_t srslte_spsc_ringbuffer_space(srslte_spsc_ringbuffer_t* q)
+{
+  return q->capacity - srslte_spsc_ringbuffer_status(q);
+}
+
+int srslte_spsc_ringbuffer_reserve(srslte_spsc_ringbuffer_t*      q,
+                                   uint32_t                       nof_bytes,
+                                   int32_t                        timeout_ms,
+                                   srslte_spsc_ringbuffer_span_t* span)
+{
+  if (q == NULL || q->buffer == NULL || span == NULL || nof_bytes > q->capacity) {
+    ERROR("Invalid inputs\n");
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+  if (!LOAD_ACQUIRE(q->active)) {
+    return 0;
+  }
+
+  // Only read the consumer index when the last one seen does not leave enough space
+  if (q->capacity - ring_count(q, q->write_idx, q->read_idx_cache) < nof_bytes && !ring_ready(q, true, nof_bytes)) {
+    int ret = ring_wait(q, true, nof_bytes, timeout_ms);
+    if (ret != SRSLTE_SUCCESS) {
+      return ret;
+    }
+  }
+  if (!LOAD_ACQUIRE(q->active)) {
+    return 0;
+  }
+
+  ring_span(q, q->write_idx, nof_bytes, span);
+  return nof_bytes;
+}
+
+void srslte_spsc_ringbuffer_commit(srslte_spsc_ringbuffer_t* q, uint32_t nof_bytes)
+{
+  STORE_RELEASE(q->write_idx, ring_advance(q, q->write_idx, nof_bytes));
+  FENCE_SEQ_CST();
+  if (LOAD_ACQUIRE(q->read_waiting)) {
+    ring_notify(&q->data_seq);
+  }
+}
+
+int srslte_spsc_ringbuffer_write(srslte_spsc_ringbuffer_t* q,
+                                 const void*               ptr,
+                                 uint32_t                  nof_bytes,
+                                 int32_t                   timeout_ms)
+{
+  srslte_spsc_ringbuffer_span_t span = {};
+
+  int ret = srslte_spsc_ringbuffer_reserve(q, nof_bytes, timeout_ms, &span);
+  if (ret > 0) {
+    memcpy(span.ptr[0], ptr, span.len[0]);
+    memcpy(span.ptr[1], (const uint8_t*)ptr + span.len[0], span.len[1]);
+    srslte_spsc_ringbuffer_commit(q, nof_bytes);
+  }
+  return ret;
+}
+
+int srslte_spsc_ringbuffer_peek(srslte_spsc_ringbuffer_t*      q,
+                                uint32_t                       nof_bytes,
+                                int32_t                        timeout_ms,
+                                srslte_spsc_ringbuffer_span_t* span)
+{
+  if (q == NULL || q->buffer == NULL || span == NULL || nof_bytes > q->capacity) {
+    ERROR("Invalid inputs\n");
+    return SRSLTE_ERROR_INVALID_INPUTS;
+  }
+  if (!LOAD_ACQUIRE(q->active)) {
+    return 0;
+  }
+
+  // Only read the producer index when the last one seen does not hold enough bytes
+  if (ring_count(q, q->write_idx_cache, q->read_idx) < nof_bytes && !ring_ready(q, false, nof_bytes)) {
+    int ret = ring_wait(q, false, nof_bytes, timeout_ms);
+    if (ret != SRSLTE_SUCCESS) {
+      return ret;
+    }
+  }
+  if (!LOAD_ACQUIRE(q->active)) {
+    return 0;
+  }
+
+  ring_span(q, q->read_idx, nof_bytes, span);
+  return nof_bytes;
+}
+
+void srslte_spsc_ringbuffer_release(srslte_spsc_ringbuffer_t* q, uint32_t nof_bytes)
+{
+  STORE_RELEASE(q->read_idx, ring_advance(q, q->read_idx, nof_bytes));
+  FENCE_SEQ_CST();
+  if (LOAD_ACQUIRE(q->write_waiting)) {
+    ring_notify(&q->space_seq);
+  }
+}
+
+int srslte_spsc_ringbuffer_read(srslte_spsc_ringbuffer_t* q, void* ptr, uint32_t nof_bytes, int32_t timeout_ms)
+{
+  srslte_spsc_ringbuffer_span_t span = {};
+
+  int ret = srslte_spsc_ringbuffer_peek(q, nof_bytes, timeout_ms, &span);
+  if (ret > 0) {
+    memcpy(ptr, span.ptr[0], span.len[0]);
+    memcpy((uint8_t*)ptr + span.len[0], span.ptr[1], span.len[1]);
+    srslte_spsc_ringbuffer_release(q, nof_bytes);
+  }
+  return ret;
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "srslte/phy/utils/ringbuffer.h"
+#include "srslte/phy/utils/spsc_ringbuffer.h"
+#include "srslte/phy/utils/vector.h"
+
+uint32_t block_samples = 1920;  // 1 ms at 1.92 MHz
+uint32_t nof_blocks    = 100000;
+uint32_t nof_buffered  = 10;    // Ring capacity in blocks
+
+void usage(char* prog)
+{
+  printf("Usage: %s\n", prog);
+  printf("\t-s Samples per write and read [Default %d]\n", block_samples);
+  printf("\t-n Number of blocks [Default %d]\n", nof_blocks);
+  printf("\t-b Ring capacity in blocks [Default %d]\n", nof_buffered);
+}
+
+void parse_args(int argc, char** argv)
+{
+  int opt;
+  while ((opt = getopt(argc, argv, "snb")) != -1) {
+    switch (opt) {
+      case 's':
+        block_samples = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'n':
+        nof_blocks = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      case 'b':
+        nof_buffered = (uint32_t)strtol(argv[optind], NULL, 10);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+typedef struct {
+  srslte_ringbuffer_t      rb;
+  srslte_spsc_ringbuffer_t spsc;
+  bool                     use_spsc;
+  cf_t*                    block;
+} bench_args_t;
+
+static void* producer_thread(void* arg)
+{
+  bench_args_t* args   = (bench_args_t*)arg;
+  uint32_t      nbytes = block_samples * sizeof(cf_t);
+
+  for (uint32_t i = 0; i < nof_blocks; i++) {
+    if (args->use_spsc) {
+      // Samples are generated straight into the ring memory
+      srslte_spsc_ringbuffer_span_t span = {};
+      srslte_spsc_ringbuffer_reserve(&args->spsc, nbytes, -1, &span);
+      memcpy(span.ptr[0], args->block, span.len[0]);
+      memcpy(span.ptr[1], (uint8_t*)args->block + span.len[0], span.len[1]);
+      srslte_spsc_ringbuffer_commit(&args->spsc, nbytes);
+    } else {
+      srslte_ringbuffer_write_block(&args->rb, args->block, nbytes);
+    }
+  }
+  return NULL;
+}
+
+static double run(bench_args_t* args, cf_t* out)
+{
+  uint32_t        nbytes = block_samples * sizeof(cf_t);
+  pthread_t       producer;
+  struct timespec t0, t1;
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  pthread_create(&producer, NULL, producer_thread, args);
+  for (uint32_t i = 0; i < nof_blocks; i++) {
+    if (args->use_spsc) {
+      srslte_spsc_ringbuffer_read(&args->spsc, out, nbytes, -1);
+    } else {
+      srslte_ringbuffer_read(&args->rb, out, nbytes);
+    }
+  }
+  pthread_join(producer, NULL);
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+
+  return (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+}
+
+int main(int argc, char** argv)
+{
+  parse_args(argc, argv);
+
+  bench_args_t args     = {};
+  uint32_t     capacity = nof_buffered * block_samples * sizeof(cf_t);
+  cf_t*        out      = srslte_vec_cf_malloc(block_samples);
+  args.block            = srslte_vec_cf_malloc(block_samples);
+  if (!out || !args.block) {
+    return SRSLTE_ERROR;
+  }
+  for (uint32_t i = 0; i < block_samples; i++) {
+    args.block[i] = i;
+  }
+  if (srslte_ringbuffer_init(&args.rb, capacity) || srslte_spsc_ringbuffer_init(&args.spsc, capacity)) {
+    return SRSLTE_ERROR;
+  }
+
+  double msps = (double)nof_blocks * block_samples / 1e6;
+
+  args.use_spsc = false;
+  double t      = run(&args, out);
+  printf("mutex ringbuffer: %.3f s, %.1f Msps\n", t, msps / t);
+
+  args.use_spsc = true;
+  t             = run(&args, out);
+  printf("spsc ringbuffer:  %.3f s, %.1f Msps\n", t, msps / t);
+
+  srslte_ringbuffer_free(&args.rb);
+  srslte_spsc_ringbuffer_free(&args.spsc);
+  free(args.block);
+  free(out);
+  printf("Done\n");
+  return SRSLTE_SUCCESS;
+}
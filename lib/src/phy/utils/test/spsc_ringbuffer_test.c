@@ -0,0 +1,156 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srslte/common/test_common.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "srslte/phy/utils/spsc_ringbuffer.h"
+#include "srslte/phy/utils/vector.h"
+
+#define CAPACITY 1000
+#define NOF_BYTES 10000000
+
+int test_wrap_around()
+{
+  srslte_spsc_ringbuffer_t      q    = {};
+  srslte_spsc_ringbuffer_span_t span = {};
+  uint8_t                       in[CAPACITY];
+  uint8_t                       out[CAPACITY];
+  for (int i = 0; i < CAPACITY; i++) {
+    in[i] = i % 251;
+  }
+
+  TESTASSERT(srslte_spsc_ringbuffer_init(&q, CAPACITY) == SRSLTE_SUCCESS);
+  TESTASSERT(srslte_spsc_ringbuffer_write(&q, in, 600, 0) == 600);
+  TESTASSERT(srslte_spsc_ringbuffer_read(&q, out, 600, 0) == 600);
+  TESTASSERT(!memcmp(in, out, 600));
+
+  // Reserved memory wraps around the end of the buffer
+  TESTASSERT(srslte_spsc_ringbuffer_reserve(&q, 700, 0, &span) == 700);
+  TESTASSERT(span.len[0] == 400 && span.len[1] == 300);
+  memcpy(span.ptr[0], in, span.len[0]);
+  memcpy(span.ptr[1], &in[span.len[0]], span.len[1]);
+  TESTASSERT(srslte_spsc_ringbuffer_status(&q) == 0);
+  srslte_spsc_ringbuffer_commit(&q, 700);
+  TESTASSERT(srslte_spsc_ringbuffer_status(&q) == 700);
+  TESTASSERT(srslte_spsc_ringbuffer_space(&q) == 300);
+
+  // Full and empty buffers are told apart, non-blocking calls do not wait
+  TESTASSERT(srslte_spsc_ringbuffer_write(&q, in, 301, 0) == SRSLTE_ERROR_TIMEOUT);
+  TESTASSERT(srslte_spsc_ringbuffer_write(&q, &in[700], 300, 0) == 300);
+  TESTASSERT(srslte_spsc_ringbuffer_status(&q) == CAPACITY);
+  TESTASSERT(srslte_spsc_ringbuffer_write(&q, in, 1, 10) == SRSLTE_ERROR_TIMEOUT);
+
+  TESTASSERT(srslte_spsc_ringbuffer_peek(&q, CAPACITY, 0, &span) == CAPACITY);
+  TESTASSERT(!memcmp(span.ptr[0], in, span.len[0]));
+  TESTASSERT(!memcmp(span.ptr[1], &in[span.len[0]], span.len[1]));
+  srslte_spsc_ringbuffer_release(&q, CAPACITY);
+  TESTASSERT(srslte_spsc_ringbuffer_status(&q) == 0);
+  TESTASSERT(srslte_spsc_ringbuffer_read(&q, out, 1, 10) == SRSLTE_ERROR_TIMEOUT);
+
+  srslte_spsc_ringbuffer_free(&q);
+  return SRSLTE_SUCCESS;
+}
+
+static void* producer_thread(void* arg)
+{
+  srslte_spsc_ringbuffer_t* q     = (srslte_spsc_ringbuffer_t*)arg;
+  uint32_t                  count = 0;
+  uint32_t                  len   = 1;
+
+  while (count < NOF_BYTES) {
+    srslte_spsc_ringbuffer_span_t span = {};
+    len                                = SRSLTE_MIN(len * 7 % (CAPACITY / 2) + 1, NOF_BYTES - count);
+    if (srslte_spsc_ringbuffer_reserve(q, len, -1, &span) != len) {
+      return NULL;
+    }
+    for (uint32_t s = 0; s < 2; s++) {
+      for (uint32_t i = 0; i < span.len[s]; i++) {
+        span.ptr[s][i] = (count++) % 253;
+      }
+    }
+    srslte_spsc_ringbuffer_commit(q, len);
+  }
+  return NULL;
+}
+
+int test_threaded()
+{
+  srslte_spsc_ringbuffer_t q = {};
+  uint8_t                  out[CAPACITY];
+  pthread_t                producer;
+
+  TESTASSERT(srslte_spsc_ringbuffer_init(&q, CAPACITY) == SRSLTE_SUCCESS);
+  TESTASSERT(pthread_create(&producer, NULL, producer_thread, &q) == 0);
+
+  // The consumer reads with other sizes than the producer, so both sides block and wrap at different points. Each
+  // side asks for at most half of the buffer, otherwise they could wait for each other
+  uint32_t count = 0;
+  uint32_t len   = 1;
+  while (count < NOF_BYTES) {
+    len = SRSLTE_MIN(len * 13 % (CAPACITY / 2) + 1, NOF_BYTES - count);
+    TESTASSERT(srslte_spsc_ringbuffer_read(&q, out, len, 2000) == len);
+    for (uint32_t i = 0; i < len; i++) {
+      TESTASSERT(out[i] == (count++) % 253);
+    }
+  }
+
+  TESTASSERT(pthread_join(producer, NULL) == 0);
+  TESTASSERT(srslte_spsc_ringbuffer_status(&q) == 0);
+  srslte_spsc_ringbuffer_free(&q);
+  return SRSLTE_SUCCESS;
+}
+
+static void* blocked_reader(void* arg)
+{
+  uint8_t out[CAPACITY];
+  return (void*)(intptr_t)srslte_spsc_ringbuffer_read((srslte_spsc_ringbuffer_t*)arg, out, CAPACITY, -1);
+}
+
+int test_stop()
+{
+  srslte_spsc_ringbuffer_t q = {};
+  pthread_t                reader;
+  void*                    ret = NULL;
+
+  TESTASSERT(srslte_spsc_ringbuffer_init(&q, CAPACITY) == SRSLTE_SUCCESS);
+  TESTASSERT(pthread_create(&reader, NULL, blocked_reader, &q) == 0);
+  usleep(10000);
+  srslte_spsc_ringbuffer_stop(&q);
+  TESTASSERT(pthread_join(reader, &ret) == 0);
+  TESTASSERT((intptr_t)ret == 0);
+
+  srslte_spsc_ringbuffer_free(&q);
+  return SRSLTE_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  TESTASSERT(test_wrap_around() == SRSLTE_SUCCESS);
+  TESTASSERT(test_threaded() == SRSLTE_SUCCESS);
+  TESTASSERT(test_stop() == SRSLTE_SUCCESS);
+  printf("Ok\n");
+  return SRSLTE_SUCCESS;
+}
@@ -290,6 +290,24 @@ TEST(
     free(x);
     free(y);)
 
+TEST(
+    srslte_vec_dot_prod_cfc, MALLOC(cf_t, x); MALLOC(float, y); cf_t z = 0.0f;
+
+    cf_t gold = 0.0f;
+    for (int i = 0; i < block_size; i++) {
+      x[i] = RANDOM_CF();
+      y[i] = RANDOM_F();
+    }
+
+    TEST_CALL(z = srslte_vec_dot_prod_cfc(x, y, block_size))
+
+        for (int i = 0; i < block_size; i++) { gold += x[i] * y[i]; }
+
+    mse = cabsf(gold - z) / cabsf(gold);
+
+    free(x);
+    free(y);)
+
 TEST(
     srslte_vec_dot_prod_conj_ccc, MALLOC(cf_t, x); MALLOC(cf_t, y); cf_t z = 0.0f;
 
@@ -834,6 +852,10 @@ int main(int argc, char** argv)
         test_srslte_vec_dot_prod_ccc(func_names[func_count], &timmings[func_count][size_count], block_size);
     func_count++;
 
+    passed[func_count][size_count] =
+        test_srslte_vec_dot_prod_cfc(func_names[func_count], &timmings[func_count][size_count], block_size);
+    func_count++;
+
     passed[func_count][size_count] =
         test_srslte_vec_dot_prod_conj_ccc(func_names[func_count], &timmings[func_count][size_count], block_size);
     func_count++;
@@ -470,12 +470,7 @@ cf_t srslte_vec_dot_prod_ccc(const cf_t* x, const cf_t* y, const uint32_t len)
 // Convolution filter and in SSS search
 cf_t srslte_vec_dot_prod_cfc(const cf_t* x, const float* y, const uint32_t len)
 {
-  uint32_t i;
-  cf_t     res = 0;
-  for (i = 0; i < len; i++) {
-    res += x[i] * y[i];
-  }
-  return res;
+  return srslte_vec_dot_prod_cfc_simd(x, y, len);
 }
 
 // SYNC
@@ -766,6 +766,51 @@ cf_t srslte_vec_dot_prod_ccc_simd(const cf_t* x, const cf_t* y, const int len)
   return result;
 }
 
+cf_t srslte_vec_dot_prod_cfc_simd(const cf_t* x, const float* y, const int len)
+{
+  int  i      = 0;
+  cf_t result = 0;
+
+#if SRSLTE_SIMD_CF_SIZE
+  if (len >= SRSLTE_SIMD_CF_SIZE) {
+    simd_cf_t avx_result = srslte_simd_cf_zero();
+    if (SRSLTE_IS_ALIGNED(x) && SRSLTE_IS_ALIGNED(y)) {
+      for (; i < len - SRSLTE_SIMD_CF_SIZE + 1; i += SRSLTE_SIMD_CF_SIZE) {
+        simd_cf_t xVal = srslte_simd_cfi_load(&x[i]);
+        simd_f_t  yVal = srslte_simd_f_load(&y[i]);
+
+        avx_result = srslte_simd_cf_add(srslte_simd_cf_mul(xVal, yVal), avx_result);
+      }
+    } else {
+      for (; i < len - SRSLTE_SIMD_CF_SIZE + 1; i += SRSLTE_SIMD_CF_SIZE) {
+        simd_cf_t xVal = srslte_simd_cfi_loadu(&x[i]);
+        simd_f_t  yVal = srslte_simd_f_loadu(&y[i]);
+
+        avx_result = srslte_simd_cf_add(srslte_simd_cf_mul(xVal, yVal), avx_result);
+      }
+    }
+
+    __attribute__((aligned(64))) float simd_dotProdVector[SRSLTE_SIMD_CF_SIZE];
+    simd_f_t                           acc_re = srslte_simd_cf_re(avx_result);
+    simd_f_t                           acc_im = srslte_simd_cf_im(avx_result);
+
+    simd_f_t acc = srslte_simd_f_hadd(acc_re, acc_im);
+    for (int j = 2; j < SRSLTE_SIMD_F_SIZE; j *= 2) {
+      acc = srslte_simd_f_hadd(acc, acc);
+    }
+    srslte_simd_f_store(simd_dotProdVector, acc);
+    __real__ result = simd_dotProdVector[0];
+    __imag__ result = simd_dotProdVector[1];
+  }
+#endif
+
+  for (; i < len; i++) {
+    result += (x[i] * y[i]);
+  }
+
+  return result;
+}
+
 #ifdef ENABLE_C16
 c16_t srslte_vec_dot_prod_ccc_c16i_simd(const c16_t* x, const c16_t* y, const int len)
 {
@@ -20,6 +20,7 @@
  */
 
 #include "srslte/radio/radio.h"
+#include "srslte/common/latency_probe.h"
 #include "srslte/common/string_helpers.h"
 #include "srslte/config.h"
 #include <list>
@@ -28,6 +29,21 @@
 
 namespace srslte {
 
+/// Reduced interpolation and decimation factors for resampling from srate_in to srate_out, rounded to Hz
+static void resampler_ratio(double srate_in, double srate_out, uint32_t& interp, uint32_t& decim)
+{
+  uint64_t a = (uint64_t)llround(srate_out);
+  uint64_t b = (uint64_t)llround(srate_in);
+  while (b != 0) {
+    uint64_t t = a % b;
+    a          = b;
+    b          = t;
+  }
+  a      = std::max(a, (uint64_t)1);
+  interp = (uint32_t)std::min((uint64_t)llround(srate_out) / a, (uint64_t)UINT32_MAX);
+  decim  = (uint32_t)std::min((uint64_t)llround(srate_in) / a, (uint64_t)UINT32_MAX);
+}
+
 radio::radio(srslte::log_filter* log_h_) : logger(nullptr), log_h(log_h_), zeros(nullptr)
 {
   zeros = srslte_vec_cf_malloc(SRSLTE_SF_LEN_MAX);
@@ -67,6 +83,14 @@ radio::~radio()
   for (srslte_resampler_fft_t& q : decimators) {
     srslte_resampler_fft_free(&q);
   }
+
+  for (srslte_resampler_poly_t& q : poly_interpolators) {
+    srslte_resampler_poly_free(&q);
+  }
+
+  for (srslte_resampler_poly_t& q : poly_decimators) {
+    srslte_resampler_poly_free(&q);
+  }
 }
 
 int radio::init(const rf_args_t& args, phy_interface_radio* phy_)
@@ -162,6 +186,10 @@ int radio::init(const rf_args_t& args, phy_interface_radio* phy_)
   if (args.continuous_tx != "auto") {
     continuous_tx = (args.continuous_tx == "yes");
   }
+  polyphase = (args.resampler == "polyphase");
+  if (not polyphase and not args.resampler.empty() and args.resampler != "fft") {
+    log_h->warning("Unknown resampler %s, using fft\n", args.resampler.c_str());
+  }
 
   // Set fixed gain options
   if (args.rx_gain < 0) {
@@ -302,19 +330,28 @@ bool radio::start_agc(bool tx_gain_same_rx)
 
 bool radio::rx_now(rf_buffer_interface& buffer, rf_timestamp_interface& rxd_time)
 {
+  SRSLTE_LATENCY_PROBE(radio_rx);
   std::unique_lock<std::mutex> lock(rx_mutex);
   bool                         ret = true;
   rf_buffer_t                  buffer_rx;
-  uint32_t                     ratio = SRSLTE_MAX(1, decimators[0].ratio);
+  uint32_t                     ratio      = SRSLTE_MAX(1, decimators[0].ratio);
+  uint32_t                     nof_rx     = buffer.get_nof_samples() * ratio;
+  bool                         decimation = ratio > 1;
+
+  // The polyphase decimator asks for as many samples as it needs for the requested ones, the ratio can be fractional
+  if (poly_decimators[0].decim > poly_decimators[0].interp) {
+    nof_rx     = srslte_resampler_poly_get_nof_input(&poly_decimators[0], buffer.get_nof_samples());
+    decimation = true;
+  }
 
   // If the interpolator have been set, interpolate
   for (uint32_t ch = 0; ch < nof_channels; ch++) {
     // Use rx buffer if decimator is required
-    buffer_rx.set(ch, ratio > 1 ? rx_buffer[ch].data() : buffer.get(ch));
+    buffer_rx.set(ch, decimation ? rx_buffer[ch].data() : buffer.get(ch));
   }
 
   // Set new buffer size
-  buffer_rx.set_nof_samples(buffer.get_nof_samples() * ratio);
+  buffer_rx.set_nof_samples(nof_rx);
 
   if (not radio_is_streaming) {
     for (srslte_rf_t& rf_device : rf_devices) {
@@ -335,9 +372,12 @@ bool radio::rx_now(rf_buffer_interface& buffer, rf_timestamp_interface& rxd_time
   }
 
   // Perform decimation
-  if (ratio > 1) {
+  if (decimation) {
     for (uint32_t ch = 0; ch < nof_channels; ch++) {
-      if (buffer.get(ch) and buffer_rx.get(ch)) {
+      if (poly_decimators[ch].decim > poly_decimators[ch].interp) {
+        // Filters straight from the received samples into the caller buffer, keeps the channel state if unused
+        srslte_resampler_poly_run(&poly_decimators[ch], buffer_rx.get(ch), buffer.get(ch), nof_rx);
+      } else if (buffer.get(ch) and buffer_rx.get(ch)) {
         srslte_resampler_fft_run(&decimators[ch], buffer_rx.get(ch), buffer.get(ch), buffer_rx.get_nof_samples());
       }
     }
@@ -405,11 +445,24 @@ bool radio::rx_dev(const uint32_t& device_idx, const rf_buffer_interface& buffer
 
 bool radio::tx(rf_buffer_interface& buffer, const rf_timestamp_interface& tx_time)
 {
+  SRSLTE_LATENCY_PROBE(radio_tx);
   bool                         ret = true;
   std::unique_lock<std::mutex> lock(tx_mutex);
 
-  // If the interpolator have been set, interpolate
-  if (interpolators[0].ratio > 1) {
+  // If the polyphase interpolator have been set, interpolate, the number of samples follows the fractional ratio
+  if (poly_interpolators[0].interp > poly_interpolators[0].decim) {
+    uint32_t nof_samples = buffer.get_nof_samples();
+    uint32_t nof_tx      = srslte_resampler_poly_get_nof_output(&poly_interpolators[0], nof_samples);
+    for (uint32_t ch = 0; ch < nof_channels; ch++) {
+      srslte_resampler_poly_run(&poly_interpolators[ch], buffer.get(ch), tx_buffer[ch].data(), nof_samples);
+
+      // Set the buffer pointer
+      buffer.set(ch, tx_buffer[ch].data());
+    }
+
+    // Set new buffer size
+    buffer.set_nof_samples(nof_tx);
+  } else if (interpolators[0].ratio > 1) {
     for (uint32_t ch = 0; ch < nof_channels; ch++) {
       // Perform actual interpolation
       srslte_resampler_fft_run(&interpolators[ch], buffer.get(ch), tx_buffer[ch].data(), buffer.get_nof_samples());
@@ -666,9 +719,22 @@ void radio::set_rx_srate(const double& srate)
     }
 
     // Update decimators
-    uint32_t ratio = (uint32_t)ceil(cur_rx_srate / srate);
-    for (uint32_t ch = 0; ch < nof_channels; ch++) {
-      srslte_resampler_fft_init(&decimators[ch], SRSLTE_RESAMPLER_MODE_DECIMATE, ratio);
+    if (polyphase) {
+      uint32_t interp = 0, decim = 0;
+      resampler_ratio(cur_rx_srate, srate, interp, decim);
+
+      // Only decimation, the device never runs slower than the requested rate
+      decim = SRSLTE_MAX(interp, decim);
+      for (uint32_t ch = 0; ch < nof_channels; ch++) {
+        if (srslte_resampler_poly_init(&poly_decimators[ch], interp, decim) < SRSLTE_SUCCESS and interp != decim) {
+          log_h->error("Initialising polyphase decimator for ratio %d/%d\n", interp, decim);
+        }
+      }
+    } else {
+      uint32_t ratio = (uint32_t)ceil(cur_rx_srate / srate);
+      for (uint32_t ch = 0; ch < nof_channels; ch++) {
+        srslte_resampler_fft_init(&decimators[ch], SRSLTE_RESAMPLER_MODE_DECIMATE, ratio);
+      }
     }
 
   } else {
@@ -905,9 +971,22 @@ void radio::set_tx_srate(const double& srate)
     }
 
     // Update interpolators
-    uint32_t ratio = (uint32_t)ceil(cur_tx_srate / srate);
-    for (uint32_t ch = 0; ch < nof_channels; ch++) {
-      srslte_resampler_fft_init(&interpolators[ch], SRSLTE_RESAMPLER_MODE_INTERPOLATE, ratio);
+    if (polyphase) {
+      uint32_t interp = 0, decim = 0;
+      resampler_ratio(srate, cur_tx_srate, interp, decim);
+
+      // Only interpolation, the device never runs slower than the requested rate
+      interp = SRSLTE_MAX(interp, decim);
+      for (uint32_t ch = 0; ch < nof_channels; ch++) {
+        if (srslte_resampler_poly_init(&poly_interpolators[ch], interp, decim) < SRSLTE_SUCCESS and interp != decim) {
+          log_h->error("Initialising polyphase interpolator for ratio %d/%d\n", interp, decim);
+        }
+      }
+    } else {
+      uint32_t ratio = (uint32_t)ceil(cur_tx_srate / srate);
+      for (uint32_t ch = 0; ch < nof_channels; ch++) {
+        srslte_resampler_fft_init(&interpolators[ch], SRSLTE_RESAMPLER_MODE_INTERPOLATE, ratio);
+      }
     }
   } else {
     for (srslte_rf_t& rf_device : rf_devices) {
@@ -23,6 +23,7 @@
 #include "formatter.h"
 #include "srslte/srslog/sink.h"
 #include <cassert>
+#include <pthread.h>
 
 using namespace srslog;
 
@@ -40,6 +41,8 @@ void backend_worker::create_worker()
   assert(!running_flag && "Only one worker thread should be created");
 
   std::thread t([this]() {
+    // Named so that the thread can be placed from the [threads] configuration.
+    pthread_setname_np(pthread_self(), "SRSLOG");
     running_flag = true;
     do_work();
   });
@@ -63,16 +66,17 @@ void backend_worker::do_work()
   assert(running_flag && "Thread entry function called without running thread");
 
   while (running_flag) {
-    auto item = queue.timed_pop(sleep_period_ms);
+    detail::log_entry* entry = queue.timed_front(sleep_period_ms);
 
     // Spin again when the timeout expires.
-    if (!item.first) {
+    if (!entry) {
       continue;
     }
 
     report_queue_on_full_once();
 
-    process_log_entry(std::move(item.second));
+    process_log_entry(std::move(*entry));
+    queue.pop();
   }
 
   // When we reach here, the thread is about to terminate, last chance to
@@ -96,12 +100,23 @@ void backend_worker::process_log_entry(detail::log_entry&& entry)
   // Check first for flush commands.
   if (entry.flush_cmd) {
     process_flush_command(*entry.flush_cmd);
+    entry.flush_cmd.reset();
     return;
   }
 
   // Save sink pointer before moving the entry.
   sink* s = entry.s;
 
+  report_discarded_entries(*s);
+
+  // Binary sinks take care of encoding the entry, skipping text formatting.
+  if (s->is_binary()) {
+    if (auto err_str = s->write_entry(entry)) {
+      err_handler(err_str.get_error());
+    }
+    return;
+  }
+
   std::string result = format_log_entry_to_text(std::move(entry));
   detail::memory_buffer buffer(result);
 
@@ -116,13 +131,37 @@ void backend_worker::process_outstanding_entries()
          "Cannot process outstanding entries while thread is running");
 
   while (true) {
-    auto item = queue.timed_pop(1);
+    detail::log_entry* entry = queue.timed_front(1);
 
     // Check if the queue is empty.
-    if (!item.first) {
+    if (!entry) {
       break;
     }
 
-    process_log_entry(std::move(item.second));
+    process_log_entry(std::move(*entry));
+    queue.pop();
+  }
+}
+
+void backend_worker::report_discarded_entries(sink& s)
+{
+  size_t nof_discarded = queue.get_nof_discarded();
+  if (nof_discarded == nof_reported_discarded) {
+    return;
+  }
+
+  size_t nof_new = nof_discarded - nof_reported_discarded;
+  nof_reported_discarded = nof_discarded;
+  if (overflow != overflow_policy::count) {
+    return;
+  }
+
+  std::string result = fmt::format(
+      "srsLog: {} log entries have been discarded due to a full queue\n",
+      nof_new);
+  detail::memory_buffer buffer(result);
+
+  if (auto err_str = s.write(buffer)) {
+    err_handler(err_str.get_error());
   }
 }
@@ -83,6 +83,9 @@ public:
     err_handler = std::move(new_err_handler);
   }
 
+  /// Selects how entries discarded due to a full queue are reported.
+  void set_overflow_policy(overflow_policy policy) { overflow = policy; }
+
 private:
   /// Creates the worker thread.
   /// NOTE: This function should be only called once.
@@ -94,6 +97,11 @@ private:
   /// Processes the log entry.
   void process_log_entry(detail::log_entry&& entry);
 
+  /// Writes into the sink of the input entry a message with the number of log
+  /// entries discarded since the last report, if the overflow policy requires
+  /// it.
+  void report_discarded_entries(sink& s);
+
   /// Processes outstanding entries in the queue until it gets empty.
   void process_outstanding_entries();
 
@@ -115,6 +123,8 @@ private:
 private:
   detail::work_queue<detail::log_entry>& queue;
   detail::shared_variable<bool> running_flag;
+  detail::shared_variable<overflow_policy> overflow{overflow_policy::drop};
+  size_t nof_reported_discarded = 0;
   error_handler err_handler = [](const std::string& error) {
     fmt::print(stderr, "srsLog error - {}\n", error);
   };
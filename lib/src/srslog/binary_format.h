@@ -0,0 +1,395 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSLOG_BINARY_FORMAT_H
+#define SRSLOG_BINARY_FORMAT_H
+
+#include "formatter.h"
+#include "srslte/srslog/detail/support/error_string.h"
+#include "srslte/srslog/detail/support/memory_buffer.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+namespace srslog {
+
+/// Binary log format.
+///
+/// Binary log files store log entries without formatting them, deferring the
+/// costly text conversion to the offline srslog_decode tool. Every file starts
+/// with a header followed by a sequence of records:
+///
+///   header: "SRSLOGB" | version (u8) | byte order mark (u32) |
+///           sizeof(long double) (u8) | sizeof(void*) (u8) | reserved (u16)
+///   string: type (u8) | id (u32) | length (u32) | characters
+///   entry:  type (u8) | format id (u32) | name id (u32) | timestamp ns (i64) |
+///           context value (u32) | flags (u8) | tag (u8) | nof args (u16) |
+///           args length (u16) | hex dump length (u16) | args | hex dump
+///   text:   type (u8) | length (u32) | characters
+///
+/// Format strings and log names are written once per file as string records
+/// and referenced by id afterwards, id 0 denotes an absent string. Strings and
+/// text records are limited to max_string_size characters. Arguments
+/// are stored with the encoding of detail::inline_arg_store. All integers use
+/// the byte order of the writer, files are expected to be decoded on a machine
+/// of the same architecture.
+namespace binary_format {
+
+constexpr char magic[] = "SRSLOGB";
+constexpr uint8_t version = 1;
+constexpr uint32_t byte_order_mark = 0x01020304;
+constexpr size_t header_size = 16;
+
+enum class record_type : uint8_t { string = 1, entry = 2, text = 3 };
+
+/// Entry record flags.
+constexpr uint8_t flag_context_enabled = 1u << 0;
+constexpr uint8_t flag_truncated = 1u << 1;
+
+/// Size of the fixed part of an entry record following the type byte.
+constexpr size_t entry_fields_size = 4 + 4 + 8 + 4 + 1 + 1 + 2 + 2 + 2;
+
+/// Maximum length of string and text records, longer ones are truncated by the
+/// encoder and treated as corrupt data by the decoder.
+constexpr uint32_t max_string_size = 64 * 1024;
+
+/// Appends the binary representation of value to the buffer.
+template <typename T>
+inline void put(fmt::memory_buffer& buffer, T value)
+{
+  const char* p = reinterpret_cast<const char*>(&value);
+  buffer.append(p, p + sizeof(value));
+}
+
+/// Reads a value from the memory pointed by p, advancing it.
+template <typename T>
+inline T get(const uint8_t*& p)
+{
+  T value;
+  std::memcpy(&value, p, sizeof(value));
+  p += sizeof(value);
+  return value;
+}
+
+/// Writes a binary file header into the buffer.
+inline void encode_header(fmt::memory_buffer& buffer)
+{
+  buffer.append(magic, magic + sizeof(magic) - 1);
+  put<uint8_t>(buffer, version);
+  put<uint32_t>(buffer, byte_order_mark);
+  put<uint8_t>(buffer, sizeof(long double));
+  put<uint8_t>(buffer, sizeof(void*));
+  put<uint16_t>(buffer, 0);
+}
+
+/// Validates the binary file header pointed by data.
+inline detail::error_string check_header(const uint8_t* data, size_t len)
+{
+  if (len < header_size ||
+      std::memcmp(data, magic, sizeof(magic) - 1) != 0) {
+    return "Not a srsLog binary file";
+  }
+
+  const uint8_t* p = data + sizeof(magic) - 1;
+  if (get<uint8_t>(p) != version) {
+    return "Unsupported srsLog binary file version";
+  }
+  if (get<uint32_t>(p) != byte_order_mark ||
+      get<uint8_t>(p) != sizeof(long double) ||
+      get<uint8_t>(p) != sizeof(void*)) {
+    return "srsLog binary file was written on a different architecture";
+  }
+
+  return {};
+}
+
+/// Encodes log entries into binary records, keeping track of the strings that
+/// have already been written.
+class encoder
+{
+public:
+  /// Forgets all the written strings. Must be called when starting a new file.
+  void reset()
+  {
+    string_ids.clear();
+    address_cache.clear();
+    next_id = 1;
+  }
+
+  /// Encodes the log entry into the buffer, preceded by the definition of any
+  /// string seen for the first time.
+  void encode(const detail::log_entry& entry, fmt::memory_buffer& buffer)
+  {
+    uint32_t fmt_id = get_string_id(entry.fmtstring, buffer);
+    uint32_t name_id = get_string_id(entry.log_name, buffer);
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  entry.tp.time_since_epoch())
+                  .count();
+    uint8_t flags = 0;
+    if (entry.context.enabled) {
+      flags |= flag_context_enabled;
+    }
+    if (entry.store.is_truncated()) {
+      flags |= flag_truncated;
+    }
+
+    put<uint8_t>(buffer, static_cast<uint8_t>(record_type::entry));
+    put<uint32_t>(buffer, fmt_id);
+    put<uint32_t>(buffer, name_id);
+    put<int64_t>(buffer, ns);
+    put<uint32_t>(buffer, entry.context.value);
+    put<uint8_t>(buffer, flags);
+    put<char>(buffer, entry.log_tag);
+    put<uint16_t>(buffer, entry.store.size());
+    put<uint16_t>(buffer, entry.store.raw_size());
+    put<uint16_t>(buffer, entry.hex_dump.size());
+    buffer.append(entry.store.raw_data(),
+                  entry.store.raw_data() + entry.store.raw_size());
+    buffer.append(entry.hex_dump.begin(), entry.hex_dump.end());
+  }
+
+  /// Encodes a plain text message into the buffer.
+  static void encode_text(detail::memory_buffer text,
+                          fmt::memory_buffer& buffer)
+  {
+    uint32_t len = std::min<size_t>(text.size(), max_string_size);
+    put<uint8_t>(buffer, static_cast<uint8_t>(record_type::text));
+    put<uint32_t>(buffer, len);
+    buffer.append(text.data(), text.data() + len);
+  }
+
+private:
+  using string_id_map = std::unordered_map<std::string, uint32_t>;
+
+  /// Returns the id associated to the string, emitting a string record when it
+  /// is seen for the first time. Strings are interned by content. The address
+  /// of the last string seen at each location is cached to skip the hashing of
+  /// literals, but a cache hit is only valid while the contents still match, as
+  /// a non literal string may be reused with different contents.
+  uint32_t get_string_id(const char* str, fmt::memory_buffer& buffer)
+  {
+    if (!str || str[0] == '\0') {
+      return 0;
+    }
+
+    auto cached = address_cache.find(str);
+    if (cached != address_cache.end() && cached->second->first == str) {
+      return cached->second->second;
+    }
+
+    std::string contents(str, ::strnlen(str, max_string_size));
+    auto it = string_ids.find(contents);
+    if (it == string_ids.end()) {
+      it = string_ids.emplace(std::move(contents), next_id++).first;
+
+      uint32_t len = it->first.size();
+      put<uint8_t>(buffer, static_cast<uint8_t>(record_type::string));
+      put<uint32_t>(buffer, it->second);
+      put<uint32_t>(buffer, len);
+      buffer.append(it->first.data(), it->first.data() + len);
+    }
+    address_cache[str] = &(*it);
+
+    return it->second;
+  }
+
+private:
+  string_id_map string_ids;
+  std::unordered_map<const char*, const string_id_map::value_type*>
+      address_cache;
+  uint32_t next_id = 1;
+};
+
+/// Decodes binary records into the same text produced by the text formatter.
+class decoder
+{
+public:
+  /// Decodes all the complete records found in the input memory block,
+  /// appending the resulting text to out. Returns the number of consumed bytes
+  /// in nof_consumed, an incomplete record at the end of the block is left
+  /// unconsumed.
+  /// NOTE: The input block should not include the file header.
+  detail::error_string decode(const uint8_t* data,
+                              size_t len,
+                              size_t& nof_consumed,
+                              std::string& out)
+  {
+    const uint8_t* p = data;
+    const uint8_t* end = data + len;
+
+    while (p < end) {
+      bool complete = false;
+      if (auto err_str = decode_record(p, end, complete, out)) {
+        nof_consumed = p - data;
+        return fmt::format("{} at offset {}",
+                           err_str.get_error(),
+                           header_size + consumed_total + nof_consumed);
+      }
+      if (!complete) {
+        break;
+      }
+    }
+
+    nof_consumed = p - data;
+    consumed_total += nof_consumed;
+    return {};
+  }
+
+private:
+  /// Decodes the record pointed by p advancing it, unless the record is
+  /// incomplete in which case complete is set to false.
+  detail::error_string decode_record(const uint8_t*& record,
+                                     const uint8_t* end,
+                                     bool& complete,
+                                     std::string& out)
+  {
+    const uint8_t* p = record;
+    auto type = static_cast<record_type>(get<uint8_t>(p));
+    size_t left = end - p;
+
+    switch (type) {
+      case record_type::string: {
+        if (left < 8) {
+          return {};
+        }
+        auto id = get<uint32_t>(p);
+        auto str_len = get<uint32_t>(p);
+        if (id == 0) {
+          return "Invalid string id 0";
+        }
+        if (str_len > max_string_size) {
+          return fmt::format("Invalid string length {}", str_len);
+        }
+        if (left - 8 < str_len) {
+          return {};
+        }
+        strings[id].assign(reinterpret_cast<const char*>(p), str_len);
+        p += str_len;
+        break;
+      }
+      case record_type::entry: {
+        if (left < entry_fields_size) {
+          return {};
+        }
+        const uint8_t* lengths = p + entry_fields_size - 4;
+        auto args_len = get<uint16_t>(lengths);
+        auto hex_len = get<uint16_t>(lengths);
+        if (left - entry_fields_size < size_t(args_len) + hex_len) {
+          return {};
+        }
+        if (auto err_str = decode_entry(p, out)) {
+          return err_str;
+        }
+        break;
+      }
+      case record_type::text: {
+        if (left < 4) {
+          return {};
+        }
+        auto text_len = get<uint32_t>(p);
+        if (text_len > max_string_size) {
+          return fmt::format("Invalid text length {}", text_len);
+        }
+        if (left - 4 < text_len) {
+          return {};
+        }
+        out.append(reinterpret_cast<const char*>(p), text_len);
+        p += text_len;
+        break;
+      }
+      default:
+        return fmt::format("Unknown record type {}", unsigned(*record));
+    }
+
+    record = p;
+    complete = true;
+    return {};
+  }
+
+  /// Decodes the entry record pointed by p, which is known to be complete.
+  detail::error_string decode_entry(const uint8_t*& p, std::string& out)
+  {
+    auto fmt_id = get<uint32_t>(p);
+    auto name_id = get<uint32_t>(p);
+    auto ns = get<int64_t>(p);
+    auto ctx_value = get<uint32_t>(p);
+    auto flags = get<uint8_t>(p);
+    auto tag = get<char>(p);
+    auto nof_args = get<uint16_t>(p);
+    auto args_len = get<uint16_t>(p);
+    auto hex_len = get<uint16_t>(p);
+
+    const char* fmtstring = find_string(fmt_id);
+    if (!fmtstring) {
+      return fmt::format("Undefined format string id {}", fmt_id);
+    }
+    const char* log_name = find_string(name_id);
+    if (!log_name) {
+      return fmt::format("Undefined log name id {}", name_id);
+    }
+    if (hex_len > detail::log_entry::hex_dump_type::capacity()) {
+      return fmt::format("Invalid hex dump length {}", hex_len);
+    }
+
+    entry.s = nullptr;
+    entry.tp = std::chrono::high_resolution_clock::time_point(
+        std::chrono::duration_cast<
+            std::chrono::high_resolution_clock::duration>(
+            std::chrono::nanoseconds(ns)));
+    entry.context = {ctx_value, (flags & flag_context_enabled) != 0};
+    entry.fmtstring = fmtstring;
+    entry.log_name = log_name;
+    entry.log_tag = tag;
+    entry.store.assign_raw(
+        p, args_len, nof_args, (flags & flag_truncated) != 0);
+    p += args_len;
+    entry.hex_dump.clear();
+    entry.hex_dump.append(p, hex_len);
+    p += hex_len;
+
+    out += format_log_entry_to_text(std::move(entry));
+
+    return {};
+  }
+
+  /// Returns the string associated to the id or nullptr if it is not defined.
+  const char* find_string(uint32_t id) const
+  {
+    if (id == 0) {
+      return "";
+    }
+    auto it = strings.find(id);
+    return (it != strings.end()) ? it->second.c_str() : nullptr;
+  }
+
+private:
+  std::unordered_map<uint32_t, std::string> strings;
+  detail::log_entry entry = {};
+  size_t consumed_total = 0;
+};
+
+} // namespace binary_format
+
+} // namespace srslog
+
+#endif // SRSLOG_BINARY_FORMAT_H
@@ -32,22 +32,23 @@ namespace detail {
 
 /// Formats into a hex dump a range of elements, storing the result in the input
 /// buffer.
-inline void format_hex_dump(const std::vector<uint8_t>& v,
+inline void format_hex_dump(const uint8_t* data,
+                            size_t len,
                             fmt::memory_buffer& buffer)
 {
-  if (v.empty()) {
+  if (len == 0) {
     return;
   }
 
   const size_t elements_per_line = 16;
 
-  for (auto i = v.cbegin(), e = v.cend(); i != e;) {
+  for (const uint8_t *i = data, *e = data + len; i != e;) {
     auto num_elements =
         std::min<size_t>(elements_per_line, std::distance(i, e));
 
     fmt::format_to(buffer,
                    "    {:04x}: {:02x}\n",
-                   std::distance(v.cbegin(), i),
+                   std::distance(data, i),
                    fmt::join(i, i + num_elements, " "));
 
     std::advance(i, num_elements);
@@ -71,7 +72,7 @@ inline std::string format_log_entry_to_text(detail::log_entry&& entry)
   fmt::format_to(buffer, "{:%H:%M:%S}.{:06} ", current_time, us_fraction);
 
   // Format optional fields if present.
-  if (!entry.log_name.empty()) {
+  if (entry.log_name && entry.log_name[0] != '\0') {
     fmt::format_to(buffer, "[{: <4.4}] ", entry.log_name);
   }
   if (entry.log_tag != '\0') {
@@ -82,11 +83,16 @@ inline std::string format_log_entry_to_text(detail::log_entry&& entry)
   }
 
   // Message formatting.
-  fmt::format_to(
-      buffer, "{}\n", fmt::vsprintf(entry.fmtstring, std::move(entry.store)));
+  detail::log_entry::arg_store_type::fmt_store_type store;
+  entry.store.load(store);
+  fmt::format_to(buffer,
+                 "{}{}\n",
+                 fmt::vsprintf(entry.fmtstring, store),
+                 entry.store.is_truncated() ? " [truncated]" : "");
 
   // Optional hex dump formatting.
-  detail::format_hex_dump(entry.hex_dump, buffer);
+  detail::format_hex_dump(
+      entry.hex_dump.data(), entry.hex_dump.size(), buffer);
 
   return fmt::to_string(buffer);
 }
@@ -24,6 +24,7 @@
 
 #include "backend_worker.h"
 #include "srslte/srslog/detail/log_backend.h"
+#include <thread>
 
 namespace srslog {
 
@@ -42,6 +43,13 @@ public:
 
   void push(detail::log_entry&& entry) override
   {
+    // Commands can not be lost, wait for the backend to make room for them.
+    if (entry.flush_cmd) {
+      while (!queue.try_push(std::move(entry))) {
+        std::this_thread::yield();
+      }
+      return;
+    }
     queue.push(std::move(entry));
   }
 
@@ -53,6 +61,19 @@ public:
     worker.set_error_handler(std::move(err_handler));
   }
 
+  /// Selects how the backend reports log entries discarded due to a full
+  /// queue.
+  void set_overflow_policy(overflow_policy policy)
+  {
+    worker.set_overflow_policy(policy);
+  }
+
+  /// Returns the number of log entries discarded due to a full queue.
+  size_t get_nof_discarded_entries() const
+  {
+    return queue.get_nof_discarded();
+  }
+
   /// Stops the backend worker thread.
   void stop() { worker.stop(); }
 
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSLOG_BINARY_FILE_SINK_H
+#define SRSLOG_BINARY_FILE_SINK_H
+
+#include "../binary_format.h"
+#include "file_utils.h"
+#include "srslte/srslog/sink.h"
+
+namespace srslog {
+
+/// This sink implementation writes log entries to files in the srsLog binary
+/// format, leaving the text formatting to the srslog_decode tool. As the file
+/// sink, it supports file rotation when the file size exceeds the configured
+/// threshold, each file being decodable on its own.
+class binary_file_sink : public sink
+{
+public:
+  binary_file_sink(std::string name, size_t max_size) :
+    max_size((max_size == 0) ? 0 : std::max<size_t>(max_size, 4 * 1024)),
+    base_filename(std::move(name))
+  {}
+
+  binary_file_sink(const binary_file_sink& other) = delete;
+  binary_file_sink& operator=(const binary_file_sink& other) = delete;
+
+  ~binary_file_sink() override { handler.close(); }
+
+  bool is_binary() const override { return true; }
+
+  detail::error_string write_entry(const detail::log_entry& entry) override
+  {
+    if (auto err_str = prepare_file()) {
+      return err_str;
+    }
+
+    buffer.clear();
+    encoder.encode(entry, buffer);
+    return write_buffer();
+  }
+
+  /// Plain text messages generated by the framework are stored as text
+  /// records.
+  detail::error_string write(detail::memory_buffer text) override
+  {
+    if (auto err_str = prepare_file()) {
+      return err_str;
+    }
+
+    buffer.clear();
+    binary_format::encoder::encode_text(text, buffer);
+    return write_buffer();
+  }
+
+  detail::error_string flush() override { return handler.flush(); }
+
+private:
+  /// Ensures an open file is available for writing, creating a new one the
+  /// first time and when the rotation threshold is exceeded.
+  detail::error_string prepare_file()
+  {
+    if (file_index == 0 || (max_size && handler && current_size >= max_size)) {
+      return create_file();
+    }
+    return {};
+  }
+
+  /// Creates a new file, writes the file header and resets the string table.
+  detail::error_string create_file()
+  {
+    if (auto err_str = handler.create(file_utils::build_filename_with_index(
+            base_filename, file_index++))) {
+      return err_str;
+    }
+
+    encoder.reset();
+    buffer.clear();
+    binary_format::encode_header(buffer);
+    current_size = 0;
+    return write_buffer();
+  }
+
+  /// Writes the contents of the internal buffer into the current file.
+  detail::error_string write_buffer()
+  {
+    // Do not bother doing any work when the file was closed on a previous
+    // error.
+    if (!handler) {
+      return {};
+    }
+
+    current_size += buffer.size();
+    return handler.write(detail::memory_buffer(buffer.data(), buffer.size()));
+  }
+
+private:
+  const size_t max_size;
+  const std::string base_filename;
+  file_utils::file handler;
+  binary_format::encoder encoder;
+  fmt::memory_buffer buffer;
+  size_t current_size = 0;
+  uint32_t file_index = 0;
+};
+
+} // namespace srslog
+
+#endif // SRSLOG_BINARY_FILE_SINK_H
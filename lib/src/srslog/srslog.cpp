@@ -20,6 +20,7 @@
  */
 
 #include "srslte/srslog/srslog.h"
+#include "sinks/binary_file_sink.h"
 #include "sinks/file_sink.h"
 #include "srslog_instance.h"
 
@@ -110,6 +111,17 @@ sink& srslog::fetch_file_sink(const std::string& path, size_t max_size)
                                                            std::forward_as_tuple(new file_sink(clean_path, max_size)));
 }
 
+sink& srslog::fetch_binary_file_sink(const std::string& path, size_t max_size)
+{
+  assert(!path.empty() && "Empty path string");
+
+  std::string clean_path = remove_sharp_chars(path);
+  return srslog_instance::get().get_sink_repo().fetch_sink(
+      std::piecewise_construct,
+      std::forward_as_tuple(clean_path),
+      std::forward_as_tuple(new binary_file_sink(clean_path, max_size)));
+}
+
 ///
 /// Framework configuration and control function implementations.
 ///
@@ -148,6 +160,16 @@ void srslog::set_error_handler(error_handler handler)
   srslog_instance::get().set_error_handler(std::move(handler));
 }
 
+void srslog::set_queue_overflow_policy(overflow_policy policy)
+{
+  srslog_instance::get().set_overflow_policy(policy);
+}
+
+size_t srslog::get_nof_discarded_log_entries()
+{
+  return srslog_instance::get().get_nof_discarded_entries();
+}
+
 ///
 /// Logger management function implementations.
 ///
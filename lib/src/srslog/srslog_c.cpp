@@ -33,11 +33,13 @@ static inline To* c_cast(From* x)
 }
 
 /// Helper to format the input argument list writing it into a channel.
+/// NOTE: The formatted text is passed as an argument, which copies it into the
+/// log entry, as the backend only keeps a pointer to the format string.
 static void log_to(log_channel& c, const char* fmt, std::va_list args)
 {
   char buffer[1024];
-  std::vsnprintf(buffer, sizeof(buffer) - 1, fmt, args);
-  c(buffer);
+  std::vsnprintf(buffer, sizeof(buffer), fmt, args);
+  c("%s", buffer);
 }
 
 void srslog_init(void)
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/// srslog_decode: converts srsLog binary log files to text.
+///
+/// Usage: srslog_decode [-o output_file] file [file...]
+///
+/// Files are decoded in the order they are given, so rotated files should be
+/// passed in ascending index order. Text is written to stdout unless an output
+/// file is specified.
+
+#include "binary_format.h"
+#include <cstdio>
+#include <vector>
+
+using namespace srslog;
+
+static void usage(const char* prog)
+{
+  fmt::print(stderr, "Usage: {} [-o output_file] file [file...]\n", prog);
+}
+
+/// Decodes the binary file in the specified path writing the resulting text to
+/// out. Returns false on error.
+static bool decode_file(const std::string& path, std::FILE* out)
+{
+  std::FILE* in = std::fopen(path.c_str(), "rb");
+  if (!in) {
+    fmt::print(stderr, "Unable to open \"{}\"\n", path);
+    return false;
+  }
+
+  uint8_t header[binary_format::header_size];
+  size_t nof_read = std::fread(header, 1, sizeof(header), in);
+  if (auto err_str = binary_format::check_header(header, nof_read)) {
+    fmt::print(stderr, "{}: {}\n", path, err_str.get_error());
+    std::fclose(in);
+    return false;
+  }
+
+  const size_t chunk_size = 1024 * 1024;
+  std::vector<uint8_t> pending;
+  std::string text;
+  binary_format::decoder decoder;
+  bool success = true;
+
+  while (true) {
+    // Append a new chunk of data after the bytes left by the last iteration.
+    size_t offset = pending.size();
+    pending.resize(offset + chunk_size);
+    nof_read = std::fread(pending.data() + offset, 1, chunk_size, in);
+    pending.resize(offset + nof_read);
+    if (nof_read == 0) {
+      break;
+    }
+
+    size_t nof_consumed = 0;
+    text.clear();
+    auto err_str =
+        decoder.decode(pending.data(), pending.size(), nof_consumed, text);
+    std::fwrite(text.data(), 1, text.size(), out);
+    if (err_str) {
+      fmt::print(stderr, "{}: {}\n", path, err_str.get_error());
+      success = false;
+      break;
+    }
+
+    pending.erase(pending.begin(), pending.begin() + nof_consumed);
+  }
+
+  if (success && !pending.empty()) {
+    fmt::print(stderr,
+               "{}: ignoring {} bytes of an incomplete record at the end of "
+               "the file\n",
+               path,
+               pending.size());
+  }
+
+  std::fclose(in);
+  return success;
+}
+
+int main(int argc, char** argv)
+{
+  std::FILE* out = stdout;
+  std::vector<std::string> files;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "-o" && i + 1 < argc) {
+      out = std::fopen(argv[++i], "w");
+      if (!out) {
+        fmt::print(stderr, "Unable to create \"{}\"\n", argv[i]);
+        return -1;
+      }
+    } else if (arg == "-h" || arg[0] == '-') {
+      usage(argv[0]);
+      return (arg == "-h") ? 0 : -1;
+    } else {
+      files.push_back(std::move(arg));
+    }
+  }
+
+  if (files.empty()) {
+    usage(argv[0]);
+    return -1;
+  }
+
+  bool success = true;
+  for (const auto& path : files) {
+    success &= decode_file(path, out);
+  }
+
+  if (out != stdout) {
+    std::fclose(out);
+  }
+
+  return success ? 0 : -1;
+}
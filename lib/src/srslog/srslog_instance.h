@@ -69,6 +69,18 @@ public:
     backend.set_error_handler(std::move(callback));
   }
 
+  /// Selects the overflow policy of the backend queue.
+  void set_overflow_policy(overflow_policy policy)
+  {
+    backend.set_overflow_policy(policy);
+  }
+
+  /// Returns the number of log entries discarded by the backend queue.
+  size_t get_nof_discarded_entries() const
+  {
+    return backend.get_nof_discarded_entries();
+  }
+
   /// Set the specified sink as the default one.
   void set_default_sink(sink& s) { default_sink = &s; }
 
@@ -92,6 +92,15 @@ void pdcp::write_sdu(uint32_t lcid, unique_byte_buffer_t sdu)
   }
 }
 
+void pdcp::write_sdus(uint32_t lcid, unique_byte_buffer_list_t sdus)
+{
+  if (valid_lcid(lcid)) {
+    pdcp_array.at(lcid)->write_sdus(std::move(sdus));
+  } else {
+    pdcp_log->warning("Writing %zd sdus: lcid=%d. Deallocating sdus\n", sdus.size(), lcid);
+  }
+}
+
 void pdcp::write_sdu_mch(uint32_t lcid, unique_byte_buffer_t sdu)
 {
   if (valid_mch_lcid(lcid)) {
@@ -44,6 +44,18 @@ void pdcp_entity_base::config_security(as_security_config_t sec_cfg_)
   log->debug_hex(sec_cfg.k_up_enc.data(), 32, "K_up_enc");
   log->debug_hex(sec_cfg.k_rrc_int.data(), 32, "K_rrc_int");
   log->debug_hex(sec_cfg.k_up_int.data(), 32, "K_up_int");
+
+  // If control plane use RRC keys. If data use user plane keys
+  uint8_t* k_enc = is_srb() ? sec_cfg.k_rrc_enc.data() : sec_cfg.k_up_enc.data();
+  uint8_t* k_int = is_srb() ? sec_cfg.k_rrc_int.data() : sec_cfg.k_up_int.data();
+  k_enc_ctx      = {};
+  k_int_ctx      = {};
+  if (sec_cfg.cipher_algo == CIPHERING_ALGORITHM_ID_128_EEA2) {
+    aes128_set_key(&k_enc_ctx, &k_enc[16]);
+  }
+  if (sec_cfg.integ_algo == INTEGRITY_ALGORITHM_ID_128_EIA2) {
+    aes128_set_key(&k_int_ctx, &k_int[16]);
+  }
 }
 
 /****************************************************************************
@@ -67,7 +79,7 @@ void pdcp_entity_base::integrity_generate(uint8_t* msg, uint32_t msg_len, uint32
       security_128_eia1(&k_int[16], count, cfg.bearer_id - 1, cfg.tx_direction, msg, msg_len, mac);
       break;
     case INTEGRITY_ALGORITHM_ID_128_EIA2:
-      security_128_eia2(&k_int[16], count, cfg.bearer_id - 1, cfg.tx_direction, msg, msg_len, mac);
+      security_128_eia2(&k_int_ctx, count, cfg.bearer_id - 1, cfg.tx_direction, msg, msg_len, mac);
       break;
     case INTEGRITY_ALGORITHM_ID_128_EIA3:
       security_128_eia3(&k_int[16], count, cfg.bearer_id - 1, cfg.tx_direction, msg, msg_len, mac);
@@ -105,7 +117,7 @@ bool pdcp_entity_base::integrity_verify(uint8_t* msg, uint32_t msg_len, uint32_t
       security_128_eia1(&k_int[16], count, cfg.bearer_id - 1, cfg.rx_direction, msg, msg_len, mac_exp);
       break;
     case INTEGRITY_ALGORITHM_ID_128_EIA2:
-      security_128_eia2(&k_int[16], count, cfg.bearer_id - 1, cfg.rx_direction, msg, msg_len, mac_exp);
+      security_128_eia2(&k_int_ctx, count, cfg.bearer_id - 1, cfg.rx_direction, msg, msg_len, mac_exp);
       break;
     case INTEGRITY_ALGORITHM_ID_128_EIA3:
       security_128_eia3(&k_int[16], count, cfg.bearer_id - 1, cfg.rx_direction, msg, msg_len, mac_exp);
@@ -165,8 +177,7 @@ void pdcp_entity_base::cipher_encrypt(uint8_t* msg, uint32_t msg_len, uint32_t c
       memcpy(ct, ct_tmp, msg_len);
       break;
     case CIPHERING_ALGORITHM_ID_128_EEA2:
-      security_128_eea2(&(k_enc[16]), count, cfg.bearer_id - 1, cfg.tx_direction, msg, msg_len, ct_tmp);
-      memcpy(ct, ct_tmp, msg_len);
+      security_128_eea2(&k_enc_ctx, count, cfg.bearer_id - 1, cfg.tx_direction, msg, msg_len, ct);
       break;
     case CIPHERING_ALGORITHM_ID_128_EEA3:
       security_128_eea3(&(k_enc[16]), count, cfg.bearer_id - 1, cfg.tx_direction, msg, msg_len, ct_tmp);
@@ -178,6 +189,25 @@ void pdcp_entity_base::cipher_encrypt(uint8_t* msg, uint32_t msg_len, uint32_t c
   log->debug_hex(ct, msg_len, "Cipher encrypt output msg");
 }
 
+// Ciphers several PDUs of this bearer in the TX direction. EEA2 runs the PDUs through the batched AES-CTR, the other
+// algorithms fall back to one cipher_encrypt() per PDU.
+void pdcp_entity_base::cipher_encrypt_batch(security_pdu_t* pdus, uint32_t nof_pdus)
+{
+  if (sec_cfg.cipher_algo != CIPHERING_ALGORITHM_ID_128_EEA2) {
+    for (uint32_t i = 0; i < nof_pdus; i++) {
+      cipher_encrypt(pdus[i].msg, pdus[i].msg_len, pdus[i].count, pdus[i].out);
+    }
+    return;
+  }
+
+  log->debug("Cipher encrypt batch: %d PDUs, first COUNT: %" PRIu32 ", Bearer ID: %d, Direction %s\n",
+             nof_pdus,
+             nof_pdus > 0 ? pdus[0].count : 0,
+             cfg.bearer_id,
+             cfg.tx_direction == SECURITY_DIRECTION_DOWNLINK ? "Downlink" : "Uplink");
+  security_128_eea2_batch(&k_enc_ctx, cfg.bearer_id - 1, cfg.tx_direction, pdus, nof_pdus);
+}
+
 void pdcp_entity_base::cipher_decrypt(uint8_t* ct, uint32_t ct_len, uint32_t count, uint8_t* msg)
 {
   uint8_t* k_enc;
@@ -205,8 +235,7 @@ void pdcp_entity_base::cipher_decrypt(uint8_t* ct, uint32_t ct_len, uint32_t cou
       memcpy(msg, msg_tmp, ct_len);
       break;
     case CIPHERING_ALGORITHM_ID_128_EEA2:
-      security_128_eea2(&k_enc[16], count, cfg.bearer_id - 1, cfg.rx_direction, ct, ct_len, msg_tmp);
-      memcpy(msg, msg_tmp, ct_len);
+      security_128_eea2(&k_enc_ctx, count, cfg.bearer_id - 1, cfg.rx_direction, ct, ct_len, msg);
       break;
     case CIPHERING_ALGORITHM_ID_128_EEA3:
       security_128_eea3(&k_enc[16], count, cfg.bearer_id - 1, cfg.rx_direction, ct, ct_len, msg_tmp);
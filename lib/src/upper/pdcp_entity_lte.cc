@@ -155,6 +155,72 @@ void pdcp_entity_lte::write_sdu(unique_byte_buffer_t sdu)
   rlc->write_sdu(lcid, std::move(sdu));
 }
 
+// Batched version of write_sdu() for DRBs. COUNTs are assigned contiguously to the SDUs of the batch, which are then
+// ciphered together and handed to RLC in a single call.
+void pdcp_entity_lte::write_sdus(unique_byte_buffer_list_t sdus)
+{
+  // SRBs append a MAC-I to every PDU, and a pending timed security activation may take effect within the batch
+  if (is_srb() || enable_security_tx_sn != -1) {
+    for (auto& sdu : sdus) {
+      write_sdu(std::move(sdu));
+    }
+    return;
+  }
+
+  // Drop what RLC cannot take before numbering, so that the SDUs dropped do not leave gaps in the SN sequence
+  std::string rb_name     = rrc->get_rb_name(lcid);
+  uint32_t    queue_space = rlc->sdu_queue_space(lcid);
+  if (sdus.size() > queue_space) {
+    log->info(
+        "Dropping %zd of %zd %s SDUs due to full queue\n", sdus.size() - queue_space, sdus.size(), rb_name.c_str());
+    sdus.resize(queue_space);
+    if (sdus.empty()) {
+      return;
+    }
+  }
+
+  bool           do_encryption = encryption_direction == DIRECTION_TX || encryption_direction == DIRECTION_TXRX;
+  security_pdu_t pdus[PDCP_TX_BATCH_SIZE];
+  uint32_t       nof_pdus = 0;
+  for (uint32_t i = 0; i < sdus.size(); i++) {
+    unique_byte_buffer_t& sdu      = sdus[i];
+    uint32_t              tx_count = COUNT(st.tx_hfn, st.next_pdcp_tx_sn);
+
+    write_data_header(sdu, tx_count);
+
+    pdus[nof_pdus].msg     = &sdu->msg[cfg.hdr_len_bytes];
+    pdus[nof_pdus].msg_len = sdu->N_bytes - cfg.hdr_len_bytes;
+    pdus[nof_pdus].count   = tx_count;
+    pdus[nof_pdus].out     = &sdu->msg[cfg.hdr_len_bytes];
+    nof_pdus++;
+
+    // Increment NEXT_PDCP_TX_SN and TX_HFN
+    st.next_pdcp_tx_sn++;
+    if (st.next_pdcp_tx_sn > maximum_pdcp_sn) {
+      st.tx_hfn++;
+      st.next_pdcp_tx_sn = 0;
+    }
+
+    if (nof_pdus == PDCP_TX_BATCH_SIZE || i == sdus.size() - 1) {
+      if (do_encryption) {
+        cipher_encrypt_batch(pdus, nof_pdus);
+      }
+      for (uint32_t j = 0; j < nof_pdus; j++) {
+        log->info_hex(pdus[j].out - cfg.hdr_len_bytes,
+                      pdus[j].msg_len + cfg.hdr_len_bytes,
+                      "TX %s PDU, SN=%d, integrity=%s, encryption=%s",
+                      rb_name.c_str(),
+                      SN(pdus[j].count),
+                      srslte_direction_text[integrity_direction],
+                      srslte_direction_text[encryption_direction]);
+      }
+      nof_pdus = 0;
+    }
+  }
+
+  rlc->write_sdus(lcid, std::move(sdus));
+}
+
 // RLC interface
 void pdcp_entity_lte::write_pdu(unique_byte_buffer_t pdu)
 {
@@ -201,6 +201,25 @@ void rlc::write_sdu(uint32_t lcid, unique_byte_buffer_t sdu)
   }
 }
 
+// Same as write_sdu() for a batch of SDUs of one bearer, with a single bearer lookup and BSR update
+void rlc::write_sdus(uint32_t lcid, unique_byte_buffer_list_t sdus)
+{
+  if (not valid_lcid(lcid)) {
+    rlc_log->warning("RLC LCID %d doesn't exist. Deallocating %zd SDUs\n", lcid, sdus.size());
+    return;
+  }
+
+  rlc_common* rlc_entity = rlc_array.at(lcid);
+  for (auto& sdu : sdus) {
+    if (sdu->N_bytes > RLC_MAX_SDU_SIZE) {
+      rlc_log->warning("Dropping too long SDU of size %d B (Max. size %d B).\n", sdu->N_bytes, RLC_MAX_SDU_SIZE);
+      continue;
+    }
+    rlc_entity->write_sdu_s(std::move(sdu));
+  }
+  update_bsr(lcid);
+}
+
 void rlc::write_sdu_mch(uint32_t lcid, unique_byte_buffer_t sdu)
 {
   if (valid_lcid_mrb(lcid)) {
@@ -243,6 +262,15 @@ bool rlc::sdu_queue_is_full(uint32_t lcid)
   return false;
 }
 
+uint32_t rlc::sdu_queue_space(uint32_t lcid)
+{
+  if (valid_lcid(lcid)) {
+    return rlc_array.at(lcid)->sdu_queue_space();
+  }
+  rlc_log->warning("RLC LCID %d doesn't exist. Ignoring queue check\n", lcid);
+  return 0;
+}
+
 /*******************************************************************************
   MAC interface (mostly called from PHY workers, lock needs to be hold)
 *******************************************************************************/
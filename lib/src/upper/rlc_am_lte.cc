@@ -139,6 +139,11 @@ bool rlc_am_lte::sdu_queue_is_full()
   return tx.sdu_queue_is_full();
 }
 
+uint32_t rlc_am_lte::sdu_queue_space()
+{
+  return tx.sdu_queue_space();
+}
+
 /****************************************************************************
  * MAC interface
  ***************************************************************************/
@@ -213,7 +218,13 @@ bool rlc_am_lte::rlc_am_lte_tx::configure(const rlc_config_t& cfg_)
     poll_retx_timer.set(static_cast<uint32_t>(cfg.t_poll_retx), [this](uint32_t timerid) { timer_expired(timerid); });
   }
 
-  tx_sdu_queue.resize(cfg_.tx_queue_length);
+  if (not tx_sdu_queue.resize(cfg_.tx_queue_length)) {
+    log->warning("%s Keeping Tx SDU queue capacity of %d SDUs instead of %d, %d SDUs are still pending\n",
+                 RB_NAME,
+                 tx_sdu_queue.capacity(),
+                 cfg_.tx_queue_length,
+                 tx_sdu_queue.size());
+  }
 
   tx_enabled = true;
 
@@ -249,6 +260,7 @@ void rlc_am_lte::rlc_am_lte_tx::stop()
 
   // Drop all messages in RETX queue
   retx_queue.clear();
+  publish_buffer_state();
   pthread_mutex_unlock(&mutex);
 }
 
@@ -263,6 +275,7 @@ void rlc_am_lte::rlc_am_lte_tx::empty_queue()
 
   // deallocate SDU that is currently processed
   tx_sdu.reset();
+  publish_buffer_state();
 
   pthread_mutex_unlock(&mutex);
 }
@@ -281,17 +294,57 @@ bool rlc_am_lte::rlc_am_lte_tx::do_status()
 // Function is supposed to return as fast as possible
 bool rlc_am_lte::rlc_am_lte_tx::has_data()
 {
+  uint64_t snapshot = buffer_state_snapshot.load(std::memory_order_acquire);
   return (((do_status() && not status_prohibit_timer.is_running())) || // if we have a status PDU to transmit
-          (not retx_queue.empty()) ||                                  // if we have a retransmission
-          (tx_sdu != NULL) ||                                          // if we are currently transmitting a SDU
+          (snapshot & 0xffffffffu) > 0 ||                              // if we have a retransmission
+          ((snapshot >> 32u) & 0x7fffffffu) > 0 ||                     // if we are currently transmitting a SDU
           (not tx_sdu_queue.is_empty())); // or if there is a SDU queued up for transmission
 }
 
+/*
+ * Recomputes the part of the buffer state that depends on the mutex-protected TX state and publishes it for
+ * lock-free readers. Must be called with the mutex held, after every change of retx_queue, tx_sdu or tx_window.
+ */
+void rlc_am_lte::rlc_am_lte_tx::publish_buffer_state()
+{
+  uint32_t retx_bytes = 0;
+
+  // Drop any retx SNs that are not present in tx_window anymore
+  while (not retx_queue.empty() && not tx_window.has_sn(retx_queue.front().sn)) {
+    retx_queue.pop_front();
+  }
+
+  if (not retx_queue.empty()) {
+    rlc_amd_retx_t retx = retx_queue.front();
+    log->debug("%s Buffer state - retx - SN=%d, Segment: %s, %d:%d\n",
+               RB_NAME,
+               retx.sn,
+               retx.is_segment ? "true" : "false",
+               retx.so_start,
+               retx.so_end);
+    int req_bytes = required_buffer_size(retx);
+    if (req_bytes < 0) {
+      log->error("In publish_buffer_state(): Removing retx.sn=%d from queue\n", retx.sn);
+      retx_queue.pop_front();
+    } else {
+      retx_bytes = static_cast<uint32_t>(req_bytes);
+    }
+  }
+
+  uint64_t sdu_bytes   = (tx_sdu != nullptr) ? (tx_sdu->N_bytes & 0x7fffffffu) : 0;
+  uint64_t window_full = tx_window.full() ? 1 : 0;
+  buffer_state_snapshot.store(retx_bytes | (sdu_bytes << 32u) | (window_full << 63u), std::memory_order_release);
+}
+
+// Lock-free. Combines the published TX state with the SDU queue occupancy and the pending status report
 uint32_t rlc_am_lte::rlc_am_lte_tx::get_buffer_state()
 {
-  pthread_mutex_lock(&mutex);
-  uint32_t n_bytes = 0;
-  uint32_t n_sdus  = 0;
+  uint64_t snapshot       = buffer_state_snapshot.load(std::memory_order_acquire);
+  uint32_t retx_bytes     = snapshot & 0xffffffffu;
+  uint32_t tx_sdu_bytes   = (snapshot >> 32u) & 0x7fffffffu;
+  bool     tx_window_full = (snapshot >> 63u) > 0;
+  uint32_t n_bytes        = 0;
+  uint32_t n_sdus         = 0;
 
   log->debug("%s Buffer state - do_status=%s, status_prohibit_running=%s (%d/%d)\n",
              RB_NAME,
@@ -307,33 +360,18 @@ uint32_t rlc_am_lte::rlc_am_lte_tx::get_buffer_state()
   }
 
   // Bytes needed for retx
-  if (not retx_queue.empty()) {
-    rlc_amd_retx_t retx = retx_queue.front();
-    log->debug("%s Buffer state - retx - SN=%d, Segment: %s, %d:%d\n",
-               RB_NAME,
-               retx.sn,
-               retx.is_segment ? "true" : "false",
-               retx.so_start,
-               retx.so_end);
-    if (tx_window.end() != tx_window.find(retx.sn)) {
-      int req_bytes = required_buffer_size(retx);
-      if (req_bytes < 0) {
-        log->error("In get_buffer_state(): Removing retx.sn=%d from queue\n", retx.sn);
-        retx_queue.pop_front();
-      } else {
-        n_bytes += req_bytes;
-        log->debug("Buffer state - retx: %d bytes\n", n_bytes);
-      }
-    }
+  if (retx_bytes > 0) {
+    n_bytes += retx_bytes;
+    log->debug("Buffer state - retx: %d bytes\n", n_bytes);
   }
 
   // Bytes needed for tx SDUs
-  if (tx_window.size() < 1024) {
+  if (not tx_window_full) {
     n_sdus = tx_sdu_queue.size();
     n_bytes += tx_sdu_queue.size_bytes();
-    if (tx_sdu != NULL) {
+    if (tx_sdu_bytes > 0) {
       n_sdus++;
-      n_bytes += tx_sdu->N_bytes;
+      n_bytes += tx_sdu_bytes;
     }
   }
 
@@ -348,7 +386,6 @@ uint32_t rlc_am_lte::rlc_am_lte_tx::get_buffer_state()
     log->debug("%s Total buffer state - %d SDUs (%d B)\n", RB_NAME, n_sdus, n_bytes);
   }
 
-  pthread_mutex_unlock(&mutex);
   return n_bytes;
 }
 
@@ -396,6 +433,11 @@ bool rlc_am_lte::rlc_am_lte_tx::sdu_queue_is_full()
   return tx_sdu_queue.is_full();
 }
 
+uint32_t rlc_am_lte::rlc_am_lte_tx::sdu_queue_space()
+{
+  return tx_sdu_queue.free_space();
+}
+
 int rlc_am_lte::rlc_am_lte_tx::read_pdu(uint8_t* payload, uint32_t nof_bytes)
 {
   pthread_mutex_lock(&mutex);
@@ -417,7 +459,7 @@ int rlc_am_lte::rlc_am_lte_tx::read_pdu(uint8_t* payload, uint32_t nof_bytes)
   }
 
   // Section 5.2.2.3 in TS 36.311, if tx_window is full and retx_queue empty, retransmit random PDU
-  if (tx_window.size() >= RLC_AM_WINDOW_SIZE && retx_queue.empty()) {
+  if (tx_window.full() && retx_queue.empty()) {
     retransmit_random_pdu();
   }
 
@@ -434,6 +476,7 @@ int rlc_am_lte::rlc_am_lte_tx::read_pdu(uint8_t* payload, uint32_t nof_bytes)
 
 unlock_and_exit:
   num_tx_bytes += pdu_size;
+  publish_buffer_state();
   pthread_mutex_unlock(&mutex);
   return pdu_size;
 }
@@ -446,10 +489,11 @@ void rlc_am_lte::rlc_am_lte_tx::timer_expired(uint32_t timeout_id)
     // Section 5.2.2.3 in TS 36.311, schedule random PDU for retransmission if
     // (a) both tx and retx buffer are empty, or
     // (b) no new data PDU can be transmitted (tx window is full)
-    if ((retx_queue.empty() && tx_sdu_queue.size() == 0) || tx_window.size() >= RLC_AM_WINDOW_SIZE) {
+    if ((retx_queue.empty() && tx_sdu_queue.size() == 0) || tx_window.full()) {
       retransmit_random_pdu();
     }
   }
+  publish_buffer_state();
   pthread_mutex_unlock(&mutex);
 
   if (bsr_callback) {
@@ -461,14 +505,26 @@ void rlc_am_lte::rlc_am_lte_tx::retransmit_random_pdu()
 {
   if (not tx_window.empty()) {
     // randomly select PDU in tx window for retransmission
-    std::map<uint32_t, rlc_amd_tx_pdu_t>::iterator it = tx_window.begin();
-    std::advance(it, rand() % tx_window.size());
-    log->info("Schedule SN=%d for reTx.\n", it->first);
+    uint32_t n  = rand() % tx_window.size();
+    uint32_t sn = vt_a;
+    for (; sn != vt_s; sn = (sn + 1) % MOD) {
+      if (tx_window.has_sn(sn)) {
+        if (n == 0) {
+          break;
+        }
+        n--;
+      }
+    }
+    if (not tx_window.has_sn(sn)) {
+      log->error("Couldn't find PDU for random reTx in tx window\n");
+      return;
+    }
+    log->info("Schedule SN=%d for reTx.\n", sn);
     rlc_amd_retx_t retx = {};
     retx.is_segment     = false;
     retx.so_start       = 0;
-    retx.so_end         = it->second.buf->N_bytes;
-    retx.sn             = it->first;
+    retx.so_end         = tx_window[sn].buf->N_bytes;
+    retx.sn             = sn;
     retx_queue.push_back(retx);
   }
 }
@@ -512,7 +568,7 @@ bool rlc_am_lte::rlc_am_lte_tx::poll_required()
     return true;
   }
 
-  if (tx_window.size() >= RLC_AM_WINDOW_SIZE) {
+  if (tx_window.full()) {
     return true;
   }
 
@@ -566,7 +622,7 @@ int rlc_am_lte::rlc_am_lte_tx::build_retx_pdu(uint8_t* payload, uint32_t nof_byt
   rlc_amd_retx_t retx = retx_queue.front();
 
   // Sanity check - drop any retx SNs not present in tx_window
-  while (tx_window.end() == tx_window.find(retx.sn)) {
+  while (not tx_window.has_sn(retx.sn)) {
     retx_queue.pop_front();
     if (!retx_queue.empty()) {
       retx = retx_queue.front();
@@ -629,7 +685,7 @@ int rlc_am_lte::rlc_am_lte_tx::build_retx_pdu(uint8_t* payload, uint32_t nof_byt
 
 int rlc_am_lte::rlc_am_lte_tx::build_segment(uint8_t* payload, uint32_t nof_bytes, rlc_amd_retx_t retx)
 {
-  if (tx_window[retx.sn].buf == NULL) {
+  if (not tx_window.has_sn(retx.sn) || tx_window[retx.sn].buf == NULL) {
     log->error("In build_segment: retx.sn=%d has null buffer\n", retx.sn);
     return 0;
   }
@@ -796,7 +852,7 @@ int rlc_am_lte::rlc_am_lte_tx::build_data_pdu(uint8_t* payload, uint32_t nof_byt
   }
 
   // do not build any more PDU if window is already full
-  if (tx_sdu == NULL && tx_window.size() >= RLC_AM_WINDOW_SIZE) {
+  if (tx_sdu == NULL && tx_window.full()) {
     log->info("Tx window full.\n");
     return 0;
   }
@@ -808,9 +864,10 @@ int rlc_am_lte::rlc_am_lte_tx::build_data_pdu(uint8_t* payload, uint32_t nof_byt
     srslte::console("tx_window size: %zd PDUs\n", tx_window.size());
     srslte::console("vt_a = %d, vt_ms = %d, vt_s = %d, poll_sn = %d\n", vt_a, vt_ms, vt_s, poll_sn);
     srslte::console("retx_queue size: %zd PDUs\n", retx_queue.size());
-    std::map<uint32_t, rlc_amd_tx_pdu_t>::iterator txit;
-    for (txit = tx_window.begin(); txit != tx_window.end(); txit++) {
-      srslte::console("tx_window - SN=%d\n", txit->first);
+    for (uint32_t sn = vt_a; sn != vt_s; sn = (sn + 1) % MOD) {
+      if (tx_window.has_sn(sn)) {
+        srslte::console("tx_window - SN=%d\n", sn);
+      }
     }
     exit(-1);
 #else
@@ -933,11 +990,12 @@ int rlc_am_lte::rlc_am_lte_tx::build_data_pdu(uint8_t* payload, uint32_t nof_byt
   vt_s      = (vt_s + 1) % MOD;
 
   // Place PDU in tx_window, write header and TX
-  tx_window[header.sn].buf        = std::move(pdu);
-  tx_window[header.sn].header     = header;
-  tx_window[header.sn].is_acked   = false;
-  tx_window[header.sn].retx_count = 0;
-  const byte_buffer_t* buffer_ptr = tx_window[header.sn].buf.get();
+  rlc_amd_tx_pdu_t& tx_pdu        = tx_window.add_pdu(header.sn);
+  tx_pdu.buf                      = std::move(pdu);
+  tx_pdu.header                   = header;
+  tx_pdu.is_acked                 = false;
+  tx_pdu.retx_count               = 0;
+  const byte_buffer_t* buffer_ptr = tx_pdu.buf.get();
 
   uint8_t* ptr = payload;
   rlc_am_write_data_pdu_header(&header, &ptr);
@@ -970,9 +1028,8 @@ void rlc_am_lte::rlc_am_lte_tx::handle_control_pdu(uint8_t* payload, uint32_t no
   }
 
   // Handle ACKs and NACKs
-  std::map<uint32_t, rlc_amd_tx_pdu_t>::iterator it;
-  bool                                           update_vt_a = true;
-  uint32_t                                       i           = vt_a;
+  bool     update_vt_a = true;
+  uint32_t i           = vt_a;
 
   while (TX_MOD_BASE(i) < TX_MOD_BASE(status.ack_sn) && TX_MOD_BASE(i) < TX_MOD_BASE(vt_s)) {
     bool nack = false;
@@ -980,34 +1037,33 @@ void rlc_am_lte::rlc_am_lte_tx::handle_control_pdu(uint8_t* payload, uint32_t no
       if (status.nacks[j].nack_sn == i) {
         nack        = true;
         update_vt_a = false;
-        it          = tx_window.find(i);
-        if (tx_window.end() != it) {
+        if (tx_window.has_sn(i)) {
+          rlc_amd_tx_pdu_t& pdu = tx_window[i];
           if (!retx_queue_has_sn(i)) {
             rlc_amd_retx_t retx = {};
             retx.sn             = i;
             retx.is_segment     = false;
             retx.so_start       = 0;
-            retx.so_end         = it->second.buf->N_bytes;
+            retx.so_end         = pdu.buf->N_bytes;
 
             if (status.nacks[j].has_so) {
               // sanity check
-              if (status.nacks[j].so_start >= it->second.buf->N_bytes) {
+              if (status.nacks[j].so_start >= pdu.buf->N_bytes) {
                 // print error but try to send original PDU again
                 log->info("SO_start is larger than original PDU (%d >= %d)\n",
                           status.nacks[j].so_start,
-                          it->second.buf->N_bytes);
+                          pdu.buf->N_bytes);
                 status.nacks[j].so_start = 0;
               }
 
               // check for special SO_end value
               if (status.nacks[j].so_end == 0x7FFF) {
-                status.nacks[j].so_end = it->second.buf->N_bytes;
+                status.nacks[j].so_end = pdu.buf->N_bytes;
               } else {
                 retx.so_end = status.nacks[j].so_end + 1;
               }
 
-              if (status.nacks[j].so_start < it->second.buf->N_bytes &&
-                  status.nacks[j].so_end <= it->second.buf->N_bytes) {
+              if (status.nacks[j].so_start < pdu.buf->N_bytes && status.nacks[j].so_end <= pdu.buf->N_bytes) {
                 retx.is_segment = true;
                 retx.so_start   = status.nacks[j].so_start;
               } else {
@@ -1016,7 +1072,7 @@ void rlc_am_lte::rlc_am_lte_tx::handle_control_pdu(uint8_t* payload, uint32_t no
                              i,
                              status.nacks[j].so_start,
                              status.nacks[j].so_end,
-                             it->second.buf->N_bytes);
+                             pdu.buf->N_bytes);
               }
             }
             retx_queue.push_back(retx);
@@ -1027,21 +1083,17 @@ void rlc_am_lte::rlc_am_lte_tx::handle_control_pdu(uint8_t* payload, uint32_t no
 
     if (!nack) {
       // ACKed SNs get marked and removed from tx_window if possible
-      if (tx_window.count(i) > 0) {
-        it = tx_window.find(i);
-        if (it != tx_window.end()) {
-          if (update_vt_a) {
-            tx_window.erase(it);
-            vt_a  = (vt_a + 1) % MOD;
-            vt_ms = (vt_ms + 1) % MOD;
-          }
-        }
+      if (tx_window.has_sn(i) && update_vt_a) {
+        tx_window.remove_pdu(i);
+        vt_a  = (vt_a + 1) % MOD;
+        vt_ms = (vt_ms + 1) % MOD;
       }
     }
     i = (i + 1) % MOD;
   }
 
   debug_state();
+  publish_buffer_state();
 
   pthread_mutex_unlock(&mutex);
 }
@@ -1054,7 +1106,7 @@ void rlc_am_lte::rlc_am_lte_tx::debug_state()
 int rlc_am_lte::rlc_am_lte_tx::required_buffer_size(rlc_amd_retx_t retx)
 {
   if (!retx.is_segment) {
-    if (tx_window.count(retx.sn) == 1) {
+    if (tx_window.has_sn(retx.sn)) {
       if (tx_window[retx.sn].buf) {
         return rlc_am_packed_length(&tx_window[retx.sn].header) + tx_window[retx.sn].buf->N_bytes;
       } else {
@@ -1213,8 +1265,6 @@ void rlc_am_lte::rlc_am_lte_rx::stop()
  */
 void rlc_am_lte::rlc_am_lte_rx::handle_data_pdu(uint8_t* payload, uint32_t nof_bytes, rlc_amd_pdu_header_t& header)
 {
-  std::map<uint32_t, rlc_amd_rx_pdu_t>::iterator it;
-
   log->info_hex(payload, nof_bytes, "%s Rx data PDU SN=%d (%d B)", RB_NAME, header.sn, nof_bytes);
   log->debug("%s\n", rlc_amd_pdu_header_to_string(header).c_str());
 
@@ -1239,8 +1289,7 @@ void rlc_am_lte::rlc_am_lte_rx::handle_data_pdu(uint8_t* payload, uint32_t nof_b
     return;
   }
 
-  it = rx_window.find(header.sn);
-  if (rx_window.end() != it) {
+  if (rx_window.has_sn(header.sn)) {
     if (header.p) {
       log->info("%s Status packet requested through polling bit\n", RB_NAME);
       do_status = true;
@@ -1250,9 +1299,8 @@ void rlc_am_lte::rlc_am_lte_rx::handle_data_pdu(uint8_t* payload, uint32_t nof_b
   }
 
   // Write to rx window
-  rlc_amd_rx_pdu_t pdu;
-  pdu.buf = srslte::allocate_unique_buffer(*pool, true);
-  if (pdu.buf == NULL) {
+  unique_byte_buffer_t buf = srslte::allocate_unique_buffer(*pool, true);
+  if (buf == NULL) {
 #ifdef RLC_AM_BUFFER_DEBUG
     srslte::console("Fatal Error: Couldn't allocate PDU in handle_data_pdu().\n");
     exit(-1);
@@ -1263,19 +1311,17 @@ void rlc_am_lte::rlc_am_lte_rx::handle_data_pdu(uint8_t* payload, uint32_t nof_b
   }
 
   // check available space for payload
-  if (nof_bytes > pdu.buf->get_tailroom()) {
-    log->error("%s Discarding SN=%d of size %d B (available space %d B)\n",
-               RB_NAME,
-               header.sn,
-               nof_bytes,
-               pdu.buf->get_tailroom());
+  if (nof_bytes > buf->get_tailroom()) {
+    log->error(
+        "%s Discarding SN=%d of size %d B (available space %d B)\n", RB_NAME, header.sn, nof_bytes, buf->get_tailroom());
     return;
   }
-  memcpy(pdu.buf->msg, payload, nof_bytes);
-  pdu.buf->N_bytes = nof_bytes;
-  pdu.header       = header;
+  memcpy(buf->msg, payload, nof_bytes);
+  buf->N_bytes = nof_bytes;
 
-  rx_window[header.sn] = std::move(pdu);
+  rlc_amd_rx_pdu_t& pdu = rx_window.add_pdu(header.sn);
+  pdu.buf               = std::move(buf);
+  pdu.header            = header;
 
   // Update vr_h
   if (RX_MOD_BASE(header.sn) >= RX_MOD_BASE(vr_h)) {
@@ -1283,10 +1329,8 @@ void rlc_am_lte::rlc_am_lte_rx::handle_data_pdu(uint8_t* payload, uint32_t nof_b
   }
 
   // Update vr_ms
-  it = rx_window.find(vr_ms);
-  while (rx_window.end() != it) {
+  while (rx_window.has_sn(vr_ms)) {
     vr_ms = (vr_ms + 1) % MOD;
-    it    = rx_window.find(vr_ms);
   }
 
   // Check poll bit
@@ -1335,8 +1379,6 @@ void rlc_am_lte::rlc_am_lte_rx::handle_data_pdu_segment(uint8_t*              pa
                                                         uint32_t              nof_bytes,
                                                         rlc_amd_pdu_header_t& header)
 {
-  std::map<uint32_t, rlc_amd_rx_pdu_segments_t>::iterator it;
-
   log->info_hex(payload,
                 nof_bytes,
                 "%s Rx data PDU segment of SN=%d (%d B), SO=%d, N_li=%d",
@@ -1379,8 +1421,7 @@ void rlc_am_lte::rlc_am_lte_rx::handle_data_pdu_segment(uint8_t*              pa
   segment.header       = header;
 
   // Check if we already have a segment from the same PDU
-  it = rx_segments.find(header.sn);
-  if (rx_segments.end() != it) {
+  if (rx_segments.has_sn(header.sn)) {
 
     if (header.p) {
       log->info("%s Status packet requested through polling bit\n", RB_NAME);
@@ -1389,16 +1430,15 @@ void rlc_am_lte::rlc_am_lte_rx::handle_data_pdu_segment(uint8_t*              pa
 
     // Add segment to PDU list and check for complete
     // NOTE: MAY MOVE. Preference would be to capture by value, and then move; but header is stack allocated
-    if (add_segment_and_check(&it->second, &segment)) {
-      rx_segments.erase(it);
+    if (add_segment_and_check(&rx_segments[header.sn], &segment)) {
+      rx_segments.remove_pdu(header.sn);
     }
 
   } else {
 
     // Create new PDU segment list and write to rx_segments
-    rlc_amd_rx_pdu_segments_t pdu;
+    rlc_amd_rx_pdu_segments_t& pdu = rx_segments.add_pdu(header.sn);
     pdu.segments.push_back(std::move(segment));
-    rx_segments[header.sn] = std::move(pdu);
 
     // Update vr_h
     if (RX_MOD_BASE(header.sn) >= RX_MOD_BASE(vr_h)) {
@@ -1440,7 +1480,7 @@ void rlc_am_lte::rlc_am_lte_rx::reassemble_rx_sdus()
   }
 
   // Iterate through rx_window, assembling and delivering SDUs
-  while (rx_window.end() != rx_window.find(vr_r)) {
+  while (rx_window.has_sn(vr_r)) {
     // Handle any SDU segments
     for (uint32_t i = 0; i < rx_window[vr_r].header.N_li; i++) {
       len = rx_window[vr_r].header.li[i];
@@ -1503,7 +1543,11 @@ void rlc_am_lte::rlc_am_lte_rx::reassemble_rx_sdus()
     // Handle last segment
     len = rx_window[vr_r].buf->N_bytes;
     log->debug_hex(rx_window[vr_r].buf->msg, len, "Handling last segment of length %d B of SN=%d\n", len, vr_r);
-    if (rx_sdu->get_tailroom() >= len) {
+    if (rx_sdu->N_bytes == 0) {
+      // Nothing accumulated yet, so the PDU buffer already holds the (start of the) SDU. Hand it over instead of
+      // copying; the empty SDU buffer is released together with the window slot
+      std::swap(rx_sdu, rx_window[vr_r].buf);
+    } else if (rx_sdu->get_tailroom() >= len) {
       memcpy(&rx_sdu->msg[rx_sdu->N_bytes], rx_window[vr_r].buf->msg, len);
       rx_sdu->N_bytes += rx_window[vr_r].buf->N_bytes;
     } else {
@@ -1537,21 +1581,18 @@ void rlc_am_lte::rlc_am_lte_rx::reassemble_rx_sdus()
     // Move the rx_window
     log->debug("Erasing SN=%d.\n", vr_r);
     // also erase any segments of this SN
-    std::map<uint32_t, rlc_amd_rx_pdu_segments_t>::iterator it;
-    it = rx_segments.find(vr_r);
-    if (rx_segments.end() != it) {
+    if (rx_segments.has_sn(vr_r)) {
       log->debug("Erasing segments of SN=%d\n", vr_r);
-      std::list<rlc_amd_rx_pdu_t>::iterator segit;
-      for (segit = it->second.segments.begin(); segit != it->second.segments.end(); ++segit) {
+      for (const rlc_amd_rx_pdu_t& segment : rx_segments[vr_r].segments) {
         log->debug(" Erasing segment of SN=%d SO=%d Len=%d N_li=%d\n",
-                   segit->header.sn,
-                   segit->header.so,
-                   segit->buf->N_bytes,
-                   segit->header.N_li);
+                   segment.header.sn,
+                   segment.header.so,
+                   segment.buf->N_bytes,
+                   segment.header.N_li);
       }
-      it->second.segments.clear();
+      rx_segments.remove_pdu(vr_r);
     }
-    rx_window.erase(vr_r);
+    rx_window.remove_pdu(vr_r);
     vr_r  = (vr_r + 1) % MOD;
     vr_mr = (vr_mr + 1) % MOD;
   }
@@ -1624,11 +1665,9 @@ void rlc_am_lte::rlc_am_lte_rx::timer_expired(uint32_t timeout_id)
     log->debug("%s reordering timeout expiry - updating vr_ms (was %d)\n", RB_NAME, vr_ms);
 
     // 36.322 v10 Section 5.1.3.2.4
-    vr_ms                                             = vr_x;
-    std::map<uint32_t, rlc_amd_rx_pdu_t>::iterator it = rx_window.find(vr_ms);
-    while (rx_window.end() != it) {
+    vr_ms = vr_x;
+    while (rx_window.has_sn(vr_ms)) {
       vr_ms = (vr_ms + 1) % MOD;
-      it    = rx_window.find(vr_ms);
     }
 
     if (poll_received) {
@@ -1655,7 +1694,7 @@ int rlc_am_lte::rlc_am_lte_rx::get_status_pdu(rlc_status_pdu_t* status, const ui
   // We don't use segment NACKs - just NACK the full PDU
   uint32_t i = vr_r;
   while (RX_MOD_BASE(i) < RX_MOD_BASE(vr_ms) && status->N_nack < RLC_AM_WINDOW_SIZE) {
-    if (rx_window.find(i) == rx_window.end()) {
+    if (not rx_window.has_sn(i)) {
       status->nacks[status->N_nack].nack_sn = i;
       status->N_nack++;
     } else {
@@ -1698,7 +1737,7 @@ int rlc_am_lte::rlc_am_lte_rx::get_status_pdu_length()
   status.ack_sn           = vr_ms;
   uint32_t i              = vr_r;
   while (RX_MOD_BASE(i) < RX_MOD_BASE(vr_ms) && status.N_nack < RLC_AM_WINDOW_SIZE) {
-    if (rx_window.find(i) == rx_window.end()) {
+    if (not rx_window.has_sn(i)) {
       status.N_nack++;
     }
     i = (i + 1) % MOD;
@@ -1709,14 +1748,15 @@ int rlc_am_lte::rlc_am_lte_rx::get_status_pdu_length()
 
 void rlc_am_lte::rlc_am_lte_rx::print_rx_segments()
 {
-  std::map<uint32_t, rlc_amd_rx_pdu_segments_t>::iterator it;
-  std::stringstream                                       ss;
+  std::stringstream ss;
   ss << "rx_segments:" << std::endl;
-  for (it = rx_segments.begin(); it != rx_segments.end(); it++) {
-    std::list<rlc_amd_rx_pdu_t>::iterator segit;
-    for (segit = it->second.segments.begin(); segit != it->second.segments.end(); segit++) {
-      ss << "    SN=" << segit->header.sn << " SO:" << segit->header.so << " N:" << segit->buf->N_bytes
-         << " N_li: " << segit->header.N_li << std::endl;
+  for (uint32_t sn = vr_r; sn != vr_mr; sn = (sn + 1) % MOD) {
+    if (not rx_segments.has_sn(sn)) {
+      continue;
+    }
+    for (const rlc_amd_rx_pdu_t& segment : rx_segments[sn].segments) {
+      ss << "    SN=" << segment.header.sn << " SO:" << segment.header.so << " N:" << segment.buf->N_bytes
+         << " N_li: " << segment.header.N_li << std::endl;
     }
   }
   log->debug("%s\n", ss.str().c_str());
@@ -1753,8 +1793,8 @@ bool rlc_am_lte::rlc_am_lte_rx::add_segment_and_check(rlc_amd_rx_pdu_segments_t*
   }
 
   // Check for complete
-  uint32_t                              so = 0;
-  std::list<rlc_amd_rx_pdu_t>::iterator it, tmpit;
+  uint32_t                                so = 0;
+  std::vector<rlc_amd_rx_pdu_t>::iterator it, tmpit;
   for (it = pdu->segments.begin(); it != pdu->segments.end(); /* Do not increment */) {
     // Check that there is no gap between last segment and current; overlap allowed
     if (so < it->header.so) {
@@ -123,6 +123,11 @@ bool rlc_um_base::sdu_queue_is_full()
   return tx->sdu_queue_is_full();
 }
 
+uint32_t rlc_um_base::sdu_queue_space()
+{
+  return tx->sdu_queue_space();
+}
+
 /****************************************************************************
  * MAC interface
  ***************************************************************************/
@@ -245,21 +250,6 @@ bool rlc_um_base::rlc_um_base_tx::has_data()
   return (tx_sdu != nullptr || !tx_sdu_queue.is_empty());
 }
 
-void rlc_um_base::rlc_um_base_tx::write_sdu(unique_byte_buffer_t sdu)
-{
-  if (sdu) {
-    log->info_hex(sdu->msg,
-                  sdu->N_bytes,
-                  "%s Tx SDU (%d B, tx_sdu_queue_len=%d)",
-                  rb_name.c_str(),
-                  sdu->N_bytes,
-                  tx_sdu_queue.size());
-    tx_sdu_queue.write(std::move(sdu));
-  } else {
-    log->warning("NULL SDU pointer in write_sdu()\n");
-  }
-}
-
 int rlc_um_base::rlc_um_base_tx::try_write_sdu(unique_byte_buffer_t sdu)
 {
   if (sdu) {
@@ -294,6 +284,11 @@ bool rlc_um_base::rlc_um_base_tx::sdu_queue_is_full()
   return tx_sdu_queue.is_full();
 }
 
+uint32_t rlc_um_base::rlc_um_base_tx::sdu_queue_space()
+{
+  return tx_sdu_queue.free_space();
+}
+
 int rlc_um_base::rlc_um_base_tx::build_data_pdu(uint8_t* payload, uint32_t nof_bytes)
 {
   unique_byte_buffer_t pdu;
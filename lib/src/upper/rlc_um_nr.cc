@@ -107,7 +107,13 @@ bool rlc_um_nr::rlc_um_nr_tx::configure(const rlc_config_t& cnfg_, std::string r
     return false;
   }
 
-  tx_sdu_queue.resize(cnfg_.tx_queue_length);
+  if (not tx_sdu_queue.resize(cnfg_.tx_queue_length)) {
+    log->warning("%s Keeping Tx SDU queue capacity of %d SDUs instead of %d, %d SDUs are still pending\n",
+                 rb_name_.c_str(),
+                 tx_sdu_queue.capacity(),
+                 cnfg_.tx_queue_length,
+                 tx_sdu_queue.size());
+  }
 
   rb_name = rb_name_;
 
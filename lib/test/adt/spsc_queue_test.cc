@@ -0,0 +1,99 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srslte/adt/spsc_queue.h"
+#include "srslte/common/test_common.h"
+#include <memory>
+#include <thread>
+
+int test_spsc_queue_api()
+{
+  srslte::spsc_queue<std::unique_ptr<int> > q(4);
+  TESTASSERT(q.empty());
+  TESTASSERT(q.capacity() == 4);
+
+  for (int i = 0; i < 4; ++i) {
+    TESTASSERT(q.try_push(std::unique_ptr<int>(new int(i))));
+  }
+  TESTASSERT(q.full());
+
+  // TEST: failed push hands the object back
+  srslte::error_type<std::unique_ptr<int> > ret = q.try_push(std::unique_ptr<int>(new int(5)));
+  TESTASSERT(not ret);
+  TESTASSERT(*ret.error() == 5);
+
+  std::unique_ptr<int> val;
+  for (int i = 0; i < 4; ++i) {
+    TESTASSERT(q.try_pop(&val));
+    TESTASSERT(*val == i);
+  }
+  TESTASSERT(not q.try_pop(&val));
+  TESTASSERT(q.empty());
+
+  // TEST: resize only while empty
+  TESTASSERT(q.resize(8));
+  TESTASSERT(q.capacity() == 8);
+  TESTASSERT(q.try_push(std::unique_ptr<int>(new int(1))));
+  TESTASSERT(not q.resize(2));
+  TESTASSERT(q.capacity() == 8);
+  TESTASSERT(q.resize(8));
+  TESTASSERT(q.size() == 1);
+
+  return SRSLTE_SUCCESS;
+}
+
+int test_spsc_queue_threads()
+{
+  const uint32_t          nof_items = 1000000;
+  srslte::spsc_queue<int> q(16);
+
+  std::thread producer([&q, nof_items]() {
+    for (uint32_t i = 0; i < nof_items; ++i) {
+      while (not q.try_push(i)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  // TEST: items are received in order and none is lost
+  uint32_t count = 0;
+  int      val   = 0;
+  while (count < nof_items) {
+    if (q.try_pop(&val)) {
+      TESTASSERT(val == (int)count);
+      count++;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  TESTASSERT(q.empty());
+
+  return SRSLTE_SUCCESS;
+}
+
+int main()
+{
+  TESTASSERT(test_spsc_queue_api() == SRSLTE_SUCCESS);
+  TESTASSERT(test_spsc_queue_threads() == SRSLTE_SUCCESS);
+  printf("Success\n");
+  return SRSLTE_SUCCESS;
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSLTE_ASN1_ARENA_TEST_COMMON_H
+#define SRSLTE_ASN1_ARENA_TEST_COMMON_H
+
+#include "srslte/asn1/asn1_utils.h"
+#include "srslte/common/test_common.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// NOTE: This header replaces the global operator new/delete, it must only be included by one file of each test
+
+// Heap allocations made by the calling thread, to count the allocations of unpacking a message
+static thread_local uint32_t nof_allocs = 0;
+
+void* operator new(size_t sz)
+{
+  nof_allocs++;
+  void* ptr = malloc(sz);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+void operator delete(void* ptr) noexcept
+{
+  free(ptr);
+}
+
+namespace asn1 {
+
+typedef std::chrono::high_resolution_clock bench_clock;
+
+// Allocations and time of unpacking a message on the heap and in an arena
+template <class Msg>
+int test_arena_unpack(const char* name, const uint8_t* buf, uint32_t len)
+{
+  const uint32_t                            nof_iterations = 1000;
+  std::chrono::duration<double, std::micro> heap_time, arena_time;
+  uint32_t                                  heap_allocs, arena_allocs;
+  mem_arena                                 arena;
+  std::vector<uint8_t>                      heap_buf(len), arena_buf(len);
+
+  nof_allocs                    = 0;
+  bench_clock::time_point start = bench_clock::now();
+  for (uint32_t i = 0; i < nof_iterations; ++i) {
+    Msg      msg;
+    cbit_ref bref(buf, len);
+    TESTASSERT(msg.unpack(bref) == SRSASN_SUCCESS);
+  }
+  heap_time   = bench_clock::now() - start;
+  heap_allocs = nof_allocs;
+
+  nof_allocs = 0;
+  start      = bench_clock::now();
+  for (uint32_t i = 0; i < nof_iterations; ++i) {
+    arena.reset();
+    Msg msg;
+    {
+      arena_scope scope(arena);
+      cbit_ref    bref(buf, len);
+      TESTASSERT(msg.unpack(bref) == SRSASN_SUCCESS);
+    }
+  }
+  arena_time   = bench_clock::now() - start;
+  arena_allocs = nof_allocs;
+
+  printf("%s unpack: heap %d allocs, %.2f us; arena %d allocs, %.2f us\n",
+         name,
+         heap_allocs / nof_iterations,
+         heap_time.count() / nof_iterations,
+         arena_allocs / nof_iterations,
+         arena_time.count() / nof_iterations);
+  // only the first message allocates the arena chunk
+  TESTASSERT(heap_allocs >= nof_iterations and arena_allocs <= 1);
+
+  // both decode the same message, and deep copies made outside of the scope outlive the arena
+  Msg* msg_cpy;
+  {
+    Msg heap_msg, arena_msg;
+    {
+      arena_scope scope(arena);
+      cbit_ref    bref(buf, len);
+      TESTASSERT(arena_msg.unpack(bref) == SRSASN_SUCCESS);
+    }
+    cbit_ref bref(buf, len);
+    TESTASSERT(heap_msg.unpack(bref) == SRSASN_SUCCESS);
+    bit_ref heap_bref(heap_buf.data(), len), arena_bref(arena_buf.data(), len);
+    TESTASSERT(heap_msg.pack(heap_bref) == SRSASN_SUCCESS);
+    TESTASSERT(arena_msg.pack(arena_bref) == SRSASN_SUCCESS);
+    TESTASSERT(heap_buf == arena_buf);
+    msg_cpy = new Msg(arena_msg);
+  }
+  arena.reset();
+  bit_ref cpy_bref(arena_buf.data(), len);
+  TESTASSERT(msg_cpy->pack(cpy_bref) == SRSASN_SUCCESS);
+  TESTASSERT(heap_buf == arena_buf);
+  delete msg_cpy;
+
+  return SRSLTE_SUCCESS;
+}
+
+} // namespace asn1
+
+#endif // SRSLTE_ASN1_ARENA_TEST_COMMON_H
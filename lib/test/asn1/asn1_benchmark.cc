@@ -0,0 +1,242 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * ASN.1 PER packing/unpacking throughput. Runs the bit_ref primitives on their own (constant width fields, aligned and
+ * unaligned octet strings) and full RRC and S1AP messages from a corpus of captured PDUs, checking that repacking
+ * every message is stable.
+ */
+
+#include "srslte/asn1/rrc_asn1.h"
+#include "srslte/asn1/s1ap_asn1.h"
+#include "srslte/common/test_common.h"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace asn1;
+
+static uint32_t nof_iterations = 20000;
+
+typedef std::chrono::high_resolution_clock bench_clock;
+
+struct corpus_msg_t {
+  const char* name;
+  const char* hex;
+};
+
+static const corpus_msg_t rrc_dl_dcch_corpus[] = {
+    {"RRC DL-DCCH RRCConnectionReconfiguration",
+     "201615C8400003C2841810A804D79514A20102189A018014810ACB840800AD6DC40608AF6DC7A0C08200000C38602030C3000010044010C2"
+     "3C2A06203011102813DA4E96DA8083A100A48300327B0895AE0016A900E080848C82BBB1B4BA188336B7319818988336B1B19A1B1B0233B8"
+     "39398280857F8080AF037F7F7D7D7F7F2805FB327B08C00001F83E3CB1B200C030381FFA9C083EA25F1CE1D084"},
+    {"RRC DL-DCCH RRCConnectionReconfiguration r15",
+     "201695a8000005143a0002900878b0000046625a03593800000000083a100a48aa1a2780280002a782800002a783000002a78400000001c2"
+     "900e080848e0434b73a32b93732ba0336b73198181b0336b1b19a1a980233b8393982808c8005332f037f7f7d7d7f7f2f83027a12027a122"
+     "805fb2a7830400000f38900f78b962ca4f5380dfb9c0327002ea03a03b1793400f40010800d9809016cda8141a0020c8287000b001efb000"
+     "24a082120205024a04e3f0d00000"},
+};
+
+static const corpus_msg_t rrc_bcch_corpus[] = {
+    {"RRC BCCH-DL-SCH SIB1", "000149001250400800094000A03F01000A7FC9800104286C000C"},
+    {"RRC BCCH-DL-SCH SIB2", "00830992B7EC9300A3424B000C000500205D6AAAF04200C01DDC801C4880030010A713228500"},
+};
+
+static const corpus_msg_t s1ap_corpus[] = {
+    {"S1AP S1SetupRequest",
+     "0011002D000004003B00080009F107000019B0003C400A0380656E62303031396200400007000001C009F1070089400140"},
+    {"S1AP InitialContextSetupRequest",
+     "00090080c60000060000000200640008000200010042000a183b9aca00603b9aca000018007800003400734500093c0f800a0021f0b7361c"
+     "5664273e5b04b7020742023e060009f107000700375266c101091b0774657374313233066d6e63303730066d636339303104677072730501"
+     "c0a80302270e8080210a0300000a810608080808500bf609f107800101f67e72691309f10700012305f4f67e7269006b000518000c000000"
+     "4900204525e49a77c8d5cf263363eb5bb9c3439b9eb3861fa8a7cf435407ae422b63b9"},
+    {"S1AP UEContextReleaseRequest", "00124015000003000000020001000800020001000240020280"},
+    {"S1AP HandoverRequest",
+     "00010080E600000800000002006400010001000002400200000042000A183B9ACA00603B9ACA000035001900001B00144A1F0A0021F0B736"
+     "1C5600093C0000008F4001000068007574005F0A100C81A00000180002E87FE40000150000000591000002900978000000627C1F50298F00"
+     "E9CE021300009501004640000001901384001C006700A0518041400670DFBC44006B01400080020800C14CA2D54E2803517240E059140121"
+     "7B000009F1070019B0100009F1070019C02100001F006B000518000C000000280021108B0DABD7E59834B3EF6CC1AAA727FBF45308FF7494"
+     "7CA71BD9B437B902786212"},
+};
+
+static void usage(char* prog)
+{
+  printf("Usage: %s [n]\n", prog);
+  printf("\t-n Number of iterations [Default %d]\n", nof_iterations);
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int opt;
+  while ((opt = getopt(argc, argv, "n:")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_iterations = (uint32_t)strtol(optarg, NULL, 10);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+static std::vector<uint8_t> hex_to_bytes(const char* hex)
+{
+  std::vector<uint8_t> bytes;
+  std::string          s(hex);
+  for (size_t i = 0; i + 1 < s.size(); i += 2) {
+    bytes.push_back((uint8_t)strtoul(s.substr(i, 2).c_str(), NULL, 16));
+  }
+  return bytes;
+}
+
+static double ns_per_iteration(bench_clock::time_point start)
+{
+  return std::chrono::duration<double, std::nano>(bench_clock::now() - start).count() / nof_iterations;
+}
+
+int bench_primitives()
+{
+  const uint32_t       nof_fields = 1000;
+  uint8_t              widths[]   = {1, 1, 2, 3, 4, 5, 8, 11, 16, 27};
+  std::vector<uint8_t> buf(nof_fields * 4 + 16);
+  std::vector<uint8_t> octets(64);
+  std::vector<uint8_t> octets_rx(64);
+  for (uint32_t i = 0; i < octets.size(); i++) {
+    octets[i] = (uint8_t)(i * 37);
+  }
+
+  printf("bit_ref primitives\n");
+
+  // Constant width fields as emitted by the generated code, e.g. bref.pack(x, 4)
+  bench_clock::time_point start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    bit_ref bref(buf.data(), buf.size());
+    for (uint32_t i = 0; i < nof_fields; i++) {
+      HANDLE_CODE(bref.pack(i, widths[i % 10]));
+    }
+  }
+  printf("  %-32s %8.2f ns/field\n", "pack", ns_per_iteration(start) / nof_fields);
+
+  start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    cbit_ref bref(buf.data(), buf.size());
+    for (uint32_t i = 0; i < nof_fields; i++) {
+      uint32_t val;
+      HANDLE_CODE(bref.unpack(val, widths[i % 10]));
+      TESTASSERT(val == (i & ((1u << widths[i % 10]) - 1)));
+    }
+  }
+  printf("  %-32s %8.2f ns/field\n", "unpack", ns_per_iteration(start) / nof_fields);
+
+  // Octet strings starting at a byte boundary and 3 bits into a byte
+  for (uint32_t offset : {0, 3}) {
+    char name[64];
+    snprintf(name, sizeof(name), "pack_bytes %zd B, offset %d", octets.size(), offset);
+    start = bench_clock::now();
+    for (uint32_t n = 0; n < nof_iterations; n++) {
+      bit_ref bref(buf.data(), buf.size());
+      HANDLE_CODE(bref.pack(0, offset));
+      for (uint32_t i = 0; i < 8; i++) {
+        HANDLE_CODE(bref.pack_bytes(octets.data(), octets.size()));
+      }
+    }
+    printf("  %-32s %8.2f ns/string\n", name, ns_per_iteration(start) / 8);
+
+    snprintf(name, sizeof(name), "unpack_bytes %zd B, offset %d", octets.size(), offset);
+    start = bench_clock::now();
+    for (uint32_t n = 0; n < nof_iterations; n++) {
+      cbit_ref bref(buf.data(), buf.size());
+      HANDLE_CODE(bref.advance_bits(offset));
+      for (uint32_t i = 0; i < 8; i++) {
+        HANDLE_CODE(bref.unpack_bytes(octets_rx.data(), octets_rx.size()));
+      }
+    }
+    printf("  %-32s %8.2f ns/string\n", name, ns_per_iteration(start) / 8);
+    TESTASSERT(octets_rx == octets);
+  }
+  return SRSLTE_SUCCESS;
+}
+
+template <class Msg>
+int bench_msg(const corpus_msg_t& entry)
+{
+  std::vector<uint8_t> pdu = hex_to_bytes(entry.hex);
+  std::vector<uint8_t> buf(pdu.size() + 64);
+  Msg                  msg;
+  uint32_t             nof_bytes = 0;
+
+  bench_clock::time_point start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    cbit_ref bref(pdu.data(), pdu.size());
+    Msg      rx;
+    TESTASSERT(rx.unpack(bref) == SRSASN_SUCCESS);
+    if (n == 0) {
+      msg = rx;
+    }
+  }
+  double unpack_ns = ns_per_iteration(start);
+
+  start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    bit_ref bref(buf.data(), buf.size());
+    TESTASSERT(msg.pack(bref) == SRSASN_SUCCESS);
+    nof_bytes = bref.distance_bytes();
+  }
+  double pack_ns = ns_per_iteration(start);
+
+  // Repacking is stable: the packed PDU unpacks and packs again to the same bytes
+  std::vector<uint8_t> buf2(buf.size());
+  cbit_ref             bref_rx(buf.data(), nof_bytes);
+  bit_ref              bref_tx(buf2.data(), buf2.size());
+  Msg                  msg2;
+  TESTASSERT(msg2.unpack(bref_rx) == SRSASN_SUCCESS);
+  TESTASSERT(msg2.pack(bref_tx) == SRSASN_SUCCESS);
+  TESTASSERT((uint32_t)bref_tx.distance_bytes() == nof_bytes);
+  TESTASSERT(std::equal(buf.begin(), buf.begin() + nof_bytes, buf2.begin()));
+
+  printf("  %-48s %4zd B  unpack %8.0f ns  pack %8.0f ns\n", entry.name, pdu.size(), unpack_ns, pack_ns);
+  return SRSLTE_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  parse_args(argc, argv);
+  srslte::logmap::set_default_log_level(srslte::LOG_LEVEL_NONE);
+
+  TESTASSERT(bench_primitives() == SRSLTE_SUCCESS);
+
+  printf("Message corpus\n");
+  for (const corpus_msg_t& entry : rrc_dl_dcch_corpus) {
+    TESTASSERT(bench_msg<rrc::dl_dcch_msg_s>(entry) == SRSLTE_SUCCESS);
+  }
+  for (const corpus_msg_t& entry : rrc_bcch_corpus) {
+    TESTASSERT(bench_msg<rrc::bcch_dl_sch_msg_s>(entry) == SRSLTE_SUCCESS);
+  }
+  for (const corpus_msg_t& entry : s1ap_corpus) {
+    TESTASSERT(bench_msg<s1ap::s1ap_pdu_c>(entry) == SRSLTE_SUCCESS);
+  }
+
+  printf("Success\n");
+  return SRSLTE_SUCCESS;
+}
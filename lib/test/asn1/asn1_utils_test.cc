@@ -192,6 +192,128 @@ int test_bit_ref()
   return 0;
 }
 
+// Fields of random widths, packed word-at-a-time and, near the end of the buffer, bit-by-bit
+int test_bit_ref_fields()
+{
+  const uint32_t nof_bytes = 64;
+  uint8_t        buf[nof_bytes + 4], expected[nof_bytes + 4];
+
+  std::uniform_int_distribution<uint32_t> width_dist(1, 31);
+  for (uint32_t trial = 0; trial < 100; ++trial) {
+    std::vector<std::pair<uint32_t, uint32_t> > fields;
+    uint32_t                                    nof_bits = 0;
+    while (true) {
+      uint32_t n = width_dist(g);
+      if (nof_bits + n > 8 * nof_bytes - trial % 8) {
+        break;
+      }
+      fields.emplace_back(g() & ((1u << n) - 1u), n);
+      nof_bits += n;
+    }
+
+    // reference bitstream, written one bit at a time
+    memset(expected, 0xff, sizeof(expected));
+    memset(expected, 0, ceil_frac(nof_bits, 8u));
+    uint32_t pos = 0;
+    for (auto& f : fields) {
+      for (uint32_t i = 0; i < f.second; ++i, ++pos) {
+        expected[pos / 8] |= ((f.first >> (f.second - 1 - i)) & 1u) << (7 - pos % 8);
+      }
+    }
+
+    // bits after the last field are zeroed up to the byte boundary, bytes past it are untouched
+    memset(buf, 0xff, sizeof(buf));
+    bit_ref bref(&buf[0], nof_bytes);
+    for (auto& f : fields) {
+      TESTASSERT(bref.pack(f.first, f.second) == SRSASN_SUCCESS);
+    }
+    TESTASSERT(bref.distance() == (int)nof_bits);
+    TESTASSERT(memcmp(buf, expected, sizeof(buf)) == 0);
+
+    cbit_ref bref2(&buf[0], nof_bytes);
+    for (auto& f : fields) {
+      uint32_t val32;
+      uint16_t val16;
+      if (f.second <= 16 and f.first % 2 == 0) {
+        TESTASSERT(bref2.unpack(val16, f.second) == SRSASN_SUCCESS);
+        val32 = val16;
+      } else {
+        TESTASSERT(bref2.unpack(val32, f.second) == SRSASN_SUCCESS);
+      }
+      TESTASSERT(val32 == f.first);
+    }
+    TESTASSERT(bref2.distance() == (int)nof_bits);
+  }
+
+  // wide fields
+  {
+    bit_ref bref(&buf[0], nof_bytes);
+    TESTASSERT(bref.pack(1, 3) == SRSASN_SUCCESS);
+    TESTASSERT(bref.pack(0x12345678, 31) == SRSASN_SUCCESS);
+    TESTASSERT(bref.pack(0x7abcdef0, 31) == SRSASN_SUCCESS);
+    cbit_ref bref2(&buf[0], nof_bytes);
+    uint64_t val;
+    TESTASSERT(bref2.unpack(val, 3) == SRSASN_SUCCESS and val == 1);
+    TESTASSERT(bref2.unpack(val, 62) == SRSASN_SUCCESS);
+    TESTASSERT(val == ((uint64_t)0x12345678 << 31u | 0x7abcdef0));
+    uint8_t val8;
+    TESTASSERT(bref2.unpack(val8, 9) != SRSASN_SUCCESS);
+  }
+
+  // buffer limits
+  {
+    bit_ref bref(&buf[0], 2);
+    TESTASSERT(bref.pack(0x1ff, 9) == SRSASN_SUCCESS);
+    TESTASSERT(bref.pack(0x7f, 7) == SRSASN_SUCCESS);
+    TESTASSERT(bref.pack(0, 1) != SRSASN_SUCCESS);
+    cbit_ref bref2(&buf[0], 2);
+    uint32_t val;
+    TESTASSERT(bref2.unpack(val, 16) == SRSASN_SUCCESS and val == 0xffff);
+    TESTASSERT(bref2.unpack(val, 1) != SRSASN_SUCCESS);
+  }
+
+  return 0;
+}
+
+// Octet strings at every bit offset, up to the end of the buffer
+int test_bit_ref_bytes()
+{
+  uint8_t buf[40], octets[32], octets2[32];
+  for (uint32_t i = 0; i < sizeof(octets); ++i) {
+    octets[i] = g();
+  }
+
+  for (uint32_t offset = 0; offset < 8; ++offset) {
+    uint32_t nof_bytes = sizeof(octets) + (offset > 0 ? 1 : 0);
+    memset(buf, 0xff, sizeof(buf));
+    bit_ref bref(&buf[0], nof_bytes);
+    TESTASSERT(bref.pack(0, offset) == SRSASN_SUCCESS);
+    TESTASSERT(bref.pack_bytes(octets, sizeof(octets)) == SRSASN_SUCCESS);
+    TESTASSERT(bref.distance() == (int)(offset + 8 * sizeof(octets)));
+    TESTASSERT(bref.pack_bytes(octets, 1) != SRSASN_SUCCESS);
+    TESTASSERT(buf[nof_bytes] == 0xff);
+
+    // same bits as packing each octet as an 8 bit field
+    uint8_t expected[sizeof(buf)];
+    memset(expected, 0xff, sizeof(expected));
+    bit_ref bref_ref(&expected[0], nof_bytes);
+    TESTASSERT(bref_ref.pack(0, offset) == SRSASN_SUCCESS);
+    for (uint32_t i = 0; i < sizeof(octets); ++i) {
+      TESTASSERT(bref_ref.pack(octets[i], 8) == SRSASN_SUCCESS);
+    }
+    TESTASSERT(memcmp(buf, expected, sizeof(buf)) == 0);
+
+    cbit_ref bref2(&buf[0], nof_bytes);
+    uint32_t val;
+    TESTASSERT(bref2.unpack(val, offset) == SRSASN_SUCCESS);
+    TESTASSERT(bref2.unpack_bytes(octets2, sizeof(octets2)) == SRSASN_SUCCESS);
+    TESTASSERT(memcmp(octets, octets2, sizeof(octets)) == 0);
+    TESTASSERT(bref2.unpack_bytes(octets2, 1) != SRSASN_SUCCESS);
+  }
+
+  return 0;
+}
+
 int test_oct_string()
 {
   uint8_t  buf[1024];
@@ -524,6 +646,87 @@ int test_copy_ptr()
   return 0;
 }
 
+// Counts live instances, to check that the arena runs the destructors of the elements
+struct arena_test_elem {
+  static int nof_alive;
+  int        val = 0;
+  arena_test_elem() { nof_alive++; }
+  arena_test_elem(const arena_test_elem& other) : val(other.val) { nof_alive++; }
+  arena_test_elem& operator=(const arena_test_elem& other) = default;
+  ~arena_test_elem() { nof_alive--; }
+};
+int arena_test_elem::nof_alive = 0;
+
+int test_mem_arena()
+{
+  mem_arena arena;
+  TESTASSERT(arena.nof_bytes() == 0 and arena.nof_chunks() == 0);
+  TESTASSERT(current_arena() == nullptr);
+
+  {
+    dyn_array<dyn_array<arena_test_elem> > vec;
+    copy_ptr<fixed_octstring<10> >         cptr;
+    {
+      arena_scope scope(arena);
+      TESTASSERT(current_arena() == &arena);
+      vec.resize(4);
+      for (uint32_t i = 0; i < vec.size(); ++i) {
+        vec[i].resize(i + 1);
+        vec[i][i].val = i;
+      }
+      // growth abandons the old storage in the arena
+      dyn_array<arena_test_elem> elem(4);
+      elem[3].val = 3;
+      vec.push_back(elem);
+      cptr.set_present();
+      (*cptr)[0] = 5;
+    }
+    TESTASSERT(current_arena() == nullptr);
+    TESTASSERT(arena.nof_bytes() > 0 and arena.nof_chunks() == 1);
+    TESTASSERT(arena_test_elem::nof_alive == 14);
+    TESTASSERT(vec[4][3].val == 3);
+
+    // copies outside of the scope go to the heap
+    size_t                                 nof_bytes = arena.nof_bytes();
+    dyn_array<dyn_array<arena_test_elem> > vec2      = vec;
+    copy_ptr<fixed_octstring<10> >         cptr2     = cptr;
+    TESTASSERT(arena.nof_bytes() == nof_bytes);
+    TESTASSERT(vec2[4][3].val == 3 and (*cptr2)[0] == 5);
+    TESTASSERT(arena_test_elem::nof_alive == 28);
+
+    // release() hands over a heap copy
+    fixed_octstring<10>* released = cptr.release();
+    TESTASSERT((*released)[0] == 5);
+    delete released;
+  }
+  TESTASSERT(arena_test_elem::nof_alive == 0);
+
+  // allocations spanning several chunks are merged into one chunk on reset
+  mem_arena small_arena(256);
+  {
+    arena_scope        scope(small_arena);
+    dyn_array<uint8_t> small(100), big(1000);
+    TESTASSERT(small_arena.nof_chunks() == 2 and small_arena.nof_bytes() == 1100);
+  }
+  small_arena.reset();
+  TESTASSERT(small_arena.nof_chunks() == 1 and small_arena.nof_bytes() == 0);
+  {
+    arena_scope        scope(small_arena);
+    dyn_array<uint8_t> small(100), big(1000);
+    TESTASSERT(small_arena.nof_chunks() == 1);
+    // nested scopes
+    mem_arena arena2;
+    {
+      arena_scope scope2(arena2);
+      dyn_array<uint8_t> vec(10);
+      TESTASSERT(arena2.nof_bytes() == 10);
+    }
+    TESTASSERT(current_arena() == &small_arena);
+  }
+
+  return 0;
+}
+
 class EnumTest
 {
 public:
@@ -635,10 +838,13 @@ int main()
   srslte::logmap::set_default_log_level(srslte::LOG_LEVEL_DEBUG);
   TESTASSERT(test_arrays() == 0);
   TESTASSERT(test_bit_ref() == 0);
+  TESTASSERT(test_bit_ref_fields() == 0);
+  TESTASSERT(test_bit_ref_bytes() == 0);
   TESTASSERT(test_oct_string() == 0);
   TESTASSERT(test_bitstring() == 0);
   TESTASSERT(test_seq_of() == 0);
   TESTASSERT(test_copy_ptr() == 0);
+  TESTASSERT(test_mem_arena() == 0);
   TESTASSERT(test_enum() == 0);
   //  TESTASSERT(test_json_writer()==0);
   printf("Success\n");
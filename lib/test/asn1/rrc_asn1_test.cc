@@ -19,6 +19,7 @@
  *
  */
 
+#include "asn1_arena_test_common.h"
 #include "srslte/asn1/rrc_asn1.h"
 #include "srslte/common/test_common.h"
 #include <cstdio>
@@ -591,6 +592,8 @@ int test_rrc_conn_reconf_r15_2()
   TESTASSERT(recfg_msg.unpack(bref) == SRSASN_SUCCESS);
 
   TESTASSERT(test_pack_unpack_consistency(recfg_msg) == SRSASN_SUCCESS);
+  TESTASSERT(test_arena_unpack<dl_dcch_msg_s>("RRCConnectionReconfiguration", rrc_msg, sizeof(rrc_msg)) ==
+             SRSLTE_SUCCESS);
 
   return SRSASN_SUCCESS;
 }
@@ -19,6 +19,7 @@
  *
  */
 
+#include "asn1_arena_test_common.h"
 #include "srslte/asn1/s1ap_asn1.h"
 #include "srslte/common/test_common.h"
 
@@ -90,6 +91,8 @@ int test_init_ctxt_setup_req()
   TESTASSERT(ctxt_setup.ue_security_cap.value.integrity_protection_algorithms.to_string() == "1100000000000000");
 
   TESTASSERT(test_pack_unpack_consistency(pdu) == SRSASN_SUCCESS);
+  TESTASSERT(test_arena_unpack<s1ap_pdu_c>("InitialContextSetupRequest", s1ap_msg, sizeof(s1ap_msg)) ==
+             SRSLTE_SUCCESS);
 
   return SRSLTE_SUCCESS;
 }
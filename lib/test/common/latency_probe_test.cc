@@ -0,0 +1,157 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srslte/common/latency_probe.h"
+#include "srslte/common/test_common.h"
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using srslte::hdr_histogram;
+using srslte::latency_probes;
+using srslte::probe_point;
+
+int test_hdr_histogram()
+{
+  std::unique_ptr<hdr_histogram> h(new hdr_histogram);
+
+  // Small values are stored exactly
+  for (uint64_t v = 0; v < hdr_histogram::SUB_BUCKETS; v++) {
+    TESTASSERT(hdr_histogram::bucket_lower_bound(hdr_histogram::bucket_idx(v)) == v);
+  }
+
+  // Any value falls in a bucket within the histogram precision
+  for (uint64_t v = 1; v < (1ul << 40); v = v * 3 + 1) {
+    uint32_t idx = hdr_histogram::bucket_idx(v);
+    uint64_t lo  = hdr_histogram::bucket_lower_bound(idx);
+    uint64_t hi  = hdr_histogram::bucket_lower_bound(idx + 1);
+    TESTASSERT(lo <= v && v < hi);
+    TESTASSERT(hi - lo <= std::max<uint64_t>(1, lo / (hdr_histogram::SUB_BUCKETS / 2)));
+  }
+
+  // Uniform 1..100000 ns
+  for (uint64_t v = 1; v <= 100000; v++) {
+    h->record(v);
+  }
+  TESTASSERT(h->count() == 100000);
+  TESTASSERT(h->max_value() == 100000);
+  TESTASSERT(std::abs(h->mean() - 50000.5) < 1e-6);
+  TESTASSERT(std::abs((double)h->percentile(0.5) - 50000) < 50000 / 16.0);
+  TESTASSERT(std::abs((double)h->percentile(0.99) - 99000) < 99000 / 16.0);
+  TESTASSERT(h->percentile(1.0) <= 100000);
+
+  // Merging keeps all the samples
+  std::unique_ptr<hdr_histogram> m(new hdr_histogram);
+  m->record(1000000);
+  m->merge(*h);
+  TESTASSERT(m->count() == 100001);
+  TESTASSERT(m->max_value() == 1000000);
+  TESTASSERT(m->percentile(0.5) == h->percentile(0.5));
+
+  h->reset();
+  TESTASSERT(h->count() == 0 and h->percentile(0.5) == 0);
+
+  return SRSLTE_SUCCESS;
+}
+
+int test_probes_multithread()
+{
+  const uint32_t nof_threads = 4;
+  const uint32_t nof_samples = 1000;
+
+  srslte::latency_probe_stats_list_t before;
+  latency_probes::get_stats(before);
+
+  // Disabled probes do not record
+  {
+    srslte::scoped_latency_probe probe(probe_point::sched_dl);
+  }
+  latency_probes::set_enabled(true);
+
+  std::vector<std::thread> threads;
+  for (uint32_t i = 0; i < nof_threads; i++) {
+    threads.emplace_back([nof_samples]() {
+      for (uint32_t n = 0; n < nof_samples; n++) {
+        srslte::scoped_latency_probe probe(probe_point::sched_dl);
+        std::this_thread::sleep_for(std::chrono::microseconds(10));
+      }
+    });
+  }
+  for (std::thread& t : threads) {
+    t.join();
+  }
+
+  srslte::latency_probe_stats_list_t stats;
+  latency_probes::get_stats(stats);
+  const srslte::latency_probe_stats_t& s = stats[(uint32_t)probe_point::sched_dl];
+  TESTASSERT(s.count == before[(uint32_t)probe_point::sched_dl].count + nof_threads * nof_samples);
+  TESTASSERT(s.p50_us >= 10.0);
+  TESTASSERT(s.p50_us <= s.p99_us and s.p99_us <= s.p999_us and s.p999_us <= s.max_us);
+  TESTASSERT(stats[(uint32_t)probe_point::radio_tx].count == before[(uint32_t)probe_point::radio_tx].count);
+
+  latency_probes::dump(stdout);
+
+  return SRSLTE_SUCCESS;
+}
+
+int test_probe_overhead()
+{
+  const uint32_t nof_batches = 10;
+  const uint32_t nof_iter    = 100000;
+  latency_probes::set_enabled(true);
+
+  srslte::latency_probe_stats_list_t before;
+  latency_probes::get_stats(before);
+
+  // The best batch is taken, so that the test being preempted does not count as probe overhead
+  double ns = std::numeric_limits<double>::max();
+  for (uint32_t b = 0; b < nof_batches; b++) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t n = 0; n < nof_iter; n++) {
+      srslte::scoped_latency_probe probe(probe_point::radio_tx);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    ns      = std::min(ns, std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / (double)nof_iter);
+  }
+  printf("Enabled probe overhead: %.1f ns\n", ns);
+
+  srslte::latency_probe_stats_list_t stats;
+  latency_probes::get_stats(stats);
+  TESTASSERT(stats[(uint32_t)probe_point::radio_tx].count ==
+             before[(uint32_t)probe_point::radio_tx].count + nof_batches * nof_iter);
+
+  // Ten probes per TTI must stay below 1% of 1 ms, i.e. 1 us per probe. The bound is the budget, not the expected
+  // cost, which is in the order of tens of ns
+  TESTASSERT(ns < 1000.0);
+
+  latency_probes::set_enabled(false);
+  return SRSLTE_SUCCESS;
+}
+
+int main()
+{
+  TESTASSERT(test_hdr_histogram() == SRSLTE_SUCCESS);
+  TESTASSERT(test_probes_multithread() == SRSLTE_SUCCESS);
+  TESTASSERT(test_probe_overhead() == SRSLTE_SUCCESS);
+  printf("Success\n");
+  return SRSLTE_SUCCESS;
+}
@@ -151,6 +151,48 @@ int basic_hex_test()
   return SRSLTE_SUCCESS;
 }
 
+int long_msg_test()
+{
+  std::string          filename = "log_filter_long_msg_test.log";
+  srslog::sink*        s        = srslog::create_file_sink(filename);
+  srslog::log_channel* chan     = srslog::create_log_channel("long_msg_test", *s);
+  TESTASSERT(s != nullptr and chan != nullptr);
+  srslte::srslog_wrapper l(*chan);
+
+  log_filter filter("layer", &l);
+  filter.set_level(LOG_LEVEL_DEBUG);
+
+  // The backend must be running for the flush below to write the file.
+  srslog::init();
+
+  // Legacy messages reach srslog as a single preformatted string, which must not be cut at the inline storage size
+  std::string msg;
+  for (uint32_t i = 0; msg.size() < 4 * 1024; i++) {
+    msg += std::to_string(i) + " ";
+  }
+  msg += "END";
+  filter.info_long("%s", msg.c_str());
+  filter.info("This is a message after the long msg\n");
+  srslog::flush();
+
+  FILE* f = fopen(filename.c_str(), "r");
+  TESTASSERT(f != nullptr);
+  std::string contents;
+  char        buf[1024];
+  size_t      n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+    contents.append(buf, n);
+  }
+  fclose(f);
+  remove(filename.c_str());
+
+  TESTASSERT(contents.find(msg + "\n") != std::string::npos);
+  TESTASSERT(contents.find("[truncated]") == std::string::npos);
+  TESTASSERT(contents.find("This is a message after the long msg") != std::string::npos);
+
+  return SRSLTE_SUCCESS;
+}
+
 int test_log_singleton()
 {
   srslte::logmap::set_default_log_level(LOG_LEVEL_DEBUG);
@@ -220,6 +262,7 @@ int main(int argc, char** argv)
   }
 
   TESTASSERT(basic_hex_test() == SRSLTE_SUCCESS);
+  TESTASSERT(long_msg_test() == SRSLTE_SUCCESS);
   TESTASSERT(full_test() == SRSLTE_SUCCESS);
   TESTASSERT(test_log_singleton() == SRSLTE_SUCCESS);
   TESTASSERT(test_log_ref() == SRSLTE_SUCCESS);
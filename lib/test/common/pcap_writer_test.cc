@@ -0,0 +1,223 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srslte/common/mac_pcap.h"
+#include "srslte/common/pcap_writer.h"
+#include "srslte/common/test_common.h"
+#include <atomic>
+#include <thread>
+#include <unistd.h>
+
+using namespace srslte;
+
+// Reads back a capture file, checking the file header and that every record carries the expected payload pattern
+static int read_pcap_file(const std::string& filename, uint32_t dlt, uint32_t* nof_records)
+{
+  FILE* f = fopen(filename.c_str(), "r");
+  TESTASSERT(f != nullptr);
+
+  pcap_hdr_t file_header;
+  TESTASSERT(fread(&file_header, sizeof(file_header), 1, f) == 1);
+  TESTASSERT(file_header.magic_number == 0xa1b2c3d4);
+  TESTASSERT(file_header.network == dlt);
+
+  pcaprec_hdr_t packet_header;
+  uint8_t       payload[2048];
+  *nof_records = 0;
+  while (fread(&packet_header, sizeof(packet_header), 1, f) == 1) {
+    TESTASSERT(packet_header.incl_len == packet_header.orig_len);
+    TESTASSERT(packet_header.incl_len <= sizeof(payload));
+    TESTASSERT(fread(payload, 1, packet_header.incl_len, f) == packet_header.incl_len);
+    // The first byte is the record length modulo 256, the rest is a counter starting there
+    for (uint32_t i = 0; i < packet_header.incl_len; i++) {
+      TESTASSERT(payload[i] == (uint8_t)(packet_header.incl_len + i));
+    }
+    (*nof_records)++;
+  }
+  fclose(f);
+  return SRSLTE_SUCCESS;
+}
+
+static void fill_pattern(uint8_t* buf, uint32_t len)
+{
+  for (uint32_t i = 0; i < len; i++) {
+    buf[i] = (uint8_t)(len + i);
+  }
+}
+
+int test_concurrent_producers()
+{
+  const uint32_t     nof_threads = 4, nof_records = 20000;
+  const std::string  filename = "pcap_writer_test.pcap";
+  pcap_writer        writer;
+  pcap_writer_args_t args;
+  args.ring_size_kb = 16384;
+  TESTASSERT(writer.open(filename, UDP_DLT, args));
+
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < nof_threads; t++) {
+    threads.emplace_back([&writer, t, nof_records]() {
+      uint8_t pdu[1024];
+      for (uint32_t i = 0; i < nof_records; i++) {
+        uint32_t len = 1 + (i * 7 + t * 13) % sizeof(pdu);
+        fill_pattern(pdu, len);
+        // Split records into a context and a PDU part, as the protocol captures do
+        uint32_t context_len = len / 4;
+        writer.write(pdu, context_len, pdu + context_len, len - context_len);
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  writer.close();
+
+  pcap_writer_stats_t stats = writer.get_stats();
+  uint32_t            nof_read;
+  TESTASSERT(read_pcap_file(filename, UDP_DLT, &nof_read) == SRSLTE_SUCCESS);
+  TESTASSERT(stats.nof_records + stats.nof_dropped == nof_threads * nof_records);
+  TESTASSERT(stats.nof_records == nof_read);
+  TESTASSERT(stats.nof_write_errors == 0);
+  TESTASSERT(stats.nof_files == 1);
+  unlink(filename.c_str());
+  return SRSLTE_SUCCESS;
+}
+
+/// Writer whose thread does not start draining the ring until released
+class stalled_pcap_writer : public pcap_writer
+{
+public:
+  std::atomic<bool> stalled{true};
+
+private:
+  void run_thread() override
+  {
+    while (stalled.load()) {
+      usleep(1000);
+    }
+    pcap_writer::run_thread();
+  }
+};
+
+int test_overflow()
+{
+  const std::string   filename = "pcap_writer_test.pcap";
+  stalled_pcap_writer writer;
+  pcap_writer_args_t  args;
+  args.ring_size_kb = 64;
+  TESTASSERT(writer.open(filename, UDP_DLT, args));
+
+  // Each record takes 8 (ring header) + 16 (PCAP header) + 1000 bytes, so exactly 64 fit in the undrained ring
+  const uint32_t nof_fit = 64;
+  uint8_t        pdu[1000];
+  fill_pattern(pdu, sizeof(pdu));
+  for (uint32_t i = 0; i < 1000; i++) {
+    TESTASSERT(writer.write(nullptr, 0, pdu, sizeof(pdu)) == (i < nof_fit));
+  }
+  TESTASSERT(writer.get_stats().nof_dropped == 1000 - nof_fit);
+
+  writer.stalled = false;
+  writer.close();
+  TESTASSERT(not writer.write(nullptr, 0, pdu, sizeof(pdu)));
+
+  pcap_writer_stats_t stats = writer.get_stats();
+  uint32_t            nof_read;
+  TESTASSERT(read_pcap_file(filename, UDP_DLT, &nof_read) == SRSLTE_SUCCESS);
+  TESTASSERT(stats.nof_records == nof_fit and nof_read == nof_fit);
+  TESTASSERT(stats.nof_dropped == 1000 - nof_fit + 1);
+  unlink(filename.c_str());
+  return SRSLTE_SUCCESS;
+}
+
+int test_rotation()
+{
+  const uint32_t     nof_records = 3000;
+  pcap_writer        writer;
+  pcap_writer_args_t args;
+  args.max_file_size_mb = 1;
+  TESTASSERT(writer.open("pcap_writer_test.pcap", MAC_LTE_DLT, args));
+
+  uint8_t pdu[1000];
+  fill_pattern(pdu, sizeof(pdu));
+  for (uint32_t i = 0; i < nof_records; i++) {
+    while (not writer.write(nullptr, 0, pdu, sizeof(pdu))) {
+      usleep(100);
+    }
+  }
+  writer.close();
+
+  // ~3 MB of records give three files, each one a valid capture below the size limit
+  pcap_writer_stats_t stats = writer.get_stats();
+  TESTASSERT(stats.nof_files == 3);
+  TESTASSERT(stats.nof_records == nof_records);
+  const char* names[]   = {"pcap_writer_test.pcap", "pcap_writer_test_1.pcap", "pcap_writer_test_2.pcap"};
+  uint32_t    total     = 0;
+  for (const char* name : names) {
+    uint32_t nof_read;
+    TESTASSERT(read_pcap_file(name, MAC_LTE_DLT, &nof_read) == SRSLTE_SUCCESS);
+    FILE* f = fopen(name, "r");
+    fseek(f, 0, SEEK_END);
+    TESTASSERT(ftell(f) <= 1024 * 1024);
+    fclose(f);
+    total += nof_read;
+    unlink(name);
+  }
+  TESTASSERT(total == nof_records);
+  return SRSLTE_SUCCESS;
+}
+
+int test_filter()
+{
+  pcap_filter filter;
+  TESTASSERT(filter.match_rnti(0x46) and filter.match_lcid(3));
+  TESTASSERT(not filter.set_rntis("0x46,abc"));
+  TESTASSERT(not filter.set_rntis("70000"));
+  TESTASSERT(filter.set_rntis(" 0x46, 71 "));
+  TESTASSERT(filter.match_rnti(0x46) and filter.match_rnti(71) and not filter.match_rnti(0x48));
+  TESTASSERT(filter.set_lcids("3"));
+  TESTASSERT(filter.match_lcid(3) and not filter.match_lcid(4) and not filter.match_lcid(100));
+
+  // Filtered C-RNTI PDUs are not copied, broadcast PDUs are always captured
+  filter.set_rntis(std::vector<uint16_t>{0x46});
+  mac_pcap pcap;
+  pcap.set_filter(filter);
+  pcap.open("pcap_writer_test.pcap");
+  uint8_t pdu[100] = {};
+  pcap.write_dl_crnti(pdu, sizeof(pdu), 0x46, true, 0, 0);
+  pcap.write_dl_crnti(pdu, sizeof(pdu), 0x47, true, 1, 0);
+  pcap.write_ul_crnti(pdu, sizeof(pdu), 0x47, 0, 2, 0);
+  pcap.write_dl_sirnti(pdu, sizeof(pdu), true, 3, 0);
+  pcap.close();
+  pcap_writer_stats_t stats = pcap.get_stats();
+  TESTASSERT(stats.nof_records == 2);
+  TESTASSERT(stats.nof_filtered == 2);
+  unlink("pcap_writer_test.pcap");
+  return SRSLTE_SUCCESS;
+}
+
+int main()
+{
+  TESTASSERT(test_concurrent_producers() == SRSLTE_SUCCESS);
+  TESTASSERT(test_overflow() == SRSLTE_SUCCESS);
+  TESTASSERT(test_rotation() == SRSLTE_SUCCESS);
+  TESTASSERT(test_filter() == SRSLTE_SUCCESS);
+  return SRSLTE_SUCCESS;
+}
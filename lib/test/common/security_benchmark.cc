@@ -0,0 +1,251 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * Throughput of the user plane ciphering and integrity algorithms for typical PDCP SDU sizes. For EEA2/EIA2 it
+ * compares the per-PDU API that expands the AES key on each call with the precomputed key context, one PDU and a
+ * batch of PDUs per call. SNOW 3G (EEA1/EIA1) and ZUC (EEA3/EIA3) are keyed per PDU by design. Milenage f1-f5 is
+ * compared between the per-function API and the batched API with a key context per subscriber.
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+#include "srslte/common/security.h"
+#include "srslte/common/test_common.h"
+
+#define BATCH_SIZE 32
+
+static uint32_t nof_iterations = 2000;
+
+typedef std::chrono::high_resolution_clock bench_clock;
+
+static void usage(char* prog)
+{
+  printf("Usage: %s [n]\n", prog);
+  printf("\t-n Number of iterations [Default %d]\n", nof_iterations);
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int opt;
+  while ((opt = getopt(argc, argv, "n:")) != -1) {
+    switch (opt) {
+      case 'n':
+        nof_iterations = (uint32_t)strtol(optarg, NULL, 10);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+static void print_rate(const char* name, uint32_t pdu_len, bench_clock::time_point start)
+{
+  double secs  = std::chrono::duration<double>(bench_clock::now() - start).count();
+  double nof_b = (double)nof_iterations * BATCH_SIZE * pdu_len;
+  printf("  %-24s %8.1f Mbps %8.1f ns/PDU\n",
+         name,
+         nof_b * 8 / secs / 1e6,
+         secs * 1e9 / ((double)nof_iterations * BATCH_SIZE));
+}
+
+int bench_pdu_size(uint32_t pdu_len)
+{
+  uint8_t  key[]     = {0xd3, 0xc5, 0xd5, 0x92, 0x32, 0x7f, 0xb1, 0x1c, 0x40, 0x35, 0xc6, 0x68, 0x0a, 0xf8, 0xc6, 0xd1};
+  uint8_t  bearer    = 0x15;
+  uint8_t  direction = 1;
+
+  std::vector<uint8_t> msg(BATCH_SIZE * pdu_len);
+  std::vector<uint8_t> ct(BATCH_SIZE * pdu_len);
+  std::vector<uint8_t> ct_ref(BATCH_SIZE * pdu_len);
+  uint8_t              mac[BATCH_SIZE][4];
+  uint8_t              mac_ref[BATCH_SIZE][4];
+  for (uint32_t i = 0; i < msg.size(); i++) {
+    msg[i] = (uint8_t)rand();
+  }
+
+  srslte::aes128_key_ctx_t ctx;
+  srslte::aes128_set_key(&ctx, key);
+
+  srslte::security_pdu_t enc_pdus[BATCH_SIZE];
+  srslte::security_pdu_t int_pdus[BATCH_SIZE];
+  for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+    enc_pdus[i] = {&msg[i * pdu_len], pdu_len, i, &ct[i * pdu_len]};
+    int_pdus[i] = {&msg[i * pdu_len], pdu_len, i, mac[i]};
+  }
+
+  printf("PDU size %d bytes, %s\n", pdu_len, srslte::aes128_impl_name());
+
+  // EEA2
+  bench_clock::time_point start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+      srslte::security_128_eea2(key, i, bearer, direction, &msg[i * pdu_len], pdu_len, &ct_ref[i * pdu_len]);
+    }
+  }
+  print_rate("EEA2 key per PDU", pdu_len, start);
+
+  start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+      srslte::security_128_eea2(&ctx, i, bearer, direction, &msg[i * pdu_len], pdu_len, &ct[i * pdu_len]);
+    }
+  }
+  print_rate("EEA2 key context", pdu_len, start);
+  TESTASSERT(ct == ct_ref);
+
+  start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    srslte::security_128_eea2_batch(&ctx, bearer, direction, enc_pdus, BATCH_SIZE);
+  }
+  print_rate("EEA2 batch", pdu_len, start);
+  TESTASSERT(ct == ct_ref);
+
+  // EIA2
+  start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+      srslte::security_128_eia2(key, i, bearer, direction, &msg[i * pdu_len], pdu_len, mac_ref[i]);
+    }
+  }
+  print_rate("EIA2 key per PDU", pdu_len, start);
+
+  start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+      srslte::security_128_eia2(&ctx, i, bearer, direction, &msg[i * pdu_len], pdu_len, mac[i]);
+    }
+  }
+  print_rate("EIA2 key context", pdu_len, start);
+  TESTASSERT(memcmp(mac, mac_ref, sizeof(mac)) == 0);
+
+  start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    srslte::security_128_eia2_batch(&ctx, bearer, direction, int_pdus, BATCH_SIZE);
+  }
+  print_rate("EIA2 batch", pdu_len, start);
+  TESTASSERT(memcmp(mac, mac_ref, sizeof(mac)) == 0);
+
+  // EEA1/EIA1 and EEA3/EIA3
+  start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+      srslte::security_128_eea1(key, i, bearer, direction, &msg[i * pdu_len], pdu_len, &ct[i * pdu_len]);
+    }
+  }
+  print_rate("EEA1", pdu_len, start);
+
+  start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+      srslte::security_128_eia1(key, i, bearer, direction, &msg[i * pdu_len], pdu_len, mac[i]);
+    }
+  }
+  print_rate("EIA1", pdu_len, start);
+
+  start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+      srslte::security_128_eea3(key, i, bearer, direction, &msg[i * pdu_len], pdu_len, &ct[i * pdu_len]);
+    }
+  }
+  print_rate("EEA3", pdu_len, start);
+
+  start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+      srslte::security_128_eia3(key, i, bearer, direction, &msg[i * pdu_len], pdu_len, mac[i]);
+    }
+  }
+  print_rate("EIA3", pdu_len, start);
+
+  return SRSLTE_SUCCESS;
+}
+
+int bench_milenage()
+{
+  const uint32_t nof_subscribers = 4;
+  uint8_t        k[nof_subscribers][16];
+  uint8_t        opc[nof_subscribers][16];
+  for (uint32_t n = 0; n < nof_subscribers; n++) {
+    for (uint32_t i = 0; i < 16; i++) {
+      k[n][i]   = (uint8_t)rand();
+      opc[n][i] = (uint8_t)rand();
+    }
+  }
+
+  srslte::milenage_ctx_t    ctx[nof_subscribers];
+  srslte::milenage_vector_t v[BATCH_SIZE] = {};
+  for (uint32_t n = 0; n < nof_subscribers; n++) {
+    srslte::security_milenage_init(&ctx[n], k[n], opc[n]);
+  }
+  for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+    v[i].ctx = &ctx[i % nof_subscribers];
+    for (uint32_t j = 0; j < 16; j++) {
+      v[i].rand[j] = (uint8_t)rand();
+    }
+  }
+
+  printf("Milenage f1-f5, %d subscribers per batch\n", nof_subscribers);
+
+  uint8_t                 mac[8], res[8], ck[16], ik[16], ak[6];
+  bench_clock::time_point start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    for (uint32_t i = 0; i < BATCH_SIZE; i++) {
+      uint32_t s = i % nof_subscribers;
+      srslte::security_milenage_f1(k[s], opc[s], v[i].rand, v[i].sqn, v[i].amf, mac);
+      srslte::security_milenage_f2345(k[s], opc[s], v[i].rand, res, ck, ik, ak);
+    }
+  }
+  double secs = std::chrono::duration<double>(bench_clock::now() - start).count();
+  printf("  %-24s %8.2f us/vector\n", "Per function", secs * 1e6 / ((double)nof_iterations * BATCH_SIZE));
+
+  start = bench_clock::now();
+  for (uint32_t n = 0; n < nof_iterations; n++) {
+    srslte::security_milenage_f12345_batch(v, BATCH_SIZE);
+  }
+  secs = std::chrono::duration<double>(bench_clock::now() - start).count();
+  printf("  %-24s %8.2f us/vector\n", "Batch", secs * 1e6 / ((double)nof_iterations * BATCH_SIZE));
+
+  // Last vector was computed by both
+  TESTASSERT(memcmp(mac, v[BATCH_SIZE - 1].mac_a, sizeof(mac)) == 0);
+  TESTASSERT(memcmp(res, v[BATCH_SIZE - 1].res, sizeof(res)) == 0);
+  TESTASSERT(memcmp(ck, v[BATCH_SIZE - 1].ck, sizeof(ck)) == 0);
+
+  return SRSLTE_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  parse_args(argc, argv);
+
+  uint32_t pdu_sizes[] = {40, 100, 500, 1500};
+  for (uint32_t pdu_len : pdu_sizes) {
+    TESTASSERT(bench_pdu_size(pdu_len) == SRSLTE_SUCCESS);
+  }
+  TESTASSERT(bench_milenage() == SRSLTE_SUCCESS);
+  return SRSLTE_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "srslte/common/liblte_security.h"
+#include "srslte/common/security.h"
+#include "srslte/srslte.h"
+
+/*
+ * Tests
+ *
+ * Document Reference: 33.401 V13.1.0 Annex C.2
+ *
+ */
+
+void test_set_2()
+{
+  uint8_t  key[]     = {0xd3, 0xc5, 0xd5, 0x92, 0x32, 0x7f, 0xb1, 0x1c, 0x40, 0x35, 0xc6, 0x68, 0x0a, 0xf8, 0xc6, 0xd1};
+  uint32_t count     = 0x398a59b4;
+  uint8_t  bearer    = 0x1a;
+  uint8_t  direction = 1;
+  uint32_t len_bits = 64, len_bytes = (len_bits + 7) / 8;
+  uint8_t  msg[] = {0x48, 0x45, 0x83, 0xd5, 0xaf, 0xe0, 0x82, 0xae};
+  uint8_t  mt[]  = {0xb9, 0x37, 0x87, 0xe6};
+
+  uint8_t mac[4];
+
+  // gen mac with the raw key
+  assert(liblte_security_128_eia2(key, count, bearer, direction, msg, len_bytes, mac) == LIBLTE_SUCCESS);
+  for (int i = 0; i < 4; i++) {
+    assert(mac[i] == mt[i]);
+  }
+
+  // gen mac with a precomputed key context
+  srslte::aes128_key_ctx_t ctx;
+  srslte::aes128_set_key(&ctx, key);
+  assert(srslte::security_128_eia2(&ctx, count, bearer, direction, msg, len_bytes, mac) == SRSLTE_SUCCESS);
+  for (int i = 0; i < 4; i++) {
+    assert(mac[i] == mt[i]);
+  }
+}
+
+// Message not aligned to the AES block size, so the last CMAC block is padded (subkey K2)
+void test_set_2_padded()
+{
+  uint8_t  key[]     = {0xd3, 0xc5, 0xd5, 0x92, 0x32, 0x7f, 0xb1, 0x1c, 0x40, 0x35, 0xc6, 0x68, 0x0a, 0xf8, 0xc6, 0xd1};
+  uint32_t count     = 0x398a59b4;
+  uint8_t  bearer    = 0x1a;
+  uint8_t  direction = 1;
+  uint32_t len_bits = 256, len_bytes = (len_bits + 7) / 8;
+  uint8_t  msg[] = {0x98, 0x1b, 0xa6, 0x82, 0x4c, 0x1b, 0xfb, 0x1a, 0xb4, 0x85, 0x47, 0x20, 0x29, 0xb7, 0x1d, 0x80,
+                   0x8c, 0xe3, 0x3e, 0x2c, 0xc3, 0xc0, 0xb5, 0xfc, 0x1f, 0x3d, 0xe8, 0xa6, 0xdc, 0x66, 0xb1, 0xf0};
+  uint8_t  mt[]  = {0x9d, 0x6d, 0xb7, 0x9e};
+
+  uint8_t mac[4];
+
+  assert(liblte_security_128_eia2(key, count, bearer, direction, msg, len_bytes, mac) == LIBLTE_SUCCESS);
+  for (int i = 0; i < 4; i++) {
+    assert(mac[i] == mt[i]);
+  }
+}
+
+// Batched MAC generation over PDUs of different length must match the per-PDU result
+void test_batch()
+{
+  uint8_t  key[]     = {0x2b, 0xd6, 0x45, 0x9f, 0x82, 0xc5, 0xb3, 0x00, 0x95, 0x2c, 0x49, 0x10, 0x48, 0x81, 0xff, 0x48};
+  uint8_t  bearer    = 0x18;
+  uint8_t  direction = 0;
+  uint32_t nof_pdus  = 21;
+  uint8_t  msg[1500];
+  uint8_t  mac[21][4];
+  uint8_t  mac_exp[4];
+
+  for (uint32_t i = 0; i < sizeof(msg); i++) {
+    msg[i] = (uint8_t)(i * 7 + 3);
+  }
+
+  srslte::aes128_key_ctx_t ctx;
+  srslte::aes128_set_key(&ctx, key);
+
+  srslte::security_pdu_t pdus[21];
+  for (uint32_t i = 0; i < nof_pdus; i++) {
+    pdus[i].msg     = msg;
+    pdus[i].msg_len = (i * 71) % sizeof(msg);
+    pdus[i].count   = 0x1000 + i;
+    pdus[i].out     = mac[i];
+  }
+  assert(srslte::security_128_eia2_batch(&ctx, bearer, direction, pdus, nof_pdus) == SRSLTE_SUCCESS);
+
+  for (uint32_t i = 0; i < nof_pdus; i++) {
+    srslte::security_128_eia2(key, pdus[i].count, bearer, direction, msg, pdus[i].msg_len, mac_exp);
+    for (int j = 0; j < 4; j++) {
+      assert(mac[i][j] == mac_exp[j]);
+    }
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  test_set_2();
+  test_set_2_padded();
+  test_batch();
+}
@@ -24,6 +24,7 @@
 #include <stdlib.h>
 
 #include "srslte/common/liblte_security.h"
+#include "srslte/common/security.h"
 
 /*
  * Prototypes
@@ -162,6 +163,83 @@ void test_set_2()
   return;
 }
 
+/*
+  Batched f1-f5 against test set 2 and against the single vector functions, with the vectors of several keys
+  interleaved in one batch
+*/
+
+void test_batch()
+{
+  uint8_t k[]    = {0x46, 0x5b, 0x5c, 0xe8, 0xb1, 0x99, 0xb4, 0x9f, 0xaa, 0x5f, 0x0a, 0x2e, 0xe2, 0x38, 0xa6, 0xbc};
+  uint8_t rand[] = {0x23, 0x55, 0x3c, 0xbe, 0x96, 0x37, 0xa8, 0x9d, 0x21, 0x8a, 0xe6, 0x4d, 0xae, 0x47, 0xbf, 0x35};
+  uint8_t sqn[]  = {0xff, 0x9b, 0xb4, 0xd0, 0xb6, 0x07};
+  uint8_t amf[]  = {0xb9, 0xb9};
+  uint8_t opc[]  = {0xcd, 0x63, 0xcb, 0x71, 0x95, 0x4a, 0x9f, 0x4e, 0x48, 0xa5, 0x99, 0x4e, 0x37, 0xa0, 0x2b, 0xaf};
+  uint8_t mac[]  = {0x4a, 0x9f, 0xfa, 0xc3, 0x54, 0xdf, 0xaf, 0xb3};
+  uint8_t res[]  = {0xa5, 0x42, 0x11, 0xd5, 0xe3, 0xba, 0x50, 0xbf};
+  uint8_t ck[]   = {0xb4, 0x0b, 0xa9, 0xa3, 0xc5, 0x8b, 0x2a, 0x05, 0xbb, 0xf0, 0xd9, 0x87, 0xb2, 0x1b, 0xf8, 0xcb};
+  uint8_t ik[]   = {0xf7, 0x69, 0xbc, 0xd7, 0x51, 0x04, 0x46, 0x04, 0x12, 0x76, 0x72, 0x71, 0x1c, 0x6d, 0x34, 0x41};
+  uint8_t ak[]   = {0xaa, 0x68, 0x9c, 0x64, 0x83, 0x70};
+
+  const uint32_t            nof_keys    = 3;
+  const uint32_t            nof_vectors = 37;
+  srslte::milenage_ctx_t    ctx[nof_keys];
+  srslte::milenage_vector_t v[nof_vectors] = {};
+  uint8_t                   keys[nof_keys][16];
+  uint8_t                   opcs[nof_keys][16];
+
+  memcpy(keys[0], k, 16);
+  memcpy(opcs[0], opc, 16);
+  for (uint32_t n = 1; n < nof_keys; n++) {
+    for (uint32_t i = 0; i < 16; i++) {
+      keys[n][i] = (uint8_t)random();
+      opcs[n][i] = (uint8_t)random();
+    }
+  }
+  for (uint32_t n = 0; n < nof_keys; n++) {
+    srslte::security_milenage_init(&ctx[n], keys[n], opcs[n]);
+  }
+
+  for (uint32_t i = 0; i < nof_vectors; i++) {
+    v[i].ctx = &ctx[i % nof_keys];
+    for (uint32_t j = 0; j < 16; j++) {
+      v[i].rand[j] = (uint8_t)random();
+    }
+    for (uint32_t j = 0; j < 6; j++) {
+      v[i].sqn[j] = (uint8_t)random();
+    }
+    v[i].amf[0] = (uint8_t)random();
+    v[i].amf[1] = (uint8_t)random();
+  }
+  memcpy(v[0].rand, rand, sizeof(rand));
+  memcpy(v[0].sqn, sqn, sizeof(sqn));
+  memcpy(v[0].amf, amf, sizeof(amf));
+
+  assert(srslte::security_milenage_f12345_batch(v, nof_vectors) == SRSLTE_SUCCESS);
+
+  assert(arrcmp(v[0].mac_a, mac, sizeof(mac)) == 0);
+  assert(arrcmp(v[0].res, res, sizeof(res)) == 0);
+  assert(arrcmp(v[0].ck, ck, sizeof(ck)) == 0);
+  assert(arrcmp(v[0].ik, ik, sizeof(ik)) == 0);
+  assert(arrcmp(v[0].ak, ak, sizeof(ak)) == 0);
+
+  for (uint32_t i = 0; i < nof_vectors; i++) {
+    uint32_t n = i % nof_keys;
+    uint8_t  mac_o[8];
+    uint8_t  res_o[8];
+    uint8_t  ck_o[16];
+    uint8_t  ik_o[16];
+    uint8_t  ak_o[6];
+    liblte_security_milenage_f1(keys[n], opcs[n], v[i].rand, v[i].sqn, v[i].amf, mac_o);
+    liblte_security_milenage_f2345(keys[n], opcs[n], v[i].rand, res_o, ck_o, ik_o, ak_o);
+    assert(arrcmp(v[i].mac_a, mac_o, sizeof(mac_o)) == 0);
+    assert(arrcmp(v[i].res, res_o, sizeof(res_o)) == 0);
+    assert(arrcmp(v[i].ck, ck_o, sizeof(ck_o)) == 0);
+    assert(arrcmp(v[i].ik, ik_o, sizeof(ik_o)) == 0);
+    assert(arrcmp(v[i].ak, ak_o, sizeof(ak_o)) == 0);
+  }
+}
+
 /*
   Own test sets
 */
@@ -170,6 +248,7 @@ int main(int argc, char* argv[])
 {
 
   test_set_2();
+  test_batch();
   /*
   test_set_3();
   test_set_4();
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srslte/common/test_common.h"
+#include "srslte/common/thread_topology.h"
+#include "srslte/common/threads.h"
+#include <set>
+
+using namespace srslte;
+
+int test_parse()
+{
+  cpu_set_t set;
+  TESTASSERT(thread_topology::parse_cpu_list("2-5,8", &set));
+  TESTASSERT(CPU_COUNT(&set) == 5);
+  TESTASSERT(CPU_ISSET(2, &set) and CPU_ISSET(5, &set) and CPU_ISSET(8, &set));
+  TESTASSERT(not CPU_ISSET(6, &set));
+  TESTASSERT(thread_topology::parse_cpu_list("0", &set));
+  TESTASSERT(CPU_COUNT(&set) == 1);
+  TESTASSERT(thread_topology::parse_cpu_list(" 1, 3 - 4", &set));
+  TESTASSERT(CPU_COUNT(&set) == 3);
+  TESTASSERT(not thread_topology::parse_cpu_list("", &set));
+  TESTASSERT(not thread_topology::parse_cpu_list("5-2", &set));
+  TESTASSERT(not thread_topology::parse_cpu_list("a", &set));
+  TESTASSERT(not thread_topology::parse_cpu_list("1,", &set));
+  TESTASSERT(not thread_topology::parse_cpu_list("100000", &set));
+
+  int policy = -1;
+  TESTASSERT(thread_topology::parse_policy("FIFO", &policy) and policy == SCHED_FIFO);
+  TESTASSERT(thread_topology::parse_policy("rr", &policy) and policy == SCHED_RR);
+  TESTASSERT(thread_topology::parse_policy("other", &policy) and policy == SCHED_OTHER);
+  TESTASSERT(not thread_topology::parse_policy("idle", &policy));
+
+  return SRSLTE_SUCCESS;
+}
+
+int test_classify()
+{
+  TESTASSERT(thread_topology::classify("WORKER2") == "phy_worker");
+  TESTASSERT(thread_topology::classify("PRACH_WORKER") == "prach");
+  TESTASSERT(thread_topology::classify("SYNC") == "txrx");
+  TESTASSERT(thread_topology::classify("SYNC_INTRA_MEASURE") == "measure");
+  TESTASSERT(thread_topology::classify("TASKWORKER0") == "task_worker");
+  TESTASSERT(thread_topology::classify("SRSLOG") == "log");
+  TESTASSERT(thread_topology::classify("TIMER_QUEUE") == "ric_timer");
+  TESTASSERT(thread_topology::classify("srsenb").empty());
+
+  // Every class is reported once and is reached from the names of the threads it is meant for
+  const std::map<std::string, std::string> thread_of_class = {{"phy_worker", "WORKER0"},
+                                                              {"txrx", "TXRX"},
+                                                              {"prach", "PRACH_WORKER"},
+                                                              {"measure", "SYNC_INTRA_MEASURE"},
+                                                              {"stack", "gNB-STACK"},
+                                                              {"sockets", "ENBSOCKETS"},
+                                                              {"gw", "GW_RX"},
+                                                              {"task_worker", "TASKWORKER3"},
+                                                              {"log", "SRSLOG"},
+                                                              {"ric", "RIC"},
+                                                              {"ric_timer", "TIMER_QUEUE"},
+                                                              {"metrics", "METRICS_HUB"},
+                                                              {"pcap", "PCAP_WRITER"},
+                                                              {"mme", "MME"},
+                                                              {"spgw", "SPGW"},
+                                                              {"mbms_gw", "MBMS_GW"}};
+  const std::vector<std::string>&          names           = thread_topology::class_names();
+  TESTASSERT(names.size() == thread_of_class.size());
+  TESTASSERT(std::set<std::string>(names.begin(), names.end()).size() == names.size());
+  for (const std::string& cls : names) {
+    auto it = thread_of_class.find(cls);
+    TESTASSERT(it != thread_of_class.end());
+    TESTASSERT(thread_topology::classify(it->second) == cls);
+  }
+  return SRSLTE_SUCCESS;
+}
+
+class affinity_thread : public thread
+{
+public:
+  affinity_thread(const std::string& name_) : thread(name_) {}
+  cpu_set_t cpus = {};
+
+protected:
+  void run_thread() override { sched_getaffinity(0, sizeof(cpus), &cpus); }
+};
+
+int test_configure()
+{
+  thread_topology& topo = thread_topology::get();
+
+  thread_topology_args_t args = {};
+  args.classes["stack"].cpus  = "0-3,99999";
+  TESTASSERT(not topo.configure(args));
+  args.classes["stack"].cpus = "0";
+  args.classes["unknown"]    = {};
+  TESTASSERT(not topo.configure(args));
+  args.classes.erase("unknown");
+  args.classes["stack"].policy = "fifo";
+  args.classes["stack"].prio   = 100;
+  TESTASSERT(not topo.configure(args));
+  TESTASSERT(not topo.active());
+
+  // Pin the stack class to the first CPU the process may use
+  cpu_set_t allowed;
+  TESTASSERT(sched_getaffinity(0, sizeof(allowed), &allowed) == 0);
+  int first = 0;
+  while (not CPU_ISSET(first, &allowed)) {
+    first++;
+  }
+  args.classes["stack"].cpus   = std::to_string(first);
+  args.classes["stack"].policy = "other";
+  args.classes["stack"].prio   = -1;
+  TESTASSERT(topo.configure(args));
+  TESTASSERT(topo.active());
+
+  affinity_thread stack("STACK");
+  stack.start();
+  stack.wait_thread_finish();
+  TESTASSERT(CPU_COUNT(&stack.cpus) == 1 and CPU_ISSET(first, &stack.cpus));
+
+  // Unconfigured classes keep the affinity inherited from the parent
+  affinity_thread pcap("PCAP_WRITER");
+  pcap.start();
+  pcap.wait_thread_finish();
+  TESTASSERT(CPU_EQUAL(&pcap.cpus, &allowed));
+
+  topo.print_report(stdout);
+  return SRSLTE_SUCCESS;
+}
+
+int main()
+{
+  TESTASSERT(test_parse() == SRSLTE_SUCCESS);
+  TESTASSERT(test_classify() == SRSLTE_SUCCESS);
+  TESTASSERT(test_configure() == SRSLTE_SUCCESS);
+
+  printf("Success\n");
+  return SRSLTE_SUCCESS;
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include <srslte/common/test_common.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "srslte/srslte.h"
+
+#define NOF_UES 6
+
+// Every PUCCH RB pair carries 36 format 1a resources, the UEs in each RB pair share the cyclic shift and are separated
+// by their orthogonal cover
+static const uint32_t ue_ncce[NOF_UES] = {0, 12, 24, 37, 49, 61};
+
+static int test_pucch_multi_ue(uint32_t nof_prb)
+{
+  srslte_cell_t cell = {
+      nof_prb,            // nof_prb
+      1,                  // nof_ports
+      1,                  // cell_id
+      SRSLTE_CP_NORM,     // cyclic prefix
+      SRSLTE_PHICH_NORM,  // PHICH length
+      SRSLTE_PHICH_R_1_6, // PHICH resources
+      SRSLTE_FDD,
+  };
+
+  srslte_refsignal_dmrs_pusch_cfg_t dmrs_pusch_cfg     = {}; // Use default
+  srslte_ue_ul_t                    ue_ul[NOF_UES]     = {};
+  srslte_pucch_cfg_t                pucch_cfg[NOF_UES] = {};
+  cf_t*                             ue_buffer[NOF_UES] = {};
+  srslte_enb_ul_t                   enb_ul             = {};
+  srslte_ul_sf_cfg_t                ul_sf              = {};
+  uint32_t                          sf_len             = SRSLTE_SF_LEN_PRB(cell.nof_prb);
+
+  cf_t* buffer = srslte_vec_cf_malloc(sf_len);
+  TESTASSERT(buffer);
+
+  // Init eNb
+  TESTASSERT(!srslte_enb_ul_init(&enb_ul, buffer, cell.nof_prb));
+  TESTASSERT(!srslte_enb_ul_set_cell(&enb_ul, cell, &dmrs_pusch_cfg, NULL));
+
+  // Init UEs, every one with its own ACK resource
+  for (uint32_t i = 0; i < NOF_UES; i++) {
+    uint16_t rnti = 0x46 + i;
+
+    pucch_cfg[i].delta_pucch_shift       = 1;
+    pucch_cfg[i].n_rb_2                  = 0;
+    pucch_cfg[i].N_cs                    = 0;
+    pucch_cfg[i].N_pucch_1               = 0;
+    pucch_cfg[i].ack_nack_feedback_mode  = SRSLTE_PUCCH_ACK_NACK_FEEDBACK_MODE_NORMAL;
+    pucch_cfg[i].uci_cfg.ack[0].ncce[0]  = ue_ncce[i];
+    pucch_cfg[i].uci_cfg.ack[0].nof_acks = 1;
+    pucch_cfg[i].rnti                    = rnti;
+
+    ue_buffer[i] = srslte_vec_cf_malloc(sf_len);
+    TESTASSERT(ue_buffer[i]);
+    TESTASSERT(!srslte_ue_ul_init(&ue_ul[i], ue_buffer[i], cell.nof_prb));
+    TESTASSERT(!srslte_ue_ul_set_cell(&ue_ul[i], cell));
+    srslte_ue_ul_set_rnti(&ue_ul[i], rnti);
+    TESTASSERT(!srslte_enb_ul_add_rnti(&enb_ul, rnti));
+  }
+
+  for (ul_sf.tti = 0; ul_sf.tti < SRSLTE_NOF_SF_X_FRAME * 2; ul_sf.tti++) {
+    uint8_t ack_value[NOF_UES] = {};
+
+    // All UEs transmit in the same subframe
+    srslte_vec_cf_zero(buffer, sf_len);
+    for (uint32_t i = 0; i < NOF_UES; i++) {
+      srslte_ue_ul_cfg_t  ue_ul_cfg  = {};
+      srslte_pusch_data_t pusch_data = {};
+
+      ack_value[i]                    = ((ul_sf.tti + i) / 2) & 1U;
+      pusch_data.uci.ack.valid        = true;
+      pusch_data.uci.ack.ack_value[0] = ack_value[i];
+      ue_ul_cfg.ul_cfg.pucch          = pucch_cfg[i];
+
+      TESTASSERT(srslte_ue_ul_encode(&ue_ul[i], &ul_sf, &ue_ul_cfg, &pusch_data) >= SRSLTE_SUCCESS);
+      srslte_vec_sum_ccc(buffer, ue_buffer[i], buffer, sf_len);
+    }
+
+    // Process UL signal
+    srslte_enb_ul_fft(&enb_ul);
+
+    for (uint32_t i = 0; i < NOF_UES; i++) {
+      srslte_pucch_cfg_t cfg       = pucch_cfg[i];
+      srslte_pucch_res_t pucch_res = {};
+
+      TESTASSERT(!srslte_enb_ul_get_pucch(&enb_ul, &ul_sf, &cfg, &pucch_res));
+
+      INFO("tti=%d; rnti=0x%x; n_pucch=%d; tx_ack=%d; rx_ack=%d; corr=%.2f;\n",
+           ul_sf.tti,
+           cfg.rnti,
+           cfg.n_pucch,
+           ack_value[i],
+           pucch_res.uci_data.ack.ack_value[0],
+           pucch_res.correlation);
+      TESTASSERT(pucch_res.detected);
+      TESTASSERT(pucch_res.uci_data.ack.valid);
+      TESTASSERT(pucch_res.uci_data.ack.ack_value[0] == ack_value[i]);
+    }
+
+    // The REs of each PUCCH RB pair were extracted once for all the UEs
+    TESTASSERT(enb_ul.nof_pucch_rb == 2);
+  }
+
+  // Free all
+  for (uint32_t i = 0; i < NOF_UES; i++) {
+    srslte_ue_ul_free(&ue_ul[i]);
+    free(ue_buffer[i]);
+  }
+  srslte_enb_ul_free(&enb_ul);
+  free(buffer);
+
+  return SRSLTE_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  TESTASSERT(!test_pucch_multi_ue(6));
+  TESTASSERT(!test_pucch_multi_ue(25));
+  TESTASSERT(!test_pucch_multi_ue(100));
+
+  printf("Ok\n");
+
+  return SRSLTE_SUCCESS;
+}
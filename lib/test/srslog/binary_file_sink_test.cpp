@@ -0,0 +1,277 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "file_test_utils.h"
+#include "src/srslog/sinks/binary_file_sink.h"
+#include "testing_helpers.h"
+#include <cstring>
+#include <iterator>
+#include <numeric>
+
+using namespace srslog;
+
+static constexpr char log_filename[] = "binary_file_sink_test.log";
+
+/// Helper to build a log entry.
+static detail::log_entry build_log_entry(unsigned i)
+{
+  using tp_ty = std::chrono::time_point<std::chrono::high_resolution_clock>;
+  tp_ty tp(std::chrono::microseconds(50000 + i));
+
+  detail::log_entry entry = {};
+  entry.tp = tp;
+  entry.context = {i, (i % 2) == 0};
+  entry.fmtstring = "Entry %u: %s, %d, %.2f";
+  entry.log_name = (i % 3 == 0) ? "" : "ABC";
+  entry.log_tag = 'Z';
+  entry.store.push_back(i);
+  entry.store.push_back(std::string("text"));
+  entry.store.push_back(-10);
+  entry.store.push_back(1.25);
+
+  uint8_t hex[20];
+  std::iota(std::begin(hex), std::end(hex), 0);
+  entry.hex_dump.append(hex, i % sizeof(hex));
+
+  return entry;
+}
+
+/// Reads the whole contents of the file in the specified path.
+static std::vector<uint8_t> read_file(const std::string& path)
+{
+  std::ifstream file(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(file),
+          std::istreambuf_iterator<char>()};
+}
+
+/// Decodes the binary file in the specified path into text.
+static bool decode_file(const std::string& path, std::string& text)
+{
+  std::vector<uint8_t> data = read_file(path);
+  if (binary_format::check_header(data.data(), data.size())) {
+    return false;
+  }
+
+  binary_format::decoder decoder;
+  size_t nof_consumed = 0;
+  size_t len = data.size() - binary_format::header_size;
+  if (decoder.decode(data.data() + binary_format::header_size,
+                     len,
+                     nof_consumed,
+                     text)) {
+    return false;
+  }
+
+  return nof_consumed == len;
+}
+
+static bool when_entries_are_written_then_decoded_text_matches_text_format()
+{
+  file_test_utils::scoped_file_deleter deleter(log_filename);
+  binary_file_sink file(log_filename, 0);
+
+  ASSERT_EQ(file.is_binary(), true);
+
+  std::string expected;
+  for (unsigned i = 0; i != 10; ++i) {
+    file.write_entry(build_log_entry(i));
+    expected += format_log_entry_to_text(build_log_entry(i));
+  }
+  std::string text = "Plain text message\n";
+  file.write(detail::memory_buffer(text));
+  expected += text;
+  file.flush();
+
+  std::string result;
+  ASSERT_EQ(decode_file(log_filename, result), true);
+  ASSERT_EQ(result, expected);
+
+  return true;
+}
+
+static bool when_file_rotates_then_each_file_is_decoded_independently()
+{
+  std::string filename0 =
+      file_utils::build_filename_with_index(log_filename, 0);
+  std::string filename1 =
+      file_utils::build_filename_with_index(log_filename, 1);
+  std::string filename2 =
+      file_utils::build_filename_with_index(log_filename, 2);
+  file_test_utils::scoped_file_deleter deleter = {
+      filename0, filename1, filename2};
+
+  binary_file_sink file(log_filename, 5000);
+
+  std::string expected;
+  for (unsigned i = 0; i != 100; ++i) {
+    file.write_entry(build_log_entry(i));
+    expected += format_log_entry_to_text(build_log_entry(i));
+  }
+  file.flush();
+
+  ASSERT_EQ(file_test_utils::file_exists(filename1), true);
+
+  std::string result;
+  for (const auto& path : {filename0, filename1, filename2}) {
+    if (file_test_utils::file_exists(path)) {
+      ASSERT_EQ(decode_file(path, result), true);
+    }
+  }
+  ASSERT_EQ(result, expected);
+
+  return true;
+}
+
+static bool when_last_record_is_incomplete_then_it_is_not_consumed()
+{
+  fmt::memory_buffer buffer;
+  binary_format::encoder encoder;
+  encoder.encode(build_log_entry(1), buffer);
+  size_t first_record_size = buffer.size();
+  encoder.encode(build_log_entry(2), buffer);
+
+  binary_format::decoder decoder;
+  size_t nof_consumed = 0;
+  std::string text;
+  auto data = reinterpret_cast<const uint8_t*>(buffer.data());
+  ASSERT_EQ(bool(decoder.decode(data, buffer.size() - 1, nof_consumed, text)),
+            false);
+  ASSERT_EQ(nof_consumed, first_record_size);
+  ASSERT_EQ(text, format_log_entry_to_text(build_log_entry(1)));
+
+  // Feeding the rest of the data completes the last record.
+  text.clear();
+  ASSERT_EQ(bool(decoder.decode(data + nof_consumed,
+                                buffer.size() - nof_consumed,
+                                nof_consumed,
+                                text)),
+            false);
+  ASSERT_EQ(text, format_log_entry_to_text(build_log_entry(2)));
+
+  return true;
+}
+
+static bool when_format_buffer_is_reused_then_strings_are_interned_by_contents()
+{
+  fmt::memory_buffer buffer;
+  binary_format::encoder encoder;
+  std::string expected;
+
+  // The same buffer holds different format strings over time.
+  char fmtstring[32];
+  for (const char* str : {"First %u: %s, %d, %.2f",
+                          "Second %u: %s, %d, %.2f",
+                          "First %u: %s, %d, %.2f"}) {
+    std::strcpy(fmtstring, str);
+    auto entry_with_format = [&fmtstring]() {
+      detail::log_entry entry = build_log_entry(1);
+      entry.fmtstring = fmtstring;
+      return entry;
+    };
+    encoder.encode(entry_with_format(), buffer);
+    expected += format_log_entry_to_text(entry_with_format());
+  }
+
+  binary_format::decoder decoder;
+  size_t nof_consumed = 0;
+  std::string text;
+  auto data = reinterpret_cast<const uint8_t*>(buffer.data());
+  ASSERT_EQ(bool(decoder.decode(data, buffer.size(), nof_consumed, text)),
+            false);
+  ASSERT_EQ(nof_consumed, buffer.size());
+  ASSERT_EQ(text, expected);
+
+  return true;
+}
+
+/// Returns a copy of the data with the value at the given offset replaced.
+template <typename T>
+static std::vector<uint8_t>
+patch(const std::vector<uint8_t>& data, size_t offset, T value)
+{
+  std::vector<uint8_t> patched = data;
+  std::memcpy(patched.data() + offset, &value, sizeof(value));
+  return patched;
+}
+
+static bool when_record_fields_are_corrupt_then_decoding_fails()
+{
+  fmt::memory_buffer buffer;
+  binary_format::encoder encoder;
+  encoder.encode(build_log_entry(1), buffer);
+  const std::vector<uint8_t> data(buffer.data(), buffer.data() + buffer.size());
+
+  // First record is the format string: type | id | length.
+  const size_t id_offset = 1;
+  const size_t length_offset = 5;
+  // Last record is the entry, preceded by the format and log name strings.
+  const size_t entry_offset = 2 * 9 + std::strlen("Entry %u: %s, %d, %.2f") +
+                              std::strlen("ABC");
+  const size_t name_id_offset = entry_offset + 1 + 4;
+  const size_t hex_len_offset =
+      entry_offset + 1 + binary_format::entry_fields_size - 2;
+
+  auto decode_fails = [](const std::vector<uint8_t>& input) {
+    binary_format::decoder decoder;
+    size_t nof_consumed = 0;
+    std::string text;
+    return bool(
+        decoder.decode(input.data(), input.size(), nof_consumed, text));
+  };
+
+  ASSERT_EQ(decode_fails(data), false);
+  ASSERT_EQ(decode_fails(patch<uint32_t>(data, id_offset, 0)), true);
+  ASSERT_EQ(decode_fails(patch<uint32_t>(data, length_offset, 0xffffffff)),
+            true);
+  ASSERT_EQ(decode_fails(patch<uint32_t>(data, name_id_offset, 1234)), true);
+
+  std::vector<uint8_t> long_hex_dump =
+      patch<uint16_t>(data, hex_len_offset, 0xffff);
+  long_hex_dump.resize(long_hex_dump.size() + 0xffff);
+  ASSERT_EQ(decode_fails(long_hex_dump), true);
+
+  return true;
+}
+
+static bool when_data_is_not_a_binary_log_then_header_check_fails()
+{
+  std::string text = "00:00:00.050000 [ABC ] [Z] Text\n";
+
+  ASSERT_EQ(bool(binary_format::check_header(
+                reinterpret_cast<const uint8_t*>(text.data()), text.size())),
+            true);
+
+  return true;
+}
+
+int main()
+{
+  TEST_FUNCTION(
+      when_entries_are_written_then_decoded_text_matches_text_format);
+  TEST_FUNCTION(when_file_rotates_then_each_file_is_decoded_independently);
+  TEST_FUNCTION(when_last_record_is_incomplete_then_it_is_not_consumed);
+  TEST_FUNCTION(
+      when_format_buffer_is_reused_then_strings_are_interned_by_contents);
+  TEST_FUNCTION(when_record_fields_are_corrupt_then_decoding_fails);
+  TEST_FUNCTION(when_data_is_not_a_binary_log_then_header_check_fails);
+
+  return 0;
+}
@@ -49,7 +49,9 @@ public:
 
   void push(detail::log_entry&& entry) override
   {
-    std::string result = fmt::vsprintf(entry.fmtstring, std::move(entry.store));
+    detail::log_entry::arg_store_type::fmt_store_type store;
+    entry.store.load(store);
+    std::string result = fmt::vsprintf(entry.fmtstring, store);
     ++count;
   }
 
@@ -32,10 +32,10 @@ static detail::log_entry build_log_entry()
   using tp_ty = std::chrono::time_point<std::chrono::high_resolution_clock>;
   tp_ty tp(std::chrono::microseconds(50000));
 
-  fmt::dynamic_format_arg_store<fmt::printf_context> store;
+  detail::log_entry::arg_store_type store;
   store.push_back(88);
 
-  return {nullptr, tp, {10, true}, "Text %d", std::move(store), "ABC", 'Z'};
+  return {nullptr, tp, {10, true}, "Text %d", store, "ABC", 'Z'};
 }
 
 static bool when_fully_filled_log_entry_then_result_everything_is_formatted()
@@ -91,8 +91,9 @@ when_log_entry_without_context_is_passed_then_context_is_not_formatted()
 static bool when_log_entry_with_hex_dump_is_passed_then_hex_dump_is_formatted()
 {
   auto entry = build_log_entry();
-  entry.hex_dump.resize(20);
-  std::iota(entry.hex_dump.begin(), entry.hex_dump.end(), 0);
+  uint8_t hex[20];
+  std::iota(std::begin(hex), std::end(hex), 0);
+  entry.hex_dump.append(hex, sizeof(hex));
 
   std::string result = format_log_entry_to_text(std::move(entry));
   std::string expected =
@@ -105,6 +106,62 @@ static bool when_log_entry_with_hex_dump_is_passed_then_hex_dump_is_formatted()
   return true;
 }
 
+static bool when_log_entry_with_string_args_is_passed_then_args_are_formatted()
+{
+  auto entry = build_log_entry();
+  entry.fmtstring = "Text %d %s %s %.1f %c";
+  char buffer[] = "buffer";
+  entry.store.push_back(std::string("string"));
+  entry.store.push_back(buffer);
+  entry.store.push_back(1.5f);
+  entry.store.push_back('x');
+
+  std::string result = format_log_entry_to_text(std::move(entry));
+  std::string expected =
+      "00:00:00.050000 [ABC ] [Z] [   10] Text 88 string buffer 1.5 x\n";
+
+  ASSERT_EQ(result, expected);
+
+  return true;
+}
+
+static bool when_log_entry_args_do_not_fit_inline_then_args_move_to_heap()
+{
+  auto entry = build_log_entry();
+  entry.fmtstring = "Text %d %s";
+  std::string long_str(4 * SRSLOG_ENTRY_ARGS_SIZE, 'a');
+  entry.store.push_back(long_str);
+
+  ASSERT_EQ(entry.store.is_truncated(), false);
+  ASSERT_EQ(entry.store.is_on_heap(), true);
+
+  std::string result = format_log_entry_to_text(std::move(entry));
+
+  ASSERT_NE(result.find("Text 88 " + long_str + "\n"), std::string::npos);
+  ASSERT_EQ(result.find(" [truncated]"), std::string::npos);
+
+  return true;
+}
+
+static bool when_log_entry_args_exceed_max_size_then_message_is_truncated()
+{
+  auto entry = build_log_entry();
+  entry.fmtstring = "Text %d %s";
+  size_t max_size = entry.store.max_size();
+  std::string long_str(max_size, 'a');
+  entry.store.push_back(long_str);
+
+  ASSERT_EQ(entry.store.is_truncated(), true);
+
+  std::string result = format_log_entry_to_text(std::move(entry));
+
+  ASSERT_NE(result.find("Text 88 aaa"), std::string::npos);
+  ASSERT_NE(result.find(" [truncated]\n"), std::string::npos);
+  ASSERT_EQ(result.size() < 64 + max_size, true);
+
+  return true;
+}
+
 int main()
 {
   TEST_FUNCTION(
@@ -116,6 +173,11 @@ int main()
       when_log_entry_without_context_is_passed_then_context_is_not_formatted);
   TEST_FUNCTION(
       when_log_entry_with_hex_dump_is_passed_then_hex_dump_is_formatted);
+  TEST_FUNCTION(
+      when_log_entry_with_string_args_is_passed_then_args_are_formatted);
+  TEST_FUNCTION(when_log_entry_args_do_not_fit_inline_then_args_move_to_heap);
+  TEST_FUNCTION(
+      when_log_entry_args_exceed_max_size_then_message_is_truncated);
 
   return 0;
 }
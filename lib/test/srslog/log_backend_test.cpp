@@ -94,10 +94,10 @@ static detail::log_entry build_log_entry(sink* s)
   using tp_ty = std::chrono::time_point<std::chrono::high_resolution_clock>;
   tp_ty tp;
 
-  fmt::dynamic_format_arg_store<fmt::printf_context> store;
+  detail::log_entry::arg_store_type store;
   store.push_back(88);
 
-  return {s, tp, {0, false}, "Text %d", std::move(store), "", '\0'};
+  return {s, tp, {0, false}, "Text %d", store, "", '\0'};
 }
 
 static bool when_backend_is_started_then_pushed_log_entries_are_sent_to_sink()
@@ -211,6 +211,57 @@ static bool when_empty_handler_is_used_then_backend_does_not_crash()
   return true;
 }
 
+/// Fills the backend queue beyond its capacity while the worker is stopped.
+static void overflow_backend_queue(log_backend_impl& backend, sink* s)
+{
+  for (unsigned i = 0, e = SRSLOG_QUEUE_CAPACITY + 10; i != e; ++i) {
+    backend.push(build_log_entry(s));
+  }
+}
+
+static bool
+when_queue_overflows_with_drop_policy_then_entries_are_silently_discarded()
+{
+  sink_spy spy;
+
+  log_backend_impl backend;
+  backend.set_error_handler([](const std::string&) {});
+  backend.set_overflow_policy(overflow_policy::drop);
+  overflow_backend_queue(backend, &spy);
+  backend.start();
+
+  // Stop the backend to ensure all entries have been processed.
+  backend.stop();
+
+  ASSERT_EQ(backend.get_nof_discarded_entries(), 10);
+  ASSERT_EQ(spy.write_invocation_count(), SRSLOG_QUEUE_CAPACITY);
+  ASSERT_EQ(spy.received_buffer().find("discarded"), std::string::npos);
+
+  return true;
+}
+
+static bool
+when_queue_overflows_with_count_policy_then_discarded_entries_are_reported()
+{
+  sink_spy spy;
+
+  log_backend_impl backend;
+  backend.set_error_handler([](const std::string&) {});
+  backend.set_overflow_policy(overflow_policy::count);
+  overflow_backend_queue(backend, &spy);
+  backend.start();
+
+  // Stop the backend to ensure all entries have been processed.
+  backend.stop();
+
+  ASSERT_EQ(backend.get_nof_discarded_entries(), 10);
+  ASSERT_EQ(spy.write_invocation_count(), SRSLOG_QUEUE_CAPACITY + 1);
+  ASSERT_NE(spy.received_buffer().find("10 log entries have been discarded"),
+            std::string::npos);
+
+  return true;
+}
+
 int main()
 {
   TEST_FUNCTION(when_backend_is_started_then_is_started_returns_true);
@@ -223,6 +274,10 @@ int main()
   TEST_FUNCTION(when_sink_write_fails_then_error_handler_is_invoked);
   TEST_FUNCTION(when_handler_is_set_after_start_then_handler_is_not_used);
   TEST_FUNCTION(when_empty_handler_is_used_then_backend_does_not_crash);
+  TEST_FUNCTION(
+      when_queue_overflows_with_drop_policy_then_entries_are_silently_discarded);
+  TEST_FUNCTION(
+      when_queue_overflows_with_count_policy_then_discarded_entries_are_reported);
 
   return 0;
 }
@@ -124,7 +124,7 @@ when_logging_in_log_channel_then_log_entry_is_pushed_into_the_backend()
   sink_dummy s;
   log_channel log("id", s, backend);
 
-  std::string fmtstring = "test";
+  const char* fmtstring = "test";
   log(fmtstring, 42, "Hello");
 
   ASSERT_EQ(backend.push_invocation_count(), 1);
@@ -139,7 +139,7 @@ static bool when_logging_in_disabled_log_channel_then_log_entry_is_ignored()
   log_channel log("id", s, backend);
 
   log.set_enabled(false);
-  std::string fmtstring = "test";
+  const char* fmtstring = "test";
   log(fmtstring, 42, "Hello");
 
   ASSERT_EQ(backend.push_invocation_count(), 0);
@@ -157,7 +157,7 @@ static bool when_logging_then_filled_in_log_entry_is_pushed_into_the_backend()
 
   log_channel log("id", s, backend, {name, tag, true});
 
-  std::string fmtstring = "test";
+  const char* fmtstring = "test";
   uint32_t ctx = 10;
 
   log.set_context(ctx);
@@ -187,7 +187,7 @@ when_logging_with_hex_dump_then_filled_in_log_entry_is_pushed_into_the_backend()
 
   log_channel log("id", s, backend, {name, tag, true});
 
-  std::string fmtstring = "test";
+  const char* fmtstring = "test";
   uint32_t ctx = 4;
 
   log.set_context(ctx);
@@ -223,7 +223,7 @@ when_hex_array_length_is_less_than_hex_log_max_size_then_array_length_is_used()
 
   log_channel log("id", s, backend);
 
-  std::string fmtstring = "test";
+  const char* fmtstring = "test";
 
   log.set_hex_dump_max_size(10);
   uint8_t hex[] = {0, 1, 2};
@@ -0,0 +1,123 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srslte/srslog/sink.h"
+#include "srslte/srslog/srslog.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace srslog;
+
+/// Measures the cost of a log call as seen by the caller threads, which is the
+/// time spent building a log entry and pushing it into the backend queue.
+///
+/// Usage: srslog_frontend_benchmark [nof_threads] [nof_calls_per_thread]
+
+namespace {
+
+/// Sink that discards all incoming data, so that the backend drains the queue
+/// as fast as possible.
+class null_sink : public sink
+{
+public:
+  detail::error_string write(detail::memory_buffer buffer) override
+  {
+    return {};
+  }
+
+  detail::error_string flush() override { return {}; }
+};
+
+} // namespace
+
+/// Logs the specified number of entries with a mix of argument types similar to
+/// the ones found in the stack.
+static void run_thread(log_channel& chan,
+                       unsigned nof_calls,
+                       std::atomic<bool>& start_flag)
+{
+  uint8_t hex[32] = {};
+  const char* name = "PUSCH";
+
+  while (!start_flag) {
+    std::this_thread::yield();
+  }
+
+  for (unsigned i = 0; i != nof_calls; ++i) {
+    if (i % 8 == 0) {
+      chan(hex, sizeof(hex), "%s: rnti=0x%x, len=%d", name, 0x46, i);
+    } else {
+      chan("%s: rnti=0x%x, tti=%d, snr=%.1f dB", name, 0x46, i, 12.5);
+    }
+  }
+}
+
+int main(int argc, char** argv)
+{
+  unsigned nof_threads = (argc > 1) ? std::atoi(argv[1]) : 4;
+  unsigned nof_calls = (argc > 2) ? std::atoi(argv[2]) : 1000000;
+
+  null_sink s;
+  log_channel* chan = create_log_channel("bench", s);
+  if (!chan) {
+    return -1;
+  }
+  chan->set_hex_dump_max_size(-1);
+
+  set_queue_overflow_policy(overflow_policy::count);
+  init();
+
+  std::atomic<bool> start_flag{false};
+  std::vector<std::thread> workers;
+  for (unsigned i = 0; i != nof_threads; ++i) {
+    workers.emplace_back(
+        run_thread, std::ref(*chan), nof_calls, std::ref(start_flag));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  start_flag = true;
+  for (auto& t : workers) {
+    t.join();
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  flush();
+
+  auto elapsed_ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+          .count();
+  uint64_t total_calls = uint64_t(nof_threads) * nof_calls;
+
+  fmt::print("threads={} calls/thread={}\n", nof_threads, nof_calls);
+  fmt::print("  wall time:        {:.3f} ms\n", elapsed_ns / 1e6);
+  fmt::print("  ns per call:      {:.1f} (per thread)\n",
+             double(elapsed_ns) * nof_threads / total_calls);
+  fmt::print("  calls per second: {:.0f} (aggregate)\n",
+             total_calls * 1e9 / elapsed_ns);
+  fmt::print("  discarded:        {} ({:.2f}%)\n",
+             get_nof_discarded_log_entries(),
+             100.0 * get_nof_discarded_log_entries() / total_calls);
+
+  return 0;
+}
@@ -21,6 +21,7 @@
 
 #include "srslte/srslog/sink.h"
 #include "srslte/srslog/srslog.h"
+#include "srslte/srslog/srslog_c.h"
 #include "testing_helpers.h"
 
 using namespace srslog;
@@ -186,6 +187,48 @@ when_setting_stderr_as_default_then_get_default_returns_stderr_sink()
   return true;
 }
 
+namespace {
+
+/// Sink that stores all the text written into it.
+class sink_spy : public sink
+{
+public:
+  detail::error_string write(detail::memory_buffer buffer) override
+  {
+    contents.append(buffer.data(), buffer.size());
+    return {};
+  }
+
+  detail::error_string flush() override { return {}; }
+
+  const std::string& get_contents() const { return contents; }
+
+private:
+  std::string contents;
+};
+
+} // namespace
+
+static bool when_logging_through_c_api_then_text_is_copied_verbatim()
+{
+  sink_spy spy;
+  fetch_log_channel("c_api_channel", spy, {});
+  srslog_log_channel* channel = srslog_find_log_channel("c_api_channel");
+  ASSERT_NE(channel, nullptr);
+
+  // Both messages are formatted into the same stack buffer, and the user text
+  // contains conversion specifiers that must not be interpreted again.
+  srslog_log(channel, "first %d%% %s\n", 100, "%d %s");
+  srslog_log(channel, "second %s\n", "message");
+  flush();
+
+  const std::string& out = spy.get_contents();
+  ASSERT_NE(out.find("first 100% %d %s\n"), std::string::npos);
+  ASSERT_NE(out.find("second message\n"), std::string::npos);
+
+  return true;
+}
+
 int main()
 {
   TEST_FUNCTION(when_fetching_channel_then_channel_instance_is_returned);
@@ -208,5 +251,8 @@ int main()
   TEST_FUNCTION(
       when_setting_stderr_as_default_then_get_default_returns_stderr_sink);
 
+  init();
+  TEST_FUNCTION(when_logging_through_c_api_then_text_is_copied_verbatim);
+
   return 0;
 }
@@ -57,6 +57,13 @@ public:
     last_pdcp_pdu.swap(sdu);
     rx_count++;
   }
+  void write_sdus(uint32_t lcid, srslte::unique_byte_buffer_list_t sdus)
+  {
+    log->info("RLC SDU batch of %zd SDUs\n", sdus.size());
+    rx_count += sdus.size();
+    rx_batch_count++;
+    last_batch = std::move(sdus);
+  }
   void discard_sdu(uint32_t lcid, uint32_t discard_sn)
   {
     log->info("Notifing RLC to discard SDU (SN=%u)\n", discard_sn);
@@ -64,15 +71,19 @@ public:
     log->info("Discard_count=%" PRIu64 "\n", discard_count);
   }
 
-  uint64_t rx_count      = 0;
-  uint64_t discard_count = 0;
+  uint64_t                          rx_count       = 0;
+  uint64_t                          rx_batch_count = 0;
+  uint64_t                          discard_count  = 0;
+  uint32_t                          queue_space    = UINT32_MAX;
+  srslte::unique_byte_buffer_list_t last_batch;
 
 private:
   srslte::log_ref              log;
   srslte::unique_byte_buffer_t last_pdcp_pdu;
 
   bool rb_is_um(uint32_t lcid) { return false; }
-  bool sdu_queue_is_full(uint32_t lcid) { return false; };
+  bool     sdu_queue_is_full(uint32_t lcid) { return queue_space == 0; };
+  uint32_t sdu_queue_space(uint32_t lcid) { return queue_space; }
 };
 
 class rrc_dummy : public srsue::rrc_interface_pdcp
@@ -0,0 +1,199 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+#include "pdcp_lte_test.h"
+#include <numeric>
+
+/*
+ * Generic function to test the batched transmission of SDUs. The PDUs handed to RLC in a single batch must
+ * match the PDUs generated by write_sdu() for the same, contiguous, COUNTs.
+ */
+int test_tx_batch(uint32_t                     nof_sdus,
+                  uint32_t                     start_count,
+                  uint8_t                      pdcp_sn_len,
+                  srslte::pdcp_rb_type_t       rb_type,
+                  srslte::as_security_config_t sec_cfg_,
+                  srslte::byte_buffer_pool*    pool,
+                  srslte::log_ref              log)
+{
+  srslte::pdcp_config_t cfg = {1,
+                               rb_type,
+                               srslte::SECURITY_DIRECTION_UPLINK,
+                               srslte::SECURITY_DIRECTION_DOWNLINK,
+                               pdcp_sn_len,
+                               srslte::pdcp_t_reordering_t::ms500,
+                               srslte::pdcp_discard_timer_t::infinity};
+
+  pdcp_lte_test_helper     pdcp_hlp(cfg, sec_cfg_, log);
+  srslte::pdcp_entity_lte* pdcp = &pdcp_hlp.pdcp;
+  rlc_dummy*               rlc  = &pdcp_hlp.rlc;
+
+  srslte::pdcp_lte_state_t init_state = {};
+  init_state.tx_hfn                   = pdcp->HFN(start_count);
+  init_state.next_pdcp_tx_sn          = pdcp->SN(start_count);
+  pdcp_hlp.set_pdcp_initial_state(init_state);
+
+  // SDUs of different sizes and contents
+  std::vector<srslte::unique_byte_buffer_t> sdus_exp;
+  srslte::unique_byte_buffer_list_t         sdus;
+  for (uint32_t i = 0; i < nof_sdus; i++) {
+    srslte::unique_byte_buffer_t sdu = allocate_unique_buffer(*pool);
+    sdu->N_bytes                     = 2 + 37 * i % 1400;
+    for (uint32_t j = 0; j < sdu->N_bytes; j++) {
+      sdu->msg[j] = (uint8_t)(i + 3 * j);
+    }
+    sdus_exp.push_back(allocate_unique_buffer(*pool));
+    *sdus_exp.back() = *sdu;
+    sdus.push_back(std::move(sdu));
+  }
+
+  pdcp->write_sdus(std::move(sdus));
+
+  TESTASSERT(rlc->rx_count == nof_sdus);
+  srslte::unique_byte_buffer_list_t& pdus = rlc->last_batch;
+  if (rb_type == srslte::PDCP_RB_IS_DRB) {
+    // DRB SDUs reach RLC in a single call
+    TESTASSERT(rlc->rx_batch_count == 1);
+    TESTASSERT(pdus.size() == nof_sdus);
+    for (uint32_t i = 0; i < nof_sdus; i++) {
+      srslte::unique_byte_buffer_t pdu_exp =
+          gen_expected_pdu(sdus_exp[i], start_count + i, pdcp_sn_len, rb_type, sec_cfg_, pool, log);
+      TESTASSERT(compare_two_packets(pdu_exp, pdus[i]) == 0);
+    }
+  } else {
+    // SRBs are processed one SDU at a time
+    TESTASSERT(rlc->rx_batch_count == 0);
+    srslte::unique_byte_buffer_t pdu_act = allocate_unique_buffer(*pool);
+    rlc->get_last_sdu(pdu_act);
+    srslte::unique_byte_buffer_t pdu_exp =
+        gen_expected_pdu(sdus_exp.back(), start_count + nof_sdus - 1, pdcp_sn_len, rb_type, sec_cfg_, pool, log);
+    TESTASSERT(compare_two_packets(pdu_exp, pdu_act) == 0);
+  }
+
+  // COUNT continues after the batch
+  srslte::pdcp_lte_state_t state = {};
+  pdcp->get_bearer_state(&state);
+  TESTASSERT(pdcp->COUNT(state.tx_hfn, state.next_pdcp_tx_sn) == start_count + nof_sdus);
+  return 0;
+}
+
+/*
+ * TX Test: a batch larger than the free RLC queue space is truncated before numbering, so that the PDUs handed to
+ * RLC and the following ones keep contiguous COUNTs.
+ */
+int test_tx_batch_queue_space(srslte::byte_buffer_pool* pool, srslte::log_ref log)
+{
+  srslte::pdcp_config_t cfg = {1,
+                               srslte::PDCP_RB_IS_DRB,
+                               srslte::SECURITY_DIRECTION_UPLINK,
+                               srslte::SECURITY_DIRECTION_DOWNLINK,
+                               srslte::PDCP_SN_LEN_12,
+                               srslte::pdcp_t_reordering_t::ms500,
+                               srslte::pdcp_discard_timer_t::infinity};
+
+  pdcp_lte_test_helper     pdcp_hlp(cfg, sec_cfg, log);
+  srslte::pdcp_entity_lte* pdcp = &pdcp_hlp.pdcp;
+  rlc_dummy*               rlc  = &pdcp_hlp.rlc;
+
+  const uint32_t nof_sdus = 12, queue_space = 5;
+  rlc->queue_space        = queue_space;
+
+  srslte::unique_byte_buffer_list_t sdus;
+  for (uint32_t i = 0; i < nof_sdus; i++) {
+    srslte::unique_byte_buffer_t sdu = allocate_unique_buffer(*pool);
+    sdu->N_bytes                     = 2 + i;
+    sdus.push_back(std::move(sdu));
+  }
+  pdcp->write_sdus(std::move(sdus));
+
+  TESTASSERT(rlc->rx_count == queue_space);
+  TESTASSERT(rlc->last_batch.size() == queue_space);
+  for (uint32_t i = 0; i < queue_space; i++) {
+    // 12 bit SN in the two byte DRB header
+    uint32_t sn = ((rlc->last_batch[i]->msg[0] & 0x0Fu) << 8u) | rlc->last_batch[i]->msg[1];
+    TESTASSERT(sn == i);
+  }
+  srslte::pdcp_lte_state_t state = {};
+  pdcp->get_bearer_state(&state);
+  TESTASSERT(pdcp->COUNT(state.tx_hfn, state.next_pdcp_tx_sn) == queue_space);
+
+  // Nothing is numbered while the queue is full
+  rlc->queue_space = 0;
+  sdus.clear();
+  sdus.push_back(allocate_unique_buffer(*pool));
+  sdus.back()->N_bytes = 2;
+  pdcp->write_sdus(std::move(sdus));
+  TESTASSERT(rlc->rx_batch_count == 1);
+  pdcp->get_bearer_state(&state);
+  TESTASSERT(pdcp->COUNT(state.tx_hfn, state.next_pdcp_tx_sn) == queue_space);
+  return 0;
+}
+
+/*
+ * TX Test: batches larger than PDCP_TX_BATCH_SIZE, across the SN wraparound, for every ciphering algorithm.
+ */
+int test_tx_all(srslte::byte_buffer_pool* pool, srslte::log_ref log)
+{
+  const srslte::CIPHERING_ALGORITHM_ID_ENUM cipher_algos[] = {srslte::CIPHERING_ALGORITHM_ID_EEA0,
+                                                              srslte::CIPHERING_ALGORITHM_ID_128_EEA1,
+                                                              srslte::CIPHERING_ALGORITHM_ID_128_EEA2,
+                                                              srslte::CIPHERING_ALGORITHM_ID_128_EEA3};
+
+  for (auto cipher_algo : cipher_algos) {
+    srslte::as_security_config_t test_sec_cfg = sec_cfg;
+    test_sec_cfg.cipher_algo                  = cipher_algo;
+
+    // TX Test 1: 12 bit SN, 40 SDUs, the SN wraps after the 10th one
+    TESTASSERT(test_tx_batch(40, 4086, srslte::PDCP_SN_LEN_12, srslte::PDCP_RB_IS_DRB, test_sec_cfg, pool, log) == 0);
+
+    // TX Test 2: 18 bit SN, a single SDU
+    TESTASSERT(test_tx_batch(1, 262143, srslte::PDCP_SN_LEN_18, srslte::PDCP_RB_IS_DRB, test_sec_cfg, pool, log) ==
+               0);
+
+    // TX Test 3: SRB with integrity protection, falls back to one SDU at a time
+    TESTASSERT(test_tx_batch(3, 30, srslte::PDCP_SN_LEN_5, srslte::PDCP_RB_IS_SRB, test_sec_cfg, pool, log) == 0);
+  }
+
+  return SRSLTE_SUCCESS;
+}
+
+// Setup all tests
+int run_all_tests(srslte::byte_buffer_pool* pool)
+{
+  // Setup log
+  srslte::log_ref log("PDCP LTE Test TX");
+  log->set_level(srslte::LOG_LEVEL_DEBUG);
+  log->set_hex_limit(128);
+
+  TESTASSERT(test_tx_all(pool, log) == 0);
+  TESTASSERT(test_tx_batch_queue_space(pool, log) == 0);
+
+  return 0;
+}
+
+int main()
+{
+  if (run_all_tests(srslte::byte_buffer_pool::get_instance()) != SRSLTE_SUCCESS) {
+    fprintf(stderr, "pdcp_lte_tests_tx() failed\n");
+    return SRSLTE_ERROR;
+  }
+
+  return SRSLTE_SUCCESS;
+}
@@ -25,8 +25,10 @@
 #include "srslte/common/threads.h"
 #include "srslte/upper/rlc.h"
 #include <boost/program_options.hpp>
+#include <algorithm>
 #include <boost/program_options/parsers.hpp>
 #include <cassert>
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <pthread.h>
@@ -319,6 +321,13 @@ private:
   byte_buffer_pool* pool = nullptr;
 };
 
+// Nanoseconds since an arbitrary (but process-wide) epoch, embedded into each SDU to measure the RLC latency
+static uint64_t now_ns()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
 class rlc_tester : public pdcp_interface_rlc, public rrc_interface_rlc, public thread
 {
 public:
@@ -351,9 +360,17 @@ public:
       if (args.pedantic_sdu_check) {
         exit(-1);
       }
+    } else if (sdu->N_bytes >= sizeof(uint64_t)) {
+      uint64_t tx_ns = 0;
+      memcpy(&tx_ns, sdu->msg, sizeof(uint64_t));
+      uint64_t rx_ns = now_ns();
+      if (tx_ns <= rx_ns) {
+        latency_us.push_back(static_cast<uint32_t>((rx_ns - tx_ns) / 1000));
+      }
     }
 
     rx_pdus++;
+    rx_bytes += sdu->N_bytes;
   }
   void write_pdu_bcch_bch(unique_byte_buffer_t sdu) {}
   void write_pdu_bcch_dlsch(unique_byte_buffer_t sdu) {}
@@ -366,6 +383,24 @@ public:
 
   int get_nof_rx_pdus() { return rx_pdus; }
 
+  // Print SDU goodput and the end-to-end (PDCP to PDCP) SDU latency distribution. Only call after stopping the test
+  void print_perf(uint32_t duration_sec)
+  {
+    printf("%s: throughput=%.2f Mbit/s", name.c_str(), rx_bytes * 8.0 / duration_sec / 1e6);
+    if (latency_us.empty()) {
+      printf("\n");
+      return;
+    }
+    std::sort(latency_us.begin(), latency_us.end());
+    auto percentile = [this](double p) { return latency_us[static_cast<size_t>(p * (latency_us.size() - 1))]; };
+    printf(", SDU latency [us]: p50=%d, p90=%d, p99=%d, p99.9=%d, max=%d\n",
+           percentile(0.5),
+           percentile(0.9),
+           percentile(0.99),
+           percentile(0.999),
+           latency_us.back());
+  }
+
 private:
   void run_thread()
   {
@@ -384,6 +419,10 @@ private:
       }
       sn++;
       pdu->N_bytes = args.sdu_size;
+      if (pdu->N_bytes >= sizeof(uint64_t)) {
+        uint64_t tx_ns = now_ns();
+        memcpy(pdu->msg, &tx_ns, sizeof(uint64_t));
+      }
       rlc->write_sdu(lcid, std::move(pdu));
       if (args.sdu_gen_delay_usec > 0) {
         usleep(args.sdu_gen_delay_usec);
@@ -391,10 +430,12 @@ private:
     }
   }
 
-  bool               run_enable;
-  uint64_t           rx_pdus;
-  uint32_t           lcid;
-  srslte::log_filter log;
+  bool                  run_enable;
+  uint64_t              rx_pdus;
+  uint64_t              rx_bytes = 0;
+  std::vector<uint32_t> latency_us;
+  uint32_t              lcid;
+  srslte::log_filter    log;
 
   std::string name;
 
@@ -544,6 +585,9 @@ void stress_test(stress_test_args_t args)
          metrics.bearer[lcid].num_tx_pdu_bytes,
          metrics.bearer[lcid].num_rx_pdu_bytes);
   rlc_bearer_metrics_print(metrics.bearer[lcid]);
+
+  tester1.print_perf(args.test_duration_sec);
+  tester2.print_perf(args.test_duration_sec);
 }
 
 int main(int argc, char** argv)
@@ -40,6 +40,7 @@
 #include "srsenb/hdr/phy/enb_phy_base.h"
 #include "srsenb/hdr/stack/enb_stack_base.h"
 #include "srsenb/hdr/stack/enb_stack_lte.h"
+#include "srsenb/hdr/ue_metrics_reader.h"
 
 #include "srslte/common/bcd_helpers.h"
 #include "srslte/common/buffer_pool.h"
@@ -47,6 +48,7 @@
 #include "srslte/common/log_filter.h"
 #include "srslte/common/mac_pcap.h"
 #include "srslte/common/security.h"
+#include "srslte/common/thread_topology.h"
 #include "srslte/interfaces/enb_command_interface.h"
 #include "srslte/interfaces/enb_metrics_interface.h"
 #include "srslte/interfaces/sched_interface.h"
@@ -92,6 +94,7 @@ struct log_args_t {
   int         all_hex_limit;
   int         file_max_size;
   std::string filename;
+  bool        binary;
 };
 
 struct gui_args_t {
@@ -104,6 +107,7 @@ struct general_args_t {
   bool        metrics_csv_enable;
   std::string metrics_csv_filename;
   bool        print_buffer_state;
+  bool        latency_probes;
   std::string eia_pref_list;
   std::string eea_pref_list;
 };
@@ -124,6 +128,8 @@ struct all_args_t {
   general_args_t    general;
   phy_args_t        phy;
   stack_args_t      stack;
+
+  srslte::thread_topology_args_t threads;
 #ifdef ENABLE_RIC_AGENT
   ric::agent_args_t ric_agent;
 #endif
@@ -165,6 +171,7 @@ public:
 
   // eNodeB metrics interface
   bool get_metrics(enb_metrics_t* m) override;
+  bool get_metrics(enb_metrics_t* m, ue_metrics_reader& reader) override;
 
   // eNodeB command interface
   void cmd_cell_gain(uint32_t cell_id, float gain) override;
@@ -189,6 +196,10 @@ private:
 
   int parse_args(const all_args_t& args_);
 
+  // Per-UE metrics shared by PHY and stack, declared first so that it outlives both
+  ue_metrics_registry ue_metrics;
+  ue_metrics_reader   hub_reader; // used by get_metrics(m), i.e. the metrics hub
+
   // eNB components
 #ifdef ENABLE_RIC_AGENT
   std::unique_ptr<ric::agent>  ric_agent = nullptr;
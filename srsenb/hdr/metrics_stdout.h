@@ -53,6 +53,8 @@ private:
   bool                   do_print;
   uint8_t                n_reports;
   enb_metrics_interface* enb;
+  uint64_t               last_nof_late_ttis             = 0;
+  uint64_t               last_nof_exhausted_softbuffers = 0;
 };
 
 } // namespace srsenb
@@ -60,7 +60,6 @@ public:
                stack_interface_phy_lte::ul_sched_t& ul_grants,
                srslte_mbsfn_cfg_t*                  mbsfn_cfg);
 
-  uint32_t get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS]);
 
 private:
   constexpr static float PUSCH_RL_SNR_DB_TH = 1.0f;
@@ -105,14 +104,10 @@ private:
 
     srslte_phich_grant_t phich_grant = {};
 
-    void     metrics_read(phy_metrics_t* metrics);
-    void     metrics_dl(uint32_t mcs);
-    void     metrics_ul(uint32_t mcs, float rssi, float sinr, float turbo_iters);
     uint32_t get_rnti() const { return rnti; }
 
   private:
-    uint32_t      rnti    = 0;
-    phy_metrics_t metrics = {};
+    uint32_t rnti = 0;
   };
 
   // Component carrier index
@@ -43,9 +43,9 @@ public:
 
   virtual void start_plot() = 0;
 
-  virtual void get_metrics(phy_metrics_t* m) = 0;
-
   virtual void cmd_cell_gain(uint32_t cell_idx, float gain_db) = 0;
+
+  virtual void get_overload_metrics(phy_overload_metrics_t* m) { *m = {}; }
 };
 
 } // namespace srsenb
@@ -45,7 +45,8 @@ public:
   int  init(const phy_args_t&            args,
             const phy_cfg_t&             cfg,
             srslte::radio_interface_phy* radio_,
-            stack_interface_phy_lte*     stack_);
+            stack_interface_phy_lte*     stack_,
+            ue_metrics_registry*         ue_metrics_ = nullptr);
   void stop() override;
 
   std::string get_type() override { return "lte"; };
@@ -66,9 +67,8 @@ public:
   void set_config(uint16_t rnti, const phy_rrc_cfg_list_t& phy_cfg_list) override;
   void complete_config(uint16_t rnti) override;
 
-  void get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS]) override;
-
   void cmd_cell_gain(uint32_t cell_id, float gain_db) override;
+  void get_overload_metrics(phy_overload_metrics_t* m) override;
 
   void radio_overflow() override{};
   void radio_failure() override{};
@@ -24,6 +24,8 @@
 
 #include "phy_interfaces.h"
 #include "srsenb/hdr/phy/phy_ue_db.h"
+#include "srsenb/hdr/phy/tti_deadline_monitor.h"
+#include "srsenb/hdr/stack/upper/ue_metrics_registry.h"
 #include "srslte/common/gen_mch_tables.h"
 #include "srslte/common/interfaces_common.h"
 #include "srslte/common/log.h"
@@ -61,8 +63,12 @@ public:
    * @param tx_sem_id Semaphore identifier, the worker thread pointer is used
    * @param buffer baseband IQ sample buffer
    * @param tx_time timestamp to transmit samples
+   * @param rx_time time at which the subframe was received, used to measure the slack against the TX deadline
    */
-  void worker_end(void* tx_sem_id, srslte::rf_buffer_t& buffer, srslte::rf_timestamp_t& tx_time);
+  void worker_end(void*                            tx_sem_id,
+                  srslte::rf_buffer_t&             buffer,
+                  srslte::rf_timestamp_t&          tx_time,
+                  tti_deadline_monitor::time_point rx_time);
 
   // Common objects
   phy_args_t params = {};
@@ -165,6 +171,15 @@ public:
   srslte::radio_interface_phy* radio      = nullptr;
   stack_interface_phy_lte*     stack      = nullptr;
   srslte::channel_ptr          dl_channel = nullptr;
+  ue_metrics_registry*         ue_metrics = nullptr;
+
+  // Slack of the workers against the TX deadline and degradation level derived from it
+  tti_deadline_monitor deadline;
+
+  ue_metrics_slot_t* get_ue_metrics(uint16_t rnti) const
+  {
+    return ue_metrics != nullptr ? ue_metrics->find(rnti) : nullptr;
+  }
 
   /**
    * UE Database object, direct public access, all PHY threads should be able to access this attribute directly
@@ -43,6 +43,19 @@ struct phy_cell_cfg_t {
 
 typedef std::vector<phy_cell_cfg_t> phy_cell_cfg_list_t;
 
+// Graceful degradation policy applied when the PHY workers cannot keep up with the TTI deadline
+struct phy_overload_args_t {
+  bool     enable             = false;
+  uint32_t slack_threshold_us = 500;    ///< TTIs sent to the radio with less slack than this count as tight
+  uint32_t window_ms          = 100;    ///< Evaluation window of the policy
+  float    enter_ratio        = 0.05f;  ///< Fraction of tight TTIs in a window that raises the level
+  float    exit_ratio         = 0.005f; ///< Fraction of tight TTIs in a window that lowers the level
+  uint32_t max_level          = 3;      ///< Highest level that can be reached, 0 disables degradation
+  int      pusch_max_its      = 4;      ///< Turbo decoder iteration cap from level 1
+  uint32_t max_users          = 4;      ///< DL and UL user allocations per TTI and carrier from level 2
+  float    max_prb_ratio      = 0.5f;   ///< Fraction of the bandwidth schedulable for user data from level 2
+};
+
 struct phy_args_t {
   std::string            type;
   srslte::phy_log_args_t log;
@@ -53,6 +66,7 @@ struct phy_args_t {
   bool        pusch_8bit_decoder  = false;
   float       tx_amplitude        = 1.0f;
   int         nof_phy_threads     = 1;
+  int         nof_prach_threads   = 0;
   std::string equalizer_mode      = "mmse";
   float       estimator_fil_w     = 1.0f;
   bool        pusch_meas_epre     = true;
@@ -63,6 +77,8 @@ struct phy_args_t {
   srslte::channel::args_t dl_channel_args;
   srslte::channel::args_t ul_channel_args;
 
+  phy_overload_args_t overload;
+
   srslte::vnf_args_t vnf_args;
 };
 
@@ -22,6 +22,8 @@
 #ifndef SRSENB_PHY_METRICS_H
 #define SRSENB_PHY_METRICS_H
 
+#include <stdint.h>
+
 namespace srsenb {
 
 // PHY metrics per user
@@ -40,6 +42,18 @@ struct dl_metrics_t {
   int   n_samples;
 };
 
+// PHY processing deadline and degradation state, counters are cumulative since start
+struct phy_overload_metrics_t {
+  uint64_t nof_ttis;          ///< TTIs sent to the radio
+  uint64_t nof_late;          ///< TTIs sent to the radio after their deadline
+  uint64_t nof_tight;         ///< TTIs sent with less slack than the threshold, including late ones
+  uint64_t nof_degraded_ttis; ///< TTIs processed with a degradation level above 0
+  uint64_t nof_escalations;   ///< Number of times the degradation level was raised
+  float    min_slack_us;      ///< Minimum slack in the last evaluation window
+  float    avg_slack_us;      ///< Average slack in the last evaluation window
+  uint32_t level;             ///< Current degradation level
+};
+
 struct phy_metrics_t {
 #ifdef ENABLE_RIC_AGENT_KPM
   uint32_t cc_idx;
@@ -25,8 +25,12 @@
 #include "srslte/common/block_queue.h"
 #include "srslte/common/buffer_pool.h"
 #include "srslte/common/log.h"
+#include "srslte/common/thread_pool.h"
 #include "srslte/common/threads.h"
 #include "srslte/interfaces/enb_interfaces.h"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 
 // Setting ENABLE_PRACH_GUI to non zero enables a GUI showing signal received in the PRACH window.
 #define ENABLE_PRACH_GUI 0
@@ -46,7 +50,8 @@ public:
             const srslte_prach_cfg_t& prach_cfg_,
             stack_interface_phy_lte*  mac,
             srslte::log*              log_h,
-            int                       priority);
+            int                       priority,
+            srslte::task_thread_pool* corr_pool_ = nullptr);
   int  new_tti(uint32_t tti, cf_t* buffer);
   void set_max_prach_offset_us(float delay_us);
   void stop();
@@ -96,6 +101,15 @@ private:
   uint32_t                 nof_sf              = 0;
   uint32_t                 sf_cnt              = 0;
 
+  // Correlation of the root sequences, spread across the shared pool if any
+  srslte::task_thread_pool* corr_pool     = nullptr;
+  std::mutex                tasks_mutex;
+  std::condition_variable   tasks_cvar;
+  uint32_t                  tasks_pending = 0;
+
+  static void correlate_batches(void* arg, uint32_t nof_batches);
+  void        run_batches(uint32_t nof_batches);
+
   void run_thread() final;
   int  run_tti(sf_buffer* b);
 };
@@ -104,6 +118,7 @@ class prach_worker_pool
 {
 private:
   std::vector<std::unique_ptr<prach_worker> > prach_vec;
+  std::unique_ptr<srslte::task_thread_pool>   corr_pool;
 
 public:
   prach_worker_pool()  = default;
@@ -114,14 +129,21 @@ public:
             const srslte_prach_cfg_t& prach_cfg_,
             stack_interface_phy_lte*  mac,
             srslte::log*              log_h,
-            int                       priority)
+            int                       priority,
+            uint32_t                  nof_corr_threads = 0)
   {
     // Create PRACH worker if required
     while (cc_idx >= prach_vec.size()) {
       prach_vec.push_back(std::unique_ptr<prach_worker>(new prach_worker(prach_vec.size())));
     }
 
-    prach_vec[cc_idx]->init(cell_, prach_cfg_, mac, log_h, priority);
+    // The correlation threads are shared by all the carriers
+    if (nof_corr_threads > 0 and not corr_pool) {
+      corr_pool = std::unique_ptr<srslte::task_thread_pool>(new srslte::task_thread_pool(nof_corr_threads));
+      corr_pool->start(priority);
+    }
+
+    prach_vec[cc_idx]->init(cell_, prach_cfg_, mac, log_h, priority, corr_pool.get());
   }
 
   void set_max_prach_offset_us(float delay_us)
@@ -136,6 +158,9 @@ public:
     for (auto& prach : prach_vec) {
       prach->stop();
     }
+    if (corr_pool) {
+      corr_pool->stop();
+    }
   }
 
   int new_tti(uint32_t cc_idx, uint32_t tti, cf_t* buffer)
@@ -55,7 +55,6 @@ public:
   int      read_pucch_d(uint32_t cc_idx, cf_t* pusch_d);
   void start_plot();
 
-  uint32_t get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS]);
 
 private:
   void work_imp() final;
@@ -69,8 +68,9 @@ private:
 
   uint32_t               tti_rx = 0, tti_tx_dl = 0, tti_tx_ul = 0;
   uint32_t               t_rx = 0, t_tx_dl = 0, t_tx_ul = 0;
-  uint32_t               tx_worker_cnt = 0;
-  srslte::rf_timestamp_t tx_time       = {};
+  uint32_t                         tx_worker_cnt = 0;
+  srslte::rf_timestamp_t           tx_time       = {};
+  tti_deadline_monitor::time_point rx_time       = {};
 
   std::vector<std::unique_ptr<cc_worker> > cc_workers;
 
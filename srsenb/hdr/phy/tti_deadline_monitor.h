@@ -0,0 +1,104 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        tti_deadline_monitor.h
+ * Description: Tracks the slack of every PHY worker against its TX deadline and
+ *              derives a degradation level from the fraction of TTIs that are
+ *              late or close to late. Each level sheds some processing load:
+ *                1: caps the PUSCH turbo decoder iterations
+ *                2: also limits the PRBs and UEs scheduled per TTI
+ *                3: also drops DL new transmissions without SRB data or CEs
+ *****************************************************************************/
+
+#ifndef SRSENB_TTI_DEADLINE_MONITOR_H
+#define SRSENB_TTI_DEADLINE_MONITOR_H
+
+#include "srsenb/hdr/phy/phy_interfaces.h"
+#include "srsenb/hdr/phy/phy_metrics.h"
+#include "srslte/common/log.h"
+#include "srslte/interfaces/sched_interface.h"
+#include <atomic>
+#include <chrono>
+
+namespace srsenb {
+
+class tti_deadline_monitor
+{
+public:
+  using clock      = std::chrono::steady_clock;
+  using time_point = clock::time_point;
+
+  static const uint32_t MAX_LEVEL = 3;
+
+  /**
+   * @param args_ degradation policy
+   * @param budget_us_ time available from the end of the subframe reception until its TX samples are due
+   */
+  void init(const phy_overload_args_t& args_, uint32_t budget_us_, srslte::log* log_h_ = nullptr);
+
+  /**
+   * Accounts for one TTI whose samples were received at rx_time and are being handed to the radio now. Must be called
+   * in TX order, which is guaranteed from phy_common::worker_end.
+   *
+   * @return true if the degradation level changed
+   */
+  bool tti_done(time_point rx_time) { return tti_done_slack(budget_us - elapsed_us(rx_time)); }
+  bool tti_done_slack(float slack_us);
+
+  uint32_t get_level() const { return level.load(std::memory_order_relaxed); }
+  // Turbo decoder iterations to use instead of the configured ones at the current level
+  uint32_t get_pusch_max_its(uint32_t configured) const;
+  // Scheduler limits for the current level
+  sched_interface::overload_limits_t get_sched_limits() const;
+
+  void get_metrics(phy_overload_metrics_t* m) const;
+
+private:
+  float elapsed_us(time_point rx_time) const
+  {
+    return std::chrono::duration_cast<std::chrono::duration<float, std::micro> >(clock::now() - rx_time).count();
+  }
+
+  phy_overload_args_t args      = {};
+  srslte::log*        log_h     = nullptr;
+  float               budget_us = 0;
+
+  // Current evaluation window, only accessed in TX order
+  uint32_t win_ttis      = 0;
+  uint32_t win_tight     = 0;
+  float    win_min_slack = 0;
+  float    win_sum_slack = 0;
+
+  // Read by the metrics thread
+  std::atomic<uint32_t> level{0};
+  std::atomic<uint64_t> nof_ttis{0};
+  std::atomic<uint64_t> nof_late{0};
+  std::atomic<uint64_t> nof_tight{0};
+  std::atomic<uint64_t> nof_degraded_ttis{0};
+  std::atomic<uint64_t> nof_escalations{0};
+  std::atomic<float>    last_min_slack_us{0};
+  std::atomic<float>    last_avg_slack_us{0};
+};
+
+} // namespace srsenb
+
+#endif // SRSENB_TTI_DEADLINE_MONITOR_H
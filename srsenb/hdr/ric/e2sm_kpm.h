@@ -11,6 +11,7 @@
 #include "srsenb/hdr/stack/upper/common_enb.h"
 #include "srslte/interfaces/enb_metrics_interface.h"
 #include "srsenb/hdr/stack/rrc/rrc_metrics.h"
+#include "srsenb/hdr/ue_metrics_reader.h"
 
 #include "srsenb/hdr/ric/e2ap.h"
 #include "srsenb/hdr/ric/e2sm.h"
@@ -97,6 +98,7 @@ public:
   typedef struct report_period {
     int ms;
     int timer_id;
+    srsenb::ue_metrics_reader reader;
     metrics last_metrics;
 #ifdef ENABLE_SLICER
     slice_metrics last_slice_metrics;
@@ -44,7 +44,7 @@ public:
     : name(std::string("TIMER_QUEUE")), thread(0), running(false), next_id(0),
       cond(PTHREAD_COND_INITIALIZER), lock(PTHREAD_MUTEX_INITIALIZER) {};
   timer_queue(std::string& name)
-    : thread(0), running(false), next_id(0), cond(PTHREAD_COND_INITIALIZER),
+    : name(name), thread(0), running(false), next_id(0), cond(PTHREAD_COND_INITIALIZER),
       lock(PTHREAD_MUTEX_INITIALIZER) {};
   virtual ~timer_queue() { stop(); };
   std::string& get_name() { return name; };
@@ -37,6 +37,9 @@ namespace srsenb {
 typedef struct {
   bool        enable;
   std::string filename;
+  uint32_t    max_size_mb;
+  uint32_t    rotate_period_s;
+  std::string rnti_filter;
 } pcap_args_t;
 
 typedef struct {
@@ -53,7 +53,10 @@ public:
   ~enb_stack_lte() final;
 
   // eNB stack base interface
-  int         init(const stack_args_t& args_, const rrc_cfg_t& rrc_cfg_, phy_interface_stack_lte* phy_);
+  int         init(const stack_args_t&      args_,
+                   const rrc_cfg_t&         rrc_cfg_,
+                   phy_interface_stack_lte* phy_,
+                   ue_metrics_registry*     ue_metrics_ = nullptr);
   int         init(const stack_args_t& args_, const rrc_cfg_t& rrc_cfg_);
   void        stop() final;
   std::string get_type() final;
@@ -114,6 +117,10 @@ public:
   {
     mac.set_sched_dl_tti_mask(tti_mask, nof_sfs);
   }
+  void set_overload_limits(const sched_interface::overload_limits_t& limits) final
+  {
+    mac.set_overload_limits(limits);
+  }
   void tti_clock() override;
 
   /* STACK-S1AP interface*/
@@ -168,10 +175,11 @@ private:
   // RAT-specific interfaces
   phy_interface_stack_lte* phy = nullptr;
 
+  // Per-UE metrics slots, owned by the eNB and shared with the PHY
+  ue_metrics_registry* ue_metrics = nullptr;
+
   // state
   bool started = false;
-
-  srslte::block_queue<stack_metrics_t> pending_stack_metrics;
 };
 
 } // namespace srsenb
@@ -55,7 +55,8 @@ public:
             phy_interface_stack_lte* phy,
             rlc_interface_mac*       rlc,
             rrc_interface_mac*       rrc,
-            srslte::log_ref          log_h);
+            srslte::log_ref          log_h,
+            ue_metrics_registry*     ue_metrics_ = nullptr);
   void stop();
 
   void start_pcap(srslte::mac_pcap* pcap_);
@@ -79,6 +80,10 @@ public:
   {
     scheduler.set_dl_tti_mask(tti_mask, nof_sfs);
   }
+  void set_overload_limits(const sched_interface::overload_limits_t& limits) override
+  {
+    scheduler.set_overload_limits(limits);
+  }
   void build_mch_sched(uint32_t tbs);
 
   /******** Interface from RRC (RRC -> MAC) ****************/
@@ -104,7 +109,9 @@ public:
 
   bool process_pdus();
 
-  void get_metrics(mac_metrics_t metrics[ENB_METRICS_MAX_USERS]);
+  /* Occupancy of the shared HARQ softbuffer pools, safe to call from any thread */
+  void get_softbuffer_metrics(softbuffer_pool_metrics_t& tx, softbuffer_pool_metrics_t& rx);
+
   void
   write_mcch(asn1::rrc::sib_type2_s* sib2, asn1::rrc::sib_type13_r9_s* sib13, asn1::rrc::mcch_msg_s* mcch) override;
 
@@ -156,10 +163,18 @@ private:
 
   sched_interface::dl_pdu_mch_t mch = {};
 
+  /* HARQ softbuffers lent to the UEs, declared first so that they outlive every UE */
+  softbuffer_tx_pool tx_softbuffers;
+  softbuffer_rx_pool rx_softbuffers;
+
   /* Map of active UEs */
   std::map<uint16_t, std::unique_ptr<ue> > ue_db, ues_to_rem;
   uint16_t                                 last_rnti = 70;
 
+  /* Per-UE metrics slots. MAC owns their lifetime: claimed when a UE enters ue_db, released once PHY dropped it */
+  ue_metrics_registry* ue_metrics = nullptr;
+  ue_metrics_slot_t*   claim_ue_metrics(uint16_t rnti);
+
   srslte::block_queue<std::unique_ptr<ue> > ue_pool; ///< Pool of pre-allocated UE objects
   void                                      prealloc_ue(uint32_t nof_ue);
 
@@ -22,6 +22,8 @@
 #ifndef SRSENB_MAC_METRICS_H
 #define SRSENB_MAC_METRICS_H
 
+#include <stdint.h>
+
 namespace srsenb {
 
 // MAC metrics per user
@@ -45,6 +47,16 @@ struct mac_metrics_t {
   uint64_t ul_rb;
 };
 
+// Occupancy of a shared HARQ softbuffer pool
+struct softbuffer_pool_metrics_t {
+  uint32_t capacity;      ///< Buffers allocated at startup
+  uint32_t in_use;        ///< Buffers bound to HARQ processes, overflow included
+  uint32_t peak;          ///< Highest in_use since startup
+  uint32_t nof_overflow;  ///< Buffers currently allocated beyond the capacity
+  uint64_t nof_exhausted; ///< Allocations that found the pool empty
+  uint64_t nof_bytes;     ///< Memory held by the buffers, overflow included
+};
+
 } // namespace srsenb
 
 #endif // SRSENB_MAC_METRICS_H
@@ -118,6 +118,7 @@ public:
 
   uint64_t get_dl_rbg_total(uint16_t rnti) final;
   uint64_t get_ul_rb_total(uint16_t rnti) final;
+  bool     get_ue_metrics(uint16_t rnti, ue_sched_metrics_t& m) final;
 
   int dl_rlc_buffer_state(uint16_t rnti, uint32_t lc_id, uint32_t tx_queue, uint32_t retx_queue) final;
   int dl_mac_buffer_state(uint16_t rnti, uint32_t ce_code, uint32_t nof_cmds = 1) final;
@@ -143,6 +144,12 @@ public:
   void                                 tpc_dec(uint16_t rnti);
   std::array<int, SRSLTE_MAX_CARRIERS> get_enb_ue_cc_map(uint16_t rnti) final;
   int                                  ul_buffer_add(uint16_t rnti, uint32_t lcid, uint32_t bytes) final;
+  void                                 set_overload_limits(const overload_limits_t& limits) final;
+  /// Same as dl_ack_info(), also returning the DL HARQ process the ACK was matched to (pid, TBS)
+  std::pair<uint32_t, int>
+  dl_harq_ack_info(uint32_t tti, uint16_t rnti, uint32_t enb_cc_idx, uint32_t tb_idx, bool ack);
+  /// Discards the TBs of a DL HARQ process whose grant was not transmitted, so that no retx is scheduled for them
+  void                                 dl_harq_flush(uint16_t rnti, uint32_t enb_cc_idx, uint32_t pid);
 #ifdef ENABLE_SLICER
   void                                 set_ue_slice_status(uint16_t rnti, uint8_t status);
   void                                 set_slicer_workshare(bool workshare);
@@ -168,6 +175,7 @@ protected:
   rrc_interface_mac*               rrc       = nullptr;
   sched_args_t                     sched_cfg = {};
   std::vector<sched_cell_params_t> sched_cell_params;
+  overload_limits_t                overload_limits;
 
   std::map<uint16_t, sched_ue> ue_db;
 
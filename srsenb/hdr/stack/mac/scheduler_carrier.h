@@ -44,6 +44,7 @@ public:
   void                   carrier_cfg(const sched_cell_params_t& sched_params_);
 #endif
   void                   set_dl_tti_mask(uint8_t* tti_mask, uint32_t nof_sfs);
+  void                   set_overload_limits(const sched_interface::overload_limits_t& limits);
   const cc_sched_result& generate_tti_result(srslte::tti_point tti_rx);
   int                    dl_rach_info(dl_sched_rar_info_t rar_info);
 
@@ -82,6 +83,8 @@ private:
 
   std::vector<uint8_t> sf_dl_mask; ///< Some TTIs may be forbidden for DL sched due to MBMS
 
+  sched_interface::overload_limits_t overload_limits; ///< Limits requested by the PHY while it is overloaded
+
   std::unique_ptr<bc_sched> bc_sched_ptr;
   std::unique_ptr<ra_sched> ra_sched_ptr;
 };
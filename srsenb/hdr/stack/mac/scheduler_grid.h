@@ -36,7 +36,7 @@ enum class alloc_type_t { DL_BC, DL_PCCH, DL_RAR, DL_DATA, UL_DATA };
 
 //! Result of alloc attempt
 struct alloc_outcome_t {
-  enum result_enum { SUCCESS, DCI_COLLISION, RB_COLLISION, ERROR, NOF_RB_INVALID, PUCCH_COLLISION };
+  enum result_enum { SUCCESS, DCI_COLLISION, RB_COLLISION, ERROR, NOF_RB_INVALID, PUCCH_COLLISION, OVERLOAD };
   result_enum result = ERROR;
   alloc_outcome_t()  = default;
   alloc_outcome_t(result_enum e) : result(e) {}
@@ -282,6 +282,7 @@ public:
   sf_sched();
   void init(const sched_cell_params_t& cell_params_);
   void new_tti(srslte::tti_point tti_rx_, sf_sched_result* cc_results);
+  void set_overload_limits(const sched_interface::overload_limits_t& limits) { overload_limits = limits; }
 
   // DL alloc methods
   alloc_outcome_t                      alloc_bc(uint32_t aggr_lvl, uint32_t sib_idx, uint32_t sib_ntx);
@@ -341,6 +342,8 @@ private:
   std::vector<ul_alloc_t>  ul_data_allocs;
   uint32_t                 last_msg3_prb = 0, max_msg3_prb = 0;
 
+  sched_interface::overload_limits_t overload_limits;
+
   // Next TTI state
   tti_params_t tti_params{10241};
 };
@@ -170,12 +170,13 @@ public:
   void ul_phr(int phr);
   void mac_buffer_state(uint32_t ce_code, uint32_t nof_cmds);
 
-  void set_ul_cqi(uint32_t tti, uint32_t enb_cc_idx, uint32_t cqi, uint32_t ul_ch_code);
-  void set_dl_ri(uint32_t tti, uint32_t enb_cc_idx, uint32_t ri);
-  void set_dl_pmi(uint32_t tti, uint32_t enb_cc_idx, uint32_t ri);
-  void set_dl_cqi(uint32_t tti, uint32_t enb_cc_idx, uint32_t cqi);
-  int  set_ack_info(uint32_t tti, uint32_t enb_cc_idx, uint32_t tb_idx, bool ack);
-  void set_ul_crc(srslte::tti_point tti_rx, uint32_t enb_cc_idx, bool crc_res);
+  void                     set_ul_cqi(uint32_t tti, uint32_t enb_cc_idx, uint32_t cqi, uint32_t ul_ch_code);
+  void                     set_dl_ri(uint32_t tti, uint32_t enb_cc_idx, uint32_t ri);
+  void                     set_dl_pmi(uint32_t tti, uint32_t enb_cc_idx, uint32_t ri);
+  void                     set_dl_cqi(uint32_t tti, uint32_t enb_cc_idx, uint32_t cqi);
+  std::pair<uint32_t, int> set_ack_info(uint32_t tti, uint32_t enb_cc_idx, uint32_t tb_idx, bool ack);
+  void                     reset_dl_harq(uint32_t enb_cc_idx, uint32_t pid);
+  void                     set_ul_crc(srslte::tti_point tti_rx, uint32_t enb_cc_idx, bool crc_res);
 
   /*******************************************************
    * Custom functions
@@ -209,6 +210,7 @@ public:
   uint32_t                   get_pending_ul_new_data(uint32_t tti, int this_ue_cc_idx);
   uint32_t                   get_pending_ul_old_data(uint32_t cc_idx);
   uint32_t                   get_pending_dl_new_data_total();
+  bool                       has_pending_dl_ctrl_data() const;
 
   dl_harq_proc* get_pending_dl_harq(uint32_t tti_tx_dl, uint32_t cc_idx);
   dl_harq_proc* get_empty_dl_harq(uint32_t tti_tx_dl, uint32_t cc_idx);
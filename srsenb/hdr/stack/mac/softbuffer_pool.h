@@ -0,0 +1,86 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSENB_SOFTBUFFER_POOL_H
+#define SRSENB_SOFTBUFFER_POOL_H
+
+#include "mac_metrics.h"
+#include "srslte/common/logmap.h"
+#include "srslte/phy/fec/softbuffer.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace srsenb {
+
+/**
+ * Pool of HARQ softbuffers shared by all UEs and carriers, for one direction.
+ *
+ * The buffers are initialized once for the widest cell. A UE takes one when a HARQ process starts a transmission and
+ * gives it back on ACK, after the last retransmission or when the UE is removed, so the memory follows the number of
+ * concurrently active HARQ processes instead of the number of connected UEs.
+ *
+ * When the pool is empty, allocate() either initializes an extra buffer on the heap (overflow) or returns nullptr, in
+ * which case the caller skips the grant and HARQ retransmits it later.
+ */
+template <class Softbuffer>
+class softbuffer_pool
+{
+public:
+  softbuffer_pool() = default;
+  ~softbuffer_pool();
+  softbuffer_pool(const softbuffer_pool&) = delete;
+  softbuffer_pool& operator=(const softbuffer_pool&) = delete;
+
+  bool init(uint32_t nof_prb_, uint32_t capacity_, bool overflow_);
+
+  Softbuffer* allocate();
+  void        deallocate(Softbuffer* buffer);
+
+  void get_metrics(softbuffer_pool_metrics_t& metrics);
+
+private:
+  bool is_pooled(const Softbuffer* buffer) const
+  {
+    return buffer >= buffers.get() and buffer < buffers.get() + capacity;
+  }
+
+  std::mutex                    mutex;
+  srslte::log_ref               log_h{"MAC"};
+  uint32_t                      nof_prb  = 0;
+  uint32_t                      capacity = 0;
+  bool                          overflow = true;
+  std::unique_ptr<Softbuffer[]> buffers;
+  std::vector<Softbuffer*>      free_list;
+
+  size_t   buffer_bytes  = 0; ///< Memory held by each buffer
+  uint32_t nof_overflow  = 0; ///< Buffers currently allocated beyond the capacity
+  uint32_t peak          = 0;
+  uint64_t nof_exhausted = 0;
+  bool     exhausted     = false; ///< Warn once per exhaustion episode
+};
+
+typedef softbuffer_pool<srslte_softbuffer_tx_t> softbuffer_tx_pool;
+typedef softbuffer_pool<srslte_softbuffer_rx_t> softbuffer_rx_pool;
+
+} // namespace srsenb
+
+#endif // SRSENB_SOFTBUFFER_POOL_H
@@ -23,6 +23,8 @@
 #define SRSENB_UE_H
 
 #include "mac_metrics.h"
+#include "softbuffer_pool.h"
+#include "srsenb/hdr/stack/upper/ue_metrics_registry.h"
 #include "srslte/common/block_queue.h"
 #include "srslte/common/log.h"
 #include "srslte/common/mac_pcap.h"
@@ -41,6 +43,8 @@ class ue : public srslte::read_pdu_interface, public srslte::pdu_queue::process_
 public:
   ue(uint16_t                 rnti,
      uint32_t                 nof_prb,
+     softbuffer_tx_pool*      tx_pool,
+     softbuffer_rx_pool*      rx_pool,
      sched_interface*         sched,
      rrc_interface_mac*       rrc_,
      rlc_interface_mac*       rlc,
@@ -79,9 +83,20 @@ public:
   uint8_t*
   generate_mch_pdu(uint32_t harq_pid, sched_interface::dl_pdu_mch_t sched, uint32_t nof_pdu_elems, uint32_t grant_size);
 
-  srslte_softbuffer_tx_t*
-                          get_tx_softbuffer(const uint32_t ue_cc_idx, const uint32_t harq_process, const uint32_t tb_idx);
-  srslte_softbuffer_rx_t* get_rx_softbuffer(const uint32_t ue_cc_idx, const uint32_t tti);
+  srslte_softbuffer_tx_t* get_tx_softbuffer(const uint32_t ue_cc_idx,
+                                            const uint32_t harq_process,
+                                            const uint32_t tb_idx,
+                                            const uint32_t tti_tx_dl,
+                                            const bool     new_tx);
+  srslte_softbuffer_rx_t* get_rx_softbuffer(const uint32_t ue_cc_idx, const uint32_t tti, const uint32_t current_tx_nb);
+
+  void set_tx_softbuffer_ack(const uint32_t ue_cc_idx,
+                             const uint32_t harq_process,
+                             const uint32_t tb_idx,
+                             const bool     ack);
+  void set_rx_softbuffer_crc(const uint32_t ue_cc_idx, const uint32_t tti_rx, const bool crc);
+  void release_stale_softbuffers(const uint32_t tti);
+  void set_max_harq_tx(uint32_t max_harq_tx_) { max_harq_tx = max_harq_tx_; }
 
   bool     process_pdus();
   uint8_t* request_buffer(const uint32_t ue_cc_idx, const uint32_t tti, const uint32_t len);
@@ -89,7 +104,7 @@ public:
   void     push_pdu(const uint32_t ue_cc_idx, const uint32_t tti, uint32_t len);
   void     deallocate_pdu(const uint32_t ue_cc_idx, const uint32_t tti);
 
-  void metrics_read(srsenb::mac_metrics_t* metrics);
+  void set_metrics_slot(ue_metrics_slot_t* slot) { metrics = slot; }
   void metrics_rx(bool crc, uint32_t tbs);
   void metrics_tx(bool crc, uint32_t tbs);
   void metrics_phr(float phr);
@@ -104,17 +119,26 @@ public:
   int  read_pdu(uint32_t lcid, uint8_t* payload, uint32_t requested_bytes) final;
 
 private:
-  uint32_t allocate_cc_buffers(const uint32_t num_cc = 1); ///< Add and initialize softbuffers for CC
+  uint32_t allocate_cc_buffers(const uint32_t num_cc = 1); ///< Add softbuffer slots for CC
+  void     release_softbuffers();
+
+  /// Softbuffer of the pool bound to one HARQ process while it holds data
+  template <class Softbuffer>
+  struct harq_softbuffer_t {
+    Softbuffer* buffer = nullptr;
+    uint32_t    tti    = 0; ///< TTI of the last transmission
+    uint32_t    nof_tx = 0; ///< Transmissions of the current TB
+  };
+
+  // HARQ processes keep their softbuffer for at most as long as the scheduler keeps them pending
+  static const uint32_t softbuffer_stale_tti = 100;
 
   void allocate_sdu(srslte::sch_pdu* pdu, uint32_t lcid, uint32_t sdu_len);
   bool process_ce(srslte::sch_subh* subh);
   void allocate_ce(srslte::sch_pdu* pdu, uint32_t lcid);
 
-  uint32_t      phr_counter    = 0;
-  uint32_t      dl_cqi_counter = 0;
-  uint32_t      dl_ri_counter  = 0;
-  uint32_t      dl_pmi_counter = 0;
-  mac_metrics_t metrics        = {};
+  static const uint32_t sched_metrics_period_tti = 10;
+  ue_metrics_slot_t*    metrics                  = nullptr;
 
   srslte::mac_pcap* pcap             = nullptr;
   uint64_t          conres_id        = 0;
@@ -124,12 +148,17 @@ private:
   uint32_t          nof_failures     = 0;
   int               nof_rx_harq_proc = 0;
   int               nof_tx_harq_proc = 0;
+  uint32_t          max_harq_tx      = 5;
+  uint32_t          nof_softbuffers  = 0; ///< Softbuffers currently bound, for a quick stale check
+
+  softbuffer_tx_pool* tx_pool = nullptr;
+  softbuffer_rx_pool* rx_pool = nullptr;
 
-  typedef std::vector<srslte_softbuffer_tx_t>
+  typedef std::vector<harq_softbuffer_t<srslte_softbuffer_tx_t> >
                                        cc_softbuffer_tx_list_t; ///< List of Tx softbuffers for all HARQ processes of one carrier
   std::vector<cc_softbuffer_tx_list_t> softbuffer_tx;           ///< List of softbuffer lists for Tx
 
-  typedef std::vector<srslte_softbuffer_rx_t>
+  typedef std::vector<harq_softbuffer_t<srslte_softbuffer_rx_t> >
                                        cc_softbuffer_rx_list_t; ///< List of Rx softbuffers for all HARQ processes of one carrier
   std::vector<cc_softbuffer_rx_list_t> softbuffer_rx;           ///< List of softbuffer lists for Rx
 
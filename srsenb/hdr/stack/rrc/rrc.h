@@ -26,6 +26,7 @@
 #include "rrc_cell_cfg.h"
 #include "rrc_metrics.h"
 #include "srsenb/hdr/stack/upper/common_enb.h"
+#include "srsenb/hdr/stack/upper/ue_metrics_registry.h"
 #include "srslte/common/block_queue.h"
 #include "srslte/common/buffer_pool.h"
 #include "srslte/common/common.h"
@@ -62,10 +63,10 @@ public:
             rlc_interface_rrc*     rlc,
             pdcp_interface_rrc*    pdcp,
             s1ap_interface_rrc*    s1ap,
-            gtpu_interface_rrc*    gtpu);
+            gtpu_interface_rrc*    gtpu,
+            ue_metrics_registry*   ue_metrics_ = nullptr);
 
   void stop();
-  void get_metrics(rrc_metrics_t& m);
   void tti_clock();
 
   // rrc_interface_mac
@@ -141,6 +142,8 @@ private:
   s1ap_interface_rrc*       s1ap = nullptr;
   srslte::log_ref           rrc_log;
 
+  ue_metrics_registry* ue_metrics = nullptr;
+
   // derived params
   std::unique_ptr<cell_info_common_list> cell_common_list;
 
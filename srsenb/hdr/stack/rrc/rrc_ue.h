@@ -47,6 +47,7 @@ public:
   void        activity_timer_expired();
 
   rrc_state_t get_state();
+  void        set_state(rrc_state_t new_state);
 
   void send_connection_setup();
   void send_connection_reest(uint8_t ncc);
@@ -59,6 +59,7 @@ public:
 
   // stack interface
   void handle_gtpu_s1u_rx_packet(srslte::unique_byte_buffer_t pdu, const sockaddr_in& addr);
+  void handle_gtpu_s1u_rx_packets(srslte::unique_byte_buffer_list_t pdus, const std::vector<sockaddr_in>& addrs);
   void handle_gtpu_m1u_rx_packet(srslte::unique_byte_buffer_t pdu, const sockaddr_in& addr);
 
 private:
@@ -117,6 +118,13 @@ private:
 
   void echo_response(in_addr_t addr, in_port_t port, uint16_t seq);
 
+  // DL data PDUs of one bearer, collected from a batch of S1-U packets
+  struct dl_sdu_batch_t {
+    rnti_lcid_t                       rnti_lcid;
+    srslte::unique_byte_buffer_list_t sdus;
+  };
+  bool read_s1u_rx_packet(const srslte::unique_byte_buffer_t& pdu, const sockaddr_in& addr, rnti_lcid_t* rnti_lcid);
+
   /****************************************************************************
    * TEID to RNIT/LCID helper functions
    ***************************************************************************/
@@ -20,6 +20,7 @@
  */
 
 #include "srslte/common/timers.h"
+#include "srsenb/hdr/stack/upper/ue_metrics_registry.h"
 #include "srslte/interfaces/enb_interfaces.h"
 #include "srslte/interfaces/ue_interfaces.h"
 #include "srslte/upper/pdcp.h"
@@ -39,16 +40,19 @@ class pdcp : public pdcp_interface_rlc, public pdcp_interface_gtpu, public pdcp_
 public:
   pdcp(srslte::task_sched_handle task_sched_, const char* logname);
   virtual ~pdcp() {}
-  void init(rlc_interface_pdcp* rlc_, rrc_interface_pdcp* rrc_, gtpu_interface_pdcp* gtpu_);
+  void init(rlc_interface_pdcp*  rlc_,
+            rrc_interface_pdcp*  rrc_,
+            gtpu_interface_pdcp* gtpu_,
+            ue_metrics_registry* ue_metrics_ = nullptr);
   void stop();
-#ifdef ENABLE_RIC_AGENT_KPM
-  void get_metrics(pdcp_metrics_t& m);
-#endif
 
   // pdcp_interface_rlc
   void write_pdu(uint16_t rnti, uint32_t lcid, srslte::unique_byte_buffer_t sdu) override;
   void write_pdu_mch(uint32_t lcid, srslte::unique_byte_buffer_t sdu) {}
 
+  // pdcp_interface_gtpu
+  void write_sdus(uint16_t rnti, uint32_t lcid, srslte::unique_byte_buffer_list_t sdus) override;
+
   // pdcp_interface_rrc
   void reset(uint16_t rnti) override;
   void add_user(uint16_t rnti) override;
@@ -73,17 +77,17 @@ private:
   public:
     uint16_t                    rnti;
 #ifdef ENABLE_RIC_AGENT_KPM
-    uint64_t                    dl_bytes;
+    ue_metrics_slot_t*          metrics;
     int8_t                      bearer_qci_map[SRSENB_N_RADIO_BEARERS];
-    uint64_t                    dl_bytes_by_bearer[SRSENB_N_RADIO_BEARERS];
-    uint64_t                    dl_bytes_by_qci[MAX_NOF_QCI];
 #endif
     srsenb::rlc_interface_pdcp* rlc;
     // rlc_interface_pdcp
-    void write_sdu(uint32_t lcid, srslte::unique_byte_buffer_t sdu);
-    void discard_sdu(uint32_t lcid, uint32_t discard_sn);
-    bool rb_is_um(uint32_t lcid);
-    bool sdu_queue_is_full(uint32_t lcid);
+    void     write_sdu(uint32_t lcid, srslte::unique_byte_buffer_t sdu);
+    void     write_sdus(uint32_t lcid, srslte::unique_byte_buffer_list_t sdus);
+    void     discard_sdu(uint32_t lcid, uint32_t discard_sn);
+    bool     rb_is_um(uint32_t lcid);
+    bool     sdu_queue_is_full(uint32_t lcid);
+    uint32_t sdu_queue_space(uint32_t lcid);
   };
 
   class user_interface_gtpu : public srsue::gw_interface_pdcp
@@ -91,10 +95,8 @@ private:
   public:
     uint16_t                     rnti;
 #ifdef ENABLE_RIC_AGENT_KPM
-    uint64_t                     ul_bytes;
+    ue_metrics_slot_t*           metrics;
     int8_t                       bearer_qci_map[SRSENB_N_RADIO_BEARERS];
-    uint64_t                     ul_bytes_by_bearer[SRSENB_N_RADIO_BEARERS];
-    uint64_t                     ul_bytes_by_qci[MAX_NOF_QCI];
 #endif
     srsenb::gtpu_interface_pdcp* gtpu;
     // gw_interface_pdcp
@@ -132,6 +134,7 @@ private:
   rlc_interface_pdcp*       rlc;
   rrc_interface_pdcp*       rrc;
   gtpu_interface_pdcp*      gtpu;
+  ue_metrics_registry*      ue_metrics = nullptr;
   srslte::task_sched_handle task_sched;
   srslte::log_ref           log_h;
   srslte::byte_buffer_pool* pool;
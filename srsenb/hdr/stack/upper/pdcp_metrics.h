@@ -24,6 +24,7 @@
 
 #include "srsenb/hdr/stack/upper/common_enb.h"
 #include "srsenb/hdr/stack/rrc/rrc_config.h"
+#include <vector>
 
 namespace srsenb {
 
@@ -38,8 +39,8 @@ struct pdcp_ue_metrics_t {
 };
 
 struct pdcp_metrics_t {
-  uint16_t          n_ues;
-  pdcp_ue_metrics_t ues[ENB_METRICS_MAX_USERS];
+  uint16_t                       n_ues;
+  std::vector<pdcp_ue_metrics_t> ues;
 };
 
 } // namespace srsenb
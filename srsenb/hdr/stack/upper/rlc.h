@@ -60,10 +60,12 @@ public:
 
   // rlc_interface_pdcp
   void        write_sdu(uint16_t rnti, uint32_t lcid, srslte::unique_byte_buffer_t sdu);
+  void        write_sdus(uint16_t rnti, uint32_t lcid, srslte::unique_byte_buffer_list_t sdus);
   void        discard_sdu(uint16_t rnti, uint32_t lcid, uint32_t discard_sn);
   bool        rb_is_um(uint16_t rnti, uint32_t lcid);
   std::string get_rb_name(uint32_t lcid);
   bool        sdu_queue_is_full(uint16_t rnti, uint32_t lcid);
+  uint32_t    sdu_queue_space(uint16_t rnti, uint32_t lcid);
 
   // rlc_interface_mac
   int  read_pdu(uint16_t rnti, uint32_t lcid, uint8_t* payload, uint32_t nof_bytes);
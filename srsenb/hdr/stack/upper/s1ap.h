@@ -22,6 +22,7 @@
 #ifndef SRSENB_S1AP_H
 #define SRSENB_S1AP_H
 
+#include <atomic>
 #include <map>
 
 #include "common_enb.h"
@@ -113,8 +114,8 @@ private:
 
   srslte::socket_handler_t s1ap_socket;
   struct sockaddr_in       mme_addr            = {}; // MME address
-  bool                     mme_connected       = false;
-  bool                     running             = false;
+  std::atomic<bool>        mme_connected{false}; // also read by get_metrics() from the metrics threads
+  std::atomic<bool>        running{false};
   uint32_t                 next_enb_ue_s1ap_id = 1; // Next ENB-side UE identifier
   uint16_t                 next_ue_stream_id   = 1; // Next UE SCTP stream identifier
   srslte::unique_timer     mme_connect_timer, s1setup_timeout;
@@ -126,6 +127,9 @@ private:
   // PCAP
   srslte::s1ap_pcap* pcap = nullptr;
 
+  // Storage of the IEs of the PDU being handled
+  asn1::mem_arena rx_arena;
+
   asn1::s1ap::s1_setup_resp_s s1setupresponse;
 
   void build_tai_cgi();
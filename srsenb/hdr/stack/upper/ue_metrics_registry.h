@@ -0,0 +1,373 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        ue_metrics_registry.h
+ * Description: Lock-free store of per-UE counters shared by PHY, MAC, RRC and
+ *              PDCP. Each UE owns a cache-line aligned slot. Layers update their
+ *              own section with relaxed atomics from whatever thread runs the
+ *              event, and metrics consumers take seqlock-consistent snapshots
+ *              from any thread, without going through the stack thread.
+ *****************************************************************************/
+
+#ifndef SRSENB_UE_METRICS_REGISTRY_H
+#define SRSENB_UE_METRICS_REGISTRY_H
+
+#include "srsenb/hdr/stack/rrc/rrc_metrics.h"
+#include "srsenb/hdr/stack/upper/common_enb.h"
+#ifdef ENABLE_RIC_AGENT_KPM
+#include "srsenb/hdr/stack/upper/pdcp_metrics.h"
+#endif
+#include "srslte/common/seqlock.h"
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdlib.h>
+#include <vector>
+
+namespace srsenb {
+
+#define UE_METRICS_CACHE_LINE 64
+
+/*
+ * All counters are monotonic int64 values that start at zero when the slot is claimed. Averages are kept as a sum of
+ * samples plus a sample count, so that several workers can accumulate into them with fetch_add, and real-valued samples
+ * are stored in fixed point (fp_scale units per 1.0). Gauges (buffer states, scheduler RB totals, RRC state) are plain
+ * relaxed stores of the latest value.
+ */
+struct ue_metrics_slot_t {
+  static const int64_t fp_scale = 1000;
+
+  enum mac_counter_t {
+    MAC_NOF_TTI = 0,
+    MAC_TX_PKTS,
+    MAC_TX_ERRORS,
+    MAC_TX_BITS,
+    MAC_RX_PKTS,
+    MAC_RX_ERRORS,
+    MAC_RX_BITS,
+    MAC_DL_CQI_SUM,
+    MAC_DL_CQI_N,
+    MAC_DL_RI_SUM,
+    MAC_DL_RI_N,
+    MAC_DL_PMI_SUM,
+    MAC_DL_PMI_N,
+    MAC_PHR_SUM,
+    MAC_PHR_N,
+    MAC_UL_BUFFER,
+    MAC_DL_BUFFER,
+    MAC_DL_RB,
+    MAC_UL_RB,
+    MAC_NOF_COUNTERS
+  };
+
+  enum phy_counter_t {
+    PHY_CC_IDX = 0,
+    PHY_DL_N,
+    PHY_DL_MCS_SUM,
+    PHY_UL_N,
+    PHY_UL_MCS_SUM,
+    PHY_UL_SINR_SUM,
+    PHY_UL_RSSI_SUM,
+    PHY_UL_TURBO_ITERS_SUM,
+    PHY_NOF_COUNTERS
+  };
+
+  enum upper_counter_t {
+    RRC_STATE = 0,
+#ifdef ENABLE_RIC_AGENT_KPM
+    PDCP_DL_BYTES,
+    PDCP_UL_BYTES,
+    PDCP_DL_BYTES_BY_BEARER,
+    PDCP_UL_BYTES_BY_BEARER = PDCP_DL_BYTES_BY_BEARER + SRSENB_N_RADIO_BEARERS,
+    PDCP_DL_BYTES_BY_QCI    = PDCP_UL_BYTES_BY_BEARER + SRSENB_N_RADIO_BEARERS,
+    PDCP_UL_BYTES_BY_QCI    = PDCP_DL_BYTES_BY_QCI + MAX_NOF_QCI,
+    UPPER_NOF_COUNTERS      = PDCP_UL_BYTES_BY_QCI + MAX_NOF_QCI
+#else
+    UPPER_NOF_COUNTERS
+#endif
+  };
+
+  // Slot identity, only changed by the registry under the seqlock
+  srslte::seqlock       seq;
+  std::atomic<uint16_t> rnti{0};
+
+  // Each section has a different set of writers: MAC events (PHY workers and the TTI loop), PHY workers and the stack
+  // thread. Keeping them in separate cache lines avoids false sharing between those threads.
+  alignas(UE_METRICS_CACHE_LINE) std::atomic<int64_t> mac[MAC_NOF_COUNTERS];
+  alignas(UE_METRICS_CACHE_LINE) std::atomic<int64_t> phy[PHY_NOF_COUNTERS];
+  alignas(UE_METRICS_CACHE_LINE) std::atomic<int64_t> upper[UPPER_NOF_COUNTERS];
+
+  ue_metrics_slot_t() { reset(); }
+
+  /* MAC */
+  void mac_tx(bool crc, uint32_t tbs) { count(mac, MAC_TX_PKTS, MAC_TX_ERRORS, MAC_TX_BITS, crc, tbs); }
+  void mac_rx(bool crc, uint32_t tbs) { count(mac, MAC_RX_PKTS, MAC_RX_ERRORS, MAC_RX_BITS, crc, tbs); }
+  int64_t mac_tti() { return mac[MAC_NOF_TTI].fetch_add(1, std::memory_order_relaxed) + 1; }
+  void mac_dl_cqi(uint32_t cqi) { sample(mac, MAC_DL_CQI_SUM, MAC_DL_CQI_N, cqi); }
+  void mac_dl_ri(uint32_t ri) { sample(mac, MAC_DL_RI_SUM, MAC_DL_RI_N, ri + 1); }
+  void mac_dl_pmi(uint32_t pmi) { sample(mac, MAC_DL_PMI_SUM, MAC_DL_PMI_N, pmi); }
+  void mac_phr(float phr) { sample(mac, MAC_PHR_SUM, MAC_PHR_N, phr); }
+  void mac_sched_state(int ul_buffer, int dl_buffer, uint64_t dl_rb, uint64_t ul_rb)
+  {
+    set(mac[MAC_UL_BUFFER], ul_buffer);
+    set(mac[MAC_DL_BUFFER], dl_buffer);
+    set(mac[MAC_DL_RB], (int64_t)dl_rb);
+    set(mac[MAC_UL_RB], (int64_t)ul_rb);
+  }
+
+  /* PHY */
+  void phy_dl(uint32_t cc_idx, uint32_t mcs)
+  {
+    set(phy[PHY_CC_IDX], cc_idx);
+    sample(phy, PHY_DL_MCS_SUM, PHY_DL_N, mcs);
+  }
+  void phy_ul(uint32_t cc_idx, uint32_t mcs, float rssi, float sinr, float turbo_iters)
+  {
+    set(phy[PHY_CC_IDX], cc_idx);
+    add(phy[PHY_UL_MCS_SUM], to_fp(mcs));
+    add(phy[PHY_UL_RSSI_SUM], to_fp(rssi));
+    add(phy[PHY_UL_SINR_SUM], to_fp(sinr));
+    add(phy[PHY_UL_TURBO_ITERS_SUM], to_fp(turbo_iters));
+    add(phy[PHY_UL_N], 1);
+  }
+
+  /* RRC/PDCP (stack thread) */
+  void rrc_state(rrc_state_t state) { set(upper[RRC_STATE], state); }
+#ifdef ENABLE_RIC_AGENT_KPM
+  void pdcp_dl(uint32_t lcid, uint32_t qci, uint32_t nof_bytes)
+  {
+    count_bytes(PDCP_DL_BYTES, PDCP_DL_BYTES_BY_BEARER, PDCP_DL_BYTES_BY_QCI, lcid, qci, nof_bytes);
+  }
+  void pdcp_ul(uint32_t lcid, uint32_t qci, uint32_t nof_bytes)
+  {
+    count_bytes(PDCP_UL_BYTES, PDCP_UL_BYTES_BY_BEARER, PDCP_UL_BYTES_BY_QCI, lcid, qci, nof_bytes);
+  }
+#endif
+
+  static int64_t to_fp(float v) { return std::isfinite(v) ? (int64_t)std::lround(v * fp_scale) : 0; }
+  static float   from_fp(int64_t v) { return (float)v / fp_scale; }
+
+  void reset()
+  {
+    for (auto& c : mac) {
+      c.store(0, std::memory_order_relaxed);
+    }
+    for (auto& c : phy) {
+      c.store(0, std::memory_order_relaxed);
+    }
+    for (auto& c : upper) {
+      c.store(0, std::memory_order_relaxed);
+    }
+  }
+
+private:
+  static void add(std::atomic<int64_t>& c, int64_t v) { c.fetch_add(v, std::memory_order_relaxed); }
+  static void set(std::atomic<int64_t>& c, int64_t v) { c.store(v, std::memory_order_relaxed); }
+
+  static void count(std::atomic<int64_t>* c, uint32_t pkts, uint32_t errors, uint32_t bits, bool crc, uint32_t tbs)
+  {
+    if (crc) {
+      add(c[bits], (int64_t)tbs * 8);
+    } else {
+      add(c[errors], 1);
+    }
+    add(c[pkts], 1);
+  }
+  static void sample(std::atomic<int64_t>* c, uint32_t sum, uint32_t n, float v)
+  {
+    add(c[sum], to_fp(v));
+    add(c[n], 1);
+  }
+#ifdef ENABLE_RIC_AGENT_KPM
+  void count_bytes(uint32_t total, uint32_t by_bearer, uint32_t by_qci, uint32_t lcid, uint32_t qci, uint32_t n)
+  {
+    add(upper[total], n);
+    if (lcid < SRSENB_N_RADIO_BEARERS) {
+      add(upper[by_bearer + lcid], n);
+    }
+    if (qci < MAX_NOF_QCI) {
+      add(upper[by_qci + qci], n);
+    }
+  }
+#endif
+};
+
+//! Plain copy of a slot, taken by ue_metrics_registry::read()
+struct ue_metrics_snapshot_t {
+  uint16_t rnti;
+  uint32_t generation; // changes every time the slot is claimed or released
+  int64_t  mac[ue_metrics_slot_t::MAC_NOF_COUNTERS];
+  int64_t  phy[ue_metrics_slot_t::PHY_NOF_COUNTERS];
+  int64_t  upper[ue_metrics_slot_t::UPPER_NOF_COUNTERS];
+};
+
+/*
+ * Dynamically sized set of per-UE slots. Slots are allocated in chunks that are never freed until the registry is
+ * destroyed, so a slot pointer handed to a layer stays valid memory for the lifetime of the registry, and slots of
+ * released UEs are recycled. A flat RNTI index makes find() a pair of atomic loads, so hot paths that only know the
+ * RNTI (the PHY workers) can look the slot up on every event.
+ *
+ * claim() and release() are serialized internally and are meant for the control path (UE creation/removal in MAC).
+ * A layer that still holds a slot pointer after release() may add a last stray sample to the next owner of the slot;
+ * layers drop their pointers before the MAC releases the UE, which keeps this window to in-flight events.
+ */
+class ue_metrics_registry
+{
+public:
+  static const uint32_t slots_per_chunk = 64;
+  static const uint32_t max_chunks      = (1u << 16) / slots_per_chunk;
+
+  ue_metrics_registry() : index(new std::atomic<uint32_t>[1u << 16]())
+  {
+    for (auto& c : chunks) {
+      c.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+  ue_metrics_registry(const ue_metrics_registry&) = delete;
+  ue_metrics_registry& operator=(const ue_metrics_registry&) = delete;
+  ~ue_metrics_registry()
+  {
+    for (auto& c : chunks) {
+      ue_metrics_slot_t* chunk = c.load(std::memory_order_relaxed);
+      if (chunk != nullptr) {
+        for (uint32_t i = 0; i < slots_per_chunk; i++) {
+          chunk[i].~ue_metrics_slot_t();
+        }
+        free(chunk);
+      }
+    }
+  }
+
+  //! Returns the slot of rnti, claiming a free one (with all counters at zero) if it does not have one yet
+  ue_metrics_slot_t* claim(uint16_t rnti)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    uint32_t                    idx = index[rnti].load(std::memory_order_relaxed);
+    if (idx != 0) {
+      return get_slot(idx - 1);
+    }
+    if (not free_slots.empty()) {
+      idx = free_slots.back();
+      free_slots.pop_back();
+    } else {
+      idx = nof_used.load(std::memory_order_relaxed);
+      if (idx >= slots_per_chunk * max_chunks) {
+        return nullptr;
+      }
+      if (idx % slots_per_chunk == 0 and not alloc_chunk(idx / slots_per_chunk)) {
+        return nullptr;
+      }
+      nof_used.store(idx + 1, std::memory_order_release);
+    }
+    ue_metrics_slot_t* slot = get_slot(idx);
+    slot->seq.write_begin();
+    slot->reset();
+    slot->rnti.store(rnti, std::memory_order_relaxed);
+    slot->seq.write_end();
+    index[rnti].store(idx + 1, std::memory_order_release);
+    return slot;
+  }
+
+  void release(uint16_t rnti)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    uint32_t                    idx = index[rnti].load(std::memory_order_relaxed);
+    if (idx == 0) {
+      return;
+    }
+    index[rnti].store(0, std::memory_order_release);
+    ue_metrics_slot_t* slot = get_slot(idx - 1);
+    slot->seq.write_begin();
+    slot->rnti.store(0, std::memory_order_relaxed);
+    slot->seq.write_end();
+    free_slots.push_back(idx - 1);
+  }
+
+  //! Lock-free lookup from any thread. Returns nullptr if rnti has no slot
+  ue_metrics_slot_t* find(uint16_t rnti) const
+  {
+    uint32_t idx = index[rnti].load(std::memory_order_acquire);
+    return idx != 0 ? get_slot(idx - 1) : nullptr;
+  }
+
+  //! Number of slot indices handed out so far. Some of them may currently be free
+  uint32_t nof_slots() const { return nof_used.load(std::memory_order_acquire); }
+
+  //! Consistent copy of slot idx. Returns false if the slot is not assigned to a UE
+  bool read(uint32_t idx, ue_metrics_snapshot_t& out) const
+  {
+    if (idx >= nof_slots()) {
+      return false;
+    }
+    const ue_metrics_slot_t* slot = get_slot(idx);
+    uint32_t                 s;
+    do {
+      s        = slot->seq.read_begin();
+      out.rnti = slot->rnti.load(std::memory_order_relaxed);
+      copy(slot->mac, out.mac);
+      copy(slot->phy, out.phy);
+      copy(slot->upper, out.upper);
+    } while (slot->seq.read_retry(s));
+    out.generation = s;
+    return out.rnti != 0;
+  }
+
+private:
+  template <size_t N>
+  static void copy(const std::atomic<int64_t> (&src)[N], int64_t (&dst)[N])
+  {
+    for (size_t i = 0; i < N; i++) {
+      dst[i] = src[i].load(std::memory_order_relaxed);
+    }
+  }
+
+  ue_metrics_slot_t* get_slot(uint32_t idx) const
+  {
+    return chunks[idx / slots_per_chunk].load(std::memory_order_acquire) + idx % slots_per_chunk;
+  }
+
+  bool alloc_chunk(uint32_t chunk_idx)
+  {
+    void* mem = nullptr;
+    if (posix_memalign(&mem, UE_METRICS_CACHE_LINE, sizeof(ue_metrics_slot_t) * slots_per_chunk) != 0) {
+      return false;
+    }
+    ue_metrics_slot_t* chunk = static_cast<ue_metrics_slot_t*>(mem);
+    for (uint32_t i = 0; i < slots_per_chunk; i++) {
+      new (&chunk[i]) ue_metrics_slot_t();
+    }
+    chunks[chunk_idx].store(chunk, std::memory_order_release);
+    return true;
+  }
+
+  std::mutex                               mutex;
+  std::vector<uint32_t>                    free_slots;
+  std::atomic<uint32_t>                    nof_used{0};
+  std::atomic<ue_metrics_slot_t*>          chunks[max_chunks];
+  std::unique_ptr<std::atomic<uint32_t>[]> index; // RNTI -> slot index + 1, 0 if the RNTI has no slot
+};
+
+} // namespace srsenb
+
+#endif // SRSENB_UE_METRICS_REGISTRY_H
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        ue_metrics_reader.h
+ * Description: Turns ue_metrics_registry snapshots into the per-UE part of
+ *              enb_metrics_t. Each consumer owns a reader, which keeps the
+ *              previous snapshot of every slot so that counters can be
+ *              reported per period without resetting them in the layers.
+ *****************************************************************************/
+
+#ifndef SRSENB_UE_METRICS_READER_H
+#define SRSENB_UE_METRICS_READER_H
+
+#include "srsenb/hdr/stack/upper/ue_metrics_registry.h"
+#include "srslte/interfaces/enb_metrics_interface.h"
+#include <vector>
+
+namespace srsenb {
+
+class ue_metrics_reader
+{
+public:
+  /**
+   * Fills stack.mac, phy, stack.rrc (and stack.pdcp) with one entry per UE that currently has a slot, all in the same
+   * order. Counters and averages cover the interval since the previous call on this reader; buffer states, RRC state
+   * and the scheduler RB totals are the latest values. Vector capacity is reused across calls.
+   */
+  void read(const ue_metrics_registry& registry, enb_metrics_t& m);
+
+private:
+  struct baseline_t {
+    bool                  valid = false;
+    ue_metrics_snapshot_t snapshot;
+  };
+
+  std::vector<baseline_t> baselines; // indexed by slot
+};
+
+} // namespace srsenb
+
+#endif // SRSENB_UE_METRICS_READER_H
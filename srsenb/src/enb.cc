@@ -107,7 +107,7 @@ int enb::init(const all_args_t& args_, srslte::logger* logger_)
 
     // Only Init PHY if radio couldn't be initialized
     if (ret == SRSLTE_SUCCESS) {
-      if (lte_phy->init(args.phy, phy_cfg, lte_radio.get(), lte_stack.get())) {
+      if (lte_phy->init(args.phy, phy_cfg, lte_radio.get(), lte_stack.get(), &ue_metrics)) {
         srslte::console("Error initializing PHY.\n");
         ret = SRSLTE_ERROR;
       }
@@ -115,7 +115,7 @@ int enb::init(const all_args_t& args_, srslte::logger* logger_)
 
     // Only init Stack if both radio and PHY could be initialized
     if (ret == SRSLTE_SUCCESS) {
-      if (lte_stack->init(args.stack, rrc_cfg, lte_phy.get())) {
+      if (lte_stack->init(args.stack, rrc_cfg, lte_phy.get(), &ue_metrics)) {
         srslte::console("Error initializing stack.\n");
         ret = SRSLTE_ERROR;
       }
@@ -252,10 +252,19 @@ void enb::print_pool()
 }
 
 bool enb::get_metrics(enb_metrics_t* m)
+{
+  return get_metrics(m, hub_reader);
+}
+
+bool enb::get_metrics(enb_metrics_t* m, ue_metrics_reader& reader)
 {
   radio->get_metrics(&m->rf);
-  phy->get_metrics(m->phy);
+  phy->get_overload_metrics(&m->phy_overload);
+  reader.read(ue_metrics, *m);
   stack->get_metrics(&m->stack);
+  if (srslte::latency_probes::is_enabled()) {
+    srslte::latency_probes::get_stats(m->latency);
+  }
   m->running = started;
   return true;
 }
@@ -29,8 +29,10 @@
 #include "srslte/common/common_helper.h"
 #include "srslte/common/config_file.h"
 #include "srslte/common/crash_handler.h"
+#include "srslte/common/latency_probe.h"
 #include "srslte/common/logger_srslog_wrapper.h"
 #include "srslte/common/signal_handler.h"
+#include "srslte/common/thread_topology.h"
 #include "srslte/srslog/srslog.h"
 
 #include <boost/program_options.hpp>
@@ -107,6 +109,7 @@ void parse_args(all_args_t* args, int argc, char* argv[])
     ("rf.device_name",       bpo::value<string>(&args->rf.device_name)->default_value("auto"),       "Front-end device name")
     ("rf.device_args",       bpo::value<string>(&args->rf.device_args)->default_value("auto"),       "Front-end device arguments")
     ("rf.time_adv_nsamples", bpo::value<string>(&args->rf.time_adv_nsamples)->default_value("auto"), "Transmission time advance")
+    ("rf.resampler",         bpo::value<string>(&args->rf.resampler)->default_value("fft"),          "Resampler used when rf.srate forces the sampling rate (fft/polyphase). Polyphase supports fractional ratios")
 
     ("gui.enable",        bpo::value<bool>(&args->gui.enable)->default_value(false),          "Enable GUI plots")
 
@@ -135,12 +138,18 @@ void parse_args(all_args_t* args, int argc, char* argv[])
 
     ("log.filename",      bpo::value<string>(&args->log.filename)->default_value("/tmp/ue.log"),"Log filename")
     ("log.file_max_size", bpo::value<int>(&args->log.file_max_size)->default_value(-1), "Maximum file size (in kilobytes). When passed, multiple files are created. Default -1 (single file)")
+    ("log.binary",        bpo::value<bool>(&args->log.binary)->default_value(false), "Write the log file in binary form, to be converted to text with srslog_decode")
 
     /* PCAP */
     ("pcap.enable",    bpo::value<bool>(&args->stack.mac_pcap.enable)->default_value(false),         "Enable MAC packet captures for wireshark")
     ("pcap.filename",  bpo::value<string>(&args->stack.mac_pcap.filename)->default_value("enb_mac.pcap"), "MAC layer capture filename")
+    ("pcap.max_size_mb",     bpo::value<uint32_t>(&args->stack.mac_pcap.max_size_mb)->default_value(0),     "Start a new MAC capture file when the current one reaches this size in MB (0: never)")
+    ("pcap.rotate_period",   bpo::value<uint32_t>(&args->stack.mac_pcap.rotate_period_s)->default_value(0), "Start a new MAC capture file every rotate_period seconds (0: never)")
+    ("pcap.rnti_filter",     bpo::value<string>(&args->stack.mac_pcap.rnti_filter)->default_value(""),      "Comma separated list of C-RNTIs to capture (empty: all)")
     ("pcap.s1ap_enable",   bpo::value<bool>(&args->stack.s1ap_pcap.enable)->default_value(false),         "Enable S1AP packet captures for wireshark")
     ("pcap.s1ap_filename", bpo::value<string>(&args->stack.s1ap_pcap.filename)->default_value("enb_s1ap.pcap"), "S1AP layer capture filename")
+    ("pcap.s1ap_max_size_mb",   bpo::value<uint32_t>(&args->stack.s1ap_pcap.max_size_mb)->default_value(0),     "Start a new S1AP capture file when the current one reaches this size in MB (0: never)")
+    ("pcap.s1ap_rotate_period", bpo::value<uint32_t>(&args->stack.s1ap_pcap.rotate_period_s)->default_value(0), "Start a new S1AP capture file every s1ap_rotate_period seconds (0: never)")
 
     /* MCS section */
     ("scheduler.pdsch_mcs", bpo::value<int>(&args->stack.mac.sched.pdsch_mcs)->default_value(-1), "Optional fixed PDSCH MCS (ignores reported CQIs if specified)")
@@ -151,6 +160,17 @@ void parse_args(all_args_t* args, int argc, char* argv[])
     ("scheduler.max_nof_ctrl_symbols", bpo::value<uint32_t>(&args->stack.mac.sched.max_nof_ctrl_symbols)->default_value(3), "Number of control symbols")
     ("scheduler.min_nof_ctrl_symbols", bpo::value<uint32_t>(&args->stack.mac.sched.min_nof_ctrl_symbols)->default_value(1), "Minimum number of control symbols")
 
+    /* PHY overload section */
+    ("overload.enable",             bpo::value<bool>(&args->phy.overload.enable)->default_value(false),              "Enable/Disable degradation when the PHY misses the TTI deadline")
+    ("overload.slack_threshold_us", bpo::value<uint32_t>(&args->phy.overload.slack_threshold_us)->default_value(500), "TTIs with less slack than this (in us) count towards overload")
+    ("overload.window_ms",          bpo::value<uint32_t>(&args->phy.overload.window_ms)->default_value(100),          "Overload evaluation window in ms")
+    ("overload.enter_ratio",        bpo::value<float>(&args->phy.overload.enter_ratio)->default_value(0.05f),        "Fraction of tight TTIs in a window that raises the degradation level")
+    ("overload.exit_ratio",         bpo::value<float>(&args->phy.overload.exit_ratio)->default_value(0.005f),        "Fraction of tight TTIs in a window that lowers the degradation level")
+    ("overload.max_level",          bpo::value<uint32_t>(&args->phy.overload.max_level)->default_value(3),            "Highest degradation level (0-3)")
+    ("overload.pusch_max_its",      bpo::value<int>(&args->phy.overload.pusch_max_its)->default_value(4),             "Turbo decoder iterations from level 1")
+    ("overload.max_users",          bpo::value<uint32_t>(&args->phy.overload.max_users)->default_value(4),            "DL and UL users scheduled per TTI and carrier from level 2")
+    ("overload.max_prb_ratio",      bpo::value<float>(&args->phy.overload.max_prb_ratio)->default_value(0.5f),       "Fraction of the bandwidth scheduled for user data from level 2")
+
     /* Downlink Channel emulator section */
     ("channel.dl.enable",            bpo::value<bool>(&args->phy.dl_channel_args.enable)->default_value(false),               "Enable/Disable internal Downlink channel emulator")
     ("channel.dl.awgn.enable",       bpo::value<bool>(&args->phy.dl_channel_args.awgn_enable)->default_value(false),          "Enable/Disable AWGN simulator")
@@ -200,10 +220,15 @@ void parse_args(all_args_t* args, int argc, char* argv[])
     ("expert.tx_amplitude", bpo::value<float>(&args->phy.tx_amplitude)->default_value(0.6), "Transmit amplitude factor")
     ("expert.nof_phy_threads", bpo::value<int>(&args->phy.nof_phy_threads)->default_value(3), "Number of PHY threads")
     ("expert.max_prach_offset_us", bpo::value<float>(&args->phy.max_prach_offset_us)->default_value(30), "Maximum allowed RACH offset (in us)")
+    ("expert.nof_prach_threads", bpo::value<int>(&args->phy.nof_prach_threads)->default_value(0), "Number of threads shared by all carriers to correlate PRACH root sequences (0: none)")
     ("expert.equalizer_mode", bpo::value<string>(&args->phy.equalizer_mode)->default_value("mmse"), "Equalizer mode")
     ("expert.estimator_fil_w", bpo::value<float>(&args->phy.estimator_fil_w)->default_value(0.1), "Chooses the coefficients for the 3-tap channel estimator centered filter.")
     ("expert.rrc_inactivity_timer", bpo::value<uint32_t>(&args->general.rrc_inactivity_timer)->default_value(30000), "Inactivity timer in ms.")
     ("expert.print_buffer_state", bpo::value<bool>(&args->general.print_buffer_state)->default_value(false), "Prints on the console the buffer state every 10 seconds")
+    ("expert.nof_tx_softbuffers", bpo::value<uint32_t>(&args->stack.mac.nof_tx_softbuffers)->default_value(128), "Number of DL HARQ softbuffers shared by all UEs")
+    ("expert.nof_rx_softbuffers", bpo::value<uint32_t>(&args->stack.mac.nof_rx_softbuffers)->default_value(64), "Number of UL HARQ softbuffers shared by all UEs")
+    ("expert.softbuffer_overflow", bpo::value<bool>(&args->stack.mac.softbuffer_overflow)->default_value(true), "Allocate extra HARQ softbuffers when the shared ones are exhausted, instead of skipping grants")
+    ("expert.latency_probes", bpo::value<bool>(&args->general.latency_probes)->default_value(false), "Record per-stage TTI latency histograms, dumped on SIGUSR1")
     ("expert.eea_pref_list", bpo::value<string>(&args->general.eea_pref_list)->default_value("EEA0, EEA2, EEA1"), "Ordered preference list for the selection of encryption algorithm (EEA) (default: EEA0, EEA2, EEA1).")
     ("expert.eia_pref_list", bpo::value<string>(&args->general.eia_pref_list)->default_value("EIA2, EIA1, EIA0"), "Ordered preference list for the selection of integrity algorithm (EIA) (default: EIA2, EIA1, EIA0).")
 
@@ -258,6 +283,20 @@ void parse_args(all_args_t* args, int argc, char* argv[])
 #endif
     ;
 
+  // Thread topology options, one set per thread class
+  common.add_options()
+    ("threads.numa",   bpo::value<bool>(&args->threads.numa)->default_value(false),   "Prefer memory from the NUMA node of the CPUs of each thread class")
+    ("threads.report", bpo::value<bool>(&args->threads.report)->default_value(false), "Print the thread layout at startup even if no class is configured")
+    ;
+  for (const string& cls : srslte::thread_topology::class_names()) {
+    srslte::thread_class_args_t& c = args->threads.classes[cls];
+    common.add_options()
+      (("threads." + cls + ".cpus").c_str(),   bpo::value<string>(&c.cpus)->default_value(""),   "CPU list of the thread class, e.g. 2-5,8")
+      (("threads." + cls + ".policy").c_str(), bpo::value<string>(&c.policy)->default_value(""), "Scheduling policy of the thread class: fifo, rr or other")
+      (("threads." + cls + ".prio").c_str(),   bpo::value<int>(&c.prio)->default_value(-1),      "Scheduling priority of the thread class for fifo and rr")
+      ;
+  }
+
   // Positional options - config file location
   bpo::options_description position("Positional options");
   position.add_options()
@@ -510,9 +549,13 @@ int main(int argc, char* argv[])
   parse_args(&args, argc, argv);
 
   // Setup logging.
-  log_sink = (args.log.filename == "stdout")
-                 ? srslog::create_stdout_sink()
-                 : srslog::create_file_sink(args.log.filename, fixup_log_file_maxsize(args.log.file_max_size));
+  if (args.log.filename == "stdout") {
+    log_sink = srslog::create_stdout_sink();
+  } else if (args.log.binary) {
+    log_sink = &srslog::fetch_binary_file_sink(args.log.filename, fixup_log_file_maxsize(args.log.file_max_size));
+  } else {
+    log_sink = srslog::create_file_sink(args.log.filename, fixup_log_file_maxsize(args.log.file_max_size));
+  }
   if (!log_sink) {
     return SRSLTE_ERROR;
   }
@@ -526,12 +569,22 @@ int main(int argc, char* argv[])
   // Start the log backend.
   srslog::init();
 
+  // Place the threads started from now on, and the log backend which already runs
+  if (not srslte::thread_topology::get().configure(args.threads)) {
+    return SRSLTE_ERROR;
+  }
+
   srslte::logmap::set_default_logger(&log_wrapper);
   srslte::logmap::get("COMMON")->set_level(srslte::LOG_LEVEL_INFO);
   srslte::log_args(argc, argv, "ENB");
 
   srslte::check_scaling_governor(args.rf.device_name);
 
+  if (args.general.latency_probes) {
+    srslte::latency_probes::set_enabled(true);
+    srslte::latency_probes::install_dump_handler(SIGUSR1);
+  }
+
   // Create eNB
   unique_ptr<srsenb::enb> enb{new srsenb::enb};
   if (enb->init(args, &log_wrapper) != SRSLTE_SUCCESS) {
@@ -550,6 +603,10 @@ int main(int argc, char* argv[])
     metrics_file.set_handle(enb.get());
   }
 
+  if (args.threads.report or srslte::thread_topology::get().active()) {
+    srslte::thread_topology::get().print_report(stdout);
+  }
+
   // create input thread
   std::thread input(&input_loop, &metrics_screen, (enb_command_interface*)enb.get());
 
@@ -567,6 +624,9 @@ int main(int argc, char* argv[])
         enb->print_pool();
       }
     }
+    if (srslte::latency_probes::dump_requested()) {
+      srslte::latency_probes::dump(stdout);
+    }
     std::this_thread::sleep_for(std::chrono::milliseconds(10));
   }
   input.join();
@@ -74,9 +74,11 @@ void metrics_csv::set_metrics(const enb_metrics_t& metrics, const uint32_t perio
 
     // Sum up rates for all UEs
     float dl_rate_sum = 0.0, ul_rate_sum = 0.0;
-    for (int i = 0; i < metrics.stack.rrc.n_ues; i++) {
-      dl_rate_sum += metrics.stack.mac[i].tx_brate / (metrics.stack.mac[i].nof_tti * 1e-3);
-      ul_rate_sum += metrics.stack.mac[i].rx_brate / (metrics.stack.mac[i].nof_tti * 1e-3);
+    for (const mac_metrics_t& mac : metrics.stack.mac) {
+      if (mac.nof_tti > 0) {
+        dl_rate_sum += mac.tx_brate / (mac.nof_tti * 1e-3);
+        ul_rate_sum += mac.rx_brate / (mac.nof_tti * 1e-3);
+      }
     }
 
     // DL rate
@@ -22,6 +22,7 @@
 #include "srsenb/hdr/metrics_stdout.h"
 
 #include <float.h>
+#include <inttypes.h>
 #include <iomanip>
 #include <iostream>
 #include <math.h>
@@ -83,6 +84,31 @@ void metrics_stdout::set_metrics(const enb_metrics_t& metrics, const uint32_t pe
     printf("RF status: O=%d, U=%d, L=%d\n", metrics.rf.rf_o, metrics.rf.rf_u, metrics.rf.rf_l);
   }
 
+  const phy_overload_metrics_t& ovl = metrics.phy_overload;
+  if (ovl.level > 0 or ovl.nof_late != last_nof_late_ttis) {
+    printf("PHY overload: level=%d, late TTIs=%" PRIu64 ", min slack=%.0f us\n",
+           ovl.level,
+           ovl.nof_late - last_nof_late_ttis,
+           ovl.min_slack_us);
+  }
+  last_nof_late_ttis = ovl.nof_late;
+
+  const softbuffer_pool_metrics_t& sb_tx         = metrics.stack.softbuffer_tx;
+  const softbuffer_pool_metrics_t& sb_rx         = metrics.stack.softbuffer_rx;
+  uint64_t                         nof_exhausted = sb_tx.nof_exhausted + sb_rx.nof_exhausted;
+  if (nof_exhausted != last_nof_exhausted_softbuffers) {
+    printf("Softbuffers exhausted: DL %d/%d in use (peak %d), UL %d/%d in use (peak %d), %.1f MB, misses=%" PRIu64 "\n",
+           sb_tx.in_use,
+           sb_tx.capacity,
+           sb_tx.peak,
+           sb_rx.in_use,
+           sb_rx.capacity,
+           sb_rx.peak,
+           (sb_tx.nof_bytes + sb_rx.nof_bytes) / 1e6,
+           nof_exhausted - last_nof_exhausted_softbuffers);
+  }
+  last_nof_exhausted_softbuffers = nof_exhausted;
+
   if (metrics.stack.rrc.n_ues == 0) {
     return;
   }
@@ -19,6 +19,7 @@
  *
  */
 
+#include "srslte/common/latency_probe.h"
 #include "srslte/common/log.h"
 #include "srslte/common/threads.h"
 #include "srslte/srslte.h"
@@ -297,6 +298,9 @@ void cc_worker::decode_pusch_rnti(stack_interface_phy_lte::ul_sched_grant_t& ul_
   // Get UE configuration
   ul_cfg = phy->ue_db.get_ul_config(rnti, cc_idx);
 
+  // Shed decoding load while the PHY is overloaded
+  ul_cfg.pusch.max_nof_iterations = phy->deadline.get_pusch_max_its(ul_cfg.pusch.max_nof_iterations);
+
   // Fill UCI configuration
   bool uci_required =
       phy->ue_db.fill_uci_cfg(tti_rx, cc_idx, rnti, ul_grant.dci.cqi_request, true, ul_cfg.pusch.uci_cfg);
@@ -322,7 +326,12 @@ void cc_worker::decode_pusch_rnti(stack_interface_phy_lte::ul_sched_grant_t& ul_
   ul_cfg.pusch.softbuffers.rx = ul_grant.softbuffer_rx;
   pusch_res.data              = ul_grant.data;
   if (pusch_res.data) {
-    if (srslte_enb_ul_get_pusch(&enb_ul, &ul_sf, &ul_cfg.pusch, &pusch_res)) {
+    int ret;
+    {
+      SRSLTE_LATENCY_PROBE(sch_decode);
+      ret = srslte_enb_ul_get_pusch(&enb_ul, &ul_sf, &ul_cfg.pusch, &pusch_res);
+    }
+    if (ret) {
       Error("Decoding PUSCH for RNTI %x\n", rnti);
       return;
     }
@@ -352,7 +361,10 @@ void cc_worker::decode_pusch_rnti(stack_interface_phy_lte::ul_sched_grant_t& ul_
   // Save statistics only if data was provided
   if (ul_grant.data != nullptr) {
     // Save metrics stats
-    ue_db[rnti]->metrics_ul(ul_grant.dci.tb.mcs_idx, 0, enb_ul.chest_res.snr_db, pusch_res.avg_iterations_block);
+    ue_metrics_slot_t* metrics = phy->get_ue_metrics(rnti);
+    if (metrics != nullptr) {
+      metrics->phy_ul(cc_idx, ul_grant.dci.tb.mcs_idx, 0, enb_ul.chest_res.snr_db, pusch_res.avg_iterations_block);
+    }
   }
 }
 
@@ -524,8 +536,9 @@ int cc_worker::encode_pmch(stack_interface_phy_lte::dl_sched_grant_t* grant, srs
   }
 
   // Save metrics stats
-  if (ue_db.count(SRSLTE_MRNTI)) {
-    ue_db[SRSLTE_MRNTI]->metrics_dl(mbsfn_cfg->mbsfn_mcs);
+  ue_metrics_slot_t* metrics = phy->get_ue_metrics(SRSLTE_MRNTI);
+  if (metrics != nullptr) {
+    metrics->phy_dl(cc_idx, mbsfn_cfg->mbsfn_mcs);
   }
   return SRSLTE_SUCCESS;
 }
@@ -553,7 +566,12 @@ int cc_worker::encode_pdsch(stack_interface_phy_lte::dl_sched_grant_t* grants, u
       }
 
       // Encode PDSCH
-      if (srslte_enb_dl_put_pdsch(&enb_dl, &dl_cfg.pdsch, grants[i].data)) {
+      int ret;
+      {
+        SRSLTE_LATENCY_PROBE(pdsch_encode);
+        ret = srslte_enb_dl_put_pdsch(&enb_dl, &dl_cfg.pdsch, grants[i].data);
+      }
+      if (ret) {
         Error("Error putting PDSCH %d\n", i);
         return SRSLTE_ERROR;
       }
@@ -572,7 +590,10 @@ int cc_worker::encode_pdsch(stack_interface_phy_lte::dl_sched_grant_t* grants, u
       }
 
       // Save metrics stats
-      ue_db[rnti]->metrics_dl(grants[i].dci.tb[0].mcs_idx);
+      ue_metrics_slot_t* metrics = phy->get_ue_metrics(rnti);
+      if (metrics != nullptr) {
+        metrics->phy_dl(cc_idx, grants[i].dci.tb[0].mcs_idx);
+      }
     } else {
       Error("User rnti=0x%x not found in cc_worker=%d\n", rnti, cc_idx);
     }
@@ -583,46 +604,6 @@ int cc_worker::encode_pdsch(stack_interface_phy_lte::dl_sched_grant_t* grants, u
   return SRSLTE_SUCCESS;
 }
 
-/************ METRICS interface ********************/
-uint32_t cc_worker::get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS])
-{
-  std::lock_guard<std::mutex> lock(mutex);
-  uint32_t                    cnt = 0;
-  for (auto& ue : ue_db) {
-    if ((SRSLTE_RNTI_ISUSER(ue.first) || ue.first == SRSLTE_MRNTI) && cnt < ENB_METRICS_MAX_USERS) {
-      ue.second->metrics_read(&metrics[cnt]);
-#ifdef ENABLE_RIC_AGENT_KPM
-      metrics[cnt].cc_idx = cc_idx;
-#endif
-      cnt++;
-    }
-  }
-  return cnt;
-}
-
-void cc_worker::ue::metrics_read(phy_metrics_t* metrics_)
-{
-  if (metrics_) {
-    *metrics_ = metrics;
-  }
-  bzero(&metrics, sizeof(phy_metrics_t));
-}
-
-void cc_worker::ue::metrics_dl(uint32_t mcs)
-{
-  metrics.dl.mcs = SRSLTE_VEC_CMA(mcs, metrics.dl.mcs, metrics.dl.n_samples);
-  metrics.dl.n_samples++;
-}
-
-void cc_worker::ue::metrics_ul(uint32_t mcs, float rssi, float sinr, float turbo_iters)
-{
-  metrics.ul.mcs         = SRSLTE_VEC_CMA((float)mcs, metrics.ul.mcs, metrics.ul.n_samples);
-  metrics.ul.sinr        = SRSLTE_VEC_CMA((float)sinr, metrics.ul.sinr, metrics.ul.n_samples);
-  metrics.ul.rssi        = SRSLTE_VEC_CMA((float)rssi, metrics.ul.rssi, metrics.ul.n_samples);
-  metrics.ul.turbo_iters = SRSLTE_VEC_CMA((float)turbo_iters, metrics.ul.turbo_iters, metrics.ul.n_samples);
-  metrics.ul.n_samples++;
-}
-
 int cc_worker::read_ce_abs(float* ce_abs)
 {
   int sz = srslte_symbol_sz(phy->get_nof_prb(cc_idx));
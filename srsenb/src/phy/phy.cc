@@ -78,7 +78,8 @@ void phy::parse_common_config(const phy_cfg_t& cfg)
 int phy::init(const phy_args_t&            args,
               const phy_cfg_t&             cfg,
               srslte::radio_interface_phy* radio_,
-              stack_interface_phy_lte*     stack_)
+              stack_interface_phy_lte*     stack_,
+              ue_metrics_registry*         ue_metrics_)
 {
   mlockall((uint32_t)MCL_CURRENT | (uint32_t)MCL_FUTURE);
 
@@ -110,10 +111,14 @@ int phy::init(const phy_args_t&            args,
   radio       = radio_;
   nof_workers = args.nof_phy_threads;
 
-  workers_common.params = args;
+  workers_common.params     = args;
+  workers_common.ue_metrics = ue_metrics_;
 
   workers_common.init(cfg.phy_cell_cfg, radio, stack_);
 
+  // Samples of a subframe are complete one subframe after its RX timestamp, and due at the TX timestamp
+  workers_common.deadline.init(args.overload, (FDD_HARQ_DELAY_UL_MS - 1) * 1000, log_h);
+
   parse_common_config(cfg);
 
   // Add workers to workers pool and start threads
@@ -125,7 +130,13 @@ int phy::init(const phy_args_t&            args,
   // For each carrier, initialise PRACH worker
   for (uint32_t cc = 0; cc < cfg.phy_cell_cfg.size(); cc++) {
     prach_cfg.root_seq_idx = cfg.phy_cell_cfg[cc].root_seq_idx;
-    prach.init(cc, cfg.phy_cell_cfg[cc].cell, prach_cfg, stack_, log_vec.at(0).get(), PRACH_WORKER_THREAD_PRIO);
+    prach.init(cc,
+               cfg.phy_cell_cfg[cc].cell,
+               prach_cfg,
+               stack_,
+               log_vec.at(0).get(),
+               PRACH_WORKER_THREAD_PRIO,
+               args.nof_prach_threads);
   }
   prach.set_max_prach_offset_us(args.max_prach_offset_us);
 
@@ -190,39 +201,14 @@ void phy::set_activation_deactivation_scell(uint16_t rnti, const std::array<bool
   }
 }
 
-void phy::get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS])
+void phy::cmd_cell_gain(uint32_t cell_id, float gain_db)
 {
-  phy_metrics_t metrics_tmp[ENB_METRICS_MAX_USERS] = {};
-
-  uint32_t nof_users = workers[0].get_nof_rnti();
-  bzero(metrics, sizeof(phy_metrics_t) * ENB_METRICS_MAX_USERS);
-  for (uint32_t i = 0; i < nof_workers; i++) {
-    workers[i].get_metrics(metrics_tmp);
-    for (uint32_t j = 0; j < nof_users; j++) {
-      metrics[j].dl.n_samples += metrics_tmp[j].dl.n_samples;
-      metrics[j].dl.mcs += metrics_tmp[j].dl.n_samples * metrics_tmp[j].dl.mcs;
-
-      metrics[j].ul.n_samples += metrics_tmp[j].ul.n_samples;
-      metrics[j].ul.mcs += metrics_tmp[j].ul.n_samples * metrics_tmp[j].ul.mcs;
-      metrics[j].ul.n += metrics_tmp[j].ul.n_samples * metrics_tmp[j].ul.n;
-      metrics[j].ul.rssi += metrics_tmp[j].ul.n_samples * metrics_tmp[j].ul.rssi;
-      metrics[j].ul.sinr += metrics_tmp[j].ul.n_samples * metrics_tmp[j].ul.sinr;
-      metrics[j].ul.turbo_iters += metrics_tmp[j].ul.n_samples * metrics_tmp[j].ul.turbo_iters;
-    }
-  }
-  for (uint32_t j = 0; j < nof_users; j++) {
-    metrics[j].dl.mcs /= metrics[j].dl.n_samples;
-    metrics[j].ul.mcs /= metrics[j].ul.n_samples;
-    metrics[j].ul.n /= metrics[j].ul.n_samples;
-    metrics[j].ul.rssi /= metrics[j].ul.n_samples;
-    metrics[j].ul.sinr /= metrics[j].ul.n_samples;
-    metrics[j].ul.turbo_iters /= metrics[j].ul.n_samples;
-  }
+  workers_common.set_cell_gain(cell_id, gain_db);
 }
 
-void phy::cmd_cell_gain(uint32_t cell_id, float gain_db)
+void phy::get_overload_metrics(phy_overload_metrics_t* m)
 {
-  workers_common.set_cell_gain(cell_id, gain_db);
+  workers_common.deadline.get_metrics(m);
 }
 
 /***** RRC->PHY interface **********/
@@ -125,11 +125,19 @@ void phy_common::set_ul_grants(uint32_t tti, const stack_interface_phy_lte::ul_s
  * Each worker uses this function to indicate that all processing is done and data is ready for transmission or
  * there is no transmission at all (tx_enable). In that case, the end of burst message will be sent to the radio
  */
-void phy_common::worker_end(void* tx_sem_id, srslte::rf_buffer_t& buffer, srslte::rf_timestamp_t& tx_time)
+void phy_common::worker_end(void*                            tx_sem_id,
+                            srslte::rf_buffer_t&             buffer,
+                            srslte::rf_timestamp_t&          tx_time,
+                            tti_deadline_monitor::time_point rx_time)
 {
   // Wait for the green light to transmit in the current TTI
   semaphore.wait(tx_sem_id);
 
+  // Measure the slack in TX order, and shed scheduled load if the degradation level changes
+  if (deadline.tti_done(rx_time)) {
+    stack->set_overload_limits(deadline.get_sched_limits());
+  }
+
   // Run DL channel emulator if created
   if (dl_channel) {
     dl_channel->run(buffer.to_cf_t(), buffer.to_cf_t(), buffer.get_nof_samples(), tx_time.get(0));
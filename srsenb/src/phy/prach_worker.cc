@@ -28,12 +28,14 @@ int prach_worker::init(const srslte_cell_t&      cell_,
                        const srslte_prach_cfg_t& prach_cfg_,
                        stack_interface_phy_lte*  stack_,
                        srslte::log*              log_h_,
-                       int                       priority)
+                       int                       priority,
+                       srslte::task_thread_pool* corr_pool_)
 {
   log_h     = log_h_;
   stack     = stack_;
   prach_cfg = prach_cfg_;
   cell      = cell_;
+  corr_pool = corr_pool_;
 
   max_prach_offset_us = 50;
 
@@ -48,6 +50,10 @@ int prach_worker::init(const srslte_cell_t&      cell_,
 
   srslte_prach_set_detect_factor(&prach, 60);
 
+  if (corr_pool) {
+    srslte_prach_set_executor(&prach, correlate_batches, this);
+  }
+
   nof_sf = (uint32_t)ceilf(prach.T_tot * 1000);
 
   start(priority);
@@ -85,6 +91,38 @@ void prach_worker::set_max_prach_offset_us(float delay_us)
   max_prach_offset_us = delay_us;
 }
 
+void prach_worker::correlate_batches(void* arg, uint32_t nof_batches)
+{
+  static_cast<prach_worker*>(arg)->run_batches(nof_batches);
+}
+
+void prach_worker::run_batches(uint32_t nof_batches)
+{
+  if (nof_batches == 0) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(tasks_mutex);
+    tasks_pending = nof_batches - 1;
+  }
+
+  // The first batch is correlated by this thread while the pool takes the rest
+  for (uint32_t b = 1; b < nof_batches; b++) {
+    corr_pool->push_task([this, b](uint32_t worker_id) {
+      srslte_prach_correlate_batch(&prach, b);
+      std::lock_guard<std::mutex> lock(tasks_mutex);
+      if (--tasks_pending == 0) {
+        tasks_cvar.notify_all();
+      }
+    });
+  }
+  srslte_prach_correlate_batch(&prach, 0);
+
+  std::unique_lock<std::mutex> lock(tasks_mutex);
+  tasks_cvar.wait(lock, [this]() { return tasks_pending == 0; });
+}
+
 int prach_worker::new_tti(uint32_t tti_rx, cf_t* buffer_rx)
 {
   // Save buffer only if it's a PRACH TTI
@@ -19,6 +19,7 @@
  *
  */
 
+#include "srslte/common/latency_probe.h"
 #include "srslte/common/log.h"
 #include "srslte/common/threads.h"
 #include "srslte/srslte.h"
@@ -123,6 +124,7 @@ void sf_worker::set_time(uint32_t tti_, uint32_t tx_worker_cnt_, const srslte::r
 
   tx_worker_cnt = tx_worker_cnt_;
   tx_time.copy(tx_time_);
+  rx_time = tti_deadline_monitor::clock::now();
 
   for (auto& w : cc_workers) {
     w->set_tti(tti_);
@@ -179,7 +181,7 @@ void sf_worker::work_imp()
   }
 
   if (!running) {
-    phy->worker_end(this, tx_buffer, tx_time);
+    phy->worker_end(this, tx_buffer, tx_time, rx_time);
     return;
   }
 
@@ -207,22 +209,25 @@ void sf_worker::work_imp()
   phy->ue_db.set_ul_grant_available(tti_rx, ul_grants);
 
   // Process UL
-  for (uint32_t cc = 0; cc < cc_workers.size(); cc++) {
-    cc_workers[cc]->work_ul(ul_sf, ul_grants[cc]);
+  {
+    SRSLTE_LATENCY_PROBE(worker_ul);
+    for (uint32_t cc = 0; cc < cc_workers.size(); cc++) {
+      cc_workers[cc]->work_ul(ul_sf, ul_grants[cc]);
+    }
   }
 
   // Get DL scheduling for the TX TTI from MAC
   if (sf_type == SRSLTE_SF_NORM) {
     if (stack->get_dl_sched(tti_tx_dl, dl_grants) < 0) {
       Error("Getting DL scheduling from MAC\n");
-      phy->worker_end(this, tx_buffer, tx_time);
+      phy->worker_end(this, tx_buffer, tx_time, rx_time);
       return;
     }
   } else {
     dl_grants[0].cfi = mbsfn_cfg.non_mbsfn_region_length;
     if (stack->get_mch_sched(tti_tx_dl, mbsfn_cfg.is_mcch, dl_grants)) {
       Error("Getting MCH packets from MAC\n");
-      phy->worker_end(this, tx_buffer, tx_time);
+      phy->worker_end(this, tx_buffer, tx_time, rx_time);
       return;
     }
   }
@@ -234,7 +239,7 @@ void sf_worker::work_imp()
   // Get UL scheduling for the TX TTI from MAC
   if (stack->get_ul_sched(tti_tx_ul, ul_grants_tx) < 0) {
     Error("Getting UL scheduling from MAC\n");
-    phy->worker_end(this, tx_buffer, tx_time);
+    phy->worker_end(this, tx_buffer, tx_time, rx_time);
     return;
   }
 
@@ -247,9 +252,12 @@ void sf_worker::work_imp()
   phy->ue_db.clear_tti_pending_ack(tti_tx_ul);
 
   // Process DL
-  for (uint32_t cc = 0; cc < cc_workers.size(); cc++) {
-    dl_sf.cfi = dl_grants[cc].cfi;
-    cc_workers[cc]->work_dl(dl_sf, dl_grants[cc], ul_grants_tx[cc], &mbsfn_cfg);
+  {
+    SRSLTE_LATENCY_PROBE(worker_dl);
+    for (uint32_t cc = 0; cc < cc_workers.size(); cc++) {
+      dl_sf.cfi = dl_grants[cc].cfi;
+      cc_workers[cc]->work_dl(dl_sf, dl_grants[cc], ul_grants_tx[cc], &mbsfn_cfg);
+    }
   }
 
   // Save grants
@@ -258,7 +266,7 @@ void sf_worker::work_imp()
 
   Debug("Sending to radio\n");
   tx_buffer.set_nof_samples(SRSLTE_SF_LEN_PRB(phy->get_nof_prb(0)));
-  phy->worker_end(this, tx_buffer, tx_time);
+  phy->worker_end(this, tx_buffer, tx_time, rx_time);
 
 #ifdef DEBUG_WRITE_FILE
   fwrite(signal_buffer_tx, SRSLTE_SF_LEN_PRB(phy->cell.nof_prb) * sizeof(cf_t), 1, f);
@@ -279,29 +287,6 @@ void sf_worker::work_imp()
 #endif
 }
 
-/************ METRICS interface ********************/
-uint32_t sf_worker::get_metrics(phy_metrics_t metrics[ENB_METRICS_MAX_USERS])
-{
-  uint32_t      cnt                             = 0;
-  phy_metrics_t _metrics[ENB_METRICS_MAX_USERS] = {};
-  for (uint32_t cc = 0; cc < phy->get_nof_carriers(); cc++) {
-    cnt = cc_workers[cc]->get_metrics(_metrics);
-    for (uint32_t r = 0; r < cnt; r++) {
-      phy_metrics_t* m  = &metrics[r];
-      phy_metrics_t* _m = &_metrics[r];
-      m->dl.mcs         = SRSLTE_VEC_PMA(m->dl.mcs, m->dl.n_samples, _m->dl.mcs, _m->dl.n_samples);
-      m->dl.n_samples += _m->dl.n_samples;
-      m->ul.n           = SRSLTE_VEC_PMA(m->ul.n, m->ul.n_samples, _m->ul.n, _m->ul.n_samples);
-      m->ul.sinr        = SRSLTE_VEC_PMA(m->ul.sinr, m->ul.n_samples, _m->ul.sinr, _m->ul.n_samples);
-      m->ul.mcs         = SRSLTE_VEC_PMA(m->ul.mcs, m->ul.n_samples, _m->ul.mcs, _m->ul.n_samples);
-      m->ul.rssi        = SRSLTE_VEC_PMA(m->ul.rssi, m->ul.n_samples, _m->ul.rssi, _m->ul.n_samples);
-      m->ul.turbo_iters = SRSLTE_VEC_PMA(m->ul.turbo_iters, m->ul.n_samples, _m->ul.turbo_iters, _m->ul.n_samples);
-      m->ul.n_samples += _m->ul.n_samples;
-    }
-  }
-  return cnt;
-}
-
 void sf_worker::start_plot()
 {
 #ifdef ENABLE_GUI
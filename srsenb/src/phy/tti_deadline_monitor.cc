@@ -0,0 +1,129 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsenb/hdr/phy/tti_deadline_monitor.h"
+#include <algorithm>
+
+namespace srsenb {
+
+void tti_deadline_monitor::init(const phy_overload_args_t& args_, uint32_t budget_us_, srslte::log* log_h_)
+{
+  args      = args_;
+  budget_us = budget_us_;
+  log_h     = log_h_;
+
+  args.window_ms = std::max(args.window_ms, 1u);
+  args.max_level = args.enable ? std::min(args.max_level, MAX_LEVEL) : 0;
+}
+
+bool tti_deadline_monitor::tti_done_slack(float slack_us)
+{
+  uint32_t cur_level = level.load(std::memory_order_relaxed);
+  bool     tight     = slack_us < (float)args.slack_threshold_us;
+
+  nof_ttis.fetch_add(1, std::memory_order_relaxed);
+  if (slack_us < 0) {
+    nof_late.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (tight) {
+    nof_tight.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (cur_level > 0) {
+    nof_degraded_ttis.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  win_min_slack = (win_ttis == 0) ? slack_us : std::min(win_min_slack, slack_us);
+  win_sum_slack += slack_us;
+  win_tight += tight ? 1 : 0;
+  win_ttis++;
+  if (win_ttis < args.window_ms) {
+    return false;
+  }
+
+  // Evaluate the window and start a new one
+  float ratio = (float)win_tight / win_ttis;
+  last_min_slack_us.store(win_min_slack, std::memory_order_relaxed);
+  last_avg_slack_us.store(win_sum_slack / win_ttis, std::memory_order_relaxed);
+  win_ttis      = 0;
+  win_tight     = 0;
+  win_sum_slack = 0;
+
+  uint32_t new_level = cur_level;
+  if (ratio >= args.enter_ratio and cur_level < args.max_level) {
+    new_level++;
+    nof_escalations.fetch_add(1, std::memory_order_relaxed);
+  } else if (ratio <= args.exit_ratio and cur_level > 0) {
+    new_level--;
+  }
+  if (new_level == cur_level) {
+    return false;
+  }
+  level.store(new_level, std::memory_order_relaxed);
+
+  if (log_h) {
+    log_h->warning("PHY overload: %.1f%% of the last %d TTIs had less than %d us slack (min %.0f us). "
+                   "Degradation level %d -> %d\n",
+                   ratio * 100,
+                   args.window_ms,
+                   args.slack_threshold_us,
+                   last_min_slack_us.load(std::memory_order_relaxed),
+                   cur_level,
+                   new_level);
+  }
+  return true;
+}
+
+uint32_t tti_deadline_monitor::get_pusch_max_its(uint32_t configured) const
+{
+  if (get_level() >= 1 and args.pusch_max_its > 0) {
+    return std::min(configured, (uint32_t)args.pusch_max_its);
+  }
+  return configured;
+}
+
+sched_interface::overload_limits_t tti_deadline_monitor::get_sched_limits() const
+{
+  sched_interface::overload_limits_t limits = {};
+  uint32_t                           l      = get_level();
+  if (l >= 2) {
+    limits.max_dl_users  = args.max_users;
+    limits.max_ul_users  = args.max_users;
+    limits.max_prb_ratio = args.max_prb_ratio;
+  }
+  if (l >= 3) {
+    limits.dl_ctrl_only = true;
+  }
+  return limits;
+}
+
+void tti_deadline_monitor::get_metrics(phy_overload_metrics_t* m) const
+{
+  m->nof_ttis          = nof_ttis.load(std::memory_order_relaxed);
+  m->nof_late          = nof_late.load(std::memory_order_relaxed);
+  m->nof_tight         = nof_tight.load(std::memory_order_relaxed);
+  m->nof_degraded_ttis = nof_degraded_ttis.load(std::memory_order_relaxed);
+  m->nof_escalations   = nof_escalations.load(std::memory_order_relaxed);
+  m->min_slack_us      = last_min_slack_us.load(std::memory_order_relaxed);
+  m->avg_slack_us      = last_avg_slack_us.load(std::memory_order_relaxed);
+  m->level             = get_level();
+}
+
+} // namespace srsenb
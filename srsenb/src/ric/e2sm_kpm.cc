@@ -147,7 +147,7 @@ void metrics::update(srsenb::enb_metrics_t *em)
   ues.clear();
 
   /* Count per-period things. */
-  for (uint16_t i = 0; i < em->stack.rrc.n_ues && i < ENB_METRICS_MAX_USERS; ++i) {
+  for (size_t i = 0; i < em->stack.rrc.ues.size(); ++i) {
     if (em->stack.rrc.ues[i].state == srsenb::RRC_STATE_REGISTERED)
       ++active_ue_count;
   }
@@ -163,7 +163,7 @@ void metrics::update(srsenb::enb_metrics_t *em)
   std::map<uint16_t,bool> ues_present;
 
   /* Handle PDCP counters. */
-  for (uint16_t i = 0; i < em->stack.pdcp.n_ues && i < ENB_METRICS_MAX_USERS; ++i) {
+  for (size_t i = 0; i < em->stack.pdcp.ues.size(); ++i) {
     uint16_t rnti = em->stack.pdcp.ues[i].rnti;
     if (rnti == 0)
       continue;
@@ -211,11 +211,10 @@ void metrics::update(srsenb::enb_metrics_t *em)
   /*
    * Handle MAC counters.
    *
-   * NB: these zero on every read, so this is broken for > 1 subscription.
-   * ... except the RB counters are read every time from sched_ue objects,
-   * and those counters are total.
+   * NB: each period samples through its own ue_metrics_reader, so these
+   * are already per-period values; the RB counters are scheduler totals.
    */
-  for (uint16_t i = 0; i < ENB_METRICS_MAX_USERS; ++i) {
+  for (size_t i = 0; i < em->stack.mac.size(); ++i) {
     uint16_t rnti = em->stack.mac[i].rnti;
     if (rnti == 0)
       continue;
@@ -591,7 +590,7 @@ void kpm_model::send_indications(int timer_id)
   E2SM_KPM_PerQCIReportListItemFormat_t *epc_cu_up_report_item;
   E2SM_KPM_PlmnID_List_t *epc_cu_up_plmnid_item;
   int period;
-  srsenb::enb_metrics_t em;
+  srsenb::enb_metrics_t em = {};
   metrics *dm;
 
   /*
@@ -619,8 +618,7 @@ void kpm_model::send_indications(int timer_id)
   /*
    * First, we grab all the RF data and process it.
    */
-  memset(&em,0,sizeof(em));
-  agent->enb_metrics_interface->get_metrics(&em);
+  agent->enb_metrics_interface->get_metrics(&em,periods[period].reader);
   periods[period].last_metrics.update(&em);
   dm = &periods[period].last_metrics;
 #ifdef ENABLE_SLICER
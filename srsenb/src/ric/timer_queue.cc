@@ -1,5 +1,6 @@
 
 #include "srsenb/hdr/ric/timer_queue.h"
+#include "srslte/common/thread_topology.h"
 
 namespace ric {
 
@@ -41,6 +42,7 @@ void *timer_queue::run(void *arg)
   timer_queue *tq = (timer_queue *)arg;
 
   pthread_setname_np(pthread_self(),tq->get_name().c_str());
+  srslte::thread_topology::get().apply_self(tq->get_name());
 
   pthread_mutex_lock(&tq->lock);
   while (tq->running) {
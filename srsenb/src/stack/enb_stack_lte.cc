@@ -32,6 +32,14 @@ using namespace srslte;
 
 namespace srsenb {
 
+static srslte::pcap_writer_args_t make_pcap_writer_args(const pcap_args_t& pcap_args)
+{
+  srslte::pcap_writer_args_t writer_args;
+  writer_args.max_file_size_mb = pcap_args.max_size_mb;
+  writer_args.rotate_period_s  = pcap_args.rotate_period_s;
+  return writer_args;
+}
+
 enb_stack_lte::enb_stack_lte(srslte::logger* logger_) :
   task_sched(512, 0, 128),
   logger(logger_),
@@ -59,9 +67,13 @@ std::string enb_stack_lte::get_type()
   return "lte";
 }
 
-int enb_stack_lte::init(const stack_args_t& args_, const rrc_cfg_t& rrc_cfg_, phy_interface_stack_lte* phy_)
+int enb_stack_lte::init(const stack_args_t&      args_,
+                        const rrc_cfg_t&         rrc_cfg_,
+                        phy_interface_stack_lte* phy_,
+                        ue_metrics_registry*     ue_metrics_)
 {
-  phy = phy_;
+  phy        = phy_;
+  ue_metrics = ue_metrics_;
   if (init(args_, rrc_cfg_)) {
     return SRSLTE_ERROR;
   }
@@ -96,11 +108,16 @@ int enb_stack_lte::init(const stack_args_t& args_, const rrc_cfg_t& rrc_cfg_)
 
   // Set up pcap and trace
   if (args.mac_pcap.enable) {
-    mac_pcap.open(args.mac_pcap.filename.c_str());
+    srslte::pcap_filter filter;
+    if (not filter.set_rntis(args.mac_pcap.rnti_filter)) {
+      stack_log->error("Invalid pcap.rnti_filter \"%s\", capturing all RNTIs\n", args.mac_pcap.rnti_filter.c_str());
+    }
+    mac_pcap.set_filter(filter);
+    mac_pcap.open(args.mac_pcap.filename.c_str(), 0, make_pcap_writer_args(args.mac_pcap));
     mac.start_pcap(&mac_pcap);
   }
   if (args.s1ap_pcap.enable) {
-    s1ap_pcap.open(args.s1ap_pcap.filename.c_str());
+    s1ap_pcap.open(args.s1ap_pcap.filename.c_str(), make_pcap_writer_args(args.s1ap_pcap));
     s1ap.start_pcap(&s1ap_pcap);
   }
 
@@ -111,10 +128,10 @@ int enb_stack_lte::init(const stack_args_t& args_, const rrc_cfg_t& rrc_cfg_)
   sync_task_queue = task_sched.make_task_queue(args.sync_queue_size);
 
   // Init all layers
-  mac.init(args.mac, rrc_cfg.cell_list, phy, &rlc, &rrc, mac_log);
+  mac.init(args.mac, rrc_cfg.cell_list, phy, &rlc, &rrc, mac_log, ue_metrics);
   rlc.init(&pdcp, &rrc, &mac, task_sched.get_timer_handler(), rlc_log);
-  pdcp.init(&rlc, &rrc, &gtpu);
-  rrc.init(rrc_cfg, phy, &mac, &rlc, &pdcp, &s1ap, &gtpu);
+  pdcp.init(&rlc, &rrc, &gtpu, ue_metrics);
+  rrc.init(rrc_cfg, phy, &mac, &rlc, &pdcp, &s1ap, &gtpu, ue_metrics);
   if (s1ap.init(args.s1ap, &rrc, this) != SRSLTE_SUCCESS) {
     stack_log->error("Couldn't initialize S1AP\n");
     return SRSLTE_ERROR;
@@ -180,24 +197,11 @@ void enb_stack_lte::stop_impl()
 
 bool enb_stack_lte::get_metrics(stack_metrics_t* metrics)
 {
-  // use stack thread to query metrics
-  auto ret = enb_task_queue.try_push([this]() {
-    stack_metrics_t metrics{};
-    mac.get_metrics(metrics.mac);
-    rrc.get_metrics(metrics.rrc);
-#ifdef ENABLE_RIC_AGENT_KPM
-    pdcp.get_metrics(metrics.pdcp);
-#endif
-    s1ap.get_metrics(metrics.s1ap);
-    pending_stack_metrics.push(metrics);
-  });
-
-  if (ret.first) {
-    // wait for result
-    *metrics = pending_stack_metrics.wait_pop();
-    return true;
-  }
-  return false;
+  // Per-UE metrics are read from the ue_metrics_registry by the caller, only the S1AP status and the MAC softbuffer
+  // pools are left here. They are read directly, so that metrics consumers never wait on the stack thread
+  s1ap.get_metrics(metrics->s1ap);
+  mac.get_softbuffer_metrics(metrics->softbuffer_tx, metrics->softbuffer_rx);
+  return true;
 }
 
 void enb_stack_lte::run_thread()
@@ -237,13 +241,14 @@ void enb_stack_lte::remove_mme_socket(int fd)
 
 void enb_stack_lte::add_gtpu_s1u_socket_handler(int fd)
 {
-  auto gtpu_s1u_handler = [this](srslte::unique_byte_buffer_t pdu, const sockaddr_in& from) {
-    auto task_handler = [this, from](srslte::unique_byte_buffer_t& t) {
-      gtpu.handle_gtpu_s1u_rx_packet(std::move(t), from);
+  // All the packets pending in the socket are read at once and deferred to the stack thread as a single task
+  auto gtpu_s1u_handler = [this](srslte::unique_byte_buffer_list_t pdus, std::vector<sockaddr_in> from) {
+    auto task_handler = [this](srslte::unique_byte_buffer_list_t& t, const std::vector<sockaddr_in>& f) {
+      gtpu.handle_gtpu_s1u_rx_packets(std::move(t), f);
     };
-    gtpu_task_queue.push(std::bind(task_handler, std::move(pdu)));
+    gtpu_task_queue.push(std::bind(task_handler, std::move(pdus), std::move(from)));
   };
-  rx_sockets->add_socket_pdu_handler(fd, gtpu_s1u_handler);
+  rx_sockets->add_socket_pdu_batch_handler(fd, gtpu_s1u_handler);
 }
 
 void enb_stack_lte::add_gtpu_m1u_socket_handler(int fd)
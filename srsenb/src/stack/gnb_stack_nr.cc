@@ -166,7 +166,7 @@ void gnb_stack_nr::process_pdus()
 
 bool gnb_stack_nr::get_metrics(srsenb::stack_metrics_t* metrics)
 {
-  m_mac->get_metrics(metrics->mac);
+  m_mac->get_metrics(metrics->mac.data());
   m_rrc->get_metrics(metrics->rrc);
   return true;
 }
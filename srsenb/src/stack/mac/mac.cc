@@ -26,6 +26,7 @@
 #include <unistd.h>
 
 #include "srsenb/hdr/stack/mac/mac.h"
+#include "srslte/common/latency_probe.h"
 #include "srslte/common/log.h"
 #include "srslte/common/log_helper.h"
 #include "srslte/common/rwlock_guard.h"
@@ -56,15 +57,17 @@ bool mac::init(const mac_args_t&        args_,
                phy_interface_stack_lte* phy,
                rlc_interface_mac*       rlc,
                rrc_interface_mac*       rrc,
-               srslte::log_ref          log_h_)
+               srslte::log_ref          log_h_,
+               ue_metrics_registry*     ue_metrics_)
 {
   started = false;
 
   if (phy && rlc && log_h_) {
-    phy_h = phy;
-    rlc_h = rlc;
-    rrc_h = rrc;
-    log_h = log_h_;
+    phy_h      = phy;
+    rlc_h      = rlc;
+    rrc_h      = rrc;
+    log_h      = log_h_;
+    ue_metrics = ue_metrics_;
 
     args  = args_;
     cells = cells_;
@@ -96,6 +99,13 @@ bool mac::init(const mac_args_t&        args_,
       srslte_softbuffer_tx_init(&cc.rar_softbuffer_tx, args.nof_prb);
     }
 
+    // Softbuffers of the UE HARQ processes, shared by all UEs and cells
+    if (not tx_softbuffers.init(args.nof_prb, args.nof_tx_softbuffers, args.softbuffer_overflow) or
+        not rx_softbuffers.init(args.nof_prb, args.nof_rx_softbuffers, args.softbuffer_overflow)) {
+      Error("Initializing HARQ softbuffer pools\n");
+      return false;
+    }
+
     reset();
 
     // Pre-alloc UE objects for first attaching users
@@ -214,6 +224,9 @@ int mac::ue_cfg(uint16_t rnti, sched_interface::ue_cfg_t* cfg)
   // Start TA FSM in UE entity
   ue_ptr->start_ta();
 
+  // HARQ processes give back their softbuffers after the last retransmission
+  ue_ptr->set_max_harq_tx(cfg->maxharq_tx);
+
   // Add RNTI to the PHY (pregenerate signals) now instead of after PRACH
   if (not ue_ptr->is_phy_added) {
     Info("Registering RNTI=0x%X to PHY...\n", rnti);
@@ -254,6 +267,9 @@ int mac::ue_rem(uint16_t rnti)
   task_sched.defer_callback(FDD_HARQ_DELAY_DL_MS + FDD_HARQ_DELAY_UL_MS, [this, rnti]() {
     phy_h->rem_rnti(rnti);
     ues_to_rem.erase(rnti);
+    if (ue_metrics != nullptr) {
+      ue_metrics->release(rnti);
+    }
     Info("User rnti=0x%x removed from MAC/PHY\n", rnti);
   });
   return SRSLTE_SUCCESS;
@@ -283,14 +299,9 @@ int mac::cell_cfg(const std::vector<sched_interface::cell_cfg_t>& cell_cfg_)
   return scheduler.cell_cfg(cell_config);
 }
 
-void mac::get_metrics(mac_metrics_t metrics[ENB_METRICS_MAX_USERS])
+ue_metrics_slot_t* mac::claim_ue_metrics(uint16_t rnti)
 {
-  srslte::rwlock_read_guard lock(rwlock);
-  int                       cnt = 0;
-  for (auto& u : ue_db) {
-    u.second->metrics_read(&metrics[cnt]);
-    cnt++;
-  }
+  return ue_metrics != nullptr ? ue_metrics->claim(rnti) : nullptr;
 }
 
 #ifdef ENABLE_SLICER
@@ -330,9 +341,17 @@ int mac::ack_info(uint32_t tti, uint16_t rnti, uint32_t enb_cc_idx, uint32_t tb_
     return SRSLTE_ERROR;
   }
 
-  uint32_t nof_bytes = scheduler.dl_ack_info(tti, rnti, enb_cc_idx, tb_idx, ack);
+  std::pair<uint32_t, int> harq_ack  = scheduler.dl_harq_ack_info(tti, rnti, enb_cc_idx, tb_idx, ack);
+  uint32_t                 nof_bytes = harq_ack.second;
   ue_db[rnti]->metrics_tx(ack, nof_bytes);
 
+  // The softbuffer is released for the HARQ process the scheduler matched the feedback to, only if the scheduler
+  // accepted it. Otherwise the TB may still be retransmitted from it
+  int ue_cc_idx = scheduler.get_enb_ue_cc_map(rnti)[enb_cc_idx];
+  if (ue_cc_idx >= 0 and harq_ack.second >= 0) {
+    ue_db[rnti]->set_tx_softbuffer_ack(ue_cc_idx, harq_ack.first, tb_idx, ack);
+  }
+
   if (ack) {
     if (nof_bytes > 64) { // do not count RLC status messages only
       rrc_h->set_activity_user(rnti);
@@ -369,6 +388,7 @@ int mac::crc_info(uint32_t tti_rx, uint16_t rnti, uint32_t enb_cc_idx, uint32_t
   } else {
     ue_db[rnti]->deallocate_pdu(ue_cc_idx, tti_rx);
   }
+  ue_db[rnti]->set_rx_softbuffer_crc(ue_cc_idx, tti_rx, crc);
 
   // Scheduler uses eNB's CC mapping
   return scheduler.ul_crc_info(tti_rx, rnti, enb_cc_idx, crc);
@@ -486,6 +506,7 @@ uint16_t mac::reserve_new_crnti(const sched_interface::ue_cfg_t& ue_cfg)
   if (pcap != nullptr) {
     ue_ptr->start_pcap(pcap);
   }
+  ue_ptr->set_metrics_slot(claim_ue_metrics(rnti));
 
   {
     srslte::rwlock_write_guard lock(rwlock);
@@ -520,6 +541,7 @@ void mac::rach_detected(uint32_t tti, uint32_t enb_cc_idx, uint32_t preamble_idx
   if (pcap != nullptr) {
     ue_ptr->start_pcap(pcap);
   }
+  ue_ptr->set_metrics_slot(claim_ue_metrics(rnti));
 
   {
     srslte::rwlock_write_guard lock(rwlock);
@@ -575,14 +597,23 @@ void mac::rach_detected(uint32_t tti, uint32_t enb_cc_idx, uint32_t preamble_idx
 void mac::prealloc_ue(uint32_t nof_ue)
 {
   for (uint32_t i = 0; i < nof_ue; i++) {
-    std::unique_ptr<ue> ptr = std::unique_ptr<ue>(
-        new ue(allocate_rnti(), args.nof_prb, &scheduler, rrc_h, rlc_h, phy_h, log_h, cells.size()));
+    std::unique_ptr<ue> ptr = std::unique_ptr<ue>(new ue(allocate_rnti(),
+                                                         args.nof_prb,
+                                                         &tx_softbuffers,
+                                                         &rx_softbuffers,
+                                                         &scheduler,
+                                                         rrc_h,
+                                                         rlc_h,
+                                                         phy_h,
+                                                         log_h,
+                                                         cells.size()));
     ue_pool.push(std::move(ptr));
   }
 }
 
 int mac::get_dl_sched(uint32_t tti_tx_dl, dl_sched_list_t& dl_sched_res_list)
 {
+  SRSLTE_LATENCY_PROBE(mac_dl_sched);
   if (!started) {
     return 0;
   }
@@ -644,11 +675,43 @@ int mac::get_dl_sched(uint32_t tti_tx_dl, dl_sched_list_t& dl_sched_res_list)
           // Copy dci info
           dl_sched_res->pdsch[n].dci = sched_result.data[i].dci;
 
+          // Bind the softbuffers of all the enabled TBs before building any PDU. If the pool is exhausted the whole
+          // grant is dropped, as the PHY cannot encode a TB without softbuffer
+          bool softbuffers_ok = true;
           for (uint32_t tb = 0; tb < SRSLTE_MAX_TB; tb++) {
+            dl_sched_res->pdsch[n].softbuffer_tx[tb] = nullptr;
+            dl_sched_res->pdsch[n].data[tb]          = nullptr;
+
+            // Disabled TBs do not hold a softbuffer
+            if (sched_result.data[i].tbs[tb] == 0) {
+              continue;
+            }
+
             dl_sched_res->pdsch[n].softbuffer_tx[tb] =
-                ue_db[rnti]->get_tx_softbuffer(sched_result.data[i].dci.ue_cc_idx, sched_result.data[i].dci.pid, tb);
+                ue_db[rnti]->get_tx_softbuffer(sched_result.data[i].dci.ue_cc_idx,
+                                               sched_result.data[i].dci.pid,
+                                               tb,
+                                               tti_tx_dl,
+                                               sched_result.data[i].nof_pdu_elems[tb] > 0);
+            if (dl_sched_res->pdsch[n].softbuffer_tx[tb] == nullptr) {
+              softbuffers_ok = false;
+            }
+          }
+          if (not softbuffers_ok) {
+            // Flush the HARQ process, otherwise its retx would be scheduled for a TB that was never encoded
+            Warning("No Tx softbuffer available. Dropping DL grant and flushing HARQ for rnti=0x%x, pid=%d\n",
+                    rnti,
+                    sched_result.data[i].dci.pid);
+            for (uint32_t tb = 0; tb < SRSLTE_MAX_TB; tb++) {
+              ue_db[rnti]->set_tx_softbuffer_ack(
+                  sched_result.data[i].dci.ue_cc_idx, sched_result.data[i].dci.pid, tb, true);
+            }
+            scheduler.dl_harq_flush(rnti, enb_cc_idx, sched_result.data[i].dci.pid);
+            continue;
+          }
 
-            // If the Rx soft-buffer is not given, abort transmission
+          for (uint32_t tb = 0; tb < SRSLTE_MAX_TB; tb++) {
+            // Disabled TB
             if (dl_sched_res->pdsch[n].softbuffer_tx[tb] == nullptr) {
               continue;
             }
@@ -901,12 +964,13 @@ int mac::get_ul_sched(uint32_t tti_tx_ul, ul_sched_list_t& ul_sched_res_list)
 
   log_h->step(TTI_SUB(tti_tx_ul, FDD_HARQ_DELAY_UL_MS + FDD_HARQ_DELAY_DL_MS));
 
-  // Execute TA FSM
+  // Execute TA FSM and reclaim the softbuffers of HARQ processes that got no feedback
   for (auto& ue : ue_db) {
     uint32_t nof_ta_count = ue.second->tick_ta_fsm();
     if (nof_ta_count) {
       scheduler.dl_mac_buffer_state(ue.first, (uint32_t)srslte::dl_sch_lcid::TA_CMD, nof_ta_count);
     }
+    ue.second->release_stale_softbuffers(tti_tx_ul);
   }
 
   for (uint32_t enb_cc_idx = 0; enb_cc_idx < cell_config.size(); enb_cc_idx++) {
@@ -936,15 +1000,15 @@ int mac::get_ul_sched(uint32_t tti_tx_ul, ul_sched_list_t& ul_sched_res_list)
             phy_ul_sched_res->pusch[n].current_tx_nb = sched_result.pusch[i].current_tx_nb;
             phy_ul_sched_res->pusch[n].needs_pdcch   = sched_result.pusch[i].needs_pdcch;
             phy_ul_sched_res->pusch[n].dci           = sched_result.pusch[i].dci;
-            phy_ul_sched_res->pusch[n].softbuffer_rx =
-                ue_db[rnti]->get_rx_softbuffer(sched_result.pusch[i].dci.ue_cc_idx, tti_tx_ul);
+            phy_ul_sched_res->pusch[n].softbuffer_rx = ue_db[rnti]->get_rx_softbuffer(
+                sched_result.pusch[i].dci.ue_cc_idx, tti_tx_ul, sched_result.pusch[i].current_tx_nb);
 
             // If the Rx soft-buffer is not given, abort reception
             if (phy_ul_sched_res->pusch[n].softbuffer_rx == nullptr) {
               continue;
             }
 
-            if (sched_result.pusch[n].current_tx_nb == 0) {
+            if (sched_result.pusch[i].current_tx_nb == 0) {
               srslte_softbuffer_rx_reset_tbs(phy_ul_sched_res->pusch[n].softbuffer_rx, sched_result.pusch[i].tbs * 8);
             }
             phy_ul_sched_res->pusch[n].data =
@@ -983,6 +1047,12 @@ bool mac::process_pdus()
   return ret;
 }
 
+void mac::get_softbuffer_metrics(softbuffer_pool_metrics_t& tx, softbuffer_pool_metrics_t& rx)
+{
+  tx_softbuffers.get_metrics(tx);
+  rx_softbuffers.get_metrics(rx);
+}
+
 void mac::write_mcch(sib_type2_s* sib2_, sib_type13_r9_s* sib13_, mcch_msg_s* mcch_)
 {
   mcch               = *mcch_;
@@ -999,8 +1069,17 @@ void mac::write_mcch(sib_type2_s* sib2_, sib_type13_r9_s* sib13_, mcch_msg_s* mc
   mcch.pack(bref);
   current_mcch_length = bref.distance_bytes(&mcch_payload_buffer[1]);
   current_mcch_length = current_mcch_length + rlc_header_len;
-  ue_db[SRSLTE_MRNTI] =
-      std::unique_ptr<ue>{new ue(SRSLTE_MRNTI, args.nof_prb, &scheduler, rrc_h, rlc_h, phy_h, log_h, cells.size())};
+  ue_db[SRSLTE_MRNTI] = std::unique_ptr<ue>{new ue(SRSLTE_MRNTI,
+                                                   args.nof_prb,
+                                                   &tx_softbuffers,
+                                                   &rx_softbuffers,
+                                                   &scheduler,
+                                                   rrc_h,
+                                                   rlc_h,
+                                                   phy_h,
+                                                   log_h,
+                                                   cells.size())};
+  ue_db[SRSLTE_MRNTI]->set_metrics_slot(claim_ue_metrics(SRSLTE_MRNTI));
 
   rrc_h->add_user(SRSLTE_MRNTI, {});
 }
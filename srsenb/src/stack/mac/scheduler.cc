@@ -24,6 +24,7 @@
 
 #include "srsenb/hdr/stack/mac/scheduler.h"
 #include "srsenb/hdr/stack/mac/scheduler_carrier.h"
+#include "srslte/common/latency_probe.h"
 #include "srslte/common/logmap.h"
 #include "srslte/srslte.h"
 
@@ -195,6 +196,7 @@ int sched::cell_cfg(const std::vector<sched_interface::cell_cfg_t>& cell_cfg)
 #else
     carrier_schedulers[i]->carrier_cfg(sched_cell_params[i]);
 #endif
+    carrier_schedulers[i]->set_overload_limits(overload_limits);
   }
 
   configured = true;
@@ -289,6 +291,21 @@ uint64_t sched::get_ul_rb_total(uint16_t rnti)
   return ret;
 }
 
+bool sched::get_ue_metrics(uint16_t rnti, ue_sched_metrics_t& m)
+{
+  std::lock_guard<std::mutex> lock(sched_mutex);
+  auto                        it = ue_db.find(rnti);
+  if (it == ue_db.end()) {
+    return false;
+  }
+  sched_ue& ue   = it->second;
+  m.ul_buffer    = ue.get_pending_ul_new_data(last_tti.to_uint(), -1);
+  m.dl_buffer    = ue.get_pending_dl_new_data();
+  m.dl_rbg_total = ue.get_dl_rbg_total();
+  m.ul_rb_total  = ue.get_ul_rb_total();
+  return true;
+}
+
 int sched::dl_rlc_buffer_state(uint16_t rnti, uint32_t lc_id, uint32_t tx_queue, uint32_t retx_queue)
 {
   return ue_db_access(rnti, [&](sched_ue& ue) { ue.dl_buffer_state(lc_id, tx_queue, retx_queue); });
@@ -301,11 +318,22 @@ int sched::dl_mac_buffer_state(uint16_t rnti, uint32_t ce_code, uint32_t nof_cmd
 
 int sched::dl_ack_info(uint32_t tti, uint16_t rnti, uint32_t enb_cc_idx, uint32_t tb_idx, bool ack)
 {
-  int ret = -1;
+  return dl_harq_ack_info(tti, rnti, enb_cc_idx, tb_idx, ack).second;
+}
+
+std::pair<uint32_t, int>
+sched::dl_harq_ack_info(uint32_t tti, uint16_t rnti, uint32_t enb_cc_idx, uint32_t tb_idx, bool ack)
+{
+  std::pair<uint32_t, int> ret = {SRSLTE_MAX_HARQ_PROC, -1};
   ue_db_access(rnti, [&](sched_ue& ue) { ret = ue.set_ack_info(tti, enb_cc_idx, tb_idx, ack); }, __PRETTY_FUNCTION__);
   return ret;
 }
 
+void sched::dl_harq_flush(uint16_t rnti, uint32_t enb_cc_idx, uint32_t pid)
+{
+  ue_db_access(rnti, [enb_cc_idx, pid](sched_ue& ue) { ue.reset_dl_harq(enb_cc_idx, pid); }, __PRETTY_FUNCTION__);
+}
+
 int sched::ul_crc_info(uint32_t tti_rx, uint16_t rnti, uint32_t enb_cc_idx, bool crc)
 {
   return ue_db_access(
@@ -364,6 +392,15 @@ void sched::set_dl_tti_mask(uint8_t* tti_mask, uint32_t nof_sfs)
   carrier_schedulers[0]->set_dl_tti_mask(tti_mask, nof_sfs);
 }
 
+void sched::set_overload_limits(const overload_limits_t& limits)
+{
+  std::lock_guard<std::mutex> lock(sched_mutex);
+  overload_limits = limits;
+  for (std::unique_ptr<carrier_sched>& c : carrier_schedulers) {
+    c->set_overload_limits(limits);
+  }
+}
+
 void sched::tpc_inc(uint16_t rnti)
 {
   ue_db_access(rnti, [](sched_ue& ue) { ue.tpc_inc(); }, __PRETTY_FUNCTION__);
@@ -412,6 +449,7 @@ void sched::set_slicer_workshare(bool workshare)
 // Downlink Scheduler API
 int sched::dl_sched(uint32_t tti_tx_dl, uint32_t enb_cc_idx, sched_interface::dl_sched_res_t& sched_result)
 {
+  SRSLTE_LATENCY_PROBE(sched_dl);
   if (!configured) {
     return 0;
   }
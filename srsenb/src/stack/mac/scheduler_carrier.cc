@@ -326,6 +326,11 @@ void sched::carrier_sched::set_dl_tti_mask(uint8_t* tti_mask, uint32_t nof_sfs)
   sf_dl_mask.assign(tti_mask, tti_mask + nof_sfs);
 }
 
+void sched::carrier_sched::set_overload_limits(const sched_interface::overload_limits_t& limits)
+{
+  overload_limits = limits;
+}
+
 #ifdef ENABLE_ZYLINIUM
 bool sched::carrier_sched::set_blocked_rbgmask(const rbgmask_t& mask)
 {
@@ -344,6 +349,8 @@ const cc_sched_result& sched::carrier_sched::generate_tti_result(tti_point tti_r
   sf_sched_result* sf_result = prev_sched_results->get_sf(tti_rx);
   cc_sched_result* cc_result = sf_result->new_cc(enb_cc_idx);
 
+  tti_sched->set_overload_limits(overload_limits);
+
   bool dl_active = sf_dl_mask[tti_sched->get_tti_tx_dl() % sf_dl_mask.size()] == 0;
 
   /* Schedule PHICH */
@@ -401,12 +408,30 @@ void sched::carrier_sched::alloc_dl_users(sf_sched* tti_result)
     }
   }
 
+  // While the PHY is overloaded, leave the upper part of the band unused for user data
+  if (overload_limits.max_prb_ratio < 1.0f) {
+    uint32_t max_rbgs = std::max(1u, (uint32_t)(overload_limits.max_prb_ratio * cc_cfg->nof_rbgs));
+    tti_result->reserve_dl_rbgs(std::min(max_rbgs, cc_cfg->nof_rbgs), cc_cfg->nof_rbgs);
+  }
+
   // call DL scheduler metric to fill RB grid
   dl_metric->sched_users(*ue_db, tti_result);
 }
 
 int sched::carrier_sched::alloc_ul_users(sf_sched* tti_sched)
 {
+  // While the PHY is overloaded, leave the upper part of the PUSCH region unused for user data
+  if (overload_limits.max_prb_ratio < 1.0f) {
+    uint32_t  pusch_start = cc_cfg->cfg.nrb_pucch;
+    uint32_t  pusch_stop  = cc_cfg->nof_prb() - cc_cfg->cfg.nrb_pucch;
+    uint32_t  max_prbs    = std::max(1u, (uint32_t)(overload_limits.max_prb_ratio * (pusch_stop - pusch_start)));
+    prbmask_t overload_mask{cc_cfg->nof_prb()};
+    if (pusch_start + max_prbs < pusch_stop) {
+      overload_mask.fill(pusch_start + max_prbs, pusch_stop);
+      tti_sched->reserve_ul_prbs(overload_mask, false);
+    }
+  }
+
   /* Call scheduler for UL data */
   ul_metric->sched_users(*ue_db, tti_sched);
 
@@ -23,6 +23,7 @@
 #include "srsenb/hdr/stack/mac/scheduler.h"
 #include "srslte/common/log_helper.h"
 #include "srslte/common/logmap.h"
+#include <algorithm>
 #include <srslte/interfaces/sched_interface.h>
 
 using srslte::tti_point;
@@ -44,6 +45,8 @@ const char* alloc_outcome_t::to_string() const
       return "invalid nof prbs";
     case PUCCH_COLLISION:
       return "pucch_collision";
+    case OVERLOAD:
+      return "overload";
   }
   return "unknown error";
 }
@@ -779,6 +782,13 @@ alloc_outcome_t sf_sched::alloc_dl_user(sched_ue* user, const rbgmask_t& user_ma
       log_h->warning("The number of RBGs allocated to rnti=0x%x will force segmentation\n", user->get_rnti());
       return alloc_outcome_t::NOF_RB_INVALID;
     }
+    // While the PHY is overloaded, limit new transmissions. HARQ retransmissions are never dropped
+    if (overload_limits.max_dl_users > 0 and data_allocs.size() >= overload_limits.max_dl_users) {
+      return alloc_outcome_t::OVERLOAD;
+    }
+    if (overload_limits.dl_ctrl_only and not user->has_pending_dl_ctrl_data()) {
+      return alloc_outcome_t::OVERLOAD;
+    }
   }
 
   // Check if there is space in the PUCCH for HARQ ACKs
@@ -823,6 +833,15 @@ alloc_outcome_t sf_sched::alloc_ul(sched_ue* user, prb_interval alloc, ul_alloc_
     return alloc_outcome_t::ERROR;
   }
 
+  // While the PHY is overloaded, limit new transmissions
+  if (alloc_type == ul_alloc_t::NEWTX and overload_limits.max_ul_users > 0) {
+    uint32_t nof_ul_users = std::count_if(
+        ul_data_allocs.begin(), ul_data_allocs.end(), [](const ul_alloc_t& a) { return not a.is_msg3(); });
+    if (nof_ul_users >= overload_limits.max_ul_users) {
+      return alloc_outcome_t::OVERLOAD;
+    }
+  }
+
   // Allocate RBGs and DCI space
   bool            needs_pdcch = alloc_type == ul_alloc_t::ADAPT_RETX or alloc_type == ul_alloc_t::NEWTX;
   alloc_outcome_t ret         = tti_alloc.alloc_ul_data(user, alloc, needs_pdcch);
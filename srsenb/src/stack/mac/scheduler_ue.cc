@@ -296,14 +296,13 @@ bool sched_ue::pucch_sr_collision(uint32_t tti, uint32_t n_cce)
   return false;
 }
 
-int sched_ue::set_ack_info(uint32_t tti_rx, uint32_t enb_cc_idx, uint32_t tb_idx, bool ack)
+std::pair<uint32_t, int> sched_ue::set_ack_info(uint32_t tti_rx, uint32_t enb_cc_idx, uint32_t tb_idx, bool ack)
 {
-  int          tbs_acked = -1;
-  cc_sched_ue* c         = find_ue_carrier(enb_cc_idx);
+  std::pair<uint32_t, int> p2 = {SRSLTE_MAX_HARQ_PROC, -1};
+  cc_sched_ue*             c  = find_ue_carrier(enb_cc_idx);
   if (c != nullptr and c->cc_state() != cc_st::idle) {
-    std::pair<uint32_t, int> p2 = c->harq_ent.set_ack_info(tti_rx, tb_idx, ack);
-    tbs_acked                   = p2.second;
-    if (tbs_acked > 0) {
+    p2 = c->harq_ent.set_ack_info(tti_rx, tb_idx, ack);
+    if (p2.second > 0) {
       Debug("SCHED: Set DL ACK=%d for rnti=0x%x, pid=%d, tb=%d, tti=%d\n", ack, rnti, p2.first, tb_idx, tti_rx);
     } else {
       Warning("SCHED: Received ACK info for unknown TTI=%d\n", tti_rx);
@@ -311,7 +310,20 @@ int sched_ue::set_ack_info(uint32_t tti_rx, uint32_t enb_cc_idx, uint32_t tb_idx
   } else {
     log_h->warning("Received DL ACK for invalid cell index %d\n", enb_cc_idx);
   }
-  return tbs_acked;
+  return p2;
+}
+
+void sched_ue::reset_dl_harq(uint32_t enb_cc_idx, uint32_t pid)
+{
+  cc_sched_ue* c = find_ue_carrier(enb_cc_idx);
+  if (c == nullptr or pid >= c->harq_ent.nof_dl_harqs()) {
+    log_h->warning("Cannot reset DL HARQ pid=%d for cell index %d\n", pid, enb_cc_idx);
+    return;
+  }
+  for (uint32_t tb = 0; tb < SRSLTE_MAX_TB; tb++) {
+    c->harq_ent.dl_harq_procs()[pid].reset(tb);
+  }
+  Debug("SCHED: Reset DL HARQ pid=%d for rnti=0x%x\n", pid, rnti);
 }
 
 void sched_ue::set_ul_crc(srslte::tti_point tti_rx, uint32_t enb_cc_idx, bool crc_res)
@@ -889,6 +901,20 @@ uint32_t sched_ue::get_pending_dl_new_data_total()
   return req_bytes;
 }
 
+/// Whether there are MAC CEs or SRB data pending for DL, which are kept when the scheduled load is limited
+bool sched_ue::has_pending_dl_ctrl_data() const
+{
+  if (not pending_ces.empty()) {
+    return true;
+  }
+  for (uint32_t lcid = 0; lcid <= 2; ++lcid) {
+    if (lch_handler.is_bearer_dl(lcid) and lch_handler.get_dl_tx_total(lcid) > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
 /**
  * Compute the range of RBGs that avoids segmentation of TM and MAC subheader data. Always computed for highest CFI
  * @param ue_cc_idx carrier of the UE
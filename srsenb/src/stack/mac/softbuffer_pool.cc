@@ -0,0 +1,162 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsenb/hdr/stack/mac/softbuffer_pool.h"
+#include <algorithm>
+
+namespace srsenb {
+
+/* Direction specific softbuffer handling */
+
+static int softbuffer_init(srslte_softbuffer_tx_t* buffer, uint32_t nof_prb)
+{
+  return srslte_softbuffer_tx_init(buffer, nof_prb);
+}
+
+static int softbuffer_init(srslte_softbuffer_rx_t* buffer, uint32_t nof_prb)
+{
+  return srslte_softbuffer_rx_init(buffer, nof_prb);
+}
+
+static void softbuffer_free(srslte_softbuffer_tx_t* buffer)
+{
+  srslte_softbuffer_tx_free(buffer);
+}
+
+static void softbuffer_free(srslte_softbuffer_rx_t* buffer)
+{
+  srslte_softbuffer_rx_free(buffer);
+}
+
+static size_t softbuffer_nof_bytes(const srslte_softbuffer_tx_t& buffer)
+{
+  return buffer.max_cb * (sizeof(uint8_t*) + SOFTBUFFER_SIZE);
+}
+
+static size_t softbuffer_nof_bytes(const srslte_softbuffer_rx_t& buffer)
+{
+  return buffer.max_cb * (sizeof(int16_t*) + sizeof(uint8_t*) + sizeof(bool) + SOFTBUFFER_SIZE * sizeof(int16_t) +
+                          6144 / 8);
+}
+
+template <class Softbuffer>
+softbuffer_pool<Softbuffer>::~softbuffer_pool()
+{
+  for (uint32_t i = 0; i < capacity; i++) {
+    softbuffer_free(&buffers[i]);
+  }
+  if (free_list.size() != capacity or nof_overflow > 0) {
+    log_h->warning("Softbuffer pool destroyed with %zd buffers in use\n", capacity - free_list.size() + nof_overflow);
+  }
+}
+
+template <class Softbuffer>
+bool softbuffer_pool<Softbuffer>::init(uint32_t nof_prb_, uint32_t capacity_, bool overflow_)
+{
+  nof_prb  = nof_prb_;
+  capacity = capacity_;
+  overflow = overflow_;
+  buffers.reset(new Softbuffer[capacity]());
+  free_list.reserve(capacity);
+
+  // Hand out the first buffers first, they are the most likely to still be cached
+  for (uint32_t i = capacity; i > 0; i--) {
+    if (softbuffer_init(&buffers[i - 1], nof_prb) != SRSLTE_SUCCESS) {
+      log_h->error("Initializing softbuffer %d of %d\n", i - 1, capacity);
+      return false;
+    }
+    free_list.push_back(&buffers[i - 1]);
+  }
+  if (capacity > 0) {
+    buffer_bytes = softbuffer_nof_bytes(buffers[0]);
+  }
+  return true;
+}
+
+template <class Softbuffer>
+Softbuffer* softbuffer_pool<Softbuffer>::allocate()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Softbuffer* buffer = nullptr;
+  if (not free_list.empty()) {
+    buffer = free_list.back();
+    free_list.pop_back();
+  } else {
+    nof_exhausted++;
+    if (not exhausted) {
+      log_h->warning("Softbuffer pool of %d buffers exhausted, %s\n",
+                     capacity,
+                     overflow ? "allocating extra buffers" : "skipping grants");
+      exhausted = true;
+    }
+    if (not overflow) {
+      return nullptr;
+    }
+    buffer = new Softbuffer();
+    if (softbuffer_init(buffer, nof_prb) != SRSLTE_SUCCESS) {
+      log_h->error("Initializing overflow softbuffer\n");
+      softbuffer_free(buffer);
+      delete buffer;
+      return nullptr;
+    }
+    buffer_bytes = softbuffer_nof_bytes(*buffer);
+    nof_overflow++;
+  }
+
+  peak = std::max(peak, capacity - (uint32_t)free_list.size() + nof_overflow);
+  return buffer;
+}
+
+template <class Softbuffer>
+void softbuffer_pool<Softbuffer>::deallocate(Softbuffer* buffer)
+{
+  if (buffer == nullptr) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  exhausted = false;
+  if (is_pooled(buffer)) {
+    free_list.push_back(buffer);
+  } else {
+    softbuffer_free(buffer);
+    delete buffer;
+    nof_overflow--;
+  }
+}
+
+template <class Softbuffer>
+void softbuffer_pool<Softbuffer>::get_metrics(softbuffer_pool_metrics_t& metrics)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  metrics.capacity      = capacity;
+  metrics.in_use        = capacity - free_list.size() + nof_overflow;
+  metrics.peak          = peak;
+  metrics.nof_overflow  = nof_overflow;
+  metrics.nof_exhausted = nof_exhausted;
+  metrics.nof_bytes     = (uint64_t)buffer_bytes * (capacity + nof_overflow);
+}
+
+template class softbuffer_pool<srslte_softbuffer_tx_t>;
+template class softbuffer_pool<srslte_softbuffer_rx_t>;
+
+} // namespace srsenb
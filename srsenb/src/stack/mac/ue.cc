@@ -32,6 +32,8 @@ namespace srsenb {
 
 ue::ue(uint16_t                 rnti_,
        uint32_t                 nof_prb_,
+       softbuffer_tx_pool*      tx_pool_,
+       softbuffer_rx_pool*      rx_pool_,
        sched_interface*         sched_,
        rrc_interface_mac*       rrc_,
        rlc_interface_mac*       rlc_,
@@ -47,6 +49,8 @@ ue::ue(uint16_t                 rnti_,
   ) :
   rnti(rnti_),
   nof_prb(nof_prb_),
+  tx_pool(tx_pool_),
+  rx_pool(rx_pool_),
   sched(sched_),
   rrc(rrc_),
   rlc(rlc_),
@@ -78,18 +82,8 @@ ue::ue(uint16_t                 rnti_,
 
 ue::~ue()
 {
-  // Free up all softbuffers for all CCs
-  for (auto cc : softbuffer_rx) {
-    for (auto buffer : cc) {
-      srslte_softbuffer_rx_free(&buffer);
-    }
-  }
-
-  for (auto cc : softbuffer_tx) {
-    for (auto buffer : cc) {
-      srslte_softbuffer_tx_free(&buffer);
-    }
-  }
+  // Give back the softbuffers of all CCs
+  release_softbuffers();
 }
 
 void ue::reset()
@@ -97,17 +91,7 @@ void ue::reset()
   metrics      = {};
   nof_failures = 0;
 
-  for (auto cc : softbuffer_rx) {
-    for (auto buffer : cc) {
-      srslte_softbuffer_rx_reset(&buffer);
-    }
-  }
-
-  for (auto cc : softbuffer_tx) {
-    for (auto buffer : cc) {
-      srslte_softbuffer_tx_reset(&buffer);
-    }
-  }
+  release_softbuffers();
 
   for (auto& cc_buffers : pending_buffers) {
     for (auto& harq_buffer : cc_buffers) {
@@ -120,9 +104,9 @@ void ue::reset()
 }
 
 /**
- * Allocate and initialize softbuffers for Tx and Rx and
- * append to current list of CC buffers. It uses the configured
- * number of HARQ processes and cell width.
+ * Append Tx and Rx softbuffer slots to current list of CC buffers. It uses
+ * the configured number of HARQ processes. The softbuffers themselves are
+ * taken from the shared pools when a HARQ process starts a transmission.
  *
  * @param num_cc Number of carriers to add buffers for (default 1)
  * @return number of carriers
@@ -130,12 +114,8 @@ void ue::reset()
 uint32_t ue::allocate_cc_buffers(const uint32_t num_cc)
 {
   for (uint32_t i = 0; i < num_cc; ++i) {
-    // create and init Rx buffers for Pcell
     softbuffer_rx.emplace_back();
     softbuffer_rx.back().resize(nof_rx_harq_proc);
-    for (auto& buffer : softbuffer_rx.back()) {
-      srslte_softbuffer_rx_init(&buffer, nof_prb);
-    }
 
     pending_buffers.emplace_back();
     pending_buffers.back().resize(nof_rx_harq_proc);
@@ -143,23 +123,37 @@ uint32_t ue::allocate_cc_buffers(const uint32_t num_cc)
       buffer = nullptr;
     }
 
-    // Create and init Tx buffers for Pcell
     softbuffer_tx.emplace_back();
     softbuffer_tx.back().resize(nof_tx_harq_proc);
-    for (auto& buffer : softbuffer_tx.back()) {
-      srslte_softbuffer_tx_init(&buffer, nof_prb);
-    }
-    // don't need to reset because just initiated the buffers
   }
   return softbuffer_tx.size();
 }
 
+void ue::release_softbuffers()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  for (auto& cc : softbuffer_rx) {
+    for (auto& h : cc) {
+      rx_pool->deallocate(h.buffer);
+      h = {};
+    }
+  }
+  for (auto& cc : softbuffer_tx) {
+    for (auto& h : cc) {
+      tx_pool->deallocate(h.buffer);
+      h = {};
+    }
+  }
+  nof_softbuffers = 0;
+}
+
 void ue::start_pcap(srslte::mac_pcap* pcap_)
 {
   pcap = pcap_;
 }
 
-srslte_softbuffer_rx_t* ue::get_rx_softbuffer(const uint32_t ue_cc_idx, const uint32_t tti)
+srslte_softbuffer_rx_t*
+ue::get_rx_softbuffer(const uint32_t ue_cc_idx, const uint32_t tti, const uint32_t current_tx_nb)
 {
   if ((size_t)ue_cc_idx >= softbuffer_rx.size()) {
     ERROR("UE CC Index (%d/%zd) out-of-range\n", ue_cc_idx, softbuffer_rx.size());
@@ -171,11 +165,29 @@ srslte_softbuffer_rx_t* ue::get_rx_softbuffer(const uint32_t ue_cc_idx, const ui
     return nullptr;
   }
 
-  return &softbuffer_rx.at(ue_cc_idx).at(tti % nof_rx_harq_proc);
+  std::lock_guard<std::mutex> lock(mutex);
+  harq_softbuffer_t<srslte_softbuffer_rx_t>& h = softbuffer_rx.at(ue_cc_idx).at(tti % nof_rx_harq_proc);
+  if (h.buffer == nullptr) {
+    h.buffer = rx_pool->allocate();
+    if (h.buffer == nullptr) {
+      return nullptr;
+    }
+    nof_softbuffers++;
+    // The buffer of this retransmission was reclaimed, soft-combine from scratch
+    if (current_tx_nb > 0) {
+      srslte_softbuffer_rx_reset(h.buffer);
+    }
+  }
+  h.tti    = tti;
+  h.nof_tx = current_tx_nb + 1;
+  return h.buffer;
 }
 
-srslte_softbuffer_tx_t*
-ue::get_tx_softbuffer(const uint32_t ue_cc_idx, const uint32_t harq_process, const uint32_t tb_idx)
+srslte_softbuffer_tx_t* ue::get_tx_softbuffer(const uint32_t ue_cc_idx,
+                                              const uint32_t harq_process,
+                                              const uint32_t tb_idx,
+                                              const uint32_t tti_tx_dl,
+                                              const bool     new_tx)
 {
   if ((size_t)ue_cc_idx >= softbuffer_tx.size()) {
     ERROR("UE CC Index (%d/%zd) out-of-range\n", ue_cc_idx, softbuffer_tx.size());
@@ -187,7 +199,101 @@ ue::get_tx_softbuffer(const uint32_t ue_cc_idx, const uint32_t harq_process, con
     return nullptr;
   }
 
-  return &softbuffer_tx.at(ue_cc_idx).at((harq_process * SRSLTE_MAX_TB + tb_idx) % nof_tx_harq_proc);
+  std::lock_guard<std::mutex> lock(mutex);
+  harq_softbuffer_t<srslte_softbuffer_tx_t>& h =
+      softbuffer_tx.at(ue_cc_idx).at((harq_process * SRSLTE_MAX_TB + tb_idx) % nof_tx_harq_proc);
+  if (h.buffer == nullptr) {
+    // A retransmission is sent from the softbuffer its first transmission was encoded into. Without it, the PHY
+    // would transmit whatever TB was last encoded in a fresh pool buffer
+    if (not new_tx) {
+      return nullptr;
+    }
+    h.buffer = tx_pool->allocate();
+    if (h.buffer == nullptr) {
+      return nullptr;
+    }
+    nof_softbuffers++;
+  }
+  h.tti    = tti_tx_dl;
+  h.nof_tx = new_tx ? 1 : h.nof_tx + 1;
+  return h.buffer;
+}
+
+/**
+ * Give back the Tx softbuffer of the HARQ process the scheduler matched the feedback to once the
+ * TB is acknowledged or has used all its transmissions. The HARQ process is resolved by the scheduler,
+ * which owns the DL HARQ-ACK timing of the cell
+ */
+void ue::set_tx_softbuffer_ack(const uint32_t ue_cc_idx,
+                               const uint32_t harq_process,
+                               const uint32_t tb_idx,
+                               const bool     ack)
+{
+  if ((size_t)ue_cc_idx >= softbuffer_tx.size()) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  cc_softbuffer_tx_list_t& cc  = softbuffer_tx[ue_cc_idx];
+  uint32_t                 idx = harq_process * SRSLTE_MAX_TB + tb_idx;
+  if (idx >= cc.size()) {
+    return;
+  }
+  harq_softbuffer_t<srslte_softbuffer_tx_t>& h = cc[idx];
+  if (h.buffer != nullptr and (ack or h.nof_tx >= max_harq_tx)) {
+    tx_pool->deallocate(h.buffer);
+    h = {};
+    nof_softbuffers--;
+  }
+}
+
+/**
+ * Give back the Rx softbuffer of the HARQ process received in tti_rx once the
+ * TB is decoded or has used all its transmissions
+ */
+void ue::set_rx_softbuffer_crc(const uint32_t ue_cc_idx, const uint32_t tti_rx, const bool crc)
+{
+  if ((size_t)ue_cc_idx >= softbuffer_rx.size()) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  harq_softbuffer_t<srslte_softbuffer_rx_t>& h = softbuffer_rx[ue_cc_idx].at(tti_rx % nof_rx_harq_proc);
+  if (h.buffer != nullptr and h.tti == tti_rx and (crc or h.nof_tx >= max_harq_tx)) {
+    rx_pool->deallocate(h.buffer);
+    h = {};
+    nof_softbuffers--;
+  }
+}
+
+/**
+ * Give back the softbuffers of HARQ processes whose feedback never came, e.g. a
+ * missed PUCCH or a PUSCH that was not decoded
+ */
+void ue::release_stale_softbuffers(const uint32_t tti)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if (nof_softbuffers == 0) {
+    return;
+  }
+  for (auto& cc : softbuffer_tx) {
+    for (auto& h : cc) {
+      if (h.buffer != nullptr and TTI_SUB(tti, h.tti) > softbuffer_stale_tti) {
+        tx_pool->deallocate(h.buffer);
+        h = {};
+        nof_softbuffers--;
+      }
+    }
+  }
+  for (auto& cc : softbuffer_rx) {
+    for (auto& h : cc) {
+      if (h.buffer != nullptr and TTI_SUB(tti, h.tti) > softbuffer_stale_tti) {
+        rx_pool->deallocate(h.buffer);
+        h = {};
+        nof_softbuffers--;
+      }
+    }
+  }
 }
 
 uint8_t* ue::request_buffer(const uint32_t ue_cc_idx, const uint32_t tti, const uint32_t len)
@@ -470,7 +576,7 @@ void ue::allocate_ce(srslte::sch_pdu* pdu, uint32_t lcid)
         }
         if (enb_cc_idx == enb_ue_cc_map.size() and pdu->get()->set_scell_activation_cmd(active_scell_list)) {
           phy->set_activation_deactivation_scell(rnti, active_scell_list);
-          // Allocate and initialize Rx/Tx softbuffers for new carriers (exclude PCell)
+          // Add Rx/Tx softbuffer slots for new carriers (exclude PCell)
           allocate_cc_buffers(active_scell_list.size() - 1);
         } else {
           Error("CE:    Setting SCell Activation CE\n");
@@ -566,72 +672,60 @@ static inline unsigned int rbg_to_rb_factor(uint32_t nof_prb)
 }
 
 /******* METRICS interface ***************/
-void ue::metrics_read(mac_metrics_t* metrics_)
-{
-  metrics.rnti      = rnti;
-  metrics.ul_buffer = sched->get_ul_buffer(rnti);
-  metrics.dl_buffer = sched->get_dl_buffer(rnti);
-  metrics.dl_rb     = sched->get_dl_rbg_total(rnti) * rbg_to_rb_factor(nof_prb);
-  metrics.ul_rb     = sched->get_ul_rb_total(rnti);
-
-  memcpy(metrics_, &metrics, sizeof(mac_metrics_t));
-
-  phr_counter    = 0;
-  dl_cqi_counter = 0;
-  metrics        = {};
-}
-
 void ue::metrics_phr(float phr)
 {
-  metrics.phr = SRSLTE_VEC_CMA(phr, metrics.phr, phr_counter);
-  phr_counter++;
+  if (metrics != nullptr) {
+    metrics->mac_phr(phr);
+  }
 }
 
 void ue::metrics_dl_ri(uint32_t dl_ri)
 {
-  if (metrics.dl_ri == 0.0f) {
-    metrics.dl_ri = (float)dl_ri + 1.0f;
-  } else {
-    metrics.dl_ri = SRSLTE_VEC_EMA((float)dl_ri + 1.0f, metrics.dl_ri, 0.5f);
+  if (metrics != nullptr) {
+    metrics->mac_dl_ri(dl_ri);
   }
-  dl_ri_counter++;
 }
 
-void ue::metrics_dl_pmi(uint32_t dl_ri)
+void ue::metrics_dl_pmi(uint32_t dl_pmi)
 {
-  metrics.dl_pmi = SRSLTE_VEC_CMA((float)dl_ri, metrics.dl_pmi, dl_pmi_counter);
-  dl_pmi_counter++;
+  if (metrics != nullptr) {
+    metrics->mac_dl_pmi(dl_pmi);
+  }
 }
 
 void ue::metrics_dl_cqi(uint32_t dl_cqi)
 {
-  metrics.dl_cqi = SRSLTE_VEC_CMA((float)dl_cqi, metrics.dl_cqi, dl_cqi_counter);
-  dl_cqi_counter++;
+  if (metrics != nullptr) {
+    metrics->mac_dl_cqi(dl_cqi);
+  }
 }
 
 void ue::metrics_rx(bool crc, uint32_t tbs)
 {
-  if (crc) {
-    metrics.rx_brate += tbs * 8;
-  } else {
-    metrics.rx_errors++;
+  if (metrics != nullptr) {
+    metrics->mac_rx(crc, tbs);
   }
-  metrics.rx_pkts++;
 }
 
 void ue::metrics_tx(bool crc, uint32_t tbs)
 {
-  if (crc) {
-    metrics.tx_brate += tbs * 8;
-  } else {
-    metrics.tx_errors++;
+  if (metrics != nullptr) {
+    metrics->mac_tx(crc, tbs);
   }
-  metrics.tx_pkts++;
 }
 
 void ue::metrics_cnt()
 {
-  metrics.nof_tti++;
+  if (metrics == nullptr) {
+    return;
+  }
+  // Buffer states and RB totals live in the scheduler and need its lock, so they are only refreshed periodically
+  if (metrics->mac_tti() % sched_metrics_period_tti == 0) {
+    sched_interface::ue_sched_metrics_t m;
+    if (sched->get_ue_metrics(rnti, m)) {
+      metrics->mac_sched_state(m.ul_buffer, m.dl_buffer, m.dl_rbg_total * rbg_to_rb_factor(nof_prb), m.ul_rb_total);
+    }
+  }
 }
 
 } // namespace srsenb
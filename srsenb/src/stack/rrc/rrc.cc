@@ -51,14 +51,16 @@ void rrc::init(const rrc_cfg_t&       cfg_,
                rlc_interface_rrc*     rlc_,
                pdcp_interface_rrc*    pdcp_,
                s1ap_interface_rrc*    s1ap_,
-               gtpu_interface_rrc*    gtpu_)
+               gtpu_interface_rrc*    gtpu_,
+               ue_metrics_registry*   ue_metrics_)
 {
-  phy  = phy_;
-  mac  = mac_;
-  rlc  = rlc_;
-  pdcp = pdcp_;
-  gtpu = gtpu_;
-  s1ap = s1ap_;
+  phy        = phy_;
+  mac        = mac_;
+  rlc        = rlc_;
+  pdcp       = pdcp_;
+  gtpu       = gtpu_;
+  s1ap       = s1ap_;
+  ue_metrics = ue_metrics_;
 
   pool = srslte::byte_buffer_pool::get_instance();
 
@@ -103,24 +105,6 @@ void rrc::stop()
   users.clear();
 }
 
-/*******************************************************************************
-  Public functions
-*******************************************************************************/
-
-void rrc::get_metrics(rrc_metrics_t& m)
-{
-  if (running) {
-    m.n_ues = 0;
-    for (auto iter = users.begin(); m.n_ues < ENB_METRICS_MAX_USERS && iter != users.end(); ++iter) {
-      ue* u                  = iter->second.get();
-#ifdef ENABLE_RIC_AGENT_KPM
-      m.ues[m.n_ues].rnti = u->rnti;
-#endif
-      m.ues[m.n_ues++].state = u->get_state();
-    }
-  }
-}
-
 /*******************************************************************************
   MAC interface
 
@@ -75,6 +75,17 @@ rrc_state_t rrc::ue::get_state()
   return state;
 }
 
+void rrc::ue::set_state(rrc_state_t new_state)
+{
+  state = new_state;
+  if (parent->ue_metrics != nullptr) {
+    ue_metrics_slot_t* metrics = parent->ue_metrics->find(rnti);
+    if (metrics != nullptr) {
+      metrics->rrc_state(state);
+    }
+  }
+}
+
 void rrc::ue::set_activity()
 {
   // re-start activity timer with current timeout value
@@ -102,7 +113,7 @@ void rrc::ue::activity_timer_expired()
     }
   }
 
-  state = RRC_STATE_RELEASE_REQUEST;
+  set_state(RRC_STATE_RELEASE_REQUEST);
 }
 
 void rrc::ue::set_activity_timeout(const activity_timeout_type_t type)
@@ -273,13 +284,13 @@ void rrc::ue::parse_ul_dcch(uint32_t lcid, srslte::unique_byte_buffer_t pdu)
     case ul_dcch_msg_type_c::c1_c_::types::rrc_conn_recfg_complete:
       handle_rrc_reconf_complete(&ul_dcch_msg.msg.c1().rrc_conn_recfg_complete(), std::move(pdu));
       srslte::console("User 0x%x connected\n", rnti);
-      state = RRC_STATE_REGISTERED;
+      set_state(RRC_STATE_REGISTERED);
       set_activity_timeout(UE_INACTIVITY_TIMEOUT);
       break;
     case ul_dcch_msg_type_c::c1_c_::types::security_mode_complete:
       handle_security_mode_complete(&ul_dcch_msg.msg.c1().security_mode_complete());
       send_ue_cap_enquiry();
-      state = RRC_STATE_WAIT_FOR_UE_CAP_INFO;
+      set_state(RRC_STATE_WAIT_FOR_UE_CAP_INFO);
       break;
     case ul_dcch_msg_type_c::c1_c_::types::security_mode_fail:
       handle_security_mode_failure(&ul_dcch_msg.msg.c1().security_mode_fail());
@@ -288,10 +299,10 @@ void rrc::ue::parse_ul_dcch(uint32_t lcid, srslte::unique_byte_buffer_t pdu)
       if (handle_ue_cap_info(&ul_dcch_msg.msg.c1().ue_cap_info())) {
         notify_s1ap_ue_ctxt_setup_complete();
         send_connection_reconf(std::move(pdu));
-        state = RRC_STATE_WAIT_FOR_CON_RECONF_COMPLETE;
+        set_state(RRC_STATE_WAIT_FOR_CON_RECONF_COMPLETE);
       } else {
         send_connection_reject();
-        state = RRC_STATE_IDLE;
+        set_state(RRC_STATE_IDLE);
       }
       break;
     case ul_dcch_msg_type_c::c1_c_::types::meas_report:
@@ -341,7 +352,7 @@ void rrc::ue::handle_rrc_con_req(rrc_conn_request_s* msg)
   }
   establishment_cause = msg_r8->establishment_cause;
   send_connection_setup();
-  state = RRC_STATE_WAIT_FOR_CON_SETUP_COMPLETE;
+  set_state(RRC_STATE_WAIT_FOR_CON_SETUP_COMPLETE);
 
   set_activity_timeout(UE_INACTIVITY_TIMEOUT);
 }
@@ -460,7 +471,7 @@ void rrc::ue::handle_rrc_con_setup_complete(rrc_conn_setup_complete_s* msg, srsl
   } else {
     parent->s1ap->initial_ue(rnti, s1ap_cause, std::move(pdu));
   }
-  state = RRC_STATE_WAIT_FOR_CON_RECONF_COMPLETE;
+  set_state(RRC_STATE_WAIT_FOR_CON_RECONF_COMPLETE);
 }
 
 void rrc::ue::send_connection_reject()
@@ -536,7 +547,7 @@ void rrc::ue::handle_rrc_con_reest_req(rrc_conn_reest_request_s* msg)
       }
 
       old_reest_rnti = old_rnti;
-      state          = RRC_STATE_WAIT_FOR_CON_REEST_COMPLETE;
+      set_state(RRC_STATE_WAIT_FOR_CON_REEST_COMPLETE);
       set_activity_timeout(UE_INACTIVITY_TIMEOUT);
     } else {
       parent->rrc_log->error("Received ConnectionReestablishment for rnti=0x%x without context\n", old_rnti);
@@ -615,7 +626,7 @@ void rrc::ue::handle_rrc_con_reest_complete(rrc_conn_reest_complete_s* msg, srsl
   // remove old RNTI
   parent->rem_user_thread(old_reest_rnti);
 
-  state = RRC_STATE_REESTABLISHMENT_COMPLETE;
+  set_state(RRC_STATE_REESTABLISHMENT_COMPLETE);
   send_connection_reconf(std::move(pdu));
 }
 
@@ -796,7 +807,7 @@ void rrc::ue::send_connection_reconf(srslte::unique_byte_buffer_t pdu)
 
   send_dl_dcch(&dl_dcch_msg, std::move(pdu));
 
-  state = RRC_STATE_WAIT_FOR_CON_RECONF_COMPLETE;
+  set_state(RRC_STATE_WAIT_FOR_CON_RECONF_COMPLETE);
 }
 
 void rrc::ue::send_connection_reconf_upd(srslte::unique_byte_buffer_t pdu)
@@ -851,7 +862,7 @@ void rrc::ue::send_connection_reconf_upd(srslte::unique_byte_buffer_t pdu)
 
   send_dl_dcch(&dl_dcch_msg, std::move(pdu));
 
-  state = RRC_STATE_WAIT_FOR_CON_RECONF_COMPLETE;
+  set_state(RRC_STATE_WAIT_FOR_CON_RECONF_COMPLETE);
 }
 
 void rrc::ue::send_connection_reconf_new_bearer()
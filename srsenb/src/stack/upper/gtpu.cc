@@ -21,6 +21,7 @@
 #include "srslte/upper/gtpu.h"
 #include "srsenb/hdr/stack/upper/gtpu.h"
 #include "srslte/common/network_utils.h"
+#include <algorithm>
 #include <errno.h>
 #include <fcntl.h>
 #include <linux/ip.h>
@@ -233,12 +234,50 @@ void gtpu::rem_user(uint16_t rnti)
 }
 
 void gtpu::handle_gtpu_s1u_rx_packet(srslte::unique_byte_buffer_t pdu, const sockaddr_in& addr)
+{
+  rnti_lcid_t rnti_lcid = {};
+  if (read_s1u_rx_packet(pdu, addr, &rnti_lcid)) {
+    pdcp->write_sdu(rnti_lcid.rnti, rnti_lcid.lcid, std::move(pdu));
+  }
+}
+
+void gtpu::handle_gtpu_s1u_rx_packets(srslte::unique_byte_buffer_list_t pdus, const std::vector<sockaddr_in>& addrs)
+{
+  // Group the DL data PDUs per bearer, keeping their order within the bearer, so that each bearer is
+  // handed to PDCP in a single call
+  std::vector<dl_sdu_batch_t> batches;
+  for (uint32_t i = 0; i < pdus.size(); i++) {
+    rnti_lcid_t rnti_lcid = {};
+    if (not read_s1u_rx_packet(pdus[i], addrs[i], &rnti_lcid)) {
+      continue;
+    }
+    auto batch_it = std::find_if(batches.begin(), batches.end(), [&rnti_lcid](const dl_sdu_batch_t& b) {
+      return b.rnti_lcid.rnti == rnti_lcid.rnti and b.rnti_lcid.lcid == rnti_lcid.lcid;
+    });
+    if (batch_it == batches.end()) {
+      batches.emplace_back();
+      batch_it            = batches.end() - 1;
+      batch_it->rnti_lcid = rnti_lcid;
+    }
+    batch_it->sdus.push_back(std::move(pdus[i]));
+  }
+
+  for (auto& batch : batches) {
+    pdcp->write_sdus(batch.rnti_lcid.rnti, batch.rnti_lcid.lcid, std::move(batch.sdus));
+  }
+}
+
+// Parses the GTPU header of an S1-U packet and answers signalling messages. Returns true if the packet is a valid
+// DL data PDU, in which case rnti_lcid holds its bearer and pdu its payload.
+bool gtpu::read_s1u_rx_packet(const srslte::unique_byte_buffer_t& pdu,
+                              const sockaddr_in&                  addr,
+                              rnti_lcid_t*                        rnti_lcid)
 {
   gtpu_log->debug("Received %d bytes from S1-U interface\n", pdu->N_bytes);
 
   gtpu_header_t header;
   if (not gtpu_read_header(pdu.get(), &header, gtpu_log)) {
-    return;
+    return false;
   }
 
   switch (header.message_type) {
@@ -247,20 +286,20 @@ void gtpu::handle_gtpu_s1u_rx_packet(srslte::unique_byte_buffer_t pdu, const soc
       echo_response(addr.sin_addr.s_addr, addr.sin_port, header.seq_number);
       break;
     case GTPU_MSG_DATA_PDU: {
-      rnti_lcid_t rnti_lcid = teidin_to_rntilcid(header.teid);
-      uint16_t    rnti      = rnti_lcid.rnti;
-      uint16_t    lcid      = rnti_lcid.lcid;
+      *rnti_lcid    = teidin_to_rntilcid(header.teid);
+      uint16_t rnti = rnti_lcid->rnti;
+      uint16_t lcid = rnti_lcid->lcid;
 
       bool user_exists = (rnti_bearers.count(rnti) > 0);
 
       if (not user_exists) {
         gtpu_log->error("Unrecognized TEID In=%d for DL PDU. Dropping packet\n", header.teid);
-        return;
+        return false;
       }
 
       if (lcid < SRSENB_N_SRB || lcid >= SRSENB_N_RADIO_BEARERS) {
         gtpu_log->error("Invalid LCID for DL PDU: %d - dropping packet\n", lcid);
-        return;
+        return false;
       }
 
       gtpu_log->info_hex(
@@ -269,7 +308,7 @@ void gtpu::handle_gtpu_s1u_rx_packet(srslte::unique_byte_buffer_t pdu, const soc
       struct iphdr* ip_pkt = (struct iphdr*)pdu->msg;
       if (ip_pkt->version != 4 && ip_pkt->version != 6) {
         gtpu_log->error("Invalid IP version to SPGW\n");
-        return;
+        return false;
       } else if (ip_pkt->version == 4) {
         if (ntohs(ip_pkt->tot_len) != pdu->N_bytes) {
           gtpu_log->error("IP Len and PDU N_bytes mismatch\n");
@@ -278,17 +317,17 @@ void gtpu::handle_gtpu_s1u_rx_packet(srslte::unique_byte_buffer_t pdu, const soc
         gtpu_log->debug("Rx S1-U PDU -- IP src addr %s\n", srslte::gtpu_ntoa(ip_pkt->saddr).c_str());
         gtpu_log->debug("Rx S1-U PDU -- IP dst addr %s\n", srslte::gtpu_ntoa(ip_pkt->daddr).c_str());
       }
-      pdcp->write_sdu(rnti, lcid, std::move(pdu));
-    } break;
+      return true;
+    }
     case GTPU_MSG_END_MARKER: {
-      rnti_lcid_t rnti_lcid = teidin_to_rntilcid(header.teid);
-      uint16_t    rnti      = rnti_lcid.rnti;
+      uint16_t rnti = teidin_to_rntilcid(header.teid).rnti;
       gtpu_log->info("Received GTPU End Marker for rnti=0x%x.\n", rnti);
       break;
     }
     default:
       break;
   }
+  return false;
 }
 
 void gtpu::handle_gtpu_m1u_rx_packet(srslte::unique_byte_buffer_t pdu, const sockaddr_in& addr)
@@ -30,11 +30,15 @@ pdcp::pdcp(srslte::task_sched_handle task_sched_, const char* logname) :
   pool(srslte::byte_buffer_pool::get_instance())
 {}
 
-void pdcp::init(rlc_interface_pdcp* rlc_, rrc_interface_pdcp* rrc_, gtpu_interface_pdcp* gtpu_)
+void pdcp::init(rlc_interface_pdcp*  rlc_,
+                rrc_interface_pdcp*  rrc_,
+                gtpu_interface_pdcp* gtpu_,
+                ue_metrics_registry* ue_metrics_)
 {
-  rlc  = rlc_;
-  rrc  = rrc_;
-  gtpu = gtpu_;
+  rlc        = rlc_;
+  rrc        = rrc_;
+  gtpu       = gtpu_;
+  ue_metrics = ue_metrics_;
 }
 
 void pdcp::stop()
@@ -45,24 +49,6 @@ void pdcp::stop()
   users.clear();
 }
 
-#ifdef ENABLE_RIC_AGENT_KPM
-void pdcp::get_metrics(pdcp_metrics_t& m)
-{
-  m.n_ues = 0;
-  for (auto iter = users.begin(); m.n_ues < ENB_METRICS_MAX_USERS && iter != users.end(); ++iter) {
-    user_interface& u = iter->second;
-    m.ues[m.n_ues].rnti = u.rlc_itf.rnti;
-    m.ues[m.n_ues].dl_bytes = u.rlc_itf.dl_bytes;
-    m.ues[m.n_ues].ul_bytes = u.gtpu_itf.ul_bytes;
-    memcpy(m.ues[m.n_ues].dl_bytes_by_bearer,u.rlc_itf.dl_bytes_by_bearer,sizeof(m.ues[m.n_ues].dl_bytes_by_bearer));
-    memcpy(m.ues[m.n_ues].ul_bytes_by_bearer,u.gtpu_itf.ul_bytes_by_bearer,sizeof(m.ues[m.n_ues].ul_bytes_by_bearer));
-    memcpy(m.ues[m.n_ues].dl_bytes_by_qci,u.rlc_itf.dl_bytes_by_qci,sizeof(m.ues[m.n_ues].dl_bytes_by_qci));
-    memcpy(m.ues[m.n_ues].ul_bytes_by_qci,u.gtpu_itf.ul_bytes_by_qci,sizeof(m.ues[m.n_ues].ul_bytes_by_qci));
-    ++m.n_ues;
-  }
-}
-#endif
-
 void pdcp::add_user(uint16_t rnti)
 {
   if (users.count(rnti) == 0) {
@@ -77,13 +63,9 @@ void pdcp::add_user(uint16_t rnti)
     users[rnti].gtpu_itf.gtpu = gtpu;
     users[rnti].pdcp          = obj;
 #ifdef ENABLE_RIC_AGENT_KPM
-    users[rnti].rlc_itf.dl_bytes = 0;
-    memset(users[rnti].rlc_itf.dl_bytes_by_bearer,0,sizeof(users[rnti].rlc_itf.dl_bytes_by_bearer));
-    memset(users[rnti].rlc_itf.dl_bytes_by_qci,0,sizeof(users[rnti].rlc_itf.dl_bytes_by_qci));
+    users[rnti].rlc_itf.metrics  = ue_metrics != nullptr ? ue_metrics->find(rnti) : nullptr;
+    users[rnti].gtpu_itf.metrics = users[rnti].rlc_itf.metrics;
     memset(users[rnti].rlc_itf.bearer_qci_map,0,sizeof(users[rnti].rlc_itf.bearer_qci_map));
-    users[rnti].gtpu_itf.ul_bytes = 0;
-    memset(users[rnti].gtpu_itf.ul_bytes_by_bearer,0,sizeof(users[rnti].gtpu_itf.ul_bytes_by_bearer));
-    memset(users[rnti].gtpu_itf.ul_bytes_by_qci,0,sizeof(users[rnti].gtpu_itf.ul_bytes_by_qci));
     memset(users[rnti].gtpu_itf.bearer_qci_map,0,sizeof(users[rnti].gtpu_itf.bearer_qci_map));
 #endif
   }
@@ -197,12 +179,27 @@ void pdcp::write_sdu(uint16_t rnti, uint32_t lcid, srslte::unique_byte_buffer_t
   }
 }
 
+void pdcp::write_sdus(uint16_t rnti, uint32_t lcid, srslte::unique_byte_buffer_list_t sdus)
+{
+  auto user_it = users.find(rnti);
+  if (user_it == users.end()) {
+    return;
+  }
+  if (rnti != SRSLTE_MRNTI) {
+    user_it->second.pdcp->write_sdus(lcid, std::move(sdus));
+  } else {
+    for (auto& sdu : sdus) {
+      user_it->second.pdcp->write_sdu_mch(lcid, std::move(sdu));
+    }
+  }
+}
+
 void pdcp::user_interface_gtpu::write_pdu(uint32_t lcid, srslte::unique_byte_buffer_t pdu)
 {
 #ifdef ENABLE_RIC_AGENT_KPM
-  ul_bytes += pdu->N_bytes;
-  ul_bytes_by_bearer[lcid] += pdu->N_bytes;
-  ul_bytes_by_qci[bearer_qci_map[lcid]] += pdu->N_bytes;
+  if (metrics != nullptr) {
+    metrics->pdcp_ul(lcid, bearer_qci_map[lcid], pdu->N_bytes);
+  }
 #endif
   gtpu->write_pdu(rnti, lcid, std::move(pdu));
 }
@@ -210,13 +207,25 @@ void pdcp::user_interface_gtpu::write_pdu(uint32_t lcid, srslte::unique_byte_buf
 void pdcp::user_interface_rlc::write_sdu(uint32_t lcid, srslte::unique_byte_buffer_t sdu)
 {
 #ifdef ENABLE_RIC_AGENT_KPM
-  dl_bytes += sdu->N_bytes;
-  dl_bytes_by_bearer[lcid] += sdu->N_bytes;
-  dl_bytes_by_qci[bearer_qci_map[lcid]] += sdu->N_bytes;
+  if (metrics != nullptr) {
+    metrics->pdcp_dl(lcid, bearer_qci_map[lcid], sdu->N_bytes);
+  }
 #endif
   rlc->write_sdu(rnti, lcid, std::move(sdu));
 }
 
+void pdcp::user_interface_rlc::write_sdus(uint32_t lcid, srslte::unique_byte_buffer_list_t sdus)
+{
+#ifdef ENABLE_RIC_AGENT_KPM
+  if (metrics != nullptr) {
+    for (auto& sdu : sdus) {
+      metrics->pdcp_dl(lcid, bearer_qci_map[lcid], sdu->N_bytes);
+    }
+  }
+#endif
+  rlc->write_sdus(rnti, lcid, std::move(sdus));
+}
+
 void pdcp::user_interface_rlc::discard_sdu(uint32_t lcid, uint32_t discard_sn)
 {
   rlc->discard_sdu(rnti, lcid, discard_sn);
@@ -232,6 +241,11 @@ bool pdcp::user_interface_rlc::sdu_queue_is_full(uint32_t lcid)
   return rlc->sdu_queue_is_full(rnti, lcid);
 }
 
+uint32_t pdcp::user_interface_rlc::sdu_queue_space(uint32_t lcid)
+{
+  return rlc->sdu_queue_space(rnti, lcid);
+}
+
 void pdcp::user_interface_rrc::write_pdu(uint32_t lcid, srslte::unique_byte_buffer_t pdu)
 {
   rrc->write_pdu(rnti, lcid, std::move(pdu));
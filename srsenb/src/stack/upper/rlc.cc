@@ -224,6 +224,22 @@ void rlc::write_sdu(uint16_t rnti, uint32_t lcid, srslte::unique_byte_buffer_t s
   pthread_rwlock_unlock(&rwlock);
 }
 
+void rlc::write_sdus(uint16_t rnti, uint32_t lcid, srslte::unique_byte_buffer_list_t sdus)
+{
+  pthread_rwlock_rdlock(&rwlock);
+  auto user_it = users.find(rnti);
+  if (user_it != users.end()) {
+    if (rnti != SRSLTE_MRNTI) {
+      user_it->second.rlc->write_sdus(lcid, std::move(sdus));
+    } else {
+      for (auto& sdu : sdus) {
+        user_it->second.rlc->write_sdu_mch(lcid, std::move(sdu));
+      }
+    }
+  }
+  pthread_rwlock_unlock(&rwlock);
+}
+
 void rlc::discard_sdu(uint16_t rnti, uint32_t lcid, uint32_t discard_sn)
 {
   pthread_rwlock_rdlock(&rwlock);
@@ -255,6 +271,17 @@ bool rlc::sdu_queue_is_full(uint16_t rnti, uint32_t lcid)
   return ret;
 }
 
+uint32_t rlc::sdu_queue_space(uint16_t rnti, uint32_t lcid)
+{
+  uint32_t ret = 0;
+  pthread_rwlock_rdlock(&rwlock);
+  if (users.count(rnti)) {
+    ret = users[rnti].rlc->sdu_queue_space(lcid);
+  }
+  pthread_rwlock_unlock(&rwlock);
+  return ret;
+}
+
 void rlc::user_interface::max_retx_attempted()
 {
   rrc->max_retx_attempted(rnti);
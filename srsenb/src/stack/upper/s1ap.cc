@@ -533,12 +533,16 @@ bool s1ap::handle_s1ap_rx_pdu(srslte::byte_buffer_t* pdu)
     pcap->write_s1ap(pdu->msg, pdu->N_bytes);
   }
 
+  // The IEs are unpacked into the arena, which the previous PDU no longer uses
+  rx_arena.reset();
   s1ap_pdu_c     rx_pdu;
   asn1::cbit_ref bref(pdu->msg, pdu->N_bytes);
-
-  if (rx_pdu.unpack(bref) != asn1::SRSASN_SUCCESS) {
-    s1ap_log->error("Failed to unpack received PDU\n");
-    return false;
+  {
+    asn1::arena_scope arena_scope(rx_arena);
+    if (rx_pdu.unpack(bref) != asn1::SRSASN_SUCCESS) {
+      s1ap_log->error("Failed to unpack received PDU\n");
+      return false;
+    }
   }
 
   switch (rx_pdu.type().value) {
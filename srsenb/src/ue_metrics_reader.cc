@@ -0,0 +1,157 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsenb/hdr/ue_metrics_reader.h"
+#include <cmath>
+
+namespace srsenb {
+
+namespace {
+
+typedef ue_metrics_slot_t slot_t;
+
+// Mean of the samples added to a (sum, count) pair since prev, or default_value if there were none
+float period_avg(const int64_t* cur, const int64_t* prev, uint32_t sum, uint32_t n, float default_value)
+{
+  int64_t nof_samples = cur[n] - prev[n];
+  if (nof_samples <= 0) {
+    return default_value;
+  }
+  return slot_t::from_fp(cur[sum] - prev[sum]) / nof_samples;
+}
+
+void fill_mac(const ue_metrics_snapshot_t& cur, const ue_metrics_snapshot_t& prev, mac_metrics_t& mac)
+{
+  const int64_t* c = cur.mac;
+  const int64_t* p = prev.mac;
+
+  mac           = {};
+  mac.rnti      = cur.rnti;
+  mac.nof_tti   = c[slot_t::MAC_NOF_TTI] - p[slot_t::MAC_NOF_TTI];
+  mac.tx_pkts   = c[slot_t::MAC_TX_PKTS] - p[slot_t::MAC_TX_PKTS];
+  mac.tx_errors = c[slot_t::MAC_TX_ERRORS] - p[slot_t::MAC_TX_ERRORS];
+  mac.tx_brate  = c[slot_t::MAC_TX_BITS] - p[slot_t::MAC_TX_BITS];
+  mac.rx_pkts   = c[slot_t::MAC_RX_PKTS] - p[slot_t::MAC_RX_PKTS];
+  mac.rx_errors = c[slot_t::MAC_RX_ERRORS] - p[slot_t::MAC_RX_ERRORS];
+  mac.rx_brate  = c[slot_t::MAC_RX_BITS] - p[slot_t::MAC_RX_BITS];
+  mac.ul_buffer = c[slot_t::MAC_UL_BUFFER];
+  mac.dl_buffer = c[slot_t::MAC_DL_BUFFER];
+  mac.dl_cqi    = period_avg(c, p, slot_t::MAC_DL_CQI_SUM, slot_t::MAC_DL_CQI_N, 0);
+  mac.dl_ri     = period_avg(c, p, slot_t::MAC_DL_RI_SUM, slot_t::MAC_DL_RI_N, 0);
+  mac.dl_pmi    = period_avg(c, p, slot_t::MAC_DL_PMI_SUM, slot_t::MAC_DL_PMI_N, 0);
+  mac.phr       = period_avg(c, p, slot_t::MAC_PHR_SUM, slot_t::MAC_PHR_N, 0);
+  mac.dl_rb     = c[slot_t::MAC_DL_RB];
+  mac.ul_rb     = c[slot_t::MAC_UL_RB];
+}
+
+void fill_phy(const ue_metrics_snapshot_t& cur, const ue_metrics_snapshot_t& prev, phy_metrics_t& phy)
+{
+  const int64_t* c = cur.phy;
+  const int64_t* p = prev.phy;
+
+  phy = {};
+#ifdef ENABLE_RIC_AGENT_KPM
+  phy.cc_idx = c[slot_t::PHY_CC_IDX];
+#endif
+  phy.dl.n_samples   = c[slot_t::PHY_DL_N] - p[slot_t::PHY_DL_N];
+  phy.dl.mcs         = period_avg(c, p, slot_t::PHY_DL_MCS_SUM, slot_t::PHY_DL_N, NAN);
+  phy.ul.n_samples   = c[slot_t::PHY_UL_N] - p[slot_t::PHY_UL_N];
+  phy.ul.mcs         = period_avg(c, p, slot_t::PHY_UL_MCS_SUM, slot_t::PHY_UL_N, NAN);
+  phy.ul.sinr        = period_avg(c, p, slot_t::PHY_UL_SINR_SUM, slot_t::PHY_UL_N, NAN);
+  phy.ul.rssi        = period_avg(c, p, slot_t::PHY_UL_RSSI_SUM, slot_t::PHY_UL_N, NAN);
+  phy.ul.turbo_iters = period_avg(c, p, slot_t::PHY_UL_TURBO_ITERS_SUM, slot_t::PHY_UL_N, NAN);
+}
+
+#ifdef ENABLE_RIC_AGENT_KPM
+void fill_pdcp(const ue_metrics_snapshot_t& cur, pdcp_ue_metrics_t& pdcp)
+{
+  // PDCP byte counts are reported as totals, the RIC agent computes its own per-period differences
+  const int64_t* c = cur.upper;
+
+  pdcp          = {};
+  pdcp.rnti     = cur.rnti;
+  pdcp.dl_bytes = c[slot_t::PDCP_DL_BYTES];
+  pdcp.ul_bytes = c[slot_t::PDCP_UL_BYTES];
+  for (uint32_t i = 0; i < SRSENB_N_RADIO_BEARERS; i++) {
+    pdcp.dl_bytes_by_bearer[i] = c[slot_t::PDCP_DL_BYTES_BY_BEARER + i];
+    pdcp.ul_bytes_by_bearer[i] = c[slot_t::PDCP_UL_BYTES_BY_BEARER + i];
+  }
+  for (uint32_t i = 0; i < MAX_NOF_QCI; i++) {
+    pdcp.dl_bytes_by_qci[i] = c[slot_t::PDCP_DL_BYTES_BY_QCI + i];
+    pdcp.ul_bytes_by_qci[i] = c[slot_t::PDCP_UL_BYTES_BY_QCI + i];
+  }
+}
+#endif
+
+} // namespace
+
+void ue_metrics_reader::read(const ue_metrics_registry& registry, enb_metrics_t& m)
+{
+  static const ue_metrics_snapshot_t zero = {};
+
+  uint32_t nof_slots = registry.nof_slots();
+  if (baselines.size() < nof_slots) {
+    baselines.resize(nof_slots);
+  }
+
+  m.phy.clear();
+  m.stack.mac.clear();
+  m.stack.rrc.ues.clear();
+#ifdef ENABLE_RIC_AGENT_KPM
+  m.stack.pdcp.ues.clear();
+#endif
+
+  ue_metrics_snapshot_t cur;
+  for (uint32_t idx = 0; idx < nof_slots; idx++) {
+    baseline_t& base = baselines[idx];
+    if (not registry.read(idx, cur)) {
+      base.valid = false;
+      continue;
+    }
+    // A slot that was released and claimed again since the last read starts from zero
+    const ue_metrics_snapshot_t& prev =
+        (base.valid and base.snapshot.generation == cur.generation) ? base.snapshot : zero;
+
+    m.stack.mac.emplace_back();
+    fill_mac(cur, prev, m.stack.mac.back());
+    m.phy.emplace_back();
+    fill_phy(cur, prev, m.phy.back());
+
+    rrc_ue_metrics_t rrc_ue = {};
+    rrc_ue.state            = (rrc_state_t)cur.upper[slot_t::RRC_STATE];
+#ifdef ENABLE_RIC_AGENT_KPM
+    rrc_ue.rnti = cur.rnti;
+    m.stack.pdcp.ues.emplace_back();
+    fill_pdcp(cur, m.stack.pdcp.ues.back());
+#endif
+    m.stack.rrc.ues.push_back(rrc_ue);
+
+    base.snapshot = cur;
+    base.valid    = true;
+  }
+
+  m.stack.rrc.n_ues = m.stack.rrc.ues.size();
+#ifdef ENABLE_RIC_AGENT_KPM
+  m.stack.pdcp.n_ues = m.stack.pdcp.ues.size();
+#endif
+}
+
+} // namespace srsenb
@@ -21,6 +21,7 @@
 
 #include "srsenb/hdr/metrics_csv.h"
 #include "srsenb/hdr/metrics_stdout.h"
+#include "srsenb/hdr/ue_metrics_reader.h"
 #include "srslte/common/metrics_hub.h"
 #include "srslte/interfaces/enb_metrics_interface.h"
 #include "srslte/srslte.h"
@@ -44,6 +45,11 @@ class enb_dummy : public enb_metrics_interface
 public:
   enb_dummy()
   {
+    for (enb_metrics_t& m : metrics) {
+      m.stack.mac.resize(1);
+      m.phy.resize(1);
+    }
+
     // first entry
     metrics[0].rf.rf_o                = 10;
     metrics[0].stack.rrc.n_ues        = 1;
@@ -60,9 +66,9 @@ public:
     metrics[0].stack.mac[0].dl_ri     = 1.5;
     metrics[0].stack.mac[0].dl_pmi    = 1.0;
     metrics[0].stack.mac[0].phr       = 12.0;
-    metrics[0].phy->dl.mcs            = 28.0;
-    metrics[0].phy->ul.mcs            = 20.2;
-    metrics[0].phy->ul.sinr           = 14.2;
+    metrics[0].phy[0].dl.mcs            = 28.0;
+    metrics[0].phy[0].ul.mcs            = 20.2;
+    metrics[0].phy[0].ul.sinr           = 14.2;
 
     // second
     metrics[1].rf.rf_o                = 10;
@@ -80,9 +86,9 @@ public:
     metrics[1].stack.mac[0].dl_ri     = 1.5;
     metrics[1].stack.mac[0].dl_pmi    = 1.0;
     metrics[1].stack.mac[0].phr       = 99.1;
-    metrics[1].phy->dl.mcs            = 6.2;
-    metrics[1].phy->ul.mcs            = 28.0;
-    metrics[1].phy->ul.sinr           = 22.2;
+    metrics[1].phy[0].dl.mcs            = 6.2;
+    metrics[1].phy[0].ul.mcs            = 28.0;
+    metrics[1].phy[0].ul.sinr           = 22.2;
 
     // third entry
     metrics[2].rf.rf_o                = 10;
@@ -100,19 +106,21 @@ public:
     metrics[2].stack.mac[0].dl_ri     = 1.5;
     metrics[2].stack.mac[0].dl_pmi    = 1.0;
     metrics[2].stack.mac[0].phr       = 12.0;
-    metrics[2].phy->dl.mcs            = 28.0;
-    metrics[2].phy->ul.mcs            = 20.2;
-    metrics[2].phy->ul.sinr           = 14.2;
+    metrics[2].phy[0].dl.mcs            = 28.0;
+    metrics[2].phy[0].ul.mcs            = 20.2;
+    metrics[2].phy[0].ul.sinr           = 14.2;
   }
 
   bool get_metrics(enb_metrics_t* m)
   {
     // fill dummy values
-    memcpy(m, &metrics[counter % NUM_METRICS], sizeof(enb_metrics_t));
+    *m = metrics[counter % NUM_METRICS];
     counter++;
     return true;
   }
 
+  bool get_metrics(enb_metrics_t* m, ue_metrics_reader& reader) { return get_metrics(m); }
+
 private:
   int           counter              = 0;
   enb_metrics_t metrics[NUM_METRICS] = {};
@@ -0,0 +1,193 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsenb/hdr/stack/mac/softbuffer_pool.h"
+#include "srsenb/hdr/stack/mac/ue.h"
+#include "srslte/common/test_common.h"
+
+using namespace srsenb;
+
+static const uint32_t nof_prb = 25;
+
+int test_pool_exhaustion()
+{
+  softbuffer_pool_metrics_t m = {};
+
+  // Overflow: extra buffers once the pool is empty, freed when given back
+  softbuffer_tx_pool tx_pool;
+  TESTASSERT(tx_pool.init(nof_prb, 4, true));
+  std::vector<srslte_softbuffer_tx_t*> buffers;
+  for (uint32_t i = 0; i < 6; i++) {
+    buffers.push_back(tx_pool.allocate());
+    TESTASSERT(buffers.back() != nullptr and buffers.back()->max_cb > 0);
+  }
+  tx_pool.get_metrics(m);
+  TESTASSERT(m.capacity == 4 and m.in_use == 6 and m.peak == 6);
+  TESTASSERT(m.nof_overflow == 2 and m.nof_exhausted == 2);
+  TESTASSERT(m.nof_bytes >= 6 * SOFTBUFFER_SIZE);
+  for (srslte_softbuffer_tx_t* b : buffers) {
+    tx_pool.deallocate(b);
+  }
+  tx_pool.get_metrics(m);
+  TESTASSERT(m.in_use == 0 and m.nof_overflow == 0 and m.peak == 6);
+
+  // No overflow: the grant has to be skipped
+  softbuffer_rx_pool rx_pool;
+  TESTASSERT(rx_pool.init(nof_prb, 2, false));
+  srslte_softbuffer_rx_t* b0 = rx_pool.allocate();
+  srslte_softbuffer_rx_t* b1 = rx_pool.allocate();
+  TESTASSERT(b0 != nullptr and b1 != nullptr and b0 != b1);
+  TESTASSERT(rx_pool.allocate() == nullptr);
+  rx_pool.deallocate(b1);
+  TESTASSERT(rx_pool.allocate() == b1);
+  rx_pool.get_metrics(m);
+  TESTASSERT(m.in_use == 2 and m.nof_overflow == 0 and m.nof_exhausted == 1);
+  rx_pool.deallocate(b0);
+  rx_pool.deallocate(b1);
+
+  return SRSLTE_SUCCESS;
+}
+
+int test_ue_harq_binding()
+{
+  softbuffer_tx_pool tx_pool;
+  softbuffer_rx_pool rx_pool;
+  TESTASSERT(tx_pool.init(nof_prb, 8, false));
+  TESTASSERT(rx_pool.init(nof_prb, 8, false));
+  softbuffer_pool_metrics_t tx_m = {}, rx_m = {};
+
+  {
+    ue u(0x46, nof_prb, &tx_pool, &rx_pool, nullptr, nullptr, nullptr, nullptr, srslte::logmap::get("MAC"), 1);
+    u.set_max_harq_tx(3);
+
+    // Connected UEs do not hold softbuffers until they are scheduled
+    tx_pool.get_metrics(tx_m);
+    TESTASSERT(tx_m.in_use == 0);
+
+    // DL: bound on the first transmission, kept for the retransmissions, given back on ACK
+    uint32_t                tti = 100;
+    srslte_softbuffer_tx_t* b   = u.get_tx_softbuffer(0, 2, 0, tti, true);
+    TESTASSERT(b != nullptr);
+    u.set_tx_softbuffer_ack(0, 2, 0, false);
+    tti += 8;
+    TESTASSERT(u.get_tx_softbuffer(0, 2, 0, tti, false) == b);
+    // Feedback of another HARQ process, or of an unknown one, is ignored
+    u.set_tx_softbuffer_ack(0, 3, 0, true);
+    u.set_tx_softbuffer_ack(0, SRSLTE_MAX_HARQ_PROC, 0, true);
+    tx_pool.get_metrics(tx_m);
+    TESTASSERT(tx_m.in_use == 1);
+    u.set_tx_softbuffer_ack(0, 2, 0, true);
+    tx_pool.get_metrics(tx_m);
+    TESTASSERT(tx_m.in_use == 0);
+
+    // DL: given back after the last retransmission
+    for (uint32_t n = 0; n < 3; n++) {
+      tti += 8;
+      TESTASSERT(u.get_tx_softbuffer(0, 5, 1, tti, n == 0) != nullptr);
+      u.set_tx_softbuffer_ack(0, 5, 1, false);
+    }
+    tx_pool.get_metrics(tx_m);
+    TESTASSERT(tx_m.in_use == 0);
+
+    // UL: given back on CRC OK or after the last retransmission
+    tti = 10235;
+    TESTASSERT(u.get_rx_softbuffer(0, tti, 0) != nullptr);
+    u.set_rx_softbuffer_crc(0, tti, false);
+    tti = TTI_ADD(tti, 8);
+    TESTASSERT(u.get_rx_softbuffer(0, tti, 1) != nullptr);
+    u.set_rx_softbuffer_crc(0, tti, true);
+    rx_pool.get_metrics(rx_m);
+    TESTASSERT(rx_m.in_use == 0);
+    for (uint32_t n = 0; n < 3; n++) {
+      TESTASSERT(u.get_rx_softbuffer(0, tti, n) != nullptr);
+      u.set_rx_softbuffer_crc(0, tti, false);
+      tti = TTI_ADD(tti, 8);
+    }
+    rx_pool.get_metrics(rx_m);
+    TESTASSERT(rx_m.in_use == 0);
+
+    // Buffers whose feedback never came are reclaimed
+    TESTASSERT(u.get_tx_softbuffer(0, 0, 0, tti, true) != nullptr);
+    TESTASSERT(u.get_rx_softbuffer(0, tti, 0) != nullptr);
+    u.release_stale_softbuffers(TTI_ADD(tti, 50));
+    tx_pool.get_metrics(tx_m);
+    TESTASSERT(tx_m.in_use == 1);
+    u.release_stale_softbuffers(TTI_ADD(tti, 200));
+    tx_pool.get_metrics(tx_m);
+    rx_pool.get_metrics(rx_m);
+    TESTASSERT(tx_m.in_use == 0 and rx_m.in_use == 0);
+
+    // Removed UEs give back their buffers
+    TESTASSERT(u.get_tx_softbuffer(0, 1, 0, tti, true) != nullptr);
+    TESTASSERT(u.get_rx_softbuffer(0, tti, 0) != nullptr);
+  }
+  tx_pool.get_metrics(tx_m);
+  rx_pool.get_metrics(rx_m);
+  TESTASSERT(tx_m.in_use == 0 and rx_m.in_use == 0);
+
+  return SRSLTE_SUCCESS;
+}
+
+int test_ue_dropped_first_tx()
+{
+  softbuffer_tx_pool tx_pool;
+  softbuffer_rx_pool rx_pool;
+  TESTASSERT(tx_pool.init(nof_prb, 1, false));
+  TESTASSERT(rx_pool.init(nof_prb, 1, false));
+  softbuffer_pool_metrics_t tx_m = {};
+
+  ue u(0x46, nof_prb, &tx_pool, &rx_pool, nullptr, nullptr, nullptr, nullptr, srslte::logmap::get("MAC"), 1);
+  u.set_max_harq_tx(3);
+
+  // The first transmission of pid=1 is dropped, as the only buffer of the pool is taken by pid=0
+  uint32_t                tti = 100;
+  srslte_softbuffer_tx_t* b   = u.get_tx_softbuffer(0, 0, 0, tti, true);
+  TESTASSERT(b != nullptr);
+  TESTASSERT(u.get_tx_softbuffer(0, 1, 0, tti + 1, true) == nullptr);
+  u.set_tx_softbuffer_ack(0, 0, 0, true);
+
+  // The retransmission of pid=1 must not be encoded into a fresh buffer, even if the pool has one again
+  TESTASSERT(u.get_tx_softbuffer(0, 1, 0, tti + 9, false) == nullptr);
+  tx_pool.get_metrics(tx_m);
+  TESTASSERT(tx_m.in_use == 0);
+
+  // Same once the buffer of a first transmission is reclaimed as stale
+  TESTASSERT(u.get_tx_softbuffer(0, 2, 0, tti + 10, true) == b);
+  u.release_stale_softbuffers(TTI_ADD(tti, 200));
+  TESTASSERT(u.get_tx_softbuffer(0, 2, 0, TTI_ADD(tti, 200), false) == nullptr);
+  tx_pool.get_metrics(tx_m);
+  TESTASSERT(tx_m.in_use == 0);
+
+  // A new transmission of the flushed HARQ process binds a buffer again
+  TESTASSERT(u.get_tx_softbuffer(0, 1, 0, TTI_ADD(tti, 201), true) == b);
+
+  return SRSLTE_SUCCESS;
+}
+
+int main()
+{
+  srslte::logmap::set_default_log_level(srslte::LOG_LEVEL_INFO);
+  TESTASSERT(test_pool_exhaustion() == SRSLTE_SUCCESS);
+  TESTASSERT(test_ue_harq_binding() == SRSLTE_SUCCESS);
+  TESTASSERT(test_ue_dropped_first_tx() == SRSLTE_SUCCESS);
+  printf("Success\n");
+  return SRSLTE_SUCCESS;
+}
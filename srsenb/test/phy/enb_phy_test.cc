@@ -302,6 +302,7 @@ private:
   CALLBACK(get_mch_sched);
   CALLBACK(get_ul_sched);
   CALLBACK(set_sched_dl_tti_mask);
+  CALLBACK(set_overload_limits);
   CALLBACK(tti_clock);
 
   typedef struct {
@@ -688,6 +689,10 @@ public:
     return SRSLTE_SUCCESS;
   }
   void set_sched_dl_tti_mask(uint8_t* tti_mask, uint32_t nof_sfs) override { notify_set_sched_dl_tti_mask(); }
+  void set_overload_limits(const srsenb::sched_interface::overload_limits_t& limits) override
+  {
+    notify_set_overload_limits();
+  }
   void tti_clock() override { notify_tti_clock(); }
   int  run_tti(bool enable_assert)
   {
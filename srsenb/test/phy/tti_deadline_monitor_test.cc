@@ -0,0 +1,162 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsenb/hdr/phy/tti_deadline_monitor.h"
+#include "srslte/common/test_common.h"
+
+using namespace srsenb;
+
+static phy_overload_args_t make_args()
+{
+  phy_overload_args_t args = {};
+  args.enable              = true;
+  args.slack_threshold_us  = 500;
+  args.window_ms           = 10;
+  args.enter_ratio         = 0.2f;
+  args.exit_ratio          = 0.0f;
+  args.max_level           = 3;
+  args.pusch_max_its       = 4;
+  args.max_users           = 2;
+  args.max_prb_ratio       = 0.5f;
+  return args;
+}
+
+// Runs one evaluation window with the given number of tight TTIs, returns whether the level changed
+static bool run_window(tti_deadline_monitor& m, uint32_t nof_ttis, uint32_t nof_tight)
+{
+  bool changed = false;
+  for (uint32_t i = 0; i < nof_ttis; i++) {
+    changed |= m.tti_done_slack(i < nof_tight ? -100.0f : 2000.0f);
+  }
+  return changed;
+}
+
+int test_escalation_and_recovery()
+{
+  tti_deadline_monitor m;
+  m.init(make_args(), 3000);
+
+  TESTASSERT(m.get_level() == 0);
+  TESTASSERT(m.get_pusch_max_its(8) == 8);
+  TESTASSERT(m.get_sched_limits().max_dl_users == 0);
+
+  // Occasional late TTIs below the enter ratio do not degrade
+  TESTASSERT(not run_window(m, 10, 1));
+  TESTASSERT(m.get_level() == 0);
+
+  // Sustained overload raises one level per window, up to the maximum
+  TESTASSERT(run_window(m, 10, 5));
+  TESTASSERT(m.get_level() == 1);
+  TESTASSERT(m.get_pusch_max_its(8) == 4);
+  TESTASSERT(m.get_pusch_max_its(2) == 2);
+  TESTASSERT(m.get_sched_limits().max_dl_users == 0);
+
+  TESTASSERT(run_window(m, 10, 5));
+  TESTASSERT(m.get_level() == 2);
+  sched_interface::overload_limits_t limits = m.get_sched_limits();
+  TESTASSERT(limits.max_dl_users == 2 and limits.max_ul_users == 2);
+  TESTASSERT(limits.max_prb_ratio == 0.5f);
+  TESTASSERT(not limits.dl_ctrl_only);
+
+  TESTASSERT(run_window(m, 10, 5));
+  TESTASSERT(m.get_level() == 3);
+  TESTASSERT(m.get_sched_limits().dl_ctrl_only);
+
+  TESTASSERT(not run_window(m, 10, 10));
+  TESTASSERT(m.get_level() == 3);
+
+  // A window with some tight TTIs between exit and enter ratios holds the level
+  TESTASSERT(not run_window(m, 10, 1));
+  TESTASSERT(m.get_level() == 3);
+
+  // Clean windows recover one level at a time
+  TESTASSERT(run_window(m, 10, 0));
+  TESTASSERT(m.get_level() == 2);
+  TESTASSERT(run_window(m, 10, 0));
+  TESTASSERT(run_window(m, 10, 0));
+  TESTASSERT(m.get_level() == 0);
+  limits = m.get_sched_limits();
+  TESTASSERT(limits.max_dl_users == 0 and limits.max_prb_ratio == 1.0f and not limits.dl_ctrl_only);
+
+  phy_overload_metrics_t metrics = {};
+  m.get_metrics(&metrics);
+  TESTASSERT(metrics.nof_ttis == 90);
+  TESTASSERT(metrics.nof_late == 1 + 5 * 3 + 10 + 1);
+  TESTASSERT(metrics.nof_tight == metrics.nof_late);
+  TESTASSERT(metrics.nof_escalations == 3);
+  TESTASSERT(metrics.nof_degraded_ttis == 70);
+  TESTASSERT(metrics.level == 0);
+  TESTASSERT(metrics.min_slack_us == 2000.0f and metrics.avg_slack_us == 2000.0f);
+
+  return SRSLTE_SUCCESS;
+}
+
+int test_disabled()
+{
+  phy_overload_args_t args = make_args();
+  args.enable              = false;
+
+  tti_deadline_monitor m;
+  m.init(args, 3000);
+  TESTASSERT(not run_window(m, 10, 10));
+  TESTASSERT(m.get_level() == 0);
+
+  // Slack is still measured and reported
+  phy_overload_metrics_t metrics = {};
+  m.get_metrics(&metrics);
+  TESTASSERT(metrics.nof_late == 10);
+  TESTASSERT(metrics.min_slack_us == -100.0f);
+  TESTASSERT(metrics.nof_escalations == 0);
+
+  // Slack is the budget minus the time elapsed since reception
+  TESTASSERT(not m.tti_done(tti_deadline_monitor::clock::now()));
+  TESTASSERT(not m.tti_done(tti_deadline_monitor::clock::now() - std::chrono::milliseconds(4)));
+  m.get_metrics(&metrics);
+  TESTASSERT(metrics.nof_ttis == 12);
+  TESTASSERT(metrics.nof_late == 11);
+
+  return SRSLTE_SUCCESS;
+}
+
+int test_max_level()
+{
+  phy_overload_args_t args = make_args();
+  args.max_level           = 1;
+
+  tti_deadline_monitor m;
+  m.init(args, 3000);
+  for (uint32_t i = 0; i < 5; i++) {
+    run_window(m, 10, 10);
+  }
+  TESTASSERT(m.get_level() == 1);
+  TESTASSERT(m.get_sched_limits().max_dl_users == 0);
+
+  return SRSLTE_SUCCESS;
+}
+
+int main()
+{
+  TESTASSERT(test_escalation_and_recovery() == SRSLTE_SUCCESS);
+  TESTASSERT(test_disabled() == SRSLTE_SUCCESS);
+  TESTASSERT(test_max_level() == SRSLTE_SUCCESS);
+  printf("Success\n");
+  return SRSLTE_SUCCESS;
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsenb/hdr/ue_metrics_reader.h"
+#include "srslte/common/test_common.h"
+#include <thread>
+
+using namespace srsenb;
+
+typedef ue_metrics_slot_t slot_t;
+
+int test_claim_release()
+{
+  ue_metrics_registry registry;
+
+  TESTASSERT(registry.find(0x46) == nullptr);
+  slot_t* slot = registry.claim(0x46);
+  TESTASSERT(slot != nullptr);
+  TESTASSERT(registry.claim(0x46) == slot);
+  TESTASSERT(registry.find(0x46) == slot);
+  TESTASSERT(registry.nof_slots() == 1);
+
+  slot->mac_tx(true, 100);
+  registry.release(0x46);
+  TESTASSERT(registry.find(0x46) == nullptr);
+
+  ue_metrics_snapshot_t snap;
+  TESTASSERT(not registry.read(0, snap));
+
+  // The released slot is recycled with all counters at zero
+  slot_t* slot2 = registry.claim(0x47);
+  TESTASSERT(slot2 == slot);
+  TESTASSERT(registry.nof_slots() == 1);
+  TESTASSERT(registry.read(0, snap));
+  TESTASSERT(snap.rnti == 0x47);
+  TESTASSERT(snap.mac[slot_t::MAC_TX_PKTS] == 0);
+
+  // More UEs than fit in one chunk
+  for (uint32_t i = 0; i < 3 * ue_metrics_registry::slots_per_chunk; i++) {
+    TESTASSERT(registry.claim(0x100 + i) != nullptr);
+  }
+  TESTASSERT(registry.nof_slots() == 3 * ue_metrics_registry::slots_per_chunk + 1);
+  for (uint32_t i = 0; i < 3 * ue_metrics_registry::slots_per_chunk; i++) {
+    TESTASSERT(registry.find(0x100 + i) != nullptr);
+    TESTASSERT(registry.find(0x100 + i)->rnti == 0x100 + i);
+  }
+  return SRSLTE_SUCCESS;
+}
+
+int test_reader_periods()
+{
+  ue_metrics_registry registry;
+  ue_metrics_reader   reader1, reader2;
+  enb_metrics_t       m1, m2;
+
+  slot_t* slot = registry.claim(0x46);
+  slot->mac_tti();
+  slot->mac_tx(true, 10);
+  slot->mac_tx(false, 10);
+  slot->mac_dl_cqi(10);
+  slot->mac_dl_cqi(12);
+  slot->mac_sched_state(100, 200, 6, 8);
+  slot->phy_ul(1, 20, -60, 15.5, 2);
+  slot->rrc_state(RRC_STATE_REGISTERED);
+
+  reader1.read(registry, m1);
+  TESTASSERT(m1.stack.mac.size() == 1 and m1.phy.size() == 1 and m1.stack.rrc.ues.size() == 1);
+  TESTASSERT(m1.stack.rrc.n_ues == 1);
+  TESTASSERT(m1.stack.mac[0].rnti == 0x46);
+  TESTASSERT(m1.stack.mac[0].nof_tti == 1);
+  TESTASSERT(m1.stack.mac[0].tx_pkts == 2);
+  TESTASSERT(m1.stack.mac[0].tx_errors == 1);
+  TESTASSERT(m1.stack.mac[0].tx_brate == 80);
+  TESTASSERT(m1.stack.mac[0].dl_cqi == 11);
+  TESTASSERT(m1.stack.mac[0].ul_buffer == 100);
+  TESTASSERT(m1.stack.mac[0].dl_rb == 6);
+  TESTASSERT(m1.phy[0].ul.n_samples == 1);
+  TESTASSERT(m1.phy[0].ul.sinr == 15.5);
+  TESTASSERT(std::isnan(m1.phy[0].dl.mcs));
+  TESTASSERT(m1.stack.rrc.ues[0].state == RRC_STATE_REGISTERED);
+
+  // Second period of reader1 only sees the new events, buffer states keep their value
+  slot->mac_tx(true, 20);
+  reader1.read(registry, m1);
+  TESTASSERT(m1.stack.mac[0].tx_pkts == 1);
+  TESTASSERT(m1.stack.mac[0].tx_brate == 160);
+  TESTASSERT(m1.stack.mac[0].dl_cqi == 0);
+  TESTASSERT(m1.stack.mac[0].ul_buffer == 100);
+  TESTASSERT(m1.phy[0].ul.n_samples == 0);
+
+  // An independent reader is not affected by reader1
+  reader2.read(registry, m2);
+  TESTASSERT(m2.stack.mac[0].tx_pkts == 3);
+
+  // A new UE in the same slot does not inherit the deltas of the previous one
+  registry.release(0x46);
+  reader1.read(registry, m1);
+  TESTASSERT(m1.stack.mac.empty() and m1.stack.rrc.n_ues == 0);
+  registry.release(0x46);
+  slot = registry.claim(0x47);
+  slot->mac_rx(true, 1);
+  reader2.read(registry, m2);
+  TESTASSERT(m2.stack.mac.size() == 1);
+  TESTASSERT(m2.stack.mac[0].rnti == 0x47);
+  TESTASSERT(m2.stack.mac[0].tx_pkts == 0);
+  TESTASSERT(m2.stack.mac[0].rx_pkts == 1);
+  return SRSLTE_SUCCESS;
+}
+
+int test_concurrent_writer()
+{
+  const uint32_t      nof_events = 200000;
+  ue_metrics_registry registry;
+  ue_metrics_reader   reader;
+  enb_metrics_t       m;
+
+  slot_t* slot = registry.claim(0x46);
+
+  std::thread writer([slot, nof_events]() {
+    for (uint32_t i = 0; i < nof_events; i++) {
+      slot->mac_tx(true, 1);
+      slot->phy_dl(0, 10);
+    }
+  });
+
+  uint64_t total = 0;
+  while (total < nof_events) {
+    reader.read(registry, m);
+    TESTASSERT(m.stack.mac.size() == 1);
+    // Counters are not updated together, but each of them only moves forward
+    TESTASSERT(m.stack.mac[0].tx_pkts >= 0 and m.stack.mac[0].tx_brate >= 0);
+    TESTASSERT(m.phy[0].dl.n_samples >= 0);
+    total += m.stack.mac[0].tx_pkts;
+  }
+  writer.join();
+  TESTASSERT(total == nof_events);
+  return SRSLTE_SUCCESS;
+}
+
+int main()
+{
+  TESTASSERT(test_claim_release() == SRSLTE_SUCCESS);
+  TESTASSERT(test_reader_periods() == SRSLTE_SUCCESS);
+  TESTASSERT(test_concurrent_writer() == SRSLTE_SUCCESS);
+  printf("Success\n");
+  return SRSLTE_SUCCESS;
+}
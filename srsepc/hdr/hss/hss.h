@@ -28,6 +28,7 @@
 #ifndef SRSEPC_HSS_H
 #define SRSEPC_HSS_H
 
+#include "srsepc/hdr/hss/hss_store.h"
 #include "srslte/common/buffer_pool.h"
 #include "srslte/common/log.h"
 #include "srslte/common/log_filter.h"
@@ -35,43 +36,25 @@
 #include <cstddef>
 #include <fstream>
 #include <map>
+#include <vector>
 
 #define LTE_FDD_ENB_IND_HE_N_BITS 5
 #define LTE_FDD_ENB_IND_HE_MASK 0x1FUL
 #define LTE_FDD_ENB_IND_HE_MAX_VALUE 31
 #define LTE_FDD_ENB_SEQ_HE_MAX_VALUE 0x07FFFFFFFFFFUL
 
+#define HSS_MILENAGE_BATCH 16
+
 namespace srsepc {
 
 typedef struct {
   std::string db_file;
+  std::string db_store;          ///< Binary subscriber store. Empty keeps the subscribers in memory only
+  uint32_t    db_sync_period_ms; ///< Maximum time between flushes of the store to disk
   uint16_t    mcc;
   uint16_t    mnc;
 } hss_args_t;
 
-enum hss_auth_algo { HSS_ALGO_XOR, HSS_ALGO_MILENAGE };
-
-typedef struct {
-  // Members
-  std::string        name;
-  uint64_t           imsi;
-  enum hss_auth_algo algo;
-  uint8_t            key[16];
-  bool               op_configured;
-  uint8_t            op[16];
-  uint8_t            opc[16];
-  uint8_t            amf[2];
-  uint8_t            sqn[6];
-  uint16_t           qci;
-  uint8_t            last_rand[16];
-  std::string        static_ip_addr;
-
-  // Helper getters/setters
-  void set_sqn(const uint8_t* sqn_);
-  void set_last_rand(const uint8_t* rand_);
-  void get_last_rand(uint8_t* rand_);
-} hss_ue_ctx_t;
-
 class hss : public hss_interface_nas
 {
 public:
@@ -81,9 +64,10 @@ public:
   void        stop(void);
 
   virtual bool gen_auth_info_answer(uint64_t imsi, uint8_t* k_asme, uint8_t* autn, uint8_t* rand, uint8_t* xres);
+  virtual bool gen_auth_vectors(uint64_t imsi, auth_vector_t* vectors, uint32_t nof_vectors);
   virtual bool gen_update_loc_answer(uint64_t imsi, uint8_t* qci);
 
-  virtual bool resync_sqn(uint64_t imsi, uint8_t* auts);
+  virtual bool resync_sqn(uint64_t imsi, uint8_t* rand, uint8_t* auts);
 
   std::map<std::string, uint64_t> get_ip_to_imsi() const;
 
@@ -92,15 +76,14 @@ private:
   virtual ~hss();
   static hss* m_instance;
 
-  std::map<uint64_t, std::unique_ptr<hss_ue_ctx_t> > m_imsi_to_ue_ctx;
+  hss_store m_store;
 
   void gen_rand(uint8_t rand_[16]);
 
-  void
-       gen_auth_info_answer_milenage(hss_ue_ctx_t* ue_ctx, uint8_t* k_asme, uint8_t* autn, uint8_t* rand, uint8_t* xres);
+  void gen_auth_vectors_milenage(hss_ue_ctx_t* ue_ctx, auth_vector_t* vectors, uint32_t nof_vectors);
   void gen_auth_info_answer_xor(hss_ue_ctx_t* ue_ctx, uint8_t* k_asme, uint8_t* autn, uint8_t* rand, uint8_t* xres);
 
-  void resync_sqn_milenage(hss_ue_ctx_t* ue_ctx, uint8_t* auts);
+  void resync_sqn_milenage(hss_ue_ctx_t* ue_ctx, uint8_t* rand, uint8_t* auts);
   void resync_sqn_xor(hss_ue_ctx_t* ue_ctx, uint8_t* auts);
 
   std::vector<std::string> split_string(const std::string& str, char delimiter);
@@ -111,7 +94,8 @@ private:
   void increment_sqn(uint8_t* sqn, uint8_t* next_sqn);
 
   bool          set_auth_algo(std::string auth_algo);
-  bool          read_db_file(std::string db_file);
+  bool          load_db(const std::string& db_file, const std::string& store_file);
+  bool          read_db_file(std::string db_file, std::vector<hss_ue_ctx_t>* ues);
   bool          write_db_file(std::string db_file);
   hss_ue_ctx_t* get_ue_ctx(uint64_t imsi);
 
@@ -128,19 +112,5 @@ private:
   std::map<std::string, uint64_t> m_ip_to_imsi;
 };
 
-inline void hss_ue_ctx_t::set_sqn(const uint8_t* sqn_)
-{
-  memcpy(sqn, sqn_, 6);
-}
-
-inline void hss_ue_ctx_t::set_last_rand(const uint8_t* last_rand_)
-{
-  memcpy(last_rand, last_rand_, 16);
-}
-
-inline void hss_ue_ctx_t::get_last_rand(uint8_t* last_rand_)
-{
-  memcpy(last_rand_, last_rand, 16);
-}
 } // namespace srsepc
 #endif // SRSEPC_HSS_H
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        hss_store.h
+ * Description: Binary subscriber store of the HSS. The file is an open
+ *              addressing hash table of fixed size subscriber records keyed
+ *              by IMSI and is memory-mapped as is, so loading it does not
+ *              parse anything and lookups are O(1). SQN updates are done in
+ *              place and flushed to disk periodically.
+ *****************************************************************************/
+
+#ifndef SRSEPC_HSS_STORE_H
+#define SRSEPC_HSS_STORE_H
+
+#include <arpa/inet.h>
+#include <chrono>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+namespace srsepc {
+
+#define HSS_UE_NAME_MAX_LEN 32
+
+enum hss_auth_algo { HSS_ALGO_XOR, HSS_ALGO_MILENAGE };
+
+/// Subscriber record. Stored verbatim in the store file, so it must stay trivially copyable
+typedef struct {
+  // Members
+  uint64_t           imsi; ///< 0 marks an empty slot of the store
+  enum hss_auth_algo algo;
+  bool               op_configured;
+  uint8_t            key[16];
+  uint8_t            op[16];
+  uint8_t            opc[16];
+  uint8_t            amf[2];
+  uint8_t            sqn[6];
+  uint16_t           qci;
+  uint8_t            last_rand[16];
+  char               name[HSS_UE_NAME_MAX_LEN];       ///< Truncated to HSS_UE_NAME_MAX_LEN - 1 characters
+  char               static_ip_addr[INET_ADDRSTRLEN]; ///< "0.0.0.0" for dynamic allocation
+
+  // Helper getters/setters
+  void set_sqn(const uint8_t* sqn_);
+  void set_last_rand(const uint8_t* rand_);
+  void get_last_rand(uint8_t* rand_);
+} hss_ue_ctx_t;
+
+class hss_store
+{
+public:
+  typedef std::chrono::steady_clock clock;
+
+  hss_store() = default;
+  ~hss_store();
+  hss_store(const hss_store&) = delete;
+  hss_store& operator=(const hss_store&) = delete;
+
+  /// Creates an empty store with room for at least nof_ues subscribers. An empty path keeps it in anonymous memory
+  bool create(const std::string& path, uint64_t nof_ues);
+  /// Maps an existing store file. Fails if it does not exist or was written with another record layout
+  bool open(const std::string& path);
+  void close();
+
+  /// Renames the store file, e.g. to atomically replace an older store once an import completed
+  bool rename(const std::string& new_path);
+  void swap(hss_store& other);
+
+  /// O(1) lookup by IMSI, nullptr if the subscriber is not provisioned
+  hss_ue_ctx_t* find(uint64_t imsi);
+  /// Returns the record of imsi, allocating an empty one if needed. nullptr if the store is full or imsi is 0
+  hss_ue_ctx_t* insert(uint64_t imsi);
+
+  /// Signals an in-place update of ue_ctx. Flushes the pages updated since the last flush if sync_period_ms elapsed
+  void written(const hss_ue_ctx_t* ue_ctx);
+  /// Flushes the whole store to disk and waits for completion
+  bool sync();
+
+  /// Updates happen in the shared page cache, so a crash of the process never loses them. The period bounds what a
+  /// crash of the host can lose. 0 flushes on every update
+  void set_sync_period_ms(uint32_t period_ms) { sync_period_ms = period_ms; }
+
+  /// Modification time, in ns, and size of the CSV file the store was last synchronized with
+  void set_csv_stamp(int64_t mtime_ns, int64_t size);
+  bool csv_stamp_matches(int64_t mtime_ns, int64_t size) const;
+
+  bool               is_open() const { return records != nullptr; }
+  uint64_t           size() const;
+  uint64_t           capacity() const;
+  const std::string& get_path() const { return path; }
+
+  /// Calls f(hss_ue_ctx_t&) for all subscribers, in storage order
+  template <class F>
+  void for_each(F f)
+  {
+    for (uint64_t i = 0; i < capacity(); i++) {
+      if (records[i].imsi != 0) {
+        f(records[i]);
+      }
+    }
+  }
+
+private:
+  struct header_t {
+    char     magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t capacity; ///< Number of slots, a power of 2
+    uint64_t nof_ues;
+    int64_t  csv_mtime; ///< ns since the epoch
+    int64_t  csv_size;
+    uint8_t  reserved[16];
+  };
+
+  bool     map(int fd_, size_t len);
+  bool     sync_dirty_pages();
+  uint64_t slot_of(uint64_t imsi) const;
+
+  std::string         path;
+  int                 fd             = -1;
+  uint8_t*            base           = nullptr;
+  size_t              map_len        = 0;
+  header_t*           header         = nullptr;
+  hss_ue_ctx_t*       records        = nullptr;
+  uint32_t            sync_period_ms = 1000;
+  clock::time_point   last_sync;
+  size_t              page_size      = 0;
+  std::vector<bool>   page_dirty;  ///< Pages with updates not flushed yet
+  std::vector<size_t> dirty_pages; ///< Indexes of the pages set in page_dirty
+};
+
+inline void hss_ue_ctx_t::set_sqn(const uint8_t* sqn_)
+{
+  memcpy(sqn, sqn_, 6);
+}
+
+inline void hss_ue_ctx_t::set_last_rand(const uint8_t* last_rand_)
+{
+  memcpy(last_rand, last_rand_, 16);
+}
+
+inline void hss_ue_ctx_t::get_last_rand(uint8_t* last_rand_)
+{
+  memcpy(last_rand_, last_rand, 16);
+}
+
+} // namespace srsepc
+
+#endif // SRSEPC_HSS_STORE_H
@@ -28,6 +28,7 @@
 #ifndef SRSEPC_MME_H
 #define SRSEPC_MME_H
 
+#include "mme_timer_wheel.h"
 #include "s1ap.h"
 #include "srslte/common/buffer_pool.h"
 #include "srslte/common/log.h"
@@ -43,12 +44,6 @@ typedef struct {
   // gtpc_args_t gtpc_args;
 } mme_args_t;
 
-typedef struct {
-  int                 fd;
-  uint64_t            imsi;
-  enum nas_timer_type type;
-} mme_timer_t;
-
 class mme : public srslte::thread, public mme_interface_nas
 {
 public:
@@ -64,7 +59,7 @@ public:
   void run_thread();
 
   // Timer Methods
-  virtual bool add_nas_timer(int timer_fd, enum nas_timer_type type, uint64_t imsi);
+  virtual bool add_nas_timer(enum nas_timer_type type, uint64_t imsi, uint32_t timeout_ms);
   virtual bool is_nas_timer_running(enum nas_timer_type type, uint64_t imsi);
   virtual bool remove_nas_timer(enum nas_timer_type type, uint64_t imsi);
 
@@ -77,13 +72,12 @@ private:
 
   bool                      m_running;
   srslte::byte_buffer_pool* m_pool;
-  fd_set                    m_set;
+  int                       m_epoll_fd;
 
-  // Timer map
-  std::vector<mme_timer_t> timers;
+  // NAS timers of all UEs
+  mme_timer_wheel m_timers;
 
-  // Timer Methods
-  void handle_timer_expire(int timer_fd);
+  void handle_s1mme_rx(srslte::byte_buffer_t* pdu);
 
   // Logs
   srslte::log_filter* m_nas_log;
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        mme_auth_cache.h
+ * Description: Per-UE cache of authentication vectors between the NAS and the
+ *              HSS. Vectors are requested from the HSS in batches and handed
+ *              out in SQN order, so re-authenticating a UE with vectors left
+ *              needs no HSS round trip.
+ *****************************************************************************/
+
+#ifndef SRSEPC_MME_AUTH_CACHE_H
+#define SRSEPC_MME_AUTH_CACHE_H
+
+#include "srslte/common/log.h"
+#include "srslte/interfaces/epc_interfaces.h"
+#include <deque>
+#include <stdint.h>
+#include <unordered_map>
+
+namespace srsepc {
+
+class mme_auth_cache : public hss_interface_nas
+{
+public:
+  /// batch_size is the number of vectors requested per HSS query. 1 disables caching
+  void init(hss_interface_nas* hss, uint32_t batch_size, srslte::log* log);
+
+  virtual bool gen_auth_info_answer(uint64_t imsi, uint8_t* k_asme, uint8_t* autn, uint8_t* rand, uint8_t* xres);
+  virtual bool gen_auth_vectors(uint64_t imsi, auth_vector_t* vectors, uint32_t nof_vectors);
+  virtual bool gen_update_loc_answer(uint64_t imsi, uint8_t* qci);
+  /// Drops the cached vectors of the UE, their SQNs are no longer acceptable after a re-synchronization
+  virtual bool resync_sqn(uint64_t imsi, uint8_t* rand, uint8_t* auts);
+
+  void   flush(uint64_t imsi);
+  size_t nof_cached(uint64_t imsi) const;
+
+private:
+  hss_interface_nas* m_hss        = nullptr;
+  srslte::log*       m_log        = nullptr;
+  uint32_t           m_batch_size = 1;
+
+  std::unordered_map<uint64_t, std::deque<auth_vector_t> > m_vectors;
+};
+
+} // namespace srsepc
+#endif // SRSEPC_MME_AUTH_CACHE_H
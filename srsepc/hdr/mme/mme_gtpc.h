@@ -28,6 +28,7 @@
 #include "srslte/common/log_filter.h"
 #include <sys/socket.h>
 #include <sys/un.h>
+#include <unordered_map>
 
 namespace srsepc {
 
@@ -68,9 +69,9 @@ private:
   srslte::log_filter* m_mme_gtpc_log;
   s1ap*               m_s1ap;
 
-  uint32_t                            m_next_ctrl_teid;
-  std::map<uint32_t, uint64_t>        m_mme_ctr_teid_to_imsi;
-  std::map<uint64_t, struct gtpc_ctx> m_imsi_to_gtpc_ctx;
+  uint32_t                                      m_next_ctrl_teid;
+  std::unordered_map<uint32_t, uint64_t>        m_mme_ctr_teid_to_imsi;
+  std::unordered_map<uint64_t, struct gtpc_ctx> m_imsi_to_gtpc_ctx;
 
   int                m_s11;
   struct sockaddr_un m_mme_addr, m_spgw_addr;
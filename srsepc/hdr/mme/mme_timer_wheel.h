@@ -0,0 +1,96 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        mme_timer_wheel.h
+ * Description: Hashed timing wheel holding the NAS timers of all UEs. Timers
+ *              are indexed by type and IMSI, so starting, stopping and looking
+ *              them up is O(1), and the MME event loop advances the wheel once
+ *              per tick instead of polling one timerfd per running timer.
+ *****************************************************************************/
+
+#ifndef SRSEPC_MME_TIMER_WHEEL_H
+#define SRSEPC_MME_TIMER_WHEEL_H
+
+#include "srslte/interfaces/epc_interfaces.h"
+#include <chrono>
+#include <list>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace srsepc {
+
+typedef struct {
+  uint64_t            imsi;
+  enum nas_timer_type type;
+} mme_timer_t;
+
+class mme_timer_wheel
+{
+public:
+  typedef std::chrono::steady_clock clock;
+
+  explicit mme_timer_wheel(uint32_t tick_ms = 10, uint32_t nof_slots = 1024);
+
+  /// Sets the time origin of the wheel and drops all running timers
+  void reset(clock::time_point now);
+
+  /// Starts a timer expiring timeout_ms after now. Returns false if the same timer is already running
+  bool add(enum nas_timer_type type, uint64_t imsi, uint32_t timeout_ms, clock::time_point now = clock::now());
+  bool remove(enum nas_timer_type type, uint64_t imsi);
+  bool is_running(enum nas_timer_type type, uint64_t imsi) const;
+
+  /// Advances the wheel up to now and appends the timers that expired meanwhile to expired, in expiry order
+  void advance(clock::time_point now, std::vector<mme_timer_t>* expired);
+
+  /// Milliseconds until the next tick if any timer is running, -1 otherwise. Meant as poll/epoll timeout
+  int time_to_next_tick_ms(clock::time_point now) const;
+
+  size_t   size() const { return index.size(); }
+  uint32_t get_tick_ms() const { return tick_ms; }
+
+private:
+  struct entry_t {
+    mme_timer_t timer;
+    uint32_t    rounds; ///< Remaining turns of the wheel before expiry
+  };
+  typedef std::list<entry_t> slot_t;
+
+  struct location_t {
+    uint32_t         slot;
+    slot_t::iterator it;
+  };
+
+  static uint64_t key(enum nas_timer_type type, uint64_t imsi) { return (imsi << 4u) | (uint64_t)type; }
+
+  uint64_t tick_of(clock::time_point t) const;
+
+  uint32_t                                 tick_ms;
+  std::vector<slot_t>                      slots;
+  std::unordered_map<uint64_t, location_t> index;
+  clock::time_point                        origin;
+  uint64_t                                 cur_tick = 0;
+};
+
+} // namespace srsepc
+
+#endif // SRSEPC_MME_TIMER_WHEEL_H
@@ -21,6 +21,7 @@
 #ifndef SRSEPC_S1AP_H
 #define SRSEPC_S1AP_H
 
+#include "mme_auth_cache.h"
 #include "mme_gtpc.h"
 #include "nas.h"
 #include "s1ap_ctx_mngmt_proc.h"
@@ -43,6 +44,8 @@
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace srsepc {
 
@@ -94,6 +97,8 @@ public:
   uint32_t         allocate_m_tmsi(uint64_t imsi);
   virtual uint64_t find_imsi_from_m_tmsi(uint32_t m_tmsi);
 
+  hss_interface_nas* get_hss() { return m_hss; }
+
   s1ap_args_t         m_s1ap_args;
   srslte::log_filter* m_s1ap_log;
   srslte::log_filter* m_nas_log;
@@ -103,8 +108,8 @@ public:
   s1ap_ctx_mngmt_proc* m_s1ap_ctx_mngmt_proc;
   s1ap_paging*         m_s1ap_paging;
 
-  std::map<uint32_t, uint64_t>   m_tmsi_to_imsi;
-  std::map<uint16_t, enb_ctx_t*> m_active_enbs;
+  std::unordered_map<uint32_t, uint64_t> m_tmsi_to_imsi;
+  std::map<uint16_t, enb_ctx_t*>         m_active_enbs;
 
   // Interfaces
   virtual bool send_initial_context_setup_request(uint64_t imsi, uint16_t erab_to_setup);
@@ -126,13 +131,14 @@ private:
   uint32_t                  m_plmn;
   srslte::byte_buffer_pool* m_pool;
 
-  hss_interface_nas*                     m_hss;
-  int                                    m_s1mme;
-  std::map<int32_t, uint16_t>            m_sctp_to_enb_id;
-  std::map<int32_t, std::set<uint32_t> > m_enb_assoc_to_ue_ids;
+  mme_auth_cache                                             m_auth_cache;
+  hss_interface_nas*                                         m_hss;
+  int                                                        m_s1mme;
+  std::map<int32_t, uint16_t>                                m_sctp_to_enb_id;
+  std::unordered_map<int32_t, std::unordered_set<uint32_t> > m_enb_assoc_to_ue_ids;
 
-  std::map<uint64_t, nas*> m_imsi_to_nas_ctx;
-  std::map<uint32_t, nas*> m_mme_ue_s1ap_id_to_nas_ctx;
+  std::unordered_map<uint64_t, nas*> m_imsi_to_nas_ctx;
+  std::unordered_map<uint32_t, nas*> m_mme_ue_s1ap_id_to_nas_ctx;
 
   uint32_t m_next_mme_ue_s1ap_id;
   uint32_t m_next_m_tmsi;
@@ -143,6 +149,9 @@ private:
   // PCAP
   bool              m_pcap_enable;
   srslte::s1ap_pcap m_pcap;
+
+  // Storage of the IEs of the PDU being handled
+  asn1::mem_arena m_rx_arena;
 };
 
 inline uint32_t s1ap::get_plmn()
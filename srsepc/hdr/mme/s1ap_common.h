@@ -37,10 +37,11 @@ static const uint8_t MAX_BPLMN = 6;   // Maximum broadcasted PLMNs per TAC
 typedef struct {
   uint8_t                             mme_code;
   uint16_t                            mme_group;
-  uint16_t                            tac;          // 16-bit tac
-  uint16_t                            mcc;          // BCD-coded with 0xF filler
-  uint16_t                            mnc;          // BCD-coded with 0xF filler
-  uint16_t                            paging_timer; // Paging timer in sec (T3413)
+  uint16_t                            tac;               // 16-bit tac
+  uint16_t                            mcc;               // BCD-coded with 0xF filler
+  uint16_t                            mnc;               // BCD-coded with 0xF filler
+  uint16_t                            paging_timer;      // Paging timer in sec (T3413)
+  uint32_t                            auth_vector_batch; // Authentication vectors fetched per HSS query
   std::string                         mme_bind_addr;
   std::string                         mme_name;
   std::string                         dns_addr;
@@ -20,11 +20,13 @@
  */
 #include "srsepc/hdr/hss/hss.h"
 #include "srslte/common/security.h"
+#include <algorithm>
 #include <inttypes.h> // for printing uint64_t
 #include <iomanip>
 #include <sstream>
 #include <stdlib.h> /* srand, rand */
 #include <string>
+#include <sys/stat.h>
 #include <time.h>
 
 namespace srsepc {
@@ -68,29 +70,112 @@ int hss::init(hss_args_t* hss_args, srslte::log_filter* hss_log)
   /*Init loggers*/
   m_hss_log = hss_log;
 
-  /*Read user information from DB*/
-  if (read_db_file(hss_args->db_file) == false) {
-    srslte::console("Error reading user database file %s\n", hss_args->db_file.c_str());
-    return -1;
-  }
-
   mcc = hss_args->mcc;
   mnc = hss_args->mnc;
 
   db_file = hss_args->db_file;
 
+  /*Read user information from DB*/
+  if (load_db(hss_args->db_file, hss_args->db_store) == false) {
+    srslte::console("Error reading user database file %s\n", hss_args->db_file.c_str());
+    return -1;
+  }
+  m_store.set_sync_period_ms(hss_args->db_sync_period_ms);
+
   m_hss_log->info("HSS Initialized. DB file %s, MCC: %d, MNC: %d\n", hss_args->db_file.c_str(), mcc, mnc);
   srslte::console("HSS Initialized.\n");
   return 0;
 }
 
+// Full resolution modification time, so that edits within the same second as the last import are not missed
+static int64_t mtime_ns(const struct stat& st)
+{
+  return (int64_t)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+}
+
 void hss::stop()
 {
-  write_db_file(db_file);
+  // Export to CSV for compatibility and remember it, so that the next start does not import it again
+  struct stat st = {};
+  if (write_db_file(db_file) and stat(db_file.c_str(), &st) == 0) {
+    m_store.set_csv_stamp(mtime_ns(st), st.st_size);
+  }
+  m_store.close();
   return;
 }
 
-bool hss::read_db_file(std::string db_filename)
+bool hss::load_db(const std::string& db_filename, const std::string& store_filename)
+{
+  struct stat csv_st = {};
+  if (stat(db_filename.c_str(), &csv_st) != 0) {
+    return false;
+  }
+
+  // Use the store as is if the CSV did not change since it was last imported or exported
+  if (not store_filename.empty() and m_store.open(store_filename)) {
+    if (m_store.csv_stamp_matches(mtime_ns(csv_st), csv_st.st_size)) {
+      m_hss_log->info("Loaded %" PRIu64 " users from store %s\n", m_store.size(), store_filename.c_str());
+    } else {
+      m_hss_log->info("DB file %s changed, importing it into store %s\n", db_filename.c_str(), store_filename.c_str());
+      m_store.close();
+    }
+  }
+
+  if (not m_store.is_open()) {
+    std::vector<hss_ue_ctx_t> ues;
+    if (not read_db_file(db_filename, &ues)) {
+      return false;
+    }
+
+    // Import into a new store that replaces the old one only once complete
+    hss_store   new_store;
+    std::string tmp_filename = store_filename.empty() ? "" : store_filename + ".tmp";
+    if (not new_store.create(tmp_filename, ues.size())) {
+      m_hss_log->error("Error creating user store %s: %s\n", tmp_filename.c_str(), strerror(errno));
+      return false;
+    }
+    hss_store old_store;
+    if (not store_filename.empty()) {
+      old_store.open(store_filename);
+    }
+    for (const hss_ue_ctx_t& ue : ues) {
+      if (new_store.find(ue.imsi) != nullptr) {
+        m_hss_log->warning("Duplicate user %015" PRIu64 " in DB file, ignoring it\n", ue.imsi);
+        continue;
+      }
+      hss_ue_ctx_t* ue_ctx = new_store.insert(ue.imsi);
+      if (ue_ctx == nullptr) {
+        m_hss_log->error("Error adding user %015" PRIu64 " to store\n", ue.imsi);
+        return false;
+      }
+      *ue_ctx = ue;
+
+      // SQNs in the store may be newer than the CSV ones if the EPC was not stopped cleanly
+      const hss_ue_ctx_t* old_ctx = old_store.find(ue.imsi);
+      if (old_ctx != nullptr and memcmp(old_ctx->sqn, ue_ctx->sqn, 6) > 0) {
+        ue_ctx->set_sqn(old_ctx->sqn);
+      }
+    }
+    old_store.close();
+    new_store.set_csv_stamp(mtime_ns(csv_st), csv_st.st_size);
+    if (not store_filename.empty() and (not new_store.sync() or not new_store.rename(store_filename))) {
+      m_hss_log->error("Error writing user store %s: %s\n", store_filename.c_str(), strerror(errno));
+      return false;
+    }
+    m_store.swap(new_store);
+    m_hss_log->info("Imported %" PRIu64 " users from DB file %s\n", m_store.size(), db_filename.c_str());
+  }
+
+  m_ip_to_imsi.clear();
+  m_store.for_each([this](hss_ue_ctx_t& ue_ctx) {
+    if (strcmp(ue_ctx.static_ip_addr, "0.0.0.0") != 0) {
+      m_ip_to_imsi.insert(std::make_pair(std::string(ue_ctx.static_ip_addr), ue_ctx.imsi));
+    }
+  });
+  return true;
+}
+
+bool hss::read_db_file(std::string db_filename, std::vector<hss_ue_ctx_t>* ues)
 {
   std::ifstream m_db_file;
 
@@ -100,7 +185,8 @@ bool hss::read_db_file(std::string db_filename)
   }
   m_hss_log->info("Opened DB file: %s\n", db_filename.c_str());
 
-  std::string line;
+  std::map<std::string, uint64_t> ip_to_imsi;
+  std::string                     line;
   while (std::getline(m_db_file, line)) {
     if (line[0] != '#' && line.length() > 0) {
       uint                     column_size = 10;
@@ -114,8 +200,8 @@ bool hss::read_db_file(std::string db_filename)
         srslte::console("See 'srsepc/user_db.csv.example' for an example.\n\n");
         return false;
       }
-      std::unique_ptr<hss_ue_ctx_t> ue_ctx = std::unique_ptr<hss_ue_ctx_t>(new hss_ue_ctx_t);
-      ue_ctx->name                         = split[0];
+      std::unique_ptr<hss_ue_ctx_t> ue_ctx = std::unique_ptr<hss_ue_ctx_t>(new hss_ue_ctx_t());
+      strncpy(ue_ctx->name, split[0].c_str(), HSS_UE_NAME_MAX_LEN - 1);
       if (split[1] == std::string("xor")) {
         ue_ctx->algo = HSS_ALGO_XOR;
       } else if (split[1] == std::string("mil")) {
@@ -152,13 +238,13 @@ bool hss::read_db_file(std::string db_filename)
       m_hss_log->debug("Default Bearer QCI: %d\n", ue_ctx->qci);
 
       if (split[9] == std::string("dynamic")) {
-        ue_ctx->static_ip_addr = "0.0.0.0";
+        strcpy(ue_ctx->static_ip_addr, "0.0.0.0");
       } else {
         char buf[128] = {0};
         if (inet_pton(AF_INET, split[9].c_str(), buf)) {
-          if (m_ip_to_imsi.insert(std::make_pair(split[9], ue_ctx->imsi)).second) {
-            ue_ctx->static_ip_addr = split[9];
-            m_hss_log->info("static ip addr %s\n", ue_ctx->static_ip_addr.c_str());
+          if (ip_to_imsi.insert(std::make_pair(split[9], ue_ctx->imsi)).second) {
+            strncpy(ue_ctx->static_ip_addr, split[9].c_str(), INET_ADDRSTRLEN - 1);
+            m_hss_log->info("static ip addr %s\n", ue_ctx->static_ip_addr);
           } else {
             m_hss_log->info("duplicate static ip addr %s\n", split[9].c_str());
             return false;
@@ -168,7 +254,7 @@ bool hss::read_db_file(std::string db_filename)
           return false;
         }
       }
-      m_imsi_to_ue_ctx.insert(std::make_pair(ue_ctx->imsi, std::move(ue_ctx)));
+      ues->push_back(*ue_ctx);
     }
   }
 
@@ -216,37 +302,43 @@ bool hss::write_db_file(std::string db_filename)
             << "#                                                                                           \n"
             << "# Note: Lines starting by '#' are ignored and will be overwritten                           \n";
 
-  std::map<uint64_t, std::unique_ptr<hss_ue_ctx_t> >::iterator it = m_imsi_to_ue_ctx.begin();
-  while (it != m_imsi_to_ue_ctx.end()) {
-    m_db_file << it->second->name;
+  // Export sorted by IMSI
+  std::vector<hss_ue_ctx_t*> ue_ctxs;
+  ue_ctxs.reserve(m_store.size());
+  m_store.for_each([&ue_ctxs](hss_ue_ctx_t& ue_ctx) { ue_ctxs.push_back(&ue_ctx); });
+  std::sort(ue_ctxs.begin(), ue_ctxs.end(), [](const hss_ue_ctx_t* a, const hss_ue_ctx_t* b) {
+    return a->imsi < b->imsi;
+  });
+
+  for (hss_ue_ctx_t* ue_ctx : ue_ctxs) {
+    m_db_file << ue_ctx->name;
     m_db_file << ",";
-    m_db_file << (it->second->algo == HSS_ALGO_XOR ? "xor" : "mil");
+    m_db_file << (ue_ctx->algo == HSS_ALGO_XOR ? "xor" : "mil");
     m_db_file << ",";
-    m_db_file << std::setfill('0') << std::setw(15) << it->second->imsi;
+    m_db_file << std::setfill('0') << std::setw(15) << ue_ctx->imsi;
     m_db_file << ",";
-    m_db_file << hex_string(it->second->key, 16);
+    m_db_file << hex_string(ue_ctx->key, 16);
     m_db_file << ",";
-    if (it->second->op_configured) {
+    if (ue_ctx->op_configured) {
       m_db_file << "op,";
-      m_db_file << hex_string(it->second->op, 16);
+      m_db_file << hex_string(ue_ctx->op, 16);
     } else {
       m_db_file << "opc,";
-      m_db_file << hex_string(it->second->opc, 16);
+      m_db_file << hex_string(ue_ctx->opc, 16);
     }
     m_db_file << ",";
-    m_db_file << hex_string(it->second->amf, 2);
+    m_db_file << hex_string(ue_ctx->amf, 2);
     m_db_file << ",";
-    m_db_file << hex_string(it->second->sqn, 6);
+    m_db_file << hex_string(ue_ctx->sqn, 6);
     m_db_file << ",";
-    m_db_file << it->second->qci;
-    if (it->second->static_ip_addr != "0.0.0.0") {
+    m_db_file << ue_ctx->qci;
+    if (strcmp(ue_ctx->static_ip_addr, "0.0.0.0") != 0) {
       m_db_file << ",";
-      m_db_file << it->second->static_ip_addr;
+      m_db_file << ue_ctx->static_ip_addr;
     } else {
       m_db_file << ",dynamic";
     }
     m_db_file << std::endl;
-    it++;
   }
   if (m_db_file.is_open()) {
     m_db_file.close();
@@ -256,8 +348,20 @@ bool hss::write_db_file(std::string db_filename)
 
 bool hss::gen_auth_info_answer(uint64_t imsi, uint8_t* k_asme, uint8_t* autn, uint8_t* rand, uint8_t* xres)
 {
+  auth_vector_t vector;
+  if (not gen_auth_vectors(imsi, &vector, 1)) {
+    return false;
+  }
+  memcpy(k_asme, vector.k_asme, sizeof(vector.k_asme));
+  memcpy(autn, vector.autn, sizeof(vector.autn));
+  memcpy(rand, vector.rand, sizeof(vector.rand));
+  memcpy(xres, vector.xres, sizeof(vector.xres));
+  return true;
+}
 
-  m_hss_log->debug("Generating AUTH info answer\n");
+bool hss::gen_auth_vectors(uint64_t imsi, auth_vector_t* vectors, uint32_t nof_vectors)
+{
+  m_hss_log->debug("Generating %d authentication vectors\n", nof_vectors);
   hss_ue_ctx_t* ue_ctx = get_ue_ctx(imsi);
   if (ue_ctx == nullptr) {
     srslte::console("User not found at HSS. IMSI: %015" PRIu64 "\n", imsi);
@@ -267,21 +371,21 @@ bool hss::gen_auth_info_answer(uint64_t imsi, uint8_t* k_asme, uint8_t* autn, ui
 
   switch (ue_ctx->algo) {
     case HSS_ALGO_XOR:
-      gen_auth_info_answer_xor(ue_ctx, k_asme, autn, rand, xres);
+      for (uint32_t i = 0; i < nof_vectors; i++) {
+        auth_vector_t* v = &vectors[i];
+        gen_auth_info_answer_xor(ue_ctx, v->k_asme, v->autn, v->rand, v->xres);
+        increment_ue_sqn(ue_ctx);
+      }
       break;
     case HSS_ALGO_MILENAGE:
-      gen_auth_info_answer_milenage(ue_ctx, k_asme, autn, rand, xres);
+      gen_auth_vectors_milenage(ue_ctx, vectors, nof_vectors);
       break;
   }
-  increment_ue_sqn(ue_ctx);
+  m_store.written(ue_ctx);
   return true;
 }
 
-void hss::gen_auth_info_answer_milenage(hss_ue_ctx_t* ue_ctx,
-                                        uint8_t*      k_asme,
-                                        uint8_t*      autn,
-                                        uint8_t*      rand,
-                                        uint8_t*      xres)
+void hss::gen_auth_vectors_milenage(hss_ue_ctx_t* ue_ctx, auth_vector_t* vectors, uint32_t nof_vectors)
 {
   // Get K, AMF, OPC and SQN
   uint8_t* k   = ue_ctx->key;
@@ -289,50 +393,65 @@ void hss::gen_auth_info_answer_milenage(hss_ue_ctx_t* ue_ctx,
   uint8_t* opc = ue_ctx->opc;
   uint8_t* sqn = ue_ctx->sqn;
 
-  // Temp variables
-  uint8_t ck[16];
-  uint8_t ik[16];
-  uint8_t ak[6];
-  uint8_t mac[8];
-
-  gen_rand(rand);
-
-  srslte::security_milenage_f2345(k, opc, rand, xres, ck, ik, ak);
+  // The key schedule is expanded once and shared by all the vectors, which consume consecutive SQNs
+  srslte::milenage_ctx_t    ctx;
+  srslte::milenage_vector_t mv[HSS_MILENAGE_BATCH];
+  srslte::security_milenage_init(&ctx, k, opc);
 
   m_hss_log->debug_hex(k, 16, "User Key : ");
   m_hss_log->debug_hex(opc, 16, "User OPc : ");
-  m_hss_log->debug_hex(rand, 16, "User Rand : ");
-  m_hss_log->debug_hex(xres, 8, "User XRES: ");
-  m_hss_log->debug_hex(ck, 16, "User CK: ");
-  m_hss_log->debug_hex(ik, 16, "User IK: ");
-  m_hss_log->debug_hex(ak, 6, "User AK: ");
 
-  srslte::security_milenage_f1(k, opc, rand, sqn, amf, mac);
+  for (uint32_t first = 0; first < nof_vectors; first += HSS_MILENAGE_BATCH) {
+    uint32_t nof = std::min(nof_vectors - first, (uint32_t)HSS_MILENAGE_BATCH);
+    for (uint32_t i = 0; i < nof; i++) {
+      mv[i].ctx = &ctx;
+      gen_rand(mv[i].rand);
+      memcpy(mv[i].sqn, sqn, sizeof(mv[i].sqn));
+      memcpy(mv[i].amf, amf, sizeof(mv[i].amf));
+      increment_ue_sqn(ue_ctx);
+    }
 
-  m_hss_log->debug_hex(sqn, 6, "User SQN : ");
-  m_hss_log->debug_hex(mac, 8, "User MAC : ");
+    srslte::security_milenage_f12345_batch(mv, nof);
 
-  // Generate K_asme
-  srslte::security_generate_k_asme(ck, ik, ak, sqn, mcc, mnc, k_asme);
+    for (uint32_t i = 0; i < nof; i++) {
+      auth_vector_t* v = &vectors[first + i];
 
-  m_hss_log->debug("User MCC : %x  MNC : %x \n", mcc, mnc);
-  m_hss_log->debug_hex(k_asme, 32, "User k_asme : ");
+      m_hss_log->debug_hex(mv[i].rand, 16, "User Rand : ");
+      m_hss_log->debug_hex(mv[i].res, 8, "User XRES: ");
+      m_hss_log->debug_hex(mv[i].ck, 16, "User CK: ");
+      m_hss_log->debug_hex(mv[i].ik, 16, "User IK: ");
+      m_hss_log->debug_hex(mv[i].ak, 6, "User AK: ");
+      m_hss_log->debug_hex(mv[i].sqn, 6, "User SQN : ");
+      m_hss_log->debug_hex(mv[i].mac_a, 8, "User MAC : ");
 
-  // Generate AUTN (autn = sqn ^ ak |+| amf |+| mac)
-  for (int i = 0; i < 6; i++) {
-    autn[i] = sqn[i] ^ ak[i];
-  }
-  for (int i = 0; i < 2; i++) {
-    autn[6 + i] = amf[i];
-  }
-  for (int i = 0; i < 8; i++) {
-    autn[8 + i] = mac[i];
+      // Generate K_asme
+      srslte::security_generate_k_asme(mv[i].ck, mv[i].ik, mv[i].ak, mv[i].sqn, mcc, mnc, v->k_asme);
+
+      m_hss_log->debug("User MCC : %x  MNC : %x \n", mcc, mnc);
+      m_hss_log->debug_hex(v->k_asme, 32, "User k_asme : ");
+
+      // Generate AUTN (autn = sqn ^ ak |+| amf |+| mac)
+      for (int j = 0; j < 6; j++) {
+        v->autn[j] = mv[i].sqn[j] ^ mv[i].ak[j];
+      }
+      for (int j = 0; j < 2; j++) {
+        v->autn[6 + j] = amf[j];
+      }
+      for (int j = 0; j < 8; j++) {
+        v->autn[8 + j] = mv[i].mac_a[j];
+      }
+      m_hss_log->debug_hex(v->autn, 16, "User AUTN: ");
+
+      memcpy(v->rand, mv[i].rand, sizeof(v->rand));
+      memcpy(v->xres, mv[i].res, sizeof(mv[i].res));
+      memset(&v->xres[sizeof(mv[i].res)], 0, sizeof(v->xres) - sizeof(mv[i].res));
+    }
   }
-  m_hss_log->debug_hex(autn, 16, "User AUTN: ");
 
   // Set last RAND
-  ue_ctx->set_last_rand(rand);
-  return;
+  if (nof_vectors > 0) {
+    ue_ctx->set_last_rand(vectors[nof_vectors - 1].rand);
+  }
 }
 
 void hss::gen_auth_info_answer_xor(hss_ue_ctx_t* ue_ctx, uint8_t* k_asme, uint8_t* autn, uint8_t* rand, uint8_t* xres)
@@ -432,19 +551,18 @@ void hss::gen_auth_info_answer_xor(hss_ue_ctx_t* ue_ctx, uint8_t* k_asme, uint8_
 
 bool hss::gen_update_loc_answer(uint64_t imsi, uint8_t* qci)
 {
-  std::map<uint64_t, std::unique_ptr<hss_ue_ctx_t> >::iterator ue_ctx_it = m_imsi_to_ue_ctx.find(imsi);
-  if (ue_ctx_it == m_imsi_to_ue_ctx.end()) {
+  hss_ue_ctx_t* ue_ctx = m_store.find(imsi);
+  if (ue_ctx == nullptr) {
     m_hss_log->info("User not found. IMSI: %015" PRIu64 "\n", imsi);
     srslte::console("User not found at HSS. IMSI: %015" PRIu64 "\n", imsi);
     return false;
   }
-  const std::unique_ptr<hss_ue_ctx_t>& ue_ctx = ue_ctx_it->second;
   m_hss_log->info("Found User %015" PRIu64 "\n", imsi);
   *qci = ue_ctx->qci;
   return true;
 }
 
-bool hss::resync_sqn(uint64_t imsi, uint8_t* auts)
+bool hss::resync_sqn(uint64_t imsi, uint8_t* rand, uint8_t* auts)
 {
   m_hss_log->debug("Re-syncing SQN\n");
   hss_ue_ctx_t* ue_ctx = get_ue_ctx(imsi);
@@ -459,11 +577,12 @@ bool hss::resync_sqn(uint64_t imsi, uint8_t* auts)
       resync_sqn_xor(ue_ctx, auts);
       break;
     case HSS_ALGO_MILENAGE:
-      resync_sqn_milenage(ue_ctx, auts);
+      resync_sqn_milenage(ue_ctx, rand, auts);
       break;
   }
 
   increment_seq_after_resync(ue_ctx);
+  m_store.written(ue_ctx);
   return true;
 }
 
@@ -474,7 +593,7 @@ void hss::resync_sqn_xor(hss_ue_ctx_t* ue_ctx, uint8_t* auts)
   return;
 }
 
-void hss::resync_sqn_milenage(hss_ue_ctx_t* ue_ctx, uint8_t* auts)
+void hss::resync_sqn_milenage(hss_ue_ctx_t* ue_ctx, uint8_t* rand, uint8_t* auts)
 {
   // Get K, AMF, OPC and SQN
   uint8_t* k   = ue_ctx->key;
@@ -483,13 +602,10 @@ void hss::resync_sqn_milenage(hss_ue_ctx_t* ue_ctx, uint8_t* auts)
   uint8_t* sqn = ue_ctx->sqn;
 
   // Temp variables
-  uint8_t last_rand[16];
   uint8_t ak[6];
   uint8_t mac_s[8];
   uint8_t sqn_ms_xor_ak[6];
 
-  ue_ctx->get_last_rand(last_rand);
-
   for (int i = 0; i < 6; i++) {
     sqn_ms_xor_ak[i] = auts[i];
   }
@@ -501,12 +617,12 @@ void hss::resync_sqn_milenage(hss_ue_ctx_t* ue_ctx, uint8_t* auts)
   m_hss_log->debug_hex(k, 16, "User Key : ");
   m_hss_log->debug_hex(opc, 16, "User OPc : ");
   m_hss_log->debug_hex(amf, 2, "User AMF : ");
-  m_hss_log->debug_hex(last_rand, 16, "User Last Rand : ");
+  m_hss_log->debug_hex(rand, 16, "User Rand : ");
   m_hss_log->debug_hex(auts, 16, "AUTS : ");
   m_hss_log->debug_hex(sqn_ms_xor_ak, 6, "SQN xor AK : ");
   m_hss_log->debug_hex(mac_s, 8, "MAC : ");
 
-  srslte::security_milenage_f5_star(k, opc, last_rand, ak);
+  srslte::security_milenage_f5_star(k, opc, rand, ak);
   m_hss_log->debug_hex(ak, 6, "Resynch AK : ");
 
   uint8_t sqn_ms[6];
@@ -520,7 +636,7 @@ void hss::resync_sqn_milenage(hss_ue_ctx_t* ue_ctx, uint8_t* auts)
 
   uint8_t dummy_amf[2] = {};
 
-  srslte::security_milenage_f1_star(k, opc, last_rand, sqn_ms, dummy_amf, mac_s_tmp);
+  srslte::security_milenage_f1_star(k, opc, rand, sqn_ms, dummy_amf, mac_s_tmp);
   m_hss_log->debug_hex(mac_s_tmp, 8, "MAC calc : ");
 
   ue_ctx->set_sqn(sqn_ms);
@@ -604,13 +720,13 @@ void hss::gen_rand(uint8_t rand_[16])
 
 hss_ue_ctx_t* hss::get_ue_ctx(uint64_t imsi)
 {
-  std::map<uint64_t, std::unique_ptr<hss_ue_ctx_t> >::iterator ue_ctx_it = m_imsi_to_ue_ctx.find(imsi);
-  if (ue_ctx_it == m_imsi_to_ue_ctx.end()) {
+  hss_ue_ctx_t* ue_ctx = m_store.find(imsi);
+  if (ue_ctx == nullptr) {
     m_hss_log->info("User not found. IMSI: %015" PRIu64 "\n", imsi);
     return nullptr;
   }
 
-  return ue_ctx_it->second.get();
+  return ue_ctx;
 }
 
 /* Helper functions*/
@@ -0,0 +1,291 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsepc/hdr/hss/hss_store.h"
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace srsepc {
+
+static const char     store_magic[8] = {'S', 'R', 'S', 'H', 'S', 'S', '\0', '\0'};
+static const uint32_t store_version  = 1;
+
+hss_store::~hss_store()
+{
+  close();
+}
+
+bool hss_store::create(const std::string& path_, uint64_t nof_ues)
+{
+  close();
+
+  // Keep the load factor at 1/2 at most, so that probe sequences stay short
+  uint64_t cap = 16;
+  while (cap < 2 * nof_ues) {
+    cap <<= 1u;
+  }
+  size_t len = sizeof(header_t) + cap * sizeof(hss_ue_ctx_t);
+
+  // ftruncate and anonymous mappings zero-fill, so all slots start empty
+  int fd_ = -1;
+  if (not path_.empty()) {
+    fd_ = ::open(path_.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fd_ < 0) {
+      return false;
+    }
+    if (ftruncate(fd_, len) != 0) {
+      ::close(fd_);
+      return false;
+    }
+  }
+  if (not map(fd_, len)) {
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+    return false;
+  }
+  path = path_;
+
+  memcpy(header->magic, store_magic, sizeof(store_magic));
+  header->version     = store_version;
+  header->record_size = sizeof(hss_ue_ctx_t);
+  header->capacity    = cap;
+  header->nof_ues     = 0;
+  set_csv_stamp(-1, -1);
+  return true;
+}
+
+bool hss_store::open(const std::string& path_)
+{
+  close();
+
+  int fd_ = ::open(path_.c_str(), O_RDWR);
+  if (fd_ < 0) {
+    return false;
+  }
+
+  // Validate the header before mapping the file
+  struct stat st  = {};
+  header_t    hdr = {};
+  if (fstat(fd_, &st) != 0 or pread(fd_, &hdr, sizeof(hdr), 0) != (ssize_t)sizeof(hdr) or
+      memcmp(hdr.magic, store_magic, sizeof(store_magic)) != 0 or hdr.version != store_version or
+      hdr.record_size != sizeof(hss_ue_ctx_t) or hdr.capacity == 0 or (hdr.capacity & (hdr.capacity - 1)) != 0 or
+      (uint64_t)st.st_size != sizeof(header_t) + hdr.capacity * sizeof(hss_ue_ctx_t)) {
+    ::close(fd_);
+    errno = EINVAL;
+    return false;
+  }
+
+  if (not map(fd_, st.st_size)) {
+    ::close(fd_);
+    return false;
+  }
+  path = path_;
+  return true;
+}
+
+bool hss_store::map(int fd_, size_t len)
+{
+  int   flags = fd_ < 0 ? MAP_PRIVATE | MAP_ANONYMOUS : MAP_SHARED;
+  void* ptr   = mmap(nullptr, len, PROT_READ | PROT_WRITE, flags, fd_, 0);
+  if (ptr == MAP_FAILED) {
+    return false;
+  }
+  fd        = fd_;
+  base      = (uint8_t*)ptr;
+  map_len   = len;
+  header    = (header_t*)base;
+  records   = (hss_ue_ctx_t*)(base + sizeof(header_t));
+  last_sync = clock::now();
+  page_size = sysconf(_SC_PAGESIZE);
+  page_dirty.assign((len + page_size - 1) / page_size, false);
+  dirty_pages.clear();
+  return true;
+}
+
+void hss_store::close()
+{
+  if (base != nullptr) {
+    sync();
+    munmap(base, map_len);
+  }
+  if (fd >= 0) {
+    ::close(fd);
+  }
+  fd      = -1;
+  base    = nullptr;
+  map_len = 0;
+  header  = nullptr;
+  records = nullptr;
+  path.clear();
+  page_dirty.clear();
+  dirty_pages.clear();
+}
+
+uint64_t hss_store::slot_of(uint64_t imsi) const
+{
+  // splitmix64 finalizer, consecutive IMSIs are spread over the whole table
+  imsi ^= imsi >> 30u;
+  imsi *= 0xbf58476d1ce4e5b9ULL;
+  imsi ^= imsi >> 27u;
+  imsi *= 0x94d049bb133111ebULL;
+  imsi ^= imsi >> 31u;
+  return imsi & (header->capacity - 1);
+}
+
+hss_ue_ctx_t* hss_store::find(uint64_t imsi)
+{
+  if (records == nullptr or imsi == 0) {
+    return nullptr;
+  }
+  uint64_t mask = header->capacity - 1;
+  uint64_t i    = slot_of(imsi);
+  for (uint64_t n = 0; n < header->capacity; n++, i = (i + 1) & mask) {
+    if (records[i].imsi == imsi) {
+      return &records[i];
+    }
+    if (records[i].imsi == 0) {
+      return nullptr;
+    }
+  }
+  return nullptr;
+}
+
+hss_ue_ctx_t* hss_store::insert(uint64_t imsi)
+{
+  if (records == nullptr or imsi == 0) {
+    return nullptr;
+  }
+  uint64_t mask = header->capacity - 1;
+  uint64_t i    = slot_of(imsi);
+  for (uint64_t n = 0; n < header->capacity; n++, i = (i + 1) & mask) {
+    if (records[i].imsi == imsi) {
+      return &records[i];
+    }
+    if (records[i].imsi == 0) {
+      records[i].imsi = imsi;
+      header->nof_ues++;
+      return &records[i];
+    }
+  }
+  return nullptr;
+}
+
+bool hss_store::rename(const std::string& new_path)
+{
+  if (fd < 0 or ::rename(path.c_str(), new_path.c_str()) != 0) {
+    return false;
+  }
+  path = new_path;
+  return true;
+}
+
+void hss_store::swap(hss_store& other)
+{
+  std::swap(path, other.path);
+  std::swap(fd, other.fd);
+  std::swap(base, other.base);
+  std::swap(map_len, other.map_len);
+  std::swap(header, other.header);
+  std::swap(records, other.records);
+  std::swap(sync_period_ms, other.sync_period_ms);
+  std::swap(last_sync, other.last_sync);
+  std::swap(page_size, other.page_size);
+  std::swap(page_dirty, other.page_dirty);
+  std::swap(dirty_pages, other.dirty_pages);
+}
+
+void hss_store::written(const hss_ue_ctx_t* ue_ctx)
+{
+  if (fd < 0 or ue_ctx == nullptr) {
+    return;
+  }
+
+  // Remember the pages holding the record, a record may straddle two of them
+  size_t begin = (const uint8_t*)ue_ctx - base;
+  for (size_t page = begin / page_size; page <= (begin + sizeof(hss_ue_ctx_t) - 1) / page_size; page++) {
+    if (not page_dirty[page]) {
+      page_dirty[page] = true;
+      dirty_pages.push_back(page);
+    }
+  }
+  if (sync_period_ms == 0 or clock::now() - last_sync >= std::chrono::milliseconds(sync_period_ms)) {
+    sync_dirty_pages();
+  }
+}
+
+bool hss_store::sync_dirty_pages()
+{
+  // Only the pages updated since the last flush are written, not the whole store
+  bool ret = true;
+  for (size_t page : dirty_pages) {
+    size_t offset = page * page_size;
+    ret &= msync(base + offset, std::min(page_size, map_len - offset), MS_SYNC) == 0;
+    page_dirty[page] = false;
+  }
+  dirty_pages.clear();
+  last_sync = clock::now();
+  return ret;
+}
+
+bool hss_store::sync()
+{
+  if (fd < 0 or base == nullptr) {
+    return true;
+  }
+  for (size_t page : dirty_pages) {
+    page_dirty[page] = false;
+  }
+  dirty_pages.clear();
+  last_sync = clock::now();
+  return msync(base, map_len, MS_SYNC) == 0;
+}
+
+void hss_store::set_csv_stamp(int64_t mtime_ns, int64_t size)
+{
+  if (header != nullptr) {
+    header->csv_mtime = mtime_ns;
+    header->csv_size  = size;
+  }
+}
+
+bool hss_store::csv_stamp_matches(int64_t mtime_ns, int64_t size) const
+{
+  return header != nullptr and header->csv_mtime == mtime_ns and header->csv_size == size;
+}
+
+uint64_t hss_store::size() const
+{
+  return header != nullptr ? header->nof_ues : 0;
+}
+
+uint64_t hss_store::capacity() const
+{
+  return header != nullptr ? header->capacity : 0;
+}
+
+} // namespace srsepc
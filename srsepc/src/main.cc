@@ -29,6 +29,7 @@
 #include "srslte/common/crash_handler.h"
 #include "srslte/common/logger_srslog_wrapper.h"
 #include "srslte/common/signal_handler.h"
+#include "srslte/common/thread_topology.h"
 #include "srslte/srslog/srslog.h"
 #include <boost/program_options.hpp>
 #include <iostream>
@@ -63,6 +64,8 @@ typedef struct {
   hss_args_t  hss_args;
   spgw_args_t spgw_args;
   log_args_t  log_args;
+
+  srslte::thread_topology_args_t threads;
 } all_args_t;
 
 /**********************************************************************
@@ -82,13 +85,16 @@ void parse_args(all_args_t* args, int argc, char* argv[])
   string   mme_apn;
   string   encryption_algo;
   string   integrity_algo;
-  uint16_t paging_timer     = 0;
-  uint32_t max_paging_queue = 0;
+  uint16_t paging_timer      = 0;
+  uint32_t max_paging_queue  = 0;
+  uint32_t auth_vector_batch = 0;
   string   spgw_bind_addr;
   string   sgi_if_addr;
   string   sgi_if_name;
   string   dns_addr;
   string   hss_db_file;
+  string   hss_db_store;
+  uint32_t hss_db_sync_period;
   string   hss_auth_algo;
   string   log_filename;
 
@@ -115,7 +121,10 @@ void parse_args(all_args_t* args, int argc, char* argv[])
     ("mme.encryption_algo", bpo::value<string>(&encryption_algo)->default_value("EEA0"),     "Set preferred encryption algorithm for NAS layer ")
     ("mme.integrity_algo",  bpo::value<string>(&integrity_algo)->default_value("EIA1"),      "Set preferred integrity protection algorithm for NAS")
     ("mme.paging_timer",    bpo::value<uint16_t>(&paging_timer)->default_value(2),           "Set paging timer value in seconds (T3413)")
+    ("mme.auth_vector_batch", bpo::value<uint32_t>(&auth_vector_batch)->default_value(1),  "Authentication vectors fetched from the HSS per query and cached per UE")
     ("hss.db_file",         bpo::value<string>(&hss_db_file)->default_value("ue_db.csv"),    ".csv file that stores UE's keys")
+    ("hss.db_store",        bpo::value<string>(&hss_db_store)->default_value(""),            "Binary store of the UE's keys and SQNs, imported from db_file when it changes")
+    ("hss.db_sync_period",  bpo::value<uint32_t>(&hss_db_sync_period)->default_value(1000),  "Maximum time between flushes of SQN updates in db_store to disk, in ms")
     ("spgw.gtpu_bind_addr", bpo::value<string>(&spgw_bind_addr)->default_value("127.0.0.1"), "IP address of SP-GW for the S1-U connection")
     ("spgw.sgi_if_addr",    bpo::value<string>(&sgi_if_addr)->default_value("176.16.0.1"),   "IP address of TUN interface for the SGi connection")
     ("spgw.sgi_if_name",    bpo::value<string>(&sgi_if_name)->default_value("srs_spgw_sgi"), "Name of TUN interface for the SGi connection")
@@ -145,6 +154,20 @@ void parse_args(all_args_t* args, int argc, char* argv[])
     ("log.filename", bpo::value<string>(&args->log_args.filename)->default_value("/tmp/epc.log"),"Log filename")
     ;
 
+  // Thread topology options, one set per thread class
+  common.add_options()
+    ("threads.numa",   bpo::value<bool>(&args->threads.numa)->default_value(false),   "Prefer memory from the NUMA node of the CPUs of each thread class")
+    ("threads.report", bpo::value<bool>(&args->threads.report)->default_value(false), "Print the thread layout at startup even if no class is configured")
+    ;
+  for (const string& cls : srslte::thread_topology::class_names()) {
+    srslte::thread_class_args_t& c = args->threads.classes[cls];
+    common.add_options()
+      (("threads." + cls + ".cpus").c_str(),   bpo::value<string>(&c.cpus)->default_value(""),   "CPU list of the thread class, e.g. 2-5,8")
+      (("threads." + cls + ".policy").c_str(), bpo::value<string>(&c.policy)->default_value(""), "Scheduling policy of the thread class: fifo, rr or other")
+      (("threads." + cls + ".prio").c_str(),   bpo::value<int>(&c.prio)->default_value(-1),      "Scheduling priority of the thread class for fifo and rr")
+      ;
+  }
+
   // Positional options - config file location
   bpo::options_description position("Positional options");
   position.add_options()
@@ -267,16 +290,19 @@ void parse_args(all_args_t* args, int argc, char* argv[])
     cout << "Using default mme.integrity_algo: EIA1" << endl;
   }
 
-  args->mme_args.s1ap_args.mme_bind_addr = mme_bind_addr;
-  args->mme_args.s1ap_args.mme_name      = mme_name;
-  args->mme_args.s1ap_args.dns_addr      = dns_addr;
-  args->mme_args.s1ap_args.mme_apn       = mme_apn;
-  args->mme_args.s1ap_args.paging_timer  = paging_timer;
-  args->spgw_args.gtpu_bind_addr         = spgw_bind_addr;
-  args->spgw_args.sgi_if_addr            = sgi_if_addr;
-  args->spgw_args.sgi_if_name            = sgi_if_name;
-  args->spgw_args.max_paging_queue       = max_paging_queue;
-  args->hss_args.db_file                 = hss_db_file;
+  args->mme_args.s1ap_args.mme_bind_addr     = mme_bind_addr;
+  args->mme_args.s1ap_args.mme_name          = mme_name;
+  args->mme_args.s1ap_args.dns_addr          = dns_addr;
+  args->mme_args.s1ap_args.mme_apn           = mme_apn;
+  args->mme_args.s1ap_args.paging_timer      = paging_timer;
+  args->mme_args.s1ap_args.auth_vector_batch = auth_vector_batch;
+  args->spgw_args.gtpu_bind_addr             = spgw_bind_addr;
+  args->spgw_args.sgi_if_addr                = sgi_if_addr;
+  args->spgw_args.sgi_if_name                = sgi_if_name;
+  args->spgw_args.max_paging_queue           = max_paging_queue;
+  args->hss_args.db_file                     = hss_db_file;
+  args->hss_args.db_store                    = hss_db_store;
+  args->hss_args.db_sync_period_ms           = hss_db_sync_period;
 
   // Apply all_level to any unset layers
   if (vm.count("log.all_level")) {
@@ -403,6 +429,11 @@ int main(int argc, char* argv[])
   // Start the log backend.
   srslog::init();
 
+  // Place the threads started from now on, and the log backend which already runs
+  if (not srslte::thread_topology::get().configure(args.threads)) {
+    return SRSLTE_ERROR;
+  }
+
   if (args.log_args.filename != "stdout") {
     log_wrapper.log_char("\n\n");
     log_wrapper.log_char(get_build_string().c_str());
@@ -466,6 +497,11 @@ int main(int argc, char* argv[])
 
   mme->start();
   spgw->start();
+
+  if (args.threads.report or srslte::thread_topology::get().active()) {
+    srslte::thread_topology::get().print_report(stdout);
+  }
+
   while (running) {
     sleep(1);
   }
@@ -23,6 +23,7 @@
 #include <arpa/inet.h>
 #include <inttypes.h> // for printing uint64_t
 #include <netinet/sctp.h>
+#include <sys/epoll.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 
@@ -31,7 +32,9 @@ namespace srsepc {
 mme*            mme::m_instance    = NULL;
 pthread_mutex_t mme_instance_mutex = PTHREAD_MUTEX_INITIALIZER;
 
-mme::mme() : m_running(false), thread("MME")
+#define MME_MAX_EPOLL_EVENTS 16
+
+mme::mme() : m_running(false), m_epoll_fd(-1), thread("MME")
 {
   m_pool = srslte::byte_buffer_pool::get_instance();
   return;
@@ -100,6 +103,10 @@ void mme::stop()
     m_running = false;
     thread_cancel();
     wait_thread_finish();
+    if (m_epoll_fd != -1) {
+      close(m_epoll_fd);
+      m_epoll_fd = -1;
+    }
   }
   return;
 }
@@ -109,135 +116,126 @@ void mme::run_thread()
   srslte::byte_buffer_t* pdu = m_pool->allocate("mme::run_thread");
   uint32_t               sz  = SRSLTE_MAX_BUFFER_SIZE_BYTES - SRSLTE_BUFFER_HEADER_OFFSET;
 
-  struct sockaddr_in     enb_addr;
-  struct sctp_sndrcvinfo sri;
-  socklen_t              fromlen = sizeof(enb_addr);
-  bzero(&enb_addr, sizeof(enb_addr));
-  int rd_sz;
-  int msg_flags = 0;
-
-  // Mark the thread as running
-  m_running = true;
-
   // Get S1-MME and S11 sockets
   int s1mme = m_s1ap->get_s1_mme();
   int s11   = m_mme_gtpc->get_s11();
 
-  while (m_running) {
-    pdu->clear();
-    int max_fd = std::max(s1mme, s11);
-
-    FD_ZERO(&m_set);
-    FD_SET(s1mme, &m_set);
-    FD_SET(s11, &m_set);
-
-    // Add timers to select
-    for (std::vector<mme_timer_t>::iterator it = timers.begin(); it != timers.end(); ++it) {
-      FD_SET(it->fd, &m_set);
-      max_fd = std::max(max_fd, it->fd);
-      m_s1ap_log->debug("Adding Timer fd %d to fd_set\n", it->fd);
+  // Register them in the event loop. NAS timers live in the timing wheel, which sets the epoll timeout
+  m_epoll_fd = epoll_create1(0);
+  if (m_epoll_fd == -1) {
+    m_s1ap_log->error("Error creating epoll instance: %s\n", strerror(errno));
+    m_pool->deallocate(pdu);
+    return;
+  }
+  int fds[] = {s1mme, s11};
+  for (int fd : fds) {
+    struct epoll_event ev = {};
+    ev.events             = EPOLLIN;
+    ev.data.fd            = fd;
+    if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+      m_s1ap_log->error("Error adding fd %d to epoll: %s\n", fd, strerror(errno));
     }
+  }
+  m_timers.reset(mme_timer_wheel::clock::now());
+
+  // Mark the thread as running
+  m_running = true;
 
+  struct epoll_event       events[MME_MAX_EPOLL_EVENTS];
+  std::vector<mme_timer_t> expired;
+  while (m_running) {
     m_s1ap_log->debug("Waiting for S1-MME or S11 Message\n");
-    int n = select(max_fd + 1, &m_set, NULL, NULL, NULL);
+    int timeout_ms = m_timers.time_to_next_tick_ms(mme_timer_wheel::clock::now());
+    int n          = epoll_wait(m_epoll_fd, events, MME_MAX_EPOLL_EVENTS, timeout_ms);
     if (n == -1) {
-      m_s1ap_log->error("Error from select\n");
-    } else if (n) {
-      // Handle S1-MME
-      if (FD_ISSET(s1mme, &m_set)) {
-        rd_sz = sctp_recvmsg(s1mme, pdu->msg, sz, (struct sockaddr*)&enb_addr, &fromlen, &sri, &msg_flags);
-        if (rd_sz == -1 && errno != EAGAIN) {
-          m_s1ap_log->error("Error reading from SCTP socket: %s", strerror(errno));
-        } else if (rd_sz == -1 && errno == EAGAIN) {
-          m_s1ap_log->debug("Socket timeout reached");
-        } else {
-          if (msg_flags & MSG_NOTIFICATION) {
-            // Received notification
-            union sctp_notification* notification = (union sctp_notification*)pdu->msg;
-            m_s1ap_log->debug("SCTP Notification %d\n", notification->sn_header.sn_type);
-            if (notification->sn_header.sn_type == SCTP_SHUTDOWN_EVENT) {
-              m_s1ap_log->info("SCTP Association Shutdown. Association: %d\n", sri.sinfo_assoc_id);
-              srslte::console("SCTP Association Shutdown. Association: %d\n", sri.sinfo_assoc_id);
-              m_s1ap->delete_enb_ctx(sri.sinfo_assoc_id);
-            }
-          } else {
-            // Received data
-            pdu->N_bytes = rd_sz;
-            m_s1ap_log->info("Received S1AP msg. Size: %d\n", pdu->N_bytes);
-            m_s1ap->handle_s1ap_rx_pdu(pdu, &sri);
-          }
-        }
+      if (errno != EINTR) {
+        m_s1ap_log->error("Error from epoll_wait: %s\n", strerror(errno));
       }
-      // Handle S11
-      if (FD_ISSET(s11, &m_set)) {
+      continue;
+    }
+
+    for (int i = 0; i < n; i++) {
+      pdu->clear();
+      if (events[i].data.fd == s1mme) {
+        // Handle S1-MME
+        handle_s1mme_rx(pdu);
+      } else if (events[i].data.fd == s11) {
+        // Handle S11
         pdu->N_bytes = recvfrom(s11, pdu->msg, sz, 0, NULL, NULL);
         m_mme_gtpc->handle_s11_pdu(pdu);
       }
-      // Handle NAS Timers
-      for (std::vector<mme_timer_t>::iterator it = timers.begin(); it != timers.end();) {
-        if (FD_ISSET(it->fd, &m_set)) {
-          m_s1ap_log->info("Timer expired\n");
-          uint64_t exp;
-          rd_sz = read(it->fd, &exp, sizeof(uint64_t));
-          m_s1ap->expire_nas_timer(it->type, it->imsi);
-          close(it->fd);
-          timers.erase(it);
-        } else {
-          ++it;
-        }
+    }
+
+    // Handle NAS Timers
+    expired.clear();
+    m_timers.advance(mme_timer_wheel::clock::now(), &expired);
+    for (const mme_timer_t& t : expired) {
+      m_s1ap_log->info("Timer expired. IMSI %" PRIu64 ", Type %d\n", t.imsi, t.type);
+      m_s1ap->expire_nas_timer(t.type, t.imsi);
+    }
+  }
+  m_pool->deallocate(pdu);
+  return;
+}
+
+void mme::handle_s1mme_rx(srslte::byte_buffer_t* pdu)
+{
+  uint32_t               sz = SRSLTE_MAX_BUFFER_SIZE_BYTES - SRSLTE_BUFFER_HEADER_OFFSET;
+  struct sockaddr_in     enb_addr;
+  struct sctp_sndrcvinfo sri;
+  socklen_t              fromlen   = sizeof(enb_addr);
+  int                    msg_flags = 0;
+  bzero(&enb_addr, sizeof(enb_addr));
+
+  int rd_sz = sctp_recvmsg(m_s1ap->get_s1_mme(), pdu->msg, sz, (struct sockaddr*)&enb_addr, &fromlen, &sri, &msg_flags);
+  if (rd_sz == -1 && errno != EAGAIN) {
+    m_s1ap_log->error("Error reading from SCTP socket: %s", strerror(errno));
+  } else if (rd_sz == -1 && errno == EAGAIN) {
+    m_s1ap_log->debug("Socket timeout reached");
+  } else {
+    if (msg_flags & MSG_NOTIFICATION) {
+      // Received notification
+      union sctp_notification* notification = (union sctp_notification*)pdu->msg;
+      m_s1ap_log->debug("SCTP Notification %d\n", notification->sn_header.sn_type);
+      if (notification->sn_header.sn_type == SCTP_SHUTDOWN_EVENT) {
+        m_s1ap_log->info("SCTP Association Shutdown. Association: %d\n", sri.sinfo_assoc_id);
+        srslte::console("SCTP Association Shutdown. Association: %d\n", sri.sinfo_assoc_id);
+        m_s1ap->delete_enb_ctx(sri.sinfo_assoc_id);
       }
     } else {
-      m_s1ap_log->debug("No data from select.\n");
+      // Received data
+      pdu->N_bytes = rd_sz;
+      m_s1ap_log->info("Received S1AP msg. Size: %d\n", pdu->N_bytes);
+      m_s1ap->handle_s1ap_rx_pdu(pdu, &sri);
     }
   }
-  return;
 }
 
 /*
  * Timer Handling
  */
-bool mme::add_nas_timer(int timer_fd, nas_timer_type type, uint64_t imsi)
+bool mme::add_nas_timer(enum nas_timer_type type, uint64_t imsi, uint32_t timeout_ms)
 {
-  m_s1ap_log->debug("Adding NAS timer to MME. IMSI %" PRIu64 ", Type %d, Fd: %d\n", imsi, type, timer_fd);
-
-  mme_timer_t timer;
-  timer.fd   = timer_fd;
-  timer.type = type;
-  timer.imsi = imsi;
-
-  timers.push_back(timer);
+  m_s1ap_log->debug("Adding NAS timer to MME. IMSI %" PRIu64 ", Type %d, Timeout: %d ms\n", imsi, type, timeout_ms);
+  if (not m_timers.add(type, imsi, timeout_ms)) {
+    m_s1ap_log->warning("NAS timer already running. IMSI %" PRIu64 ", Type %d\n", imsi, type);
+    return false;
+  }
   return true;
 }
 
-bool mme::is_nas_timer_running(nas_timer_type type, uint64_t imsi)
+bool mme::is_nas_timer_running(enum nas_timer_type type, uint64_t imsi)
 {
-  std::vector<mme_timer_t>::iterator it;
-  for (it = timers.begin(); it != timers.end(); ++it) {
-    if (it->type == type && it->imsi == imsi) {
-      return true; // found timer
-    }
-  }
-  return false;
+  return m_timers.is_running(type, imsi);
 }
 
-bool mme::remove_nas_timer(nas_timer_type type, uint64_t imsi)
+bool mme::remove_nas_timer(enum nas_timer_type type, uint64_t imsi)
 {
-  std::vector<mme_timer_t>::iterator it;
-  for (it = timers.begin(); it != timers.end(); ++it) {
-    if (it->type == type && it->imsi == imsi) {
-      break; // found timer to remove
-    }
-  }
-  if (it == timers.end()) {
+  if (not m_timers.remove(type, imsi)) {
     m_s1ap_log->warning("Could not find timer to remove. IMSI %" PRIu64 ", Type %d\n", imsi, type);
     return false;
   }
-
-  // removing timer
-  m_s1ap_log->debug("Removing NAS timer from MME. IMSI %" PRIu64 ", Type %d, Fd: %d\n", imsi, type, it->fd);
-  FD_CLR(it->fd, &m_set);
-  close(it->fd);
-  timers.erase(it);
+  m_s1ap_log->debug("Removing NAS timer from MME. IMSI %" PRIu64 ", Type %d\n", imsi, type);
   return true;
 }
 
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsepc/hdr/mme/mme_auth_cache.h"
+#include <inttypes.h>
+#include <string.h>
+#include <vector>
+
+namespace srsepc {
+
+void mme_auth_cache::init(hss_interface_nas* hss, uint32_t batch_size, srslte::log* log)
+{
+  m_hss        = hss;
+  m_log        = log;
+  m_batch_size = batch_size > 0 ? batch_size : 1;
+  m_vectors.clear();
+}
+
+bool mme_auth_cache::gen_auth_info_answer(uint64_t imsi, uint8_t* k_asme, uint8_t* autn, uint8_t* rand, uint8_t* xres)
+{
+  if (m_batch_size == 1) {
+    return m_hss->gen_auth_info_answer(imsi, k_asme, autn, rand, xres);
+  }
+
+  std::deque<auth_vector_t>& cached = m_vectors[imsi];
+  if (cached.empty()) {
+    std::vector<auth_vector_t> batch(m_batch_size);
+    if (not m_hss->gen_auth_vectors(imsi, batch.data(), m_batch_size)) {
+      m_vectors.erase(imsi);
+      return false;
+    }
+    cached.assign(batch.begin(), batch.end());
+    m_log->debug("Fetched %d authentication vectors from HSS. IMSI: %015" PRIu64 "\n", m_batch_size, imsi);
+  }
+
+  const auth_vector_t& v = cached.front();
+  memcpy(k_asme, v.k_asme, sizeof(v.k_asme));
+  memcpy(autn, v.autn, sizeof(v.autn));
+  memcpy(rand, v.rand, sizeof(v.rand));
+  memcpy(xres, v.xres, sizeof(v.xres));
+  cached.pop_front();
+  return true;
+}
+
+bool mme_auth_cache::gen_auth_vectors(uint64_t imsi, auth_vector_t* vectors, uint32_t nof_vectors)
+{
+  return m_hss->gen_auth_vectors(imsi, vectors, nof_vectors);
+}
+
+bool mme_auth_cache::gen_update_loc_answer(uint64_t imsi, uint8_t* qci)
+{
+  return m_hss->gen_update_loc_answer(imsi, qci);
+}
+
+bool mme_auth_cache::resync_sqn(uint64_t imsi, uint8_t* rand, uint8_t* auts)
+{
+  flush(imsi);
+  return m_hss->resync_sqn(imsi, rand, auts);
+}
+
+void mme_auth_cache::flush(uint64_t imsi)
+{
+  m_vectors.erase(imsi);
+}
+
+size_t mme_auth_cache::nof_cached(uint64_t imsi) const
+{
+  auto it = m_vectors.find(imsi);
+  return it != m_vectors.end() ? it->second.size() : 0;
+}
+
+} // namespace srsepc
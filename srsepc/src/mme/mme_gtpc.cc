@@ -170,11 +170,11 @@ bool mme_gtpc::send_create_session_request(uint64_t imsi)
   cs_req->eps_bearer_context_created.ebi = 5;
 
   // Check whether this UE is already registed
-  std::map<uint64_t, struct gtpc_ctx>::iterator it = m_imsi_to_gtpc_ctx.find(imsi);
+  auto it = m_imsi_to_gtpc_ctx.find(imsi);
   if (it != m_imsi_to_gtpc_ctx.end()) {
     m_mme_gtpc_log->warning("Create Session Request being called for an UE with an active GTP-C connection.\n");
     m_mme_gtpc_log->warning("Deleting previous GTP-C connection.\n");
-    std::map<uint32_t, uint64_t>::iterator jt = m_mme_ctr_teid_to_imsi.find(it->second.mme_ctr_fteid.teid);
+    auto jt = m_mme_ctr_teid_to_imsi.find(it->second.mme_ctr_fteid.teid);
     if (jt == m_mme_ctr_teid_to_imsi.end()) {
       m_mme_gtpc_log->error("Could not find IMSI from MME Ctrl TEID. MME Ctr TEID: %d\n",
                             it->second.mme_ctr_fteid.teid);
@@ -217,7 +217,7 @@ bool mme_gtpc::handle_create_session_response(srslte::gtpc_pdu* cs_resp_pdu)
   }
 
   // Get IMSI from the control TEID
-  std::map<uint32_t, uint64_t>::iterator id_it = m_mme_ctr_teid_to_imsi.find(cs_resp_pdu->header.teid);
+  auto id_it = m_mme_ctr_teid_to_imsi.find(cs_resp_pdu->header.teid);
   if (id_it == m_mme_ctr_teid_to_imsi.end()) {
     m_mme_gtpc_log->warning("Could not find IMSI from Ctrl TEID.\n");
     return false;
@@ -267,7 +267,7 @@ bool mme_gtpc::handle_create_session_response(srslte::gtpc_pdu* cs_resp_pdu)
   srslte::console("SPGW Allocated IP %s to IMSI %015" PRIu64 "\n", inet_ntoa(emm_ctx->ue_ip), emm_ctx->imsi);
 
   // Save SGW ctrl F-TEID in GTP-C context
-  std::map<uint64_t, struct gtpc_ctx>::iterator it_g = m_imsi_to_gtpc_ctx.find(imsi);
+  auto it_g = m_imsi_to_gtpc_ctx.find(imsi);
   if (it_g == m_imsi_to_gtpc_ctx.end()) {
     // Could not find GTP-C Context
     m_mme_gtpc_log->error("Could not find GTP-C context\n");
@@ -292,7 +292,7 @@ bool mme_gtpc::send_modify_bearer_request(uint64_t imsi, uint16_t erab_to_modify
   srslte::gtpc_pdu mb_req_pdu;
   std::memset(&mb_req_pdu, 0, sizeof(mb_req_pdu));
 
-  std::map<uint64_t, gtpc_ctx_t>::iterator it = m_imsi_to_gtpc_ctx.find(imsi);
+  auto it = m_imsi_to_gtpc_ctx.find(imsi);
   if (it == m_imsi_to_gtpc_ctx.end()) {
     m_mme_gtpc_log->error("Modify bearer request for UE without GTP-C connection\n");
     return false;
@@ -321,8 +321,8 @@ bool mme_gtpc::send_modify_bearer_request(uint64_t imsi, uint16_t erab_to_modify
 
 void mme_gtpc::handle_modify_bearer_response(srslte::gtpc_pdu* mb_resp_pdu)
 {
-  uint32_t                               mme_ctrl_teid = mb_resp_pdu->header.teid;
-  std::map<uint32_t, uint64_t>::iterator imsi_it       = m_mme_ctr_teid_to_imsi.find(mme_ctrl_teid);
+  uint32_t mme_ctrl_teid = mb_resp_pdu->header.teid;
+  auto     imsi_it       = m_mme_ctr_teid_to_imsi.find(mme_ctrl_teid);
   if (imsi_it == m_mme_ctr_teid_to_imsi.end()) {
     m_mme_gtpc_log->error("Could not find IMSI from control TEID\n");
     return;
@@ -344,7 +344,7 @@ bool mme_gtpc::send_delete_session_request(uint64_t imsi)
   srslte::gtp_fteid_t mme_ctr_fteid;
 
   // Get S-GW Ctr TEID
-  std::map<uint64_t, gtpc_ctx_t>::iterator it_ctx = m_imsi_to_gtpc_ctx.find(imsi);
+  auto it_ctx = m_imsi_to_gtpc_ctx.find(imsi);
   if (it_ctx == m_imsi_to_gtpc_ctx.end()) {
     m_mme_gtpc_log->error("Could not find GTP-C context to remove\n");
     return false;
@@ -365,7 +365,7 @@ bool mme_gtpc::send_delete_session_request(uint64_t imsi)
   send_s11_pdu(del_req_pdu);
 
   // Delete GTP-C context
-  std::map<uint32_t, uint64_t>::iterator it_imsi = m_mme_ctr_teid_to_imsi.find(mme_ctr_fteid.teid);
+  auto it_imsi = m_mme_ctr_teid_to_imsi.find(mme_ctr_fteid.teid);
   if (it_imsi == m_mme_ctr_teid_to_imsi.end()) {
     m_mme_gtpc_log->error("Could not find IMSI from MME ctr TEID");
   } else {
@@ -384,7 +384,7 @@ void mme_gtpc::send_release_access_bearers_request(uint64_t imsi)
   srslte::gtp_fteid_t sgw_ctr_fteid;
 
   // Get S-GW Ctr TEID
-  std::map<uint64_t, gtpc_ctx_t>::iterator it_ctx = m_imsi_to_gtpc_ctx.find(imsi);
+  auto it_ctx = m_imsi_to_gtpc_ctx.find(imsi);
   if (it_ctx == m_imsi_to_gtpc_ctx.end()) {
     m_mme_gtpc_log->error("Could not find GTP-C context to remove\n");
     return;
@@ -410,7 +410,7 @@ bool mme_gtpc::handle_downlink_data_notification(srslte::gtpc_pdu* dl_not_pdu)
 {
   uint32_t                                 mme_ctrl_teid = dl_not_pdu->header.teid;
   srslte::gtpc_downlink_data_notification* dl_not        = &dl_not_pdu->choice.downlink_data_notification;
-  std::map<uint32_t, uint64_t>::iterator   imsi_it       = m_mme_ctr_teid_to_imsi.find(mme_ctrl_teid);
+  auto                                     imsi_it       = m_mme_ctr_teid_to_imsi.find(mme_ctrl_teid);
   if (imsi_it == m_mme_ctr_teid_to_imsi.end()) {
     m_mme_gtpc_log->error("Could not find IMSI from control TEID\n");
     return false;
@@ -435,7 +435,7 @@ void mme_gtpc::send_downlink_data_notification_acknowledge(uint64_t imsi, enum s
   std::memset(&not_ack_pdu, 0, sizeof(not_ack_pdu));
 
   // get s-gw ctr teid
-  std::map<uint64_t, gtpc_ctx_t>::iterator it_ctx = m_imsi_to_gtpc_ctx.find(imsi);
+  auto it_ctx = m_imsi_to_gtpc_ctx.find(imsi);
   if (it_ctx == m_imsi_to_gtpc_ctx.end()) {
     m_mme_gtpc_log->error("could not find gtp-c context to remove\n");
     return;
@@ -465,7 +465,7 @@ bool mme_gtpc::send_downlink_data_notification_failure_indication(uint64_t imsi,
   std::memset(&not_fail_pdu, 0, sizeof(not_fail_pdu));
 
   // get s-gw ctr teid
-  std::map<uint64_t, gtpc_ctx_t>::iterator it_ctx = m_imsi_to_gtpc_ctx.find(imsi);
+  auto it_ctx = m_imsi_to_gtpc_ctx.find(imsi);
   if (it_ctx == m_imsi_to_gtpc_ctx.end()) {
     m_mme_gtpc_log->error("could not find gtp-c context to send paging failure\n");
     return false;
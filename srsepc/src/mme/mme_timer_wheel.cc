@@ -0,0 +1,137 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsepc/hdr/mme/mme_timer_wheel.h"
+#include <algorithm>
+#include <iterator>
+
+namespace srsepc {
+
+mme_timer_wheel::mme_timer_wheel(uint32_t tick_ms_, uint32_t nof_slots) :
+  tick_ms(std::max(tick_ms_, 1u)),
+  slots(std::max(nof_slots, 1u)),
+  origin(clock::now())
+{
+}
+
+void mme_timer_wheel::reset(clock::time_point now)
+{
+  for (slot_t& s : slots) {
+    s.clear();
+  }
+  index.clear();
+  origin   = now;
+  cur_tick = 0;
+}
+
+bool mme_timer_wheel::add(enum nas_timer_type type, uint64_t imsi, uint32_t timeout_ms, clock::time_point now)
+{
+  uint64_t k = key(type, imsi);
+  if (index.count(k) > 0) {
+    return false;
+  }
+
+  // The wheel may lag behind the current time until the next advance(). Round up, a timer never fires early
+  uint64_t ticks  = std::max<uint64_t>((timeout_ms + tick_ms - 1) / tick_ms, 1);
+  uint64_t expiry = std::max(cur_tick, tick_of(now)) + ticks;
+  uint32_t slot   = expiry % slots.size();
+
+  entry_t e;
+  e.timer.imsi = imsi;
+  e.timer.type = type;
+  e.rounds     = (expiry - cur_tick - 1) / slots.size();
+  slots[slot].push_back(e);
+
+  location_t loc;
+  loc.slot = slot;
+  loc.it   = std::prev(slots[slot].end());
+  index.emplace(k, loc);
+  return true;
+}
+
+bool mme_timer_wheel::remove(enum nas_timer_type type, uint64_t imsi)
+{
+  auto it = index.find(key(type, imsi));
+  if (it == index.end()) {
+    return false;
+  }
+  slots[it->second.slot].erase(it->second.it);
+  index.erase(it);
+  return true;
+}
+
+bool mme_timer_wheel::is_running(enum nas_timer_type type, uint64_t imsi) const
+{
+  return index.count(key(type, imsi)) > 0;
+}
+
+void mme_timer_wheel::advance(clock::time_point now, std::vector<mme_timer_t>* expired)
+{
+  uint64_t target = tick_of(now);
+
+  // Nothing to visit, just move the wheel
+  if (index.empty()) {
+    cur_tick = std::max(cur_tick, target);
+    return;
+  }
+
+  while (cur_tick < target) {
+    cur_tick++;
+    slot_t& s = slots[cur_tick % slots.size()];
+    for (auto it = s.begin(); it != s.end();) {
+      if (it->rounds > 0) {
+        it->rounds--;
+        ++it;
+        continue;
+      }
+      expired->push_back(it->timer);
+      index.erase(key(it->timer.type, it->timer.imsi));
+      it = s.erase(it);
+    }
+    if (index.empty()) {
+      cur_tick = target;
+    }
+  }
+}
+
+uint64_t mme_timer_wheel::tick_of(clock::time_point t) const
+{
+  if (t < origin) {
+    return 0;
+  }
+  return std::chrono::duration_cast<std::chrono::milliseconds>(t - origin).count() / tick_ms;
+}
+
+int mme_timer_wheel::time_to_next_tick_ms(clock::time_point now) const
+{
+  if (index.empty()) {
+    return -1;
+  }
+  clock::time_point next = origin + std::chrono::milliseconds((cur_tick + 1) * tick_ms);
+  if (next <= now) {
+    return 0;
+  }
+  // Round up so that the wheel is not advanced before the tick boundary
+  auto us = std::chrono::duration_cast<std::chrono::microseconds>(next - now).count();
+  return (int)((us + 999) / 1000);
+}
+
+} // namespace srsepc
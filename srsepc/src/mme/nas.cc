@@ -25,7 +25,6 @@
 #include "srslte/common/security.h"
 #include <cmath>
 #include <inttypes.h> // for printing uint64_t
-#include <sys/timerfd.h>
 #include <time.h>
 
 namespace srsepc {
@@ -1202,7 +1201,7 @@ bool nas::handle_authentication_failure(srslte::byte_buffer_t* nas_rx)
         m_nas_log->error("Missing fail parameter\n");
         return false;
       }
-      if (!m_hss->resync_sqn(m_emm_ctx.imsi, auth_fail.auth_fail_param)) {
+      if (!m_hss->resync_sqn(m_emm_ctx.imsi, m_sec_ctx.rand, auth_fail.auth_fail_param)) {
         srslte::console("Resynchronization failed. IMSI %015" PRIu64 "\n", m_emm_ctx.imsi);
         m_nas_log->info("Resynchronization failed. IMSI %015" PRIu64 "\n", m_emm_ctx.imsi);
         return false;
@@ -1931,24 +1930,10 @@ bool nas::start_t3413()
     return false;
   }
 
-  int fdt = timerfd_create(CLOCK_MONOTONIC, 0);
-  if (fdt < 0) {
-    m_nas_log->error("Error creating timer. %s\n", strerror(errno));
+  if (!m_mme->add_nas_timer(T_3413, m_emm_ctx.imsi, m_t3413 * 1000)) { // TODO timers without IMSI?
+    m_nas_log->error("Could not start T3413\n");
     return false;
   }
-  struct itimerspec t_value;
-  t_value.it_value.tv_sec     = m_t3413;
-  t_value.it_value.tv_nsec    = 0;
-  t_value.it_interval.tv_sec  = 0;
-  t_value.it_interval.tv_nsec = 0;
-
-  if (timerfd_settime(fdt, 0, &t_value, NULL) == -1) {
-    m_nas_log->error("Could not set timer\n");
-    close(fdt);
-    return false;
-  }
-
-  m_mme->add_nas_timer(fdt, T_3413, m_emm_ctx.imsi); // TODO timers without IMSI?
   return true;
 }
 
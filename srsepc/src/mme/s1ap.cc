@@ -73,8 +73,9 @@ int s1ap::init(s1ap_args_t s1ap_args, srslte::log_filter* nas_log, srslte::log_f
   m_nas_log  = nas_log;
   m_s1ap_log = s1ap_log;
 
-  // Get pointer to the HSS
-  m_hss = hss::get_instance();
+  // Get pointer to the HSS, accessed through the authentication vector cache
+  m_auth_cache.init(hss::get_instance(), s1ap_args.auth_vector_batch, m_nas_log);
+  m_hss = &m_auth_cache;
 
   // Init message handlers
   m_s1ap_mngmt_proc = s1ap_mngmt_proc::get_instance(); // Managment procedures
@@ -113,7 +114,7 @@ void s1ap::stop()
     m_active_enbs.erase(enb_it++);
   }
 
-  std::map<uint64_t, nas*>::iterator ue_it = m_imsi_to_nas_ctx.begin();
+  auto ue_it = m_imsi_to_nas_ctx.begin();
   while (ue_it != m_imsi_to_nas_ctx.end()) {
     m_s1ap_log->info("Deleting UE EMM context. IMSI: %015" PRIu64 "\n", ue_it->first);
     srslte::console("Deleting UE EMM context. IMSI: %015" PRIu64 "\n", ue_it->first);
@@ -230,12 +231,16 @@ void s1ap::handle_s1ap_rx_pdu(srslte::byte_buffer_t* pdu, struct sctp_sndrcvinfo
     m_pcap.write_s1ap(pdu->msg, pdu->N_bytes);
   }
 
-  // Get PDU type
+  // Get PDU type. The IEs are unpacked into the arena, which the previous PDU no longer uses
+  m_rx_arena.reset();
   s1ap_pdu_t     rx_pdu;
   asn1::cbit_ref bref(pdu->msg, pdu->N_bytes);
-  if (rx_pdu.unpack(bref) != asn1::SRSASN_SUCCESS) {
-    m_s1ap_log->error("Failed to unpack received PDU\n");
-    return;
+  {
+    asn1::arena_scope arena_scope(m_rx_arena);
+    if (rx_pdu.unpack(bref) != asn1::SRSASN_SUCCESS) {
+      m_s1ap_log->error("Failed to unpack received PDU\n");
+      return;
+    }
   }
 
   switch (rx_pdu.type().value) {
@@ -305,12 +310,12 @@ void s1ap::handle_successful_outcome(const asn1::s1ap::successful_outcome_s& msg
 void s1ap::add_new_enb_ctx(const enb_ctx_t& enb_ctx, const struct sctp_sndrcvinfo* enb_sri)
 {
   m_s1ap_log->info("Adding new eNB context. eNB ID %d\n", enb_ctx.enb_id);
-  std::set<uint32_t> ue_set;
-  enb_ctx_t*         enb_ptr = new enb_ctx_t;
-  *enb_ptr                   = enb_ctx;
+  std::unordered_set<uint32_t> ue_set;
+  enb_ctx_t*                   enb_ptr = new enb_ctx_t;
+  *enb_ptr                             = enb_ctx;
   m_active_enbs.insert(std::pair<uint16_t, enb_ctx_t*>(enb_ptr->enb_id, enb_ptr));
   m_sctp_to_enb_id.insert(std::pair<int32_t, uint16_t>(enb_sri->sinfo_assoc_id, enb_ptr->enb_id));
-  m_enb_assoc_to_ue_ids.insert(std::pair<int32_t, std::set<uint32_t> >(enb_sri->sinfo_assoc_id, ue_set));
+  m_enb_assoc_to_ue_ids.insert(std::pair<int32_t, std::unordered_set<uint32_t> >(enb_sri->sinfo_assoc_id, ue_set));
 }
 
 enb_ctx_t* s1ap::find_enb_ctx(uint16_t enb_id)
@@ -350,13 +355,13 @@ void s1ap::delete_enb_ctx(int32_t assoc_id)
 // UE Context Management
 bool s1ap::add_nas_ctx_to_imsi_map(nas* nas_ctx)
 {
-  std::map<uint64_t, nas*>::iterator ctx_it = m_imsi_to_nas_ctx.find(nas_ctx->m_emm_ctx.imsi);
+  auto ctx_it = m_imsi_to_nas_ctx.find(nas_ctx->m_emm_ctx.imsi);
   if (ctx_it != m_imsi_to_nas_ctx.end()) {
     m_s1ap_log->error("UE Context already exists. IMSI %015" PRIu64 "\n", nas_ctx->m_emm_ctx.imsi);
     return false;
   }
   if (nas_ctx->m_ecm_ctx.mme_ue_s1ap_id != 0) {
-    std::map<uint32_t, nas*>::iterator ctx_it2 = m_mme_ue_s1ap_id_to_nas_ctx.find(nas_ctx->m_ecm_ctx.mme_ue_s1ap_id);
+    auto ctx_it2 = m_mme_ue_s1ap_id_to_nas_ctx.find(nas_ctx->m_ecm_ctx.mme_ue_s1ap_id);
     if (ctx_it2 != m_mme_ue_s1ap_id_to_nas_ctx.end() && ctx_it2->second != nas_ctx) {
       m_s1ap_log->error("Context identified with IMSI does not match context identified by MME UE S1AP Id.\n");
       return false;
@@ -373,13 +378,13 @@ bool s1ap::add_nas_ctx_to_mme_ue_s1ap_id_map(nas* nas_ctx)
     m_s1ap_log->error("Could not add UE context to MME UE S1AP map. MME UE S1AP ID 0 is not valid.\n");
     return false;
   }
-  std::map<uint32_t, nas*>::iterator ctx_it = m_mme_ue_s1ap_id_to_nas_ctx.find(nas_ctx->m_ecm_ctx.mme_ue_s1ap_id);
+  auto ctx_it = m_mme_ue_s1ap_id_to_nas_ctx.find(nas_ctx->m_ecm_ctx.mme_ue_s1ap_id);
   if (ctx_it != m_mme_ue_s1ap_id_to_nas_ctx.end()) {
     m_s1ap_log->error("UE Context already exists. MME UE S1AP Id %015" PRIu64 "\n", nas_ctx->m_emm_ctx.imsi);
     return false;
   }
   if (nas_ctx->m_emm_ctx.imsi != 0) {
-    std::map<uint32_t, nas*>::iterator ctx_it2 = m_mme_ue_s1ap_id_to_nas_ctx.find(nas_ctx->m_ecm_ctx.mme_ue_s1ap_id);
+    auto ctx_it2 = m_mme_ue_s1ap_id_to_nas_ctx.find(nas_ctx->m_ecm_ctx.mme_ue_s1ap_id);
     if (ctx_it2 != m_mme_ue_s1ap_id_to_nas_ctx.end() && ctx_it2->second != nas_ctx) {
       m_s1ap_log->error("Context identified with MME UE S1AP Id does not match context identified by IMSI.\n");
       return false;
@@ -392,12 +397,12 @@ bool s1ap::add_nas_ctx_to_mme_ue_s1ap_id_map(nas* nas_ctx)
 
 bool s1ap::add_ue_to_enb_set(int32_t enb_assoc, uint32_t mme_ue_s1ap_id)
 {
-  std::map<int32_t, std::set<uint32_t> >::iterator ues_in_enb = m_enb_assoc_to_ue_ids.find(enb_assoc);
+  auto ues_in_enb = m_enb_assoc_to_ue_ids.find(enb_assoc);
   if (ues_in_enb == m_enb_assoc_to_ue_ids.end()) {
     m_s1ap_log->error("Could not find eNB from eNB SCTP association %d\n", enb_assoc);
     return false;
   }
-  std::set<uint32_t>::iterator ue_id = ues_in_enb->second.find(mme_ue_s1ap_id);
+  auto ue_id = ues_in_enb->second.find(mme_ue_s1ap_id);
   if (ue_id != ues_in_enb->second.end()) {
     m_s1ap_log->error("UE with MME UE S1AP Id already exists %d\n", mme_ue_s1ap_id);
     return false;
@@ -409,7 +414,7 @@ bool s1ap::add_ue_to_enb_set(int32_t enb_assoc, uint32_t mme_ue_s1ap_id)
 
 nas* s1ap::find_nas_ctx_from_mme_ue_s1ap_id(uint32_t mme_ue_s1ap_id)
 {
-  std::map<uint32_t, nas*>::iterator it = m_mme_ue_s1ap_id_to_nas_ctx.find(mme_ue_s1ap_id);
+  auto it = m_mme_ue_s1ap_id_to_nas_ctx.find(mme_ue_s1ap_id);
   if (it == m_mme_ue_s1ap_id_to_nas_ctx.end()) {
     return NULL;
   } else {
@@ -419,7 +424,7 @@ nas* s1ap::find_nas_ctx_from_mme_ue_s1ap_id(uint32_t mme_ue_s1ap_id)
 
 nas* s1ap::find_nas_ctx_from_imsi(uint64_t imsi)
 {
-  std::map<uint64_t, nas*>::iterator it = m_imsi_to_nas_ctx.find(imsi);
+  auto it = m_imsi_to_nas_ctx.find(imsi);
   if (it == m_imsi_to_nas_ctx.end()) {
     return NULL;
   } else {
@@ -430,15 +435,15 @@ nas* s1ap::find_nas_ctx_from_imsi(uint64_t imsi)
 void s1ap::release_ues_ecm_ctx_in_enb(int32_t enb_assoc)
 {
   srslte::console("Releasing UEs context\n");
-  std::map<int32_t, std::set<uint32_t> >::iterator ues_in_enb = m_enb_assoc_to_ue_ids.find(enb_assoc);
-  std::set<uint32_t>::iterator                     ue_id      = ues_in_enb->second.begin();
+  auto ues_in_enb = m_enb_assoc_to_ue_ids.find(enb_assoc);
+  auto ue_id      = ues_in_enb->second.begin();
   if (ue_id == ues_in_enb->second.end()) {
     srslte::console("No UEs to be released\n");
   } else {
     while (ue_id != ues_in_enb->second.end()) {
-      std::map<uint32_t, nas*>::iterator nas_ctx = m_mme_ue_s1ap_id_to_nas_ctx.find(*ue_id);
-      emm_ctx_t*                         emm_ctx = &nas_ctx->second->m_emm_ctx;
-      ecm_ctx_t*                         ecm_ctx = &nas_ctx->second->m_ecm_ctx;
+      auto       nas_ctx = m_mme_ue_s1ap_id_to_nas_ctx.find(*ue_id);
+      emm_ctx_t* emm_ctx = &nas_ctx->second->m_emm_ctx;
+      ecm_ctx_t* ecm_ctx = &nas_ctx->second->m_ecm_ctx;
 
       m_s1ap_log->info(
           "Releasing UE context. IMSI: %015" PRIu64 ", UE-MME S1AP Id: %d\n", emm_ctx->imsi, ecm_ctx->mme_ue_s1ap_id);
@@ -470,8 +475,8 @@ bool s1ap::release_ue_ecm_ctx(uint32_t mme_ue_s1ap_id)
     m_s1ap_log->error("Could not find eNB for UE release request.\n");
     return false;
   }
-  uint16_t                                         enb_id = it->second;
-  std::map<int32_t, std::set<uint32_t> >::iterator ue_set = m_enb_assoc_to_ue_ids.find(ecm_ctx->enb_sri.sinfo_assoc_id);
+  uint16_t enb_id = it->second;
+  auto     ue_set = m_enb_assoc_to_ue_ids.find(ecm_ctx->enb_sri.sinfo_assoc_id);
   if (ue_set == m_enb_assoc_to_ue_ids.end()) {
     m_s1ap_log->error("Could not find the eNB's UEs.\n");
     return false;
@@ -511,14 +516,14 @@ bool s1ap::delete_ue_ctx(uint64_t imsi)
 // UE Bearer Managment
 void s1ap::activate_eps_bearer(uint64_t imsi, uint8_t ebi)
 {
-  std::map<uint64_t, nas*>::iterator ue_ctx_it = m_imsi_to_nas_ctx.find(imsi);
+  auto ue_ctx_it = m_imsi_to_nas_ctx.find(imsi);
   if (ue_ctx_it == m_imsi_to_nas_ctx.end()) {
     m_s1ap_log->error("Could not activate EPS bearer: Could not find UE context\n");
     return;
   }
   // Make sure NAS is active
-  uint32_t                           mme_ue_s1ap_id = ue_ctx_it->second->m_ecm_ctx.mme_ue_s1ap_id;
-  std::map<uint32_t, nas*>::iterator it             = m_mme_ue_s1ap_id_to_nas_ctx.find(mme_ue_s1ap_id);
+  uint32_t mme_ue_s1ap_id = ue_ctx_it->second->m_ecm_ctx.mme_ue_s1ap_id;
+  auto     it             = m_mme_ue_s1ap_id_to_nas_ctx.find(mme_ue_s1ap_id);
   if (it == m_mme_ue_s1ap_id_to_nas_ctx.end()) {
     m_s1ap_log->error("Could not activate EPS bearer: ECM context seems to be missing\n");
     return;
@@ -558,7 +563,7 @@ uint32_t s1ap::allocate_m_tmsi(uint64_t imsi)
 
 uint64_t s1ap::find_imsi_from_m_tmsi(uint32_t m_tmsi)
 {
-  std::map<uint32_t, uint64_t>::iterator it = m_tmsi_to_imsi.find(m_tmsi);
+  auto it = m_tmsi_to_imsi.find(m_tmsi);
   if (it != m_tmsi_to_imsi.end()) {
     m_s1ap_log->debug("Found IMSI %015" PRIu64 " from M-TMSI 0x%x\n", it->second, m_tmsi);
     return it->second;
@@ -84,7 +84,7 @@ void s1ap_nas_transport::init()
   // Init NAS interface
   m_nas_if.s1ap = s1ap::get_instance();
   m_nas_if.gtpc = mme_gtpc::get_instance();
-  m_nas_if.hss  = hss::get_instance();
+  m_nas_if.hss  = m_s1ap->get_hss();
   m_nas_if.mme  = mme::get_instance();
 }
 
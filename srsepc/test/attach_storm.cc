@@ -0,0 +1,740 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        attach_storm.cc
+ * Description: S1-MME load generator. Emulates a number of eNBs, each one
+ *              running the complete EPS attach procedure (authentication, NAS
+ *              security mode and default bearer setup) for many UEs at once,
+ *              and reports the attach rate sustained by the MME together with
+ *              the attach latency distribution.
+ *****************************************************************************/
+
+#include "srslte/asn1/liblte_mme.h"
+#include "srslte/asn1/s1ap_asn1.h"
+#include "srslte/common/bcd_helpers.h"
+#include "srslte/common/int_helpers.h"
+#include "srslte/common/network_utils.h"
+#include "srslte/common/security.h"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <chrono>
+#include <inttypes.h>
+#include <netinet/sctp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+using namespace asn1::s1ap;
+using namespace srslte;
+
+typedef std::chrono::steady_clock clock_type;
+
+#define S1AP_PPID 18
+#define MAX_EPOLL_EVENTS 64
+
+/**********************************************************************
+ *  Program arguments
+ **********************************************************************/
+std::string mme_addr     = "127.0.1.100";
+std::string bind_addr    = "127.0.1.1";
+std::string gtp_addr     = "127.0.1.1";
+std::string db_file      = "";
+std::string mcc_str      = "001";
+std::string mnc_str      = "01";
+uint16_t    tac          = 0x0007;
+uint32_t    nof_enbs     = 4;
+uint32_t    nof_ues      = 1000;
+uint32_t    concurrency  = 64;
+uint64_t    first_imsi   = 1010000000000;
+uint32_t    timeout_s    = 60;
+bool        detach       = true;
+uint16_t    mcc          = 0;
+uint16_t    mnc          = 0;
+
+// Subscriber keys shared by all the emulated UEs
+uint8_t k[16]   = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+uint8_t opc[16] = {0x63, 0xbf, 0xa5, 0x0e, 0xe6, 0x52, 0x33, 0x65, 0xff, 0x14, 0xc1, 0xf4, 0x5f, 0x88, 0x73, 0x7d};
+
+void usage(char* prog)
+{
+  printf("Usage: %s [abgmnleucit] [-d] [-w user_db.csv]\n", prog);
+  printf("\t-a MME address [Default %s]\n", mme_addr.c_str());
+  printf("\t-b S1-MME bind address of the emulated eNBs [Default %s]\n", bind_addr.c_str());
+  printf("\t-g GTP-U address reported to the MME [Default %s]\n", gtp_addr.c_str());
+  printf("\t-m MCC [Default %s]\n", mcc_str.c_str());
+  printf("\t-n MNC [Default %s]\n", mnc_str.c_str());
+  printf("\t-l TAC [Default 0x%x]\n", tac);
+  printf("\t-e Number of emulated eNBs [Default %d]\n", nof_enbs);
+  printf("\t-u Number of UEs (attaches) [Default %d]\n", nof_ues);
+  printf("\t-c Maximum number of attaches in flight [Default %d]\n", concurrency);
+  printf("\t-i IMSI of the first UE [Default %015" PRIu64 "]\n", first_imsi);
+  printf("\t-t Timeout of the whole run in seconds [Default %d]\n", timeout_s);
+  printf("\t-d Keep the UEs attached, do not send a detach after each attach\n");
+  printf("\t-w Write the UEs into the given HSS user database file and exit\n");
+  printf("\nAll UEs use Milenage with K=00112233445566778899aabbccddeeff and OPc=63bfa50ee6523365ff14c1f45f88737d\n");
+}
+
+void parse_args(int argc, char** argv)
+{
+  int opt;
+  while ((opt = getopt(argc, argv, "a:b:g:m:n:l:e:u:c:i:t:dw:h")) != -1) {
+    switch (opt) {
+      case 'a':
+        mme_addr = optarg;
+        break;
+      case 'b':
+        bind_addr = optarg;
+        break;
+      case 'g':
+        gtp_addr = optarg;
+        break;
+      case 'm':
+        mcc_str = optarg;
+        break;
+      case 'n':
+        mnc_str = optarg;
+        break;
+      case 'l':
+        tac = (uint16_t)strtol(optarg, NULL, 0);
+        break;
+      case 'e':
+        nof_enbs = (uint32_t)strtol(optarg, NULL, 10);
+        break;
+      case 'u':
+        nof_ues = (uint32_t)strtol(optarg, NULL, 10);
+        break;
+      case 'c':
+        concurrency = (uint32_t)strtol(optarg, NULL, 10);
+        break;
+      case 'i':
+        first_imsi = strtoull(optarg, NULL, 10);
+        break;
+      case 't':
+        timeout_s = (uint32_t)strtol(optarg, NULL, 10);
+        break;
+      case 'd':
+        detach = false;
+        break;
+      case 'w':
+        db_file = optarg;
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+  if (not string_to_mcc(mcc_str, &mcc) or not string_to_mnc(mnc_str, &mnc)) {
+    printf("Invalid MCC/MNC %s/%s\n", mcc_str.c_str(), mnc_str.c_str());
+    exit(-1);
+  }
+  if (nof_enbs == 0 or concurrency == 0) {
+    usage(argv[0]);
+    exit(-1);
+  }
+}
+
+/**********************************************************************
+ *  Emulated UEs and eNBs
+ **********************************************************************/
+typedef enum {
+  UE_WAIT_AUTH = 0,
+  UE_WAIT_SMC,
+  UE_WAIT_CTXT_SETUP,
+  UE_WAIT_EMM_INFO,
+  UE_WAIT_RELEASE,
+} ue_state_t;
+
+struct ue_ctx_t {
+  uint64_t                    imsi;
+  uint32_t                    enb_ue_s1ap_id;
+  uint32_t                    mme_ue_s1ap_id;
+  ue_state_t                  state;
+  uint8_t                     k_asme[32];
+  uint8_t                     k_nas_enc[32];
+  uint8_t                     k_nas_int[32];
+  CIPHERING_ALGORITHM_ID_ENUM cipher_algo;
+  INTEGRITY_ALGORITHM_ID_ENUM integ_algo;
+  uint32_t                    ul_count;
+  clock_type::time_point      start;
+};
+
+struct enb_ctx_t {
+  uint32_t                               enb_id;
+  socket_handler_t                       socket;
+  sockaddr_in                            mme_sockaddr;
+  bool                                   setup_done;
+  uint32_t                               next_enb_ue_s1ap_id;
+  std::unordered_map<uint32_t, ue_ctx_t> ues; ///< Indexed by eNB-UE-S1AP-ID
+  asn1::s1ap::tai_s                      tai;
+  asn1::s1ap::eutran_cgi_s               eutran_cgi;
+};
+
+struct storm_stats_t {
+  uint32_t              started;
+  uint32_t              completed;
+  uint32_t              failed;
+  uint32_t              released;
+  std::vector<uint32_t> latency_us;
+};
+
+static storm_stats_t stats = {};
+
+static bool send_s1ap(enb_ctx_t* enb, const s1ap_pdu_c& tx_pdu)
+{
+  uint8_t       buf[4096];
+  asn1::bit_ref bref(buf, sizeof(buf));
+  if (tx_pdu.pack(bref) != asn1::SRSASN_SUCCESS) {
+    printf("Error packing S1AP PDU\n");
+    return false;
+  }
+  ssize_t n_sent = sctp_sendmsg(enb->socket.fd(),
+                                buf,
+                                bref.distance_bytes(),
+                                (struct sockaddr*)&enb->mme_sockaddr,
+                                sizeof(struct sockaddr_in),
+                                htonl(S1AP_PPID),
+                                0,
+                                0,
+                                0,
+                                0);
+  if (n_sent == -1) {
+    printf("Error sending S1AP PDU from eNB %d: %s\n", enb->enb_id, strerror(errno));
+    return false;
+  }
+  return true;
+}
+
+static bool send_s1_setup(enb_ctx_t* enb)
+{
+  uint32_t plmn;
+  s1ap_mccmnc_to_plmn(mcc, mnc, &plmn);
+
+  enb->tai.plm_nid.from_number(plmn);
+  enb->tai.tac.from_number(tac);
+  enb->eutran_cgi.plm_nid.from_number(plmn);
+  enb->eutran_cgi.cell_id.from_number((enb->enb_id << 8u) | 1u);
+
+  s1ap_pdu_c pdu;
+  pdu.set_init_msg().load_info_obj(ASN1_S1AP_ID_S1_SETUP);
+  s1_setup_request_ies_container& container = pdu.init_msg().value.s1_setup_request().protocol_ies;
+  container.global_enb_id.value.plm_nid.from_number(plmn);
+  container.global_enb_id.value.enb_id.set_macro_enb_id().from_number(enb->enb_id);
+  container.enbname_present = true;
+  container.enbname.value.from_string("storm" + std::to_string(enb->enb_id));
+  container.supported_tas.value.resize(1);
+  container.supported_tas.value[0].tac.from_number(tac);
+  container.supported_tas.value[0].broadcast_plmns.resize(1);
+  container.supported_tas.value[0].broadcast_plmns[0].from_number(plmn);
+  container.default_paging_drx.value.value = asn1::s1ap::paging_drx_opts::v128;
+
+  return send_s1ap(enb, pdu);
+}
+
+static bool send_ul_nas(enb_ctx_t* enb, ue_ctx_t* ue, const LIBLTE_BYTE_MSG_STRUCT& nas)
+{
+  s1ap_pdu_c tx_pdu;
+  tx_pdu.set_init_msg().load_info_obj(ASN1_S1AP_ID_UL_NAS_TRANSPORT);
+  ul_nas_transport_ies_container& container = tx_pdu.init_msg().value.ul_nas_transport().protocol_ies;
+  container.mme_ue_s1ap_id.value            = ue->mme_ue_s1ap_id;
+  container.enb_ue_s1ap_id.value            = ue->enb_ue_s1ap_id;
+  container.nas_pdu.value.resize(nas.N_bytes);
+  memcpy(container.nas_pdu.value.data(), nas.msg, nas.N_bytes);
+  container.eutran_cgi.value = enb->eutran_cgi;
+  container.tai.value        = enb->tai;
+  return send_s1ap(enb, tx_pdu);
+}
+
+/* (De)ciphers the payload of a security protected NAS message */
+static void cipher_nas(ue_ctx_t* ue, uint32_t count, uint8_t direction, LIBLTE_BYTE_MSG_STRUCT* nas)
+{
+  switch (ue->cipher_algo) {
+    case CIPHERING_ALGORITHM_ID_128_EEA1:
+      security_128_eea1(&ue->k_nas_enc[16], count, 0, direction, &nas->msg[6], nas->N_bytes - 6, &nas->msg[6]);
+      break;
+    case CIPHERING_ALGORITHM_ID_128_EEA2:
+      security_128_eea2(&ue->k_nas_enc[16], count, 0, direction, &nas->msg[6], nas->N_bytes - 6, &nas->msg[6]);
+      break;
+    default:
+      break;
+  }
+}
+
+/* Ciphers and integrity protects a packed uplink NAS message, as done by the UE NAS layer */
+static void protect_nas(ue_ctx_t* ue, LIBLTE_BYTE_MSG_STRUCT* nas)
+{
+  cipher_nas(ue, ue->ul_count, SECURITY_DIRECTION_UPLINK, nas);
+  switch (ue->integ_algo) {
+    case INTEGRITY_ALGORITHM_ID_128_EIA1:
+      security_128_eia1(
+          &ue->k_nas_int[16], ue->ul_count, 0, SECURITY_DIRECTION_UPLINK, &nas->msg[5], nas->N_bytes - 5, &nas->msg[1]);
+      break;
+    case INTEGRITY_ALGORITHM_ID_128_EIA2:
+      security_128_eia2(
+          &ue->k_nas_int[16], ue->ul_count, 0, SECURITY_DIRECTION_UPLINK, &nas->msg[5], nas->N_bytes - 5, &nas->msg[1]);
+      break;
+    default:
+      break;
+  }
+}
+
+static bool start_attach(enb_ctx_t* enb, uint64_t imsi)
+{
+  ue_ctx_t ue       = {};
+  ue.imsi           = imsi;
+  ue.enb_ue_s1ap_id = enb->next_enb_ue_s1ap_id++;
+  ue.state          = UE_WAIT_AUTH;
+  ue.start          = clock_type::now();
+
+  // PDN connectivity request without ESM information transfer, so that the MME goes straight to the default bearer
+  LIBLTE_MME_PDN_CONNECTIVITY_REQUEST_MSG_STRUCT pdn_con_req = {};
+  pdn_con_req.eps_bearer_id                                  = 0;
+  pdn_con_req.proc_transaction_id                            = 1;
+  pdn_con_req.request_type                                   = LIBLTE_MME_REQUEST_TYPE_INITIAL_REQUEST;
+  pdn_con_req.pdn_type                                       = LIBLTE_MME_PDN_TYPE_IPV4;
+
+  LIBLTE_MME_ATTACH_REQUEST_MSG_STRUCT attach_req = {};
+  attach_req.eps_attach_type                      = LIBLTE_MME_EPS_ATTACH_TYPE_EPS_ATTACH;
+  for (uint32_t i = 0; i < 3; i++) {
+    attach_req.ue_network_cap.eea[i] = true;
+    attach_req.ue_network_cap.eia[i] = true;
+  }
+  attach_req.eps_mobile_id.type_of_id = LIBLTE_MME_EPS_MOBILE_ID_TYPE_IMSI;
+  attach_req.nas_ksi.tsc_flag         = LIBLTE_MME_TYPE_OF_SECURITY_CONTEXT_FLAG_NATIVE;
+  attach_req.nas_ksi.nas_ksi          = LIBLTE_MME_NAS_KEY_SET_IDENTIFIER_NO_KEY_AVAILABLE;
+  for (int i = 14; i >= 0; i--) {
+    attach_req.eps_mobile_id.imsi[i] = imsi % 10;
+    imsi /= 10;
+  }
+  liblte_mme_pack_pdn_connectivity_request_msg(&pdn_con_req, &attach_req.esm_msg);
+
+  LIBLTE_BYTE_MSG_STRUCT nas = {};
+  liblte_mme_pack_attach_request_msg(&attach_req, &nas);
+
+  s1ap_pdu_c tx_pdu;
+  tx_pdu.set_init_msg().load_info_obj(ASN1_S1AP_ID_INIT_UE_MSG);
+  init_ue_msg_ies_container& container = tx_pdu.init_msg().value.init_ue_msg().protocol_ies;
+  container.enb_ue_s1ap_id.value       = ue.enb_ue_s1ap_id;
+  container.nas_pdu.value.resize(nas.N_bytes);
+  memcpy(container.nas_pdu.value.data(), nas.msg, nas.N_bytes);
+  container.tai.value                     = enb->tai;
+  container.eutran_cgi.value              = enb->eutran_cgi;
+  container.rrc_establishment_cause.value = asn1::s1ap::rrc_establishment_cause_opts::mo_sig;
+
+  enb->ues[ue.enb_ue_s1ap_id] = ue;
+  stats.started++;
+  return send_s1ap(enb, tx_pdu);
+}
+
+static void finish_attach(enb_ctx_t* enb, ue_ctx_t* ue, bool success)
+{
+  if (success) {
+    stats.completed++;
+    stats.latency_us.push_back(
+        std::chrono::duration_cast<std::chrono::microseconds>(clock_type::now() - ue->start).count());
+  } else {
+    stats.failed++;
+  }
+
+  if (success and detach) {
+    // Switch-off detach, the MME answers with a UE context release
+    LIBLTE_MME_DETACH_REQUEST_MSG_STRUCT detach_req = {};
+    detach_req.detach_type.switch_off               = LIBLTE_MME_SO_FLAG_SWITCH_OFF;
+    detach_req.detach_type.type_of_detach           = LIBLTE_MME_TOD_UL_EPS_DETACH;
+    detach_req.nas_ksi.tsc_flag                     = LIBLTE_MME_TYPE_OF_SECURITY_CONTEXT_FLAG_NATIVE;
+    detach_req.eps_mobile_id.type_of_id             = LIBLTE_MME_EPS_MOBILE_ID_TYPE_IMSI;
+    uint64_t imsi                                   = ue->imsi;
+    for (int i = 14; i >= 0; i--) {
+      detach_req.eps_mobile_id.imsi[i] = imsi % 10;
+      imsi /= 10;
+    }
+    LIBLTE_BYTE_MSG_STRUCT nas = {};
+    liblte_mme_pack_detach_request_msg(
+        &detach_req, LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY_AND_CIPHERED, ue->ul_count, &nas);
+    protect_nas(ue, &nas);
+    ue->ul_count++;
+    ue->state = UE_WAIT_RELEASE;
+    send_ul_nas(enb, ue, nas);
+  } else {
+    enb->ues.erase(ue->enb_ue_s1ap_id);
+  }
+}
+
+static void handle_dl_nas(enb_ctx_t* enb, ue_ctx_t* ue, const uint8_t* data, uint32_t len)
+{
+  LIBLTE_BYTE_MSG_STRUCT nas = {};
+  if (len > LIBLTE_MAX_MSG_SIZE_BYTES or len < 2) {
+    return;
+  }
+  memcpy(nas.msg, data, len);
+  nas.N_bytes = len;
+
+  // Decipher protected messages before looking at the message type
+  uint8_t sec_hdr_type = nas.msg[0] >> 4u;
+  if ((sec_hdr_type == LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY_AND_CIPHERED or
+       sec_hdr_type == LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY_AND_CIPHERED_WITH_NEW_EPS_SECURITY_CONTEXT) and
+      nas.N_bytes > 6) {
+    cipher_nas(ue, nas.msg[5], SECURITY_DIRECTION_DOWNLINK, &nas);
+  }
+
+  uint8_t pd       = 0;
+  uint8_t msg_type = 0;
+  liblte_mme_parse_msg_header(&nas, &pd, &msg_type);
+
+  switch (msg_type) {
+    case LIBLTE_MME_MSG_TYPE_AUTHENTICATION_REQUEST: {
+      LIBLTE_MME_AUTHENTICATION_REQUEST_MSG_STRUCT auth_req = {};
+      liblte_mme_unpack_authentication_request_msg(&nas, &auth_req);
+
+      uint8_t ck[16], ik[16], ak[6], sqn[6];
+      LIBLTE_MME_AUTHENTICATION_RESPONSE_MSG_STRUCT auth_resp = {};
+      security_milenage_f2345(k, opc, auth_req.rand, auth_resp.res, ck, ik, ak);
+      auth_resp.res_len = 8;
+      for (uint32_t i = 0; i < 6; i++) {
+        sqn[i] = auth_req.autn[i] ^ ak[i];
+      }
+      security_generate_k_asme(ck, ik, ak, sqn, mcc, mnc, ue->k_asme);
+
+      nas = {};
+      liblte_mme_pack_authentication_response_msg(&auth_resp, LIBLTE_MME_SECURITY_HDR_TYPE_PLAIN_NAS, 0, &nas);
+      ue->state = UE_WAIT_SMC;
+      send_ul_nas(enb, ue, nas);
+      break;
+    }
+    case LIBLTE_MME_MSG_TYPE_SECURITY_MODE_COMMAND: {
+      LIBLTE_MME_SECURITY_MODE_COMMAND_MSG_STRUCT sec_mode_cmd = {};
+      liblte_mme_unpack_security_mode_command_msg(&nas, &sec_mode_cmd);
+      ue->cipher_algo = (CIPHERING_ALGORITHM_ID_ENUM)sec_mode_cmd.selected_nas_sec_algs.type_of_eea;
+      ue->integ_algo  = (INTEGRITY_ALGORITHM_ID_ENUM)sec_mode_cmd.selected_nas_sec_algs.type_of_eia;
+      security_generate_k_nas(ue->k_asme, ue->cipher_algo, ue->integ_algo, ue->k_nas_enc, ue->k_nas_int);
+
+      LIBLTE_MME_SECURITY_MODE_COMPLETE_MSG_STRUCT sec_mode_comp = {};
+      ue->ul_count                                               = 0;
+      nas                                                        = {};
+      liblte_mme_pack_security_mode_complete_msg(
+          &sec_mode_comp,
+          LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY_AND_CIPHERED_WITH_NEW_EPS_SECURITY_CONTEXT,
+          ue->ul_count,
+          &nas);
+      protect_nas(ue, &nas);
+      ue->ul_count++;
+      ue->state = UE_WAIT_CTXT_SETUP;
+      send_ul_nas(enb, ue, nas);
+      break;
+    }
+    case LIBLTE_MME_MSG_TYPE_ATTACH_ACCEPT: {
+      // The default bearer is always the first one assigned by the MME
+      LIBLTE_MME_ATTACH_COMPLETE_MSG_STRUCT                            attach_comp = {};
+      LIBLTE_MME_ACTIVATE_DEFAULT_EPS_BEARER_CONTEXT_ACCEPT_MSG_STRUCT act_accept  = {};
+      act_accept.eps_bearer_id                                                     = 5;
+      act_accept.proc_transaction_id                                               = 1;
+      liblte_mme_pack_activate_default_eps_bearer_context_accept_msg(&act_accept, &attach_comp.esm_msg);
+      nas = {};
+      liblte_mme_pack_attach_complete_msg(
+          &attach_comp, LIBLTE_MME_SECURITY_HDR_TYPE_INTEGRITY_AND_CIPHERED, ue->ul_count, &nas);
+      protect_nas(ue, &nas);
+      ue->ul_count++;
+      ue->state = UE_WAIT_EMM_INFO;
+      send_ul_nas(enb, ue, nas);
+      break;
+    }
+    case LIBLTE_MME_MSG_TYPE_EMM_INFORMATION:
+      if (ue->state == UE_WAIT_EMM_INFO) {
+        finish_attach(enb, ue, true);
+      }
+      break;
+    case LIBLTE_MME_MSG_TYPE_AUTHENTICATION_REJECT:
+    case LIBLTE_MME_MSG_TYPE_ATTACH_REJECT:
+      printf("Attach of IMSI %015" PRIu64 " rejected\n", ue->imsi);
+      finish_attach(enb, ue, false);
+      break;
+    default:
+      break;
+  }
+}
+
+static ue_ctx_t* find_ue(enb_ctx_t* enb, uint32_t enb_ue_s1ap_id, uint32_t mme_ue_s1ap_id)
+{
+  auto it = enb->ues.find(enb_ue_s1ap_id);
+  if (it == enb->ues.end()) {
+    return nullptr;
+  }
+  it->second.mme_ue_s1ap_id = mme_ue_s1ap_id;
+  return &it->second;
+}
+
+static void handle_init_ctxt_setup(enb_ctx_t* enb, const init_context_setup_request_s& msg)
+{
+  ue_ctx_t* ue =
+      find_ue(enb, msg.protocol_ies.enb_ue_s1ap_id.value.value, msg.protocol_ies.mme_ue_s1ap_id.value.value);
+  if (ue == nullptr) {
+    return;
+  }
+
+  s1ap_pdu_c tx_pdu;
+  tx_pdu.set_successful_outcome().load_info_obj(ASN1_S1AP_ID_INIT_CONTEXT_SETUP);
+  init_context_setup_resp_ies_container& container =
+      tx_pdu.successful_outcome().value.init_context_setup_resp().protocol_ies;
+  container.mme_ue_s1ap_id.value = ue->mme_ue_s1ap_id;
+  container.enb_ue_s1ap_id.value = ue->enb_ue_s1ap_id;
+
+  in_addr_t addr = inet_addr(gtp_addr.c_str());
+  const erab_to_be_setup_list_ctxt_su_req_l& erabs = msg.protocol_ies.erab_to_be_setup_list_ctxt_su_req.value;
+  container.erab_setup_list_ctxt_su_res.value.resize(erabs.size());
+  for (uint32_t i = 0; i < erabs.size(); i++) {
+    const erab_to_be_setup_item_ctxt_su_req_s& req = erabs[i].value.erab_to_be_setup_item_ctxt_su_req();
+    container.erab_setup_list_ctxt_su_res.value[i].load_info_obj(ASN1_S1AP_ID_ERAB_SETUP_ITEM_CTXT_SU_RES);
+    erab_setup_item_ctxt_su_res_s& item =
+        container.erab_setup_list_ctxt_su_res.value[i].value.erab_setup_item_ctxt_su_res();
+    item.erab_id = req.erab_id;
+    item.transport_layer_address.resize(32);
+    item.transport_layer_address.from_number(ntohl(addr));
+    item.gtp_teid.from_number(ue->enb_ue_s1ap_id);
+  }
+  if (not send_s1ap(enb, tx_pdu)) {
+    return;
+  }
+
+  // The Attach Accept travels inside the E-RAB setup
+  if (erabs.size() > 0 and erabs[0].value.erab_to_be_setup_item_ctxt_su_req().nas_pdu_present) {
+    const asn1::unbounded_octstring<true>& nas_pdu = erabs[0].value.erab_to_be_setup_item_ctxt_su_req().nas_pdu;
+    handle_dl_nas(enb, ue, nas_pdu.data(), nas_pdu.size());
+  }
+}
+
+static void handle_ue_ctxt_release(enb_ctx_t* enb, const ue_context_release_cmd_s& msg)
+{
+  const ue_s1ap_ids_c& ids = msg.protocol_ies.ue_s1ap_ids.value;
+  ue_ctx_t*            ue  = nullptr;
+  if (ids.type().value == ue_s1ap_ids_c::types_opts::ue_s1ap_id_pair) {
+    ue = find_ue(enb, ids.ue_s1ap_id_pair().enb_ue_s1ap_id, ids.ue_s1ap_id_pair().mme_ue_s1ap_id);
+  } else {
+    for (auto& it : enb->ues) {
+      if (it.second.mme_ue_s1ap_id == ids.mme_ue_s1ap_id()) {
+        ue = &it.second;
+        break;
+      }
+    }
+  }
+  if (ue == nullptr) {
+    return;
+  }
+
+  s1ap_pdu_c tx_pdu;
+  tx_pdu.set_successful_outcome().load_info_obj(ASN1_S1AP_ID_UE_CONTEXT_RELEASE);
+  auto& container                = tx_pdu.successful_outcome().value.ue_context_release_complete().protocol_ies;
+  container.enb_ue_s1ap_id.value = ue->enb_ue_s1ap_id;
+  container.mme_ue_s1ap_id.value = ue->mme_ue_s1ap_id;
+  send_s1ap(enb, tx_pdu);
+
+  if (ue->state == UE_WAIT_RELEASE) {
+    stats.released++;
+  } else {
+    stats.failed++;
+  }
+  enb->ues.erase(ue->enb_ue_s1ap_id);
+}
+
+static void handle_s1ap_rx(enb_ctx_t* enb, const uint8_t* data, uint32_t len)
+{
+  s1ap_pdu_c     rx_pdu;
+  asn1::cbit_ref bref(data, len);
+  if (rx_pdu.unpack(bref) != asn1::SRSASN_SUCCESS) {
+    printf("Error unpacking S1AP PDU received by eNB %d\n", enb->enb_id);
+    return;
+  }
+
+  switch (rx_pdu.type().value) {
+    case s1ap_pdu_c::types_opts::init_msg: {
+      const init_msg_s& msg = rx_pdu.init_msg();
+      switch (msg.value.type().value) {
+        case s1ap_elem_procs_o::init_msg_c::types_opts::dl_nas_transport: {
+          const dl_nas_transport_ies_container& c = msg.value.dl_nas_transport().protocol_ies;
+          ue_ctx_t* ue = find_ue(enb, c.enb_ue_s1ap_id.value.value, c.mme_ue_s1ap_id.value.value);
+          if (ue != nullptr) {
+            handle_dl_nas(enb, ue, c.nas_pdu.value.data(), c.nas_pdu.value.size());
+          }
+          break;
+        }
+        case s1ap_elem_procs_o::init_msg_c::types_opts::init_context_setup_request:
+          handle_init_ctxt_setup(enb, msg.value.init_context_setup_request());
+          break;
+        case s1ap_elem_procs_o::init_msg_c::types_opts::ue_context_release_cmd:
+          handle_ue_ctxt_release(enb, msg.value.ue_context_release_cmd());
+          break;
+        default:
+          break;
+      }
+      break;
+    }
+    case s1ap_pdu_c::types_opts::successful_outcome:
+      if (rx_pdu.successful_outcome().value.type().value ==
+          s1ap_elem_procs_o::successful_outcome_c::types_opts::s1_setup_resp) {
+        enb->setup_done = true;
+      }
+      break;
+    case s1ap_pdu_c::types_opts::unsuccessful_outcome:
+      printf("eNB %d received unsuccessful outcome %s\n",
+             enb->enb_id,
+             rx_pdu.unsuccessful_outcome().value.type().to_string().c_str());
+      break;
+    default:
+      break;
+  }
+}
+
+/* Writes the emulated UEs in the HSS user database format */
+static int write_user_db()
+{
+  FILE* f = fopen(db_file.c_str(), "w");
+  if (f == nullptr) {
+    printf("Error opening %s: %s\n", db_file.c_str(), strerror(errno));
+    return SRSLTE_ERROR;
+  }
+  fprintf(f, "# Generated by attach_storm: %d UEs from IMSI %015" PRIu64 "\n", nof_ues, first_imsi);
+  for (uint32_t i = 0; i < nof_ues; i++) {
+    fprintf(f,
+            "storm%d,mil,%015" PRIu64 ",00112233445566778899aabbccddeeff,opc,63bfa50ee6523365ff14c1f45f88737d,"
+            "8000,000000000000,9,dynamic\n",
+            i,
+            first_imsi + i);
+  }
+  fclose(f);
+  printf("Wrote %d UEs to %s\n", nof_ues, db_file.c_str());
+  return SRSLTE_SUCCESS;
+}
+
+static uint32_t percentile(std::vector<uint32_t>& v, float p)
+{
+  if (v.empty()) {
+    return 0;
+  }
+  size_t n = std::min(v.size() - 1, (size_t)(p * v.size()));
+  std::nth_element(v.begin(), v.begin() + n, v.end());
+  return v[n];
+}
+
+int main(int argc, char** argv)
+{
+  parse_args(argc, argv);
+
+  if (not db_file.empty()) {
+    return write_user_db();
+  }
+
+  int epoll_fd = epoll_create1(0);
+  if (epoll_fd == -1) {
+    perror("epoll_create1");
+    return SRSLTE_ERROR;
+  }
+
+  // Connect the eNBs and run S1 Setup
+  std::vector<enb_ctx_t> enbs(nof_enbs);
+  for (uint32_t i = 0; i < nof_enbs; i++) {
+    enb_ctx_t& enb          = enbs[i];
+    enb.enb_id              = 0x100 + i;
+    enb.setup_done          = false;
+    enb.next_enb_ue_s1ap_id = 1;
+    if (not net_utils::sctp_init_client(&enb.socket, net_utils::socket_type::seqpacket, bind_addr.c_str()) or
+        not enb.socket.connect_to(mme_addr.c_str(), 36412, &enb.mme_sockaddr)) {
+      printf("Error connecting eNB %d to MME %s\n", enb.enb_id, mme_addr.c_str());
+      return SRSLTE_ERROR;
+    }
+    struct epoll_event ev = {};
+    ev.events             = EPOLLIN;
+    ev.data.u32           = i;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, enb.socket.fd(), &ev);
+    send_s1_setup(&enb);
+  }
+
+  clock_type::time_point deadline    = clock_type::now() + std::chrono::seconds(timeout_s);
+  clock_type::time_point storm_start = {};
+  bool                   storming    = false;
+  uint64_t               next_imsi   = first_imsi;
+  uint32_t               next_enb    = 0;
+  uint8_t                buf[SRSLTE_MAX_BUFFER_SIZE_BYTES];
+  struct epoll_event     events[MAX_EPOLL_EVENTS];
+
+  while (clock_type::now() < deadline) {
+    if (not storming) {
+      storming = std::all_of(enbs.begin(), enbs.end(), [](const enb_ctx_t& e) { return e.setup_done; });
+      if (storming) {
+        printf("%d eNBs set up, starting %d attaches with %d in flight\n", nof_enbs, nof_ues, concurrency);
+        storm_start = clock_type::now();
+      }
+    }
+
+    // Keep the number of attaches in flight
+    if (storming) {
+      while (stats.started < nof_ues and stats.started - stats.completed - stats.failed < concurrency) {
+        start_attach(&enbs[next_enb], next_imsi++);
+        next_enb = (next_enb + 1) % nof_enbs;
+      }
+      uint32_t pending = 0;
+      for (const enb_ctx_t& e : enbs) {
+        pending += e.ues.size();
+      }
+      if (stats.started == nof_ues and pending == 0) {
+        break;
+      }
+    }
+
+    int n = epoll_wait(epoll_fd, events, MAX_EPOLL_EVENTS, 100);
+    for (int i = 0; i < n; i++) {
+      enb_ctx_t&             enb       = enbs[events[i].data.u32];
+      struct sctp_sndrcvinfo sri       = {};
+      int                    msg_flags = 0;
+      ssize_t rd_sz = sctp_recvmsg(enb.socket.fd(), buf, sizeof(buf), nullptr, nullptr, &sri, &msg_flags);
+      if (rd_sz <= 0) {
+        printf("eNB %d lost the connection to the MME\n", enb.enb_id);
+        return SRSLTE_ERROR;
+      }
+      if (not(msg_flags & MSG_NOTIFICATION)) {
+        handle_s1ap_rx(&enb, buf, rd_sz);
+      }
+    }
+  }
+  close(epoll_fd);
+
+  double elapsed = std::chrono::duration<double>(clock_type::now() - storm_start).count();
+  if (not storming) {
+    printf("S1 Setup did not complete\n");
+    return SRSLTE_ERROR;
+  }
+  printf("Attaches: %d started, %d completed, %d failed, %d detached in %.2f s\n",
+         stats.started,
+         stats.completed,
+         stats.failed,
+         stats.released,
+         elapsed);
+  printf("Attach rate: %.1f attaches/s\n", stats.completed / elapsed);
+  printf("Attach latency: p50 %.2f ms, p90 %.2f ms, p99 %.2f ms, max %.2f ms\n",
+         percentile(stats.latency_us, 0.5f) / 1000.0,
+         percentile(stats.latency_us, 0.9f) / 1000.0,
+         percentile(stats.latency_us, 0.99f) / 1000.0,
+         percentile(stats.latency_us, 1.0f) / 1000.0);
+
+  return stats.completed == nof_ues ? SRSLTE_SUCCESS : SRSLTE_ERROR;
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/*
+ * HSS subscriber database benchmark: time to import the CSV user database into the binary store, time to load the
+ * store on later starts, and authentication vector generation rate for MILENAGE and XOR subscribers, one vector per
+ * request and batches of vectors per request.
+ */
+
+#include "srsepc/hdr/hss/hss.h"
+#include "srslte/common/test_common.h"
+#include <chrono>
+#include <inttypes.h>
+#include <unistd.h>
+
+using namespace srsepc;
+
+#define DB_FILE "hss_benchmark_db.csv"
+#define STORE_FILE "hss_benchmark_db.bin"
+#define FIRST_IMSI UINT64_C(1010000000000)
+
+static uint32_t nof_ues          = 10000;
+static uint32_t nof_auth_vectors = 100000;
+static uint32_t batch_size       = 8;
+
+typedef std::chrono::high_resolution_clock bench_clock;
+
+static void usage(char* prog)
+{
+  printf("Usage: %s [nub]\n", prog);
+  printf("\t-u Number of subscribers [Default %d]\n", nof_ues);
+  printf("\t-n Number of authentication vectors per algorithm [Default %d]\n", nof_auth_vectors);
+  printf("\t-b Number of authentication vectors per batched request [Default %d]\n", batch_size);
+}
+
+static void parse_args(int argc, char** argv)
+{
+  int opt;
+  while ((opt = getopt(argc, argv, "u:n:b:")) != -1) {
+    switch (opt) {
+      case 'u':
+        nof_ues = (uint32_t)strtol(optarg, NULL, 10);
+        break;
+      case 'n':
+        nof_auth_vectors = (uint32_t)strtol(optarg, NULL, 10);
+        break;
+      case 'b':
+        batch_size = (uint32_t)strtol(optarg, NULL, 10);
+        break;
+      default:
+        usage(argv[0]);
+        exit(-1);
+    }
+  }
+}
+
+static double elapsed_ms(bench_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(bench_clock::now() - start).count();
+}
+
+/* Even IMSIs use MILENAGE, odd ones XOR */
+static int write_db_file()
+{
+  FILE* f = fopen(DB_FILE, "w");
+  TESTASSERT(f != nullptr);
+  for (uint32_t i = 0; i < nof_ues; i++) {
+    fprintf(f,
+            "ue%d,%s,%015" PRIu64 ",00112233445566778899aabbccddeeff,opc,63bfa50ee6523365ff14c1f45f88737d,8000,"
+            "000000001234,7,dynamic\n",
+            i,
+            i % 2 ? "xor" : "mil",
+            FIRST_IMSI + i);
+  }
+  fclose(f);
+  return SRSLTE_SUCCESS;
+}
+
+static void print_rate(const char* name, bench_clock::time_point start)
+{
+  double ms = elapsed_ms(start);
+  printf("  %-18s %10.0f vectors/s %8.2f us/vector\n",
+         name,
+         nof_auth_vectors / ms * 1000,
+         ms * 1000 / nof_auth_vectors);
+}
+
+static uint64_t bench_imsi(uint32_t i, uint32_t parity)
+{
+  return FIRST_IMSI + (((uint64_t)i * 7919) % (nof_ues / 2)) * 2 + parity;
+}
+
+static int bench_auth_vectors(hss* h, uint32_t parity, const char* name)
+{
+  uint8_t k_asme[32], autn[16], rand[16], xres[16];
+  char    label[32];
+
+  bench_clock::time_point start = bench_clock::now();
+  for (uint32_t i = 0; i < nof_auth_vectors; i++) {
+    TESTASSERT(h->gen_auth_info_answer(bench_imsi(i, parity), k_asme, autn, rand, xres));
+  }
+  print_rate(name, start);
+
+  std::vector<auth_vector_t> vectors(batch_size);
+  snprintf(label, sizeof(label), "%s x%d", name, batch_size);
+  start = bench_clock::now();
+  for (uint32_t i = 0; i < nof_auth_vectors; i += batch_size) {
+    TESTASSERT(h->gen_auth_vectors(bench_imsi(i / batch_size, parity), vectors.data(), batch_size));
+  }
+  print_rate(label, start);
+  return SRSLTE_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  parse_args(argc, argv);
+  TESTASSERT(nof_ues >= 2 && batch_size > 0);
+
+  srslte::log_filter log("HSS ");
+  log.set_level(srslte::LOG_LEVEL_ERROR);
+
+  hss_args_t args        = {};
+  args.db_file           = DB_FILE;
+  args.db_store          = STORE_FILE;
+  args.db_sync_period_ms = 1000;
+  args.mcc               = 0xf001;
+  args.mnc               = 0xff01;
+
+  unlink(STORE_FILE);
+  TESTASSERT(write_db_file() == SRSLTE_SUCCESS);
+
+  // First start imports the CSV
+  bench_clock::time_point start = bench_clock::now();
+  hss*                    h     = hss::get_instance();
+  TESTASSERT(h->init(&args, &log) == 0);
+  printf("%d subscribers\n", nof_ues);
+  printf("  CSV import %10.2f ms\n", elapsed_ms(start));
+  h->stop();
+  hss::cleanup();
+
+  // Later starts map the store
+  start = bench_clock::now();
+  h     = hss::get_instance();
+  TESTASSERT(h->init(&args, &log) == 0);
+  printf("  Store load %10.2f ms\n", elapsed_ms(start));
+
+  printf("Authentication vector generation\n");
+  TESTASSERT(bench_auth_vectors(h, 0, "MILENAGE") == SRSLTE_SUCCESS);
+  TESTASSERT(bench_auth_vectors(h, 1, "XOR") == SRSLTE_SUCCESS);
+
+  // SQNs advanced in place, without waiting for the CSV export
+  {
+    hss_store store;
+    TESTASSERT(store.open(STORE_FILE));
+    TESTASSERT(store.size() == nof_ues);
+    const hss_ue_ctx_t* ue_ctx = store.find(FIRST_IMSI);
+    TESTASSERT(ue_ctx != nullptr);
+    uint8_t initial_sqn[6] = {0x00, 0x00, 0x00, 0x00, 0x12, 0x34};
+    TESTASSERT(memcmp(ue_ctx->sqn, initial_sqn, 6) > 0);
+  }
+  h->stop();
+  hss::cleanup();
+
+  unlink(DB_FILE);
+  unlink(STORE_FILE);
+  printf("Success\n");
+  return SRSLTE_SUCCESS;
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsepc/hdr/hss/hss_store.h"
+#include "srslte/common/test_common.h"
+#include <unistd.h>
+
+using namespace srsepc;
+
+#define STORE_FILE "hss_store_test.bin"
+
+int test_anonymous_store()
+{
+  hss_store store;
+  TESTASSERT(store.create("", 100));
+  TESTASSERT(store.capacity() >= 200);
+  TESTASSERT(store.size() == 0);
+  TESTASSERT(store.find(1010123456789) == nullptr);
+  TESTASSERT(store.insert(0) == nullptr);
+
+  for (uint64_t imsi = 1010000000001; imsi <= 1010000000100; imsi++) {
+    hss_ue_ctx_t* ue_ctx = store.insert(imsi);
+    TESTASSERT(ue_ctx != nullptr and ue_ctx->imsi == imsi);
+    ue_ctx->qci = imsi % 10;
+  }
+  TESTASSERT(store.size() == 100);
+  // Inserting again returns the existing record
+  TESTASSERT(store.insert(1010000000050)->qci == 0);
+  TESTASSERT(store.size() == 100);
+
+  for (uint64_t imsi = 1010000000001; imsi <= 1010000000100; imsi++) {
+    TESTASSERT(store.find(imsi) != nullptr and store.find(imsi)->qci == imsi % 10);
+  }
+  TESTASSERT(store.find(1010000000101) == nullptr);
+
+  uint32_t count = 0;
+  store.for_each([&count](hss_ue_ctx_t& ue_ctx) { count++; });
+  TESTASSERT(count == 100);
+
+  // Nothing to flush nor rename without a file
+  TESTASSERT(store.sync());
+  TESTASSERT(not store.rename(STORE_FILE));
+  return SRSLTE_SUCCESS;
+}
+
+int test_file_store()
+{
+  uint8_t sqn[6] = {0x00, 0x00, 0x00, 0x00, 0x12, 0x34};
+
+  unlink(STORE_FILE);
+  {
+    hss_store store;
+    TESTASSERT(not store.open(STORE_FILE));
+    TESTASSERT(store.create(STORE_FILE, 10));
+    hss_ue_ctx_t* ue_ctx = store.insert(1010123456789);
+    TESTASSERT(ue_ctx != nullptr);
+    strcpy(ue_ctx->name, "ue1");
+    ue_ctx->set_sqn(sqn);
+    store.set_csv_stamp(1234, 5678);
+    store.set_sync_period_ms(0);
+    store.written(ue_ctx);
+  }
+
+  // In-place updates are found after reopening
+  {
+    hss_store store;
+    TESTASSERT(store.open(STORE_FILE));
+    TESTASSERT(store.size() == 1);
+    TESTASSERT(store.csv_stamp_matches(1234, 5678));
+    TESTASSERT(not store.csv_stamp_matches(1234, 5679));
+    hss_ue_ctx_t* ue_ctx = store.find(1010123456789);
+    TESTASSERT(ue_ctx != nullptr);
+    TESTASSERT(strcmp(ue_ctx->name, "ue1") == 0);
+    TESTASSERT(memcmp(ue_ctx->sqn, sqn, 6) == 0);
+    sqn[5]++;
+    ue_ctx->set_sqn(sqn);
+  }
+  {
+    hss_store store;
+    TESTASSERT(store.open(STORE_FILE));
+    TESTASSERT(memcmp(store.find(1010123456789)->sqn, sqn, 6) == 0);
+  }
+
+  // Files that are not a store, or are truncated, are refused
+  TESTASSERT(truncate(STORE_FILE, 100) == 0);
+  {
+    hss_store store;
+    TESTASSERT(not store.open(STORE_FILE));
+  }
+  unlink(STORE_FILE);
+  return SRSLTE_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  TESTASSERT(test_anonymous_store() == SRSLTE_SUCCESS);
+  TESTASSERT(test_file_store() == SRSLTE_SUCCESS);
+
+  printf("Success\n");
+  return SRSLTE_SUCCESS;
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsepc/hdr/mme/mme_auth_cache.h"
+#include "srslte/common/log_filter.h"
+#include "srslte/common/test_common.h"
+
+using namespace srsepc;
+
+// Numbers the vectors it generates through RAND[0], per IMSI, like consecutive SQNs
+class hss_dummy : public hss_interface_nas
+{
+public:
+  bool gen_auth_info_answer(uint64_t imsi, uint8_t* k_asme, uint8_t* autn, uint8_t* rand, uint8_t* xres)
+  {
+    auth_vector_t v;
+    if (not gen_auth_vectors(imsi, &v, 1)) {
+      return false;
+    }
+    memcpy(rand, v.rand, sizeof(v.rand));
+    return true;
+  }
+  bool gen_auth_vectors(uint64_t imsi, auth_vector_t* vectors, uint32_t nof_vectors)
+  {
+    nof_requests++;
+    if (imsi == 0) {
+      return false;
+    }
+    for (uint32_t i = 0; i < nof_vectors; i++) {
+      vectors[i]         = {};
+      vectors[i].rand[0] = next_seq[imsi]++;
+    }
+    return true;
+  }
+  bool gen_update_loc_answer(uint64_t imsi, uint8_t* qci) { return true; }
+  bool resync_sqn(uint64_t imsi, uint8_t* rand, uint8_t* auts)
+  {
+    nof_resyncs++;
+    return true;
+  }
+
+  uint32_t                              nof_requests = 0;
+  uint32_t                              nof_resyncs  = 0;
+  std::unordered_map<uint64_t, uint8_t> next_seq;
+};
+
+static uint8_t next_rand(mme_auth_cache& cache, uint64_t imsi)
+{
+  uint8_t k_asme[32], autn[16], rand[16], xres[16];
+  TESTASSERT(cache.gen_auth_info_answer(imsi, k_asme, autn, rand, xres));
+  return rand[0];
+}
+
+int test_batching()
+{
+  srslte::log_filter log("MME ");
+  hss_dummy          hss;
+  mme_auth_cache     cache;
+  cache.init(&hss, 4, &log);
+
+  // One HSS request per 4 authentications, vectors handed out in order and per UE
+  for (uint8_t seq = 0; seq < 6; seq++) {
+    TESTASSERT(next_rand(cache, 1) == seq);
+  }
+  TESTASSERT(next_rand(cache, 2) == 0);
+  TESTASSERT(hss.nof_requests == 3);
+  TESTASSERT(cache.nof_cached(1) == 2);
+  TESTASSERT(cache.nof_cached(2) == 3);
+
+  // After a re-synchronization the cached vectors are stale
+  uint8_t rand[16] = {}, auts[14] = {};
+  TESTASSERT(cache.resync_sqn(1, rand, auts));
+  TESTASSERT(hss.nof_resyncs == 1);
+  TESTASSERT(cache.nof_cached(1) == 0);
+  TESTASSERT(next_rand(cache, 1) == 8);
+  TESTASSERT(hss.nof_requests == 4);
+
+  // Unknown subscriber
+  uint8_t k_asme[32], autn[16], xres[16];
+  TESTASSERT(not cache.gen_auth_info_answer(0, k_asme, autn, rand, xres));
+  TESTASSERT(cache.nof_cached(0) == 0);
+
+  return SRSLTE_SUCCESS;
+}
+
+int test_disabled()
+{
+  srslte::log_filter log("MME ");
+  hss_dummy          hss;
+  mme_auth_cache     cache;
+  cache.init(&hss, 1, &log);
+
+  for (uint8_t seq = 0; seq < 3; seq++) {
+    TESTASSERT(next_rand(cache, 1) == seq);
+  }
+  TESTASSERT(hss.nof_requests == 3);
+  TESTASSERT(cache.nof_cached(1) == 0);
+
+  return SRSLTE_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  TESTASSERT(test_batching() == SRSLTE_SUCCESS);
+  TESTASSERT(test_disabled() == SRSLTE_SUCCESS);
+
+  printf("Success\n");
+  return SRSLTE_SUCCESS;
+}
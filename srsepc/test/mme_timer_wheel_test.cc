@@ -0,0 +1,110 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsepc/hdr/mme/mme_timer_wheel.h"
+#include "srslte/common/test_common.h"
+
+using namespace srsepc;
+
+typedef mme_timer_wheel::clock clock_t_;
+
+static clock_t_::time_point at_ms(clock_t_::time_point t0, uint32_t ms)
+{
+  return t0 + std::chrono::milliseconds(ms);
+}
+
+int test_expiry_order()
+{
+  mme_timer_wheel      wheel(10, 16);
+  clock_t_::time_point t0 = clock_t_::now();
+  wheel.reset(t0);
+
+  TESTASSERT(wheel.time_to_next_tick_ms(t0) == -1);
+  TESTASSERT(wheel.add(T_3413, 1, 50, t0));
+  TESTASSERT(wheel.add(T_3413, 2, 20, t0));
+  // Longer than one turn of the wheel (160 ms)
+  TESTASSERT(wheel.add(T_3413, 3, 500, t0));
+  TESTASSERT(not wheel.add(T_3413, 2, 100, t0));
+  TESTASSERT(wheel.size() == 3);
+  TESTASSERT(wheel.is_running(T_3413, 3));
+  TESTASSERT(not wheel.is_running(T_3413, 4));
+  TESTASSERT(wheel.time_to_next_tick_ms(t0) == 10);
+
+  std::vector<mme_timer_t> expired;
+  wheel.advance(at_ms(t0, 19), &expired);
+  TESTASSERT(expired.empty());
+  wheel.advance(at_ms(t0, 20), &expired);
+  TESTASSERT(expired.size() == 1 and expired[0].imsi == 2);
+
+  // A late advance collects everything that expired meanwhile, in expiry order
+  expired.clear();
+  wheel.advance(at_ms(t0, 499), &expired);
+  TESTASSERT(expired.size() == 1 and expired[0].imsi == 1);
+  wheel.advance(at_ms(t0, 500), &expired);
+  TESTASSERT(expired.size() == 2 and expired[1].imsi == 3 and expired[1].type == T_3413);
+  TESTASSERT(wheel.size() == 0);
+  TESTASSERT(wheel.time_to_next_tick_ms(at_ms(t0, 500)) == -1);
+
+  return SRSLTE_SUCCESS;
+}
+
+int test_remove_and_restart()
+{
+  mme_timer_wheel      wheel(10, 8);
+  clock_t_::time_point t0 = clock_t_::now();
+  wheel.reset(t0);
+
+  TESTASSERT(wheel.add(T_3413, 7, 30, t0));
+  TESTASSERT(wheel.remove(T_3413, 7));
+  TESTASSERT(not wheel.remove(T_3413, 7));
+  TESTASSERT(not wheel.is_running(T_3413, 7));
+
+  // Restarted while the wheel lags behind: the timeout counts from the new start time
+  TESTASSERT(wheel.add(T_3413, 7, 30, at_ms(t0, 100)));
+  std::vector<mme_timer_t> expired;
+  wheel.advance(at_ms(t0, 129), &expired);
+  TESTASSERT(expired.empty());
+  wheel.advance(at_ms(t0, 130), &expired);
+  TESTASSERT(expired.size() == 1 and expired[0].imsi == 7);
+
+  // Many timers sharing slots
+  for (uint64_t imsi = 0; imsi < 1000; imsi++) {
+    TESTASSERT(wheel.add(T_3413, imsi, 10 * (imsi % 40 + 1), at_ms(t0, 130)));
+  }
+  expired.clear();
+  for (uint32_t ms = 130; ms <= 530; ms += 10) {
+    size_t before = expired.size();
+    wheel.advance(at_ms(t0, ms), &expired);
+    TESTASSERT(expired.size() - before == (ms == 130 ? 0 : 25));
+  }
+  TESTASSERT(expired.size() == 1000 and wheel.size() == 0);
+
+  return SRSLTE_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  TESTASSERT(test_expiry_order() == SRSLTE_SUCCESS);
+  TESTASSERT(test_remove_and_restart() == SRSLTE_SUCCESS);
+
+  printf("Success\n");
+  return SRSLTE_SUCCESS;
+}
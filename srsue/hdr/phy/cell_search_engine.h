@@ -0,0 +1,168 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#ifndef SRSUE_CELL_SEARCH_ENGINE_H
+#define SRSUE_CELL_SEARCH_ENGINE_H
+
+#include "srslte/common/log.h"
+#include "srslte/common/thread_pool.h"
+#include "srslte/phy/resampling/channelizer.h"
+#include "srslte/srslte.h"
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace srsue {
+
+/**
+ * Parallel PSS/SSS cell search engine.
+ *
+ * A search takes one capture per EARFCN sampled at 1.92 MHz, or a single wideband capture which is channelized into
+ * every EARFCN it contains, and runs the following stages on a pool of worker threads:
+ *  - channelization (wideband only) and overlap-save FFT of the capture, once per EARFCN;
+ *  - PSS correlation of every N_id_2 hypothesis against the shared FFT, one task per (EARFCN, N_id_2);
+ *  - CFO correction, CP and frame type detection and SSS decoding of every PSS peak above the PSR threshold.
+ *
+ * All the hypotheses are evaluated over the same samples, so the capture time does not grow with the number of
+ * hypotheses or EARFCNs. The report includes the time elapsed until the first cell was confirmed.
+ */
+class cell_search_engine
+{
+public:
+  struct args_t {
+    uint32_t nof_workers    = 2;    // Worker threads, 0 runs all the stages in the caller thread
+    int32_t  worker_prio    = -1;   // Worker thread priority, -1 for default
+    uint32_t max_capture_ms = 40;   // Longest capture per EARFCN
+    uint32_t max_channels   = 8;    // Most EARFCNs searched in parallel
+    float    psr_threshold  = 2.0f; // Minimum PSS peak to side-lobe ratio to attempt the SSS detection
+  };
+
+  struct cell_t {
+    uint32_t            earfcn;
+    uint32_t            pci;
+    srslte_cp_t         cp;
+    srslte_frame_type_t frame_type;
+    uint32_t            peak_pos; // PSS symbol position within the half-frame, in 1.92 MHz samples
+    float               peak;
+    float               psr;
+    float               cfo_hz;
+    float               mode;      // Fraction of PSS occurrences agreeing in the detected PCI
+    uint64_t            detect_us; // Time since the search started until this cell was confirmed
+  };
+
+  struct report_t {
+    std::vector<cell_t> cells;         // Detected cells, strongest first
+    uint32_t            nof_channels  = 0;
+    uint64_t            first_cell_us = 0; // Time to first cell, 0 if no cell was found
+    uint64_t            total_us      = 0;
+  };
+
+  cell_search_engine() = default;
+  ~cell_search_engine();
+
+  bool init(const args_t& args_, srslte::log* log_h_);
+  void stop();
+
+  /**
+   * Searches cells in a single EARFCN
+   * @param earfcn EARFCN the capture was taken from, only used for reporting
+   * @param samples Baseband samples at 1.92 MHz centered at the EARFCN carrier
+   * @param nof_samples Number of samples, up to max_capture_ms
+   * @param report Detected cells and timing
+   * @return true if the search could be run
+   */
+  bool search(uint32_t earfcn, const cf_t* samples, uint32_t nof_samples, report_t* report);
+
+  /**
+   * Channelizes a wideband capture and searches cells in all the EARFCNs it covers
+   * @param samples Baseband samples at srate_hz centered at center_freq_hz
+   * @param srate_hz Capture sampling rate, it must be an integer multiple of 1.92 MHz
+   * @param earfcns EARFCNs to search, all of them must be inside the captured band
+   * @return true if the search could be run
+   */
+  bool search_wideband(const cf_t*                  samples,
+                       uint32_t                     nof_samples,
+                       double                       srate_hz,
+                       double                       center_freq_hz,
+                       const std::vector<uint32_t>& earfcns,
+                       report_t*                    report);
+
+  /**
+   * Selects the EARFCNs of a list that can be searched from a single capture starting with earfcn_list[start_idx]
+   * @param center_freq_hz Returns the frequency the capture must be centered at
+   */
+  static std::vector<uint32_t> group_earfcns(const std::vector<uint32_t>& earfcn_list,
+                                             uint32_t                     start_idx,
+                                             double                       srate_hz,
+                                             double*                      center_freq_hz);
+
+private:
+  const static uint32_t SRATE_CS   = 1920000;
+  const static uint32_t SAMPLES_MS = SRATE_CS / 1000;
+
+  struct channel_t {
+    uint32_t             earfcn      = 0;
+    float                offset      = 0.0f; // Normalized to the wideband sampling rate
+    const cf_t*          samples     = nullptr;
+    uint32_t             nof_samples = 0;
+    cf_t*                baseband    = nullptr;
+    srslte_channelizer_t channelizer = {};
+    srslte_pss_search_t  pss         = {};
+  };
+
+  struct worker_t {
+    srslte_sss_t sss    = {};
+    cf_t*        window = nullptr;
+  };
+
+  void run_task(const std::function<void(uint32_t)>& task);
+  bool run(uint32_t nof_channels, report_t* report);
+  void prepare_channel(channel_t* ch);
+  void search_hypothesis(uint32_t worker_id, channel_t* ch, uint32_t N_id_2);
+  bool detect_cell(worker_t* w, const channel_t* ch, const srslte_pss_search_result_t& pss, cell_t* cell);
+  bool set_ratio(uint32_t ratio);
+
+  args_t                                    args        = {};
+  srslte::log*                              log_h       = nullptr;
+  std::unique_ptr<srslte::task_thread_pool> pool        = nullptr;
+  std::vector<std::unique_ptr<channel_t>>   channels    = {};
+  std::vector<std::unique_ptr<worker_t>>    workers     = {};
+  uint32_t                                  max_samples = 0;
+
+  // Wideband capture, read concurrently by the channel tasks
+  const cf_t* wb_samples     = nullptr;
+  uint32_t    wb_nof_samples = 0;
+  uint32_t    ratio          = 0;
+
+  // Current search, protected by mutex
+  std::mutex                            mutex;
+  std::condition_variable               cvar;
+  uint32_t                              pending        = 0;
+  report_t*                             current_report = nullptr;
+  std::chrono::steady_clock::time_point t_start        = {};
+};
+
+} // namespace srsue
+
+#endif // SRSUE_CELL_SEARCH_ENGINE_H
@@ -22,11 +22,16 @@
 #define SRSUE_INTRA_MEASURE_H
 
 #include <srslte/common/log.h>
+#include <srslte/common/thread_pool.h>
 #include <srslte/common/threads.h>
 #include <srslte/common/tti_sync_cv.h>
 #include <srslte/srslte.h>
 
 #include "scell_recv.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
 
 namespace srsue {
 namespace scell {
@@ -189,6 +194,23 @@ private:
    */
   void measure_proc();
 
+  /**
+   * Runs a batch of tasks on the measurement workers and waits for all of them to finish. Each task receives the
+   * index of the worker running it. Without workers the tasks run in the calling thread.
+   */
+  void run_tasks(const std::vector<std::function<void(uint32_t)> >& tasks);
+
+  /**
+   * Measures a single PCI in the samples of search_buffer, reusing the shared subframe FFTs
+   */
+  void measure_pci(uint32_t worker_idx, uint32_t pci, rrc_interface_phy_lte::phy_meas_t* meas, bool* found);
+
+  /**
+   * Discards the samples written in the ring buffer before the start of the current window. Only called by the
+   * measurement thread, the ring buffer is never reset while in use
+   */
+  void drain_ring_buffer();
+
   /**
    * Internal asynchronous low priority thread, waits for measure internal state to execute the measurement process. It
    * stops when the internal state transitions to quit.
@@ -215,10 +237,23 @@ private:
 
   cf_t* search_buffer = nullptr;
 
-  uint32_t            receive_cnt = 0;
-  srslte_ringbuffer_t ring_buffer = {};
+  uint32_t                 receive_cnt = 0;
+  srslte_spsc_ringbuffer_t ring_buffer = {};
+
+  // Byte counts of the ring buffer. The window start is the number of bytes written when the current window started
+  std::atomic<uint64_t> ring_write_bytes  = {0}; // Only updated by write()
+  std::atomic<uint64_t> ring_window_start = {0}; // Only updated by write()
+  uint64_t              ring_read_bytes   = 0;   // Only updated by the measurement thread
 
-  srslte_refsignal_dl_sync_t refsignal_dl_sync = {};
+  // Measurement workers, each task gets the reference signal correlator of the worker running it
+  std::unique_ptr<srslte::task_thread_pool> meas_pool               = nullptr;
+  uint32_t                                  nof_meas_threads        = 0;
+  std::vector<srslte_refsignal_dl_sync_t>   refsignal_dl_sync       = {};
+  srslte_refsignal_dl_sync_input_t          refsignal_dl_sync_input = {};
+  scell_recv                                scell_aux               = {}; // Searches the second N_id_2 in parallel
+  std::mutex                                tasks_mutex;
+  std::condition_variable                   tasks_cvar;
+  uint32_t                                  tasks_pending = 0;
 };
 
 } // namespace scell
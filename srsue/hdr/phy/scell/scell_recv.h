@@ -38,6 +38,13 @@ public:
   void reset();
   std::set<uint32_t> find_cells(const cf_t* input_buffer, const srslte_cell_t serving_cell, const uint32_t nof_sf);
 
+  /**
+   * Searches only the cells with the given N_id_2, so several scell_recv objects can search the hypotheses in parallel
+   * @return The detected PCI or -1 if none was found
+   */
+  int
+  find_cell_N_id_2(const cf_t* input_buffer, const srslte_cell_t serving_cell, const uint32_t nof_sf, uint32_t n_id_2);
+
 private:
   // 36.133 9.1.2.1 for band 7
   constexpr static float ABSOLUTE_RSRP_THRESHOLD_DBM = -125;
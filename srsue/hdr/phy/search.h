@@ -23,8 +23,12 @@
 #define SRSUE_SEARCH_H
 
 #include "srslte/interfaces/ue_interfaces.h"
+#include "srsue/hdr/phy/cell_search_engine.h"
 #include "srslte/radio/radio.h"
 #include "srslte/srslte.h"
+#include <map>
+#include <set>
+#include <vector>
 
 namespace srsue {
 
@@ -44,19 +48,48 @@ public:
   typedef enum { CELL_NOT_FOUND, CELL_FOUND, ERROR, TIMEOUT } ret_code;
 
   ~search();
-  void     init(srslte::rf_buffer_t& buffer_, srslte::log* log_h, uint32_t nof_rx_channels, search_callback* parent);
+  void     init(srslte::rf_buffer_t& buffer_,
+                srslte::log*         log_h,
+                uint32_t             nof_rx_channels,
+                search_callback*     parent,
+                uint32_t             nof_engine_workers = 0);
   void     reset();
   float    get_last_cfo();
   void     set_agc_enable(bool enable);
-  ret_code run(srslte_cell_t* cell, std::array<uint8_t, SRSLTE_BCH_PAYLOAD_LEN>& bch_payload);
+  ret_code run(srslte_cell_t* cell, std::array<uint8_t, SRSLTE_BCH_PAYLOAD_LEN>& bch_payload, uint32_t earfcn = 0);
+
+  /**
+   * Captures the band currently tuned at srate_hz and searches all the given EARFCNs with the parallel cell search
+   * engine. The results are kept until clear_wideband() and used by run() instead of a new capture.
+   */
+  bool run_wideband(const std::vector<uint32_t>& earfcns, double srate_hz, double center_freq_hz);
+  bool is_wideband_searched(uint32_t earfcn) const { return wb_searched.count(earfcn) > 0; }
+  void clear_wideband();
+  bool is_engine_enabled() const { return engine_enabled; }
 
 private:
+  ret_code run_engine(srslte_cell_t* cell, std::array<uint8_t, SRSLTE_BCH_PAYLOAD_LEN>& bch_payload, uint32_t earfcn);
+  ret_code decode_mib(srslte_cell_t                                 new_cell,
+                      float                                         cfo,
+                      srslte_cell_t*                                cell,
+                      std::array<uint8_t, SRSLTE_BCH_PAYLOAD_LEN>& bch_payload);
+  bool     capture(double srate_hz);
+
   search_callback*       p            = nullptr;
   srslte::log*           log_h        = nullptr;
   srslte::rf_buffer_t    buffer       = {};
   srslte_ue_cellsearch_t cs           = {};
   srslte_ue_mib_sync_t   ue_mib_sync  = {};
   int                    force_N_id_2 = 0;
+
+  // Parallel cell search
+  bool                                           engine_enabled = false;
+  cell_search_engine                             engine;
+  std::vector<cf_t>                              capture_buffer;
+  uint32_t                                       capture_ms  = 0;
+  uint32_t                                       capture_len = 0;
+  std::map<uint32_t, cell_search_engine::cell_t> wb_found;
+  std::set<uint32_t>                             wb_searched;
 };
 
 }; // namespace srsue
@@ -134,6 +134,12 @@ private:
    */
   void run_cell_search_state();
 
+  /**
+   * Captures the band around the current EARFCN at the wideband cell search rate and searches in parallel all the
+   * EARFCNs of the list that fit in it. Restores the cell search rate and frequency before returning.
+   */
+  void run_wideband_search();
+
   /**
    * SFN synchronization using MIB. run_subframe() receives and processes 1 subframe
    * and returns
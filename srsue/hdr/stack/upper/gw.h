@@ -31,6 +31,8 @@
 #include "srslte/common/threads.h"
 #include "srslte/interfaces/ue_interfaces.h"
 #include "tft_packet_filter.h"
+#include "tun_io.h"
+#include <atomic>
 #include <net/if.h>
 
 namespace srsue {
@@ -40,12 +42,13 @@ struct gw_args_t {
     std::string gw_level;
     int         gw_hex_limit;
   } log;
-  std::string netns;
-  std::string tun_dev_name;
-  std::string tun_dev_netmask;
+  std::string   netns;
+  std::string   tun_dev_name;
+  std::string   tun_dev_netmask;
+  tun_io_args_t tun_io;
 };
 
-class gw : public gw_interface_stack, public srslte::thread
+class gw : public gw_interface_stack, public tun_io_rx_handler
 {
 public:
   gw();
@@ -58,6 +61,9 @@ public:
   void write_pdu(uint32_t lcid, srslte::unique_byte_buffer_t pdu);
   void write_pdu_mch(uint32_t lcid, srslte::unique_byte_buffer_t pdu);
 
+  // Stack interface
+  void run_tti();
+
   // NAS interface
   int setup_if_addr(uint32_t lcid, uint8_t pdn_type, uint32_t ip_addr, uint8_t* ipv6_if_addr, char* err_str);
   int apply_traffic_flow_template(const uint8_t&                                 eps_bearer_id,
@@ -77,25 +83,24 @@ private:
 
   gw_args_t args = {};
 
-  bool         running      = false;
-  bool         run_enable   = false;
-  int32_t      netns_fd     = 0;
-  int32_t      tun_fd       = 0;
-  struct ifreq ifr          = {};
-  int32_t      sock         = 0;
-  bool         if_up        = false;
-  uint32_t     default_lcid = 0;
+  std::atomic<bool> run_enable   = {false};
+  int32_t           netns_fd     = 0;
+  tun_io            tun;
+  struct ifreq      ifr          = {};
+  int32_t           sock         = 0;
+  bool              if_up        = false;
+  uint32_t          default_lcid = 0;
 
   srslte::log_filter log;
 
   uint32_t current_ip_addr = 0;
   uint8_t  current_if_id[8];
 
-  long           ul_tput_bytes = 0;
-  long           dl_tput_bytes = 0;
-  struct timeval metrics_time[3];
+  std::atomic<long> ul_tput_bytes = {0};
+  long              dl_tput_bytes = 0;
+  struct timeval    metrics_time[3];
 
-  void run_thread();
+  void tun_rx_pdu(uint32_t queue_idx, srslte::unique_byte_buffer_t pdu) override;
   int  init_if(char* err_str);
   int  setup_if_addr4(uint32_t ip_addr, char* err_str);
   int  setup_if_addr6(uint8_t* ipv6_if_id, char* err_str);
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+/******************************************************************************
+ * File:        tun_io.h
+ * Description: Packet I/O towards the GW TUN device. Each queue of a
+ *              multi-queue TUN device is served by its own receive thread.
+ *              With virtio-net headers enabled the kernel hands over TCP
+ *              super-packets (GSO) that are split into MSS-sized IP packets
+ *              here, and consecutive DL TCP segments of one flow are merged
+ *              into a single super-packet (GRO) when the DL batch is flushed.
+ *****************************************************************************/
+
+#ifndef SRSUE_TUN_IO_H
+#define SRSUE_TUN_IO_H
+
+#include "srslte/common/buffer_pool.h"
+#include "srslte/common/common.h"
+#include "srslte/common/log.h"
+#include "srslte/common/threads.h"
+#include <atomic>
+#include <memory>
+#include <net/if.h>
+#include <vector>
+
+namespace srsue {
+
+struct tun_io_args_t {
+  uint32_t nof_queues = 1;     // TUN queues, each one read by its own thread
+  bool     vnet_hdr   = false; // exchange virtio-net headers with the kernel to enable checksum and TSO offloads
+  bool     dl_batch   = false; // hold DL packets until flush() instead of writing each one straight away
+};
+
+// Same layout as struct virtio_net_hdr of linux/virtio_net.h, which does not compile as C++. Host byte order.
+struct tun_vnet_hdr_t {
+  static const uint8_t F_NEEDS_CSUM = 1;
+  static const uint8_t GSO_NONE     = 0;
+  static const uint8_t GSO_TCPV4    = 1;
+  static const uint8_t GSO_TCPV6    = 4;
+  static const uint8_t GSO_ECN      = 0x80;
+
+  uint8_t  flags;
+  uint8_t  gso_type;
+  uint16_t hdr_len;
+  uint16_t gso_size;
+  uint16_t csum_start;
+  uint16_t csum_offset;
+};
+
+struct tun_io_stats_t {
+  uint64_t rx_pkts;     // packets read from the device, a GSO super-packet counts once
+  uint64_t rx_sdus;     // IP packets delivered to the handler
+  uint64_t rx_dropped;  // packets that could not be parsed or buffered
+  uint64_t tx_pkts;     // IP packets passed to write_pdu()
+  uint64_t tx_writes;   // write() calls towards the device
+  uint64_t tx_dropped;  // packets the device did not accept
+};
+
+class tun_io_rx_handler
+{
+public:
+  virtual void tun_rx_pdu(uint32_t queue_idx, srslte::unique_byte_buffer_t pdu) = 0;
+};
+
+class tun_io
+{
+public:
+  explicit tun_io(srslte::log* log_);
+  ~tun_io();
+
+  // Opens the TUN device named in ifr with one file descriptor per queue
+  int open(const tun_io_args_t& args_, struct ifreq* ifr);
+  // Uses descriptors that were opened elsewhere, one per queue, with the offloads already configured
+  int  attach(const tun_io_args_t& args_, const std::vector<int>& fds_);
+  void start(tun_io_rx_handler* handler_, int prio);
+  void stop();
+  bool is_open() const { return not fds.empty(); }
+
+  // Not thread-safe, to be called from the stack thread only
+  void write_pdu(srslte::unique_byte_buffer_t pdu);
+  void flush();
+
+  tun_io_stats_t get_stats() const;
+
+private:
+  static const uint32_t MAX_GSO_BYTES   = 65535;
+  static const uint32_t MAX_GRO_SEGS    = 64;
+  static const uint32_t MAX_DL_BATCH    = 256;
+  static const int      POLL_TIMEOUT_MS = 100;
+
+  class rx_worker;
+
+  void                         rx_loop(uint32_t queue_idx);
+  void                         rx_vnet_pkt(uint32_t queue_idx, uint8_t* buf, uint32_t len);
+  void                         deliver(uint32_t queue_idx, srslte::unique_byte_buffer_t pdu);
+  srslte::unique_byte_buffer_t allocate_pdu();
+  uint32_t                     gro_chain_len(const srslte::unique_byte_buffer_t* pdus, uint32_t nof_pdus);
+  void                         write_chain(srslte::unique_byte_buffer_t* pdus, uint32_t nof_pdus);
+
+  srslte::log*              log     = nullptr;
+  srslte::byte_buffer_pool* pool    = nullptr;
+  tun_io_rx_handler*        handler = nullptr;
+  tun_io_args_t             args    = {};
+
+  std::vector<int>                        fds;
+  std::vector<std::unique_ptr<rx_worker> > workers;
+  std::atomic<bool>                       run_enable = {false};
+
+  std::vector<srslte::unique_byte_buffer_t> dl_pending;
+
+  std::atomic<uint64_t> rx_pkts    = {0};
+  std::atomic<uint64_t> rx_sdus    = {0};
+  std::atomic<uint64_t> rx_dropped = {0};
+  std::atomic<uint64_t> tx_pkts    = {0};
+  std::atomic<uint64_t> tx_writes  = {0};
+  std::atomic<uint64_t> tx_dropped = {0};
+};
+
+} // namespace srsue
+
+#endif // SRSUE_TUN_IO_H
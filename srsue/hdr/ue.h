@@ -35,6 +35,7 @@
 #include "phy/ue_phy_base.h"
 #include "srslte/common/buffer_pool.h"
 #include "srslte/common/log_filter.h"
+#include "srslte/common/thread_topology.h"
 #include "srslte/interfaces/ue_interfaces.h"
 #include "srslte/radio/radio.h"
 #include "stack/ue_stack_base.h"
@@ -58,6 +59,7 @@ typedef struct {
   int         all_hex_limit;
   int         file_max_size;
   std::string filename;
+  bool        binary;
 } log_args_t;
 
 typedef struct {
@@ -82,7 +84,8 @@ typedef struct {
   stack_args_t stack;
   gw_args_t    gw;
 
-  general_args_t general;
+  general_args_t                 general;
+  srslte::thread_topology_args_t threads;
 } all_args_t;
 
 /*******************************************************************************
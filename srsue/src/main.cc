@@ -26,6 +26,7 @@
 #include "srslte/common/logmap.h"
 #include "srslte/common/metrics_hub.h"
 #include "srslte/common/signal_handler.h"
+#include "srslte/common/thread_topology.h"
 #include "srslte/srslog/srslog.h"
 #include "srslte/srslte.h"
 #include "srslte/version.h"
@@ -99,6 +100,7 @@ static int parse_args(all_args_t* args, int argc, char* argv[])
     ("rf.device_args", bpo::value<string>(&args->rf.device_args)->default_value("auto"), "Front-end device arguments")
     ("rf.time_adv_nsamples", bpo::value<string>(&args->rf.time_adv_nsamples)->default_value("auto"), "Transmission time advance")
     ("rf.continuous_tx", bpo::value<string>(&args->rf.continuous_tx)->default_value("auto"), "Transmit samples continuously to the radio or on bursts (auto/yes/no). Default is auto (yes for UHD, no for rest)")
+    ("rf.resampler", bpo::value<string>(&args->rf.resampler)->default_value("fft"), "Resampler used when rf.srate forces the sampling rate (fft/polyphase). Polyphase supports fractional ratios")
 
     ("rf.bands.rx[0].min", bpo::value<float>(&args->rf.ch_rx_bands[0].min)->default_value(0), "Lower frequency boundary for CH0-RX")
     ("rf.bands.rx[0].max", bpo::value<float>(&args->rf.ch_rx_bands[0].max)->default_value(0), "Higher frequency boundary for CH0-RX")
@@ -172,6 +174,7 @@ static int parse_args(all_args_t* args, int argc, char* argv[])
 
     ("log.filename", bpo::value<string>(&args->log.filename)->default_value("/tmp/ue.log"), "Log filename")
     ("log.file_max_size", bpo::value<int>(&args->log.file_max_size)->default_value(-1), "Maximum file size (in kilobytes). When passed, multiple files are created. Default -1 (single file)")
+    ("log.binary", bpo::value<bool>(&args->log.binary)->default_value(false), "Write the log file in binary form, to be converted to text with srslog_decode")
 
     ("usim.mode", bpo::value<string>(&args->stack.usim.mode)->default_value("soft"), "USIM mode (soft or pcsc)")
     ("usim.algo", bpo::value<string>(&args->stack.usim.algo), "USIM authentication algorithm")
@@ -186,6 +189,9 @@ static int parse_args(all_args_t* args, int argc, char* argv[])
     ("gw.netns", bpo::value<string>(&args->gw.netns)->default_value(""), "Network namespace to for TUN device (empty for default netns)")
     ("gw.ip_devname", bpo::value<string>(&args->gw.tun_dev_name)->default_value("tun_srsue"), "Name of the tun_srsue device")
     ("gw.ip_netmask", bpo::value<string>(&args->gw.tun_dev_netmask)->default_value("255.255.255.0"), "Netmask of the tun_srsue device")
+    ("gw.tun_queues", bpo::value<uint32_t>(&args->gw.tun_io.nof_queues)->default_value(1), "Number of TUN device queues, each read by its own thread")
+    ("gw.vnet_hdr", bpo::value<bool>(&args->gw.tun_io.vnet_hdr)->default_value(false), "Enable TUN checksum/TSO offloads, TCP super-packets are split and merged by the GW")
+    ("gw.dl_batch", bpo::value<bool>(&args->gw.tun_io.dl_batch)->default_value(false), "Write DL IP packets to the TUN device once per TTI")
 
     /* Downlink Channel emulator section */
     ("channel.dl.enable",            bpo::value<bool>(&args->phy.dl_channel_args.enable)->default_value(false),                 "Enable/Disable internal Downlink channel emulator")
@@ -292,6 +298,10 @@ static int parse_args(all_args_t* args, int argc, char* argv[])
        bpo::value<uint32_t>(&args->phy.intra_freq_meas_period_ms)->default_value(200),
        "Period of intra-frequency neighbour cell measurement in ms. Maximum as per 3GPP is 200 ms.")
 
+    ("phy.intra_freq_meas_threads",
+       bpo::value<uint32_t>(&args->phy.intra_freq_meas_threads)->default_value(2),
+       "Number of threads measuring the neighbour cells in parallel, 0 measures them in the measurement thread.")
+
     ("phy.correct_sync_error",
        bpo::value<bool>(&args->phy.correct_sync_error)->default_value(false),
        "Channel estimator measures and pre-compensates time synchronization error. Increases CPU usage, improves PDSCH "
@@ -359,6 +369,14 @@ static int parse_args(all_args_t* args, int argc, char* argv[])
      bpo::value<float>(&args->phy.snr_to_cqi_offset)->default_value(0),
      "Sets an offset in the SNR to CQI table. This is used to adjust the reported CQI.")
 
+    ("phy.cell_search_threads",
+     bpo::value<uint32_t>(&args->phy.cell_search_threads)->default_value(0),
+     "Number of threads of the parallel cell search, 0 uses the sequential cell search")
+
+    ("phy.cell_search_wideband_srate",
+     bpo::value<float>(&args->phy.cell_search_wideband_srate)->default_value(0.0),
+     "Sampling rate of the wideband cell search capture, multiple of 1.92 MHz (0 disables it)")
+
     ("phy.sss_algorithm",
      bpo::value<string>(&args->phy.sss_algorithm)->default_value("full"),
      "Selects the SSS estimation algorithm.")
@@ -431,6 +449,33 @@ static int parse_args(all_args_t* args, int argc, char* argv[])
     ("vnf.port", bpo::value<uint16_t>(&args->phy.vnf_args.bind_port)->default_value(3334), "Bind port")
     ;
 
+  // Thread topology options, one set per thread class
+  common.add_options()
+    ("threads.numa",
+     bpo::value<bool>(&args->threads.numa)->default_value(false),
+     "Prefer memory from the NUMA node of the CPUs of each thread class")
+
+    ("threads.report",
+     bpo::value<bool>(&args->threads.report)->default_value(false),
+     "Print the thread layout at startup even if no class is configured")
+    ;
+  for (const string& cls : srslte::thread_topology::class_names()) {
+    srslte::thread_class_args_t& c = args->threads.classes[cls];
+    common.add_options()
+      (("threads." + cls + ".cpus").c_str(),
+       bpo::value<string>(&c.cpus)->default_value(""),
+       "CPU list of the thread class, e.g. 2-5,8")
+
+      (("threads." + cls + ".policy").c_str(),
+       bpo::value<string>(&c.policy)->default_value(""),
+       "Scheduling policy of the thread class: fifo, rr or other")
+
+      (("threads." + cls + ".prio").c_str(),
+       bpo::value<int>(&c.prio)->default_value(-1),
+       "Scheduling priority of the thread class for fifo and rr")
+      ;
+  }
+
   // Positional options - config file location
   bpo::options_description position("Positional options");
   position.add_options()
@@ -627,9 +672,13 @@ int main(int argc, char* argv[])
   }
 
   // Setup logging.
-  log_sink = (args.log.filename == "stdout")
-                 ? srslog::create_stdout_sink()
-                 : srslog::create_file_sink(args.log.filename, fixup_log_file_maxsize(args.log.file_max_size));
+  if (args.log.filename == "stdout") {
+    log_sink = srslog::create_stdout_sink();
+  } else if (args.log.binary) {
+    log_sink = &srslog::fetch_binary_file_sink(args.log.filename, fixup_log_file_maxsize(args.log.file_max_size));
+  } else {
+    log_sink = srslog::create_file_sink(args.log.filename, fixup_log_file_maxsize(args.log.file_max_size));
+  }
   if (!log_sink) {
     return SRSLTE_ERROR;
   }
@@ -642,6 +691,11 @@ int main(int argc, char* argv[])
   // Start the log backend.
   srslog::init();
 
+  // Place the threads started from now on, and the log backend which already runs
+  if (not srslte::thread_topology::get().configure(args.threads)) {
+    return SRSLTE_ERROR;
+  }
+
   srslte::logmap::set_default_logger(&log_wrapper);
   srslte::log_args(argc, argv, "UE");
 
@@ -671,6 +725,10 @@ int main(int argc, char* argv[])
     }
   }
 
+  if (args.threads.report or srslte::thread_topology::get().active()) {
+    srslte::thread_topology::get().print_report(stdout);
+  }
+
   pthread_t input;
   pthread_create(&input, nullptr, &input_loop, &args);
 
@@ -0,0 +1,407 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsue/hdr/phy/cell_search_engine.h"
+#include <algorithm>
+#include <array>
+
+#define Error(fmt, ...)                                                                                                \
+  if (SRSLTE_DEBUG_ENABLED)                                                                                            \
+  log_h->error(fmt, ##__VA_ARGS__)
+#define Warning(fmt, ...)                                                                                              \
+  if (SRSLTE_DEBUG_ENABLED)                                                                                            \
+  log_h->warning(fmt, ##__VA_ARGS__)
+#define Info(fmt, ...)                                                                                                 \
+  if (SRSLTE_DEBUG_ENABLED)                                                                                            \
+  log_h->info(fmt, ##__VA_ARGS__)
+#define Debug(fmt, ...)                                                                                                \
+  if (SRSLTE_DEBUG_ENABLED)                                                                                            \
+  log_h->debug(fmt, ##__VA_ARGS__)
+
+// Samples preceding the PSS needed for the CP and SSS detection (TDD SSS with extended CP)
+#define CS_LOOKBACK (3 * SRSLTE_SYMBOL_SZ(SRSLTE_PSS_SEARCH_SYMBOL_SZ, SRSLTE_CP_EXT))
+#define CS_WINDOW_SZ (CS_LOOKBACK + SRSLTE_PSS_SEARCH_SYMBOL_SZ)
+
+// Largest bandwidth occupied by the synchronization signals around an EARFCN carrier
+#define CS_SYNC_BW_HZ (SRSLTE_PSS_RE * 15e3)
+
+// Fraction of the captured band which is considered free of aliasing
+#define CS_WIDEBAND_USABLE_BW 0.8
+
+namespace srsue {
+
+cell_search_engine::~cell_search_engine()
+{
+  stop();
+
+  for (auto& ch : channels) {
+    srslte_pss_search_free(&ch->pss);
+    srslte_channelizer_free(&ch->channelizer);
+    if (ch->baseband) {
+      free(ch->baseband);
+    }
+  }
+  for (auto& w : workers) {
+    srslte_sss_free(&w->sss);
+    if (w->window) {
+      free(w->window);
+    }
+  }
+}
+
+bool cell_search_engine::init(const args_t& args_, srslte::log* log_h_)
+{
+  args        = args_;
+  log_h       = log_h_;
+  max_samples = args.max_capture_ms * SAMPLES_MS;
+
+  for (uint32_t i = 0; i < args.max_channels; i++) {
+    std::unique_ptr<channel_t> ch(new channel_t);
+    ch->baseband = srslte_vec_cf_malloc(max_samples);
+    if (ch->baseband == nullptr) {
+      Error("Cell search: Error allocating channel buffer\n");
+      return false;
+    }
+    if (srslte_pss_search_init(&ch->pss, max_samples)) {
+      Error("Cell search: Error initiating PSS search\n");
+      return false;
+    }
+    channels.push_back(std::move(ch));
+  }
+
+  // All the stages run in the caller thread if there are no workers
+  for (uint32_t i = 0; i < SRSLTE_MAX(1, args.nof_workers); i++) {
+    std::unique_ptr<worker_t> w(new worker_t);
+    w->window = srslte_vec_cf_malloc(CS_WINDOW_SZ);
+    if (w->window == nullptr) {
+      Error("Cell search: Error allocating worker buffer\n");
+      return false;
+    }
+    if (srslte_sss_init(&w->sss, SRSLTE_PSS_SEARCH_SYMBOL_SZ)) {
+      Error("Cell search: Error initiating SSS\n");
+      return false;
+    }
+    workers.push_back(std::move(w));
+  }
+
+  if (args.nof_workers > 0) {
+    pool = std::unique_ptr<srslte::task_thread_pool>(new srslte::task_thread_pool(args.nof_workers));
+    pool->start(args.worker_prio);
+  }
+
+  return true;
+}
+
+void cell_search_engine::stop()
+{
+  if (pool) {
+    pool->stop();
+    pool = nullptr;
+  }
+}
+
+bool cell_search_engine::search(uint32_t earfcn, const cf_t* samples, uint32_t nof_samples, report_t* report)
+{
+  if (channels.empty() || samples == nullptr || report == nullptr) {
+    return false;
+  }
+
+  channel_t* ch   = channels[0].get();
+  ch->earfcn      = earfcn;
+  ch->offset      = 0.0f;
+  ch->samples     = samples;
+  ch->nof_samples = SRSLTE_MIN(nof_samples, max_samples);
+
+  wb_samples     = nullptr;
+  wb_nof_samples = 0;
+
+  return run(1, report);
+}
+
+bool cell_search_engine::search_wideband(const cf_t*                  samples,
+                                         uint32_t                     nof_samples,
+                                         double                       srate_hz,
+                                         double                       center_freq_hz,
+                                         const std::vector<uint32_t>& earfcns,
+                                         report_t*                    report)
+{
+  if (channels.empty() || samples == nullptr || report == nullptr) {
+    return false;
+  }
+
+  uint32_t new_ratio = (uint32_t)round(srate_hz / SRATE_CS);
+  if (new_ratio == 0 || fabs(new_ratio * (double)SRATE_CS - srate_hz) > 1.0) {
+    Error("Cell search: Wideband sampling rate %.2f MHz is not a multiple of %.2f MHz\n", srate_hz / 1e6, SRATE_CS / 1e6);
+    return false;
+  }
+  if (not set_ratio(new_ratio)) {
+    return false;
+  }
+
+  wb_samples     = samples;
+  wb_nof_samples = SRSLTE_MIN(nof_samples, max_samples * ratio);
+  wb_nof_samples -= wb_nof_samples % ratio;
+
+  uint32_t nof_channels = 0;
+  for (uint32_t earfcn : earfcns) {
+    if (nof_channels == channels.size()) {
+      Warning("Cell search: Only the first %zd EARFCNs of the capture are searched\n", channels.size());
+      break;
+    }
+    double offset_hz = 1e6 * srslte_band_fd(earfcn) - center_freq_hz;
+    if (fabs(offset_hz) + CS_SYNC_BW_HZ / 2 > srate_hz / 2) {
+      Warning("Cell search: EARFCN=%d is outside of the captured band\n", earfcn);
+      continue;
+    }
+    channel_t* ch   = channels[nof_channels++].get();
+    ch->earfcn      = earfcn;
+    ch->offset      = (float)(offset_hz / srate_hz);
+    ch->samples     = ch->baseband;
+    ch->nof_samples = wb_nof_samples / ratio;
+  }
+
+  return run(nof_channels, report);
+}
+
+std::vector<uint32_t> cell_search_engine::group_earfcns(const std::vector<uint32_t>& earfcn_list,
+                                                        uint32_t                     start_idx,
+                                                        double                       srate_hz,
+                                                        double*                      center_freq_hz)
+{
+  std::vector<uint32_t> group;
+  if (start_idx >= earfcn_list.size()) {
+    return group;
+  }
+
+  // Greedily add the EARFCNs that keep the whole group inside the usable captured band
+  double f_min = 1e6 * srslte_band_fd(earfcn_list[start_idx]);
+  double f_max = f_min;
+  for (uint32_t i = start_idx; i < earfcn_list.size(); i++) {
+    double f    = 1e6 * srslte_band_fd(earfcn_list[i]);
+    double span = SRSLTE_MAX(f_max, f) - SRSLTE_MIN(f_min, f) + CS_SYNC_BW_HZ;
+    if (f > 0 && span <= CS_WIDEBAND_USABLE_BW * srate_hz) {
+      f_min = SRSLTE_MIN(f_min, f);
+      f_max = SRSLTE_MAX(f_max, f);
+      group.push_back(earfcn_list[i]);
+    }
+  }
+
+  if (center_freq_hz) {
+    *center_freq_hz = (f_min + f_max) / 2;
+  }
+  return group;
+}
+
+bool cell_search_engine::set_ratio(uint32_t new_ratio)
+{
+  if (new_ratio == ratio) {
+    return true;
+  }
+  for (auto& ch : channels) {
+    srslte_channelizer_free(&ch->channelizer);
+    if (srslte_channelizer_init(&ch->channelizer, new_ratio)) {
+      Error("Cell search: Error initiating channelizer with ratio %d\n", new_ratio);
+      ratio = 0;
+      return false;
+    }
+  }
+  ratio = new_ratio;
+  return true;
+}
+
+void cell_search_engine::run_task(const std::function<void(uint32_t)>& task)
+{
+  if (pool) {
+    pool->push_task(task);
+  } else {
+    task(0);
+  }
+}
+
+bool cell_search_engine::run(uint32_t nof_channels, report_t* report)
+{
+  *report              = {};
+  report->nof_channels = nof_channels;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    current_report = report;
+    pending        = nof_channels * SRSLTE_NOF_NID_2;
+    t_start        = std::chrono::steady_clock::now();
+  }
+
+  for (uint32_t c = 0; c < nof_channels; c++) {
+    channel_t* ch = channels[c].get();
+    run_task([this, ch](uint32_t worker_id) {
+      prepare_channel(ch);
+      // The hypotheses share the transformed input, so they are only dispatched once it is ready
+      for (uint32_t N_id_2 = 1; N_id_2 < SRSLTE_NOF_NID_2; N_id_2++) {
+        run_task([this, ch, N_id_2](uint32_t id) { search_hypothesis(id, ch, N_id_2); });
+      }
+      search_hypothesis(worker_id, ch, 0);
+    });
+  }
+
+  std::unique_lock<std::mutex> lock(mutex);
+  cvar.wait(lock, [this]() { return pending == 0; });
+
+  std::sort(report->cells.begin(), report->cells.end(), [](const cell_t& a, const cell_t& b) {
+    return a.peak > b.peak;
+  });
+  report->total_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t_start).count();
+  current_report = nullptr;
+
+  Info("Cell search: %zd cells in %d EARFCNs, time to first cell %.1f ms, total %.1f ms\n",
+       report->cells.size(),
+       nof_channels,
+       report->first_cell_us / 1000.0,
+       report->total_us / 1000.0);
+
+  return true;
+}
+
+void cell_search_engine::prepare_channel(channel_t* ch)
+{
+  if (wb_samples) {
+    srslte_channelizer_set_freq(&ch->channelizer, ch->offset);
+    srslte_channelizer_run(&ch->channelizer, wb_samples, ch->baseband, wb_nof_samples);
+  }
+
+  if (srslte_pss_search_set_input(&ch->pss, ch->samples, ch->nof_samples)) {
+    Warning("Cell search: Not enough samples in EARFCN=%d (%d)\n", ch->earfcn, ch->nof_samples);
+    ch->nof_samples = 0;
+  }
+}
+
+void cell_search_engine::search_hypothesis(uint32_t worker_id, channel_t* ch, uint32_t N_id_2)
+{
+  srslte_pss_search_result_t pss   = {};
+  cell_t                     cell  = {};
+  bool                       found = false;
+
+  if (ch->nof_samples > 0 && srslte_pss_search_run(&ch->pss, N_id_2, &pss) == SRSLTE_SUCCESS) {
+    if (pss.psr >= args.psr_threshold) {
+      found = detect_cell(workers.at(worker_id).get(), ch, pss, &cell);
+    } else {
+      Debug("Cell search: EARFCN=%d, N_id_2=%d, PSR=%.1f below threshold\n", ch->earfcn, N_id_2, pss.psr);
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (found) {
+    cell.detect_us = SRSLTE_MAX(
+        1,
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t_start).count());
+    if (current_report->first_cell_us == 0) {
+      current_report->first_cell_us = cell.detect_us;
+    }
+    current_report->cells.push_back(cell);
+    Info("Cell search: EARFCN=%d, PCI=%d, CP=%s, %s, PSR=%.1f, CFO=%.1f KHz, mode=%.2f, detected in %.1f ms\n",
+         cell.earfcn,
+         cell.pci,
+         srslte_cp_string(cell.cp),
+         cell.frame_type ? "TDD" : "FDD",
+         cell.psr,
+         cell.cfo_hz / 1000,
+         cell.mode,
+         cell.detect_us / 1000.0);
+  }
+  pending--;
+  if (pending == 0) {
+    cvar.notify_all();
+  }
+}
+
+bool cell_search_engine::detect_cell(worker_t*                         w,
+                                     const channel_t*                  ch,
+                                     const srslte_pss_search_result_t& pss,
+                                     cell_t*                           cell)
+{
+  const uint32_t symbol_sz = SRSLTE_PSS_SEARCH_SYMBOL_SZ;
+
+  // Votes of every PSS occurrence, decided like srslte_ue_cellsearch does across frames
+  std::array<uint8_t, SRSLTE_NOF_NID_1> nof_id   = {};
+  std::array<uint8_t, SRSLTE_NOF_NID_1> nof_norm = {};
+  std::array<uint8_t, SRSLTE_NOF_NID_1> nof_fdd  = {};
+  uint32_t                              nof_pss  = 0;
+
+  srslte_sss_set_N_id_2(&w->sss, pss.N_id_2);
+
+  for (uint32_t n = pss.peak_pos; n + symbol_sz <= ch->nof_samples; n += SRSLTE_PSS_SEARCH_PERIOD) {
+    if (n < CS_LOOKBACK) {
+      continue;
+    }
+
+    // Correct the PSS-estimated CFO before the CP and SSS detection
+    srslte_vec_apply_cfo(&ch->samples[n - CS_LOOKBACK], -pss.cfo / symbol_sz, w->window, CS_WINDOW_SZ);
+    const cf_t* pss_ptr = &w->window[CS_LOOKBACK];
+
+    srslte_cp_t cp = srslte_pss_search_detect_cp(pss_ptr);
+
+    // The SSS precedes the PSS by one symbol in FDD and by three symbols in TDD
+    srslte_frame_type_t frame_type = SRSLTE_FDD;
+    uint32_t            m0 = 0, m1 = 0;
+    float               corr = -1.0f;
+    for (srslte_frame_type_t ft : {SRSLTE_FDD, SRSLTE_TDD}) {
+      uint32_t    nof_symbols = ft == SRSLTE_FDD ? 1 : 3;
+      const cf_t* sss_ptr     = pss_ptr - nof_symbols * SRSLTE_SYMBOL_SZ(symbol_sz, cp);
+      uint32_t    m0_ = 0, m1_ = 0;
+      float       m0_value = 0, m1_value = 0;
+      srslte_sss_m0m1_partial(&w->sss, sss_ptr, 3, NULL, &m0_, &m0_value, &m1_, &m1_value);
+      if (m0_value + m1_value > corr) {
+        corr       = m0_value + m1_value;
+        m0         = m0_;
+        m1         = m1_;
+        frame_type = ft;
+      }
+    }
+
+    int N_id_1 = srslte_sss_N_id_1(&w->sss, m0, m1, corr);
+    nof_pss++;
+    if (N_id_1 < 0 || N_id_1 >= SRSLTE_NOF_NID_1) {
+      continue;
+    }
+    nof_id[N_id_1]++;
+    nof_norm[N_id_1] += SRSLTE_CP_ISNORM(cp) ? 1 : 0;
+    nof_fdd[N_id_1] += frame_type == SRSLTE_FDD ? 1 : 0;
+  }
+
+  uint32_t N_id_1 = std::max_element(nof_id.begin(), nof_id.end()) - nof_id.begin();
+  if (nof_pss == 0 || nof_id[N_id_1] == 0) {
+    Debug("Cell search: EARFCN=%d, N_id_2=%d, no valid SSS in %d PSS\n", ch->earfcn, pss.N_id_2, nof_pss);
+    return false;
+  }
+
+  cell->earfcn     = ch->earfcn;
+  cell->pci        = SRSLTE_NOF_NID_2 * N_id_1 + pss.N_id_2;
+  cell->cp         = 2 * nof_norm[N_id_1] > nof_id[N_id_1] ? SRSLTE_CP_NORM : SRSLTE_CP_EXT;
+  cell->frame_type = 2 * nof_fdd[N_id_1] > nof_id[N_id_1] ? SRSLTE_FDD : SRSLTE_TDD;
+  cell->peak_pos   = pss.peak_pos;
+  cell->peak       = pss.peak_value;
+  cell->psr        = pss.psr;
+  cell->cfo_hz     = pss.cfo * 15000;
+  cell->mode       = (float)nof_id[N_id_1] / nof_pss;
+
+  return true;
+}
+
+} // namespace srsue
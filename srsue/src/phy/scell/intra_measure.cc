@@ -40,8 +40,11 @@ intra_measure::intra_measure() : scell(), thread("SYNC_INTRA_MEASURE") {}
 
 intra_measure::~intra_measure()
 {
-  srslte_ringbuffer_free(&ring_buffer);
+  srslte_spsc_ringbuffer_free(&ring_buffer);
   scell.deinit();
+  if (nof_meas_threads > 0) {
+    scell_aux.deinit();
+  }
   free(search_buffer);
 }
 
@@ -55,17 +58,29 @@ void intra_measure::init(uint32_t cc_idx_, phy_common* common, meas_itf* new_cel
     intra_freq_meas_len_ms    = common->args->intra_freq_meas_len_ms;
     intra_freq_meas_period_ms = common->args->intra_freq_meas_period_ms;
     rx_gain_offset_db         = common->args->rx_gain_offset;
+    nof_meas_threads          = common->args->intra_freq_meas_threads;
   }
 
-  // Initialise Reference signal measurement
-  srslte_refsignal_dl_sync_init(&refsignal_dl_sync);
+  // Initialise one Reference signal measurement per worker, they share the FFT of the captured subframes
+  refsignal_dl_sync.resize(SRSLTE_MAX(nof_meas_threads, 1));
+  for (srslte_refsignal_dl_sync_t& q : refsignal_dl_sync) {
+    srslte_refsignal_dl_sync_init(&q);
+  }
+  srslte_refsignal_dl_sync_input_init(&refsignal_dl_sync_input);
 
   // Start scell
   scell.init(log_h, intra_freq_meas_len_ms);
 
+  if (nof_meas_threads > 0) {
+    scell_aux.init(log_h, intra_freq_meas_len_ms);
+    meas_pool = std::unique_ptr<srslte::task_thread_pool>(new srslte::task_thread_pool(nof_meas_threads));
+    meas_pool->start(INTRA_FREQ_MEAS_PRIO);
+  }
+
   search_buffer = srslte_vec_cf_malloc(intra_freq_meas_len_ms * SRSLTE_SF_LEN_PRB(SRSLTE_MAX_PRB));
 
-  if (srslte_ringbuffer_init(&ring_buffer, sizeof(cf_t) * intra_freq_meas_len_ms * SRSLTE_SF_LEN_PRB(SRSLTE_MAX_PRB))) {
+  if (srslte_spsc_ringbuffer_init(&ring_buffer, sizeof(cf_t) * intra_freq_meas_len_ms * SRSLTE_SF_LEN_PRB(SRSLTE_MAX_PRB)) !=
+      SRSLTE_SUCCESS) {
     return;
   }
 
@@ -76,9 +91,17 @@ void intra_measure::init(uint32_t cc_idx_, phy_common* common, meas_itf* new_cel
 void intra_measure::stop()
 {
   state.set_state(internal_state::quit);
-  srslte_ringbuffer_stop(&ring_buffer);
+  srslte_spsc_ringbuffer_stop(&ring_buffer);
   wait_thread_finish();
-  srslte_refsignal_dl_sync_free(&refsignal_dl_sync);
+  if (meas_pool) {
+    meas_pool->stop();
+    meas_pool = nullptr;
+  }
+  for (srslte_refsignal_dl_sync_t& q : refsignal_dl_sync) {
+    srslte_refsignal_dl_sync_free(&q);
+  }
+  refsignal_dl_sync.clear();
+  srslte_refsignal_dl_sync_input_free(&refsignal_dl_sync_input);
 }
 
 void intra_measure::set_primary_cell(uint32_t earfcn, srslte_cell_t cell)
@@ -95,9 +118,8 @@ void intra_measure::set_rx_gain_offset(float rx_gain_offset_db_)
 
 void intra_measure::meas_stop()
 {
+  // The samples of an unfinished window are discarded by the measurement thread
   state.set_state(internal_state::idle);
-  receive_cnt = 0;
-  srslte_ringbuffer_reset(&ring_buffer);
   if (log_h) {
     log_h->info("INTRA: Disabled neighbour cell search for EARFCN %d\n", get_earfcn());
   }
@@ -119,23 +141,36 @@ void intra_measure::write(uint32_t tti, cf_t* data, uint32_t nsamples)
   switch (state.get_state()) {
 
     case internal_state::idle:
+      // Anything written so far is stale
+      receive_cnt = 0;
+      ring_window_start.store(ring_write_bytes.load(std::memory_order_relaxed), std::memory_order_release);
+      break;
     case internal_state::measure:
+      // The measurement thread reads the window, a new one starts from scratch
+      receive_cnt = 0;
+      break;
     case internal_state::quit:
       // Do nothing
       break;
     case internal_state::wait:
+      receive_cnt = 0;
+      ring_window_start.store(ring_write_bytes.load(std::memory_order_relaxed), std::memory_order_release);
       if (elapsed_tti >= intra_freq_meas_period_ms) {
         state.set_state(internal_state::receive);
-        receive_cnt      = 0;
         last_measure_tti = tti;
-        srslte_ringbuffer_reset(&ring_buffer);
       }
       break;
     case internal_state::receive:
-      if (srslte_ringbuffer_write(&ring_buffer, data, nsamples * sizeof(cf_t)) < (int)(nsamples * sizeof(cf_t))) {
+      if (receive_cnt == 0) {
+        ring_window_start.store(ring_write_bytes.load(std::memory_order_relaxed), std::memory_order_release);
+      }
+      // Never block the PHY worker, drop the measurement if the measure thread is behind
+      if (srslte_spsc_ringbuffer_write(&ring_buffer, data, nsamples * sizeof(cf_t), 0) <
+          (int)(nsamples * sizeof(cf_t))) {
         Warning("Error writing to ringbuffer\n");
         state.set_state(internal_state::idle);
       } else {
+        ring_write_bytes.fetch_add(nsamples * sizeof(cf_t), std::memory_order_relaxed);
         receive_cnt++;
         if (receive_cnt == intra_freq_meas_len_ms) {
           // Buffer ready for measuring, start
@@ -155,8 +190,14 @@ void intra_measure::measure_proc()
   cells_to_measure = active_pci;
   active_pci_mutex.unlock();
 
-  // Read data from buffer and find cells in it
-  srslte_ringbuffer_read(&ring_buffer, search_buffer, intra_freq_meas_len_ms * current_sflen * sizeof(cf_t));
+  // Read the window from the buffer and find cells in it. The window is complete when the measure state is set, it
+  // can only be missing if a newer window has started in the meantime
+  drain_ring_buffer();
+  uint32_t window_len = intra_freq_meas_len_ms * current_sflen * sizeof(cf_t);
+  int      nof_read   = srslte_spsc_ringbuffer_read(&ring_buffer, search_buffer, window_len, 0);
+  if (nof_read > 0) {
+    ring_read_bytes += (uint32_t)nof_read;
+  }
 
   // Go to receive before finishing, so new samples can be enqueued before the thread finishes
   if (state.get_state() == internal_state::measure) {
@@ -164,48 +205,65 @@ void intra_measure::measure_proc()
     state.set_state(internal_state::wait);
   }
 
-  // Detect new cells using PSS/SSS
-  std::set<uint32_t> detected_cells = scell.find_cells(search_buffer, serving_cell, intra_freq_meas_len_ms);
+  if (nof_read < (int)window_len) {
+    return;
+  }
+
+  // Detect new cells using PSS/SSS while the subframe FFTs shared by all the PCI measurements are computed
+  std::set<uint32_t>                          detected_cells = {};
+  std::vector<std::function<void(uint32_t)> > tasks          = {};
+  std::mutex                                  detected_mutex;
+  if (nof_meas_threads > 0) {
+    uint32_t k = 0;
+    for (uint32_t n_id_2 = 0; n_id_2 < 3; n_id_2++) {
+      if (n_id_2 == serving_cell.id % 3) {
+        continue;
+      }
+      scell_recv* recv = (k++ == 0) ? &scell : &scell_aux;
+      tasks.push_back([this, recv, n_id_2, &detected_cells, &detected_mutex](uint32_t worker_id) {
+        int cell_id = recv->find_cell_N_id_2(search_buffer, serving_cell, intra_freq_meas_len_ms, n_id_2);
+        if (cell_id >= 0) {
+          std::lock_guard<std::mutex> lock(detected_mutex);
+          detected_cells.insert((uint32_t)cell_id);
+        }
+      });
+    }
+  } else {
+    tasks.push_back([this, &detected_cells](uint32_t worker_id) {
+      detected_cells = scell.find_cells(search_buffer, serving_cell, intra_freq_meas_len_ms);
+    });
+  }
+  tasks.push_back([this](uint32_t worker_id) {
+    srslte_refsignal_dl_sync_input_set(
+        &refsignal_dl_sync_input, search_buffer, intra_freq_meas_len_ms * current_sflen, serving_cell.nof_prb);
+  });
+  run_tasks(tasks);
 
-  // Add detected cells to the list of cells to measure
+  // Add detected cells to the list of cells to measure, except the serving cell since it's measured by workers
   for (auto& c : detected_cells) {
     cells_to_measure.insert(c);
   }
-
-  // Initialise empty neighbour cell list
-  std::vector<rrc_interface_phy_lte::phy_meas_t> neighbour_cells = {};
+  cells_to_measure.erase(serving_cell.id);
 
   new_cell_itf->cell_meas_reset(cc_idx);
 
-  // Use Cell Reference signal to measure cells in the time domain for all known active PCI
-  for (auto id : cells_to_measure) {
-    // Do not measure serving cell here since it's measured by workers
-    if (id == serving_cell.id) {
-      continue;
-    }
-    srslte_cell_t cell = serving_cell;
-    cell.id            = id;
-
-    srslte_refsignal_dl_sync_set_cell(&refsignal_dl_sync, cell);
-    srslte_refsignal_dl_sync_run(&refsignal_dl_sync, search_buffer, intra_freq_meas_len_ms * current_sflen);
-
-    if (refsignal_dl_sync.found) {
-      rrc_interface_phy_lte::phy_meas_t m = {};
-      m.pci                               = cell.id;
-      m.earfcn                            = current_earfcn;
-      m.rsrp                              = refsignal_dl_sync.rsrp_dBfs - rx_gain_offset_db;
-      m.rsrq                              = refsignal_dl_sync.rsrq_dB;
-      m.cfo_hz                            = refsignal_dl_sync.cfo_Hz;
-      neighbour_cells.push_back(m);
-
-      Info("INTRA: Found neighbour cell: EARFCN=%d, PCI=%03d, RSRP=%5.1f dBm, RSRQ=%5.1f, peak_idx=%5d, "
-           "CFO=%+.1fHz\n",
-           m.earfcn,
-           m.pci,
-           m.rsrp,
-           m.rsrq,
-           refsignal_dl_sync.peak_index,
-           refsignal_dl_sync.cfo_Hz);
+  // Use Cell Reference signal to measure cells in the time domain for all known active PCI, one task per PCI
+  std::vector<uint32_t>                          pcis(cells_to_measure.begin(), cells_to_measure.end());
+  std::vector<rrc_interface_phy_lte::phy_meas_t> meas(pcis.size());
+  std::unique_ptr<bool[]>                        found(new bool[pcis.size()]());
+  tasks.clear();
+  for (uint32_t i = 0; i < pcis.size(); i++) {
+    tasks.push_back([this, i, &pcis, &meas, &found](uint32_t worker_id) {
+      measure_pci(worker_id, pcis[i], &meas[i], &found[i]);
+    });
+  }
+  run_tasks(tasks);
+
+  // Initialise neighbour cell list in PCI order
+  std::vector<rrc_interface_phy_lte::phy_meas_t> neighbour_cells = {};
+  for (uint32_t i = 0; i < pcis.size(); i++) {
+    if (found[i]) {
+      neighbour_cells.push_back(meas[i]);
     }
   }
 
@@ -218,6 +276,75 @@ void intra_measure::measure_proc()
   meas_sync.increase();
 }
 
+void intra_measure::measure_pci(uint32_t                           worker_idx,
+                                uint32_t                           pci,
+                                rrc_interface_phy_lte::phy_meas_t* meas,
+                                bool*                              found)
+{
+  srslte_refsignal_dl_sync_t* q    = &refsignal_dl_sync[worker_idx % refsignal_dl_sync.size()];
+  srslte_cell_t               cell = serving_cell;
+  cell.id                          = pci;
+
+  srslte_refsignal_dl_sync_set_cell(q, cell);
+  srslte_refsignal_dl_sync_run_input(
+      q, &refsignal_dl_sync_input, search_buffer, intra_freq_meas_len_ms * current_sflen);
+
+  *found = q->found;
+  if (q->found) {
+    meas->pci    = cell.id;
+    meas->earfcn = current_earfcn;
+    meas->rsrp   = q->rsrp_dBfs - rx_gain_offset_db;
+    meas->rsrq   = q->rsrq_dB;
+    meas->cfo_hz = q->cfo_Hz;
+
+    Info("INTRA: Found neighbour cell: EARFCN=%d, PCI=%03d, RSRP=%5.1f dBm, RSRQ=%5.1f, peak_idx=%5d, "
+         "CFO=%+.1fHz\n",
+         meas->earfcn,
+         meas->pci,
+         meas->rsrp,
+         meas->rsrq,
+         q->peak_index,
+         q->cfo_Hz);
+  }
+}
+
+void intra_measure::run_tasks(const std::vector<std::function<void(uint32_t)> >& tasks)
+{
+  if (not meas_pool) {
+    for (const auto& task : tasks) {
+      task(0);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(tasks_mutex);
+    tasks_pending = tasks.size();
+  }
+
+  for (const auto& task : tasks) {
+    meas_pool->push_task([this, &task](uint32_t worker_id) {
+      task(worker_id);
+      std::lock_guard<std::mutex> lock(tasks_mutex);
+      if (--tasks_pending == 0) {
+        tasks_cvar.notify_all();
+      }
+    });
+  }
+
+  std::unique_lock<std::mutex> lock(tasks_mutex);
+  tasks_cvar.wait(lock, [this]() { return tasks_pending == 0; });
+}
+
+void intra_measure::drain_ring_buffer()
+{
+  uint64_t window_start = ring_window_start.load(std::memory_order_acquire);
+  if (window_start > ring_read_bytes) {
+    srslte_spsc_ringbuffer_release(&ring_buffer, (uint32_t)(window_start - ring_read_bytes));
+    ring_read_bytes = window_start;
+  }
+}
+
 void intra_measure::run_thread()
 {
   bool quit = false;
@@ -228,7 +355,8 @@ void intra_measure::run_thread()
       case internal_state::idle:
       case internal_state::wait:
       case internal_state::receive:
-        // Wait for a state change
+        // Discard the samples of any unfinished window and wait for a state change
+        drain_ring_buffer();
         state.wait_change();
         break;
       case internal_state::measure:
@@ -84,79 +84,89 @@ scell_recv::find_cells(const cf_t* input_buffer, const srslte_cell_t serving_cel
 {
   std::set<uint32_t> found_cell_ids = {};
 
+  for (uint32_t n_id_2 = 0; n_id_2 < 3; n_id_2++) {
+    if (n_id_2 != (serving_cell.id % 3)) {
+      int cell_id = find_cell_N_id_2(input_buffer, serving_cell, nof_sf, n_id_2);
+      if (cell_id >= 0) {
+        found_cell_ids.insert((uint32_t)cell_id);
+      }
+    }
+  }
+  return found_cell_ids;
+}
+
+int scell_recv::find_cell_N_id_2(const cf_t*         input_buffer,
+                                 const srslte_cell_t serving_cell,
+                                 const uint32_t      nof_sf,
+                                 uint32_t            n_id_2)
+{
   uint32_t fft_sz = srslte_symbol_sz(serving_cell.nof_prb);
   uint32_t sf_len = SRSLTE_SF_LEN(fft_sz);
 
   if (fft_sz != current_fft_sz) {
     if (srslte_sync_resize(&sync_find, nof_sf * sf_len, 5 * sf_len, fft_sz)) {
       log_h->error("Error resizing sync nof_sf=%d, sf_len=%d, fft_sz=%d\n", nof_sf, sf_len, fft_sz);
-      return found_cell_ids;
+      return -1;
     }
     current_fft_sz = fft_sz;
   }
 
-  uint32_t peak_idx  = 0;
-  int      cell_id   = 0;
+  uint32_t peak_idx = 0;
+  int      cell_id  = 0;
 
-  for (uint32_t n_id_2 = 0; n_id_2 < 3; n_id_2++) {
+  srslte_sync_set_N_id_2(&sync_find, n_id_2);
 
-    if (n_id_2 != (serving_cell.id % 3)) {
-      srslte_sync_set_N_id_2(&sync_find, n_id_2);
-
-      srslte_sync_find_ret_t sync_res;
-
-      srslte_sync_reset(&sync_find);
-      srslte_sync_cfo_reset(&sync_find, 0.0f);
-
-      sync_res          = SRSLTE_SYNC_NOFOUND;
-      bool sss_detected = false;
-      cell_id           = 0;
-      float max_peak    = -1;
-
-      float sss_correlation_peak_max = 0.0f;
-
-      for (uint32_t sf5_cnt = 0; sf5_cnt < nof_sf / 5; sf5_cnt++) {
-        sync_res = srslte_sync_find(&sync_find, input_buffer, sf5_cnt * 5 * sf_len, &peak_idx);
-        if (sync_res == SRSLTE_SYNC_ERROR) {
-          log_h->error("INTRA: Error calling sync_find()\n");
-          return found_cell_ids;
-        }
-
-        if (sync_find.peak_value > max_peak && sync_res == SRSLTE_SYNC_FOUND && srslte_sync_sss_detected(&sync_find)) {
-
-          // Uses the cell ID from the highest SSS correlation peak
-          if (sss_correlation_peak_max < srslte_sync_sss_correlation_peak(&sync_find)) {
-            // Set the cell ID
-            cell_id = srslte_sync_get_cell_id(&sync_find);
-
-            // Update the maximum value
-            sss_correlation_peak_max = srslte_sync_sss_correlation_peak(&sync_find);
-          }
-          sss_detected = true;
-        }
-
-        log_h->debug("INTRA: n_id_2=%d, cnt=%d/%d, sync_res=%d, cell_id=%d, sf_idx=%d, peak_idx=%d, peak_value=%f, "
-                     "sss_detected=%d\n",
-                     n_id_2,
-                     sf5_cnt,
-                     nof_sf / 5,
-                     sync_res,
-                     cell_id,
-                     srslte_sync_get_sf_idx(&sync_find),
-                     peak_idx,
-                     sync_find.peak_value,
-                     srslte_sync_sss_detected(&sync_find));
-      }
+  srslte_sync_find_ret_t sync_res;
 
-      // If the SSS was not detected, the serving_cell id is not reliable. So, consider no sync found
-      if (sync_res == SRSLTE_SYNC_FOUND && sss_detected && cell_id >= 0) {
-        // We have found a new cell, add to the list
-        found_cell_ids.insert((uint32_t)cell_id);
-        log_h->debug("INTRA: Detected new cell_id=%d using PSS/SSS\n", cell_id);
+  srslte_sync_reset(&sync_find);
+  srslte_sync_cfo_reset(&sync_find, 0.0f);
+
+  sync_res          = SRSLTE_SYNC_NOFOUND;
+  bool sss_detected = false;
+  float max_peak    = -1;
+
+  float sss_correlation_peak_max = 0.0f;
+
+  for (uint32_t sf5_cnt = 0; sf5_cnt < nof_sf / 5; sf5_cnt++) {
+    sync_res = srslte_sync_find(&sync_find, input_buffer, sf5_cnt * 5 * sf_len, &peak_idx);
+    if (sync_res == SRSLTE_SYNC_ERROR) {
+      log_h->error("INTRA: Error calling sync_find()\n");
+      return -1;
+    }
+
+    if (sync_find.peak_value > max_peak && sync_res == SRSLTE_SYNC_FOUND && srslte_sync_sss_detected(&sync_find)) {
+
+      // Uses the cell ID from the highest SSS correlation peak
+      if (sss_correlation_peak_max < srslte_sync_sss_correlation_peak(&sync_find)) {
+        // Set the cell ID
+        cell_id = srslte_sync_get_cell_id(&sync_find);
+
+        // Update the maximum value
+        sss_correlation_peak_max = srslte_sync_sss_correlation_peak(&sync_find);
       }
+      sss_detected = true;
     }
+
+    log_h->debug("INTRA: n_id_2=%d, cnt=%d/%d, sync_res=%d, cell_id=%d, sf_idx=%d, peak_idx=%d, peak_value=%f, "
+                 "sss_detected=%d\n",
+                 n_id_2,
+                 sf5_cnt,
+                 nof_sf / 5,
+                 sync_res,
+                 cell_id,
+                 srslte_sync_get_sf_idx(&sync_find),
+                 peak_idx,
+                 sync_find.peak_value,
+                 srslte_sync_sss_detected(&sync_find));
   }
-  return found_cell_ids;
+
+  // If the SSS was not detected, the serving_cell id is not reliable. So, consider no sync found
+  if (sync_res == SRSLTE_SYNC_FOUND && sss_detected && cell_id >= 0) {
+    // We have found a new cell
+    log_h->debug("INTRA: Detected new cell_id=%d using PSS/SSS\n", cell_id);
+    return cell_id;
+  }
+  return -1;
 }
 
 } // namespace scell
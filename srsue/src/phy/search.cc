@@ -20,6 +20,7 @@
  */
 
 #include "srsue/hdr/phy/search.h"
+#include <chrono>
 
 #define Error(fmt, ...)                                                                                                \
   if (SRSLTE_DEBUG_ENABLED)                                                                                            \
@@ -50,11 +51,16 @@ static SRSLTE_AGC_CALLBACK(callback_set_rx_gain)
 
 search::~search()
 {
+  engine.stop();
   srslte_ue_mib_sync_free(&ue_mib_sync);
   srslte_ue_cellsearch_free(&cs);
 }
 
-void search::init(srslte::rf_buffer_t& buffer_, srslte::log* log_h_, uint32_t nof_rx_channels, search_callback* parent)
+void search::init(srslte::rf_buffer_t& buffer_,
+                  srslte::log*         log_h_,
+                  uint32_t             nof_rx_channels,
+                  search_callback*     parent,
+                  uint32_t             nof_engine_workers)
 {
   log_h = log_h_;
   p     = parent;
@@ -74,6 +80,17 @@ void search::init(srslte::rf_buffer_t& buffer_, srslte::log* log_h_, uint32_t no
   p->set_ue_sync_opts(&cs.ue_sync, 0);
 
   force_N_id_2 = -1;
+
+  // The parallel cell search replaces the sequential PSS scan when it has worker threads
+  if (nof_engine_workers > 0) {
+    cell_search_engine::args_t engine_args = {};
+    engine_args.nof_workers                = nof_engine_workers;
+    engine_enabled                         = engine.init(engine_args, log_h);
+    capture_ms                             = engine_args.max_capture_ms;
+    if (not engine_enabled) {
+      Error("SYNC:  Initiating parallel cell search, using the sequential cell search\n");
+    }
+  }
 }
 
 void search::reset()
@@ -100,8 +117,13 @@ void search::set_agc_enable(bool enable)
   }
 }
 
-search::ret_code search::run(srslte_cell_t* cell_, std::array<uint8_t, SRSLTE_BCH_PAYLOAD_LEN>& bch_payload)
+search::ret_code
+search::run(srslte_cell_t* cell_, std::array<uint8_t, SRSLTE_BCH_PAYLOAD_LEN>& bch_payload, uint32_t earfcn)
 {
+  if (engine_enabled) {
+    return run_engine(cell_, bch_payload, earfcn);
+  }
+
   srslte_cell_t new_cell = {};
 
   srslte_ue_cellsearch_result_t found_cells[3];
@@ -142,6 +164,14 @@ search::ret_code search::run(srslte_cell_t* cell_, std::array<uint8_t, SRSLTE_BC
        cfo / 1000,
        srslte_cp_string(new_cell.cp));
 
+  return decode_mib(new_cell, cfo, cell_, bch_payload);
+}
+
+search::ret_code search::decode_mib(srslte_cell_t                                 new_cell,
+                                    float                                         cfo,
+                                    srslte_cell_t*                                cell_,
+                                    std::array<uint8_t, SRSLTE_BCH_PAYLOAD_LEN>& bch_payload)
+{
   if (srslte_ue_mib_sync_set_cell(&ue_mib_sync, new_cell)) {
     Error("SYNC:  Setting UE MIB cell\n");
     return ERROR;
@@ -154,7 +184,7 @@ search::ret_code search::run(srslte_cell_t* cell_, std::array<uint8_t, SRSLTE_BC
 
   /* Find and decode MIB */
   int sfn_offset;
-  ret = srslte_ue_mib_sync_decode(&ue_mib_sync, 40, bch_payload.data(), &new_cell.nof_ports, &sfn_offset);
+  int ret = srslte_ue_mib_sync_decode(&ue_mib_sync, 40, bch_payload.data(), &new_cell.nof_ports, &sfn_offset);
   if (ret == 1) {
     srslte_pbch_mib_unpack(bch_payload.data(), &new_cell, NULL);
     // pack MIB and store inplace for PCAP dump
@@ -197,4 +227,121 @@ search::ret_code search::run(srslte_cell_t* cell_, std::array<uint8_t, SRSLTE_BC
   }
 }
 
-}; // namespace srsue
\ No newline at end of file
+/* Receives capture_ms of samples from the first RF channel, one subframe at a time, through the sync callback */
+bool search::capture(double srate_hz)
+{
+  uint32_t sf_len = (uint32_t)round(srate_hz / 1000);
+  if (sf_len == 0 || sf_len > buffer.size()) {
+    Error("SYNC:  Invalid cell search capture rate %.2f MHz\n", srate_hz / 1e6);
+    return false;
+  }
+
+  capture_len = capture_ms * sf_len;
+  if (capture_buffer.size() < capture_len) {
+    capture_buffer.resize(capture_len);
+  }
+
+  srslte_timestamp_t rx_time = {};
+  buffer.set_nof_samples(sf_len);
+  for (uint32_t sf = 0; sf < capture_ms; sf++) {
+    if (p->radio_recv_fnc(buffer, &rx_time) != SRSLTE_SUCCESS) {
+      Error("SYNC:  Receiving cell search capture\n");
+      return false;
+    }
+    srslte_vec_cf_copy(&capture_buffer[sf * sf_len], buffer.get(0), sf_len);
+  }
+  return true;
+}
+
+search::ret_code
+search::run_engine(srslte_cell_t* cell_, std::array<uint8_t, SRSLTE_BCH_PAYLOAD_LEN>& bch_payload, uint32_t earfcn)
+{
+  cell_search_engine::cell_t found = {};
+
+  if (wb_searched.count(earfcn)) {
+    // The EARFCN was already searched in a wideband capture, only the MIB is left
+    auto it = wb_found.find(earfcn);
+    if (it == wb_found.end()) {
+      Info("SYNC:  Wideband cell search did not find any cell in EARFCN=%d\n", earfcn);
+      return CELL_NOT_FOUND;
+    }
+    found = it->second;
+  } else {
+    Info("SYNC:  Searching for cell...\n");
+    srslte::console(".");
+
+    auto t_capture = std::chrono::steady_clock::now();
+    if (not capture(SRSLTE_CS_SAMP_FREQ)) {
+      return ERROR;
+    }
+    uint64_t capture_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t_capture).count();
+
+    cell_search_engine::report_t report = {};
+    if (not engine.search(earfcn, capture_buffer.data(), capture_len, &report)) {
+      Error("SYNC:  Error running parallel cell search\n");
+      return ERROR;
+    }
+    if (report.cells.empty()) {
+      Info("SYNC:  Could not find any cell in this frequency\n");
+      return CELL_NOT_FOUND;
+    }
+    Info("SYNC:  Parallel cell search found %zd cells, time to first cell %.1f ms (capture %.1f ms)\n",
+         report.cells.size(),
+         (capture_us + report.first_cell_us) / 1000.0,
+         capture_us / 1000.0);
+    found = report.cells[0];
+  }
+
+  srslte_cell_t new_cell = {};
+  new_cell.id            = found.pci;
+  new_cell.cp            = found.cp;
+  new_cell.frame_type    = found.frame_type;
+  float cfo              = found.cfo_hz;
+
+  srslte::console("\n");
+  Info("SYNC:  PSS/SSS detected: Mode=%s, PCI=%d, CFO=%.1f KHz, CP=%s\n",
+       new_cell.frame_type ? "TDD" : "FDD",
+       new_cell.id,
+       cfo / 1000,
+       srslte_cp_string(new_cell.cp));
+
+  return decode_mib(new_cell, cfo, cell_, bch_payload);
+}
+
+bool search::run_wideband(const std::vector<uint32_t>& earfcns, double srate_hz, double center_freq_hz)
+{
+  if (not engine_enabled || earfcns.empty()) {
+    return false;
+  }
+
+  Info("SYNC:  Wideband cell search of %zd EARFCNs at %.1f MHz, srate=%.2f MHz\n",
+       earfcns.size(),
+       center_freq_hz / 1e6,
+       srate_hz / 1e6);
+
+  if (not capture(srate_hz)) {
+    return false;
+  }
+
+  cell_search_engine::report_t report = {};
+  if (not engine.search_wideband(capture_buffer.data(), capture_len, srate_hz, center_freq_hz, earfcns, &report)) {
+    Error("SYNC:  Error running wideband cell search\n");
+    return false;
+  }
+
+  wb_searched.insert(earfcns.begin(), earfcns.end());
+  // Cells are sorted strongest first, keep the strongest of each EARFCN
+  for (const cell_search_engine::cell_t& c : report.cells) {
+    wb_found.insert(std::make_pair(c.earfcn, c));
+  }
+  return true;
+}
+
+void search::clear_wideband()
+{
+  wb_found.clear();
+  wb_searched.clear();
+}
+
+}; // namespace srsue
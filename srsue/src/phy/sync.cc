@@ -92,7 +92,7 @@ void sync::init(srslte::radio_interface_phy* _radio,
   worker_com->set_nof_workers(nof_workers);
 
   // Initialize cell searcher
-  search_p.init(sf_buffer, log_h, nof_rf_channels, this);
+  search_p.init(sf_buffer, log_h, nof_rf_channels, this, worker_com->args->cell_search_threads);
 
   // Initialize SFN synchronizer, it uses only pcell buffer
   sfn_p.init(&ue_sync, worker_com->args, sf_buffer, sf_buffer.size(), log_h);
@@ -269,6 +269,7 @@ rrc_interface_phy_lte::cell_search_ret_t sync::cell_search_start(phy_cell_t* fou
   if (cellsearch_earfcn_index >= worker_com->args->dl_earfcn_list.size()) {
     Info("Cell Search: No more frequencies in the current EARFCN set\n");
     cellsearch_earfcn_index = 0;
+    search_p.clear_wideband();
     ret.last_freq           = rrc_interface_phy_lte::cell_search_ret_t::NO_MORE_FREQS;
   } else {
     ret.last_freq = rrc_interface_phy_lte::cell_search_ret_t::MORE_FREQS;
@@ -380,13 +381,46 @@ bool sync::cell_is_camping()
 
 void sync::run_cell_search_state()
 {
-  cell_search_ret = search_p.run(&cell, mib);
+  if (search_p.is_engine_enabled() and worker_com->args->cell_search_wideband_srate > 0 and
+      not search_p.is_wideband_searched(current_earfcn)) {
+    run_wideband_search();
+  }
+
+  cell_search_ret = search_p.run(&cell, mib, current_earfcn);
   if (cell_search_ret == search::CELL_FOUND) {
     stack->bch_decoded_ok(SYNC_CC_IDX, mib.data(), mib.size() / 8);
   }
   phy_state.state_exit();
 }
 
+void sync::run_wideband_search()
+{
+  // Forced frequencies do not correspond to the EARFCN list
+  if (dl_freq > 0 && ul_freq > 0) {
+    return;
+  }
+
+  double                srate   = worker_com->args->cell_search_wideband_srate;
+  double                center  = 0;
+  std::vector<uint32_t> earfcns = cell_search_engine::group_earfcns(
+      worker_com->args->dl_earfcn_list, cellsearch_earfcn_index, srate, &center);
+
+  // A single EARFCN is searched faster at the cell search rate
+  if (earfcns.size() < 2) {
+    return;
+  }
+
+  radio_h->set_rx_srate(srate);
+  radio_h->set_rx_freq(0, center);
+
+  if (not search_p.run_wideband(earfcns, srate, center)) {
+    Warning("Cell Search: Wideband search failed, searching EARFCN=%d alone\n", current_earfcn);
+  }
+
+  radio_h->set_rx_srate(SRSLTE_CS_SAMP_FREQ);
+  set_frequency();
+}
+
 void sync::run_sfn_sync_state()
 {
   srslte_cell_t temp_cell = cell;
@@ -24,6 +24,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <inttypes.h>
 #include <linux/if_tun.h>
 #include <linux/ip.h>
 #include <linux/netlink.h>
@@ -34,7 +35,7 @@
 
 namespace srsue {
 
-gw::gw() : thread("GW"), pool(srslte::byte_buffer_pool::get_instance()), tft_matcher(&log) {}
+gw::gw() : pool(srslte::byte_buffer_pool::get_instance()), tun(&log), tft_matcher(&log) {}
 
 int gw::init(const gw_args_t& args_, srslte::logger* logger_, stack_interface_gw* stack_)
 {
@@ -71,18 +72,17 @@ void gw::stop()
   if (run_enable) {
     run_enable = false;
     if (if_up) {
-      close(tun_fd);
-
-      // Wait thread to exit gracefully otherwise might leave a mutex locked
-      int cnt = 0;
-      while (running && cnt < 100) {
-        usleep(10000);
-        cnt++;
-      }
-      if (running) {
-        thread_cancel();
-      }
-      wait_thread_finish();
+      // Receive threads poll the TUN queues and exit once run_enable is cleared
+      tun.stop();
+      tun_io_stats_t s = tun.get_stats();
+      log.info("TUN I/O: rx_pkts=%" PRIu64 ", rx_sdus=%" PRIu64 ", rx_dropped=%" PRIu64 ", tx_pkts=%" PRIu64
+               ", tx_writes=%" PRIu64 ", tx_dropped=%" PRIu64 "\n",
+               s.rx_pkts,
+               s.rx_sdus,
+               s.rx_dropped,
+               s.tx_pkts,
+               s.tx_writes,
+               s.tx_dropped);
 
       current_ip_addr = 0;
     }
@@ -100,12 +100,11 @@ void gw::get_metrics(gw_metrics_t& m)
   double secs = (double)metrics_time[0].tv_sec + metrics_time[0].tv_usec * 1e-6;
 
   m.dl_tput_mbps = (dl_tput_bytes * 8 / (double)1e6) / secs;
-  m.ul_tput_mbps = (ul_tput_bytes * 8 / (double)1e6) / secs;
+  m.ul_tput_mbps = (ul_tput_bytes.exchange(0) * 8 / (double)1e6) / secs;
   log.info("RX throughput: %4.6f Mbps. TX throughput: %4.6f Mbps.\n", m.dl_tput_mbps, m.ul_tput_mbps);
 
   memcpy(&metrics_time[1], &metrics_time[2], sizeof(struct timeval));
   dl_tput_bytes = 0;
-  ul_tput_bytes = 0;
 }
 
 /*******************************************************************************
@@ -124,10 +123,7 @@ void gw::write_pdu(uint32_t lcid, srslte::unique_byte_buffer_t pdu)
     // Only handle IPv4 and IPv6 packets
     struct iphdr* ip_pkt = (struct iphdr*)pdu->msg;
     if (ip_pkt->version == 4 || ip_pkt->version == 6) {
-      int n = write(tun_fd, pdu->msg, pdu->N_bytes);
-      if (n > 0 && (pdu->N_bytes != (uint32_t)n)) {
-        log.warning("DL TUN/TAP write failure. Wanted to write %d B but only wrote %d B.\n", pdu->N_bytes, n);
-      }
+      tun.write_pdu(std::move(pdu));
     } else {
       log.error("Unsupported IP version. Dropping packet with %d B\n", pdu->N_bytes);
     }
@@ -150,14 +146,22 @@ void gw::write_pdu_mch(uint32_t lcid, srslte::unique_byte_buffer_t pdu)
     if (!if_up) {
       log.warning("TUN/TAP not up - dropping gw RX message\n");
     } else {
-      int n = write(tun_fd, pdu->msg, pdu->N_bytes);
-      if (n > 0 && (pdu->N_bytes != (uint32_t)n)) {
-        log.warning("DL TUN/TAP write failure\n");
-      }
+      tun.write_pdu(std::move(pdu));
     }
   }
 }
 
+/*******************************************************************************
+  Stack interface
+*******************************************************************************/
+void gw::run_tti()
+{
+  // Write the DL packets collected during this TTI
+  if (if_up) {
+    tun.flush();
+  }
+}
+
 /*******************************************************************************
   NAS interface
 *******************************************************************************/
@@ -180,8 +184,8 @@ int gw::setup_if_addr(uint32_t lcid, uint8_t pdn_type, uint32_t ip_addr, uint8_t
   default_lcid = lcid;
   tft_matcher.set_default_lcid(lcid);
 
-  // Setup a thread to receive packets from the TUN device
-  start(GW_THREAD_PRIO);
+  // Setup the threads to receive packets from the TUN device
+  tun.start(this, GW_THREAD_PRIO);
   return SRSLTE_SUCCESS;
 }
 
@@ -210,100 +214,35 @@ void gw::add_mch_port(uint32_t lcid, uint32_t port)
 /********************/
 /*    GW Receive    */
 /********************/
-void gw::run_thread()
+void gw::tun_rx_pdu(uint32_t queue_idx, srslte::unique_byte_buffer_t pdu)
 {
-  uint32 idx     = 0;
-  int32  N_bytes = 0;
-
-  srslte::unique_byte_buffer_t pdu = srslte::allocate_unique_buffer(*pool, true);
-  if (!pdu) {
-    log.error("Fatal Error: Couldn't allocate PDU in run_thread().\n");
-    return;
-  }
-
   const static uint32_t ATTACH_WAIT_TOUT = 40; // 4 sec
   uint32_t              attach_wait      = 0;
 
-  log.info("GW IP packet receiver thread run_enable\n");
+  log.info_hex(pdu->msg, pdu->N_bytes, "TX PDU");
 
-  running = true;
-  while (run_enable) {
-    if (SRSLTE_MAX_BUFFER_SIZE_BYTES - SRSLTE_BUFFER_HEADER_OFFSET > idx) {
-      N_bytes = read(tun_fd, &pdu->msg[idx], SRSLTE_MAX_BUFFER_SIZE_BYTES - SRSLTE_BUFFER_HEADER_OFFSET - idx);
-    } else {
-      log.error("GW pdu buffer full - gw receive thread exiting.\n");
-      srslte::console("GW pdu buffer full - gw receive thread exiting.\n");
-      break;
+  while (run_enable && !stack->is_lcid_enabled(default_lcid) && attach_wait < ATTACH_WAIT_TOUT) {
+    if (!attach_wait) {
+      log.info("LCID=%d not active, requesting NAS attach (%d/%d)\n", default_lcid, attach_wait, ATTACH_WAIT_TOUT);
+      if (not stack->switch_on()) {
+        log.warning("Could not re-establish the connection\n");
+      }
     }
-    log.debug("Read %d bytes from TUN fd=%d, idx=%d\n", N_bytes, tun_fd, idx);
-    if (N_bytes > 0) {
-      struct iphdr*   ip_pkt  = (struct iphdr*)pdu->msg;
-      struct ipv6hdr* ip6_pkt = (struct ipv6hdr*)pdu->msg;
-      uint16_t        pkt_len = 0;
-      pdu->N_bytes            = idx + N_bytes;
-      if (ip_pkt->version == 4 || ip_pkt->version == 6) {
-        if (ip_pkt->version == 4) {
-          pkt_len = ntohs(ip_pkt->tot_len);
-        } else if (ip_pkt->version == 6) {
-          pkt_len = ntohs(ip6_pkt->payload_len) + 40;
-        } else {
-          log.error_hex(pdu->msg, pdu->N_bytes, "Unsupported IP version. Dropping packet.\n");
-          continue;
-        }
-        log.debug("IPv%d packet total length: %d Bytes\n", ip_pkt->version, pkt_len);
-        // Check if entire packet was received
-        if (pkt_len == pdu->N_bytes) {
-          log.info_hex(pdu->msg, pdu->N_bytes, "TX PDU");
-
-          while (run_enable && !stack->is_lcid_enabled(default_lcid) && attach_wait < ATTACH_WAIT_TOUT) {
-            if (!attach_wait) {
-              log.info(
-                  "LCID=%d not active, requesting NAS attach (%d/%d)\n", default_lcid, attach_wait, ATTACH_WAIT_TOUT);
-              if (not stack->switch_on()) {
-                log.warning("Could not re-establish the connection\n");
-              }
-            }
-            usleep(100000);
-            attach_wait++;
-          }
-
-          attach_wait = 0;
+    usleep(100000);
+    attach_wait++;
+  }
 
-          if (!run_enable) {
-            break;
-          }
+  if (!run_enable) {
+    return;
+  }
 
-          uint8_t lcid = tft_matcher.check_tft_filter_match(pdu);
-          // Send PDU directly to PDCP
-          if (stack->is_lcid_enabled(lcid)) {
-            pdu->set_timestamp();
-            ul_tput_bytes += pdu->N_bytes;
-            stack->write_sdu(lcid, std::move(pdu));
-            do {
-              pdu = srslte::allocate_unique_buffer(*pool);
-              if (!pdu) {
-                log.error("Fatal Error: Couldn't allocate PDU in run_thread().\n");
-                usleep(100000);
-              }
-            } while (!pdu);
-            idx = 0;
-          }
-        } else {
-          idx += N_bytes;
-          log.debug(
-              "Entire packet not read from socket. Total Length %d, N_Bytes %d.\n", ip_pkt->tot_len, pdu->N_bytes);
-        }
-      } else {
-        log.error("IP Version not handled. Version %d\n", ip_pkt->version);
-      }
-    } else {
-      log.error("Failed to read from TUN interface - gw receive thread exiting.\n");
-      srslte::console("Failed to read from TUN interface - gw receive thread exiting.\n");
-      break;
-    }
+  uint8_t lcid = tft_matcher.check_tft_filter_match(pdu);
+  // Send PDU directly to PDCP
+  if (stack->is_lcid_enabled(lcid)) {
+    pdu->set_timestamp();
+    ul_tput_bytes += pdu->N_bytes;
+    stack->write_sdu(lcid, std::move(pdu));
   }
-  running = false;
-  log.info("GW IP receiver thread exiting.\n");
 }
 
 /**************************/
@@ -332,24 +271,12 @@ int gw::init_if(char* err_str)
     }
   }
 
-  // Construct the TUN device
-  tun_fd = open("/dev/net/tun", O_RDWR);
-  log.info("TUN file descriptor = %d\n", tun_fd);
-  if (0 > tun_fd) {
-    err_str = strerror(errno);
-    log.error("Failed to open TUN device: %s\n", err_str);
-    return SRSLTE_ERROR_CANT_START;
-  }
-
+  // Construct the TUN device, one file descriptor per queue
   memset(&ifr, 0, sizeof(ifr));
-  ifr.ifr_flags = IFF_TUN | IFF_NO_PI;
   strncpy(
       ifr.ifr_ifrn.ifrn_name, args.tun_dev_name.c_str(), std::min(args.tun_dev_name.length(), (size_t)(IFNAMSIZ - 1)));
   ifr.ifr_ifrn.ifrn_name[IFNAMSIZ - 1] = 0;
-  if (0 > ioctl(tun_fd, TUNSETIFF, &ifr)) {
-    err_str = strerror(errno);
-    log.error("Failed to set TUN device name: %s\n", err_str);
-    close(tun_fd);
+  if (tun.open(args.tun_io, &ifr) != SRSLTE_SUCCESS) {
     return SRSLTE_ERROR_CANT_START;
   }
 
@@ -358,14 +285,14 @@ int gw::init_if(char* err_str)
   if (0 > ioctl(sock, SIOCGIFFLAGS, &ifr)) {
     err_str = strerror(errno);
     log.error("Failed to bring up socket: %s\n", err_str);
-    close(tun_fd);
+    tun.stop();
     return SRSLTE_ERROR_CANT_START;
   }
   ifr.ifr_flags |= IFF_UP | IFF_RUNNING;
   if (0 > ioctl(sock, SIOCSIFFLAGS, &ifr)) {
     err_str = strerror(errno);
     log.error("Failed to set socket flags: %s\n", err_str);
-    close(tun_fd);
+    tun.stop();
     return SRSLTE_ERROR_CANT_START;
   }
 
@@ -400,7 +327,7 @@ int gw::setup_if_addr4(uint32_t ip_addr, char* err_str)
     if (0 > ioctl(sock, SIOCSIFADDR, &ifr)) {
       err_str = strerror(errno);
       log.debug("Failed to set socket address: %s\n", err_str);
-      close(tun_fd);
+      tun.stop();
       return SRSLTE_ERROR_CANT_START;
     }
     ifr.ifr_netmask.sa_family                                = AF_INET;
@@ -408,7 +335,7 @@ int gw::setup_if_addr4(uint32_t ip_addr, char* err_str)
     if (0 > ioctl(sock, SIOCSIFNETMASK, &ifr)) {
       err_str = strerror(errno);
       log.debug("Failed to set socket netmask: %s\n", err_str);
-      close(tun_fd);
+      tun.stop();
       return SRSLTE_ERROR_CANT_START;
     }
     current_ip_addr = ip_addr;
@@ -0,0 +1,635 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srsue/hdr/stack/upper/tun_io.h"
+
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/if_tun.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace srsue {
+
+namespace {
+
+const uint8_t  TCP_FLAG_FIN    = 0x01;
+const uint8_t  TCP_FLAG_PSH    = 0x08;
+const uint8_t  TCP_FLAG_ACK    = 0x10;
+const uint8_t  TCP_FLAG_CWR    = 0x80;
+const uint32_t TCP_HDR_MIN_LEN = 20;
+const uint32_t TCP_CSUM_OFFSET = 16;
+const uint32_t IPV4_HDR_LEN    = 20;
+const uint32_t IPV6_HDR_LEN    = 40;
+
+uint16_t get_be16(const uint8_t* p)
+{
+  return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+uint32_t get_be32(const uint8_t* p)
+{
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+void set_be16(uint8_t* p, uint16_t v)
+{
+  p[0] = v >> 8;
+  p[1] = v & 0xff;
+}
+
+void set_be32(uint8_t* p, uint32_t v)
+{
+  p[0] = v >> 24;
+  p[1] = (v >> 16) & 0xff;
+  p[2] = (v >> 8) & 0xff;
+  p[3] = v & 0xff;
+}
+
+uint16_t csum_fold(uint64_t sum)
+{
+  while (sum >> 16) {
+    sum = (sum & 0xffff) + (sum >> 16);
+  }
+  return (uint16_t)sum;
+}
+
+// Internet checksum (RFC 1071) accumulation over 16-bit big-endian words. The bulk is summed 8 bytes at a time in
+// host order, which gives the byte-swapped result of the big-endian sum (RFC 1071 section 2.B).
+uint64_t csum_add(uint64_t sum, const uint8_t* p, uint32_t len)
+{
+  uint64_t acc = 0;
+  for (; len >= 8; len -= 8, p += 8) {
+    uint64_t w;
+    memcpy(&w, p, sizeof(w));
+    acc += (w & 0xffffffff) + (w >> 32);
+  }
+  sum += ntohs(csum_fold(acc));
+  for (; len > 1; len -= 2, p += 2) {
+    sum += get_be16(p);
+  }
+  if (len > 0) {
+    sum += (uint32_t)p[0] << 8;
+  }
+  return sum;
+}
+
+uint64_t pseudo_hdr_sum(const uint8_t* ip, uint8_t proto, uint32_t l4_len)
+{
+  bool     v4  = (ip[0] >> 4) == 4;
+  uint64_t sum = v4 ? csum_add(0, ip + 12, 8) : csum_add(0, ip + 8, 32);
+  return sum + proto + l4_len;
+}
+
+void set_ipv4_csum(uint8_t* ip)
+{
+  set_be16(ip + 10, 0);
+  set_be16(ip + 10, ~csum_fold(csum_add(0, ip, (ip[0] & 0xf) * 4)));
+}
+
+void set_tcp_csum(uint8_t* ip, uint32_t l4_off, uint32_t len)
+{
+  uint8_t* th = ip + l4_off;
+  set_be16(th + TCP_CSUM_OFFSET, 0);
+  uint64_t sum = pseudo_hdr_sum(ip, IPPROTO_TCP, len - l4_off);
+  set_be16(th + TCP_CSUM_OFFSET, ~csum_fold(csum_add(sum, th, len - l4_off)));
+}
+
+struct tcp_seg_t {
+  bool     v4;
+  uint32_t l4_off;
+  uint32_t hdr_len;
+  uint32_t payload_len;
+  uint32_t seq;
+  uint8_t  flags;
+};
+
+// Only plain TCP segments, i.e. IPv4 without options or fragmentation and IPv6 without extension headers, take part
+// in coalescing
+bool parse_tcp_seg(const uint8_t* p, uint32_t len, tcp_seg_t* seg)
+{
+  if (len < IPV4_HDR_LEN) {
+    return false;
+  }
+  seg->v4 = (p[0] >> 4) == 4;
+  if (seg->v4) {
+    if (p[0] != 0x45 or get_be16(p + 2) != len or p[9] != IPPROTO_TCP or (get_be16(p + 6) & 0x3fff) != 0) {
+      return false;
+    }
+    seg->l4_off = IPV4_HDR_LEN;
+  } else {
+    if ((p[0] >> 4) != 6 or len < IPV6_HDR_LEN or p[6] != IPPROTO_TCP or get_be16(p + 4) + IPV6_HDR_LEN != len) {
+      return false;
+    }
+    seg->l4_off = IPV6_HDR_LEN;
+  }
+  if (seg->l4_off + TCP_HDR_MIN_LEN > len) {
+    return false;
+  }
+  const uint8_t* th = p + seg->l4_off;
+  seg->hdr_len      = seg->l4_off + (th[12] >> 4) * 4;
+  if (seg->hdr_len < seg->l4_off + TCP_HDR_MIN_LEN or seg->hdr_len > len) {
+    return false;
+  }
+  seg->payload_len = len - seg->hdr_len;
+  seg->seq         = get_be32(th + 4);
+  seg->flags       = th[13];
+  return true;
+}
+
+// Compares all header fields that must be equal for two segments to be merged, skipping lengths, IPv4 ID,
+// sequence number, flags and checksums
+bool same_flow(const uint8_t* a, const uint8_t* b, const tcp_seg_t& seg)
+{
+  if (seg.v4) {
+    if (memcmp(a, b, 2) != 0 or memcmp(a + 6, b + 6, 4) != 0 or memcmp(a + 12, b + 12, 8) != 0) {
+      return false;
+    }
+  } else if (memcmp(a, b, 4) != 0 or memcmp(a + 6, b + 6, IPV6_HDR_LEN - 6) != 0) {
+    return false;
+  }
+  const uint8_t* ta = a + seg.l4_off;
+  const uint8_t* tb = b + seg.l4_off;
+  return memcmp(ta, tb, 4) == 0 and memcmp(ta + 8, tb + 8, 5) == 0 and memcmp(ta + 14, tb + 14, 2) == 0 and
+         memcmp(ta + 18, tb + 18, seg.hdr_len - seg.l4_off - 18) == 0;
+}
+
+} // namespace
+
+class tun_io::rx_worker : public srslte::thread
+{
+public:
+  rx_worker(tun_io* parent_, uint32_t queue_idx_) :
+    thread("GW_RX" + std::to_string(queue_idx_)),
+    parent(parent_),
+    queue_idx(queue_idx_)
+  {}
+
+private:
+  void run_thread() override { parent->rx_loop(queue_idx); }
+
+  tun_io*  parent;
+  uint32_t queue_idx;
+};
+
+tun_io::tun_io(srslte::log* log_) : log(log_), pool(srslte::byte_buffer_pool::get_instance()) {}
+
+tun_io::~tun_io()
+{
+  stop();
+}
+
+int tun_io::open(const tun_io_args_t& args_, struct ifreq* ifr)
+{
+  if (is_open()) {
+    return SRSLTE_ERROR_ALREADY_STARTED;
+  }
+
+  std::vector<int> new_fds;
+  auto             close_fds = [&new_fds]() {
+    for (int fd : new_fds) {
+      close(fd);
+    }
+  };
+
+  short flags = IFF_TUN | IFF_NO_PI;
+  if (args_.nof_queues > 1) {
+    flags |= IFF_MULTI_QUEUE;
+  }
+  if (args_.vnet_hdr) {
+    flags |= IFF_VNET_HDR;
+  }
+
+  for (uint32_t i = 0; i < std::max(args_.nof_queues, 1u); ++i) {
+    int fd = ::open("/dev/net/tun", O_RDWR);
+    log->info("TUN file descriptor = %d (queue %d)\n", fd, i);
+    if (0 > fd) {
+      log->error("Failed to open TUN device: %s\n", strerror(errno));
+      close_fds();
+      return SRSLTE_ERROR_CANT_START;
+    }
+    new_fds.push_back(fd);
+
+    ifr->ifr_flags = flags;
+    if (0 > ioctl(fd, TUNSETIFF, ifr)) {
+      log->error("Failed to set TUN device name: %s\n", strerror(errno));
+      close_fds();
+      return SRSLTE_ERROR_CANT_START;
+    }
+  }
+
+  if (args_.vnet_hdr) {
+    // Let the kernel pass partially checksummed packets and TCP super-packets, they are completed and split here
+    unsigned long offload = TUN_F_CSUM | TUN_F_TSO4 | TUN_F_TSO6;
+    if (0 > ioctl(new_fds[0], TUNSETOFFLOAD, offload)) {
+      log->warning("Failed to enable TUN offloads: %s\n", strerror(errno));
+    }
+  }
+
+  return attach(args_, new_fds);
+}
+
+int tun_io::attach(const tun_io_args_t& args_, const std::vector<int>& fds_)
+{
+  if (is_open()) {
+    return SRSLTE_ERROR_ALREADY_STARTED;
+  }
+  if (fds_.empty()) {
+    log->error("No TUN file descriptors given\n");
+    return SRSLTE_ERROR;
+  }
+
+  // Reads poll once the queue runs empty, so a blocked receive thread still notices stop()
+  for (int fd : fds_) {
+    int fl = fcntl(fd, F_GETFL);
+    if (fl < 0 or fcntl(fd, F_SETFL, fl | O_NONBLOCK) < 0) {
+      log->error("Failed to set non-blocking TUN fd=%d: %s\n", fd, strerror(errno));
+      return SRSLTE_ERROR;
+    }
+  }
+
+  args            = args_;
+  args.nof_queues = fds_.size();
+  fds             = fds_;
+  dl_pending.reserve(MAX_DL_BATCH);
+  return SRSLTE_SUCCESS;
+}
+
+void tun_io::start(tun_io_rx_handler* handler_, int prio)
+{
+  if (not is_open() or not workers.empty()) {
+    return;
+  }
+  handler    = handler_;
+  run_enable = true;
+  for (uint32_t i = 0; i < fds.size(); ++i) {
+    workers.emplace_back(new rx_worker(this, i));
+    workers.back()->start(prio);
+  }
+}
+
+void tun_io::stop()
+{
+  run_enable = false;
+  for (auto& w : workers) {
+    w->wait_thread_finish();
+  }
+  workers.clear();
+  dl_pending.clear();
+  for (int fd : fds) {
+    close(fd);
+  }
+  fds.clear();
+}
+
+tun_io_stats_t tun_io::get_stats() const
+{
+  tun_io_stats_t s = {};
+  s.rx_pkts        = rx_pkts.load(std::memory_order_relaxed);
+  s.rx_sdus        = rx_sdus.load(std::memory_order_relaxed);
+  s.rx_dropped     = rx_dropped.load(std::memory_order_relaxed);
+  s.tx_pkts        = tx_pkts.load(std::memory_order_relaxed);
+  s.tx_writes      = tx_writes.load(std::memory_order_relaxed);
+  s.tx_dropped     = tx_dropped.load(std::memory_order_relaxed);
+  return s;
+}
+
+/********************/
+/*    TUN Receive   */
+/********************/
+srslte::unique_byte_buffer_t tun_io::allocate_pdu()
+{
+  srslte::unique_byte_buffer_t pdu = srslte::allocate_unique_buffer(*pool);
+  while (not pdu and run_enable) {
+    log->error("Fatal Error: Couldn't allocate PDU in TUN receive thread.\n");
+    usleep(100000);
+    pdu = srslte::allocate_unique_buffer(*pool);
+  }
+  return pdu;
+}
+
+void tun_io::deliver(uint32_t queue_idx, srslte::unique_byte_buffer_t pdu)
+{
+  rx_sdus.fetch_add(1, std::memory_order_relaxed);
+  handler->tun_rx_pdu(queue_idx, std::move(pdu));
+}
+
+void tun_io::rx_loop(uint32_t queue_idx)
+{
+  const uint32_t max_pdu_len = SRSLTE_MAX_BUFFER_SIZE_BYTES - SRSLTE_BUFFER_HEADER_OFFSET;
+  int            fd          = fds[queue_idx];
+  uint32_t       idx         = 0;
+
+  // With virtio-net headers a single read can return a super-packet larger than a PDU buffer
+  std::vector<uint8_t>         rx_buf(args.vnet_hdr ? sizeof(tun_vnet_hdr_t) + MAX_GSO_BYTES : 0);
+  srslte::unique_byte_buffer_t pdu;
+
+  log->info("GW IP packet receiver thread for TUN queue %d running\n", queue_idx);
+
+  while (run_enable) {
+    if (not args.vnet_hdr and not pdu) {
+      pdu = allocate_pdu();
+      if (not pdu) {
+        break;
+      }
+      idx = 0;
+    }
+
+    ssize_t N_bytes = 0;
+    if (args.vnet_hdr) {
+      N_bytes = read(fd, rx_buf.data(), rx_buf.size());
+    } else if (max_pdu_len > idx) {
+      N_bytes = read(fd, &pdu->msg[idx], max_pdu_len - idx);
+    } else {
+      log->error("GW pdu buffer full - gw receive thread exiting.\n");
+      srslte::console("GW pdu buffer full - gw receive thread exiting.\n");
+      break;
+    }
+
+    if (N_bytes < 0 and (errno == EAGAIN or errno == EWOULDBLOCK or errno == EINTR)) {
+      struct pollfd pfd = {fd, POLLIN, 0};
+      poll(&pfd, 1, POLL_TIMEOUT_MS);
+      continue;
+    }
+    if (N_bytes <= 0) {
+      log->error("Failed to read from TUN interface - gw receive thread exiting.\n");
+      srslte::console("Failed to read from TUN interface - gw receive thread exiting.\n");
+      break;
+    }
+    log->debug("Read %zd bytes from TUN fd=%d, idx=%d\n", N_bytes, fd, idx);
+    rx_pkts.fetch_add(1, std::memory_order_relaxed);
+
+    if (args.vnet_hdr) {
+      rx_vnet_pkt(queue_idx, rx_buf.data(), N_bytes);
+      continue;
+    }
+
+    uint8_t  version = pdu->msg[0] >> 4;
+    uint32_t pkt_len = 0;
+    pdu->N_bytes     = idx + N_bytes;
+    if (version == 4) {
+      pkt_len = get_be16(&pdu->msg[2]);
+    } else if (version == 6) {
+      pkt_len = get_be16(&pdu->msg[4]) + IPV6_HDR_LEN;
+    } else {
+      log->error("IP Version not handled. Version %d\n", version);
+      rx_dropped.fetch_add(1, std::memory_order_relaxed);
+      idx = 0;
+      continue;
+    }
+    log->debug("IPv%d packet total length: %d Bytes\n", version, pkt_len);
+
+    // Check if entire packet was received
+    if (pkt_len == pdu->N_bytes) {
+      deliver(queue_idx, std::move(pdu));
+    } else if (pkt_len > pdu->N_bytes) {
+      idx += N_bytes;
+      log->debug("Entire packet not read from socket. Total Length %d, N_Bytes %d.\n", pkt_len, pdu->N_bytes);
+    } else {
+      log->warning("IP packet length %d B shorter than read %d B. Dropping packet.\n", pkt_len, pdu->N_bytes);
+      rx_dropped.fetch_add(1, std::memory_order_relaxed);
+      idx = 0;
+    }
+  }
+  log->info("GW IP receiver thread for TUN queue %d exiting.\n", queue_idx);
+}
+
+void tun_io::rx_vnet_pkt(uint32_t queue_idx, uint8_t* buf, uint32_t len)
+{
+  const uint32_t max_pdu_len = SRSLTE_MAX_BUFFER_SIZE_BYTES - SRSLTE_BUFFER_HEADER_OFFSET;
+
+  if (len <= sizeof(tun_vnet_hdr_t)) {
+    log->warning("TUN read of %d B too small to hold a virtio-net header. Dropping packet.\n", len);
+    rx_dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  tun_vnet_hdr_t vh;
+  memcpy(&vh, buf, sizeof(vh));
+  uint8_t* pkt      = buf + sizeof(vh);
+  uint8_t  gso_type = vh.gso_type & ~tun_vnet_hdr_t::GSO_ECN;
+  bool     csum     = vh.flags & tun_vnet_hdr_t::F_NEEDS_CSUM;
+  len -= sizeof(vh);
+
+  if (csum and vh.csum_start + vh.csum_offset + 2u > len) {
+    log->warning(
+        "Invalid checksum offset %d+%d in %d B packet. Dropping packet.\n", vh.csum_start, vh.csum_offset, len);
+    rx_dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  if (gso_type == tun_vnet_hdr_t::GSO_NONE) {
+    if (len > max_pdu_len) {
+      log->warning("Packet of %d B exceeds PDU buffer. Dropping packet.\n", len);
+      rx_dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    if (csum) {
+      // The checksum field holds the pseudo-header sum, complete it over the L4 header and payload
+      uint16_t c = ~csum_fold(csum_add(0, pkt + vh.csum_start, len - vh.csum_start));
+      set_be16(pkt + vh.csum_start + vh.csum_offset, c == 0 ? 0xffff : c);
+    }
+    srslte::unique_byte_buffer_t pdu = allocate_pdu();
+    if (not pdu) {
+      rx_dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    memcpy(pdu->msg, pkt, len);
+    pdu->N_bytes = len;
+    deliver(queue_idx, std::move(pdu));
+    return;
+  }
+
+  bool v4 = gso_type == tun_vnet_hdr_t::GSO_TCPV4;
+  if ((not v4 and gso_type != tun_vnet_hdr_t::GSO_TCPV6) or not csum or (pkt[0] >> 4) != (v4 ? 4 : 6)) {
+    log->warning("Unsupported GSO type %d. Dropping packet with %d B\n", gso_type, len);
+    rx_dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  // Split the super-packet in gso_size chunks, each with a copy of the IP and TCP headers
+  uint32_t l4_off  = vh.csum_start;
+  uint32_t hdr_len = l4_off + TCP_HDR_MIN_LEN <= len ? l4_off + (pkt[l4_off + 12] >> 4) * 4 : len + 1;
+  uint32_t mss     = vh.gso_size;
+  if (hdr_len > len or mss == 0 or hdr_len + mss > max_pdu_len) {
+    log->warning("Malformed GSO packet (hdr_len=%d, gso_size=%d, len=%d). Dropping packet.\n", hdr_len, mss, len);
+    rx_dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  uint32_t payload_len = len - hdr_len;
+  uint32_t seq         = get_be32(pkt + l4_off + 4);
+  uint16_t ip_id       = v4 ? get_be16(pkt + 4) : 0;
+  uint8_t  flags       = pkt[l4_off + 13];
+
+  for (uint32_t off = 0, i = 0; off < payload_len; off += mss, ++i) {
+    uint32_t                     seg_len = std::min(mss, payload_len - off);
+    srslte::unique_byte_buffer_t pdu     = allocate_pdu();
+    if (not pdu) {
+      rx_dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    memcpy(pdu->msg, pkt, hdr_len);
+    memcpy(pdu->msg + hdr_len, pkt + hdr_len + off, seg_len);
+    pdu->N_bytes = hdr_len + seg_len;
+
+    uint8_t* ip = pdu->msg;
+    uint8_t* th = ip + l4_off;
+    if (v4) {
+      set_be16(ip + 2, pdu->N_bytes);
+      set_be16(ip + 4, ip_id + i);
+      set_ipv4_csum(ip);
+    } else {
+      set_be16(ip + 4, pdu->N_bytes - IPV6_HDR_LEN);
+    }
+    set_be32(th + 4, seq + off);
+    uint8_t seg_flags = flags;
+    if (off + seg_len < payload_len) {
+      seg_flags &= ~(TCP_FLAG_FIN | TCP_FLAG_PSH);
+    }
+    if (off > 0) {
+      seg_flags &= ~TCP_FLAG_CWR;
+    }
+    th[13] = seg_flags;
+    set_tcp_csum(ip, l4_off, pdu->N_bytes);
+
+    deliver(queue_idx, std::move(pdu));
+  }
+}
+
+/********************/
+/*    TUN Transmit  */
+/********************/
+void tun_io::write_pdu(srslte::unique_byte_buffer_t pdu)
+{
+  tx_pkts.fetch_add(1, std::memory_order_relaxed);
+  if (not args.dl_batch) {
+    write_chain(&pdu, 1);
+    return;
+  }
+  dl_pending.push_back(std::move(pdu));
+  if (dl_pending.size() >= MAX_DL_BATCH) {
+    flush();
+  }
+}
+
+void tun_io::flush()
+{
+  uint32_t i = 0;
+  while (i < dl_pending.size()) {
+    uint32_t n = args.vnet_hdr ? gro_chain_len(&dl_pending[i], dl_pending.size() - i) : 1;
+    write_chain(&dl_pending[i], n);
+    i += n;
+  }
+  dl_pending.clear();
+}
+
+// Number of PDUs, starting with the first one, that form a run of in-order full-sized segments of one TCP flow
+uint32_t tun_io::gro_chain_len(const srslte::unique_byte_buffer_t* pdus, uint32_t nof_pdus)
+{
+  tcp_seg_t first;
+  if (nof_pdus < 2 or not parse_tcp_seg(pdus[0]->msg, pdus[0]->N_bytes, &first) or first.flags != TCP_FLAG_ACK or
+      first.payload_len == 0) {
+    return 1;
+  }
+
+  tcp_seg_t prev  = first;
+  uint32_t  total = pdus[0]->N_bytes;
+  uint32_t  n     = 1;
+  while (n < nof_pdus and n < MAX_GRO_SEGS and prev.flags == TCP_FLAG_ACK and prev.payload_len == first.payload_len) {
+    const srslte::byte_buffer_t* p = pdus[n].get();
+    tcp_seg_t                    cur;
+    if (not parse_tcp_seg(p->msg, p->N_bytes, &cur) or cur.v4 != first.v4 or cur.hdr_len != first.hdr_len or
+        (cur.flags & ~TCP_FLAG_PSH) != TCP_FLAG_ACK or cur.payload_len == 0 or
+        cur.payload_len > first.payload_len or cur.seq != prev.seq + prev.payload_len or
+        total + cur.payload_len > MAX_GSO_BYTES or not same_flow(pdus[0]->msg, p->msg, first)) {
+      break;
+    }
+    total += cur.payload_len;
+    prev = cur;
+    n++;
+  }
+  return n;
+}
+
+void tun_io::write_chain(srslte::unique_byte_buffer_t* pdus, uint32_t nof_pdus)
+{
+  int     fd       = fds[0];
+  ssize_t expected = pdus[0]->N_bytes;
+  ssize_t n        = 0;
+
+  if (not args.vnet_hdr) {
+    n = write(fd, pdus[0]->msg, pdus[0]->N_bytes);
+  } else {
+    tun_vnet_hdr_t vh = {};
+    struct iovec   iov[MAX_GRO_SEGS + 1];
+    iov[0].iov_base = &vh;
+    iov[0].iov_len  = sizeof(vh);
+    iov[1].iov_base = pdus[0]->msg;
+    iov[1].iov_len  = pdus[0]->N_bytes;
+
+    if (nof_pdus > 1) {
+      // Append the payloads of the following segments and rewrite the first header to cover all of them
+      tcp_seg_t seg;
+      parse_tcp_seg(pdus[0]->msg, pdus[0]->N_bytes, &seg);
+      uint32_t total = pdus[0]->N_bytes;
+      for (uint32_t i = 1; i < nof_pdus; ++i) {
+        iov[i + 1].iov_base = pdus[i]->msg + seg.hdr_len;
+        iov[i + 1].iov_len  = pdus[i]->N_bytes - seg.hdr_len;
+        total += iov[i + 1].iov_len;
+      }
+
+      uint8_t* ip = pdus[0]->msg;
+      uint8_t* th = ip + seg.l4_off;
+      if (seg.v4) {
+        set_be16(ip + 2, total);
+        set_ipv4_csum(ip);
+      } else {
+        set_be16(ip + 4, total - IPV6_HDR_LEN);
+      }
+      th[13] |= pdus[nof_pdus - 1]->msg[seg.l4_off + 13] & TCP_FLAG_PSH;
+      // For partially checksummed packets the kernel expects the folded pseudo-header sum in the checksum field
+      set_be16(th + TCP_CSUM_OFFSET, csum_fold(pseudo_hdr_sum(ip, IPPROTO_TCP, total - seg.l4_off)));
+
+      vh.flags       = tun_vnet_hdr_t::F_NEEDS_CSUM;
+      vh.gso_type    = seg.v4 ? tun_vnet_hdr_t::GSO_TCPV4 : tun_vnet_hdr_t::GSO_TCPV6;
+      vh.hdr_len     = seg.hdr_len;
+      vh.gso_size    = seg.payload_len;
+      vh.csum_start  = seg.l4_off;
+      vh.csum_offset = TCP_CSUM_OFFSET;
+      expected       = total;
+    }
+    expected += sizeof(vh);
+    n = writev(fd, iov, nof_pdus + 1);
+  }
+
+  tx_writes.fetch_add(1, std::memory_order_relaxed);
+  if (n != expected) {
+    tx_dropped.fetch_add(nof_pdus, std::memory_order_relaxed);
+    log->warning("DL TUN/TAP write failure. Wanted to write %zd B but only wrote %zd B.\n", expected, n);
+  }
+}
+
+} // namespace srsue
@@ -0,0 +1,210 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srslte/common/log_filter.h"
+#include "srslte/common/test_common.h"
+#include "srslte/phy/resampling/resampler.h"
+#include "srsue/hdr/phy/cell_search_engine.h"
+#include <vector>
+
+using namespace srsue;
+
+#define SRATE_CS 1920000
+#define CAPTURE_MS 40
+
+static srslte_cell_t make_cell(uint32_t pci, srslte_cp_t cp)
+{
+  srslte_cell_t cell   = {};
+  cell.nof_prb         = 6;
+  cell.nof_ports       = 1;
+  cell.id              = pci;
+  cell.cp              = cp;
+  cell.phich_length    = SRSLTE_PHICH_NORM;
+  cell.phich_resources = SRSLTE_PHICH_R_1_6;
+  cell.frame_type      = SRSLTE_FDD;
+  return cell;
+}
+
+/* Adds to signal the downlink of a 6 PRB cell sampled at 1.92 MHz with unit average power, starting at subframe
+ * boundary offset and with the given carrier frequency offset and gain
+ */
+static int add_cell(std::vector<cf_t>& signal, const srslte_cell_t& cell, uint32_t offset, float cfo_hz, float gain_db)
+{
+  srslte_enb_dl_t enb_dl                       = {};
+  cf_t*           sf_buffer[SRSLTE_MAX_PORTS] = {};
+  uint32_t        sf_len                       = SRSLTE_SF_LEN_PRB(cell.nof_prb);
+  uint32_t        nof_sf                       = (signal.size() + offset) / sf_len + 1;
+  std::vector<cf_t> tx(nof_sf * sf_len);
+
+  sf_buffer[0] = srslte_vec_cf_malloc(sf_len);
+  TESTASSERT(sf_buffer[0] != nullptr);
+  TESTASSERT(srslte_enb_dl_init(&enb_dl, sf_buffer, cell.nof_prb) == SRSLTE_SUCCESS);
+  TESTASSERT(srslte_enb_dl_set_cell(&enb_dl, cell) == SRSLTE_SUCCESS);
+
+  for (uint32_t sf = 0; sf < nof_sf; sf++) {
+    srslte_dl_sf_cfg_t dl_sf = {};
+    dl_sf.tti                = sf;
+    srslte_enb_dl_put_base(&enb_dl, &dl_sf);
+    srslte_enb_dl_gen_signal(&enb_dl);
+    srslte_vec_cf_copy(&tx[sf * sf_len], sf_buffer[0], sf_len);
+  }
+
+  srslte_enb_dl_free(&enb_dl);
+  free(sf_buffer[0]);
+
+  float scale = srslte_convert_dB_to_amplitude(gain_db) / sqrtf(srslte_vec_avg_power_cf(tx.data(), tx.size()));
+  srslte_vec_sc_prod_cfc(tx.data(), scale, tx.data(), tx.size());
+  srslte_vec_apply_cfo(tx.data(), cfo_hz / SRATE_CS, tx.data(), tx.size());
+  srslte_vec_sum_ccc(signal.data(), &tx[offset], signal.data(), signal.size());
+
+  return SRSLTE_SUCCESS;
+}
+
+static const cell_search_engine::cell_t* find_cell(const cell_search_engine::report_t& report, uint32_t earfcn)
+{
+  for (const cell_search_engine::cell_t& c : report.cells) {
+    if (c.earfcn == earfcn) {
+      return &c;
+    }
+  }
+  return nullptr;
+}
+
+int test_single_earfcn(uint32_t nof_workers, srslte_cp_t cp)
+{
+  srslte::log_filter log("PHY");
+  log.set_level(srslte::LOG_LEVEL_WARNING);
+
+  cell_search_engine::args_t args = {};
+  args.nof_workers                = nof_workers;
+  cell_search_engine engine;
+  TESTASSERT(engine.init(args, &log));
+
+  // Strongest cell in N_id_2=1 with CFO and a weaker one in N_id_2=2, in noise
+  std::vector<cf_t> signal(CAPTURE_MS * SRATE_CS / 1000);
+  TESTASSERT(add_cell(signal, make_cell(301, cp), 1234, 2000.0f, 0.0f) == SRSLTE_SUCCESS);
+  TESTASSERT(add_cell(signal, make_cell(17, cp), 5678, -500.0f, -6.0f) == SRSLTE_SUCCESS);
+  srslte_ch_awgn_c(signal.data(), signal.data(), srslte_convert_dB_to_power(-3.0f), signal.size());
+
+  cell_search_engine::report_t report = {};
+  TESTASSERT(engine.search(3400, signal.data(), signal.size(), &report));
+  TESTASSERT(report.cells.size() == 2);
+  TESTASSERT(report.cells[0].earfcn == 3400);
+  TESTASSERT(report.cells[0].pci == 301);
+  TESTASSERT(report.cells[0].cp == cp);
+  TESTASSERT(report.cells[0].frame_type == SRSLTE_FDD);
+  TESTASSERT(fabsf(report.cells[0].cfo_hz - 2000.0f) < 200.0f);
+  TESTASSERT(report.cells[1].pci == 17);
+  TESTASSERT(report.cells[1].cp == cp);
+  TESTASSERT(fabsf(report.cells[1].cfo_hz + 500.0f) < 500.0f);
+  TESTASSERT(report.first_cell_us > 0 && report.first_cell_us <= report.total_us);
+
+  printf("Single EARFCN (%d workers, %s CP): time to first cell %.2f ms, total %.2f ms\n",
+         nof_workers,
+         srslte_cp_string(cp),
+         report.first_cell_us / 1000.0,
+         report.total_us / 1000.0);
+
+  // Noise only
+  std::vector<cf_t> noise(signal.size());
+  srslte_ch_awgn_c(noise.data(), noise.data(), 1.0f, noise.size());
+  TESTASSERT(engine.search(3400, noise.data(), noise.size(), &report));
+  TESTASSERT(report.cells.empty());
+  TESTASSERT(report.first_cell_us == 0);
+
+  engine.stop();
+  return SRSLTE_SUCCESS;
+}
+
+int test_wideband(uint32_t nof_workers)
+{
+  srslte::log_filter log("PHY");
+  log.set_level(srslte::LOG_LEVEL_WARNING);
+
+  cell_search_engine::args_t args = {};
+  args.nof_workers                = nof_workers;
+  cell_search_engine engine;
+  TESTASSERT(engine.init(args, &log));
+
+  // Band 7 EARFCNs 5 MHz apart plus one without any cell, captured at 15.36 MHz
+  const uint32_t              ratio      = 8;
+  const double                srate      = ratio * SRATE_CS;
+  const std::vector<uint32_t> earfcn_all = {3300, 3350, 3375, 3400, 5000};
+  const std::vector<uint32_t> earfcn_pci = {3300, 3350, 3400};
+  const uint32_t              pcis[]     = {7, 200, 412};
+
+  double                center  = 0;
+  std::vector<uint32_t> earfcns = cell_search_engine::group_earfcns(earfcn_all, 0, srate, &center);
+  TESTASSERT(earfcns.size() == 4);
+  TESTASSERT(fabs(center - 2680e6) < 1.0);
+
+  srslte_resampler_fft_t interp = {};
+  TESTASSERT(srslte_resampler_fft_init(&interp, SRSLTE_RESAMPLER_MODE_INTERPOLATE, ratio) == SRSLTE_SUCCESS);
+
+  std::vector<cf_t> wideband(CAPTURE_MS * SRATE_CS / 1000 * ratio);
+  std::vector<cf_t> upsampled(wideband.size());
+  for (uint32_t i = 0; i < earfcn_pci.size(); i++) {
+    std::vector<cf_t> baseband(CAPTURE_MS * SRATE_CS / 1000);
+    TESTASSERT(add_cell(baseband, make_cell(pcis[i], SRSLTE_CP_NORM), 1000 * i + 300, 300.0f * i, 0.0f) ==
+               SRSLTE_SUCCESS);
+    srslte_resampler_fft_reset(&interp);
+    srslte_resampler_fft_run(&interp, baseband.data(), upsampled.data(), baseband.size());
+    double offset = 1e6 * srslte_band_fd(earfcn_pci[i]) - center;
+    srslte_vec_apply_cfo(upsampled.data(), (float)(offset / srate), upsampled.data(), upsampled.size());
+    srslte_vec_sum_ccc(wideband.data(), upsampled.data(), wideband.data(), wideband.size());
+  }
+  srslte_resampler_fft_free(&interp);
+  srslte_ch_awgn_c(wideband.data(), wideband.data(), srslte_convert_dB_to_power(-3.0f), wideband.size());
+
+  cell_search_engine::report_t report = {};
+  TESTASSERT(engine.search_wideband(wideband.data(), wideband.size(), srate, center, earfcns, &report));
+  TESTASSERT(report.nof_channels == 4);
+  TESTASSERT(report.cells.size() == 3);
+  for (uint32_t i = 0; i < earfcn_pci.size(); i++) {
+    const cell_search_engine::cell_t* c = find_cell(report, earfcn_pci[i]);
+    TESTASSERT(c != nullptr);
+    TESTASSERT(c->pci == pcis[i]);
+    TESTASSERT(c->cp == SRSLTE_CP_NORM);
+    TESTASSERT(fabsf(c->cfo_hz - 300.0f * i) < 200.0f);
+  }
+  TESTASSERT(find_cell(report, 3375) == nullptr);
+
+  printf("Wideband %zd EARFCNs (%d workers): time to first cell %.2f ms, total %.2f ms\n",
+         earfcns.size(),
+         nof_workers,
+         report.first_cell_us / 1000.0,
+         report.total_us / 1000.0);
+
+  engine.stop();
+  return SRSLTE_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  TESTASSERT(test_single_earfcn(0, SRSLTE_CP_NORM) == SRSLTE_SUCCESS);
+  TESTASSERT(test_single_earfcn(3, SRSLTE_CP_NORM) == SRSLTE_SUCCESS);
+  TESTASSERT(test_single_earfcn(3, SRSLTE_CP_EXT) == SRSLTE_SUCCESS);
+  TESTASSERT(test_wideband(0) == SRSLTE_SUCCESS);
+  TESTASSERT(test_wideband(4) == SRSLTE_SUCCESS);
+
+  printf("Success\n");
+  return SRSLTE_SUCCESS;
+}
@@ -60,6 +60,7 @@ public:
   void add_mch_port(uint32_t lcid, uint32_t port);
   void write_pdu(uint32_t lcid, srslte::unique_byte_buffer_t pdu);
   void write_pdu_mch(uint32_t lcid, srslte::unique_byte_buffer_t pdu);
+  void run_tti() {}
   int  setup_if_addr(uint32_t lcid, uint8_t pdn_type, uint32_t ip_addr, uint8_t* ipv6_if_id, char* err_str);
 
   int apply_traffic_flow_template(const uint8_t&                                 eps_bearer_id,
@@ -0,0 +1,462 @@
+/*
+ * Copyright 2013-2020 Software Radio Systems Limited
+ *
+ * This file is part of srsLTE.
+ *
+ * srsLTE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * srsLTE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * A copy of the GNU Affero General Public License can be found in
+ * the LICENSE file in the top-level directory of this distribution
+ * and at http://www.gnu.org/licenses/.
+ *
+ */
+
+#include "srslte/common/log_filter.h"
+#include "srslte/common/test_common.h"
+#include "srsue/hdr/stack/upper/tun_io.h"
+#include <atomic>
+#include <chrono>
+#include <errno.h>
+#include <inttypes.h>
+#include <mutex>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace srsue;
+
+namespace {
+
+const uint32_t MSS     = 1400;
+const uint32_t V4_HDR  = 40; // IPv4 + TCP header
+const uint32_t V6_HDR  = 60; // IPv6 + TCP header
+const uint8_t  ACK     = 0x10;
+const uint8_t  PSH_ACK = 0x18;
+
+// Stub PDCP that takes the UL packets of the GW receive threads
+class pdcp_stub : public tun_io_rx_handler
+{
+public:
+  void tun_rx_pdu(uint32_t queue_idx, srslte::unique_byte_buffer_t pdu) override
+  {
+    nof_bytes += pdu->N_bytes;
+    if (keep_pdus) {
+      std::lock_guard<std::mutex> lock(mutex);
+      pdus.push_back(std::move(pdu));
+    }
+    nof_pdus++;
+  }
+
+  bool wait_pdus(uint64_t n, uint32_t timeout_ms = 5000)
+  {
+    for (uint32_t i = 0; i < timeout_ms and nof_pdus < n; ++i) {
+      usleep(1000);
+    }
+    return nof_pdus == n;
+  }
+
+  bool                                      keep_pdus = true;
+  std::atomic<uint64_t>                     nof_pdus  = {0};
+  std::atomic<uint64_t>                     nof_bytes = {0};
+  std::mutex                                mutex;
+  std::vector<srslte::unique_byte_buffer_t> pdus;
+};
+
+uint32_t csum_sum(const uint8_t* p, uint32_t len, uint32_t sum = 0)
+{
+  for (; len > 1; len -= 2, p += 2) {
+    sum += (p[0] << 8) | p[1];
+  }
+  if (len) {
+    sum += p[0] << 8;
+  }
+  while (sum >> 16) {
+    sum = (sum & 0xffff) + (sum >> 16);
+  }
+  return sum;
+}
+
+uint32_t pseudo_sum(const uint8_t* ip, uint32_t l4_len)
+{
+  bool v4 = (ip[0] >> 4) == 4;
+  return csum_sum(ip + (v4 ? 12 : 8), v4 ? 8 : 32, IPPROTO_TCP + l4_len);
+}
+
+bool ipv4_csum_ok(const uint8_t* ip)
+{
+  return csum_sum(ip, 20) == 0xffff;
+}
+
+bool tcp_csum_ok(const uint8_t* ip, uint32_t len)
+{
+  uint32_t l4_off = (ip[0] >> 4) == 4 ? 20 : 40;
+  return csum_sum(ip + l4_off, len - l4_off, pseudo_sum(ip, len - l4_off)) == 0xffff;
+}
+
+uint8_t pattern(uint32_t seq)
+{
+  return (seq * 7 + 3) & 0xff;
+}
+
+// Builds an IP/TCP packet of one flow, identified by src_port, whose payload bytes depend on their sequence number
+uint32_t build_tcp_pkt(uint8_t* p, bool v4, uint16_t src_port, uint32_t seq, uint32_t payload_len, uint8_t flags)
+{
+  uint32_t l4_off = v4 ? 20 : 40;
+  uint32_t len    = l4_off + 20 + payload_len;
+  memset(p, 0, l4_off + 20);
+  if (v4) {
+    uint8_t ip[] = {0x45, 0, (uint8_t)(len >> 8), (uint8_t)len, 0x12, 0x34, 0x40, 0, 64, IPPROTO_TCP, 0, 0,
+                    10,   0, 0,                   1,            10,   0,    0,    2};
+    memcpy(p, ip, sizeof(ip));
+    uint16_t c = ~csum_sum(p, 20);
+    p[10]      = c >> 8;
+    p[11]      = c & 0xff;
+  } else {
+    p[0] = 0x60;
+    p[4] = (len - 40) >> 8;
+    p[5] = (len - 40) & 0xff;
+    p[6] = IPPROTO_TCP;
+    p[7] = 64;
+    p[8] = p[24] = 0x20;
+    p[23]        = 1;
+    p[39]        = 2;
+  }
+  uint8_t* th = p + l4_off;
+  th[0]       = src_port >> 8;
+  th[1]       = src_port & 0xff;
+  th[2]       = 0x13;
+  th[3]       = 0x89;
+  th[4]       = seq >> 24;
+  th[5]       = (seq >> 16) & 0xff;
+  th[6]       = (seq >> 8) & 0xff;
+  th[7]       = seq & 0xff;
+  th[11]      = 1;
+  th[12]      = 5 << 4;
+  th[13]      = flags;
+  th[14]      = 0xff;
+  for (uint32_t i = 0; i < payload_len; ++i) {
+    th[20 + i] = pattern(seq + i);
+  }
+  uint16_t c = ~csum_sum(th, len - l4_off, pseudo_sum(p, len - l4_off));
+  th[16]     = c >> 8;
+  th[17]     = c & 0xff;
+  return len;
+}
+
+uint32_t get_u16(const uint8_t* p)
+{
+  return (p[0] << 8) | p[1];
+}
+
+uint32_t get_seq(const uint8_t* ip)
+{
+  const uint8_t* th = ip + ((ip[0] >> 4) == 4 ? 20 : 40);
+  return ((uint32_t)th[4] << 24) | (th[5] << 16) | (th[6] << 8) | th[7];
+}
+
+bool payload_ok(const uint8_t* p, uint32_t seq, uint32_t len)
+{
+  for (uint32_t i = 0; i < len; ++i) {
+    if (p[i] != pattern(seq + i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// A datagram socket pair stands in for each TUN queue, it keeps the packet boundaries like the TUN device does
+struct tun_emulator {
+  explicit tun_emulator(uint32_t nof_queues)
+  {
+    for (uint32_t i = 0; i < nof_queues; ++i) {
+      int sv[2];
+      if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sv) == 0) {
+        stack_fds.push_back(sv[0]);
+        kernel_fds.push_back(sv[1]);
+      }
+    }
+  }
+  ~tun_emulator()
+  {
+    for (int fd : kernel_fds) {
+      close(fd);
+    }
+  }
+  std::vector<int> stack_fds;
+  std::vector<int> kernel_fds;
+};
+
+int send_gso(int fd, bool v4, uint32_t seq, uint32_t payload_len, uint8_t flags)
+{
+  std::vector<uint8_t> buf(sizeof(tun_vnet_hdr_t) + V6_HDR + payload_len);
+  tun_vnet_hdr_t       vh = {};
+  vh.flags                = tun_vnet_hdr_t::F_NEEDS_CSUM;
+  vh.gso_type             = v4 ? tun_vnet_hdr_t::GSO_TCPV4 : tun_vnet_hdr_t::GSO_TCPV6;
+  vh.hdr_len              = v4 ? V4_HDR : V6_HDR;
+  vh.gso_size             = MSS;
+  vh.csum_start           = v4 ? 20 : 40;
+  vh.csum_offset          = 16;
+  memcpy(buf.data(), &vh, sizeof(vh));
+  uint32_t len = build_tcp_pkt(buf.data() + sizeof(vh), v4, 1000, seq, payload_len, flags);
+  return send(fd, buf.data(), sizeof(vh) + len, 0) == (ssize_t)(sizeof(vh) + len) ? SRSLTE_SUCCESS : SRSLTE_ERROR;
+}
+
+} // namespace
+
+int test_gso_split(bool v4)
+{
+  srslte::log_filter log("GW");
+  log.set_level(srslte::LOG_LEVEL_WARNING);
+
+  tun_emulator  tun_emu(1);
+  pdcp_stub     pdcp;
+  tun_io        tun(&log);
+  tun_io_args_t args = {};
+  args.vnet_hdr      = true;
+  TESTASSERT(tun.attach(args, tun_emu.stack_fds) == SRSLTE_SUCCESS);
+  tun.start(&pdcp, -1);
+
+  // A 20000 B super-packet arrives as 15 segments, the last one carrying the PSH flag
+  const uint32_t seq = 0xfffff000, payload_len = 20000, nof_segs = 15;
+  uint32_t       hdr_len = v4 ? V4_HDR : V6_HDR;
+  TESTASSERT(send_gso(tun_emu.kernel_fds[0], v4, seq, payload_len, PSH_ACK) == SRSLTE_SUCCESS);
+  TESTASSERT(pdcp.wait_pdus(nof_segs));
+
+  for (uint32_t i = 0; i < nof_segs; ++i) {
+    const srslte::unique_byte_buffer_t& pdu     = pdcp.pdus[i];
+    uint32_t                            seg_len = std::min(MSS, payload_len - i * MSS);
+    TESTASSERT(pdu->N_bytes == hdr_len + seg_len);
+    TESTASSERT(get_seq(pdu->msg) == seq + i * MSS);
+    TESTASSERT(payload_ok(pdu->msg + hdr_len, seq + i * MSS, seg_len));
+    TESTASSERT(tcp_csum_ok(pdu->msg, pdu->N_bytes));
+    TESTASSERT(pdu->msg[hdr_len - 7] == (i == nof_segs - 1 ? PSH_ACK : ACK));
+    if (v4) {
+      TESTASSERT(get_u16(&pdu->msg[2]) == pdu->N_bytes);
+      TESTASSERT(get_u16(&pdu->msg[4]) == 0x1234 + i);
+      TESTASSERT(ipv4_csum_ok(pdu->msg));
+    } else {
+      TESTASSERT(get_u16(&pdu->msg[4]) == pdu->N_bytes - 40);
+    }
+  }
+
+  tun.stop();
+  tun_io_stats_t s = tun.get_stats();
+  TESTASSERT(s.rx_pkts == 1);
+  TESTASSERT(s.rx_sdus == nof_segs);
+  TESTASSERT(s.rx_dropped == 0);
+  return SRSLTE_SUCCESS;
+}
+
+int test_csum_offload()
+{
+  srslte::log_filter log("GW");
+  log.set_level(srslte::LOG_LEVEL_WARNING);
+
+  tun_emulator  tun_emu(1);
+  pdcp_stub     pdcp;
+  tun_io        tun(&log);
+  tun_io_args_t args = {};
+  args.vnet_hdr      = true;
+  TESTASSERT(tun.attach(args, tun_emu.stack_fds) == SRSLTE_SUCCESS);
+  tun.start(&pdcp, -1);
+
+  // The kernel only fills in the pseudo-header sum, the GW has to complete the checksum
+  uint8_t        buf[sizeof(tun_vnet_hdr_t) + V4_HDR + 100];
+  tun_vnet_hdr_t vh = {};
+  vh.flags          = tun_vnet_hdr_t::F_NEEDS_CSUM;
+  vh.csum_start     = 20;
+  vh.csum_offset    = 16;
+  memcpy(buf, &vh, sizeof(vh));
+  uint8_t* ip  = buf + sizeof(vh);
+  uint32_t len = build_tcp_pkt(ip, true, 1000, 1, 100, PSH_ACK);
+  uint16_t c   = pseudo_sum(ip, len - 20);
+  ip[36]       = c >> 8;
+  ip[37]       = c & 0xff;
+  TESTASSERT(not tcp_csum_ok(ip, len));
+  TESTASSERT(send(tun_emu.kernel_fds[0], buf, sizeof(vh) + len, 0) == (ssize_t)(sizeof(vh) + len));
+
+  TESTASSERT(pdcp.wait_pdus(1));
+  TESTASSERT(pdcp.pdus[0]->N_bytes == len);
+  TESTASSERT(tcp_csum_ok(pdcp.pdus[0]->msg, len));
+  tun.stop();
+  return SRSLTE_SUCCESS;
+}
+
+int test_gro_coalesce()
+{
+  srslte::log_filter log("GW");
+  log.set_level(srslte::LOG_LEVEL_WARNING);
+  srslte::byte_buffer_pool* pool = srslte::byte_buffer_pool::get_instance();
+
+  tun_emulator  tun_emu(1);
+  tun_io        tun(&log);
+  tun_io_args_t args = {};
+  args.vnet_hdr      = true;
+  args.dl_batch      = true;
+  TESTASSERT(tun.attach(args, tun_emu.stack_fds) == SRSLTE_SUCCESS);
+
+  auto write_tcp = [&](uint16_t port, uint32_t seq, uint32_t payload_len, uint8_t flags) {
+    srslte::unique_byte_buffer_t pdu = srslte::allocate_unique_buffer(*pool, true);
+    pdu->N_bytes                     = build_tcp_pkt(pdu->msg, true, port, seq, payload_len, flags);
+    tun.write_pdu(std::move(pdu));
+  };
+
+  // One TTI worth of DL packets: 10 in-order segments of one flow, a packet of another flow that starts a new run
+  // and an out-of-order segment
+  const uint32_t seq = 5000;
+  for (uint32_t i = 0; i < 9; ++i) {
+    write_tcp(1000, seq + i * MSS, MSS, ACK);
+  }
+  write_tcp(1000, seq + 9 * MSS, 500, PSH_ACK);
+  write_tcp(2000, 1, MSS, ACK);
+  write_tcp(2000, 1 + 2 * MSS, MSS, ACK);
+
+  // Nothing is written before the end of the TTI
+  uint8_t buf[sizeof(tun_vnet_hdr_t) + 65536];
+  TESTASSERT(recv(tun_emu.kernel_fds[0], buf, sizeof(buf), MSG_DONTWAIT) < 0 and errno == EAGAIN);
+  tun.flush();
+
+  // The first flow arrives as a single super-packet
+  ssize_t        n = recv(tun_emu.kernel_fds[0], buf, sizeof(buf), MSG_DONTWAIT);
+  tun_vnet_hdr_t vh;
+  memcpy(&vh, buf, sizeof(vh));
+  uint8_t* ip      = buf + sizeof(vh);
+  uint32_t pkt_len = V4_HDR + 9 * MSS + 500;
+  TESTASSERT(n == (ssize_t)(sizeof(vh) + pkt_len));
+  TESTASSERT(vh.gso_type == tun_vnet_hdr_t::GSO_TCPV4);
+  TESTASSERT(vh.flags == tun_vnet_hdr_t::F_NEEDS_CSUM);
+  TESTASSERT(vh.gso_size == MSS);
+  TESTASSERT(vh.hdr_len == V4_HDR);
+  TESTASSERT(vh.csum_start == 20 and vh.csum_offset == 16);
+  TESTASSERT(get_u16(&ip[2]) == pkt_len);
+  TESTASSERT(ipv4_csum_ok(ip));
+  TESTASSERT(ip[33] == PSH_ACK);
+  TESTASSERT(get_seq(ip) == seq);
+  TESTASSERT(payload_ok(ip + V4_HDR, seq, 9 * MSS + 500));
+  // Complete the partial checksum the way the kernel does and check the result
+  uint16_t c = ~csum_sum(ip + 20, pkt_len - 20);
+  ip[36]     = c >> 8;
+  ip[37]     = c & 0xff;
+  TESTASSERT(tcp_csum_ok(ip, pkt_len));
+
+  // The other flow has a gap, so both of its packets are written on their own
+  for (uint32_t i = 0; i < 2; ++i) {
+    n = recv(tun_emu.kernel_fds[0], buf, sizeof(buf), MSG_DONTWAIT);
+    memcpy(&vh, buf, sizeof(vh));
+    TESTASSERT(n == (ssize_t)(sizeof(vh) + V4_HDR + MSS));
+    TESTASSERT(vh.gso_type == tun_vnet_hdr_t::GSO_NONE and vh.flags == 0);
+    TESTASSERT(tcp_csum_ok(buf + sizeof(vh), V4_HDR + MSS));
+  }
+  TESTASSERT(recv(tun_emu.kernel_fds[0], buf, sizeof(buf), MSG_DONTWAIT) < 0);
+
+  tun_io_stats_t s = tun.get_stats();
+  TESTASSERT(s.tx_pkts == 12);
+  TESTASSERT(s.tx_writes == 3);
+  TESTASSERT(s.tx_dropped == 0);
+  tun.stop();
+  return SRSLTE_SUCCESS;
+}
+
+// Measures the UL rate from the emulated kernel side through the receive threads into the stub PDCP, once with a
+// packet per read and once with 64 kB super-packets, and the DL write rate with and without per-TTI batching
+int test_throughput(uint32_t nof_queues, bool vnet_hdr)
+{
+  srslte::log_filter log("GW");
+  log.set_level(srslte::LOG_LEVEL_WARNING);
+  srslte::byte_buffer_pool* pool = srslte::byte_buffer_pool::get_instance();
+
+  tun_emulator  tun_emu(nof_queues);
+  pdcp_stub     pdcp;
+  tun_io        tun(&log);
+  tun_io_args_t args = {};
+  args.nof_queues    = nof_queues;
+  args.vnet_hdr      = vnet_hdr;
+  args.dl_batch      = vnet_hdr;
+  pdcp.keep_pdus     = false;
+  TESTASSERT(tun.attach(args, tun_emu.stack_fds) == SRSLTE_SUCCESS);
+  tun.start(&pdcp, -1);
+
+  // UL: every queue carries 32 MB of TCP payload
+  const uint32_t bytes_per_queue = 32 * 1024 * 1024;
+  const uint32_t super_payload   = 44 * MSS;
+  uint32_t       nof_reads       = vnet_hdr ? bytes_per_queue / super_payload : bytes_per_queue / MSS;
+  uint64_t       nof_segs        = (uint64_t)nof_queues * (vnet_hdr ? nof_reads * 44 : nof_reads);
+
+  auto                     tic = std::chrono::steady_clock::now();
+  std::vector<std::thread> kernel;
+  for (uint32_t q = 0; q < nof_queues; ++q) {
+    kernel.emplace_back([&, q]() {
+      std::vector<uint8_t> pkt(V4_HDR + MSS);
+      build_tcp_pkt(pkt.data(), true, 1000 + q, 0, MSS, ACK);
+      for (uint32_t i = 0; i < nof_reads; ++i) {
+        if (vnet_hdr) {
+          send_gso(tun_emu.kernel_fds[q], true, i * super_payload, super_payload, ACK);
+        } else {
+          send(tun_emu.kernel_fds[q], pkt.data(), pkt.size(), 0);
+        }
+      }
+    });
+  }
+  for (auto& t : kernel) {
+    t.join();
+  }
+  TESTASSERT(pdcp.wait_pdus(nof_segs, 20000));
+  double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - tic).count();
+  printf("UL queues=%d vnet_hdr=%d: %" PRIu64 " IP packets in %" PRIu64 " reads, %.1f Mbps\n",
+         nof_queues,
+         vnet_hdr,
+         nof_segs,
+         tun.get_stats().rx_pkts,
+         pdcp.nof_bytes * 8 / secs / 1e6);
+
+  // DL: 10 TTIs of 40 segments each, drained by the emulated kernel
+  const uint32_t nof_ttis = 10, pdus_per_tti = 40;
+  tic                     = std::chrono::steady_clock::now();
+  for (uint32_t tti = 0; tti < nof_ttis; ++tti) {
+    for (uint32_t i = 0; i < pdus_per_tti; ++i) {
+      srslte::unique_byte_buffer_t pdu = srslte::allocate_unique_buffer(*pool, true);
+      pdu->N_bytes = build_tcp_pkt(pdu->msg, true, 1000, (tti * pdus_per_tti + i) * MSS, MSS, ACK);
+      tun.write_pdu(std::move(pdu));
+    }
+    tun.flush();
+    uint8_t buf[sizeof(tun_vnet_hdr_t) + 65536];
+    while (recv(tun_emu.kernel_fds[0], buf, sizeof(buf), MSG_DONTWAIT) > 0) {
+    }
+  }
+  secs             = std::chrono::duration<double>(std::chrono::steady_clock::now() - tic).count();
+  tun_io_stats_t s = tun.get_stats();
+  printf("DL queues=%d vnet_hdr=%d: %" PRIu64 " IP packets in %" PRIu64 " writes, %.1f Mbps\n",
+         nof_queues,
+         vnet_hdr,
+         s.tx_pkts,
+         s.tx_writes,
+         s.tx_pkts * (V4_HDR + MSS) * 8 / secs / 1e6);
+  TESTASSERT(s.tx_pkts == nof_ttis * pdus_per_tti);
+  TESTASSERT(s.tx_dropped == 0);
+  TESTASSERT(s.tx_writes == (vnet_hdr ? nof_ttis : s.tx_pkts));
+
+  tun.stop();
+  return SRSLTE_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+  TESTASSERT(test_gso_split(true) == SRSLTE_SUCCESS);
+  TESTASSERT(test_gso_split(false) == SRSLTE_SUCCESS);
+  TESTASSERT(test_csum_offload() == SRSLTE_SUCCESS);
+  TESTASSERT(test_gro_coalesce() == SRSLTE_SUCCESS);
+  TESTASSERT(test_throughput(1, false) == SRSLTE_SUCCESS);
+  TESTASSERT(test_throughput(1, true) == SRSLTE_SUCCESS);
+  TESTASSERT(test_throughput(4, true) == SRSLTE_SUCCESS);
+  return SRSLTE_SUCCESS;
+}